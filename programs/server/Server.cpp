@@ -37,6 +37,7 @@
 #include <CloudServices/CnchServerServiceImpl.h>
 #include <CloudServices/CnchWorkerClientPools.h>
 #include <CloudServices/CnchWorkerServiceImpl.h>
+#include <Compression/CompressionDictionaryStore.h>
 #include <DataTypes/MapHelpers.h>
 #include <Core/ServerUUID.h>
 #include <Dictionaries/registerDictionaries.h>
@@ -48,6 +49,7 @@
 #include <IO/Scheduler/IOScheduler.h>
 #include <IO/UseSSL.h>
 #include <Interpreters/AsynchronousMetrics.h>
+#include <Interpreters/CacheSizeArbiter.h>
 #include <Interpreters/DDLWorker.h>
 #include <Interpreters/DNSCacheUpdater.h>
 #include <Interpreters/DatabaseCatalog.h>
@@ -116,6 +118,7 @@
 #include <Common/StringUtils/StringUtils.h>
 #include <Common/TLDListsHolder.h>
 #include <Common/ThreadFuzzer.h>
+#include <Common/ThreadPool.h>
 #include <Common/ThreadProfileEvents.h>
 #include <Common/ThreadStatus.h>
 #include <Common/ZooKeeper/ZooKeeper.h>
@@ -861,7 +864,12 @@ int Server::main(const std::vector<std::string> & /*args*/)
         // global_context->setTemporaryStoragePath(tmp_path, 0);
 
         for (const DiskPtr & disk : volume->getDisks())
-            setupTmpPath(log, disk->getPath());
+        {
+            /// Clearing leftovers only makes sense for local disks; a remote temporary
+            /// disk (tmp_policy pointing at bytehdfs and alike) has no local path
+            if (disk->getType() == DiskType::Type::Local)
+                setupTmpPath(log, disk->getPath());
+        }
         global_context->setTemporaryStoragePath();
     }
 
@@ -890,6 +898,10 @@ int Server::main(const std::vector<std::string> & /*args*/)
         fs::create_directories(dictionaries_lib_path);
     }
 
+    /// pre-trained dictionaries for CODEC(ZSTD_DICT), looked up lazily by id
+    if (config().has("compression_dictionary_path"))
+        CompressionDictionaryStore::instance().setLookupPath(config().getString("compression_dictionary_path"));
+
     /// top_level_domains_lists
     {
         const std::string & top_level_domains_path = config().getString("top_level_domains_path", fs::path(path) / "top_level_domains/");
@@ -1205,7 +1217,14 @@ int Server::main(const std::vector<std::string> & /*args*/)
         LOG_INFO(log, "Mark cache size was lowered to {} because the system has low amount of memory",
             formatReadableSizeWithBinarySuffix(mark_cache_size));
     }
-    global_context->setMarkCache(mark_cache_size);
+    /// Optional second in-memory tier keeping evicted marks delta-compressed, see MarkCache.
+    size_t compressed_mark_cache_size = config().getUInt64("compressed_mark_cache_size", 0);
+    global_context->setMarkCache(mark_cache_size, compressed_mark_cache_size);
+
+    /// Optional cache of decoded LowCardinality dictionaries shared across parts, disabled when 0.
+    size_t low_cardinality_dictionary_cache_size = config().getUInt64("low_cardinality_dictionary_cache_size", 0);
+    if (low_cardinality_dictionary_cache_size)
+        global_context->setLowCardinalityDictionaryCache(low_cardinality_dictionary_cache_size);
 
     /// A cache for part checksums
     ChecksumsCacheSettings checksum_cache_settings;
@@ -1245,6 +1264,10 @@ int Server::main(const std::vector<std::string> & /*args*/)
     if (global_context->getServerType() == ServerType::cnch_server)
         global_context->setQueryCache(config());
 
+    /// A cache for plan segment results of repeated sub-plans.
+    if (global_context->getServerType() == ServerType::cnch_worker)
+        global_context->setPlanSegmentResultCache(config());
+
     /// Size of delete bitmap for HaMergeTree engine to be cached in memory; default is 1GB
     size_t delete_bitmap_cache_size = config().getUInt64("delete_bitmap_cache_size", 1073741824);
     global_context->setDeleteBitmapCache(delete_bitmap_cache_size);
@@ -1340,40 +1363,6 @@ int Server::main(const std::vector<std::string> & /*args*/)
         registerDefaultHdfsFileSystem(hdfs_params, hdfs_max_fd_num, hdfs_skip_fd_num, hdfs_io_error_num_to_reconnect);
     }
 
-#endif
-
-    try
-    {
-        DiskCacheFactory::instance().init(*global_context);
-    }
-    catch (...)
-    {
-        tryLogCurrentException(__PRETTY_FUNCTION__);
-        throw;
-    }
-
-    /// Disk cache for unique key index
-    size_t uki_disk_cache_max_bytes = 50 * 1024 * 1024 * 1024UL; // 50GB
-    for (const auto & [name, disk] : global_context->getDisksMap())
-    {
-        if (disk->getType() == DiskType::Type::Local && disk->getPath() == global_context->getPath())
-        {
-            Poco::File disk_path(disk->getPath());
-            if (!disk_path.canRead() || !disk_path.canWrite())
-                throw Exception("There is no RW access to disk " + name + " (" + disk->getPath() + ")", ErrorCodes::PATH_ACCESS_DENIED);
-            uki_disk_cache_max_bytes = std::min<size_t>(0.25 * disk->getAvailableSpace().bytes, uki_disk_cache_max_bytes);
-            break;
-        }
-    }
-    size_t unique_key_index_file_cache_size = config().getUInt64("unique_key_index_disk_cache_max_bytes", uki_disk_cache_max_bytes);
-    global_context->setUniqueKeyIndexFileCache(unique_key_index_file_cache_size);
-
-    global_context->setNvmCache(config());
-
-#if USE_EMBEDDED_COMPILER
-    constexpr size_t compiled_expression_cache_size_default = 1024 * 1024 * 128;
-    size_t compiled_expression_cache_size = config().getUInt64("compiled_expression_cache_size", compiled_expression_cache_size_default);
-    CompiledExpressionCacheFactory::instance().init(compiled_expression_cache_size);
 #endif
 
     /// Set path for format schema files
@@ -1383,17 +1372,85 @@ int Server::main(const std::vector<std::string> & /*args*/)
 
     auto remote_format_schema_path = config().getString("remote_format_schema_path", ""); // only hdfs for now
     global_context->setFormatSchemaPath(remote_format_schema_path, true);
-    try
-    {
-        reloadFormatSchema(remote_format_schema_path, format_schema_path.string(), log);
-    }
-    catch(const Exception &)
-    {
-        LOG_ERROR(log, "load remote format schema fail, reload it later manually");
-    }
-    catch(...)
+
+    /// The caches built below depend only on the disks initialized above and not on each
+    /// other, so build them concurrently. Scanning a populated disk cache and fetching
+    /// remote format schemas dominate restart time, and failover RTO depends on it.
     {
-        throw;
+        ThreadPool startup_pool(4);
+        ExceptionHandler startup_exception_handler;
+
+        startup_pool.scheduleOrThrowOnError(createExceptionHandledJob(
+            [&]
+            {
+                try
+                {
+                    DiskCacheFactory::instance().init(*global_context);
+                }
+                catch (...)
+                {
+                    tryLogCurrentException(__PRETTY_FUNCTION__);
+                    throw;
+                }
+            },
+            startup_exception_handler));
+
+        startup_pool.scheduleOrThrowOnError(createExceptionHandledJob(
+            [&]
+            {
+                /// Disk cache for unique key index
+                size_t uki_disk_cache_max_bytes = 50 * 1024 * 1024 * 1024UL; // 50GB
+                for (const auto & [name, disk] : global_context->getDisksMap())
+                {
+                    if (disk->getType() == DiskType::Type::Local && disk->getPath() == global_context->getPath())
+                    {
+                        Poco::File disk_path(disk->getPath());
+                        if (!disk_path.canRead() || !disk_path.canWrite())
+                            throw Exception("There is no RW access to disk " + name + " (" + disk->getPath() + ")", ErrorCodes::PATH_ACCESS_DENIED);
+                        uki_disk_cache_max_bytes = std::min<size_t>(0.25 * disk->getAvailableSpace().bytes, uki_disk_cache_max_bytes);
+                        break;
+                    }
+                }
+                size_t unique_key_index_file_cache_size = config().getUInt64("unique_key_index_disk_cache_max_bytes", uki_disk_cache_max_bytes);
+                global_context->setUniqueKeyIndexFileCache(unique_key_index_file_cache_size);
+
+                global_context->setNvmCache(config());
+            },
+            startup_exception_handler));
+
+#if USE_EMBEDDED_COMPILER
+        startup_pool.scheduleOrThrowOnError(createExceptionHandledJob(
+            [&]
+            {
+                constexpr size_t compiled_expression_cache_size_default = 1024 * 1024 * 128;
+                size_t compiled_expression_cache_size = config().getUInt64("compiled_expression_cache_size", compiled_expression_cache_size_default);
+                CompiledExpressionCacheFactory::instance().init(compiled_expression_cache_size);
+
+                /// When a path is configured, compiled expression object code is persisted there and
+                /// reused across restarts instead of being recompiled.
+                String compiled_expression_cache_path = config().getString("compiled_expression_cache_path", "");
+                if (!compiled_expression_cache_path.empty())
+                    CompiledModuleObjectCache::instance().init(compiled_expression_cache_path);
+            },
+            startup_exception_handler));
+#endif
+
+        startup_pool.scheduleOrThrowOnError(createExceptionHandledJob(
+            [&]
+            {
+                try
+                {
+                    reloadFormatSchema(remote_format_schema_path, format_schema_path.string(), log);
+                }
+                catch (const Exception &)
+                {
+                    LOG_ERROR(log, "load remote format schema fail, reload it later manually");
+                }
+            },
+            startup_exception_handler));
+
+        startup_pool.wait();
+        startup_exception_handler.throwIfException();
     }
 
     // Note:: just for test.
@@ -1579,6 +1636,22 @@ int Server::main(const std::vector<std::string> & /*args*/)
         dns_cache_updater = std::make_unique<DNSCacheUpdater>(global_context, config().getInt("dns_cache_update_period", 15));
     }
 
+    /// One shared budget for the main in-memory caches: periodically shift capacity
+    /// towards whichever of them the current workload hits hardest. Disabled unless an
+    /// update period is configured.
+    std::unique_ptr<CacheSizeArbiter> cache_size_arbiter;
+    if (Int32 cache_arbiter_period = config().getInt("cache_size_arbiter_update_period", 0); cache_arbiter_period > 0)
+    {
+        cache_size_arbiter = std::make_unique<CacheSizeArbiter>(global_context, cache_arbiter_period);
+        if (auto cache = global_context->getUncompressedCache())
+            cache_size_arbiter->addCache("UncompressedCache", cache, uncompressed_cache_size / 4);
+        if (auto cache = global_context->getMarkCache())
+            cache_size_arbiter->addCache("MarkCache", cache, mark_cache_size / 4);
+        if (auto cache = global_context->getPrimaryIndexCache())
+            cache_size_arbiter->addCache("PrimaryIndexCache", cache, primary_index_cache_size / 4);
+        cache_size_arbiter->start();
+    }
+
 #if defined(OS_LINUX)
     if (!TasksStatsCounters::checkIfAvailable())
     {
@@ -1,6 +1,7 @@
 #include <Analyzers/SubstituteLiteralToPreparedParams.h>
 
 #include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesDecimal.h>
 #include <DataTypes/DataTypesNumber.h>
 #include <Parsers/ASTPreparedParameter.h>
 #include <Common/FieldVisitors.h>
@@ -60,7 +61,7 @@ namespace
         }
         DataTypePtr operator()(const Float64 &) const
         {
-            return nullptr;
+            return std::make_shared<DataTypeFloat64>();
         }
         DataTypePtr operator()(const String &) const
         {
@@ -82,21 +83,21 @@ namespace
         {
             return nullptr;
         }
-        DataTypePtr operator()(const DecimalField<Decimal32> &) const
+        DataTypePtr operator()(const DecimalField<Decimal32> & x) const
         {
-            return nullptr;
+            return std::make_shared<DataTypeDecimal<Decimal32>>(DecimalUtils::max_precision<Decimal32>, x.getScale());
         }
-        DataTypePtr operator()(const DecimalField<Decimal64> &) const
+        DataTypePtr operator()(const DecimalField<Decimal64> & x) const
         {
-            return nullptr;
+            return std::make_shared<DataTypeDecimal<Decimal64>>(DecimalUtils::max_precision<Decimal64>, x.getScale());
         }
-        DataTypePtr operator()(const DecimalField<Decimal128> &) const
+        DataTypePtr operator()(const DecimalField<Decimal128> & x) const
         {
-            return nullptr;
+            return std::make_shared<DataTypeDecimal<Decimal128>>(DecimalUtils::max_precision<Decimal128>, x.getScale());
         }
-        DataTypePtr operator()(const DecimalField<Decimal256> &) const
+        DataTypePtr operator()(const DecimalField<Decimal256> & x) const
         {
-            return nullptr;
+            return std::make_shared<DataTypeDecimal<Decimal256>>(DecimalUtils::max_precision<Decimal256>, x.getScale());
         }
         DataTypePtr operator()(const AggregateFunctionStateData &) const
         {
@@ -45,6 +45,7 @@
 #include <Common/ProfileEvents.h>
 #include <Common/RpcClientPool.h>
 #include <Common/ScanWaitFreeMap.h>
+#include <Common/ThreadPool.h>
 #include <Common/Status.h>
 #include <Common/serverLocality.h>
 #include "Interpreters/DistributedStages/PlanSegmentInstance.h"
@@ -58,6 +59,7 @@
 #include <IO/WriteHelpers.h>
 #include <MergeTreeCommon/CnchTopologyMaster.h>
 #include <Parsers/formatAST.h>
+#include <Protos/DataModelHelpers.h>
 #include <Protos/RPCHelpers.h>
 #include <Protos/data_models.pb.h>
 #include <Statistics/ExportSymbols.h>
@@ -244,6 +246,8 @@ namespace ProfileEvents
     extern const Event SetTransactionRecordFailed;
     extern const Event SetTransactionRecordWithRequestsSuccess;
     extern const Event SetTransactionRecordWithRequestsFailed;
+    extern const Event SetTransactionRecordsSuccess;
+    extern const Event SetTransactionRecordsFailed;
     extern const Event SetTransactionRecordCleanTimeSuccess;
     extern const Event SetTransactionRecordCleanTimeFailed;
     extern const Event SetTransactionRecordStatusWithOffsetsSuccess;
@@ -294,6 +298,10 @@ namespace ProfileEvents
     extern const Event ClearFilesysLockTxnIdFailed;
     extern const Event GetAllFilesysLockSuccess;
     extern const Event GetAllFilesysLockFailed;
+    extern const Event TryClaimGlobalGCPartitionSuccess;
+    extern const Event TryClaimGlobalGCPartitionFailed;
+    extern const Event ReleaseGlobalGCPartitionSuccess;
+    extern const Event ReleaseGlobalGCPartitionFailed;
     extern const Event InsertTransactionSuccess;
     extern const Event InsertTransactionFailed;
     extern const Event RemoveTransactionSuccess;
@@ -514,6 +522,7 @@ namespace ErrorCodes
     extern const int UNKNOWN_MASKING_POLICY_NAME;
     extern const int BUCKET_TABLE_ENGINE_MISMATCH;
     extern const int ACCESS_ENTITY_ALREADY_EXISTS;
+    extern const int METASTORE_COMMIT_CAS_FAILURE;
 }
 
 namespace Catalog
@@ -1157,8 +1166,9 @@ namespace Catalog
                     }
                     else if (is_local_server)
                     {
-                        // update cache with nullptr and latest table commit_time to prevent an old version be inserted into cache.
-                        // the cache will be reloaded in following getTable
+                        // publish a nullptr placeholder for the new commit_time. Older cached versions stay
+                        // live for queries whose read snapshot predates the ALTER; the first getTable at a
+                        // newer snapshot rebuilds the storage and fills in the placeholder.
                         cache_manager->insertStorageCache(storage->getStorageID(), nullptr, table->commit_time(), host_port.topology_version);
                     }
                 }
@@ -1337,7 +1347,8 @@ namespace Catalog
 
                 if (is_host_server && cache_manager)
                 {
-                    auto cached_storage = cache_manager->getStorageFromCache(UUIDHelpers::toUUID(table_id->uuid()), host_server.topology_version);
+                    auto cached_storage
+                        = cache_manager->getStorageFromCache(UUIDHelpers::toUUID(table_id->uuid()), host_server.topology_version, ts.toUInt64());
                     if (cached_storage && cached_storage->commit_time <= ts && cached_storage->getStorageID().database_name == database && cached_storage->getStorageID().table_name == name)
                     {
                         res = cached_storage;
@@ -1408,7 +1419,8 @@ namespace Catalog
                 {
                     if (current_topology_version != PairInt64(0, 0))
                     {
-                        auto cached_storage = cache_manager->getStorageFromCache(UUIDHelpers::toUUID(uuid), current_topology_version);
+                        auto cached_storage
+                            = cache_manager->getStorageFromCache(UUIDHelpers::toUUID(uuid), current_topology_version, ts.toUInt64());
                         if (cached_storage && cached_storage->commit_time <= ts)
                         {
                             auto host_server = current_topology.getTargetServer(uuid, cached_storage->getServerVwName());
@@ -1697,10 +1709,11 @@ namespace Catalog
         const TxnTimestamp & ts,
         const Context * session_context,
         const VisibilityLevel visibility,
-        const std::set<Int64> & bucket_numbers)
+        const std::set<Int64> & bucket_numbers,
+        const CachedPartsFilter & parts_filter)
     {
         ServerDataPartsWithDBM res;
-        res.first = getServerDataPartsInPartitions(storage, partitions, ts, session_context, VisibilityLevel::All, bucket_numbers);
+        res.first = getServerDataPartsInPartitions(storage, partitions, ts, session_context, VisibilityLevel::All, bucket_numbers, parts_filter);
 
         if (res.first.empty())
             return res;
@@ -1751,13 +1764,50 @@ namespace Catalog
         return res;
     }
 
+    std::vector<ServerDataPartsWithDBM> Catalog::getServerDataPartsInPartitionsWithDBMForTables(
+        const std::vector<TablePartitions> & requests,
+        const TxnTimestamp & ts,
+        const Context * session_context,
+        const VisibilityLevel visibility)
+    {
+        std::vector<ServerDataPartsWithDBM> res(requests.size());
+        if (requests.empty())
+            return res;
+
+        size_t max_threads = std::min<size_t>(settings.fetch_parts_max_threads, requests.size());
+        if (max_threads < 2)
+        {
+            for (size_t i = 0; i < requests.size(); ++i)
+                res[i] = getServerDataPartsInPartitionsWithDBM(
+                    requests[i].storage, requests[i].partitions, ts, session_context, visibility, requests[i].bucket_numbers);
+            return res;
+        }
+
+        /// Every fetch filters visibility with the same timestamp, so the combined result is
+        /// the snapshot a serial loop would see; running the fetches concurrently collapses
+        /// one round of metastore latency per table into a single round.
+        ExceptionHandler exception_handler;
+        ThreadPool thread_pool(max_threads);
+        for (size_t i = 0; i < requests.size(); ++i)
+            thread_pool.scheduleOrThrowOnError(createExceptionHandledJob(
+                [&, i] {
+                    res[i] = getServerDataPartsInPartitionsWithDBM(
+                        requests[i].storage, requests[i].partitions, ts, session_context, visibility, requests[i].bucket_numbers);
+                },
+                exception_handler));
+        thread_pool.wait();
+        exception_handler.throwIfException();
+        return res;
+    }
+
     DB::ServerDataPartsVector Catalog::getServerDataPartsInPartitions(
         const ConstStoragePtr & storage,
         const Strings & partitions,
         const TxnTimestamp & ts,
         const Context * session_context,
         const VisibilityLevel visibility,
-        const std::set<Int64> & bucket_numbers)
+        const std::set<Int64> & bucket_numbers,
+        const CachedPartsFilter & parts_filter)
     {
         ServerDataPartsVector res;
         String source;
@@ -1825,7 +1875,8 @@ namespace Catalog
                                 return ret;
                             },
                             ts.toUInt64(),
-                            host_port.topology_version);
+                            host_port.topology_version,
+                            parts_filter);
                         if (miss_cache)
                             source = "KV(miss cache)";
                     }
@@ -2485,11 +2536,13 @@ namespace Catalog
         }
         else
         {
-            // commit data parts first
+            std::vector<BatchedCommitIndex> batches;
+
+            // batch data parts first
             size_t batch_count{0};
             while (batch_count + settings.max_commit_size_one_batch < total_parts_number)
             {
-                commit_in_batch(
+                batches.push_back(
                     {batch_count,
                      batch_count + settings.max_commit_size_one_batch,
                      0,
@@ -2504,13 +2557,13 @@ namespace Catalog
                      0});
                 batch_count += settings.max_commit_size_one_batch;
             }
-            commit_in_batch({batch_count, total_parts_number, 0, 0, 0, 0, batch_count, total_parts_number, 0, 0, 0, 0});
+            batches.push_back({batch_count, total_parts_number, 0, 0, 0, 0, batch_count, total_parts_number, 0, 0, 0, 0});
 
-            // then commit delete bitmap
+            // then delete bitmap
             batch_count = 0;
             while (batch_count + settings.max_commit_size_one_batch < delete_bitmaps.size())
             {
-                commit_in_batch(
+                batches.push_back(
                     {0,
                      0,
                      batch_count,
@@ -2525,13 +2578,13 @@ namespace Catalog
                      0});
                 batch_count += settings.max_commit_size_one_batch;
             }
-            commit_in_batch({0, 0, batch_count, total_deleted_bitmaps_number, 0, 0, 0, 0, batch_count, total_deleted_bitmaps_number, 0, 0});
+            batches.push_back({0, 0, batch_count, total_deleted_bitmaps_number, 0, 0, 0, 0, batch_count, total_deleted_bitmaps_number, 0, 0});
 
-            // then commit staged parts
+            // then staged parts
             batch_count = 0;
             while (batch_count + settings.max_commit_size_one_batch < total_staged_parts_num)
             {
-                commit_in_batch(
+                batches.push_back(
                     {0,
                      0,
                      0,
@@ -2546,7 +2599,27 @@ namespace Catalog
                      batch_count + settings.max_commit_size_one_batch});
                 batch_count += settings.max_commit_size_one_batch;
             }
-            commit_in_batch({0, 0, 0, 0, batch_count, total_staged_parts_num, 0, 0, 0, 0, batch_count, total_staged_parts_num});
+            batches.push_back({0, 0, 0, 0, batch_count, total_staged_parts_num, 0, 0, 0, 0, batch_count, total_staged_parts_num});
+
+            size_t max_threads = std::min<size_t>(settings.commit_parts_max_threads, batches.size());
+            if (max_threads < 2)
+            {
+                for (const auto & batch : batches)
+                    commit_in_batch(batch);
+            }
+            else
+            {
+                /// Batches cover disjoint key ranges and the overall commit is already not
+                /// atomic across them, so writing them concurrently only shortens the window
+                /// for oversized (10k+ parts) bulk loads.
+                ExceptionHandler exception_handler;
+                ThreadPool thread_pool(max_threads);
+                for (const auto & batch : batches)
+                    thread_pool.scheduleOrThrowOnError(
+                        createExceptionHandledJob([&, batch] { commit_in_batch(batch); }, exception_handler));
+                thread_pool.wait();
+                exception_handler.throwIfException();
+            }
         }
     }
 
@@ -2828,12 +2901,17 @@ namespace Catalog
     Strings Catalog::getPartitionIDsFromMetastore(const ConstStoragePtr & storage)
     {
         Strings partitions_id;
+        /// The partition id is embedded in the meta key (see tablePartitionInfoKey: prefix + id + '_'),
+        /// so listing ids only needs the keys. Skip deserializing the PartitionMeta value per entry;
+        /// for tables with very many partitions this removes the dominant decode cost of the scan.
+        const String key_prefix
+            = MetastoreProxy::tablePartitionInfoPrefix(name_space, UUIDHelpers::UUIDToString(storage->getStorageID().uuid));
         IMetaStore::IteratorPtr it = meta_proxy->getPartitionList(name_space, UUIDHelpers::UUIDToString(storage->getStorageID().uuid));
         while (it->next())
         {
-            Protos::PartitionMeta partition_meta;
-            partition_meta.ParseFromString(it->value());
-            partitions_id.emplace_back(partition_meta.id());
+            const String & key = it->key();
+            chassert(key.size() > key_prefix.size());
+            partitions_id.emplace_back(key.substr(key_prefix.size(), key.size() - key_prefix.size() - 1));
         }
         return partitions_id;
     }
@@ -3189,6 +3267,40 @@ namespace Catalog
         return res;
     }
 
+    bool Catalog::setTransactionRecords(const std::vector<std::pair<TransactionRecord, TransactionRecord>> & expected_and_target)
+    {
+        bool res;
+        runWithMetricSupport(
+            [&] {
+                BatchCommitRequest requests(true, false);
+                for (const auto & [expected_record, target_record] : expected_and_target)
+                {
+                    requests.AddPut(SinglePutRequest(
+                        MetastoreProxy::transactionRecordKey(name_space, expected_record.txnID().toUInt64()),
+                        target_record.serialize(),
+                        expected_record.serialize()));
+                }
+
+                try
+                {
+                    BatchCommitResponse response;
+                    meta_proxy->batchWrite(requests, response);
+                    res = true;
+                }
+                catch (Exception & e)
+                {
+                    /// The batch is rejected as a whole on any CAS mismatch; callers retry each
+                    /// record through the individual commit path which reports per-record conflicts.
+                    if (e.code() != ErrorCodes::METASTORE_COMMIT_CAS_FAILURE)
+                        throw;
+                    res = false;
+                }
+            },
+            ProfileEvents::SetTransactionRecordsSuccess,
+            ProfileEvents::SetTransactionRecordsFailed);
+        return res;
+    }
+
     void Catalog::setTransactionRecordCleanTime(TransactionRecord record, const TxnTimestamp & clean_ts, UInt64 ttl)
     {
         runWithMetricSupport(
@@ -4320,6 +4432,27 @@ namespace Catalog
         return res;
     }
 
+    bool Catalog::tryClaimGlobalGCPartition(const String & table_uuid, const String & partition_id, const String & owner, UInt64 lease_sec)
+    {
+        bool res = false;
+        runWithMetricSupport(
+            [&] {
+                UInt64 expire_ts = static_cast<UInt64>(time(nullptr)) + lease_sec;
+                res = meta_proxy->tryClaimGlobalGCPartition(name_space, table_uuid, partition_id, owner, expire_ts);
+            },
+            ProfileEvents::TryClaimGlobalGCPartitionSuccess,
+            ProfileEvents::TryClaimGlobalGCPartitionFailed);
+        return res;
+    }
+
+    void Catalog::releaseGlobalGCPartition(const String & table_uuid, const String & partition_id)
+    {
+        runWithMetricSupport(
+            [&] { meta_proxy->releaseGlobalGCPartition(name_space, table_uuid, partition_id); },
+            ProfileEvents::ReleaseGlobalGCPartitionSuccess,
+            ProfileEvents::ReleaseGlobalGCPartitionFailed);
+    }
+
     void Catalog::insertTransaction(TxnTimestamp & txnID)
     {
         runWithMetricSupport(
@@ -4921,9 +5054,21 @@ namespace Catalog
         {
             batch_writes.AddDelete(part_meta_prefix + part->info().getPartName());
             if (!is_zombie_with_staging_txn_id)
+            {
+                String part_meta;
+                if (const auto * merge_tree = dynamic_cast<const MergeTreeMetaBase *>(table.get());
+                    merge_tree && !part->part_model().has_partition_minmax())
+                {
+                    /// Compact cached model: the trash record must carry the raw partition_minmax bytes.
+                    auto part_model = part->part_model();
+                    restorePartitionAndMinMaxIndex(*merge_tree, *part->part_model_wrapper, part_model);
+                    part_meta = part_model.SerializeAsString();
+                }
+                else
+                    part_meta = part->part_model_wrapper->part_model->SerializeAsString();
                 batch_writes.AddPut(
-                    {MetastoreProxy::dataPartKeyInTrash(name_space, table_uuid, part->name()),
-                    part->part_model_wrapper->part_model->SerializeAsString()});
+                    {MetastoreProxy::dataPartKeyInTrash(name_space, table_uuid, part->name()), std::move(part_meta)});
+            }
             LOG_DEBUG(
                 log,
                 "Will move part of table {} to trash: {} [{} - {}) {}",
@@ -5018,6 +5163,36 @@ namespace Catalog
             mgr->updateTrashItemsMetrics(table->getStorageUUID(), items, false);
     }
 
+    void Catalog::clearTrashItemsRange(const StoragePtr & table, const TrashItems & items)
+    {
+        if (items.empty())
+            return;
+
+        String table_uuid = UUIDHelpers::UUIDToString(table->getStorageUUID());
+
+        /// The end key is exclusive, so the upper bound of an inclusive run is the smallest key
+        /// greater than its last key.
+        auto next_key = [](String key) { key.push_back('\0'); return key; };
+
+        /// Part and delete bitmap records live under distinct sub-prefixes of the trash prefix,
+        /// so each kind forms its own contiguous run.
+        if (!items.data_parts.empty())
+            meta_proxy->cleanRange(
+                MetastoreProxy::dataPartKeyInTrash(name_space, table_uuid, items.data_parts.front()->name()),
+                next_key(MetastoreProxy::dataPartKeyInTrash(name_space, table_uuid, items.data_parts.back()->name())));
+
+        if (!items.delete_bitmaps.empty())
+            meta_proxy->cleanRange(
+                MetastoreProxy::deleteBitmapKeyInTrash(name_space, table_uuid, *(items.delete_bitmaps.front()->getModel())),
+                next_key(MetastoreProxy::deleteBitmapKeyInTrash(name_space, table_uuid, *(items.delete_bitmaps.back()->getModel()))));
+
+        LOG_DEBUG(log, "Removed trash record of {} parts and {} delete bitmaps by range.", items.data_parts.size(), items.delete_bitmaps.size());
+
+        /// Update trash items metrics.
+        if (auto mgr = context.getPartCacheManager())
+            mgr->updateTrashItemsMetrics(table->getStorageUUID(), items, false);
+    }
+
     std::vector<TxnTimestamp> Catalog::getSyncList(const StoragePtr & storage)
     {
         std::vector<TxnTimestamp> res;
@@ -6119,22 +6294,24 @@ namespace Catalog
         DataModelTables res;
         runWithMetricSupport(
             [&] {
-                for (auto & identifier : identifiers)
-                {
-                    const String & database_name = identifier->database();
-                    const String & table_name = identifier->name();
-                    const String & uuid = identifier->uuid();
+                /// Coalesce the per-table metastore reads into batched multi-gets so that
+                /// resolving N cold tables does not pay N sequential round trips.
+                Strings uuids;
+                uuids.reserve(identifiers.size());
+                for (const auto & identifier : identifiers)
+                    uuids.push_back(identifier->uuid());
 
-                    Strings tables_meta;
-                    meta_proxy->getTableByUUID(name_space, uuid, tables_meta);
+                Strings tables_meta = meta_proxy->getTablesByUUIDs(name_space, uuids);
 
-                    if (!tables_meta.empty())
-                    {
-                        DB::Protos::DataModelTable table_data;
-                        table_data.ParseFromString(tables_meta.back());
-                        replace_definition(table_data, database_name, table_name);
-                        res.push_back(table_data);
-                    }
+                for (size_t i = 0; i < identifiers.size(); ++i)
+                {
+                    if (tables_meta[i].empty())
+                        continue;
+
+                    DB::Protos::DataModelTable table_data;
+                    table_data.ParseFromString(tables_meta[i]);
+                    replace_definition(table_data, identifiers[i]->database(), identifiers[i]->name());
+                    res.push_back(table_data);
                 }
             },
             ProfileEvents::GetTablesByIDSuccess,
@@ -258,6 +258,8 @@ public:
      *
      * @param bucket_numbers If empty fetch all bucket_numbers (by default),
      * otherwise fetch the given bucket_numbers.
+     * @param parts_filter Optional pruning predicate pushed down into the part cache scan,
+     * parts it rejects are dropped before ServerDataPart objects are materialized.
      */
     ServerDataPartsWithDBM getServerDataPartsInPartitionsWithDBM(
         const ConstStoragePtr & storage,
@@ -265,7 +267,8 @@ public:
         const TxnTimestamp & ts,
         const Context * session_context,
         VisibilityLevel visibility = VisibilityLevel::Visible,
-        const std::set<Int64> & bucket_numbers = {});
+        const std::set<Int64> & bucket_numbers = {},
+        const CachedPartsFilter & parts_filter = {});
 
     /// @param bucket_numbers If empty fetch all bucket_numbers, otherwise fetch the given bucket_numbers.
     ServerDataPartsVector getServerDataPartsInPartitions(
@@ -274,7 +277,31 @@ public:
         const TxnTimestamp & ts,
         const Context * session_context,
         VisibilityLevel visibility = VisibilityLevel::Visible,
-        const std::set<Int64> & bucket_numbers = {});
+        const std::set<Int64> & bucket_numbers = {},
+        const CachedPartsFilter & parts_filter = {});
+
+    /// One table's slice of a multi-table part fetch, see getServerDataPartsInPartitionsWithDBMForTables.
+    struct TablePartitions
+    {
+        ConstStoragePtr storage;
+        Strings partitions;
+        std::set<Int64> bucket_numbers = {};
+    };
+
+    /**
+     * @brief Fetch parts (and delete bitmap metas for unique tables) for several tables
+     * under one transaction timestamp.
+     *
+     * Each per-table result is identical to a getServerDataPartsInPartitionsWithDBM call
+     * with the same arguments; the fetches run concurrently, so a query joining a fact
+     * table with several dimensions pays one round of metastore latency instead of one
+     * round per table. Results are returned in request order.
+     */
+    std::vector<ServerDataPartsWithDBM> getServerDataPartsInPartitionsWithDBMForTables(
+        const std::vector<TablePartitions> & requests,
+        const TxnTimestamp & ts,
+        const Context * session_context,
+        VisibilityLevel visibility = VisibilityLevel::Visible);
 
     ServerDataPartsWithDBM getTrashedPartsInPartitionsWithDBM(const ConstStoragePtr & storage, const Strings & partitions, const TxnTimestamp & ts);
 
@@ -390,6 +417,11 @@ public:
     bool setTransactionRecordWithRequests(
         const TransactionRecord & expected_record, TransactionRecord & record, BatchCommitRequest & request, BatchCommitResponse & response);
 
+    /// CAS operation over several transaction records at once (group commit).
+    /// The batch is all-or-nothing: returns false if any record hits a CAS conflict,
+    /// in which case none of the records were written.
+    bool setTransactionRecords(const std::vector<std::pair<TransactionRecord, TransactionRecord>> & expected_and_target);
+
     void setTransactionRecordCleanTime(TransactionRecord record, const TxnTimestamp & ts, UInt64 ttl);
 
     bool setTransactionRecordStatusWithOffsets(
@@ -529,6 +561,12 @@ public:
     /// get all filesys lock record
     std::vector<FilesysLock> getAllFilesysLock();
 
+    /// Lease-based partition claims for global GC so several server replicas can split the
+    /// data removal of one trashed table. Claims are best-effort: losing a race or taking
+    /// over an expired lease only leads to duplicate idempotent deletes.
+    bool tryClaimGlobalGCPartition(const String & table_uuid, const String & partition_id, const String & owner, UInt64 lease_sec);
+    void releaseGlobalGCPartition(const String & table_uuid, const String & partition_id);
+
     /// For discussion: as parts can be intents, need some extra transaction record check logic. Return all parts and do in server side?
     /// DataPartsVector getDataPartsInPartitions(const StoragePtr & storage, const Strings & partitions, const TxnTimestamp & ts = 0);
     ///DataPartsVector getAllDataParts(const StoragePtr & table, const TxnTimestamp & ts = 0);
@@ -611,6 +649,12 @@ public:
      */
     void clearTrashItems(const StoragePtr & table, const TrashItems & items);
 
+    /// Remove the trash records of `items` with one ranged metastore delete per item kind instead
+    /// of one delete per key. The caller must guarantee that the items form contiguous runs of the
+    /// table's trash key space (e.g. a complete, unfiltered scan batch), otherwise records of
+    /// unrelated trash items in between would be removed as well.
+    void clearTrashItemsRange(const StoragePtr & table, const TrashItems & items);
+
     /**
      * @brief Get all trashed parts in given table.
      *
@@ -86,11 +86,12 @@ StoragePtr CatalogFactory::getTableByDataModel(
     storage_ptr->latest_version = table_model->has_latest_version() ? TxnTimestamp{table_model->latest_version()} : TxnTimestamp::minTS();
     if (auto * merge_tree = dynamic_cast<MergeTreeMetaBase *>(storage_ptr.get()))
     {
-        merge_tree->part_columns = std::make_shared<NamesAndTypesList>(merge_tree->getInMemoryMetadataPtr()->getColumns().getAllPhysical());
+        /// Interned: tenants create thousands of tables with identical schemas, no need to hold a copy per table.
+        merge_tree->part_columns = internNamesAndTypesList(merge_tree->getInMemoryMetadataPtr()->getColumns().getAllPhysical());
         for (const auto & version : table_model->definitions())
         {
             auto s = getTableByDefinition(context, db, table, version.definition());
-            merge_tree->previous_versions_part_columns[version.commit_time()] = std::make_shared<NamesAndTypesList>(s->getInMemoryMetadataPtr()->getColumns().getAllPhysical());
+            merge_tree->previous_versions_part_columns[version.commit_time()] = internNamesAndTypesList(s->getInMemoryMetadataPtr()->getColumns().getAllPhysical());
         }
     }
     storage_ptr->is_dropped = DB::Status::isDeleted(table_model->status());
@@ -29,7 +29,9 @@ struct CatalogSettings
 
 #define APPLY_FOR_CATALOG_SETTINGS(M) \
     M(AtomicSettingUInt64, max_commit_size_one_batch, 500)                                                                 \
+    M(AtomicSettingUInt64, commit_parts_max_threads, 1)                                                                 \
     M(AtomicSettingUInt64, max_drop_size_one_batch, 1000)                                                               \
+    M(AtomicSettingUInt64, fetch_parts_max_threads, 16)                                                                 \
     M(AtomicSettingBool, write_undo_buffer_new_key, false)                                               \
 
 #define DECLARE(TYPE, NAME, DEFAULT) \
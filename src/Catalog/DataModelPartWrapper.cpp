@@ -179,7 +179,16 @@ MutableMergeTreeDataPartCNCHPtr ServerDataPart::toCNCHDataPart(
     /*const std::unordered_map<UInt32, String> & id_full_paths,*/
     const std::optional<std::string> & relative_path) const
 {
-    auto res = createPartFromModel(storage, part_model(), /*id_full_paths,*/ relative_path);
+    MutableMergeTreeDataPartCNCHPtr res;
+    if (!part_model().has_partition_minmax())
+    {
+        /// Compact cached model: put the raw partition_minmax bytes back before loading.
+        Protos::DataModelPart model_copy = part_model();
+        restorePartitionAndMinMaxIndex(storage, *part_model_wrapper, model_copy);
+        res = createPartFromModel(storage, model_copy, /*id_full_paths,*/ relative_path);
+    }
+    else
+        res = createPartFromModel(storage, part_model(), /*id_full_paths,*/ relative_path);
 
     /// Here we need to use the commit time of the server part to set the commit time, otherwise the commit time detected from the transaction may be lost which will affect the visibility.
     if (getCommitTime() != IMergeTreeDataPart::NOT_INITIALIZED_COMMIT_TIME)
@@ -14,6 +14,7 @@
  */
 
 #pragma once
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -28,4 +29,7 @@ using DataModelPartWrapperVector = std::vector<DataModelPartWrapperPtr>;
 using ServerDataPartPtr = std::shared_ptr<const ServerDataPart>;
 using ServerDataPartsVector = std::vector<ServerDataPartPtr>;
 using ServerDataPartsWithDBM = std::pair<ServerDataPartsVector, std::vector<std::shared_ptr<DeleteBitmapMeta>>>; // DBM: delete bitmap meta
+/// Optional pruning predicate over part metadata. When set, parts it rejects are dropped while
+/// being read from the server part cache, before any ServerDataPart object is materialized.
+using CachedPartsFilter = std::function<bool(const DataModelPartWrapperPtr &)>;
 }
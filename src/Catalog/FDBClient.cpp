@@ -218,6 +218,44 @@ fdb_error_t FDBClient::MultiGet(FDBTransactionPtr tr, const std::vector<std::str
     return 0;
 }
 
+fdb_error_t FDBClient::MultiGetLastInRanges(FDBTransactionPtr tr, const std::vector<std::pair<std::string, std::string>> & ranges, std::vector<std::string> & values)
+{
+    if (ranges.empty())
+        return 0;
+    AssertTrsansactionStatus(tr);
+    std::vector<FDBFuturePtr> future_list;
+    future_list.reserve(ranges.size());
+    for (const auto & [start_key, end_key] : ranges)
+    {
+        FDBFuturePtr f_read = std::make_shared<FDBFutureRAII>(fdb_transaction_get_range(
+            tr->transaction,
+            FDB_KEYSEL_FIRST_GREATER_OR_EQUAL(reinterpret_cast<const uint8_t *>(start_key.c_str()), start_key.size()),
+            FDB_KEYSEL_FIRST_GREATER_OR_EQUAL(reinterpret_cast<const uint8_t *>(end_key.c_str()), end_key.size()),
+            /*limit*/ 1,
+            /*target_bytes*/ 0,
+            FDB_STREAMING_MODE_EXACT,
+            /*iteration*/ 0,
+            /*snapshot*/ 1,
+            /*reverse*/ 1));
+        future_list.emplace_back(f_read);
+    }
+
+    const FDBKeyValue * out_kvs;
+    int out_count;
+    fdb_bool_t out_more;
+    for (FDBFuturePtr f_read : future_list)
+    {
+        RETURN_ON_ERROR(fdb_future_block_until_ready(f_read->future));
+        RETURN_ON_ERROR(fdb_future_get_keyvalue_array(f_read->future, &out_kvs, &out_count, &out_more));
+        if (out_count > 0)
+            values.emplace_back(reinterpret_cast<const char *>(out_kvs[0].value), out_kvs[0].value_length);
+        else
+            values.emplace_back();
+    }
+
+    return 0;
+}
+
 fdb_error_t FDBClient::MultiWrite(FDBTransactionPtr tr, const Catalog::BatchCommitRequest & req, Catalog::BatchCommitResponse & resp)
 {
     if (req.isEmpty())
@@ -124,6 +124,10 @@ public:
     fdb_error_t Put(FDBTransactionPtr tr, const PutRequest & put);
     std::shared_ptr<Iterator> Scan(FDBTransactionPtr tr, const ScanRequest & scan_req);
     fdb_error_t MultiGet(FDBTransactionPtr tr, const std::vector<std::string> & keys, std::vector<std::pair<std::string, UInt64>> & values);
+    /// For each [start, end) range get the value of its largest key. The range reads are issued
+    /// as parallel futures on one transaction, so N lookups cost one round trip. Values of empty
+    /// ranges are returned as empty strings.
+    fdb_error_t MultiGetLastInRanges(FDBTransactionPtr tr, const std::vector<std::pair<std::string, std::string>> & ranges, std::vector<std::string> & values);
     fdb_error_t MultiWrite(FDBTransactionPtr tr, const Catalog::BatchCommitRequest & req, Catalog::BatchCommitResponse & resp);
     fdb_error_t Delete(FDBTransactionPtr tr, const std::string & key, const std::string & expected = {});
     fdb_error_t Clear(FDBTransactionPtr tr, const std::string & start_key, const std::string & end_key);
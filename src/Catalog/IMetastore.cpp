@@ -43,6 +43,35 @@ void IMetaStore::adaptiveBatchWrite(const BatchCommitRequest & req)
         commit_rquest();
 }
 
+void IMetaStore::cleanRange(const String & start_key, const String & end_key)
+{
+    /// Generic fallback: collect the keys by scanning the range and remove them with batched
+    /// deletes. Backends with native range-delete support override this.
+    BatchCommitRequest batch_write(false);
+    auto it = getByRange(start_key, end_key, true, false);
+    while (it->next())
+        batch_write.AddDelete(it->key());
+
+    if (!batch_write.isEmpty())
+        adaptiveBatchWrite(batch_write);
+}
+
+std::vector<String> IMetaStore::multiGetLastInPrefixes(const std::vector<String> & prefixes)
+{
+    /// Generic fallback: one scan per prefix. Backends with multi-get support override this.
+    std::vector<String> res;
+    res.reserve(prefixes.size());
+    for (const auto & prefix : prefixes)
+    {
+        String last_value;
+        auto it = getByPrefix(prefix);
+        while (it->next())
+            last_value = it->value();
+        res.emplace_back(std::move(last_value));
+    }
+    return res;
+}
+
 }
 
 }
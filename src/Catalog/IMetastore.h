@@ -65,6 +65,13 @@ public:
      */
     virtual std::vector<std::pair<String, UInt64>> multiGet(const std::vector<String> & keys) = 0;
 
+    /***
+     * For each key prefix, get the value of the last (largest) key under that prefix.
+     * The result has one entry per prefix; prefixes without any key yield an empty string.
+     * Backends may override this to coalesce all lookups into fewer round trips.
+     */
+    virtual std::vector<String> multiGetLastInPrefixes(const std::vector<String> & prefixes);
+
     /***
      * Commit records in batch within one transaction. For both write and delete.
      */
@@ -108,6 +115,12 @@ public:
      */
     virtual void clean(const String & prefix) = 0;
 
+    /***
+     * Clear all metainfo in the key range [start_key, end_key). Backends with native
+     * range-delete support override this with a single ranged operation;
+     */
+    virtual void cleanRange(const String & start_key, const String & end_key);
+
     /***
      * Close metastore;
      */
@@ -100,6 +100,22 @@ std::vector<std::pair<String, UInt64>> MetastoreFDBImpl::multiGet(const std::vec
     return res;
 }
 
+std::vector<String> MetastoreFDBImpl::multiGetLastInPrefixes(const std::vector<String> & prefixes)
+{
+    std::vector<String> res;
+    res.reserve(prefixes.size());
+    for (size_t i = 0; i < prefixes.size(); i += DEFAULT_MULTI_GET_BATCH_COUNT)
+    {
+        std::vector<std::pair<String, String>> ranges;
+        for (size_t j = i; j < std::min(i + DEFAULT_MULTI_GET_BATCH_COUNT, prefixes.size()); ++j)
+            ranges.emplace_back(prefixes[j], getNextKey(prefixes[j]));
+        FDB::FDBTransactionPtr tr = std::make_shared<FDB::FDBTransactionRAII>();
+        check_fdb_op(fdb_client->CreateTransaction(tr));
+        check_fdb_op(fdb_client->MultiGetLastInRanges(tr, ranges, res));
+    }
+    return res;
+}
+
 void MetastoreFDBImpl::drop(const String & key, [[maybe_unused]] const UInt64 & expected)
 {
     FDB::FDBTransactionPtr tr = std::make_shared<FDB::FDBTransactionRAII>();
@@ -177,6 +193,13 @@ void MetastoreFDBImpl::clean(const String & prefix)
     check_fdb_op(fdb_client->Clear(tr, prefix, end_key));
 }
 
+void MetastoreFDBImpl::cleanRange(const String & start_key, const String & end_key)
+{
+    FDB::FDBTransactionPtr tr = std::make_shared<FDB::FDBTransactionRAII>();
+    check_fdb_op(fdb_client->CreateTransaction(tr));
+    check_fdb_op(fdb_client->Clear(tr, start_key, end_key));
+}
+
 void MetastoreFDBImpl::check_fdb_op(const fdb_error_t & error_code)
 {
     if (error_code)
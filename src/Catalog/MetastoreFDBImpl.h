@@ -80,6 +80,8 @@ public:
 
     std::vector<std::pair<String, UInt64>> multiGet(const std::vector<String> & keys) override;
 
+    std::vector<String> multiGetLastInPrefixes(const std::vector<String> & prefixes) override;
+
     bool batchWrite(const BatchCommitRequest & req, BatchCommitResponse & response) override;
 
     void drop(const String &, const UInt64 & expected = 0) override;
@@ -98,6 +100,8 @@ public:
 
     void clean(const String & prefix) override;
 
+    void cleanRange(const String & start_key, const String & end_key) override;
+
     void close() override {}
 
     static void check_fdb_op(const fdb_error_t & error_t);
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <cstddef>
 #include <random>
 #include <sstream>
@@ -342,6 +343,7 @@ void MetastoreProxy::createTable(const String & name_space, const UUID & db_uuid
     batch_write.AddPut(SinglePutRequest(nonHostUpdateKey(name_space, uuid), "0", true));
     // insert table meta
     batch_write.AddPut(SinglePutRequest(tableStoreKey(name_space, uuid, table_data.commit_time()), serialized_meta, true));
+    batch_write.AddPut(SinglePutRequest(metaCacheTokenKey(name_space, uuid), toString(table_data.commit_time())));
     /// add dependency mapping if need
     for (const String & dependency : dependencies)
         batch_write.AddPut(SinglePutRequest(viewDependencyKey(name_space, dependency, uuid), uuid));
@@ -417,7 +419,12 @@ void MetastoreProxy::dropUDF(const String & name_space, const String &resolved_n
 
 void MetastoreProxy::updateTable(const String & name_space, const String & table_uuid, const String & table_info_new, const UInt64 & ts)
 {
-    metastore_ptr->put(tableStoreKey(name_space, table_uuid, ts), table_info_new);
+    BatchCommitRequest batch_write;
+    batch_write.AddPut(SinglePutRequest(tableStoreKey(name_space, table_uuid, ts), table_info_new));
+    batch_write.AddPut(SinglePutRequest(metaCacheTokenKey(name_space, table_uuid), toString(ts)));
+    BatchCommitResponse resp;
+    metastore_ptr->batchWrite(batch_write, resp);
+    invalidateTableMetaCache(name_space, table_uuid);
 }
 
 void MetastoreProxy::updateTableWithID(const String & name_space, const Protos::TableIdentifier & table_id, const DB::Protos::DataModelTable & table_data)
@@ -425,17 +432,100 @@ void MetastoreProxy::updateTableWithID(const String & name_space, const Protos::
     BatchCommitRequest batch_write;
     batch_write.AddPut(SinglePutRequest(tableUUIDMappingKey(name_space, table_id.database(), table_id.name()), table_id.SerializeAsString()));
     batch_write.AddPut(SinglePutRequest(tableStoreKey(name_space, table_id.uuid(), table_data.commit_time()), table_data.SerializeAsString()));
+    batch_write.AddPut(SinglePutRequest(metaCacheTokenKey(name_space, table_id.uuid()), toString(table_data.commit_time())));
     BatchCommitResponse resp;
     metastore_ptr->batchWrite(batch_write, resp);
+    invalidateTableMetaCache(name_space, table_id.uuid());
+}
+
+static UInt64 cacheClockMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool MetastoreProxy::tryGetTableMetaFromCache(const String & name_space, const String & table_uuid, Strings & tables_info)
+{
+    if (!cache_lease_ms)
+        return false;
+
+    const String cache_key = tableStorePrefix(name_space, table_uuid);
+    String cached_token;
+    {
+        std::lock_guard lock(cache_mutex);
+        auto it = table_meta_cache.find(cache_key);
+        if (it == table_meta_cache.end())
+            return false;
+        if (cacheClockMs() < it->second.lease_deadline_ms)
+        {
+            tables_info.insert(tables_info.end(), it->second.values.begin(), it->second.values.end());
+            return true;
+        }
+        cached_token = it->second.token;
+    }
+
+    /// Lease expired: revalidate with a single small read of the invalidation token instead of
+    /// re-reading the whole table meta.
+    String current_token;
+    metastore_ptr->get(metaCacheTokenKey(name_space, table_uuid), current_token);
+
+    std::lock_guard lock(cache_mutex);
+    auto it = table_meta_cache.find(cache_key);
+    if (it == table_meta_cache.end() || it->second.token != current_token)
+    {
+        if (it != table_meta_cache.end())
+            table_meta_cache.erase(it);
+        return false;
+    }
+    it->second.lease_deadline_ms = cacheClockMs() + cache_lease_ms;
+    tables_info.insert(tables_info.end(), it->second.values.begin(), it->second.values.end());
+    return true;
+}
+
+void MetastoreProxy::putTableMetaToCache(const String & name_space, const String & table_uuid, const String & token, const Strings & tables_info)
+{
+    std::lock_guard lock(cache_mutex);
+    auto & entry = table_meta_cache[tableStorePrefix(name_space, table_uuid)];
+    entry.values = tables_info;
+    entry.token = token;
+    entry.lease_deadline_ms = cacheClockMs() + cache_lease_ms;
+}
+
+void MetastoreProxy::invalidateTableMetaCache(const String & name_space, const String & table_uuid)
+{
+    if (!cache_lease_ms)
+        return;
+    std::lock_guard lock(cache_mutex);
+    table_meta_cache.erase(tableStorePrefix(name_space, table_uuid));
 }
 
 void MetastoreProxy::getTableByUUID(const String & name_space, const String & table_uuid, Strings & tables_info)
 {
+    if (tryGetTableMetaFromCache(name_space, table_uuid, tables_info))
+        return;
+
+    /// Read the token before the data so that a mutation landing in between makes the cached
+    /// entry look older than it is, never newer.
+    String token;
+    if (cache_lease_ms)
+        metastore_ptr->get(metaCacheTokenKey(name_space, table_uuid), token);
+
     auto it = metastore_ptr->getByPrefix(tableStorePrefix(name_space, table_uuid));
     while(it->next())
     {
         tables_info.emplace_back(it->value());
     }
+
+    if (cache_lease_ms && !tables_info.empty())
+        putTableMetaToCache(name_space, table_uuid, token, tables_info);
+}
+
+Strings MetastoreProxy::getTablesByUUIDs(const String & name_space, const Strings & table_uuids)
+{
+    Strings prefixes;
+    prefixes.reserve(table_uuids.size());
+    for (const auto & table_uuid : table_uuids)
+        prefixes.emplace_back(tableStorePrefix(name_space, table_uuid));
+    return metastore_ptr->multiGetLastInPrefixes(prefixes);
 }
 
 IMetaStore::IteratorPtr MetastoreProxy::getAllTablesMeta(const DB::String &name_space)
@@ -735,6 +825,7 @@ void MetastoreProxy::clearTableMeta(const String & name_space, const String & da
     /// remove table uuid unique key
     batch_write.AddDelete(tableUUIDUniqueKey(name_space, uuid));
     batch_write.AddDelete(nonHostUpdateKey(name_space, uuid));
+    batch_write.AddDelete(metaCacheTokenKey(name_space, uuid));
 
     /// remove all statistics
     auto table_statistics_prefix = tableStatisticPrefix(name_space, uuid);
@@ -760,6 +851,7 @@ void MetastoreProxy::clearTableMeta(const String & name_space, const String & da
 
     BatchCommitResponse resp;
     metastore_ptr->batchWrite(batch_write, resp);
+    invalidateTableMetaCache(name_space, uuid);
 }
 
 String MetastoreProxy::getMaskingPolicy(const String & name_space, const String & masking_policy_name) const
@@ -832,6 +924,8 @@ void MetastoreProxy::prepareRenameTable(const String & name_space,
     to_table.SerializeToString(&meta_data);
     /// add new table meta data with new name
     batch_write.AddPut(SinglePutRequest(tableStoreKey(name_space, table_uuid, to_table.commit_time()), meta_data, true));
+    batch_write.AddPut(SinglePutRequest(metaCacheTokenKey(name_space, table_uuid), toString(to_table.commit_time())));
+    invalidateTableMetaCache(name_space, table_uuid);
 }
 
 bool MetastoreProxy::alterTable(const String & name_space, const Protos::DataModelTable & table, const Strings & masks_to_remove, const Strings & masks_to_add)
@@ -840,6 +934,7 @@ bool MetastoreProxy::alterTable(const String & name_space, const Protos::DataMod
 
     String table_uuid = UUIDHelpers::UUIDToString(RPCHelpers::createUUID(table.uuid()));
     batch_write.AddPut(SinglePutRequest(tableStoreKey(name_space, table_uuid, table.commit_time()), table.SerializeAsString(), true));
+    batch_write.AddPut(SinglePutRequest(metaCacheTokenKey(name_space, table_uuid), toString(table.commit_time())));
 
     Protos::TableIdentifier identifier;
     identifier.set_database(table.database());
@@ -856,7 +951,9 @@ bool MetastoreProxy::alterTable(const String & name_space, const Protos::DataMod
         batch_write.AddPut(SinglePutRequest(maskingPolicyTableMappingKey(name_space, name, table_uuid), table_uuid));
 
     BatchCommitResponse resp;
-    return metastore_ptr->batchWrite(batch_write, resp);
+    bool success = metastore_ptr->batchWrite(batch_write, resp);
+    invalidateTableMetaCache(name_space, table_uuid);
+    return success;
 }
 
 Strings MetastoreProxy::getAllTablesInDB(const String & name_space, const String & database)
@@ -1545,6 +1642,11 @@ void MetastoreProxy::multiDrop(const Strings & keys)
     metastore_ptr->adaptiveBatchWrite(batch_write);
 }
 
+void MetastoreProxy::cleanRange(const String & start_key, const String & end_key)
+{
+    metastore_ptr->cleanRange(start_key, end_key);
+}
+
 bool MetastoreProxy::batchWrite(const BatchCommitRequest & request, BatchCommitResponse response)
 {
     return metastore_ptr->batchWrite(request, response);
@@ -1602,6 +1704,44 @@ IMetaStore::IteratorPtr MetastoreProxy::getAllFilesysLock(const String & name_sp
     return metastore_ptr->getByPrefix(escapeString(name_space) + '_' + FILESYS_LOCK_PREFIX);
 }
 
+bool MetastoreProxy::tryClaimGlobalGCPartition(
+    const String & name_space, const String & table_uuid, const String & partition_id, const String & owner, UInt64 expire_ts)
+{
+    /// Claim value is "<expire_ts>:<owner>". The claim protects idempotent deletes only,
+    /// so a lost race or a claim taken over after its lease expired is always safe; it
+    /// merely costs one more round of DeleteObjects over already removed keys.
+    String key = globalGCPartitionClaimKey(name_space, table_uuid, partition_id);
+    String new_claim = toString(expire_ts) + ":" + owner;
+
+    String current;
+    metastore_ptr->get(key, current);
+    if (current.empty())
+    {
+        try
+        {
+            metastore_ptr->put(key, new_claim, /*if_not_exists*/ true);
+            return true;
+        }
+        catch (Exception &)
+        {
+            /// Another replica claimed it first.
+            return false;
+        }
+    }
+
+    UInt64 current_expire_ts = parse<UInt64>(current.substr(0, current.find(':')));
+    if (current_expire_ts >= static_cast<UInt64>(time(nullptr)))
+        return false;
+
+    /// The previous owner died or stalled; take the claim over atomically.
+    return metastore_ptr->putCAS(key, new_claim, current).first;
+}
+
+void MetastoreProxy::releaseGlobalGCPartition(const String & name_space, const String & table_uuid, const String & partition_id)
+{
+    metastore_ptr->drop(globalGCPartitionClaimKey(name_space, table_uuid, partition_id));
+}
+
 std::vector<String> MetastoreProxy::multiDropAndCheck(const Strings & keys)
 {
     multiDrop(keys);
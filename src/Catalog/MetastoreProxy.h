@@ -25,6 +25,7 @@
 #include <Storages/MergeTree/DeleteBitmapMeta.h>
 // #include <Transaction/ICnchTransaction.h>
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -113,6 +114,7 @@ namespace DB::Catalog
 #define COLUMN_STATISTICS_TAG_PREFIX "CST_" // deprecated, just remove it
 #define SQL_BINDING_PREFIX "SBI_"
 #define FILESYS_LOCK_PREFIX "FSLK_"
+#define GLOBAL_GC_PARTITION_CLAIM_PREFIX "GGCPC_"
 #define UDF_STORE_PREFIX "UDF_"
 #define MERGEMUTATE_THREAD_START_TIME "MTST_"
 #define DETACHED_PART_PREFIX "DP_"
@@ -128,6 +130,7 @@ namespace DB::Catalog
 #define DICTIONARY_BUCKET_UPDATE_TIME_PREFIX "DBUT_"
 #define ENTITY_UUID_MAPPING "EUM_"
 #define SENSITIVE_RESOURCE_PREFIX "SR_"
+#define META_CACHE_TOKEN_PREFIX "MCT_"
 
 using EntityType = IAccessEntity::Type;
 struct EntityMetastorePrefix
@@ -181,6 +184,7 @@ public:
 
     explicit MetastoreProxy(const MetastoreConfig & config)
         : metastore_ptr(getMetastorePtr(config))
+        , cache_lease_ms(config.cache_lease_milliseconds)
     {
     }
 
@@ -311,6 +315,13 @@ public:
         return escapeString(name_space) + '_' + TABLE_STORE_PREFIX;
     }
 
+    /// Invalidation token of the leased metadata cache. Bumped by every mutation of the table
+    /// meta so cached entries on other servers can be revalidated with a single small read.
+    static std::string metaCacheTokenKey(const std::string & name_space, const std::string & uuid)
+    {
+        return escapeString(name_space) + '_' + META_CACHE_TOKEN_PREFIX + uuid;
+    }
+
     static std::string udfMetaPrefix(const std::string & name_space)
     {
         return escapeString(name_space) + '_' + UDF_STORE_PREFIX;
@@ -881,6 +892,11 @@ public:
         return escapeString(name_space) + "_" + DATA_ITEM_TRASH_PREFIX + uuid + "_";
     }
 
+    static String globalGCPartitionClaimKey(const String & name_space, const String & table_uuid, const String & partition_id)
+    {
+        return escapeString(name_space) + "_" + GLOBAL_GC_PARTITION_CLAIM_PREFIX + table_uuid + "_" + partition_id;
+    }
+
     static String partialSchemaPrefix(const String & name_space, const String & table_uuid)
     {
          return escapeString(name_space) + "_" + OBJECT_PARTIAL_SCHEMA_PREFIX + table_uuid + "_";
@@ -946,6 +962,13 @@ public:
     std::vector<String> getFilesysLocks(const String& name_space, const std::vector<String>& dirs);
     void clearFilesysLocks(const String & name_space, const std::vector<String>& dirs);
 
+    /// Lease-based claim of one partition of a trashed table during global GC, so several
+    /// server replicas can split the data removal of a huge table between them. Returns
+    /// whether the claim now belongs to `owner`; an expired claim may be taken over via CAS.
+    bool tryClaimGlobalGCPartition(
+        const String & name_space, const String & table_uuid, const String & partition_id, const String & owner, UInt64 expire_ts);
+    void releaseGlobalGCPartition(const String & name_space, const String & table_uuid, const String & partition_id);
+
     IMetaStore::IteratorPtr getAllFilesysLock(const String & name_space);
 
     /// TODO: remove old transaction api
@@ -997,6 +1020,9 @@ public:
     void updateTable(const String & name_space, const String & table_uuid, const String & table_info_new, const UInt64 & ts);
     void updateTableWithID(const String & name_space, const Protos::TableIdentifier & table_id, const DB::Protos::DataModelTable & table_data);
     void getTableByUUID(const String & name_space, const String & table_uuid, Strings & tables_info);
+    /// Batched version of getTableByUUID: fetch the latest metadata of many tables at once.
+    /// The result is aligned with `table_uuids`; entries of unknown tables are empty strings.
+    Strings getTablesByUUIDs(const String & name_space, const Strings & table_uuids);
     void clearTableMeta(const String & name_space, const String & database, const String & table, const String & uuid, const Strings & dependencies, const UInt64 & ts = 0);
     static void prepareRenameTable(const String & name_space, const String & table_uuid, const String & from_db, const String & from_table, const UUID & to_db_uuid, Protos::DataModelTable & to_table, BatchCommitRequest & batch_write);
     bool alterTable(const String & name_space, const Protos::DataModelTable & table, const Strings & masks_to_remove, const Strings & masks_to_add);
@@ -1103,6 +1129,10 @@ public:
 
     void multiDrop(const Strings & keys);
 
+    /// Remove all KV pairs in [start_key, end_key) with a single ranged delete when the backend
+    /// supports it (e.g. FDB clear_range), instead of one delete per key.
+    void cleanRange(const String & start_key, const String & end_key);
+
     bool batchWrite(const BatchCommitRequest & request, BatchCommitResponse response);
     /// tmp api to help debug drop keys failed issue. remove this later.
     std::vector<String> multiDropAndCheck(const Strings & keys);
@@ -1334,7 +1364,28 @@ public:
 
 private:
 
+    /// Leased read-through cache for hot metadata keys (currently table schemas). An entry is
+    /// served from memory while its lease holds; once the lease expires the invalidation token
+    /// (bumped by every mutation of the same meta) is re-read, and the entry is either granted
+    /// another lease or reloaded. Staleness is therefore bounded by the lease TTL even when the
+    /// mutation happened on another server.
+    struct LeasedCacheEntry
+    {
+        Strings values;
+        String token;    /// value of the invalidation token key when the entry was loaded
+        UInt64 lease_deadline_ms = 0;
+    };
+
+    bool tryGetTableMetaFromCache(const String & name_space, const String & table_uuid, Strings & tables_info);
+    void putTableMetaToCache(const String & name_space, const String & table_uuid, const String & token, const Strings & tables_info);
+    void invalidateTableMetaCache(const String & name_space, const String & table_uuid);
+
     MetastorePtr metastore_ptr;
+
+    /// 0 disables the cache and keeps every read on the metastore.
+    UInt64 cache_lease_ms = 0;
+    std::mutex cache_mutex;
+    std::unordered_map<String, LeasedCacheEntry> table_meta_cache;
 };
 
 } // namespace DB::Catalog
@@ -25,6 +25,7 @@
 #include <Parsers/parseQuery.h>
 #include <Storages/IStorage.h>
 #include <Storages/StorageFactory.h>
+#include <Common/LRUCache.h>
 #include "Storages/ColumnsDescription.h"
 #include "Storages/ForeignKeysDescription.h"
 #include "Storages/UniqueNotEnforcedDescription.h"
@@ -32,11 +33,41 @@
 namespace DB
 {
 
-std::shared_ptr<ASTCreateQuery> getASTCreateQueryFromString(const String & query, const ContextPtr & context)
+namespace ErrorCodes
+{
+    extern const int INCORRECT_QUERY;
+}
+
+std::shared_ptr<ASTCreateQuery> parseCreateQueryWithCache(const String & query, const ContextPtr & context)
 {
-    ParserCreateQuery parser_create;
     const auto & settings = context->getSettingsRef();
-    auto create_ast = std::dynamic_pointer_cast<ASTCreateQuery>(parseQuery(parser_create, query, settings.max_query_size, settings.max_parser_depth));
+
+    auto parse = [&]
+    {
+        ParserCreateQuery parser_create;
+        auto create_ast = std::dynamic_pointer_cast<ASTCreateQuery>(
+            parseQuery(parser_create, query, settings.max_query_size, settings.max_parser_depth));
+        if (!create_ast)
+            throw Exception("Expected a CREATE query for a cloud table, got: " + query, ErrorCodes::INCORRECT_QUERY);
+        return create_ast;
+    };
+
+    if (!settings.enable_cloud_table_definition_cache)
+        return parse();
+
+    /// Workers receive the same CREATE statements on every session of a hot table. Keep the
+    /// pristine parsed AST in a process-wide cache keyed by the definition text and hand out
+    /// clones - callers mutate their copies freely, and DDL changes the text, so outdated
+    /// definitions just stop being requested and age out.
+    static LRUCache<String, ASTCreateQuery> definition_cache(1024);
+
+    auto [pristine_ast, _] = definition_cache.getOrSet(query, parse);
+    return std::dynamic_pointer_cast<ASTCreateQuery>(pristine_ast->clone());
+}
+
+std::shared_ptr<ASTCreateQuery> getASTCreateQueryFromString(const String & query, const ContextPtr & context)
+{
+    auto create_ast = parseCreateQueryWithCache(query, context);
     create_ast->attach = true;
     create_ast->create = false;
 
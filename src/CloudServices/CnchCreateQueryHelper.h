@@ -29,6 +29,11 @@ class ASTSetQuery;
 /// see Databases/DatabaseOnDisk.h
 extern String getObjectDefinitionFromCreateQuery(const ASTPtr & query, std::optional<bool> attach);
 
+/// Parse a CREATE query, serving repeated definitions from a process-wide cache of pristine
+/// ASTs when enable_cloud_table_definition_cache is set. The caller gets its own clone and
+/// may mutate it freely.
+std::shared_ptr<ASTCreateQuery> parseCreateQueryWithCache(const String & query, const ContextPtr & context);
+
 std::shared_ptr<ASTCreateQuery> getASTCreateQueryFromString(const String & query, const ContextPtr & context);
 std::shared_ptr<ASTCreateQuery> getASTCreateQueryFromStorage(const IStorage & storage, const ContextPtr & context);
 
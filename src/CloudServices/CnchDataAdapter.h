@@ -81,7 +81,12 @@ public:
     DataModelPartWrapperPtr getData() const { return data->part_model_wrapper; }
     size_t getCommitTime() const { return data->getCommitTime(); }
     ServerDataPartPtr toData() { return data; }
-    String getPartitionMinmax() { return data->part_model().partition_minmax(); }
+    /// The wrapper always carries the decoded partition, even when the cached model is
+    /// compact (cnch_part_cache_compact_model) and the raw partition_minmax bytes are gone.
+    std::shared_ptr<MergeTreePartition> getPartition() const
+    {
+        return std::make_shared<MergeTreePartition>(data->part_model_wrapper->partition);
+    }
 };
 
 
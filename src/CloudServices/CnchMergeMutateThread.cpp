@@ -622,6 +622,106 @@ bool CnchMergeMutateThread::tryMergeParts(StoragePtr & istorage, StorageCnchMerg
     return result;
 }
 
+/// Greedily group contiguous runs of tiny parts of one partition, in visible order.
+/// Microbatch INSERTs create such runs much faster than the cost-based selector picks
+/// them up, and merging a run of sub-threshold parts is always a win, so no cost model
+/// is needed - only the merge predicate and the group size limits.
+static std::vector<ServerDataPartsVector> selectTinyPartGroups(
+    const ServerDataPartsVector & visible_parts,
+    const ServerCanMergeCallback & can_merge,
+    size_t micro_part_bytes,
+    size_t min_parts_in_group,
+    size_t max_parts_in_group)
+{
+    std::vector<ServerDataPartsVector> groups;
+    ServerDataPartsVector current;
+
+    auto flush = [&]
+    {
+        if (current.size() >= min_parts_in_group)
+            groups.push_back(std::move(current));
+        current.clear();
+    };
+
+    for (const auto & part : visible_parts)
+    {
+        bool tiny = part->part_model().size() <= micro_part_bytes && can_merge(nullptr, part);
+        if (tiny && !current.empty() && current.size() < max_parts_in_group
+            && current.back()->info().partition_id == part->info().partition_id
+            && can_merge(current.back(), part))
+        {
+            current.push_back(part);
+            continue;
+        }
+
+        flush();
+        if (tiny)
+            current.push_back(part);
+    }
+    flush();
+
+    return groups;
+}
+
+/// Parts whose recompression TTL fired after they were written still sit on the hot codec:
+/// any rewrite after that point picks the colder codec on the worker through
+/// getCompressionCodecForPart(), so selecting such parts into ordinary merge tasks is enough.
+/// A group may degenerate to a single part - an old partition is typically one big part
+/// that no longer participates in regular merges.
+static std::vector<ServerDataPartsVector> selectRecompressionGroups(
+    const ServerDataPartsVector & visible_parts,
+    const ServerCanMergeCallback & can_merge,
+    size_t max_bytes_in_group,
+    size_t max_parts_in_group,
+    time_t current_time)
+{
+    std::vector<ServerDataPartsVector> groups;
+    ServerDataPartsVector current;
+    size_t current_bytes = 0;
+
+    auto needs_recompression = [current_time](const ServerDataPartPtr & part)
+    {
+        if (!part->part_model().has_part_ttl_info())
+            return false;
+        UInt64 recompress_ttl = part->part_model().part_ttl_info().min_max_recompression_ttl();
+        return recompress_ttl && recompress_ttl <= static_cast<UInt64>(current_time)
+            && TxnTimestamp(part->getCommitTime()).toSecond() < recompress_ttl;
+    };
+
+    auto flush = [&]
+    {
+        if (!current.empty())
+            groups.push_back(std::move(current));
+        current.clear();
+        current_bytes = 0;
+    };
+
+    for (const auto & part : visible_parts)
+    {
+        bool eligible = needs_recompression(part) && can_merge(nullptr, part);
+        size_t part_bytes = part->part_model().size();
+        if (eligible && !current.empty() && current.size() < max_parts_in_group
+            && current_bytes + part_bytes <= max_bytes_in_group
+            && current.back()->info().partition_id == part->info().partition_id
+            && can_merge(current.back(), part))
+        {
+            current.push_back(part);
+            current_bytes += part_bytes;
+            continue;
+        }
+
+        flush();
+        if (eligible)
+        {
+            current.push_back(part);
+            current_bytes = part_bytes;
+        }
+    }
+    flush();
+
+    return groups;
+}
+
 bool CnchMergeMutateThread::trySelectPartsToMerge(StoragePtr & istorage, StorageCnchMergeTree & storage, MergeSelectionMetrics & metrics)
 {
     /// 6 steps of selecting parts to merge. (the order is important)
@@ -740,15 +840,50 @@ bool CnchMergeMutateThread::trySelectPartsToMerge(StoragePtr & istorage, Storage
     }
     metrics.num_legal_visible_parts = visible_parts.size();
 
+    /// Step 4: create merge predicate
+    auto can_merge = getMergePred(merging_mutating_parts_snapshot, mutation_timestamps);
+
+    std::vector<ServerDataPartsVector> res;
+
+    /// Fast path for microbatch ingestion: sub-threshold parts pile up faster than the
+    /// cost-based selector schedules them, so grab contiguous runs of tiny parts first
+    /// and let the regular selector work on what remains. Bucket tables are excluded as
+    /// their groups must not cross bucket boundaries.
+    if (storage_settings->cnch_merge_enable_micro_merge && !storage.isBucketTable())
+    {
+        auto micro_groups = selectTinyPartGroups(
+            visible_parts,
+            can_merge,
+            storage_settings->cnch_merge_micro_part_bytes,
+            storage_settings->cnch_merge_micro_min_parts_to_merge,
+            storage_settings->cnch_merge_max_parts_to_merge);
+
+        if (!micro_groups.empty())
+        {
+            NameSet micro_selected;
+            for (const auto & group : micro_groups)
+                for (const auto & part : group)
+                    micro_selected.insert(part->name());
+
+            visible_parts.erase(
+                std::remove_if(
+                    visible_parts.begin(),
+                    visible_parts.end(),
+                    [&micro_selected](const auto & p) { return micro_selected.count(p->name()); }),
+                visible_parts.end());
+
+            LOG_DEBUG(log, "Micro-merge fast path selected {} groups of tiny parts", micro_groups.size());
+            res = std::move(micro_groups);
+        }
+    }
+
     /// Step 5: do selecting.
     const bool enable_batch_select = storage_settings->cnch_merge_enable_batch_select;
-    std::vector<ServerDataPartsVector> res;
     [[maybe_unused]] auto decision = selectPartsToMerge(
         storage,
         res,
         visible_parts,
-        /// Step 4: create merge predicate
-        getMergePred(merging_mutating_parts_snapshot, mutation_timestamps),
+        can_merge,
         max_bytes,
         false, /// aggressive
         enable_batch_select,
@@ -756,6 +891,22 @@ bool CnchMergeMutateThread::trySelectPartsToMerge(StoragePtr & istorage, Storage
         false, /// merge_with_ttl_allowed
         log); /// log
 
+    /// Recompression TTLs ride on idle merge capacity: only when the cost-based selector
+    /// found nothing does the round go to rewriting parts whose RECOMPRESS TTL has expired,
+    /// so read-hot data never competes with recompression for merge slots.
+    if (res.empty() && storage_settings->cnch_merge_enable_recompression_ttl
+        && storage.getInMemoryMetadataPtr()->hasAnyRecompressionTTL())
+    {
+        auto recompress_groups = selectRecompressionGroups(
+            visible_parts, can_merge, max_bytes, storage_settings->cnch_merge_max_parts_to_merge, std::time(nullptr));
+
+        if (!recompress_groups.empty())
+        {
+            LOG_DEBUG(log, "Selected {} part ranges for recompression TTL rewrite", recompress_groups.size());
+            res = std::move(recompress_groups);
+        }
+    }
+
     metrics.elapsed_select_parts = watch.elapsedMicroseconds();
     watch.restart();
 
@@ -1310,6 +1461,42 @@ bool CnchMergeMutateThread::tryMutateParts(StoragePtr & istorage, StorageCnchMer
 
     bool change_schema = current_mutate_entry->commands.changeSchema();
 
+    /// Point-delete pipelines leave long runs of tiny mutation entries. When the current
+    /// entry does not change the schema, ship the whole consecutive run of such entries as
+    /// one task: a part that needs the earliest entry needs every later one too (needMutate()
+    /// compares mutation_commit_time and min_block against a growing commit time), so the
+    /// worker can apply the combined commands in a single rewrite that commits once at the
+    /// last entry's timestamp. Part selection and the finish/removal bookkeeping below keep
+    /// tracking only the earliest entry; the later ones stay in the KV and are confirmed in
+    /// the following rounds, normally with no parts left to rewrite.
+    auto batched_entry = *current_mutate_entry;
+    if (size_t max_batched = storage_settings->cnch_mutate_max_batched_mutations;
+        max_batched > 1 && !change_schema && !current_mutate_entry->isReclusterMutation())
+    {
+        size_t num_batched = 1;
+        for (auto it = std::next(current_mutations_by_version.find(current_mutate_entry->commit_time));
+             it != current_mutations_by_version.end() && num_batched < max_batched;
+             ++it)
+        {
+            const auto & candidate = it->second;
+            if (candidate.commands.changeSchema() || candidate.isReclusterMutation()
+                || candidate.columns_commit_time != batched_entry.columns_commit_time)
+                break;
+
+            batched_entry.commands.insert(batched_entry.commands.end(), candidate.commands.begin(), candidate.commands.end());
+            batched_entry.commit_time = candidate.commit_time;
+            ++num_batched;
+        }
+
+        if (num_batched > 1)
+            LOG_DEBUG(
+                log,
+                "Batched {} consecutive mutations into one run, commit time {} -> {}",
+                num_batched,
+                current_mutate_entry->commit_time,
+                batched_entry.commit_time);
+    }
+
     /// Function to generating new tasks. Return true if we can still generate new tasks.
     auto generate_tasks = [&](const ServerDataPartsVector & visible_parts, const NameSet & snapshot)
     {
@@ -1379,7 +1566,7 @@ bool CnchMergeMutateThread::tryMutateParts(StoragePtr & istorage, StorageCnchMer
                     submitFutureManipulationTask(
                         storage,
                         FutureManipulationTask(*this, type)
-                            .setMutationEntry(*current_mutate_entry)
+                            .setMutationEntry(batched_entry)
                             .assignSourceParts(std::move(alter_parts)));
 
                     alter_parts.clear();
@@ -1396,7 +1583,7 @@ bool CnchMergeMutateThread::tryMutateParts(StoragePtr & istorage, StorageCnchMer
             submitFutureManipulationTask(
                 storage,
                 FutureManipulationTask(*this, type)
-                    .setMutationEntry(*current_mutate_entry)
+                    .setMutationEntry(batched_entry)
                     .assignSourceParts(std::move(alter_parts)));
         }
         else if (alter_parts.empty() && type == ManipulationType::Clustering)
@@ -572,6 +572,13 @@ size_t CnchPartGCThread::doPhaseTwoGC(const StoragePtr & istorage, StorageCnchMe
     ThreadPool remove_pool(pool_size);
     std::atomic<size_t> ntotal = 0;
 
+    /// When the filter kept the whole scanned batch, every thread's slice is a contiguous run of
+    /// the trash key space and its records can be reclaimed with one ranged delete, provided all
+    /// items of the slice were actually removed.
+    const bool can_range_delete = storage.getSettings()->gc_trash_items_range_delete
+        && items_to_remove.data_parts.size() == trash_items.data_parts.size()
+        && items_to_remove.delete_bitmaps.size() == trash_items.delete_bitmaps.size();
+
     auto batch_remove = [&](size_t p_beg, size_t p_end, size_t d_beg, size_t d_end) {
         remove_pool.scheduleOrThrowOnError([&, p_beg, p_end, d_beg, d_end] {
             Stopwatch watch;
@@ -612,7 +619,10 @@ size_t CnchPartGCThread::doPhaseTwoGC(const StoragePtr & istorage, StorageCnchMe
             size_t nparts = items_removed.data_parts.size();
             size_t nbitmaps = items_removed.delete_bitmaps.size();
             LOG_DEBUG(log, "[p2] Will remove trash records of {} parts, {} delete bitmaps", nparts, nbitmaps);
-            catalog->clearTrashItems(istorage, items_removed);
+            if (can_range_delete && nparts == p_end - p_beg && nbitmaps == d_end - d_beg)
+                catalog->clearTrashItemsRange(istorage, items_removed);
+            else
+                catalog->clearTrashItems(istorage, items_removed);
             LOG_DEBUG(
                 log, "[p2] Completely removed data of {} parts and {} delete bitmaps in {} ms", nparts, nbitmaps, watch.elapsedMilliseconds());
             ntotal += (nparts + nbitmaps);
@@ -849,6 +849,18 @@ UInt64 CnchServerClient::getServerStartTime()
     return response.server_start_time();
 }
 
+UInt64 CnchServerClient::getQueryLoad()
+{
+    brpc::Controller cntl;
+    Protos::GetQueryLoadReq request;
+    Protos::GetQueryLoadResp response;
+
+    stub->getQueryLoad(&cntl, &request, &response, nullptr);
+
+    assertController(cntl);
+    return response.running_queries();
+}
+
 bool CnchServerClient::scheduleGlobalGC(const std::vector<Protos::DataModelTable> & tables)
 {
     brpc::Controller cntl;
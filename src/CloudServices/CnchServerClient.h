@@ -175,6 +175,8 @@ public:
     std::optional<TxnTimestamp> getMinActiveTimestamp(const StorageID & storage_id);
 
     UInt64 getServerStartTime();
+    /// Number of queries currently running on the server, used for query forwarding load shedding.
+    UInt64 getQueryLoad();
     bool scheduleGlobalGC(const std::vector<Protos::DataModelTable> & tables);
     size_t getNumOfTablesCanSendForGlobalGC();
     google::protobuf::RepeatedPtrField<DB::Protos::BackgroundThreadStatus>
@@ -263,11 +263,49 @@ void CnchServerResource::sendResources(const ContextPtr & context, std::optional
     auto handler = std::make_shared<ExceptionHandlerWithFailedInfo>();
     std::vector<brpc::CallId> call_ids;
     call_ids.resize(all_resources.size());
+    /// Warmup hints are fire-and-forget: the worker fills its disk cache from the assigned
+    /// parts while the plan segments are still being distributed, so the first granule
+    /// reads of the query hit warm cache instead of paying the miss after scheduling.
+    bool warmup_parts = context->getSettingsRef().enable_parts_warmup_on_send_resources;
+    auto warmup_handler = std::make_shared<ExceptionHandler>();
+    auto send_warmup_hints = [&](const CnchWorkerClientPtr & worker_client, const std::vector<AssignedResource> & resources_to_send)
+    {
+        for (const auto & resource : resources_to_send)
+        {
+            if (resource.server_parts.empty())
+                continue;
+
+            const auto * cnch_table = dynamic_cast<const StorageCnchMergeTree *>(resource.storage.get());
+            if (!cnch_table)
+                continue;
+
+            /// The worker honors the same table-level preload opt-in as background preloads.
+            const auto & table_settings = *cnch_table->getSettings();
+            UInt64 preload_level = table_settings.parts_preload_level ? table_settings.parts_preload_level.value
+                                                                      : (table_settings.enable_preload_parts ? 3 : 0);
+            if (!preload_level)
+                continue;
+
+            worker_client->preloadDataParts(
+                context,
+                txn_id,
+                *cnch_table,
+                resource.create_table_query,
+                resource.server_parts,
+                warmup_handler,
+                /*enable_parts_sync_preload*/ false,
+                preload_level,
+                txn_id.toUInt64());
+        }
+    };
+
     auto worker_send_resources = [&](const HostWithPorts & host_ports, const std::vector<AssignedResource> & resources_to_send, size_t i)
     {
         auto worker_client = worker_group->getWorkerClient(host_ports);
         auto full_worker_id = WorkerStatusManager::getWorkerId(worker_group->getVWName(), worker_group->getID(), host_ports.id);
         call_ids[i] = worker_client->sendResources(context, resources_to_send, handler, full_worker_id, send_mutations);
+        if (warmup_parts)
+            send_warmup_hints(worker_client, resources_to_send);
     };
 
     size_t max_threads = Catalog::getMaxThreads();
@@ -402,7 +440,7 @@ void CnchServerResource::allocateResource(
                         leftover_server_parts.size());
                     ProfileEvents::increment(ProfileEvents::CnchPartAllocationSplits);
                 }
-                assigned_map = assignCnchParts(worker_group, leftover_server_parts);
+                assigned_map = assignCnchParts(worker_group, leftover_server_parts, storage->getStorageUUID());
                 moveBucketTablePartsToAssignedParts(assigned_map, bucket_parts, worker_group->getWorkerIDVec(), required_bucket_numbers);
             }
             else if (auto * cnchhive = dynamic_cast<StorageCnchHive *>(storage.get()))
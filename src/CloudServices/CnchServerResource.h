@@ -194,8 +194,6 @@ private:
     void computeResourceSize(
         std::optional<ResourceOption> & resource_option, std::unordered_map<HostWithPorts, std::vector<AssignedResource>> & all_resources);
 
-    void sendCreateQueries(const ContextPtr & context);
-    void sendDataParts(const ContextPtr & context);
     void sendOffloadingInfo(const ContextPtr & context);
 
     TxnTimestamp txn_id;
@@ -19,8 +19,10 @@
 #include <Catalog/Catalog.h>
 #include <Interpreters/CnchQueryMetrics/QueryWorkerMetricLog.h>
 #include <Interpreters/Context.h>
+#include <Interpreters/ProcessList.h>
 #include <MergeTreeCommon/CnchTopologyMaster.h>
 #include <MergeTreeCommon/MergeTreeMetaBase.h>
+#include <Protos/DataModelHelpers.h>
 #include <Protos/RPCHelpers.h>
 #include <Transaction/LockManager.h>
 #include <Transaction/TransactionCommon.h>
@@ -598,8 +600,14 @@ void CnchServerServiceImpl::fetchDataParts(
                 bucket_numbers);
 
             auto & mutable_parts = *response->mutable_parts();
+            const auto & merge_tree = dynamic_cast<const MergeTreeMetaBase &>(*storage);
             for (const auto & part : parts)
-                *mutable_parts.Add() = part->part_model();
+            {
+                auto & part_model = *mutable_parts.Add();
+                part_model = part->part_model();
+                if (!part_model.has_partition_minmax())
+                    restorePartitionAndMinMaxIndex(merge_tree, *part->part_model_wrapper, part_model);
+            }
         }
         catch (...)
         {
@@ -984,6 +992,16 @@ void CnchServerServiceImpl::getServerStartTime(
     response->set_server_start_time(server_start_time);
 }
 
+void CnchServerServiceImpl::getQueryLoad(
+    google::protobuf::RpcController *,
+    const Protos::GetQueryLoadReq *,
+    Protos::GetQueryLoadResp * response,
+    google::protobuf::Closure * done)
+{
+    brpc::ClosureGuard done_guard(done);
+    response->set_running_queries(getContext()->getProcessList().size());
+}
+
 // About Auto Statistics
 void CnchServerServiceImpl::queryUdiCounter(
     [[maybe_unused]] google::protobuf::RpcController* controller,
@@ -209,6 +209,12 @@ public:
         Protos::GetServerStartTimeResp * response,
         google::protobuf::Closure * done) override;
 
+    void getQueryLoad(
+        google::protobuf::RpcController * cntl,
+        const Protos::GetQueryLoadReq * request,
+        Protos::GetQueryLoadResp * response,
+        google::protobuf::Closure * done) override;
+
     /***
      *  About GlobalGC
      */
@@ -34,6 +34,7 @@
 
 #include <brpc/channel.h>
 #include <brpc/controller.h>
+#include <google/protobuf/arena.h>
 #include <common/logger_useful.h>
 #include <Storages/MergeTree/MarkRange.h>
 namespace DB
@@ -399,7 +400,11 @@ brpc::CallId CnchWorkerClient::sendResources(
     const WorkerId & worker_id,
     bool with_mutations)
 {
-    Protos::SendResourcesReq request;
+    /// The request embeds the part models of every table going to this worker, which on large
+    /// queries means tens of thousands of small sub-messages. Build the tree on an arena so the
+    /// allocations are batched and the whole request is freed in one shot after serialization.
+    google::protobuf::Arena arena;
+    auto & request = *google::protobuf::Arena::CreateMessage<Protos::SendResourcesReq>(&arena);
 
     const auto & settings = context->getSettingsRef();
     auto max_execution_time = settings.max_execution_time.value.totalSeconds();
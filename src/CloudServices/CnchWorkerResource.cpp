@@ -16,13 +16,12 @@
 #include <memory>
 #include <CloudServices/CnchWorkerResource.h>
 
+#include <CloudServices/CnchCreateQueryHelper.h>
 #include <Core/Names.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/InterpreterSetQuery.h>
 #include <Interpreters/InterpreterCreateQuery.h>
-#include <Parsers/ParserQueryWithOutput.h>
 #include <Parsers/ASTCreateQuery.h>
-#include <Parsers/parseQuery.h>
 #include <Parsers/formatTenantDatabaseName.h>
 #include <Parsers/ASTForeignKeyDeclaration.h>
 #include <Parsers/ASTUniqueNotEnforcedDeclaration.h>
@@ -33,6 +32,7 @@
 #include <Storages/IStorage.h>
 #include <Databases/DatabaseMemory.h>
 #include <Storages/StorageFactory.h>
+#include <Common/ThreadPool.h>
 
 
 namespace DB
@@ -42,18 +42,15 @@ namespace ErrorCodes
 {
     extern const int DUPLICATE_COLUMN;
     extern const int INCORRECT_QUERY;
+    extern const int LOGICAL_ERROR;
     extern const int TABLE_ALREADY_EXISTS;
 }
 
 void CnchWorkerResource::executeCreateQuery(ContextMutablePtr context, const String & create_query, bool skip_if_exists, const ColumnsDescription & object_columns)
 {
     LOG_DEBUG(&Poco::Logger::get("WorkerResource"), "start create cloud table {}", create_query);
-    const char * begin = create_query.data();
-    const char * end = create_query.data() + create_query.size();
-    ParserQueryWithOutput parser{end};
-    const auto & settings = context->getSettingsRef();
-    ASTPtr ast_query = parseQuery(parser, begin, end, "CreateCloudTable", settings.max_query_size, settings.max_parser_depth);
-    auto & ast_create_query = ast_query->as<ASTCreateQuery &>();
+    auto ast_query = parseCreateQueryWithCache(create_query, context);
+    auto & ast_create_query = *ast_query;
 
     /// set query settings
     if (ast_create_query.settings_ast)
@@ -158,6 +155,35 @@ void CnchWorkerResource::executeCreateQuery(ContextMutablePtr context, const Str
     LOG_DEBUG(&Poco::Logger::get("WorkerResource"), "Successfully create cloud table {} and database {}", res->getStorageID().getNameForLogs(), database_name);
 }
 
+void CnchWorkerResource::executeCreateQueries(
+    ContextMutablePtr context, const Strings & create_queries, const std::vector<ColumnsDescription> & object_columns_list)
+{
+    if (create_queries.size() != object_columns_list.size())
+        throw Exception(
+            ErrorCodes::LOGICAL_ERROR,
+            "Mismatched number of create queries ({}) and object column schemas ({})",
+            create_queries.size(),
+            object_columns_list.size());
+
+    /// Queries with a couple of tables don't benefit from the pool, keep them in the caller's thread.
+    if (create_queries.size() <= 2)
+    {
+        for (size_t i = 0; i < create_queries.size(); ++i)
+            executeCreateQuery(Context::createCopy(context), create_queries[i], false, object_columns_list[i]);
+        return;
+    }
+
+    ThreadPool pool(std::min(create_queries.size(), 16UL));
+    for (size_t i = 0; i < create_queries.size(); ++i)
+    {
+        pool.scheduleOrThrowOnError([&, i] {
+            executeCreateQuery(Context::createCopy(context), create_queries[i], false, object_columns_list[i]);
+        });
+    }
+    /// Rethrows the first exception from the tasks, if any.
+    pool.wait();
+}
+
 StoragePtr CnchWorkerResource::getTable(const StorageID & table_id) const
 {
     String tenant_db = formatTenantDatabaseName(table_id.getDatabaseName());
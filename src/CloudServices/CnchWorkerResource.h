@@ -35,6 +35,9 @@ class CnchWorkerResource
 {
 public:
     void executeCreateQuery(ContextMutablePtr context, const String & create_query, bool skip_if_exists = false, const ColumnsDescription & object_columns = {});
+    /// Create a batch of cloud tables concurrently over a thread pool. Each DDL gets its own
+    /// copy of the context, so a SETTINGS clause in one query cannot leak into another.
+    void executeCreateQueries(ContextMutablePtr context, const Strings & create_queries, const std::vector<ColumnsDescription> & object_columns_list);
     StoragePtr getTable(const StorageID & table_id) const;
     DatabasePtr getDatabase(const String & database_name) const;
     bool isCnchTableInWorker(const StorageID & table_id) const;
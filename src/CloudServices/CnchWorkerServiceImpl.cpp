@@ -492,11 +492,13 @@ void CnchWorkerServiceImpl::sendQueryDataParts(
             request->txn_id());
 
         MergeTreeMutableDataPartsVector data_parts;
+        size_t deserialize_threads = query_context->getSettingsRef().cnch_send_parts_deserialize_max_threads;
         if (cloud_merge_tree.getInMemoryMetadata().hasUniqueKey())
             data_parts = createBasePartAndDeleteBitmapFromModelsForSend<IMergeTreeMutableDataPartPtr>(
-                cloud_merge_tree, request->parts(), request->bitmaps());
+                cloud_merge_tree, request->parts(), request->bitmaps(), /*paths*/ nullptr, deserialize_threads);
         else
-            data_parts = createPartVectorFromModelsForSend<IMergeTreeMutableDataPartPtr>(cloud_merge_tree, request->parts());
+            data_parts = createPartVectorFromModelsForSend<IMergeTreeMutableDataPartPtr>(
+                cloud_merge_tree, request->parts(), /*paths*/ nullptr, deserialize_threads);
 
         if (request->has_disk_cache_mode())
         {
@@ -731,16 +733,18 @@ void CnchWorkerServiceImpl::sendResources(
 
         /// store cloud tables in cnch_session_resource.
         {
-            /// create a copy of session_context to avoid modify settings in SessionResource
-            auto context_for_create = Context::createCopy(query_context);
+            Strings create_queries;
+            std::vector<ColumnsDescription> object_columns_list;
+            create_queries.reserve(request->create_queries_size());
+            object_columns_list.reserve(request->create_queries_size());
             for (int i = 0; i < request->create_queries_size(); i++)
             {
-                auto create_query = request->create_queries().at(i);
-                auto object_columns = request->dynamic_object_column_schema().at(i);
-
-                worker_resource->executeCreateQuery(context_for_create, create_query, false, ColumnsDescription::parse(object_columns));
+                create_queries.emplace_back(request->create_queries().at(i));
+                object_columns_list.emplace_back(ColumnsDescription::parse(request->dynamic_object_column_schema().at(i)));
             }
 
+            /// Cloud tables are constructed concurrently, each over its own copy of the session context.
+            worker_resource->executeCreateQueries(query_context, create_queries, object_columns_list);
 
             LOG_DEBUG(log, "Successfully create {} queries for Session: {}", request->create_queries_size(), request->txn_id());
         }
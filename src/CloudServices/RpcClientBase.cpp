@@ -73,6 +73,9 @@ void RpcClientBase::assertController(const brpc::Controller & cntl)
 {
     if (cntl.Failed())
     {
+        if (consecutive_failures.fetch_add(1, std::memory_order_relaxed) + 1 >= PROBATION_FAILURES)
+            probation_until.store(time(nullptr) + PROBATION_SECONDS, std::memory_order_relaxed);
+
         auto err = cntl.ErrorCode();
 
         if (err == ECONNREFUSED || err == ECONNRESET || err == ENETUNREACH)
@@ -96,6 +99,15 @@ void RpcClientBase::assertController(const brpc::Controller & cntl)
     else
     {
         ok_.store(true, std::memory_order_relaxed);
+        consecutive_failures.store(0, std::memory_order_relaxed);
+
+        auto sample = static_cast<UInt64>(cntl.latency_us());
+        UInt64 old_value = ewma_latency_us.load(std::memory_order_relaxed);
+        UInt64 new_value;
+        do
+        {
+            new_value = old_value ? (old_value - old_value / EWMA_ALPHA_INVERSE + sample / EWMA_ALPHA_INVERSE) : sample;
+        } while (!ewma_latency_us.compare_exchange_weak(old_value, new_value, std::memory_order_relaxed));
     }
 }
 
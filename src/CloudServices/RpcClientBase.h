@@ -46,6 +46,14 @@ public:
     bool ok() const { return ok_.load(std::memory_order_relaxed); }
     void reset() { ok_.store(true, std::memory_order_relaxed); }
 
+    /// Smoothed latency of completed RPCs in microseconds; 0 until the first sample.
+    /// Maintained by assertController(), used for latency-aware worker selection.
+    UInt64 getSmoothedLatencyUs() const { return ewma_latency_us.load(std::memory_order_relaxed); }
+
+    /// Whether the peer recently failed several RPCs in a row and should only be
+    /// picked when there is no better choice.
+    bool inProbation() const { return time(nullptr) < probation_until.load(std::memory_order_relaxed); }
+
     auto & getChannel() { return *channel; }
 
     auto getActiveTime() const { return time(nullptr) - start_up_time; }
@@ -61,6 +69,14 @@ protected:
     std::atomic_bool ok_{true};
     time_t start_up_time{0};
     std::unique_ptr<brpc::ChannelOptions> default_options;
+
+    /// EWMA with weight 1/EWMA_ALPHA_INVERSE for a new sample.
+    static constexpr UInt64 EWMA_ALPHA_INVERSE = 8;
+    static constexpr size_t PROBATION_FAILURES = 3;
+    static constexpr time_t PROBATION_SECONDS = 30;
+    std::atomic<UInt64> ewma_latency_us{0};
+    std::atomic<size_t> consecutive_failures{0};
+    std::atomic<time_t> probation_until{0};
 };
 
 }
@@ -16,9 +16,13 @@
 #include <CloudServices/selectPartsToMerge.h>
 
 #include <Catalog/DataModelPartWrapper.h>
+#include <Core/UUID.h>
 #include <MergeTreeCommon/MergeTreeMetaBase.h>
 #include <Storages/MergeTree/DanceMergeSelector.h>
+#include <Storages/MergeTree/MergeSelectorAdaptiveController.h>
 #include <Storages/MergeTree/SimpleMergeSelector.h>
+#include <Storages/PartCacheManager.h>
+#include <Common/Exception.h>
 
 namespace DB
 {
@@ -230,6 +234,36 @@ ServerSelectPartsDecision selectPartsToMerge(
         merge_settings.min_parts_to_merge_base = 1;
     merge_settings.final = final;
     merge_settings.max_age_for_single_part_chain = data_settings->merge_with_ttl_timeout;
+
+    String table_uuid;
+    if (merge_settings.enable_adaptive_base)
+    {
+        /// Feed the current part count per partition into the feedback controller, so it can
+        /// track the trend and adjust the selector base before this selection round.
+        table_uuid = UUIDHelpers::UUIDToString(data.getStorageUUID());
+        try
+        {
+            if (auto cache_manager = data.getContext()->getPartCacheManager())
+            {
+                std::unordered_map<String, PartitionFullPtr> partition_metrics;
+                if (cache_manager->getPartsInfoMetrics(data, partition_metrics, /*require_partition_info=*/false))
+                {
+                    auto & adaptive_controller = MergeSelectorAdaptiveController::instance();
+                    for (auto & [partition_id, partition_full] : partition_metrics)
+                    {
+                        if (partition_full->partition_info_ptr && partition_full->partition_info_ptr->metrics_ptr)
+                            adaptive_controller.observePartition(
+                                table_uuid, partition_id, partition_full->partition_info_ptr->metrics_ptr->read().total_parts_number);
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log ? log : &Poco::Logger::get("selectPartsToMerge"));
+        }
+    }
+
     auto merge_selector = std::make_unique<DanceMergeSelector>(data, merge_settings);
 
     auto ranges = merge_selector->selectMulti(parts_ranges, max_total_size_to_merge, nullptr);
@@ -239,6 +273,7 @@ ServerSelectPartsDecision selectPartsToMerge(
         return ServerSelectPartsDecision::CANNOT_SELECT;
     }
 
+    size_t res_start = res.size();
     for (auto & range : ranges)
     {
         /// Do not allow to "merge" part with itself for regular merges, unless it is a TTL-merge where it is ok to remove some values with expired ttl
@@ -259,6 +294,32 @@ ServerSelectPartsDecision selectPartsToMerge(
             res.back().push_back(*static_cast<const ServerDataPartPtr *>(part.data));
     }
 
+    if (merge_settings.enable_adaptive_base)
+    {
+        /// Feed back the ranges that were picked: bytes they will rewrite and the share of them
+        /// that is freshly ingested data, from which the controller estimates realized write
+        /// amplification.
+        std::unordered_map<String, std::tuple<size_t, UInt64, UInt64>> selected_per_partition;
+        for (size_t i = res_start; i < res.size(); ++i)
+        {
+            const auto & selected_parts = res[i];
+            auto & [num_ranges, bytes_to_rewrite, bytes_in_new_parts]
+                = selected_per_partition[selected_parts.front()->info().partition_id];
+            ++num_ranges;
+            for (const auto & part : selected_parts)
+            {
+                bytes_to_rewrite += part->part_model().size();
+                if (part->info().level == 0)
+                    bytes_in_new_parts += part->part_model().size();
+            }
+        }
+
+        auto & adaptive_controller = MergeSelectorAdaptiveController::instance();
+        for (const auto & [partition_id, selected] : selected_per_partition)
+            adaptive_controller.onMergesSelected(
+                table_uuid, partition_id, std::get<0>(selected), std::get<1>(selected), std::get<2>(selected));
+    }
+
     return ServerSelectPartsDecision::SELECTED;
 }
 
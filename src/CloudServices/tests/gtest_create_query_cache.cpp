@@ -0,0 +1,48 @@
+#include <CloudServices/CnchCreateQueryHelper.h>
+#include <Parsers/ASTCreateQuery.h>
+#include <Parsers/formatAST.h>
+#include <gtest/gtest.h>
+#include <Common/tests/gtest_global_context.h>
+#include <Interpreters/Context.h>
+
+using namespace DB;
+
+namespace
+{
+
+ContextMutablePtr createCachingContext()
+{
+    auto context = Context::createCopy(getContext().context);
+    context->setSetting("enable_cloud_table_definition_cache", true);
+    return context;
+}
+
+}
+
+TEST(CreateQueryCacheTest, CachedParseMatchesDirectParse)
+{
+    String query = "create table gztest.test(id Int32, s String) ENGINE=CnchMergeTree order by id";
+
+    auto cached = parseCreateQueryWithCache(query, createCachingContext());
+    auto direct = parseCreateQueryWithCache(query, getContext().context);
+
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(serializeAST(*cached), serializeAST(*direct));
+}
+
+TEST(CreateQueryCacheTest, ClonesAreIndependent)
+{
+    String query = "create table gztest.test_clone(id Int32) ENGINE=CnchMergeTree order by id";
+    auto context = createCachingContext();
+
+    auto first = parseCreateQueryWithCache(query, context);
+    String pristine_text = serializeAST(*first);
+
+    /// Mutating one clone the way executeCreateQuery does must not poison the cached copy.
+    first->attach = true;
+    first->create = false;
+    first->table = "renamed";
+
+    auto second = parseCreateQueryWithCache(query, context);
+    ASSERT_EQ(serializeAST(*second), pristine_text);
+}
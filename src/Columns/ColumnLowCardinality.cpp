@@ -646,29 +646,32 @@ void ColumnLowCardinality::getPermutationImpl(IColumn::PermutationSortDirection
     else
         getDictionary().getNestedColumn()->getPermutation(direction, stability, unique_limit, nan_direction_hint, unique_perm);
 
-    /// TODO: optimize with sse.
-
-    /// Get indexes per row in column_unique.
-    std::vector<std::vector<size_t>> indexes_per_row(getDictionary().size());
+    /// Counting sort on the indexes: count the rows of every dictionary key, lay the
+    /// keys' slices out in dictionary-sorted order, then scatter the rows into their
+    /// slices in one pass. Rows are visited in order, so equal keys stay stable.
+    size_t dict_size = getDictionary().size();
     size_t indexes_size = getIndexes().size();
+
+    PaddedPODArray<size_t> counts(dict_size, 0);
     for (size_t row = 0; row < indexes_size; ++row)
-        indexes_per_row[getIndexes().getUInt(row)].push_back(row);
+        ++counts[getIndexes().getUInt(row)];
+
+    /// Current write offset of each key's slice in the result.
+    PaddedPODArray<size_t> offsets(dict_size, 0);
+    size_t accumulated = 0;
+    for (auto unique_position : unique_perm)
+    {
+        offsets[unique_position] = accumulated;
+        accumulated += counts[unique_position];
+    }
 
-    /// Replicate permutation.
     size_t perm_size = std::min(indexes_size, limit);
     res.resize(perm_size);
-    size_t perm_index = 0;
-    for (size_t row = 0; row < unique_perm.size() && perm_index < perm_size; ++row)
+    for (size_t row = 0; row < indexes_size; ++row)
     {
-        const auto & row_indexes = indexes_per_row[unique_perm[row]];
-        for (auto row_index : row_indexes)
-        {
-            res[perm_index] = row_index;
-            ++perm_index;
-
-            if (perm_index == perm_size)
-                break;
-        }
+        size_t position = offsets[getIndexes().getUInt(row)]++;
+        if (position < perm_size)
+            res[position] = row;
     }
 }
 
@@ -313,13 +313,13 @@ void ColumnVector<T, has_buf>::getPermutation(IColumn::PermutationSortDirection
             res[i] = i;
 
         if (direction == IColumn::PermutationSortDirection::Ascending && stability == IColumn::PermutationSortStability::Unstable)
-            std::sort(res.begin(), res.end(), less(*this, nan_direction_hint));
+            pdqsort(res.begin(), res.end(), less(*this, nan_direction_hint));
         else if (direction == IColumn::PermutationSortDirection::Ascending && stability == IColumn::PermutationSortStability::Stable)
-            std::sort(res.begin(), res.end(), less_stable(*this, nan_direction_hint));
+            pdqsort(res.begin(), res.end(), less_stable(*this, nan_direction_hint));
         else if (direction == IColumn::PermutationSortDirection::Descending && stability == IColumn::PermutationSortStability::Unstable)
-            std::sort(res.begin(), res.end(), greater(*this, nan_direction_hint));
+            pdqsort(res.begin(), res.end(), greater(*this, nan_direction_hint));
         else if (direction == IColumn::PermutationSortDirection::Descending && stability == IColumn::PermutationSortStability::Stable)
-            std::sort(res.begin(), res.end(), greater_stable(*this, nan_direction_hint));
+            pdqsort(res.begin(), res.end(), greater_stable(*this, nan_direction_hint));
     }
 }
 
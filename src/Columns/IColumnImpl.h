@@ -10,6 +10,8 @@
 #include <Common/PODArray.h>
 #include <common/sort.h>
 
+#include <pdqsort.h>
+
 namespace DB
 {
 namespace ErrorCodes
@@ -22,7 +24,7 @@ struct DefaultSort
     template <typename RandomIt, typename Compare>
     void operator()(RandomIt begin, RandomIt end, Compare compare)
     {
-        std::sort(begin, end, compare);
+        pdqsort(begin, end, compare);
     }
 };
 
@@ -65,6 +65,8 @@ struct MetastoreConfig
                 topology_key = poco_config.getString(service_name + ".topology_key");
             }
 
+            cache_lease_milliseconds = poco_config.getUInt64(service_name + ".cache_lease_milliseconds", 0);
+
             if (service_name == TSO_SERVICE_CONFIGURE)
                 key_name = poco_config.getString(service_name + ".key_name", "tso");
         }
@@ -75,6 +77,9 @@ struct MetastoreConfig
     ByteKVConf bytekv_conf;
     String topology_key;
 
+    /// Lease TTL of the read-through cache on hot metadata keys. 0 disables the cache.
+    uint64_t cache_lease_milliseconds = 0;
+
     // TSO service only.
     String key_name;
 };
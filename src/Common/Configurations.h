@@ -69,6 +69,8 @@ struct SDKVConfiguration final : public SDKVConfigurationData
     M(UInt64, port, "", 9000, ConfigFlag::Default, "desc: rpc port") \
     M(UInt64, tso_window_ms, "", 3000, ConfigFlag::Default, "") \
     M(UInt64, tso_max_retry_count, "", 3, ConfigFlag::Default, "") \
+    M(UInt64, tso_batch_window_size, "", 0, ConfigFlag::Default, "desc: fetch this many timestamps per RPC and vend them locally, 0 or 1 keeps one RPC per timestamp") \
+    M(UInt64, tso_batch_window_ttl_ms, "", 10, ConfigFlag::Default, "desc: locally vended timestamps expire after this interval to bound their physical staleness") \
 
 DECLARE_CONFIG_DATA(TSOConfigurationData, TSO_CONFIG_FIELDS_LIST)
 struct TSOConfiguration final: public TSOConfigurationData
@@ -139,6 +141,7 @@ struct BSPConfiguration final : public BSPConfigurationData
     M(Int64, cnch_merge_txn_commit_timeout, "", 10, ConfigFlag::Default, "") \
     M(Float32, max_ratio_of_cnch_tasks_to_threads, "", 1.5, ConfigFlag::Default, "") \
     M(Float32, vw_ratio_of_busy_worker, "", 1.2, ConfigFlag::Default, "The ratio for detecting busy worker in the VW.") \
+    M(Bool, vw_enable_latency_aware_pick, "", true, ConfigFlag::Default, "Compare the smoothed RPC latency of two candidates (power of two choices) when picking a worker from the VW.") \
     M(UInt64, max_async_query_threads, "", 5000, ConfigFlag::Default, "Maximum threads that async queries use.") \
     M(UInt64, async_query_status_ttl, "", 86400, ConfigFlag::Default, "TTL for async query status stored in catalog, in seconds.") \
     M(UInt64, async_query_expire_time, "", 3600, ConfigFlag::Default, "Expire time for async query, in seconds.") \
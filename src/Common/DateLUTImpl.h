@@ -333,6 +333,12 @@ private:
 public:
     const std::string & getTimeZone() const { return time_zone; }
 
+    /// Whether the UTC offset stayed a whole number of hours (resp. minutes) for every day since the epoch.
+    /// When true, rounding a non-negative timestamp down to an interval dividing an hour (resp. a minute)
+    /// is plain arithmetic and needs no lookup in the LUT.
+    bool offsetIsWholeNumberOfHoursDuringEpoch() const { return offset_is_whole_number_of_hours_during_epoch; }
+    bool offsetIsWholeNumberOfMinutesDuringEpoch() const { return offset_is_whole_number_of_minutes_during_epoch; }
+
     // Methods only for unit-testing, it makes very little sense to use it from user code.
     auto getOffsetAtStartOfEpoch() const { return offset_at_start_of_epoch; }
     auto getTimeOffsetAtStartOfLUT() const { return offset_at_start_of_lut; }
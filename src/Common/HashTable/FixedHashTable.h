@@ -237,6 +237,9 @@ public:
 
     size_t hash(const Key & x) const { return x; }
 
+    /// Same interface as HashTable::prefetch; cells are addressed by key directly.
+    void ALWAYS_INLINE prefetch(size_t hash_value) const { __builtin_prefetch(&buf[hash_value]); }
+
     FixedHashTable() { alloc(); }
 
     FixedHashTable(FixedHashTable && rhs) : buf(nullptr) { *this = std::move(rhs); }
@@ -492,6 +495,9 @@ public:
     size_t size() const { return this->getSize(buf, *this, NUM_CELLS); }
     bool empty() const { return this->isEmpty(buf, *this, NUM_CELLS); }
 
+    /// The buffer always holds NUM_CELLS cells, there is nothing to preallocate.
+    void reserve(size_t) {}
+
     void clear()
     {
         destroyElements();
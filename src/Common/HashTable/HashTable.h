@@ -824,6 +824,13 @@ public:
 
     size_t hash(const Key & x) const { return Hash::operator()(x); }
 
+    /// Prefetch the cell a lookup for this hash would probe first. Used by batched
+    /// probers (e.g. the join probe loop) to hide cache misses behind useful work.
+    void ALWAYS_INLINE prefetch(size_t hash_value) const
+    {
+        __builtin_prefetch(&buf[grower.place(hash_value)]);
+    }
+
 
     HashTable()
     {
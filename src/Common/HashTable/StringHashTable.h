@@ -232,6 +232,14 @@ public:
 
     ~StringHashTable() = default;
 
+    void reserve(size_t num_elements)
+    {
+        m1.reserve(num_elements / 4);
+        m2.reserve(num_elements / 4);
+        m3.reserve(num_elements / 4);
+        ms.reserve(num_elements / 4);
+    }
+
     static constexpr bool IS_SPECIAL_HT_FOR_SMALL_KEYS = false;
 
 public:
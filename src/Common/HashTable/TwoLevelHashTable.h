@@ -99,6 +99,12 @@ public:
             impl.reserve(size_hint / NUM_BUCKETS);
     }
 
+    void reserve(size_t num_elements)
+    {
+        for (auto & impl : impls)
+            impl.reserve(num_elements / NUM_BUCKETS);
+    }
+
     template <typename Source>
     void insertFrom(const Source & src)
     {
@@ -40,6 +40,12 @@ public:
 
     TwoLevelStringHashTable() {}
 
+    void reserve(size_t num_elements)
+    {
+        for (auto & impl : impls)
+            impl.reserve(num_elements / NUM_BUCKETS);
+    }
+
     template <typename Source>
     TwoLevelStringHashTable(const Source & src)
     {
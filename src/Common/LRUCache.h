@@ -319,6 +319,16 @@ public:
         return max_size;
     }
 
+    /// Change the capacity at runtime, evicting from the cold end when the cache shrank
+    /// below its current weight. Lets CacheSizeArbiter move budget between caches while
+    /// the workload shifts.
+    void setMaxSize(size_t new_max_size)
+    {
+        std::lock_guard lock(mutex);
+        max_size = std::max(static_cast<size_t>(1), new_max_size);
+        removeOverflow(Clock::now());
+    }
+
     void reset()
     {
         std::lock_guard lock(mutex);
@@ -478,7 +488,8 @@ private:
 
     /// Total weight of values.
     size_t current_size = 0;
-    const size_t max_size;
+    /// Atomic so that maxSize() stays lock-free while setMaxSize() updates it under the mutex.
+    std::atomic<size_t> max_size;
     const Delay expiration_delay;
 
     std::atomic<size_t> hits {0};
@@ -77,8 +77,11 @@
     M(TableFunctionExecute, "") \
     M(MarkCacheHits, "") \
     M(MarkCacheMisses, "") \
+    M(MarkCacheCompressedTierHits, "") \
     M(QueryCacheHits, "") \
     M(QueryCacheMisses, "") \
+    M(PlanSegmentResultCacheHits, "") \
+    M(PlanSegmentResultCacheMisses, "") \
     M(PrimaryIndexCacheHits, "") \
     M(PrimaryIndexCacheMisses, "") \
     M(PrimaryIndexDiskCacheHits, "") \
@@ -86,6 +89,8 @@
     M(LoadPrimaryIndexMicroseconds, "") \
     M(ChecksumsCacheHits, "") \
     M(ChecksumsCacheMisses, "") \
+    M(LowCardinalityDictionaryCacheHits, "") \
+    M(LowCardinalityDictionaryCacheMisses, "") \
     M(LoadDataPartFooter, "Number of times load data part footer from remote.") \
     M(LoadChecksums, "Number of times load checksums.") \
     M(LoadRemoteChecksums, "Number of times load checksums from remote.") \
@@ -205,6 +210,7 @@
     M(IndexGranuleSeekTime, "The total time that skip index spent on seeking files.") \
     M(IndexGranuleReadTime, "The total time that skip index spent on reading files.") \
     M(IndexGranuleCalcTime, "The total time that skip index spent on calculating conditions.") \
+    M(RuntimeFilterPrunedGranules, "Number of granules dropped by probing runtime bloom filters during index analysis.") \
 \
     M(Merge, "Number of launched background merges.") \
     M(MergedRows, "Rows read for background merges. This is the number of rows before merge.") \
@@ -316,6 +322,13 @@
     M(ThreadPoolReaderScheduleMicroseconds, "Time spent waiting for scheduling.") \
     M(ThreadPoolReaderReadBytes, "Bytes read from a thread pool task in asynchronous reading") \
     M(ThreadPoolReaderSubmit, "The number of submit asynchronous reading tasks.") \
+    M(ThreadPoolReaderPageCacheHit, "Number of times the read inside ThreadPoolReader was done from page cache.") \
+    M(ThreadPoolReaderPageCacheHitBytes, "Number of bytes read inside ThreadPoolReader when it was done from page cache.") \
+    M(ThreadPoolReaderPageCacheHitElapsedMicroseconds, "Time spent reading data from page cache in ThreadPoolReader.") \
+    M(ThreadPoolReaderPageCacheMiss, "Number of times the read inside ThreadPoolReader was not done from page cache and was handed off to the thread pool.") \
+    M(ThreadPoolReaderPageCacheMissBytes, "Number of bytes read inside ThreadPoolReader when read was not done from page cache and was handed off to the thread pool.") \
+    M(ThreadPoolReaderPageCacheMissElapsedMicroseconds, "Time spent reading data inside the asynchronous job in ThreadPoolReader - when read was not done from page cache.") \
+    M(AsynchronousReadWaitMicroseconds, "Time spent in waiting for asynchronous local reads.") \
     \
     M(CannotWriteToWriteBufferDiscard, \
       "Number of stack traces dropped by query profiler or signal handler because pipe is full or cannot write to pipe.") \
@@ -413,6 +426,9 @@
     M(HdfsGetBlkLocMicroseconds, "Total number of milliseconds spent to call getBlockLocations") \
     M(HdfsSlowNodeCount, "Total number of milliseconds spent to call getBlockLocations") \
     M(HdfsFailedNodeCount, "Total number of milliseconds spent to call getBlockLocations") \
+\
+    M(HedgedRemoteReads, "Number of hedge requests issued because a remote read exceeded its adaptive deadline") \
+    M(HedgedRemoteReadsWon, "Number of hedge requests that finished before the original remote read") \
 \
     M(DiskCacheGetMicroSeconds, "Total time for disk cache get operation") \
     M(DiskCacheAcquireStatsLock, "Total time for acquire table stats lock") \
@@ -423,6 +439,9 @@
     M(DiskCacheGetTotalOps, "Total count of disk cache get operations") \
     M(DiskCacheSetTotalOps, "Total count of disk cache set operations") \
     M(DiskCacheSetTotalBytes, "Total  of disk cache set operations") \
+    M(DiskCacheSetCoalescedSegments, "Total count of disk cache segments populated through coalesced source reads") \
+    M(DiskCacheDuplicateFetchesSkipped, "Total count of disk cache segment fetches skipped because another task was already fetching the same segment") \
+    M(DiskCacheSetCoalescedBytes, "Total bytes of disk cache segments populated through coalesced source reads") \
     M(DiskCacheDeviceBytesWritten, "Total bytes written of disk cache device") \
     M(DiskCacheDeviceBytesRead, "Total bytes read of disk cache device") \
     M(DiskCacheDeviceWriteIOErrors, "Total errors of disk cache device write io") \
@@ -643,6 +662,8 @@
     M(SetTransactionRecordFailed, "") \
     M(SetTransactionRecordWithRequestsSuccess, "") \
     M(SetTransactionRecordWithRequestsFailed, "") \
+    M(SetTransactionRecordsSuccess, "") \
+    M(SetTransactionRecordsFailed, "") \
     M(SetTransactionRecordCleanTimeSuccess, "") \
     M(SetTransactionRecordCleanTimeFailed, "") \
     M(SetTransactionRecordStatusWithOffsetsSuccess, "") \
@@ -693,6 +714,10 @@
     M(ClearFilesysLockTxnIdFailed, "") \
     M(GetAllFilesysLockSuccess, "") \
     M(GetAllFilesysLockFailed, "") \
+    M(TryClaimGlobalGCPartitionSuccess, "") \
+    M(TryClaimGlobalGCPartitionFailed, "") \
+    M(ReleaseGlobalGCPartitionSuccess, "") \
+    M(ReleaseGlobalGCPartitionFailed, "") \
     M(InsertTransactionSuccess, "") \
     M(InsertTransactionFailed, "") \
     M(RemoveTransactionSuccess, "") \
@@ -867,6 +892,8 @@
     M(CnchDataDeleteBitmapCacheMisses, "")\
     M(CnchReadSizeFromDiskCache, "") \
     M(CnchReadSizeFromRemote, "") \
+    M(CnchDiskCacheReadaheadSegments, "") \
+    M(CnchDiskCacheReadaheadBytes, "") \
     M(CnchReadDataMicroSeconds,"") \
     M(CnchAddStreamsElapsedMilliseconds,"") \
     M(CnchAddStreamsParallelTasks,"") \
@@ -0,0 +1,77 @@
+#include <Common/SegmentProfileSamples.h>
+
+#include <Common/SipHash.h>
+
+namespace DB
+{
+
+SegmentProfileSamples & SegmentProfileSamples::instance()
+{
+    static SegmentProfileSamples ret;
+    return ret;
+}
+
+void SegmentProfileSamples::add(const String & query_id, Int32 segment_id, TraceType trace_type, const Array & trace, UInt64 timestamp_ns)
+{
+    SipHash hash;
+    hash.update(query_id.data(), query_id.size());
+    hash.update(segment_id);
+    hash.update(trace_type);
+    for (const auto & frame : trace)
+        hash.update(frame.safeGet<UInt64>());
+    UInt64 key = hash.get64();
+
+    std::lock_guard lock(mutex);
+
+    auto it = samples.find(key);
+    if (it != samples.end())
+    {
+        ++it->second.samples;
+        it->second.last_timestamp_ns = timestamp_ns;
+        return;
+    }
+
+    if (samples.size() >= max_entries)
+    {
+        evictStaleLocked(timestamp_ns);
+        if (samples.size() >= max_entries)
+            return;
+    }
+
+    Sample sample{query_id, segment_id, trace_type, trace, 1, timestamp_ns};
+    samples.emplace(key, std::move(sample));
+}
+
+void SegmentProfileSamples::evictStaleLocked(UInt64 now_ns)
+{
+    if (now_ns < last_eviction_ns + eviction_interval_ns)
+        return;
+    last_eviction_ns = now_ns;
+
+    for (auto it = samples.begin(); it != samples.end();)
+    {
+        if (it->second.last_timestamp_ns + entry_ttl_ns < now_ns)
+            it = samples.erase(it);
+        else
+            ++it;
+    }
+}
+
+std::vector<SegmentProfileSamples::Sample> SegmentProfileSamples::get() const
+{
+    std::vector<Sample> res;
+
+    std::lock_guard lock(mutex);
+    res.reserve(samples.size());
+    for (const auto & [_, sample] : samples)
+        res.push_back(sample);
+    return res;
+}
+
+void SegmentProfileSamples::clear()
+{
+    std::lock_guard lock(mutex);
+    samples.clear();
+}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Core/Field.h>
+#include <Common/TraceCollector.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace DB
+{
+
+/** In-memory aggregation of sampling profiler stacks attributed to plan segments.
+  *
+  * TraceCollector feeds every Real/CPU sample that carries a plan segment id here.
+  * Samples with the same (query_id, segment_id, trace_type, stack) collapse into one
+  * entry with a counter, so memory is proportional to the number of distinct hot
+  * stacks rather than to the sampling rate. The map is bounded: when it is full,
+  * entries that have not been hit for a while are aged out first, and only if that
+  * frees nothing are new distinct stacks dropped. Counters of already known stacks
+  * keep growing either way.
+  *
+  * Exposed through the system.segment_profile table.
+  */
+class SegmentProfileSamples
+{
+public:
+    struct Sample
+    {
+        String query_id;
+        Int32 segment_id = -1;
+        TraceType trace_type{};
+        Array trace;
+        UInt64 samples = 0;
+        UInt64 last_timestamp_ns = 0;
+    };
+
+    static SegmentProfileSamples & instance();
+
+    void add(const String & query_id, Int32 segment_id, TraceType trace_type, const Array & trace, UInt64 timestamp_ns);
+
+    std::vector<Sample> get() const;
+
+    void clear();
+
+private:
+    /// With 45-frame stacks an entry is well under 1 KiB, so the cap bounds the
+    /// aggregation at tens of megabytes in the worst case.
+    static constexpr size_t max_entries = 1 << 16;
+    /// Entries not hit for this long may be evicted when the map is full, so stacks
+    /// of long-finished queries cannot freeze the aggregation forever.
+    static constexpr UInt64 entry_ttl_ns = 10ULL * 60 * 1000000000;
+    /// The eviction scan is O(map size); run it at most this often.
+    static constexpr UInt64 eviction_interval_ns = 1000000000;
+
+    /// Drops entries whose last sample is older than entry_ttl_ns. Must be called with
+    /// `mutex` held; rate-limited by eviction_interval_ns.
+    void evictStaleLocked(UInt64 now_ns);
+
+    mutable std::mutex mutex;
+    /// Keyed by a hash of (query_id, segment_id, trace_type, stack).
+    std::unordered_map<UInt64, Sample> samples;
+    UInt64 last_eviction_ns = 0;
+};
+
+}
@@ -147,4 +147,38 @@ std::vector<cpu_set_t> SystemUtils::getNumaNodesCpuMask()
 #endif
 }
 
+bool SystemUtils::parseCpuAffinityMask(const std::string & cpu_list_str, cpu_set_t & mask)
+{
+#if defined(__linux__)
+    CPU_ZERO(&mask);
+
+    std::vector<size_t> cpu_list;
+    try
+    {
+        cpu_list = parse_cpu_list(cpu_list_str);
+    }
+    catch (std::exception &)
+    {
+        return false;
+    }
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (0 != sched_getaffinity(0, sizeof(allowed), &allowed))
+        return false;
+
+    for (auto cpu_index : cpu_list)
+    {
+        if (cpu_index < CPU_SETSIZE && CPU_ISSET(cpu_index, &allowed))
+            CPU_SET(cpu_index, &mask);
+    }
+
+    return CPU_COUNT(&mask) > 0;
+#else
+    (void)cpu_list_str;
+    (void)mask;
+    return false;
+#endif
+}
+
 }
@@ -164,6 +164,11 @@ public:
 
     static std::vector<cpu_set_t> getNumaNodesCpuMask();
 
+    /// Parses a kernel-style cpu list ("0-3,8,10-11") into an affinity mask, intersected
+    /// with the cpus the process is currently allowed to run on, so cgroup/cpuset limits
+    /// are respected. Returns false if the list cannot be parsed or the intersection is empty.
+    static bool parseCpuAffinityMask(const std::string & cpu_list_str, cpu_set_t & mask);
+
     static void getCpuUsageInfo(const std::unordered_set<size_t> & cpu_nodes, std::vector<CpuUsageInfo> & cpu_usage_info_vec)
     {
 #if defined(__linux__)
@@ -201,4 +206,36 @@ public:
 
 std::vector<size_t> parse_cpu_list(const std::string & cpu_list_str);
 
+/// Pins the calling thread to the given mask for the lifetime of the object and restores
+/// the previous affinity on destruction. Meant for threads that are returned to a shared
+/// pool and must not keep the pinning beyond one task.
+class ScopedThreadCpuAffinity
+{
+public:
+    explicit ScopedThreadCpuAffinity(const cpu_set_t & mask)
+    {
+#if defined(__linux__)
+        restore = (0 == sched_getaffinity(0, sizeof(previous), &previous))
+            && (0 == sched_setaffinity(0, sizeof(mask), &mask));
+#else
+        (void)mask;
+#endif
+    }
+
+    ~ScopedThreadCpuAffinity()
+    {
+#if defined(__linux__)
+        if (restore)
+            (void)sched_setaffinity(0, sizeof(previous), &previous);
+#endif
+    }
+
+    ScopedThreadCpuAffinity(const ScopedThreadCpuAffinity &) = delete;
+    ScopedThreadCpuAffinity & operator=(const ScopedThreadCpuAffinity &) = delete;
+
+private:
+    cpu_set_t previous{};
+    bool restore = false;
+};
+
 }
@@ -108,6 +108,10 @@ public:
 
     String query;
     UInt64 normalized_query_hash = 0;
+
+    /// Id of the plan segment this group executes, -1 if the group does not belong to a plan segment.
+    /// Threads attached to the group copy it, so profiler samples from all pipeline threads carry it.
+    Int32 plan_segment_id = -1;
 };
 
 
@@ -142,6 +146,10 @@ public:
     /// Also called "nice" value. If it was changed to non-zero (when attaching query) - will be reset to zero when query is detached.
     Int32 os_thread_priority = 0;
 
+    /// Id of the plan segment being executed by this thread, -1 if the thread does not run a plan segment.
+    /// Read from the signal handler by TraceCollector::collect, so it is a plain field like thread_id.
+    Int32 plan_segment_id = -1;
+
     /// TODO: merge them into common entity
     ProfileEvents::Counters performance_counters{VariableContext::Thread};
     MemoryTracker memory_tracker{VariableContext::Thread};
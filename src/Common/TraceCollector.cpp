@@ -10,6 +10,7 @@
 #include <Poco/Logger.h>
 #include <Common/Exception.h>
 #include <Common/PipeFDs.h>
+#include <Common/SegmentProfileSamples.h>
 #include <Common/StackTrace.h>
 #include <Common/setThreadName.h>
 #include <common/logger_useful.h>
@@ -69,6 +70,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
         + sizeof(StackTrace::FramePointers)  /// Collected stack trace, maximum capacity
         + sizeof(TraceType)                  /// trace type
         + sizeof(UInt64)                     /// thread_id
+        + sizeof(Int32)                      /// plan segment id
         + sizeof(Int64);                     /// size
 
     /// Write should be atomic to avoid overlaps
@@ -81,6 +83,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
 
     StringRef query_id;
     UInt64 thread_id;
+    Int32 segment_id = -1;
 
     if (CurrentThread::isInitialized())
     {
@@ -88,6 +91,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
         query_id.size = std::min(query_id.size, QUERY_ID_MAX_LEN);
 
         thread_id = CurrentThread::get().thread_id;
+        segment_id = CurrentThread::get().plan_segment_id;
     }
     else
     {
@@ -107,6 +111,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
 
     writePODBinary(trace_type, out);
     writePODBinary(thread_id, out);
+    writePODBinary(segment_id, out);
     writePODBinary(size, out);
 
     out.next();
@@ -166,19 +171,28 @@ void TraceCollector::run()
         UInt64 thread_id;
         readPODBinary(thread_id, in);
 
+        Int32 segment_id;
+        readPODBinary(segment_id, in);
+
         Int64 size;
         readPODBinary(size, in);
 
+        // time and time_in_microseconds are both being constructed from the same timespec so that the
+        // times will be equal up to the precision of a second.
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+
+        UInt64 time = UInt64(ts.tv_sec * 1000000000LL + ts.tv_nsec);
+        UInt64 time_in_microseconds = UInt64((ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000));
+
+        /// Samples attributed to a plan segment also feed the in-memory aggregation
+        /// behind system.segment_profile.
+        if (segment_id >= 0 && (trace_type == TraceType::Real || trace_type == TraceType::CPU))
+            SegmentProfileSamples::instance().add(query_id, segment_id, trace_type, trace, time);
+
         if (trace_log)
         {
-            // time and time_in_microseconds are both being constructed from the same timespec so that the
-            // times will be equal up to the precision of a second.
-            struct timespec ts;
-            clock_gettime(CLOCK_REALTIME, &ts);
-
-            UInt64 time = UInt64(ts.tv_sec * 1000000000LL + ts.tv_nsec);
-            UInt64 time_in_microseconds = UInt64((ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000));
-            TraceLogElement element{time_t(time / 1000000000), time_in_microseconds, time, trace_type, thread_id, query_id, trace, size};
+            TraceLogElement element{time_t(time / 1000000000), time_in_microseconds, time, trace_type, thread_id, query_id, segment_id, trace, size};
             trace_log->add(element);
         }
     }
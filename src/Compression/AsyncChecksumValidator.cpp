@@ -0,0 +1,72 @@
+#include <Compression/AsyncChecksumValidator.h>
+
+#include <cassert>
+#include <city.h>
+#include <Common/Exception.h>
+#include <Common/hex.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+using Checksum = CityHash_v1_0_2::uint128;
+
+AsyncChecksumValidator & AsyncChecksumValidator::instance()
+{
+    static AsyncChecksumValidator validator;
+    return validator;
+}
+
+AsyncChecksumValidator::AsyncChecksumValidator()
+    : pool(validation_threads, validation_threads, max_queued_blocks)
+    , log(&Poco::Logger::get("AsyncChecksumValidator"))
+{
+}
+
+void AsyncChecksumValidator::submit(const String & label, PODArray<char> frame, QuarantineCallback on_mismatch)
+{
+    /// ThreadPool jobs must be copyable, so the frame travels behind a shared_ptr.
+    auto frame_holder = std::make_shared<PODArray<char>>(std::move(frame));
+    auto task = [this, label, frame_holder, on_mismatch = std::move(on_mismatch)]
+    {
+        validate(label, *frame_holder, on_mismatch);
+    };
+
+    if (!pool.trySchedule(task))
+        task();
+}
+
+void AsyncChecksumValidator::validate(const String & label, const PODArray<char> & frame, const QuarantineCallback & on_mismatch)
+{
+    assert(frame.size() >= sizeof(Checksum));
+
+    const auto & expected_checksum = *reinterpret_cast<const Checksum *>(frame.data());
+    const char * data = frame.data() + sizeof(Checksum);
+    size_t size = frame.size() - sizeof(Checksum);
+
+    auto calculated_checksum = CityHash_v1_0_2::CityHash128(data, size);
+    if (expected_checksum == calculated_checksum)
+        return;
+
+    String message = fmt::format(
+        "Checksum mismatch detected by background validation in {}: reference {}{}, actual {}{}, size of compressed block {}",
+        label,
+        getHexUIntLowercase(expected_checksum.first), getHexUIntLowercase(expected_checksum.second),
+        getHexUIntLowercase(calculated_checksum.first), getHexUIntLowercase(calculated_checksum.second),
+        size);
+    LOG_ERROR(log, "{}", message);
+
+    if (on_mismatch)
+    {
+        try
+        {
+            on_mismatch(message);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Failed to quarantine corrupted data for " + label);
+        }
+    }
+}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <functional>
+#include <Common/PODArray.h>
+#include <Common/ThreadPool.h>
+
+namespace Poco { class Logger; }
+
+namespace DB
+{
+
+/** Background lane for validating checksums of compressed blocks off the read hot path.
+  *
+  * Readers that can recover from corruption (e.g. locally cached copies of remote data,
+  * which can be quarantined and re-fetched) hand a private copy of each compressed frame
+  * here and serve the decompressed block optimistically; a small thread pool recomputes
+  * the checksum behind the scenes. On mismatch the submitter's quarantine callback runs,
+  * so the corrupted copy is removed before it can serve another query.
+  *
+  * When the lane is saturated, validation happens synchronously on the submitting thread:
+  * overload degrades latency, never integrity.
+  */
+class AsyncChecksumValidator
+{
+public:
+    static AsyncChecksumValidator & instance();
+
+    using QuarantineCallback = std::function<void(const String & message)>;
+
+    /// `frame` holds the stored checksum followed by the compressed block it covers,
+    /// exactly as laid out on disk. `label` identifies the source in logs.
+    void submit(const String & label, PODArray<char> frame, QuarantineCallback on_mismatch);
+
+private:
+    AsyncChecksumValidator();
+
+    void validate(const String & label, const PODArray<char> & frame, const QuarantineCallback & on_mismatch);
+
+    static constexpr size_t validation_threads = 2;
+    static constexpr size_t max_queued_blocks = 10000;
+
+    ThreadPool pool;
+    Poco::Logger * log;
+};
+
+}
@@ -177,7 +177,18 @@ size_t CompressedReadBufferBase::readCompressedData(size_t & size_decompressed,
     if (!disable_checksum)
     {
         Checksum & checksum = *reinterpret_cast<Checksum *>(own_compressed_buffer.data());
-        validateChecksum(compressed_buffer, size_compressed_without_checksum, checksum);
+        if (checksum_offload)
+        {
+            /// Hand a private copy of the frame to the background checker and serve the
+            /// block optimistically; a copy is required because both the zero-copy and the
+            /// own-buffer variants of compressed_buffer are invalidated by the next read.
+            PODArray<char> frame(sizeof(Checksum) + size_compressed_without_checksum);
+            memcpy(frame.data(), &checksum, sizeof(Checksum));
+            memcpy(frame.data() + sizeof(Checksum), compressed_buffer, size_compressed_without_checksum);
+            checksum_offload(std::move(frame));
+        }
+        else
+            validateChecksum(compressed_buffer, size_compressed_without_checksum, checksum);
     }
 
     return size_compressed_without_checksum + sizeof(Checksum);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <Common/PODArray.h>
 #include <Compression/LZ4_decompress_faster.h>
 #include <Compression/ICompressionCodec.h>
@@ -27,6 +28,11 @@ protected:
     /// Don't checksum on decompressing.
     bool disable_checksum = false;
 
+    /// If set, checksums are not validated inline: each frame (stored checksum followed by
+    /// the compressed block) is copied and handed to this callback instead, and the block
+    /// is served optimistically. See offloadChecksumValidation().
+    std::function<void(PODArray<char> frame)> checksum_offload;
+
     /// Allow reading data, compressed by different codecs from one file.
     bool allow_different_codecs;
 
@@ -59,6 +65,15 @@ public:
         disable_checksum = true;
     }
 
+    /** Offload checksum validation to the given callback instead of doing it on the read path.
+      * Only suitable when the caller can recover from late-detected corruption, e.g. by
+      * quarantining a locally cached copy and re-fetching from the source of truth.
+      */
+    void offloadChecksumValidation(std::function<void(PODArray<char> frame)> offload)
+    {
+        checksum_offload = std::move(offload);
+    }
+
 public:
     CompressionCodecPtr codec;
 };
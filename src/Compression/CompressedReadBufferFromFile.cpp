@@ -20,14 +20,23 @@
  */
 
 #include <cassert>
+#include <cstring>
 
 #include "CompressedReadBufferFromFile.h"
 
 #include <Compression/LZ4_decompress_faster.h>
 #include <IO/WriteHelpers.h>
 #include <IO/createReadBufferFromFileBase.h>
+#include <Common/ProfileEvents.h>
+#include <Common/ThreadPool.h>
 
 
+namespace ProfileEvents
+{
+    extern const Event CompressedReadBufferBlocks;
+    extern const Event CompressedReadBufferBytes;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -38,6 +47,9 @@ namespace ErrorCodes
 
 bool CompressedReadBufferFromFile::nextImpl()
 {
+    if (decompress_ahead_blocks)
+        return nextDecompressAhead();
+
     /// TODO: handle hdfs case
     if (/*(storage_type == StorageType::Hdfs ||*/ is_limit /*)*/ && file_in.getPosition() >= limit_offset_in_file)
     {
@@ -71,6 +83,113 @@ bool CompressedReadBufferFromFile::nextImpl()
     return true;
 }
 
+
+void CompressedReadBufferFromFile::fillDecompressAheadQueue()
+{
+    while (decompress_ahead_queue.size() < decompress_ahead_blocks)
+    {
+        /// TODO: handle hdfs case
+        if (/*(storage_type == StorageType::Hdfs ||*/ is_limit /*)*/ && file_in.getPosition() >= limit_offset_in_file)
+            break;
+
+        DecompressAheadBlock block;
+        block.offset_in_compressed_file = file_in.getPosition();
+
+        size_t size_decompressed = 0;
+        size_t size_compressed_without_checksum = 0;
+        block.size_compressed = readCompressedData(size_decompressed, size_compressed_without_checksum, false);
+        if (!block.size_compressed)
+            break;
+
+        auto additional_size_at_the_end_of_buffer = codec->getAdditionalSizeAtTheEndOfBuffer();
+
+        /// `compressed_buffer` may point into file_in's internal buffer, which the next
+        /// readCompressedData call will overwrite, so the job gets its own copy of the block.
+        block.compressed.resize(size_compressed_without_checksum + additional_size_at_the_end_of_buffer);
+        memcpy(block.compressed.data(), compressed_buffer, size_compressed_without_checksum);
+        block.size_decompressed = size_decompressed;
+        block.decompressed.resize(size_decompressed + additional_size_at_the_end_of_buffer);
+
+        /// The codec may change between blocks when allow_different_codecs is set, so each job
+        /// decompresses with the codec readCompressedData resolved for its own block.
+        auto job = std::make_shared<std::packaged_task<void()>>(
+            [compressed = block.compressed.data(),
+             decompressed = block.decompressed.data(),
+             size_decompressed,
+             size_compressed_without_checksum,
+             block_codec = codec]
+            {
+                if (block_codec->isNone())
+                    memcpy(decompressed, compressed + ICompressionCodec::getHeaderSize(), size_decompressed);
+                else
+                    block_codec->decompress(compressed, size_compressed_without_checksum, decompressed);
+            });
+        block.done = job->get_future();
+        decompress_ahead_queue.push_back(std::move(block));
+
+        try
+        {
+            GlobalThreadPool::instance().scheduleOrThrowOnError([job] { (*job)(); });
+        }
+        catch (...)
+        {
+            /// The pool is saturated; decompress on the calling thread so the future
+            /// queued above always becomes ready.
+            (*job)();
+        }
+    }
+}
+
+
+bool CompressedReadBufferFromFile::nextDecompressAhead()
+{
+    fillDecompressAheadQueue();
+
+    if (decompress_ahead_queue.empty())
+    {
+        size_compressed = 0;
+        return false;
+    }
+
+    DecompressAheadBlock block = std::move(decompress_ahead_queue.front());
+    decompress_ahead_queue.pop_front();
+    block.done.get();    /// Rethrows decompression errors on the query thread.
+
+    ProfileEvents::increment(ProfileEvents::CompressedReadBufferBlocks);
+    ProfileEvents::increment(ProfileEvents::CompressedReadBufferBytes, block.size_decompressed);
+
+    memory = std::move(block.decompressed);
+    working_buffer = Buffer(memory.data(), memory.data() + block.size_decompressed);
+    size_compressed = block.size_compressed;
+    current_block_start = block.offset_in_compressed_file;
+
+    /// nextimpl_working_buffer_offset is set in the seek function (lazy seek). So we have to
+    /// check that we are not seeking beyond working buffer.
+    if (nextimpl_working_buffer_offset > working_buffer.size())
+        throw Exception(ErrorCodes::SEEK_POSITION_OUT_OF_BOUND, "Required to move position beyond the decompressed block (pos: "
+        "{}, block size: {})", nextimpl_working_buffer_offset, toString(working_buffer.size()));
+
+    return true;
+}
+
+
+void CompressedReadBufferFromFile::resetDecompressAheadQueue()
+{
+    /// Pending jobs hold raw pointers into the blocks' buffers, so wait them out before
+    /// discarding. Errors of blocks we are discarding anyway are dropped with them.
+    for (auto & block : decompress_ahead_queue)
+        if (block.done.valid())
+            block.done.wait();
+    decompress_ahead_queue.clear();
+}
+
+
+CompressedReadBufferFromFile::~CompressedReadBufferFromFile()
+{
+    resetDecompressAheadQueue();
+}
+
+
 CompressedReadBufferFromFile::CompressedReadBufferFromFile(
     std::unique_ptr<ReadBufferFromFileBase> buf,
     bool allow_different_codecs_,
@@ -124,13 +243,17 @@ void CompressedReadBufferFromFile::seek(size_t offset_in_compressed_file, size_t
 
     /// Our seek is within working_buffer, so just move the position
     if (size_compressed &&
-        offset_in_compressed_file == file_in.getPosition() - size_compressed &&
+        offset_in_compressed_file
+            == (decompress_ahead_blocks ? current_block_start : file_in.getPosition() - size_compressed) &&
         offset_in_decompressed_block <= working_buffer.size())
     {
         pos = working_buffer.begin() + offset_in_decompressed_block;
     }
     else /// Our seek outside working buffer, so perform "lazy seek"
     {
+        /// Blocks read ahead past the seek target are of no use anymore.
+        if (decompress_ahead_blocks)
+            resetDecompressAheadQueue();
         /// Actually seek compressed file
         file_in.seek(offset_in_compressed_file, SEEK_SET);
         /// We will discard our working_buffer, but have to account rest bytes
@@ -147,6 +270,11 @@ void CompressedReadBufferFromFile::seek(size_t offset_in_compressed_file, size_t
 
 size_t CompressedReadBufferFromFile::readBig(char * to, size_t n)
 {
+    /// The lookahead queue already owns decompressed buffers, so the decompress-directly-to-`to`
+    /// shortcut below cannot be used; drain blocks through the working buffer in order instead.
+    if (decompress_ahead_blocks)
+        return read(to, n);
+
     size_t bytes_read = 0;
 
     /// If there are unread bytes in the buffer, then we copy needed to `to`.
@@ -206,6 +334,17 @@ size_t CompressedReadBufferFromFile::readBig(char * to, size_t n)
 
 std::pair<size_t, size_t> CompressedReadBufferFromFile::position() const
 {
+    if (decompress_ahead_blocks)
+    {
+        /// file_in already points past the blocks read ahead, so derive the position from the
+        /// current block (or the first undelivered one).
+        if (size_compressed)
+            return {current_block_start, offset()};
+        if (!decompress_ahead_queue.empty())
+            return {decompress_ahead_queue.front().offset_in_compressed_file, 0};
+        return {static_cast<size_t>(file_in.getPosition()), 0};
+    }
+
     return {file_in.getPosition() - size_compressed, size_compressed == 0 ? 0 : offset()};
 }
 
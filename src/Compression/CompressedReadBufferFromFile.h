@@ -24,6 +24,8 @@
 #include "CompressedReadBufferBase.h"
 #include <IO/ReadBufferFromFileBase.h>
 #include <time.h>
+#include <deque>
+#include <future>
 #include <memory>
 
 
@@ -64,8 +66,32 @@ private:
     ///
     /* size_t nextimpl_working_buffer_offset; */
 
+    /// A compressed block read ahead of the consumer and decompressed on the thread pool.
+    /// The job holds raw pointers into `compressed` and `decompressed`, so the block must not
+    /// be destroyed before `done` is ready.
+    struct DecompressAheadBlock
+    {
+        Memory<> compressed;    /// owned copy, checksum is verified before the copy is made
+        Memory<> decompressed;
+        size_t size_decompressed = 0;
+        size_t size_compressed = 0;    /// including checksum, as returned by readCompressedData
+        size_t offset_in_compressed_file = 0;
+        std::future<void> done;
+    };
+
+    /// Non-zero when decompress-ahead is enabled; blocks are delivered strictly in file order.
+    size_t decompress_ahead_blocks = 0;
+    std::deque<DecompressAheadBlock> decompress_ahead_queue;
+    /// Start offset of the block in working_buffer. Only maintained in decompress-ahead mode,
+    /// where file_in already points past the blocks queued behind the current one.
+    size_t current_block_start = 0;
+
     bool nextImpl() override;
 
+    bool nextDecompressAhead();
+    void fillDecompressAheadQueue();
+    void resetDecompressAheadQueue();
+
     void prefetch(Priority priority) override;
 
 public:
@@ -88,6 +114,16 @@ public:
         size_t file_size_ = 0,
         bool is_limit_ = false);
 
+    ~CompressedReadBufferFromFile() override;
+
+    /// Overlap decompression with the rest of the read path: up to `lookahead_blocks` compressed
+    /// blocks are read ahead on the calling thread (so IO and checksumming stay where they were)
+    /// and decompressed on the global thread pool, and nextImpl() hands the finished buffers out
+    /// in file order. readBig() falls back to draining blocks through the working buffer, losing
+    /// its decompress-directly-to-destination shortcut, so enable this only for streams consumed
+    /// via next().
+    void enableDecompressAhead(size_t lookahead_blocks) { decompress_ahead_blocks = lookahead_blocks; }
+
     /// Seek is lazy in some sense. We move position in compressed file_in to offset_in_compressed_file, but don't
     /// read data into working_buffer and don't shift our position to offset_in_decompressed_block. Instead
     /// we store this offset inside nextimpl_working_buffer_offset.
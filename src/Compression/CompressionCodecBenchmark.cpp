@@ -0,0 +1,132 @@
+#include <Compression/CompressionCodecBenchmark.h>
+
+#include <Compression/CompressionFactory.h>
+#include <Compression/ICompressionCodec.h>
+#include <Core/Defines.h>
+#include <Parsers/ExpressionElementParsers.h>
+#include <Parsers/parseQuery.h>
+#include <Common/PODArray.h>
+#include <Common/Stopwatch.h>
+
+#include <cstring>
+
+namespace DB
+{
+
+namespace
+{
+    /// Codec blocks are bounded by UInt32 sizes and production data is compressed in
+    /// bounded blocks anyway, so benchmark in chunks of a typical large compress block.
+    constexpr size_t benchmark_block_size = 1 << 20;
+
+    const std::vector<const char *> & candidateDeclarations()
+    {
+        static const std::vector<const char *> candidates = {
+            "CODEC(LZ4)",
+            "CODEC(LZ4HC(9))",
+            "CODEC(ZSTD(1))",
+            "CODEC(ZSTD(3))",
+            "CODEC(ZSTD(9))",
+            "CODEC(Delta, LZ4)",
+            "CODEC(DoubleDelta, LZ4)",
+            "CODEC(Gorilla, LZ4)",
+            "CODEC(T64, LZ4)",
+        };
+        return candidates;
+    }
+
+    double toMBps(size_t bytes, UInt64 elapsed_ns)
+    {
+        if (!elapsed_ns)
+            return 0.0;
+        return static_cast<double>(bytes) / (1 << 20) / (static_cast<double>(elapsed_ns) / 1e9);
+    }
+}
+
+CodecBenchmarkResults benchmarkCompressionCodecs(const String & data, const DataTypePtr & column_type)
+{
+    CodecBenchmarkResults results;
+    if (data.empty())
+        return results;
+
+    auto & factory = CompressionCodecFactory::instance();
+
+    for (const char * declaration : candidateDeclarations())
+    {
+        CompressionCodecPtr codec;
+        try
+        {
+            ParserCodec codec_parser;
+            auto codec_ast
+                = parseQuery(codec_parser, declaration, declaration + strlen(declaration), "codec declaration", 0, DBMS_DEFAULT_MAX_PARSER_DEPTH);
+            codec = factory.get(codec_ast, column_type);
+        }
+        catch (const Exception &)
+        {
+            /// the candidate does not apply to this column type (e.g. Gorilla on strings)
+            continue;
+        }
+
+        std::vector<String> compressed_blocks;
+        compressed_blocks.reserve(data.size() / benchmark_block_size + 1);
+        size_t total_compressed = 0;
+
+        Stopwatch compress_watch;
+        for (size_t offset = 0; offset < data.size(); offset += benchmark_block_size)
+        {
+            UInt32 block_size = static_cast<UInt32>(std::min(benchmark_block_size, data.size() - offset));
+            String compressed;
+            compressed.resize(codec->getCompressedReserveSize(block_size));
+            UInt32 compressed_size = codec->compress(data.data() + offset, block_size, compressed.data());
+            compressed.resize(compressed_size);
+            total_compressed += compressed_size;
+            compressed_blocks.push_back(std::move(compressed));
+        }
+        UInt64 compress_ns = compress_watch.elapsed();
+
+        PODArray<char> decompressed;
+        Stopwatch decompress_watch;
+        for (const auto & block : compressed_blocks)
+        {
+            UInt32 decompressed_size = ICompressionCodec::readDecompressedBlockSize(block.data());
+            decompressed.resize(decompressed_size);
+            codec->decompress(block.data(), static_cast<UInt32>(block.size()), decompressed.data());
+        }
+        UInt64 decompress_ns = decompress_watch.elapsed();
+
+        results.push_back(
+            {declaration,
+             static_cast<double>(data.size()) / std::max<size_t>(total_compressed, 1),
+             toMBps(data.size(), compress_ns),
+             toMBps(data.size(), decompress_ns)});
+    }
+
+    return results;
+}
+
+const CodecBenchmarkResult * chooseRecommendedCodec(const CodecBenchmarkResults & results)
+{
+    if (results.empty())
+        return nullptr;
+
+    double fastest_decode = 0;
+    for (const auto & result : results)
+        fastest_decode = std::max(fastest_decode, result.decompress_mbps);
+
+    const CodecBenchmarkResult * best = nullptr;
+    for (const auto & result : results)
+    {
+        if (result.decompress_mbps < fastest_decode / 3)
+            continue;
+        if (!best || result.compression_ratio > best->compression_ratio)
+            best = &result;
+    }
+    /// all candidates were filtered out only if fastest_decode is 0, fall back to ratio
+    if (!best)
+        for (const auto & result : results)
+            if (!best || result.compression_ratio > best->compression_ratio)
+                best = &result;
+    return best;
+}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <DataTypes/IDataType.h>
+#include <common/types.h>
+
+#include <vector>
+
+namespace DB
+{
+
+struct CodecBenchmarkResult
+{
+    String codec; /// declaration as it would appear in DDL, e.g. "CODEC(Delta, LZ4)"
+    double compression_ratio; /// uncompressed size / compressed size
+    double compress_mbps;
+    double decompress_mbps;
+};
+
+using CodecBenchmarkResults = std::vector<CodecBenchmarkResult>;
+
+/// Runs the standard codec candidates - LZ4, ZSTD at several levels, and the
+/// type-specialized Delta / DoubleDelta / Gorilla / T64 chained with LZ4 - over `data`,
+/// the serialized values of one column sampled from real parts. Candidates that do not
+/// apply to `column_type` are skipped.
+CodecBenchmarkResults benchmarkCompressionCodecs(const String & data, const DataTypePtr & column_type);
+
+/// The candidate worth recommending: best compression ratio among those that decode at no
+/// less than a third of the fastest candidate, so storage wins never come at an unbounded
+/// read-bandwidth cost. Returns nullptr when `results` is empty.
+const CodecBenchmarkResult * chooseRecommendedCodec(const CodecBenchmarkResults & results);
+
+}
@@ -0,0 +1,163 @@
+#include <Compression/ICompressionCodec.h>
+#include <Compression/CompressionInfo.h>
+#include <Compression/CompressionFactory.h>
+#include <Compression/CompressionDictionaryStore.h>
+#include <zstd.h>
+#include <Parsers/IAST.h>
+#include <Parsers/ASTLiteral.h>
+#include <Common/typeid_cast.h>
+#include <common/unaligned.h>
+#include <IO/WriteHelpers.h>
+
+
+namespace DB
+{
+
+/** ZSTD with a pre-trained shared dictionary, for columns whose individual blocks are too
+  * small for the codec to build good entropy tables on its own (typical for short
+  * event-attribute strings with a large shared vocabulary). Each frame stores the id of its
+  * dictionary in front of the zstd data, so blocks stay self-describing and different parts
+  * of one column may reference different dictionary versions.
+  */
+class CompressionCodecZSTDDict : public ICompressionCodec
+{
+public:
+    static constexpr auto ZSTD_DEFAULT_LEVEL = 1;
+    /// An UInt64 dictionary id precedes the zstd frame.
+    static constexpr UInt32 DICT_ID_SIZE = 8;
+
+    CompressionCodecZSTDDict(UInt64 dictionary_id_, int level_);
+
+    uint8_t getMethodByte() const override;
+
+    UInt32 getMaxCompressedDataSize(UInt32 uncompressed_size) const override;
+
+    void updateHash(SipHash & hash) const override;
+
+protected:
+
+    UInt32 doCompressData(const char * source, UInt32 source_size, char * dest) const override;
+
+    void doDecompressData(const char * source, UInt32 source_size, char * dest, UInt32 uncompressed_size) const override;
+
+    bool isCompression() const override { return true; }
+    bool isGenericCompression() const override { return true; }
+
+private:
+    /// Zero when the codec is instantiated from the method byte alone to decode blocks;
+    /// such an instance cannot compress.
+    const UInt64 dictionary_id;
+    const int level;
+};
+
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_COMPRESS;
+    extern const int CANNOT_DECOMPRESS;
+    extern const int ILLEGAL_SYNTAX_FOR_CODEC_TYPE;
+    extern const int ILLEGAL_CODEC_PARAMETER;
+}
+
+uint8_t CompressionCodecZSTDDict::getMethodByte() const
+{
+    return static_cast<uint8_t>(CompressionMethodByte::ZSTDDict);
+}
+
+void CompressionCodecZSTDDict::updateHash(SipHash & hash) const
+{
+    getCodecDesc()->updateTreeHash(hash);
+}
+
+UInt32 CompressionCodecZSTDDict::getMaxCompressedDataSize(UInt32 uncompressed_size) const
+{
+    return DICT_ID_SIZE + ZSTD_compressBound(uncompressed_size);
+}
+
+UInt32 CompressionCodecZSTDDict::doCompressData(const char * source, UInt32 source_size, char * dest) const
+{
+    if (!dictionary_id)
+        throw Exception("ZSTD_DICT codec cannot compress without a dictionary id", ErrorCodes::CANNOT_COMPRESS);
+
+    auto cdict = CompressionDictionaryStore::instance().getCDict(dictionary_id, level);
+
+    ZSTD_CCtx * cctx = ZSTD_createCCtx();
+    size_t compressed_size
+        = ZSTD_compress_usingCDict(cctx, dest + DICT_ID_SIZE, ZSTD_compressBound(source_size), source, source_size, cdict.get());
+    ZSTD_freeCCtx(cctx);
+
+    if (ZSTD_isError(compressed_size))
+        throw Exception(
+            "Cannot compress block with ZSTD_DICT: " + std::string(ZSTD_getErrorName(compressed_size)), ErrorCodes::CANNOT_COMPRESS);
+
+    unalignedStore<UInt64>(dest, dictionary_id);
+    return DICT_ID_SIZE + compressed_size;
+}
+
+void CompressionCodecZSTDDict::doDecompressData(const char * source, UInt32 source_size, char * dest, UInt32 uncompressed_size) const
+{
+    if (source_size < DICT_ID_SIZE)
+        throw Exception("Cannot decompress ZSTD_DICT block: data is too short", ErrorCodes::CANNOT_DECOMPRESS);
+
+    UInt64 frame_dictionary_id = unalignedLoad<UInt64>(source);
+    auto ddict = CompressionDictionaryStore::instance().getDDict(frame_dictionary_id);
+
+    ZSTD_DCtx * dctx = ZSTD_createDCtx();
+    size_t res = ZSTD_decompress_usingDDict(dctx, dest, uncompressed_size, source + DICT_ID_SIZE, source_size - DICT_ID_SIZE, ddict.get());
+    ZSTD_freeDCtx(dctx);
+
+    if (ZSTD_isError(res))
+        throw Exception("Cannot decompress ZSTD_DICT block: " + std::string(ZSTD_getErrorName(res)), ErrorCodes::CANNOT_DECOMPRESS);
+}
+
+CompressionCodecZSTDDict::CompressionCodecZSTDDict(UInt64 dictionary_id_, int level_) : dictionary_id(dictionary_id_), level(level_)
+{
+    if (dictionary_id)
+        setCodecDescription(
+            "ZSTD_DICT", {std::make_shared<ASTLiteral>(dictionary_id), std::make_shared<ASTLiteral>(static_cast<UInt64>(level))});
+    else
+        setCodecDescription("ZSTD_DICT");
+}
+
+void registerCodecZSTDDict(CompressionCodecFactory & factory)
+{
+    UInt8 method_code = UInt8(CompressionMethodByte::ZSTDDict);
+    factory.registerCompressionCodec("ZSTD_DICT", method_code, [&](const ASTPtr & arguments) -> CompressionCodecPtr {
+        /// Without arguments (instantiation from the method byte while reading) the codec can
+        /// only decode; the frames themselves carry the dictionary id then.
+        UInt64 dictionary_id = 0;
+        int level = CompressionCodecZSTDDict::ZSTD_DEFAULT_LEVEL;
+        if (arguments && !arguments->children.empty())
+        {
+            if (arguments->children.size() > 2)
+                throw Exception(
+                    "ZSTD_DICT codec must have 1 or 2 parameters, given " + std::to_string(arguments->children.size()),
+                    ErrorCodes::ILLEGAL_SYNTAX_FOR_CODEC_TYPE);
+
+            const auto children = arguments->children;
+            const auto * literal = children[0]->as<ASTLiteral>();
+            if (!literal)
+                throw Exception("ZSTD_DICT codec first argument must be a dictionary id", ErrorCodes::ILLEGAL_CODEC_PARAMETER);
+
+            dictionary_id = literal->value.safeGet<UInt64>();
+            if (dictionary_id == 0)
+                throw Exception("ZSTD_DICT dictionary id must be positive", ErrorCodes::ILLEGAL_CODEC_PARAMETER);
+
+            if (children.size() > 1)
+            {
+                const auto * level_literal = children[1]->as<ASTLiteral>();
+                if (!level_literal)
+                    throw Exception("ZSTD_DICT codec second argument must be integer", ErrorCodes::ILLEGAL_CODEC_PARAMETER);
+
+                level = level_literal->value.safeGet<UInt64>();
+                if (level > ZSTD_maxCLevel())
+                    throw Exception(
+                        "ZSTD_DICT codec can't have level more than " + toString(ZSTD_maxCLevel()) + ", given " + toString(level),
+                        ErrorCodes::ILLEGAL_CODEC_PARAMETER);
+            }
+        }
+        return std::make_shared<CompressionCodecZSTDDict>(dictionary_id, level);
+    });
+}
+
+}
@@ -0,0 +1,133 @@
+#include <Compression/CompressionDictionaryStore.h>
+
+#include <filesystem>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <Common/Exception.h>
+#include <zstd.h>
+#include <zdict.h>
+
+namespace fs = std::filesystem;
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int BAD_ARGUMENTS;
+    extern const int CANNOT_COMPRESS;
+    extern const int CANNOT_DECOMPRESS;
+}
+
+CompressionDictionaryStore & CompressionDictionaryStore::instance()
+{
+    static CompressionDictionaryStore ret;
+    return ret;
+}
+
+void CompressionDictionaryStore::setLookupPath(const String & path)
+{
+    std::lock_guard lock(mutex);
+    lookup_path = path;
+}
+
+void CompressionDictionaryStore::registerDictionary(UInt64 id, String blob)
+{
+    if (blob.empty())
+        throw Exception("Compression dictionary " + toString(id) + " is empty", ErrorCodes::BAD_ARGUMENTS);
+
+    std::lock_guard lock(mutex);
+    entries[id] = Entry{std::move(blob), {}, nullptr};
+}
+
+bool CompressionDictionaryStore::has(UInt64 id)
+{
+    std::lock_guard lock(mutex);
+    if (entries.count(id))
+        return true;
+    return !lookup_path.empty() && fs::exists(fs::path(lookup_path) / (toString(id) + ".dict"));
+}
+
+CompressionDictionaryStore::Entry & CompressionDictionaryStore::getEntry(UInt64 id, std::lock_guard<std::mutex> &)
+{
+    auto it = entries.find(id);
+    if (it != entries.end())
+        return it->second;
+
+    if (!lookup_path.empty())
+    {
+        auto blob_path = fs::path(lookup_path) / (toString(id) + ".dict");
+        if (fs::exists(blob_path))
+        {
+            ReadBufferFromFile in(blob_path.string());
+            String blob;
+            readStringUntilEOF(blob, in);
+            if (!blob.empty())
+                return entries.emplace(id, Entry{std::move(blob), {}, nullptr}).first->second;
+        }
+    }
+
+    throw Exception(
+        "Unknown compression dictionary " + toString(id) + "; data written with CODEC(ZSTD_DICT) needs its dictionary blob"
+        " under <compression_dictionary_path> on every reading server",
+        ErrorCodes::CANNOT_DECOMPRESS);
+}
+
+CompressionDictionaryStore::CDictPtr CompressionDictionaryStore::getCDict(UInt64 id, int level)
+{
+    std::lock_guard lock(mutex);
+    auto & entry = getEntry(id, lock);
+
+    auto & cached = entry.cdicts_by_level[level];
+    if (!cached)
+    {
+        ZSTD_CDict * raw = ZSTD_createCDict(entry.blob.data(), entry.blob.size(), level);
+        if (!raw)
+            throw Exception("Cannot digest compression dictionary " + toString(id), ErrorCodes::CANNOT_COMPRESS);
+        cached = CDictPtr(raw, &ZSTD_freeCDict);
+    }
+    return cached;
+}
+
+CompressionDictionaryStore::DDictPtr CompressionDictionaryStore::getDDict(UInt64 id)
+{
+    std::lock_guard lock(mutex);
+    auto & entry = getEntry(id, lock);
+
+    if (!entry.ddict)
+    {
+        ZSTD_DDict * raw = ZSTD_createDDict(entry.blob.data(), entry.blob.size());
+        if (!raw)
+            throw Exception("Cannot digest compression dictionary " + toString(id), ErrorCodes::CANNOT_DECOMPRESS);
+        entry.ddict = DDictPtr(raw, &ZSTD_freeDDict);
+    }
+    return entry.ddict;
+}
+
+String CompressionDictionaryStore::train(const std::vector<String> & samples, size_t max_dictionary_size)
+{
+    if (samples.empty())
+        throw Exception("Cannot train a compression dictionary on an empty sample set", ErrorCodes::BAD_ARGUMENTS);
+
+    String samples_buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto & sample : samples)
+    {
+        samples_buffer += sample;
+        sample_sizes.push_back(sample.size());
+    }
+
+    String dictionary(max_dictionary_size, '\0');
+    size_t res = ZDICT_trainFromBuffer(
+        dictionary.data(), dictionary.size(), samples_buffer.data(), sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+
+    if (ZDICT_isError(res))
+        throw Exception("Cannot train compression dictionary: " + String(ZDICT_getErrorName(res)), ErrorCodes::CANNOT_COMPRESS);
+
+    dictionary.resize(res);
+    return dictionary;
+}
+
+}
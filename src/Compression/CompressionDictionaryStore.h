@@ -0,0 +1,64 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <Core/Types.h>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace DB
+{
+
+/** Process-wide registry of pre-trained zstd dictionaries used by the ZSTD_DICT codec.
+  *
+  * Every compressed frame carries the numeric id of its dictionary, so data stays readable
+  * as long as the same dictionary blob is available on the reading server. Blobs are looked
+  * up lazily as "<id>.dict" files in the directory configured with
+  * <compression_dictionary_path>, or registered programmatically. Digested ZSTD_CDict /
+  * ZSTD_DDict objects are cached per dictionary (and per compression level for the write
+  * side), since digesting a dictionary costs far more than compressing a single block.
+  */
+class CompressionDictionaryStore : private boost::noncopyable
+{
+public:
+    using CDictPtr = std::shared_ptr<ZSTD_CDict_s>;
+    using DDictPtr = std::shared_ptr<ZSTD_DDict_s>;
+
+    static CompressionDictionaryStore & instance();
+
+    /// Directory with "<id>.dict" blobs. Set once at server startup, before queries run.
+    void setLookupPath(const String & path);
+
+    /// Makes a dictionary blob (ZDICT or raw content format) available under the given id.
+    void registerDictionary(UInt64 id, String blob);
+
+    bool has(UInt64 id);
+
+    CDictPtr getCDict(UInt64 id, int level);
+    DDictPtr getDDict(UInt64 id);
+
+    /// Trains a dictionary of at most max_dictionary_size bytes from the given samples with
+    /// ZDICT. Typical inputs are raw values of one column collected while merging its parts.
+    static String train(const std::vector<String> & samples, size_t max_dictionary_size);
+
+private:
+    struct Entry
+    {
+        String blob;
+        std::map<int, CDictPtr> cdicts_by_level;
+        DDictPtr ddict;
+    };
+
+    Entry & getEntry(UInt64 id, std::lock_guard<std::mutex> &);
+
+    std::mutex mutex;
+    String lookup_path;
+    std::unordered_map<UInt64, Entry> entries;
+};
+
+}
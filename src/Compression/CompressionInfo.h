@@ -30,6 +30,8 @@ namespace DB
   *
   * 0x90 - ZSTD
   *
+  * 0x96 - ZSTD with a pre-trained shared dictionary; an UInt64 dictionary id precedes the zstd frame.
+  *
   * All sizes are little endian.
   */
 
@@ -43,6 +45,7 @@ enum class CompressionMethodByte : uint8_t
     T64      = 0x93,
     DoubleDelta  = 0x94,
     Gorilla      = 0x95,
+    ZSTDDict     = 0x96,
 };
 
 }
@@ -1,3 +1,4 @@
+#include <Compression/CompressionDictionaryStore.h>
 #include <Compression/CompressionFactory.h>
 
 #include <Common/PODArray.h>
@@ -1314,4 +1315,38 @@ INSTANTIATE_TEST_SUITE_P(Gorilla,
 //    ),
 //);
 
+TEST(CodecZSTDDict, TrainCompressDecompressRoundtrip)
+{
+    /// Short repetitive samples, as produced by event-attribute columns: each block is too
+    /// small to compress well on its own, but the vocabulary is shared across all of them.
+    std::vector<String> samples;
+    for (size_t i = 0; i < 4000; ++i)
+        samples.push_back("status=ok&region=eu-west-" + std::to_string(i % 8) + "&retries=" + std::to_string(i % 3));
+
+    auto & store = CompressionDictionaryStore::instance();
+    store.registerDictionary(42, CompressionDictionaryStore::train(samples, 4 * 1024));
+    ASSERT_TRUE(store.has(42));
+
+    const auto codec = makeCodec("ZSTD_DICT(42)", nullptr);
+
+    const String source = samples[17] + samples[33] + samples[111];
+    PODArray<char> encoded(codec->getCompressedReserveSize(source.size()));
+    const UInt32 encoded_size = codec->compress(source.data(), source.size(), encoded.data());
+
+    PODArray<char> decoded(source.size());
+    const UInt32 decoded_size = codec->decompress(encoded.data(), encoded_size, decoded.data());
+
+    ASSERT_EQ(source.size(), decoded_size);
+    ASSERT_EQ(source, String(decoded.data(), decoded_size));
+}
+
+TEST(CodecZSTDDict, UnknownDictionaryThrows)
+{
+    const auto codec = makeCodec("ZSTD_DICT(424242)", nullptr);
+
+    const String source = "some data";
+    PODArray<char> encoded(codec->getCompressedReserveSize(source.size()));
+    EXPECT_THROW(codec->compress(source.data(), source.size(), encoded.data()), Exception);
+}
+
 }
@@ -34,6 +34,9 @@
 #include <Protos/plan_node_utils.pb.h>
 #include <sparsehash/dense_hash_map>
 
+#include <mutex>
+#include <unordered_map>
+
 
 namespace DB
 {
@@ -273,6 +276,38 @@ NamesAndTypesList NamesAndTypesList::parse(const String & s)
     return res;
 }
 
+NamesAndTypesListPtr internNamesAndTypesList(const NamesAndTypesList & list)
+{
+    static std::mutex registry_mutex;
+    static std::unordered_map<String, std::weak_ptr<NamesAndTypesList>> registry;
+    static size_t inserts_since_cleanup = 0;
+
+    String key = list.toString();
+
+    std::lock_guard lock(registry_mutex);
+    auto & entry = registry[key];
+    if (auto res = entry.lock())
+        return res;
+
+    /// Sweep dead entries occasionally so the registry does not accumulate
+    /// keys of schemas whose last owner is long gone.
+    if (++inserts_since_cleanup >= 1024)
+    {
+        inserts_since_cleanup = 0;
+        for (auto it = registry.begin(); it != registry.end();)
+        {
+            if (it->second.expired())
+                it = registry.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    auto res = std::make_shared<NamesAndTypesList>(list);
+    registry[key] = res;
+    return res;
+}
+
 bool NamesAndTypesList::isSubsetOf(const NamesAndTypesList & rhs) const
 {
     NamesAndTypes vector(rhs.begin(), rhs.end());
@@ -153,6 +153,13 @@ public:
 
 using NamesAndTypesListPtr = std::shared_ptr<NamesAndTypesList>;
 using NamesAndTypesLists = std::vector<NamesAndTypesList>;
+
+/// Deduplicate immutable column lists through a process-wide registry keyed by the
+/// serialized list. Thousands of tables (and their parts) with an identical schema
+/// then share a single in-memory copy instead of holding one each. The returned list
+/// must never be modified in place - replace the pointer instead, as setColumnsPtr
+/// and ALTER already do. Entries are held weakly, so dropping the last owner frees them.
+NamesAndTypesListPtr internNamesAndTypesList(const NamesAndTypesList & list);
 }
 
 namespace std
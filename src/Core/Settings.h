@@ -236,6 +236,29 @@ enum PreloadLevelSettings : UInt64
       "The maximum speed of data exchange over the network in bytes per second for replicated sends. Zero means unlimited. Only has " \
       "meaning at server startup.", \
       0) \
+    M(UInt64, \
+      max_remote_read_network_bandwidth_for_server, \
+      0, \
+      "The maximum speed of reading from remote storage in bytes per second shared by all reads on this node. Zero means unlimited.", \
+      0) \
+    M(UInt64, \
+      max_remote_read_network_bandwidth_for_merges, \
+      0, \
+      "The maximum speed of reading from remote storage in bytes per second for background merges and mutations; also counted against " \
+      "max_remote_read_network_bandwidth_for_server when both are set. Zero means unlimited.", \
+      0) \
+    M(UInt64, \
+      max_remote_request_rate_for_server, \
+      0, \
+      "The maximum number of remote storage read requests per second shared by all queries on this node. Configure it per virtual " \
+      "warehouse profile to cap the request rate a worker group may put on a shared bucket. Zero means unlimited.", \
+      0) \
+    M(UInt64, \
+      max_remote_request_rate_for_query, \
+      0, \
+      "The maximum number of remote storage read requests per second a single query may issue against one table; also counted " \
+      "against the table and server level limits when they are set. Zero means unlimited.", \
+      0) \
 \
     M(Milliseconds, \
       distributed_directory_monitor_sleep_time_ms, \
@@ -340,10 +363,15 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, merge_tree_min_rows_for_seek, 0, "You can skip reading more than that number of rows at the price of one seek per file.", 0) \
     M(UInt64, merge_tree_min_bytes_for_seek, 0, "You can skip reading more than that number of bytes at the price of one seek per file.", 0) \
     M(UInt64, remote_read_min_bytes_for_seek, 3 * DBMS_DEFAULT_BUFFER_SIZE, "Min bytes required for remote read (url, s3) to do seek, instead of read with ignore.", 0) \
+    M(Float, remote_read_min_density_for_sequential_read, 0.6, "If the mark ranges requested from one stream cover at least this fraction of its marks, read the stream in a single sequential window and skip the gaps client-side instead of issuing a remote request per range. 0 disables it.", 0) \
     M(UInt64, merge_tree_coarse_index_granularity, 8, "If the index segment can contain the required keys, divide it into as many parts and recursively check them.", 0) \
     M(UInt64, merge_tree_max_rows_to_use_cache, (128 * 8192), "The maximum number of rows per request, to use the cache of uncompressed data. If the request is large, the cache is not used. (For large queries not to flush out the cache.)", 0) \
     M(UInt64, merge_tree_max_bytes_to_use_cache, (192 * 10 * 1024 * 1024), "The maximum number of bytes per request, to use the cache of uncompressed data. If the request is large, the cache is not used. (For large queries not to flush out the cache.)", 0) \
+    M(Bool, enable_cooperative_scans, false, "Let concurrent queries scanning overlapping ranges of the same parts share one physical read and decompression per granule through the uncompressed cache, even for scans large enough to normally bypass it", 0) \
     M(UInt64, merge_tree_calculate_columns_size_sample, 1000, "The number of the sample parts to calculate columns size.", 0) \
+    M(UInt64, merge_tree_parts_ranges_selection_threads, 0, "The maximum number of threads used to select mark ranges among data parts during query planning. 0 means use the number of read streams. Helps when a query touches hundreds of thousands of parts.", 0) \
+    M(UInt64, merge_tree_min_parts_per_ranges_selection_task, 64, "Group at least that many parts into one range-selection task to avoid scheduling overhead on huge part lists.", 0) \
+    M(Float, merge_tree_prewhere_filter_selectivity_threshold, 0.6, "If the combined PREWHERE filter keeps less than this fraction of rows, columns are filtered inside PREWHERE instead of deferring filtering to WHERE, so subsequent granule reads skip the dropped rows.", 0) \
     M(Bool, do_not_merge_across_partitions_select_final, false, "Merge parts only in one partition in select final", 0) \
     \
     M(UInt64, mysql_max_rows_to_insert, 65536, "The maximum number of rows in MySQL batch insertion of the MySQL storage engine", 0) \
@@ -355,6 +383,9 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, min_bytes_to_use_direct_io, 0, "The minimum number of bytes for reading the data with O_DIRECT option during SELECT queries execution. 0 - disabled.", 0) \
     M(UInt64, min_bytes_to_use_mmap_io, 0, "The minimum number of bytes for reading the data with mmap option during SELECT queries execution. 0 - disabled.", 0) \
     M(Bool, checksum_on_read, true, "Validate checksums on reading. It is enabled by default and should be always enabled in production. Please do not expect any benefits in disabling this setting. It may only be used for experiments and benchmarks. The setting only applicable for tables of MergeTree family. Checksums are always validated for other table engines and when receiving data over network.", 0) \
+    M(Bool, async_checksum_validation, false, "Validate checksums of locally cached segments on a background thread instead of the scan hot loop. Corrupted segments are dropped from the disk cache and re-fetched from remote storage. Only takes effect together with checksum_on_read.", 0) \
+    M(UInt64, merge_tree_decompress_ahead_blocks, 0, "Number of compressed blocks each MergeTree read stream reads ahead and decompresses on the thread pool, overlapping decompression with IO. Helps scans of heavily compressed data; 0 - disabled.", 0) \
+    M(UInt64, merge_tree_read_columns_max_parallelism, 1, "Decode independent columns of a MergeTree read concurrently on up to this many threads. Only pays off for scans reading dozens of columns; 1 - disabled.", 0) \
     \
     M(Bool, force_index_by_date, 0, "Throw an exception if there is a partition key in a table, and it is not used.", 0) \
     M(Bool, force_primary_key, 0, "Throw an exception if there is primary key in a table, and it is not used.", 0) \
@@ -399,6 +430,7 @@ enum PreloadLevelSettings : UInt64
     M(Bool, log_processors_profiles, false, "Log Processors profile events.", 0) \
     M(Bool, log_segment_profiles, false, "Log profile of each segment info including runtime and planning information.", 0) \
     M(Bool, report_processors_profiles, false, "Report processors profile to coordinator.", 0) \
+    M(Bool, enable_elastic_pipeline_parallelism, false, "Let pipeline execution lanes above the query's fair share of cores park while other queries run and resume as the host drains. Effective parallelism stays capped by max_threads.", 0) \
     M(UInt64, report_processors_profiles_timeout_millseconds, 10, "Report processors profile to coordinator timeout millseconds.", 0) \
     M(DistributedProductMode, \
       distributed_product_mode, \
@@ -754,6 +786,8 @@ enum PreloadLevelSettings : UInt64
       "to MergeJoin on the fly to avoid out of memory.", \
       0) \
     M(Bool, join_parallel_left_right, true, "Enable joinTransform parallel for left input and right input", 0) \
+    M(Bool, enable_hash_join_cache, false, "Reuse hash tables of eligible broadcast joins across queries on workers instead of rebuilding them per query. Cached entries may serve data up to hash_join_cache_ttl_seconds stale. Only takes effect with the optimizer enabled", 0) \
+    M(UInt64, hash_join_cache_ttl_seconds, 60, "How long a cached broadcast join hash table stays valid; bounds the staleness of the joined dimension data", 0) \
     M(Bool, partial_merge_join_optimizations, true, "Enable optimizations in partial merge join", 0) \
     M(UInt64, \
       default_max_bytes_in_join, \
@@ -896,6 +930,8 @@ enum PreloadLevelSettings : UInt64
       0) \
     M(Bool, optimize_read_in_order, true, "Enable ORDER BY optimization for reading data in corresponding order in MergeTree tables.", 0) \
     M(Bool, optimize_aggregation_in_order, false, "Enable GROUP BY optimization for aggregating data in corresponding order in MergeTree tables.", 0) \
+    M(Bool, adaptive_aggregation_in_order, false, "For partial aggregation, detect at runtime whether the input arrives ordered by the grouping keys and switch from hash to streaming in-order aggregation.", 0) \
+    M(UInt64, adaptive_aggregation_in_order_sample_chunks, 8, "How many leading chunks must arrive ordered by the grouping keys before adaptive aggregation switches to the in-order algorithm.", 0) \
     M(UInt64, read_in_order_two_level_merge_threshold, 100, "Minimal number of parts to read to run preliminary merge step during multithread reading in order of primary key.", 0) \
     M(Bool, low_cardinality_allow_in_native_format, true, "Use LowCardinality type in Native format. Otherwise, convert LowCardinality columns to ordinary for select query, and convert ordinary columns to required LowCardinality for insert query.", 0) \
     M(Bool, cancel_http_readonly_queries_on_client_close, false, "Cancel HTTP readonly queries when a client closes the connection without waiting for response.", 0) \
@@ -962,9 +998,12 @@ enum PreloadLevelSettings : UInt64
       "For tables in databases with Engine=Atomic show UUID of the table in its CREATE query.", \
       0) \
     M(UInt64, max_threads_for_cnch_dump, 1, "The maximum number of threads for dumping data in cnch.", 0) \
+    M(UInt64, cnch_part_min_rows_to_dump, 0, "Buffer INSERT blocks inside the cloud MergeTree output stream until at least this many rows are accumulated before building and dumping a part, so INSERT SELECT copies write fewer, larger parts to remote storage. Has no effect on tables with a unique key. 0 - build parts from blocks as they arrive.", 0) \
+    M(UInt64, cnch_part_min_bytes_to_dump, 0, "Like cnch_part_min_rows_to_dump, but the threshold is in bytes. The conditions are OR-ed.", 0) \
     M(Bool, database_atomic_wait_for_drop_and_detach_synchronously, false, "When executing DROP or DETACH TABLE in Atomic database, wait for table data to be finally dropped or detached.", 0) \
     M(Bool, enable_scalar_subquery_optimization, true, "If it is set to true, prevent scalar subqueries from (de)serializing large scalar values and possibly avoid running the same subquery more than once.", 0) \
     M(Bool, optimize_trivial_count_query, true, "Process trivial 'SELECT count() FROM table' query from metadata.", 0) \
+    M(Bool, optimize_trivial_minmax_query, true, "Process trivial 'SELECT min/max(partition column) FROM table' query from part minmax metadata.", 0) \
     M(Bool, optimize_respect_aliases, true, "If it is set to true, it will respect aliases in WHERE/GROUP BY/ORDER BY, that will help with partition pruning/secondary indexes/optimize_aggregation_in_order/optimize_read_in_order/optimize_trivial_count", 0) \
     M(UInt64, mutations_sync, 0, "Wait for synchronous execution of ALTER TABLE UPDATE/DELETE queries (mutations). 0 - execute asynchronously. 1 - wait current server. 2 - wait all replicas if they exist.", 0) \
     M(UInt64, mutations_wait_timeout, 0, "Maximum seconds to wait for synchronous mutations. 0 - wait unlimited time", 0) \
@@ -1095,6 +1134,11 @@ enum PreloadLevelSettings : UInt64
       10'000'000, \
       "For how many elements it is allowed to preallocate space in all hash tables in total before aggregation", \
       0) \
+    M(Bool, \
+      use_cardinality_estimate_for_aggregation, \
+      false, \
+      "Pre-size aggregation hash tables from the optimizer cardinality estimate and start two-level aggregation right away when the estimated number of groups exceeds group_by_two_level_threshold, avoiding mid-query rehashes. Only takes effect with the optimizer enabled", \
+      0) \
 \
     M(Bool, handle_division_by_zero, false, "If set true, return null for division by zero (MySQL Behavior)", 0) \
     \
@@ -1151,6 +1195,7 @@ enum PreloadLevelSettings : UInt64
       "Limit the total number of optimizations applied to query plan. If zero, ignored. If limit reached, throw exception", \
       0) \
     M(Bool, query_plan_filter_push_down, true, "Allow to push down filter by predicate query plan step", 0) \
+    M(Bool, query_plan_merge_filters, true, "Allow to merge two adjacent filter query plan steps into one, applying both conditions in a single pass over the block", 0) \
     M(Bool, enable_partition_filter_push_down, false, "Allow to push down partition filter to query info", 0) \
     M(Bool, external_enable_partition_filter_push_down, true, "Allow to push down partition filter to query info for external table. Consider to merge into enable_partition_filter_push_down when mergetree bug is fixed", 0) \
     M(Bool, remove_partition_filter_on_worker, true, "Remove partition filter before worker execution, since partition pruning has been done on the server. This temp fix is used for not selecting partition key as prewhere", 0) \
@@ -1231,6 +1276,7 @@ enum PreloadLevelSettings : UInt64
     M(Bool, enable_transactional_query_cache, true, "Enable transactional query cache for CNCH engine table", IMPORTANT) \
     M(Bool, enable_writes_to_query_cache, true, "Enable storing results of SELECT queries in the query cache", 0) \
     M(Bool, enable_reads_from_query_cache, true, "Enable reading results of SELECT queries from the query cache", 0) \
+    M(Bool, enable_plan_segment_result_cache, false, "Serve repeated identical plan segments from the worker-side segment result cache when the scanned tables are unchanged", 0) \
     M(Bool, \
       query_cache_store_results_of_queries_with_nondeterministic_functions, \
       false, \
@@ -1275,6 +1321,8 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, catalog_max_commit_size, 500, "Max record number to be committed in one batch.", 0) \
     M(Bool, catalog_enable_multiple_threads, false, "Whether leverage multiple threads to handle metadata.", 0) \
     M(UInt64, catalog_multiple_threads_min_parts, 10000, "Minimum parts number to enable multi-thread in calc visible parts.", 0) \
+    M(Bool, enable_part_cache_minmax_pruning, false, "Prune parts by the minmax index while scanning the server part cache, before materializing server parts.", 0) \
+    M(Bool, enable_visible_parts_cache, false, "Reuse the whole-table visible part set across queries reading the same snapshot, skipping repeated visibility calculation on server.", 0) \
     M(Bool, server_write_ha, false, "Whether to enable write on non-host server if host server is not available. Directly commit from non-host server.", 0) \
     M(Bool, enable_write_non_host_server, true, "Whether to eable write on non-host server. Will root write request to host server.", 0) \
     M(Bool, force_execute_alter, false, "Force the Alter Query to be executed ignore the host server.", 0) \
@@ -1301,6 +1349,18 @@ enum PreloadLevelSettings : UInt64
       "Part allocation algorithm, 0: jump consistent hashing, 1: bounded hash ring consistent hashing, 2: strict ring consistent " \
       "hashing.", \
       0) \
+    M(Bool, \
+      enable_cache_resident_part_assignment, \
+      false, \
+      "Bias part allocation toward the worker each part was most recently assigned to, so its disk cache is reused after worker group " \
+      "topology changes and query retries. Imbalance stays bounded: parts above the per-worker cap fall back to the hash policy.", \
+      0) \
+    M(UInt64, \
+      cache_resident_part_assignment_ttl_seconds, \
+      1800, \
+      "How long a remembered part-to-worker assignment counts as evidence of disk cache residency. Expired parts are assigned by the " \
+      "hash policy again.", \
+      0) \
     M(UInt64, cnch_max_cached_storage, 2048, "Cnch storage cache size.", 0) \
     M(Bool, enable_multiple_tables_for_cnch_parts, 0, "Allow to query multiple tables for system.cnch_parts", 0) \
     M(Bool, enable_skip_non_cnch_tables_for_cnch_parts, true, "Allow to skip non cnch tables for system.cnch_parts", 0) \
@@ -1313,7 +1373,10 @@ enum PreloadLevelSettings : UInt64
     M(Bool, enable_local_disk_cache, 1, "enable global local disk cache", 0) \
     M(UInt64, parts_preload_level, 1, "used for global preload(manual alter&table auto), 0=close preload;1=preload meta;2=preload data;3=preload meta&data, Note: for table auto preload, 0 will disable all table preload, > 0 will use table preload setting", 0) \
     M(UInt64, parts_preload_throttler, 0, "used for max preload rpc concurrent count", 0) \
+    M(Bool, enable_parts_warmup_on_send_resources, false, "Fire an async preload hint to each worker for the parts assigned to it right after resource allocation, so the disk cache fill overlaps with plan segment scheduling. Only effective for tables whose preload settings are enabled", 0) \
     M(DiskCacheMode, disk_cache_mode, DiskCacheMode::AUTO, "Whether to use local disk cache", 0) \
+    M(UInt64, disk_cache_readahead_segments, 0, "When a sequential scan misses the disk cache, fetch up to this many following segments of the stream with one remote read and cache them in one shot, 0 disables readahead", 0) \
+    M(Bool, enable_primary_index_cache_mmap_read, false, "Read locally cached primary index files through mmap, so index loads after a restart are served by the OS page cache and concurrent loaders share one mapping", 0) \
     M(Bool, enable_vw_customized_setting, false, "Allow vw customized overwrite profile settings", 0) \
     M(Bool, enable_async_execution, false, "Whether to enable async execution", 0) \
     M(Bool, drop_vw_disk_cache, false, "if drop the all disk cache of vw even pass one table.", 0) \
@@ -1324,12 +1387,14 @@ enum PreloadLevelSettings : UInt64
     M(Seconds, cnch_txn_lock_expire_duration_seconds, 30, "Transaction lock expire duration.", 0) \
     M(Seconds, cnch_lock_manager_txn_checker_schedule_seconds, 30, "LockManager txn checker schedule seconds.", 0) \
     M(UInt64, parts_preallocate_pool_size, 16, "Number of threads for part preallocate", 0) \
+    M(Bool, enable_cloud_table_definition_cache, false, "Cache parsed CREATE statements of cloud tables keyed by the definition text, so repeated worker session setup reuses the AST instead of re-parsing it. DDL changes the text and bypasses stale entries naturally.", 0) \
     /** Settings for hive */ \
     M(Bool, use_hive_metastore_filter, true, "", 0) \
     M(Bool, use_hive_cluster_key_filter, true, "", 0) \
     M(Bool, use_hive_partition_filter, true, "", 0) \
     M(Bool, use_hive_file_level_filter, false, "", 0) \
     M(Bool, use_hive_split_level_filter, false, "", 0) \
+    M(Bool, enable_read_hive_file_by_slice, false, "Allocate hive files to reading threads by slice (parquet row group, ORC stripe) instead of by whole file, so that several threads read one big file in parallel", 0) \
     /** Settings for Unique Table */ \
     M(Bool, enable_unique_partial_update, true, "Whether to use partial column update for INSERT", 0) \
     M(Milliseconds, dedup_worker_heartbeat_ms, 3000, "Dedup worker heartbeat interval time", 0) \
@@ -1341,6 +1406,7 @@ enum PreloadLevelSettings : UInt64
     M(Bool, enable_unique_table_detach_ignore_delete_bitmap, false, "Enable ignore delete bitmap info when handling detach commands for unique table, for example: delete bitmap has been broken, we can just ignore it via this parameter.", 0) \
     M(DedupKeyMode, dedup_key_mode, DedupKeyMode::REPLACE, "Handle different deduplication modes, current valid values: REPLACE, THROW, APPEND. THROW mode can only be used in non-staging area scenarios. APPEND mode will not execute dedup process, which is suitable for historical non-duplicated data import scenarios", 0) \
     M(Seconds, unique_sleep_seconds_after_acquire_lock, 0, "Only for test", 0) \
+    M(Bool, enable_unique_table_point_lookup, false, "Serve SELECTs that bind the whole unique key with equality predicates by probing the per-part key indexes instead of setting up a scan. Only applies to tables with table-level unique keys when the parts are available locally.", 0) \
     \
     /** Settings for Map */ \
     M(Bool, optimize_map_column_serialization, false, "Construct map value columns in advance during serialization", 0) \
@@ -1354,6 +1420,7 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, grace_hash_join_left_side_parallel, 1, "Initial number of grace hash join left side parallel", 0) \
     M(UInt64, grace_hash_join_read_result_block_size, 65536, "Rows for reading spilled block in grace hash join.", 0) \
     M(UInt64, grace_hash_join_read_result_block_bytes, 10000000, "Bytes for reading spilled block in grace hash join.", 0) \
+    M(Bool, grace_hash_join_spill_to_disk_cache, false, "Place grace hash join spill files on the volume backing the local merge tree disk cache when one is configured, so spilling runs at the cache device's speed instead of the generic tmp path. Spill files share the device with cached data and are removed as soon as their bucket is joined", 0) \
     M(Bool, use_grace_hash_only_repartition, false, "Only use grace hash join when exchange type is repartition", 0) \
     M(UInt64, filesystem_cache_max_download_size, (128UL * 1024 * 1024 * 1024), "Max remote filesystem cache size that can be downloaded by a single query", 0) \
     M(Bool, skip_download_if_exceeds_query_cache, true, "Skip download from remote filesystem if exceeds query cache size", 0) \
@@ -1431,6 +1498,7 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, plan_optimizer_rule_warning_time, 1000, "Send warning if a optimize rule optimize time exceed timeout", 0) \
     M(Bool, enable_plan_cache, false, "Whether enable plan cache", 0) \
     M(Bool, force_plan_cache, false, "Force to use plan cache", 0) \
+    M(Bool, enable_cardinality_feedback, false, "Whether to override cardinality estimates with output cardinalities observed from previous runs of the same plan", 0) \
     M(UInt64, max_plannode_count, 200, "The max plannode count", 0) \
     M(Bool, enable_memory_catalog, false, "Enable memory catalog for unittest", 0) \
     M(UInt64, memory_catalog_worker_size, 8, "Memory catalog work size for unittest", 0) \
@@ -1445,6 +1513,7 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, global_bindings_update_time, 60*60, "Interval to update global binding cache from catalog, in seconds.", 0) \
     /** */ \
     M(Bool, late_materialize_aggressive_push_down, false, "When table use early materialize strategy, this setting enable aggressively moving predicates to read chain w/o considering other factor like columns size or number of columns in the query", 0) \
+    M(Bool, enable_prewhere_selectivity_order, false, "Order PREWHERE/late-materialize candidates by estimated cost (column bytes times the fraction of rows expected to survive the condition) instead of by column size alone", 0) \
     /** Optimizer relative settings, Plan build and RBO */ \
     M(Bool, enable_auto_prepared_statement, false, "Whether to enable automatic prepared statement", 0) \
     M(Bool, enable_nested_loop_join, true, "Whether enable nest loop join for outer join with filter", 0)\
@@ -1505,6 +1574,7 @@ enum PreloadLevelSettings : UInt64
     M(Bool, enable_predicate_pushdown_rewrite, true, "Whether to enable PredicatePushdown", 0) \
     M(Bool, enable_hints_propagator, true, "Whether to enable HintsPropagator", 0) \
     M(Bool, enable_join_algorithm_hints, true, "Whether to enable ImplementJoinAlgorithmHints", 0) \
+    M(Bool, enable_sorted_merge_join_for_sorted_scans, false, "Use the streaming merge join instead of hash join when both join inputs scan tables whose sorting key covers the join keys", 0) \
     M(Bool, enable_join_operation_hints, true, "Whether to enable ImplementJoinOperationHints", 0) \
     M(Bool, enable_join_order_hint, true, "Whether to enable ImplementJoinOrderHints", 0) \
     M(Bool, enable_set_join_distribution, true, "Whether to enable SetJoinDistribution rule", 0) \
@@ -1558,6 +1628,7 @@ enum PreloadLevelSettings : UInt64
     M(Bool, enable_remove_redundant, true, "Whether to enable RemoveRedundant rules", 0) \
     M(Bool, enable_push_projection, true, "Whether to enable PushProjection rules", 0) \
     M(Bool, enable_push_partial_agg_through_exchange, true, "Whether to enable PushPartialAggThroughExchange rules", 0) \
+    M(Bool, enable_intermediate_merge_before_gather, false, "Insert a repartitioned state-merging stage below a gather exchange of a final aggregation, so the gathering segment receives pre-merged states instead of every worker's partials", 0) \
     M(Bool, enable_push_partial_agg_through_union, true, "Whether to enable PushPartialAggThroughUnion rules", 0) \
     M(Bool, enable_push_partial_sorting_through_exchange, true, "Whether to enable PushPartialSortingThroughExchange rules", 0) \
     M(Bool, enable_push_partial_limit_through_exchange, true, "Whether to enable PushPartialLimitThroughExchange rules", 0) \
@@ -1568,6 +1639,8 @@ enum PreloadLevelSettings : UInt64
     M(Bool, enable_push_topn_through_projection, true, "Whether to enable PushTopNThroughProjection rules", 0) \
     M(Bool, enable_push_topn_filtering_through_projection, true, "Whether to enable PushTopNFilteringThroughProjection rules", 0) \
     M(Bool, enable_push_topn_filtering_through_union, true, "Whether to enable PushTopNFilteringThroughUnion rules", 0) \
+    M(Bool, enable_lazy_topn_materialization, false, "For ORDER BY ... LIMIT over a plain table scan, read only the sort columns first and fetch the remaining columns for the top rows afterwards", 0) \
+    M(UInt64, max_limit_for_lazy_topn_materialization, 10000, "The maximum LIMIT for which lazy TopN materialization is applied; larger limits make the per-row fetch more expensive than a normal read", 0) \
     M(Bool, enable_optimize_aggregate_memory_efficient, false, "Whether to enable OptimizeMemoryEfficientAggregation rules", 0) \
     M(Bool, enable_cascades_optimizer, true, "Whether to enable CascadesOptimizer", 0) \
     M(Bool, enable_iterative_rewriter, true, "Whether to enable InterativeRewriter", 0) \
@@ -1594,6 +1667,7 @@ enum PreloadLevelSettings : UInt64
     M(Bool, statistics_enable_sample, true, "Use sampling for statistics", 0) \
     M(UInt64, statistics_sample_row_count, 40'000'000, "Minimal row count for sampling", 0) \
     M(Float, statistics_sample_ratio, 0.01, "Ratio for sampling", 0) \
+    M(UInt64, statistics_full_ndv_sample_threshold, 0, "In full statistics collection mode, estimate NDV from a block sample when the table has more rows than this, instead of scanning every row. Zero keeps the exact full scan.", 0) \
     M(StatisticsAccurateSampleNdvMode, statistics_accurate_sample_ndv, StatisticsAccurateSampleNdvMode::AUTO, "Mode of accurate sample ndv to estimate full ndv", 0) \
     M(UInt64, statistics_batch_max_columns, 30, "Max column size in a batch when collecting stats", 0) \
     M(String, statistics_exclude_tables_regex, "", "regex to exclude tables for statistics operations", 0) \
@@ -1650,6 +1724,7 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, max_expand_join_key_size, 3, "Whether enable using equivalences when property match", 0) \
     M(UInt64, max_expand_agg_key_size, 3, "Max allowed agg/window keys number when expand powerset when property match", 0) \
     M(Bool, enable_sharding_optimize, false, "Whether enable sharding optimization, eg. local join", 0) \
+    M(Bool, enable_bucket_shuffle_join, false, "Whether enable repartitioning one join side with the bucket hash of the other side, so the clustered side joins in place without exchange", 0) \
     M(Bool, enable_magic_set, true, "Whether enable magic set rewriting for join aggregation", 0) \
     M(Float, magic_set_filter_factor, 0.5, "The minimum filter factor of magic set, used for early pruning", 0) \
     M(UInt64, magic_set_max_search_tree, 2, "The maximum table scans in magic set, used for early pruning", 0) \
@@ -1657,6 +1732,7 @@ enum PreloadLevelSettings : UInt64
     M(Float, magic_set_rows_factor, 0.6, "The minimum rows of source node in magic set, used for early pruning", 0) \
     M(Bool, enable_magic_set_cte, true, "Whether enable magic set rewriting build as cte", 0) \
     M(CTEMode, cte_mode, CTEMode::AUTO, "CTE mode: SHARED|INLINED|AUTO|ENFORCED", 0) \
+    M(UInt64, cte_buffer_max_bytes_before_spill, 0, "Deadlock-avoidance buffers of shared CTEs keep at most this many bytes in memory and spill the tail to a compressed temporary file, streaming it back once the producer is done. 0 - unbounded in-memory buffering.", 0) \
     M(SpillMode, spill_mode, SpillMode::MANUAL, "SpillMode: MANUAL(default)|AUTO", 0) \
     M(UInt64, max_allowed_mem_size_in_join_spill, 512000000, "Max allowed memory-size(estimated) in join spill", 0) \
     M(Float, spill_triger_threshold, 0.7, "Threshold to triger spill then memory usage reach a certain ratio of memory quota", 0) \
@@ -1705,9 +1781,16 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, exchange_remote_receiver_queue_size, 100, "Queue size for remote exchange receiver",0) \
     M(UInt64, exchange_multi_path_receiver_queue_size, 200, "Queue size for multi path exchange receiver", 0) \
     M(Bool, exchange_enable_block_compress, false, "Whether enable exchange block compress ", 0) \
+    M(Bool, exchange_enable_string_dictionary_encoding, false, "Send low-cardinality String columns of exchange blocks as per-block dictionaries plus indices, detected by sampling during serialization", 0) \
+    M(String, exchange_cross_host_compression_method, "", "Codec for compressed exchange data whose receiver runs on another host, e.g. ZSTD for cross-AZ worker groups. Empty uses network_compression_method for all hops", 0) \
+    M(Bool, exchange_skip_compress_for_same_host, false, "Use the NONE codec for exchange data when every receiver runs on the sender's host, such traffic stays on loopback and compressing it only costs CPU", 0) \
+    M(UInt64, exchange_parallel_deserialize_threads, 0, "Deserialize received exchange blocks with up to this many threads per block, senders write a column-sliced format when it is not 0, so it must be identical on all nodes of the query", 0) \
+    M(Bool, exchange_enable_zero_copy_send, false, "Attach large fixed-width columns of uncompressed column-sliced exchange blocks to the brpc send buffer by reference instead of serializing a copy. The wire format is unchanged", 0) \
     M(UInt64, exchange_stream_max_buf_size, 209715200, "Default 200M, -1 means no limit", 0) \
     M(UInt64, exchange_buffer_send_threshold_in_bytes, 1000000, "The minimum bytes when exchange will flush send buffer ", 0) \
     M(UInt64, exchange_buffer_send_threshold_in_row, 65505, "The minimum row num when exchange will flush send buffer", 0) \
+    M(UInt64, exchange_buffer_send_max_hold_ms, 100, "Flush exchange send buffer after holding rows this long even below size thresholds, 0 means wait for thresholds", 0) \
+    M(UInt64, exchange_sender_merge_states_threshold_in_bytes, 0, "Combine aggregate states with equal grouping keys on the exchange sender side before serialization, flushing the merge buffer once it grows beyond this many bytes. 0 disables the merge", 0) \
     M(UInt64, \
       exchange_unordered_output_parallel_size, \
       8, \
@@ -1720,6 +1803,9 @@ enum PreloadLevelSettings : UInt64
     M(Bool, exchange_force_use_buffer, false, "Force exchange use buffer as possible", 0) \
     M(Bool, exchange_enable_node_stable_hash, false, "Force exchange use buffer as possible", 0) \
     M(Bool, exchange_use_query_memory_tracker, true, "Use query-level memory tracker", 0) \
+    M(Bool, exchange_enable_async_recv, true, "Poll exchange receive queues with epoll instead of blocking a pipeline thread per stream", 0) \
+    M(UInt64, plan_segment_estimated_memory, 0, "Declared per-worker peak memory of this query in bytes, used by the worker-level memory arbiter when admitting plan segments. 0 means unknown and bypasses arbitration", 0) \
+    M(Milliseconds, plan_segment_memory_admission_max_wait_ms, 5000, "How long a plan segment may queue on a worker waiting for declared memory to be released before the query is rejected", 0) \
     M(UInt64, wait_for_post_processing_timeout_ms, 1000, "Timeout for waiting post processing rpc from workers.", 0) \
     M(UInt64, distributed_query_wait_exception_ms, 2000,"Wait final planSegment exception from segmentScheduler.", 0) \
     M(UInt64, distributed_max_parallel_size, false, "Max distributed execution parallel size", 0) \
@@ -1737,6 +1823,7 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, runtime_filter_bloom_build_threshold, 2048000, "The threshold of right table to build bloom filter", 0) \
     M(UInt64, runtime_filter_in_build_threshold, 1024, "The threshold of right table to build value set filter", 0) \
     M(Bool, enable_runtime_filter_pipeline_poll, true, "No additional segment needed for the left side during broadcast join, polling time bounded", 0) \
+    M(Bool, enable_runtime_filter_index_pruning, false, "Probe ready runtime bloom filters against primary key values that are constant within a granule during index analysis, pruning granules before any column IO", 0) \
     M(Float, adjust_range_set_filter_rate, 0.1, "If the prewhere is not range or set, adjust use this value as priority to bloom filter ", 0) \
     M(UInt64, shuffle_aware_ndv_threshold, 0, "Threshold to to use shuffle-aware grf or to use pre enlarge ndv, 0 disable shuffle-aware grf", 0) \
     M(String, runtime_filter_black_list, "", "Runtime filter ids need be blocked", 0) \
@@ -1831,9 +1918,15 @@ enum PreloadLevelSettings : UInt64
     M(Bool, bsp_shuffle_reduce_locality_enabled, true, "Whether to compute locality preferences for reduce tasks", 0) \
     M(Float, bsp_shuffle_reduce_locality_fraction, 0.2, "Fraction of total map output that must be at a location for it to considered as a preferred location for a reduce task", 0) \
     M(UInt64, bsp_max_retry_num, 3, "max retry number for a task(plan segment instance) in bsp mode, does not include first execution(i.e. normal execution without retry)",0) \
+    M(Bool, enable_bsp_speculative_execution, false, "Cancel and re-dispatch straggling plan segment instances in bsp mode. Safe because materialized exchange outputs let the rerun read the same inputs", 0) \
+    M(Float, bsp_speculation_slow_instance_multiplier, 2.0, "An instance is considered a straggler when its elapsed time exceeds this multiple of the median runtime of the finished instances of the same segment", 0) \
+    M(Float, bsp_speculation_quantile, 0.75, "Fraction of a segment's instances that must have finished before its stragglers are considered for speculative re-dispatch", 0) \
+    M(UInt64, bsp_speculation_min_elapsed_ms, 10000, "Never treat an instance as a straggler before it has run for at least this many milliseconds", 0) \
+    M(Bool, bsp_recover_lost_exchange_data, true, "When a segment instance in bsp mode fails because materialized exchange data on a lost worker cannot be read, re-run only the producer instances whose output lived on that worker and retry the consumer, instead of failing the whole query", 0) \
     /*end of bulk synchronous parallel section*/ \
     M(Bool, enable_io_scheduler, false, "Enable io scheduler", 0) \
     M(Bool, enable_io_pfra, false, "Enable prefetch and read ahead for remote read", 0) \
+    M(Bool, remote_fs_enable_hedged_reads, false, "When a remote read exceeds an adaptive latency deadline, issue a second request through another replica/connection and take the first response", 0) \
     M(Bool, enable_implicit_column_prewhere_push, false, "Enable push implicit column(map column) to prewhere", 0) \
     \
     M(Bool, force_manipulate_materialized_mysql_table, false, "For tables of materialized mysql engine, force to manipulate it.", 0) \
@@ -2029,13 +2122,16 @@ enum PreloadLevelSettings : UInt64
     M(UInt64, cnch_part_attach_assert_rows_count, 0, "Assert totol number of part rows to attach.", 0) \
     M(UInt64, cnch_part_attach_max_source_discover_level, 1, "Maximum levels of drill down to lookup for different sources", 0) \
     M(UInt64, cnch_part_attach_max_threads, 16, "Max threads to use when attach parts", 0) \
+    M(UInt64, cnch_send_parts_deserialize_max_threads, 8, "Max threads to build data parts from the part models of a sendQueryDataParts RPC; only applied when the request carries thousands of parts", 0) \
     M(UInt64, attach_failure_injection_knob, 0, "Attach failure injection knob, for test only", 0) \
     M(Bool, skip_table_definition_hash_check, false, "Whether skip table definition hash check when attach data parts.", 0)  \
     M(Bool, allow_attach_parts_with_different_table_definition_hash, true, "Whether to allow attaching of parts with different table definition hash to target table.", 0)  \
     M(Bool, async_post_commit, true, "Txn post commit asynchronously", 0) \
+    M(Bool, enable_transaction_group_commit, false, "Batch concurrent plain transaction commits into one TSO fetch and one metastore write; improves small-insert throughput", 0) \
     M(String, tenant_id, "", "tenant_id of cnch user", 0) \
     M(Bool, cnch_enable_merge_prefetch, true, "Enable prefetching while merge", 0) \
     M(UInt64, cnch_merge_prefetch_segment_size, 256 * 1024 * 1024, "Min segment size of file when prefetching for merge", 0) \
+    M(UInt64, cnch_merge_prefetch_max_inflight_bytes, 0, "Cap on the total size of merge prefetch segments kept on local disk at once; 0 means unlimited. Bounds the prefetch footprint while merging huge parts", 0) \
     M(Bool, offloading_with_query_plan, false, "utilize query plan to offload the computation completely to worker", 0) \
     M(Seconds, access_entity_ttl, 60 * 60, "TTL for access entities stored in memory in seconds", 0) \
 \
@@ -2049,6 +2145,7 @@ enum PreloadLevelSettings : UInt64
     \
     M(Bool, enable_cache_reader_buffer_reuse, false, "Decpreated settings, only a place holder", 0) \
     M(Bool, enable_auto_query_forwarding, true, "Auto forward query to target server when having multiple servers", 0) \
+    M(UInt64, query_forwarding_max_target_queries, 0, "When larger than 0, skip forwarding a query to the table's host server if that server already runs at least this many queries and execute it locally instead. 0 means always forward", 0) \
     M(Bool, enable_select_query_forwarding, false, "Auto forward select query to target server when having multiple servers", 0) \
     \
     M(Bool, merge_partition_stats,false, "merge all partition stats", 0) \
@@ -0,0 +1,46 @@
+#include <Core/NamesAndTypes.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataTypes/DataTypeString.h>
+
+#include <gtest/gtest.h>
+
+using namespace DB;
+
+TEST(InternedNamesAndTypes, IdenticalListsShareOneCopy)
+{
+    NamesAndTypesList columns{
+        {"id", std::make_shared<DataTypeUInt64>()},
+        {"value", std::make_shared<DataTypeString>()},
+    };
+
+    auto first = internNamesAndTypesList(columns);
+    auto second = internNamesAndTypesList(columns);
+
+    ASSERT_EQ(first.get(), second.get());
+    ASSERT_EQ(*first, columns);
+}
+
+TEST(InternedNamesAndTypes, DifferentListsStayDistinct)
+{
+    NamesAndTypesList a{{"id", std::make_shared<DataTypeUInt64>()}};
+    NamesAndTypesList b{{"id", std::make_shared<DataTypeInt64>()}};
+
+    auto interned_a = internNamesAndTypesList(a);
+    auto interned_b = internNamesAndTypesList(b);
+
+    ASSERT_NE(interned_a.get(), interned_b.get());
+}
+
+TEST(InternedNamesAndTypes, EntryIsRecreatedAfterLastOwnerDies)
+{
+    NamesAndTypesList columns{{"ephemeral", std::make_shared<DataTypeUInt8>()}};
+
+    auto first = internNamesAndTypesList(columns);
+    const auto * old_address = first.get();
+    first.reset();
+
+    /// The registry holds entries weakly, so a fresh list is handed out.
+    auto second = internNamesAndTypesList(columns);
+    ASSERT_EQ(*second, columns);
+    (void)old_address;
+}
@@ -33,9 +33,11 @@
 #include <Interpreters/Context.h>
 #include <Parsers/ASTInsertQuery.h>
 #include <Common/CurrentThread.h>
+#include <Common/SipHash.h>
 #include <Common/setThreadName.h>
 #include <Common/ThreadPool.h>
 #include <Common/checkStackSize.h>
+#include <Common/Stopwatch.h>
 #include <Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.h>
 #include <Storages/StorageValues.h>
 #include <Storages/LiveView/StorageLiveView.h>
@@ -47,9 +49,98 @@
 #include <Storages/Kafka/StorageCloudKafka.h>
 #endif
 
+#include <map>
+#include <mutex>
+#include <optional>
+
 namespace DB
 {
- 
+
+namespace
+{
+
+/// Cache of analyzed materialized view select headers. Streaming consumers (Kafka) rebuild
+/// this output stream every poll cycle, and re-running the analyze-only select interpreter
+/// for every attached view each cycle dominated the per-poll overhead. The cache is keyed by
+/// the exact metadata snapshots of the source table and the view and pins them, so any DDL,
+/// which installs new snapshot objects, naturally invalidates the entry. Settings can change
+/// the analyzed header too (join_use_nulls alone flips result types), so a fingerprint of the
+/// select context's changed settings is part of the key as well.
+class ViewSelectHeaderCache
+{
+public:
+    static ViewSelectHeaderCache & instance()
+    {
+        static ViewSelectHeaderCache cache;
+        return cache;
+    }
+
+    static UInt64 settingsFingerprint(const Settings & settings)
+    {
+        SipHash hash;
+        for (const auto & setting : settings.allChanged())
+        {
+            hash.update(setting.getName());
+            hash.update(setting.getValueString());
+        }
+        return hash.get64();
+    }
+
+    std::optional<Block>
+    tryGet(const StorageMetadataPtr & source_metadata, const StorageMetadataPtr & view_metadata, UInt64 settings_fingerprint)
+    {
+        std::lock_guard lock(mutex);
+        auto it = entries.find(makeKey(source_metadata, view_metadata, settings_fingerprint));
+        if (it == entries.end() || it->second.expire_at_ns < clock_gettime_ns(CLOCK_MONOTONIC))
+            return {};
+        return it->second.header;
+    }
+
+    void set(
+        const StorageMetadataPtr & source_metadata,
+        const StorageMetadataPtr & view_metadata,
+        UInt64 settings_fingerprint,
+        const Block & header)
+    {
+        std::lock_guard lock(mutex);
+        /// The cap only guards against unbounded growth on busy servers with many short-lived
+        /// tables; dropping everything is fine, entries are cheap to rebuild.
+        if (entries.size() >= max_entries)
+            entries.clear();
+        entries[makeKey(source_metadata, view_metadata, settings_fingerprint)]
+            = {source_metadata, view_metadata, header, clock_gettime_ns(CLOCK_MONOTONIC) + ttl_ns};
+    }
+
+private:
+    struct Entry
+    {
+        /// Pinning the snapshots keeps their addresses from being reused for new metadata.
+        StorageMetadataPtr source_metadata;
+        StorageMetadataPtr view_metadata;
+        Block header;
+        UInt64 expire_at_ns;
+    };
+
+    /// The snapshot-based key does not see DDL of other tables a view query may join, so
+    /// entries additionally expire after a minute; at streaming poll cadence that still
+    /// amortizes the analysis over thousands of cycles.
+    static constexpr UInt64 ttl_ns = 60ULL * 1'000'000'000;
+
+    using Key = std::tuple<const void *, const void *, UInt64>;
+
+    static Key makeKey(const StorageMetadataPtr & source_metadata, const StorageMetadataPtr & view_metadata, UInt64 settings_fingerprint)
+    {
+        return {source_metadata.get(), view_metadata.get(), settings_fingerprint};
+    }
+
+    static constexpr size_t max_entries = 1024;
+
+    std::mutex mutex;
+    std::map<Key, Entry> entries;
+};
+
+}
+
 PushingToViewsBlockOutputStream::PushingToViewsBlockOutputStream(
     const StoragePtr & storage_,
     const StorageMetadataPtr & metadata_snapshot_,
@@ -177,9 +268,20 @@ PushingToViewsBlockOutputStream::PushingToViewsBlockOutputStream(
                 std::unique_ptr<ASTInsertQuery> insert = std::make_unique<ASTInsertQuery>();
                 insert->table_id = target_table_id;
 
-                /// Get list of columns we get from select query.
-                auto header = InterpreterSelectQuery(query, select_context, SelectQueryOptions().analyze())
-                    .getSampleBlock();
+                /// Get list of columns we get from select query. The analyzed header only
+                /// depends on the source and view metadata plus the header-affecting
+                /// settings, so reuse it across the per-cycle stream rebuilds of
+                /// streaming consumers.
+                Block header;
+                auto & header_cache = ViewSelectHeaderCache::instance();
+                UInt64 settings_fingerprint = ViewSelectHeaderCache::settingsFingerprint(select_context->getSettingsRef());
+                if (auto cached_header = header_cache.tryGet(metadata_snapshot, dependent_metadata_snapshot, settings_fingerprint))
+                    header = std::move(*cached_header);
+                else
+                {
+                    header = InterpreterSelectQuery(query, select_context, SelectQueryOptions().analyze()).getSampleBlock();
+                    header_cache.set(metadata_snapshot, dependent_metadata_snapshot, settings_fingerprint, header);
+                }
 
                 /// Select columns without materialized columns and columns function of uniq merge tree.
                 auto list = std::make_shared<ASTExpressionList>();
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+
+#include <Columns/IColumnUnique.h>
+#include <Common/LRUCache.h>
+#include <Common/ProfileEvents.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event LowCardinalityDictionaryCacheHits;
+    extern const Event LowCardinalityDictionaryCacheMisses;
+}
+
+namespace DB
+{
+
+/// Estimate of number of bytes a decoded dictionary occupies in cache.
+struct LowCardinalityDictionaryWeightFunction
+{
+    /// We spent additional bytes on key in hashmap, linked lists, shared pointers, etc ...
+    static constexpr size_t DICTIONARY_CACHE_OVERHEAD = 128;
+
+    size_t operator()(const ColumnUniquePtr & dictionary) const
+    {
+        return (dictionary ? dictionary->allocatedBytes() : 0) + DICTIONARY_CACHE_OVERHEAD;
+    }
+};
+
+/** Cache of decoded LowCardinality dictionaries, shared across parts of a table.
+  * Parts produced by successive merges of the same data usually carry near-identical
+  * dictionaries, so one decoded ColumnUnique can serve readers of many parts.
+  *
+  * Keyed by the checksum of the dictionary stream file, so identical dictionary content
+  * maps to the same entry regardless of which part it was read from. Cached dictionaries
+  * are only ever used read-only: any mutation goes through COW and forks a private copy.
+  */
+class LowCardinalityDictionaryCache
+    : public LRUCache<String, ColumnUniquePtr, std::hash<String>, LowCardinalityDictionaryWeightFunction>
+{
+private:
+    using Base = LRUCache<String, ColumnUniquePtr, std::hash<String>, LowCardinalityDictionaryWeightFunction>;
+
+public:
+    explicit LowCardinalityDictionaryCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {
+    }
+
+    MappedPtr get(const Key & key)
+    {
+        auto result = Base::get(key);
+        if (result)
+            ProfileEvents::increment(ProfileEvents::LowCardinalityDictionaryCacheHits);
+        else
+            ProfileEvents::increment(ProfileEvents::LowCardinalityDictionaryCacheMisses);
+
+        return result;
+    }
+};
+
+using LowCardinalityDictionaryCachePtr = std::shared_ptr<LowCardinalityDictionaryCache>;
+
+}
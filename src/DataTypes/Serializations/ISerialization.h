@@ -59,6 +59,8 @@ struct NameAndTypePair;
 
 class CompressedDataIndex;
 
+class LowCardinalityDictionaryCache;
+
 class ISerialization : private boost::noncopyable, public std::enable_shared_from_this<ISerialization>
 {
 public:
@@ -272,6 +274,13 @@ public:
         double avg_value_size_hint = 0;
 
         bool zero_copy_read_from_cache = false;
+
+        /// Shared cache of decoded LowCardinality dictionaries. Looked up only when the key getter
+        /// returns a non-empty key for the dictionary stream; the getter returns an empty key
+        /// whenever skipping the stream on a cache hit would be unsafe (e.g. the stream contains
+        /// more than one dictionary).
+        std::shared_ptr<LowCardinalityDictionaryCache> low_cardinality_dictionary_cache;
+        std::function<String(const SubstreamPath &)> low_cardinality_dictionary_cache_key_getter;
     };
 
     /// Call before serializeBinaryBulkWithMultipleStreams chain to write something before first mark.
@@ -22,6 +22,7 @@
 #include <DataTypes/Serializations/SerializationLowCardinality.h>
 #include <DataTypes/DataTypeLowCardinality.h>
 #include <DataTypes/DataTypeNullable.h>
+#include <DataTypes/LowCardinalityDictionaryCache.h>
 #include <DataTypes/DataTypesNumber.h>
 
 #include <Columns/ColumnLowCardinality.h>
@@ -655,6 +656,25 @@ void SerializationLowCardinality::deserializeBinaryBulkWithMultipleStreams(
 
     auto read_dictionary = [this, low_cardinality_state, keys_stream, &settings]()
     {
+        String cache_key;
+        if (settings.low_cardinality_dictionary_cache && settings.low_cardinality_dictionary_cache_key_getter)
+        {
+            settings.path.push_back(Substream::DictionaryKeys);
+            cache_key = settings.low_cardinality_dictionary_cache_key_getter(settings.path);
+            settings.path.pop_back();
+        }
+
+        if (!cache_key.empty())
+        {
+            if (auto cached_dictionary = settings.low_cardinality_dictionary_cache->get(cache_key))
+            {
+                /// The key getter guarantees the keys stream holds a single dictionary, so it is
+                /// safe to leave the stream unconsumed: every seek lands back at its start.
+                low_cardinality_state->global_dictionary = *cached_dictionary;
+                return;
+            }
+        }
+
         UInt64 num_keys;
         readIntBinary(num_keys, *keys_stream);
 
@@ -662,7 +682,9 @@ void SerializationLowCardinality::deserializeBinaryBulkWithMultipleStreams(
         auto global_dict_keys = keys_type->createColumn();
         dict_inner_serialization->deserializeBinaryBulk(*global_dict_keys, *keys_stream, num_keys, 0, settings.zero_copy_read_from_cache);
 
-        auto column_unique = DataTypeLowCardinality::createColumnUnique(*dictionary_type, std::move(global_dict_keys));
+        ColumnUniquePtr column_unique = DataTypeLowCardinality::createColumnUnique(*dictionary_type, std::move(global_dict_keys));
+        if (!cache_key.empty())
+            settings.low_cardinality_dictionary_cache->set(cache_key, std::make_shared<ColumnUniquePtr>(column_unique));
         low_cardinality_state->global_dictionary = std::move(column_unique);
     };
 
@@ -38,7 +38,14 @@ void SerializationObject<Parser>::deserializeTextImpl(IColumn & column, Reader &
 {
     auto & column_object = assert_cast<ColumnObject &>(column);
 
-    String buf;
+    /// One scratch buffer and one parser per thread: keeps the parser's internal
+    /// buffers (simdjson reuses its structural index allocation between documents)
+    /// warm across the rows of an INSERT and avoids a heap allocation plus a pool
+    /// mutex round-trip for every document.
+    static thread_local String buf;
+    static thread_local Parser parser;
+
+    buf.clear();
     reader(buf);
     std::optional<ParseResult> result;
 
@@ -46,8 +53,7 @@ void SerializationObject<Parser>::deserializeTextImpl(IColumn & column, Reader &
     /// for better CAST from String to Object.
     if (!buf.empty())
     {
-        auto parser = parsers_pool.get([] { return new Parser; });
-        result = parser->parse(buf.data(), buf.size());
+        result = parser.parse(buf.data(), buf.size());
     }
     else
     {
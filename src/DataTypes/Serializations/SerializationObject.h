@@ -2,7 +2,6 @@
 
 #include <Columns/ColumnObject.h>
 #include <DataTypes/Serializations/SimpleTextSerialization.h>
-#include <Common/ObjectPool.h>
 
 namespace DB
 {
@@ -106,9 +105,6 @@ private:
 
     void serializeTextImpl(const IColumn & column, size_t row_num, WriteBuffer & ostr, const FormatSettings & settings) const;
     void serializeTextFromSubcolumn(const ColumnObject::Subcolumn & subcolumn, size_t row_num, WriteBuffer & ostr, const FormatSettings & settings) const;
-
-    /// Pool of parser objects to make SerializationObject thread safe.
-    mutable SimpleObjectPool<Parser> parsers_pool;
 };
 
 SerializationPtr getObjectSerialization(const String & schema_format);
@@ -22,6 +22,7 @@
 #include "IO/ReadSettings.h"
 #include <Disks/IO/AsynchronousBoundedReadBuffer.h>
 #include <IO/Scheduler/IOScheduler.h>
+#include <IO/HedgedRemoteFSReader.h>
 #include <IO/S3Common.h>
 #include <IO/S3RemoteFSReader.h>
 #include <IO/ReadBufferFromS3.h>
@@ -198,10 +199,13 @@ std::unique_ptr<ReadBufferFromFileBase> DiskByteS3::readFile(const String & path
 {
     String object_key = std::filesystem::path(root_prefix) / path;
     if (IO::Scheduler::IOSchedulerSet::instance().enabled() && settings.enable_io_scheduler) {
+        std::shared_ptr<RemoteFSReaderOpts> effective_reader_opts = reader_opts;
+        if (settings.remote_fs_enable_hedged_reads)
+            effective_reader_opts = std::make_shared<HedgedRemoteFSReaderOpts>(effective_reader_opts);
         if (settings.enable_io_pfra) {
             return std::make_unique<PFRAWSReadBufferFromFS>(
                 object_key,
-                reader_opts,
+                effective_reader_opts,
                 IO::Scheduler::IOSchedulerSet::instance().schedulerForPath(object_key),
                 PFRAWSReadBufferFromFS::Options{
                     .min_buffer_size_ = settings.remote_fs_buffer_size,
@@ -210,7 +214,7 @@ std::unique_ptr<ReadBufferFromFileBase> DiskByteS3::readFile(const String & path
         } else {
             return std::make_unique<WSReadBufferFromFS>(
                 object_key,
-                reader_opts,
+                effective_reader_opts,
                 IO::Scheduler::IOSchedulerSet::instance().schedulerForPath(object_key),
                 settings.remote_fs_buffer_size,
                 nullptr,
@@ -22,6 +22,7 @@
 #include <Interpreters/Context.h>
 #include <Interpreters/Context_fwd.h>
 #include <IO/Scheduler/IOScheduler.h>
+#include <IO/HedgedRemoteFSReader.h>
 #include <IO/PFRAWSReadBufferFromFS.h>
 #include <IO/WSReadBufferFromFS.h>
 #include <Storages/HDFS/ReadBufferFromByteHDFS.h>
@@ -189,10 +190,13 @@ std::unique_ptr<ReadBufferFromFileBase> DiskByteHDFS::readFile(const String & pa
     String file_path = absolutePath(path);
 
     if (IO::Scheduler::IOSchedulerSet::instance().enabled() && settings.enable_io_scheduler) {
+        std::shared_ptr<RemoteFSReaderOpts> reader_opts = settings.byte_hdfs_pread ? pread_reader_opts : read_reader_opts;
+        if (settings.remote_fs_enable_hedged_reads)
+            reader_opts = std::make_shared<HedgedRemoteFSReaderOpts>(reader_opts);
         if (settings.enable_io_pfra) {
             return std::make_unique<PFRAWSReadBufferFromFS>(
                 file_path,
-                settings.byte_hdfs_pread ? pread_reader_opts : read_reader_opts,
+                reader_opts,
                 IO::Scheduler::IOSchedulerSet::instance().schedulerForPath(file_path),
                 PFRAWSReadBufferFromFS::Options{
                     .min_buffer_size_ = settings.remote_fs_buffer_size,
@@ -201,7 +205,7 @@ std::unique_ptr<ReadBufferFromFileBase> DiskByteHDFS::readFile(const String & pa
         } else {
             return std::make_unique<WSReadBufferFromFS>(
                 file_path,
-                settings.byte_hdfs_pread ? pread_reader_opts : read_reader_opts,
+                reader_opts,
                 IO::Scheduler::IOSchedulerSet::instance().schedulerForPath(file_path),
                 settings.remote_fs_buffer_size,
                 nullptr,
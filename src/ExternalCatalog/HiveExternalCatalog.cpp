@@ -15,6 +15,7 @@
 #include <Parsers/parseQuery.h>
 #include <Storages/ColumnsDescription.h>
 #include <Storages/Hive/HiveSchemaConverter.h>
+#include <Storages/Hive/Metastore/CachedMetaClient.h>
 #include <Storages/Hive/Metastore/HiveMetastore.h>
 #include <Storages/Hive/Metastore/IMetaClient.h>
 #include <Storages/IStorage.h>
@@ -55,6 +56,14 @@ HiveExternalCatalog::HiveExternalCatalog(const std::string & _catalog_name, [[ma
     {
         hms_client = GlueMetastoreClientFactory::instance().getOrCreate(configs);
     }
+
+    /// Schemas and partition listings of lake tables change rarely compared to how often
+    /// federation queries ask for them, while a metastore round trip costs seconds. With a
+    /// TTL configured, repeated queries are served from the cache and expired entries are
+    /// refreshed in the background instead of stalling planning.
+    if (UInt64 cache_ttl_sec = configs->getUInt64("hive.metastore.cache_ttl_sec", 0))
+        hms_client = std::make_shared<CachedMetaClient>(
+            hms_client, cache_ttl_sec, configs->getUInt64("hive.metastore.cache_max_entries", 1024));
 }
 
 std::vector<std::string> HiveExternalCatalog::listDbNames()
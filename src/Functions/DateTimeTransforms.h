@@ -34,6 +34,7 @@
 #include <Functions/IFunction.h>
 #include <Functions/FunctionFactory.h>
 #include <Functions/extractTimeZoneFromFunctionArguments.h>
+#include <Common/TargetSpecific.h>
 #include <DataTypes/DataTypeString.h>
 #include <DataTypes/DataTypeDateTime.h>
 #include <DataTypes/DataTypeDateTime64.h>
@@ -388,6 +389,9 @@ struct ToStartOfMinuteImpl
         throwDate32IsNotSupported(name);
     }
 
+    /// Enables the vectorized batch rounding in Transformer (see there).
+    static constexpr UInt32 round_down_seconds = 60;
+
     using FactorTransform = ZeroTransform;
 };
 
@@ -586,6 +590,8 @@ struct ToStartOfFiveMinutesImpl
         throwDate32IsNotSupported(name);
     }
 
+    static constexpr UInt32 round_down_seconds = 5 * 60;
+
     using FactorTransform = ZeroTransform;
 };
 
@@ -618,6 +624,8 @@ struct ToStartOfTenMinutesImpl
         throwDate32IsNotSupported(name);
     }
 
+    static constexpr UInt32 round_down_seconds = 10 * 60;
+
     using FactorTransform = ZeroTransform;
 };
 
@@ -650,6 +658,8 @@ struct ToStartOfFifteenMinutesImpl
         throwDate32IsNotSupported(name);
     }
 
+    static constexpr UInt32 round_down_seconds = 15 * 60;
+
     using FactorTransform = ZeroTransform;
 };
 
@@ -731,6 +741,8 @@ struct ToStartOfHourImpl
         throwDate32IsNotSupported(name);
     }
 
+    static constexpr UInt32 round_down_seconds = 3600;
+
     using FactorTransform = ZeroTransform;
 };
 
@@ -1834,6 +1846,29 @@ struct ToDateTimeComponentsImpl
     using FactorTransform = ZeroTransform;
 };
 
+DECLARE_MULTITARGET_CODE(
+
+template <UInt32 divisor>
+void roundTimestampsDownBatch(const UInt32 * __restrict from, UInt32 * __restrict to, size_t size)
+{
+    /// Division by a compile-time constant is strength-reduced to a multiply and shift,
+    /// so the loop vectorizes with the full register width of the selected target.
+    for (size_t i = 0; i < size; ++i)
+        to[i] = from[i] / divisor * divisor;
+}
+
+) // DECLARE_MULTITARGET_CODE
+
+template <UInt32 divisor>
+void roundTimestampsDownBatch(const UInt32 * from, UInt32 * to, size_t size)
+{
+#if USE_MULTITARGET_CODE
+    if (isArchSupported(TargetArch::AVX2))
+        return TargetSpecific::AVX2::roundTimestampsDownBatch<divisor>(from, to, size);
+#endif
+    TargetSpecific::Default::roundTimestampsDownBatch<divisor>(from, to, size);
+}
+
 template <typename FromType, typename ToType, typename Transform, bool is_extended_result = false>
 struct Transformer
 {
@@ -1843,6 +1878,26 @@ struct Transformer
         size_t size = vec_from.size();
         vec_to.resize(size);
 
+        /// Time-bucket transforms dominating rollup queries round a DateTime down to a fixed
+        /// interval. When the timezone offset is aligned with that interval during the whole
+        /// epoch, the per-row DateLUT lookup degenerates to pure arithmetic which we run as a
+        /// vectorized batch kernel instead of the scalar loop.
+        if constexpr (
+            !is_extended_result && requires { Transform::round_down_seconds; }
+            && std::is_same_v<typename FromTypeVector::value_type, UInt32>
+            && std::is_same_v<typename ToTypeVector::value_type, UInt32>)
+        {
+            constexpr UInt32 divisor = Transform::round_down_seconds;
+            const bool offset_is_aligned = (divisor % 3600 == 0)
+                ? time_zone.offsetIsWholeNumberOfHoursDuringEpoch()
+                : time_zone.offsetIsWholeNumberOfMinutesDuringEpoch();
+            if (offset_is_aligned)
+            {
+                roundTimestampsDownBatch<divisor>(vec_from.data(), vec_to.data(), size);
+                return;
+            }
+        }
+
         for (size_t i = 0; i < size; ++i)
             if constexpr (is_extended_result)
                 vec_to[i] = transform.executeExtendedResult(vec_from[i], time_zone);
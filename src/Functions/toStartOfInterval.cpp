@@ -33,6 +33,10 @@
 #include <Functions/IFunction.h>
 #include <IO/WriteHelpers.h>
 
+#include <libdivide.h>
+
+#include <limits>
+
 
 namespace DB
 {
@@ -544,6 +548,47 @@ private:
 
         Int64 scale_multiplier = DecimalUtils::scaleMultiplier<DateTime64>(scale);
 
+        /// For sub-day intervals over DateTime the rounding is pure arithmetic whenever the
+        /// timezone offset stays aligned with the interval during the whole epoch — the same
+        /// conditions the scalar DateLUT helpers re-check per row. In that case run a batch
+        /// loop with libdivide, which turns the runtime divisor into a multiply so the loop
+        /// vectorizes instead of doing a LUT lookup per row.
+        if constexpr (
+            std::is_same_v<FromDataType, DataTypeDateTime>
+            && (unit == IntervalKind::Hour || unit == IntervalKind::Minute || unit == IntervalKind::Second))
+        {
+            Int64 divisor = 0;
+            bool offset_is_aligned = false;
+            if constexpr (unit == IntervalKind::Hour)
+            {
+                /// Longer hour intervals are rounded within each day and realign at offset
+                /// changes (see toStartOfHourInterval), so only the one-hour case is arithmetic.
+                divisor = num_units == 1 ? 3600 : 0;
+                offset_is_aligned = time_zone.offsetIsWholeNumberOfHoursDuringEpoch();
+            }
+            else if constexpr (unit == IntervalKind::Minute)
+            {
+                divisor = num_units <= std::numeric_limits<UInt32>::max() / 60 ? num_units * 60 : 0;
+                offset_is_aligned = time_zone.offsetIsWholeNumberOfMinutesDuringEpoch();
+            }
+            else
+            {
+                divisor = num_units;
+                offset_is_aligned = num_units % 60 == 0
+                    ? time_zone.offsetIsWholeNumberOfMinutesDuringEpoch()
+                    : time_zone.offsetIsWholeNumberOfHoursDuringEpoch();
+            }
+
+            if (divisor > 1 && divisor <= std::numeric_limits<UInt32>::max() && offset_is_aligned)
+            {
+                const UInt32 divisor32 = static_cast<UInt32>(divisor);
+                const libdivide::divider<UInt32> fast_divisor(divisor32);
+                for (size_t i = 0; i != size; ++i)
+                    result_data[i] = static_cast<ToFieldType>(time_data[i] / fast_divisor * divisor32);
+                return result_col;
+            }
+        }
+
         for (size_t i = 0; i != size; ++i)
             result_data[i] = static_cast<ToFieldType>(
                 Transform<unit>::execute(time_data[i], num_units, time_zone, scale_multiplier));
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2016-2023 ClickHouse, Inc.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * This file may have been modified by Bytedance Ltd. and/or its affiliates (“ Bytedance's Modifications”).
+ * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
+ */
+
+#include <cassert>
+#include <errno.h>
+
+#include <IO/AsynchronousReadBufferFromFileDescriptor.h>
+#include <IO/WriteHelpers.h>
+#include <Common/CurrentMetrics.h>
+#include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
+#include <Common/filesystemHelpers.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event AsynchronousReadWaitMicroseconds;
+}
+
+namespace CurrentMetrics
+{
+    extern const Metric AsynchronousReadWait;
+}
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int ARGUMENT_OUT_OF_BOUND;
+}
+
+
+std::string AsynchronousReadBufferFromFileDescriptor::getFileName() const
+{
+    return "(fd = " + toString(fd) + ")";
+}
+
+
+std::future<IAsynchronousReader::Result> AsynchronousReadBufferFromFileDescriptor::asyncReadInto(char * data, size_t size, Priority priority)
+{
+    IAsynchronousReader::Request request;
+    request.descriptor = std::make_shared<IAsynchronousReader::LocalFileDescriptor>(fd);
+    request.buf = data;
+    request.size = size;
+    request.offset = file_offset_of_buffer_end;
+    request.priority = Priority{base_priority.value + priority.value};
+    request.ignore = 0;
+    return reader->submit(request);
+}
+
+
+void AsynchronousReadBufferFromFileDescriptor::prefetch(Priority priority)
+{
+    if (prefetch_future.valid())
+        return;
+
+    /// Will request the same amount of data that is read in nextImpl.
+    prefetch_buffer.resize(internal_buffer.size());
+    prefetch_future = asyncReadInto(prefetch_buffer.data(), prefetch_buffer.size(), priority);
+}
+
+
+bool AsynchronousReadBufferFromFileDescriptor::nextImpl()
+{
+    IAsynchronousReader::Result result;
+    if (prefetch_future.valid())
+    {
+        /// Read request is already in flight. Wait for its completion.
+
+        CurrentMetrics::Increment metric_increment{CurrentMetrics::AsynchronousReadWait};
+        Stopwatch watch;
+        result = prefetch_future.get();
+        prefetch_future = {};
+        ProfileEvents::increment(ProfileEvents::AsynchronousReadWaitMicroseconds, watch.elapsedMicroseconds());
+
+        if (result.size)
+        {
+            prefetch_buffer.swap(memory);
+            /// Adjust the working buffer so that it ignores `offset` bytes.
+            internal_buffer = Buffer(memory.data(), memory.data() + memory.size());
+            working_buffer = Buffer(memory.data() + result.offset, memory.data() + result.size);
+            pos = working_buffer.begin();
+        }
+    }
+    else
+    {
+        /// No pending request. Do synchronous read.
+
+        result = asyncReadInto(memory.data(), memory.size(), Priority{}).get();
+
+        if (result.size)
+        {
+            /// Adjust the working buffer so that it ignores `offset` bytes.
+            internal_buffer = Buffer(memory.data(), memory.data() + memory.size());
+            working_buffer = Buffer(memory.data() + result.offset, memory.data() + result.size);
+            pos = working_buffer.begin();
+        }
+    }
+
+    file_offset_of_buffer_end += result.size;
+
+    if (throttler)
+        throttler->add(result.size - result.offset);
+
+    return result.size;
+}
+
+
+AsynchronousReadBufferFromFileDescriptor::AsynchronousReadBufferFromFileDescriptor(
+    AsynchronousReaderPtr reader_,
+    Priority priority_,
+    int fd_,
+    size_t buf_size,
+    char * existing_memory,
+    size_t alignment,
+    std::optional<size_t> file_size_,
+    ThrottlerPtr throttler_)
+    : ReadBufferFromFileBase(buf_size, existing_memory, alignment, file_size_)
+    , reader(std::move(reader_))
+    , base_priority(priority_)
+    , required_alignment(alignment)
+    , fd(fd_)
+    , throttler(throttler_)
+{
+    prefetch_buffer.alignment = alignment;
+}
+
+
+AsynchronousReadBufferFromFileDescriptor::~AsynchronousReadBufferFromFileDescriptor()
+{
+    /// Must wait for events in flight before potential destruction of the buffer they are reading to.
+    if (prefetch_future.valid())
+        prefetch_future.wait();
+}
+
+
+/// If 'offset' is small enough to stay in buffer after seek, then true seek in file does not happen.
+off_t AsynchronousReadBufferFromFileDescriptor::seek(off_t offset, int whence)
+{
+    size_t new_pos;
+    if (whence == SEEK_SET)
+    {
+        assert(offset >= 0);
+        new_pos = offset;
+    }
+    else if (whence == SEEK_CUR)
+    {
+        new_pos = file_offset_of_buffer_end - (working_buffer.end() - pos) + offset;
+    }
+    else
+    {
+        throw Exception("ReadBufferFromFileDescriptor::seek expects SEEK_SET or SEEK_CUR as whence", ErrorCodes::ARGUMENT_OUT_OF_BOUND);
+    }
+
+    /// Position is unchanged.
+    if (new_pos + (working_buffer.end() - pos) == file_offset_of_buffer_end)
+        return new_pos;
+
+    if (file_offset_of_buffer_end - working_buffer.size() <= new_pos
+        && new_pos <= file_offset_of_buffer_end)
+    {
+        /// Position is still inside the buffer.
+        pos = working_buffer.end() - file_offset_of_buffer_end + new_pos;
+        assert(pos >= working_buffer.begin());
+        assert(pos <= working_buffer.end());
+
+        return new_pos;
+    }
+    else
+    {
+        if (prefetch_future.valid())
+        {
+            prefetch_future.wait();
+            prefetch_future = {};
+        }
+
+        /// Position is out of the buffer, we need to do real seek.
+        off_t seek_pos = required_alignment > 1
+            ? new_pos / required_alignment * required_alignment
+            : new_pos;
+
+        /// First reset the buffer so the next read will fetch new data to the buffer.
+        resetWorkingBuffer();
+
+        /// Just update the info about the next position in file.
+
+        file_offset_of_buffer_end = seek_pos;
+        size_t offset_after_seek_pos = new_pos - seek_pos;
+
+        if (offset_after_seek_pos)
+            ignore(offset_after_seek_pos);
+
+        return new_pos;
+    }
+}
+
+
+void AsynchronousReadBufferFromFileDescriptor::rewind()
+{
+    if (prefetch_future.valid())
+    {
+        prefetch_future.wait();
+        prefetch_future = {};
+    }
+
+    /// Clearing the buffer with existing data. New data will be read on subsequent call to 'next'.
+    working_buffer.resize(0);
+    pos = working_buffer.begin();
+    file_offset_of_buffer_end = 0;
+}
+
+
+size_t AsynchronousReadBufferFromFileDescriptor::getFileSize()
+{
+    return getSizeFromFileDescriptor(fd, getFileName());
+}
+
+}
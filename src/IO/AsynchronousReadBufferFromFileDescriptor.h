@@ -0,0 +1,98 @@
+/*
+ * Copyright 2016-2023 ClickHouse, Inc.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * This file may have been modified by Bytedance Ltd. and/or its affiliates (“ Bytedance's Modifications”).
+ * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <IO/AsynchronousReader.h>
+#include <IO/ReadBufferFromFileBase.h>
+#include <Common/Throttler.h>
+
+#include <unistd.h>
+
+
+namespace DB
+{
+
+/** Use ready file descriptor. Does not open or close a file.
+  * All reads go through an IAsynchronousReader; prefetch() issues the next read
+  * into a second buffer while the current one is being consumed, so decompression
+  * and IO overlap.
+  */
+class AsynchronousReadBufferFromFileDescriptor : public ReadBufferFromFileBase
+{
+protected:
+    AsynchronousReaderPtr reader;
+    Priority base_priority;
+
+    Memory<> prefetch_buffer;
+    std::future<IAsynchronousReader::Result> prefetch_future;
+
+    const size_t required_alignment = 0; /// For O_DIRECT both file offsets and memory addresses have to be aligned.
+
+    size_t file_offset_of_buffer_end = 0; /// What offset in file corresponds to working_buffer.end().
+
+    int fd;
+
+    ThrottlerPtr throttler;
+
+    bool nextImpl() override;
+
+    /// Name or some description of file.
+    std::string getFileName() const override;
+
+public:
+    explicit AsynchronousReadBufferFromFileDescriptor(
+        AsynchronousReaderPtr reader_,
+        Priority priority_,
+        int fd_,
+        size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE,
+        char * existing_memory = nullptr,
+        size_t alignment = 0,
+        std::optional<size_t> file_size_ = std::nullopt,
+        ThrottlerPtr throttler_ = {});
+
+    ~AsynchronousReadBufferFromFileDescriptor() override;
+
+    void prefetch(Priority priority) override;
+
+    int getFD() const
+    {
+        return fd;
+    }
+
+    off_t getPosition() override { return file_offset_of_buffer_end - (working_buffer.end() - pos); }
+
+    /// If 'offset' is small enough to stay in buffer after seek, then true seek in file does not happen.
+    off_t seek(off_t off, int whence) override;
+
+    /// Seek to the beginning, discarding already read data if any. Useful to reread file that changes on every read.
+    void rewind();
+
+    size_t getFileSize() override;
+
+private:
+    /// Ordinary sync read when there is no prefetched data.
+    std::future<IAsynchronousReader::Result> asyncReadInto(char * data, size_t size, Priority priority);
+};
+
+}
@@ -0,0 +1,166 @@
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <optional>
+#include <vector>
+#include <IO/HedgedRemoteFSReader.h>
+#include <Interpreters/threadPoolCallbackRunner.h>
+#include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
+#include <Common/ThreadPool.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
+
+namespace ProfileEvents
+{
+    extern const Event HedgedRemoteReads;
+    extern const Event HedgedRemoteReadsWon;
+}
+
+namespace DB {
+
+namespace {
+
+// Everything an in-flight request touches, shared with the task so an abandoned
+// request stays valid until the straggling call returns
+struct ReadAttempt {
+    ReadAttempt(std::shared_ptr<RemoteFSReader> reader_, uint64_t size): reader(std::move(reader_)), scratch(size) {}
+
+    std::shared_ptr<RemoteFSReader> reader;
+    std::vector<char> scratch;
+};
+using ReadAttemptPtr = std::shared_ptr<ReadAttempt>;
+
+ThreadPool& getHedgedReadPool() {
+    // Shared by all readers, sized for blocking remote calls rather than cpu work
+    static ThreadPool pool(getNumberOfPhysicalCPUCores() * 4, getNumberOfPhysicalCPUCores() * 4, 10000);
+    return pool;
+}
+
+}
+
+HedgedRemoteFSReader::HedgedRemoteFSReader(std::unique_ptr<RemoteFSReader> reader,
+    const std::shared_ptr<RemoteFSReaderOpts>& reader_opts, const Options& options):
+        path_(reader->objectName()), reader_opts_(reader_opts), options_(options),
+        reader_(std::move(reader)) {}
+
+uint64_t HedgedRemoteFSReader::seek(uint64_t offset) {
+    // Applied lazily in ensureReaderPositioned, the reader may be replaced by a
+    // hedge winner before the next read anyway
+    logical_offset_ = offset;
+    return offset;
+}
+
+uint64_t HedgedRemoteFSReader::remain() const {
+    if (reader_ != nullptr && reader_->offset() == logical_offset_) {
+        return reader_->remain();
+    }
+    return 0;
+}
+
+void HedgedRemoteFSReader::ensureReaderPositioned() {
+    if (reader_ == nullptr) {
+        reader_ = reader_opts_->create(path_);
+    }
+    if (reader_->offset() != logical_offset_) {
+        reader_->seek(logical_offset_);
+    }
+}
+
+uint64_t HedgedRemoteFSReader::deadlineMs() const {
+    // Don't trust the estimate until a few reads completed, the first ones pay
+    // for connection setup
+    static constexpr size_t warm_up_samples = 3;
+    if (latency_samples_ < warm_up_samples) {
+        return options_.initial_deadline_ms;
+    }
+    return std::max(options_.min_deadline_ms,
+        ewma_latency_ms_ + options_.deadline_dev_multiplier * ewma_latency_dev_ms_);
+}
+
+void HedgedRemoteFSReader::recordLatency(uint64_t latency_ms) {
+    if (latency_samples_ == 0) {
+        ewma_latency_ms_ = latency_ms;
+    } else {
+        int64_t error = static_cast<int64_t>(latency_ms) - static_cast<int64_t>(ewma_latency_ms_);
+        int64_t deviation = error < 0 ? -error : error;
+        ewma_latency_dev_ms_ = static_cast<uint64_t>(static_cast<int64_t>(ewma_latency_dev_ms_)
+            + (deviation - static_cast<int64_t>(ewma_latency_dev_ms_)) / 4);
+        ewma_latency_ms_ = static_cast<uint64_t>(static_cast<int64_t>(ewma_latency_ms_) + error / 8);
+    }
+    ++latency_samples_;
+}
+
+uint64_t HedgedRemoteFSReader::read(char* buffer, uint64_t size) {
+    if (size == 0) {
+        return 0;
+    }
+
+    ensureReaderPositioned();
+
+    Stopwatch watch;
+    auto schedule = threadPoolCallbackRunner<uint64_t>(getHedgedReadPool(), "HedgedRead");
+
+    ReadAttemptPtr primary = std::make_shared<ReadAttempt>(std::move(reader_), size);
+    auto primary_future = schedule(
+        [primary] { return primary->reader->read(primary->scratch.data(), primary->scratch.size()); }, {});
+
+    auto finish = [&](const ReadAttemptPtr& winner, uint64_t readed) {
+        reader_ = std::move(winner->reader);
+        memcpy(buffer, winner->scratch.data(), readed);
+        logical_offset_ += readed;
+        recordLatency(watch.elapsedMilliseconds());
+        return readed;
+    };
+
+    std::chrono::milliseconds deadline(deadlineMs());
+    if (primary_future.wait_for(deadline) == std::future_status::ready) {
+        return finish(primary, primary_future.get());
+    }
+
+    // Primary exceeded the deadline, race it against a fresh reader at the same
+    // offset and take whichever response comes first
+    ProfileEvents::increment(ProfileEvents::HedgedRemoteReads);
+    ReadAttemptPtr hedge = std::make_shared<ReadAttempt>(reader_opts_->create(path_), size);
+    auto hedge_future = schedule(
+        [hedge, offset = logical_offset_] {
+            hedge->reader->seek(offset);
+            return hedge->reader->read(hedge->scratch.data(), hedge->scratch.size());
+        }, {});
+
+    std::optional<uint64_t> primary_readed;
+    std::optional<uint64_t> hedge_readed;
+    std::exception_ptr primary_error;
+    std::exception_ptr hedge_error;
+    static constexpr std::chrono::milliseconds poll_interval(1);
+    while (true) {
+        if (!primary_readed && !primary_error
+            && primary_future.wait_for(poll_interval) == std::future_status::ready) {
+            try {
+                primary_readed = primary_future.get();
+            } catch (...) {
+                primary_error = std::current_exception();
+            }
+        }
+        if (primary_readed) {
+            return finish(primary, *primary_readed);
+        }
+        if (!hedge_readed && !hedge_error
+            && hedge_future.wait_for(poll_interval) == std::future_status::ready) {
+            try {
+                hedge_readed = hedge_future.get();
+            } catch (...) {
+                hedge_error = std::current_exception();
+            }
+        }
+        if (hedge_readed) {
+            ProfileEvents::increment(ProfileEvents::HedgedRemoteReadsWon);
+            return finish(hedge, *hedge_readed);
+        }
+        if (primary_error && hedge_error) {
+            std::rethrow_exception(primary_error);
+        }
+    }
+}
+
+}
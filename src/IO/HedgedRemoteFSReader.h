@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <Core/Types.h>
+#include <IO/RemoteFSReader.h>
+
+namespace DB {
+
+// Tail-tolerant decorator over any RemoteFSReader: every read runs on a shared
+// thread pool and is given an adaptive deadline derived from the smoothed read
+// latency of this reader. If the deadline passes, a second reader is created
+// through the factory (another replica for HDFS, a fresh connection for S3),
+// positioned at the same offset, and whichever request finishes first wins.
+// The losing request is abandoned; its reader stays alive inside the task and
+// is destroyed once the straggling call returns.
+class HedgedRemoteFSReader: public RemoteFSReader {
+public:
+    struct Options {
+        // Deadline used until enough latency samples accumulated
+        uint64_t initial_deadline_ms = 5000;
+        // Lower bound of the adaptive deadline, hedging more often than this
+        // mostly duplicates load
+        uint64_t min_deadline_ms = 50;
+        // Deadline is smoothed latency plus this many mean deviations
+        uint64_t deadline_dev_multiplier = 4;
+    };
+
+    HedgedRemoteFSReader(std::unique_ptr<RemoteFSReader> reader,
+        const std::shared_ptr<RemoteFSReaderOpts>& reader_opts, const Options& options = {});
+
+    virtual String objectName() const override { return path_; }
+
+    virtual uint64_t read(char* buffer, uint64_t size) override;
+    virtual uint64_t seek(uint64_t offset) override;
+
+    virtual uint64_t offset() const override { return logical_offset_; }
+
+    virtual uint64_t remain() const override;
+
+private:
+    void ensureReaderPositioned();
+    uint64_t deadlineMs() const;
+    void recordLatency(uint64_t latency_ms);
+
+    String path_;
+    std::shared_ptr<RemoteFSReaderOpts> reader_opts_;
+    Options options_;
+
+    std::shared_ptr<RemoteFSReader> reader_;
+
+    uint64_t logical_offset_{0};
+
+    // Smoothed latency and mean deviation of completed reads, RFC 6298 style
+    size_t latency_samples_{0};
+    uint64_t ewma_latency_ms_{0};
+    uint64_t ewma_latency_dev_ms_{0};
+};
+
+// Wraps every reader created by the nested factory into a HedgedRemoteFSReader,
+// the nested factory also serves as the source of hedge readers
+struct HedgedRemoteFSReaderOpts: public RemoteFSReaderOpts {
+    HedgedRemoteFSReaderOpts(const std::shared_ptr<RemoteFSReaderOpts>& nested,
+        const HedgedRemoteFSReader::Options& options = {}):
+            nested_(nested), options_(options) {}
+
+    virtual std::unique_ptr<RemoteFSReader> create(const String& path) override {
+        return std::make_unique<HedgedRemoteFSReader>(nested_->create(path), nested_, options_);
+    }
+
+private:
+    std::shared_ptr<RemoteFSReaderOpts> nested_;
+    HedgedRemoteFSReader::Options options_;
+};
+
+}
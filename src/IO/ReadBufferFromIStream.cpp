@@ -31,8 +31,8 @@ bool ReadBufferFromIStream::nextImpl()
     return true;
 }
 
-ReadBufferFromIStream::ReadBufferFromIStream(std::istream & istr_, size_t size)
-    : BufferWithOwnMemory<ReadBuffer>(size), istr(istr_)
+ReadBufferFromIStream::ReadBufferFromIStream(std::istream & istr_, size_t size, char * existing_memory, size_t alignment)
+    : BufferWithOwnMemory<ReadBuffer>(size, existing_memory, alignment), istr(istr_)
 {
 }
 
@@ -17,7 +17,8 @@ private:
     bool nextImpl() override;
 
 public:
-    explicit ReadBufferFromIStream(std::istream & istr_, size_t size = DBMS_DEFAULT_BUFFER_SIZE);
+    explicit ReadBufferFromIStream(
+        std::istream & istr_, size_t size = DBMS_DEFAULT_BUFFER_SIZE, char * existing_memory = nullptr, size_t alignment = 0);
 };
 
 }
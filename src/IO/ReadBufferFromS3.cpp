@@ -347,7 +347,12 @@ std::unique_ptr<ReadBufferFromIStream> ReadBufferFromS3::initialize()
     read_result = sendRequest(offset, read_until_position ? std::make_optional(read_until_position) : std::nullopt);
 
     size_t buffer_size = use_external_buffer ? 0 : read_settings.remote_fs_buffer_size;
-    return std::make_unique<ReadBufferFromIStream>(read_result->GetBody(), buffer_size);
+    /// Lend the segment owned by this buffer's base class to the istream wrapper instead of
+    /// letting it allocate its own: `impl` is recreated on every retry, far seek and range
+    /// change, and without reuse each stream (re)initialization paid a buffer_size allocation
+    /// while the base segment sat idle (nextImpl repoints at impl's buffer anyway).
+    char * reuse_memory = use_external_buffer ? nullptr : memory.data();
+    return std::make_unique<ReadBufferFromIStream>(read_result->GetBody(), buffer_size, reuse_memory);
 }
 
 size_t ReadBufferFromS3::getFileSize()
@@ -383,6 +388,9 @@ Aws::S3::Model::GetObjectResult ReadBufferFromS3::sendRequest(size_t range_begin
             bucket, key, range_begin);
     }
 
+    if (read_settings.remote_request_throttler)
+        read_settings.remote_request_throttler->add(1);
+
     Stopwatch watch;
 
     ProfileEvents::increment(ProfileEvents::S3GetObject);
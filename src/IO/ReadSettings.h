@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <Core/Defines.h>
 #include <Core/SettingsEnums.h>
+#include <Common/Priority.h>
 #include <Common/Throttler.h>
 
 namespace DB
@@ -89,6 +90,10 @@ struct ReadSettings
     ThrottlerPtr remote_throttler;
     ThrottlerPtr local_throttler;
 
+    /// Request-rate throttler: charged one unit per remote storage request (S3 GetObject,
+    /// HDFS read call) instead of bytes, to smooth request bursts against shared buckets.
+    ThrottlerPtr remote_request_throttler;
+
     /// For trace all read requests in system table
     RemoteReadLog * remote_read_log = nullptr;
     /// Allow reader to provide additional context (e.g., stream name) for the request,
@@ -98,6 +103,9 @@ struct ReadSettings
     /// For 'read', 'pread' and 'pread_threadpool' methods.
     size_t aio_threshold = 0;
 
+    /// For 'pread_threadpool' method. Lower value means higher priority.
+    Priority priority;
+
     /// For 'mmap' method.
     size_t mmap_threshold = 0;
     MMappedFileCache * mmap_cache = nullptr;
@@ -109,15 +117,21 @@ struct ReadSettings
 
     bool zero_copy_read_from_cache = false;
 
+    /// Race a slow remote read against a second request through another replica/connection
+    bool remote_fs_enable_hedged_reads = false;
+
     bool byte_hdfs_pread = true;
     size_t filesystem_cache_max_download_size = (128UL * 1024 * 1024 * 1024);
     bool skip_download_if_exceeds_query_cache = true;
     size_t remote_read_min_bytes_for_seek = 3 * DBMS_DEFAULT_BUFFER_SIZE;
     DiskCacheMode disk_cache_mode {DiskCacheMode::AUTO};
+    /// Number of following disk cache segments to fetch with one remote read on a sequential cache miss.
+    size_t disk_cache_readahead_segments = 0;
 
     size_t parquet_decode_threads = 48;
 
     size_t filtered_ratio_to_use_skip_read = 0;
+    double prewhere_filter_selectivity_threshold = 0.6;
     /// Monitoring
     bool for_disk_s3 = false; // to choose which profile events should be incremented
 
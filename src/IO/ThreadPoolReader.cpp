@@ -0,0 +1,218 @@
+/*
+ * Copyright 2016-2023 ClickHouse, Inc.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * This file may have been modified by Bytedance Ltd. and/or its affiliates (“ Bytedance's Modifications”).
+ * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
+ */
+
+#include <IO/ThreadPoolReader.h>
+
+#include <Common/CurrentMetrics.h>
+#include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
+#include <Common/assert_cast.h>
+#include <Common/setThreadName.h>
+#include <Interpreters/threadPoolCallbackRunner.h>
+#include <common/errnoToString.h>
+
+#include <future>
+#include <memory>
+
+#include <errno.h>
+#include <unistd.h>
+
+#if defined(OS_LINUX)
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+/// We don't want to depend on fresh glibc or kernel headers.
+#ifndef RWF_NOWAIT
+#define RWF_NOWAIT 8
+#endif
+#endif
+
+
+namespace ProfileEvents
+{
+    extern const Event ThreadPoolReaderTaskMicroseconds;
+    extern const Event ThreadPoolReaderReadBytes;
+    extern const Event ThreadPoolReaderSubmit;
+    extern const Event ThreadPoolReaderScheduleMicroseconds;
+    extern const Event ThreadPoolReaderPageCacheHit;
+    extern const Event ThreadPoolReaderPageCacheHitBytes;
+    extern const Event ThreadPoolReaderPageCacheHitElapsedMicroseconds;
+    extern const Event ThreadPoolReaderPageCacheMiss;
+    extern const Event ThreadPoolReaderPageCacheMissBytes;
+    extern const Event ThreadPoolReaderPageCacheMissElapsedMicroseconds;
+}
+
+namespace CurrentMetrics
+{
+    extern const Metric Read;
+}
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_READ_FROM_FILE_DESCRIPTOR;
+}
+
+#if defined(OS_LINUX) && defined(SYS_preadv2)
+/// preadv2() with RWF_NOWAIT is supported since Linux 4.14; disabled forever after the first ENOSYS/EOPNOTSUPP.
+static std::atomic<bool> has_pread_nowait_support{true};
+#endif
+
+
+ThreadPoolReader::ThreadPoolReader(size_t pool_size, size_t queue_size_)
+    : pool(std::make_unique<ThreadPool>(pool_size, pool_size, queue_size_))
+{
+}
+
+std::future<IAsynchronousReader::Result> ThreadPoolReader::submit(Request request)
+{
+    int fd = assert_cast<const LocalFileDescriptor &>(*request.descriptor).fd;
+
+    /// Local files are random access, so the prefix to ignore is simply skipped by reading further.
+    size_t offset = request.offset + request.ignore;
+
+#if defined(OS_LINUX) && defined(SYS_preadv2)
+    /// Check if data is already in the page cache with preadv2(RWF_NOWAIT) syscall
+    /// and complete the request in the caller's thread if so: only reads that would
+    /// block on the device are scheduled on the pool.
+    if (has_pread_nowait_support.load(std::memory_order_relaxed))
+    {
+        Stopwatch watch(CLOCK_MONOTONIC);
+
+        std::promise<Result> promise;
+        std::future<Result> future = promise.get_future();
+
+        size_t bytes_read = 0;
+        while (!bytes_read)
+        {
+            struct iovec io_vec{.iov_base = request.buf, .iov_len = request.size};
+            ssize_t res = syscall(
+                SYS_preadv2, fd, &io_vec, 1,
+                static_cast<long>(offset), static_cast<long>(offset >> 32 >> 32), /// Assuming variant with 6 arguments (low and high part of offset).
+                RWF_NOWAIT);
+
+            if (!res)
+            {
+                /// The file has ended.
+                promise.set_value({0, 0});
+
+                watch.stop();
+                ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheHit);
+                ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheHitElapsedMicroseconds, watch.elapsedMicroseconds());
+
+                return future;
+            }
+
+            if (-1 == res)
+            {
+                if (errno == ENOSYS || errno == EOPNOTSUPP)
+                {
+                    /// No support for the syscall or the flag in the Linux kernel.
+                    has_pread_nowait_support.store(false, std::memory_order_relaxed);
+                    break;
+                }
+                else if (errno == EAGAIN)
+                {
+                    /// The data is not in the page cache, go the long way through the pool.
+                    break;
+                }
+                else if (errno == EINTR)
+                {
+                    continue;
+                }
+                else
+                {
+                    promise.set_exception(std::make_exception_ptr(ErrnoException(
+                        fmt::format("Cannot read from file {}, {}", fd,
+                            errnoToString(ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR, errno)),
+                        ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR, errno)));
+                    return future;
+                }
+            }
+            else
+            {
+                bytes_read += res;
+            }
+        }
+
+        if (bytes_read)
+        {
+            watch.stop();
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheHit);
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheHitBytes, bytes_read);
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheHitElapsedMicroseconds, watch.elapsedMicroseconds());
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderReadBytes, bytes_read);
+
+            promise.set_value({bytes_read, 0});
+            return future;
+        }
+    }
+#endif
+
+    ProfileEvents::increment(ProfileEvents::ThreadPoolReaderSubmit);
+    ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheMiss);
+
+    auto submit_watch = std::make_unique<Stopwatch>(CLOCK_REALTIME);
+    return scheduleFromThreadPool<Result>(
+        [request, fd, offset, submit_watch = std::move(submit_watch)]() -> Result {
+            setThreadName("ThreadPoolRead");
+            submit_watch->stop();
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderScheduleMicroseconds, submit_watch->elapsedMicroseconds());
+            CurrentMetrics::Increment metric_increment{CurrentMetrics::Read};
+
+            auto exec_watch = std::make_unique<Stopwatch>(CLOCK_REALTIME);
+
+            size_t bytes_read = 0;
+            while (!bytes_read)
+            {
+                ssize_t res = ::pread(fd, request.buf, request.size, offset);
+                if (!res)
+                    break;
+
+                if (-1 == res && errno != EINTR)
+                    throwFromErrno(fmt::format("Cannot read from file {}", fd), ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR);
+
+                if (res > 0)
+                    bytes_read += res;
+            }
+
+            exec_watch->stop();
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderTaskMicroseconds, exec_watch->elapsedMicroseconds());
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheMissElapsedMicroseconds, exec_watch->elapsedMicroseconds());
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderReadBytes, bytes_read);
+            ProfileEvents::increment(ProfileEvents::ThreadPoolReaderPageCacheMissBytes, bytes_read);
+
+            return Result{.size = bytes_read, .offset = 0, .execution_watch = std::move(exec_watch)};
+        },
+        *pool,
+        "ThreadPoolRead",
+        request.priority);
+}
+
+void ThreadPoolReader::wait()
+{
+    pool->wait();
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2016-2023 ClickHouse, Inc.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * This file may have been modified by Bytedance Ltd. and/or its affiliates (“ Bytedance's Modifications”).
+ * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
+ */
+
+#pragma once
+
+#include <IO/AsynchronousReader.h>
+#include <Common/ThreadPool.h>
+
+namespace DB
+{
+
+/** Perform reads from a local file descriptor in a thread pool of specified size.
+  *
+  * Before offloading a request to the pool, checks with preadv2(..., RWF_NOWAIT)
+  * whether the data already resides in the page cache; if so, the read completes
+  * in the caller's thread without any scheduling or inter-thread communication.
+  * Only reads that would actually block on the device pay for a pool thread,
+  * so many descriptors can be served concurrently by a bounded number of threads.
+  */
+class ThreadPoolReader final : public IAsynchronousReader
+{
+public:
+    ThreadPoolReader(size_t pool_size, size_t queue_size_);
+
+    std::future<Result> submit(Request request) override;
+
+    void wait() override;
+
+private:
+    std::unique_ptr<ThreadPool> pool;
+};
+
+}
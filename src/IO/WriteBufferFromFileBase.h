@@ -17,6 +17,11 @@ public:
 
     void sync() override = 0;
     virtual std::string getFileName() const = 0;
+
+    /// Tell the kernel the written data will not be read back soon, so its pages can be
+    /// dropped from the page cache instead of evicting hot data. Call after finalize().
+    /// No-op by default and on non-local files.
+    virtual void advisePageCacheDontNeed() {}
 };
 
 }
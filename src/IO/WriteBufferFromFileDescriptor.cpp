@@ -136,6 +136,17 @@ void WriteBufferFromFileDescriptor::sync()
 }
 
 
+void WriteBufferFromFileDescriptor::advisePageCacheDontNeed()
+{
+#if defined(OS_LINUX)
+    /// The advice silently skips dirty pages, so push the written range to disk first.
+    /// Advisory only: failures (e.g. fd is a pipe) are deliberately ignored.
+    ::sync_file_range(fd, 0, 0, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+}
+
+
 off_t WriteBufferFromFileDescriptor::seek(off_t offset, int whence)
 {
     off_t res = lseek(fd, offset, whence);
@@ -63,6 +63,8 @@ public:
 
     void sync() override;
 
+    void advisePageCacheDontNeed() override;
+
     off_t seek(off_t offset, int whence);
     off_t getPosition();
 
@@ -20,9 +20,11 @@
  */
 
 #include <IO/createReadBufferFromFileBase.h>
+#include <IO/AsynchronousReadBufferFromFile.h>
 #include <IO/ReadBufferFromFile.h>
 #include <IO/ReadBufferFromEmptyFile.h>
 #include <IO/MMapReadBufferFromFileWithCache.h>
+#include <Interpreters/Context.h>
 #include <Common/ProfileEvents.h>
 
 
@@ -140,21 +142,27 @@ std::unique_ptr<ReadBufferFromFileBase> createReadBufferFromFileBase(
 //             throw Exception(ErrorCodes::UNSUPPORTED_METHOD, "Read method io_uring is only supported in Linux");
 // #endif
 //         }
-        // else if (settings.local_fs_method == LocalFSReadMethod::pread_threadpool)
-        // {
-        //     auto & reader = getThreadPoolReader(FilesystemReaderType::ASYNCHRONOUS_LOCAL_FS_READER);
-        //     res = std::make_unique<AsynchronousReadBufferFromFileWithDescriptorsCache>(
-        //         reader,
-        //         settings.priority,
-        //         filename,
-        //         buffer_size,
-        //         actual_flags,
-        //         existing_memory,
-        //         buffer_alignment,
-        //         file_size,
-        //         settings.local_throttler,
-        //         use_external_buffer);
-        // }
+        else if (settings.local_fs_method == LocalFSReadMethod::pread_threadpool)
+        {
+            auto global_context = Context::getGlobalContextInstance();
+            if (!global_context)
+                throw Exception(ErrorCodes::LOGICAL_ERROR, "Cannot obtain local thread pool reader (global context not initialized)");
+
+            res = std::make_unique<AsynchronousReadBufferFromFileWithDescriptorsCache>(
+                global_context->getLocalThreadPoolReader(),
+                settings.priority,
+                filename,
+                buffer_size,
+                actual_flags,
+                existing_memory,
+                buffer_alignment,
+                file_size,
+                settings.local_throttler);
+        }
+        else if (settings.local_fs_method == LocalFSReadMethod::io_uring)
+        {
+            throw Exception(ErrorCodes::UNSUPPORTED_METHOD, "Read method io_uring is not supported in this build");
+        }
         else
             throw Exception(ErrorCodes::LOGICAL_ERROR, "Unknown read method");
 
@@ -0,0 +1,114 @@
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <thread>
+#include <gtest/gtest.h>
+#include <IO/HedgedRemoteFSReader.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/WriteBufferFromFile.h>
+
+namespace DB {
+namespace {
+
+String randomData(size_t length) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_int_distribution<int> dist('a', 'z');
+    String str(length, '\0');
+    for (auto& ch : str) {
+        ch = static_cast<char>(dist(re));
+    }
+    return str;
+}
+
+class FixedDelayReader: public RemoteFSReader {
+public:
+    FixedDelayReader(const String& path, size_t delay_ms): delay_ms_(delay_ms), in_(path) {}
+
+    virtual String objectName() const override { return in_.getFileName(); }
+
+    virtual uint64_t read(char* buffer, uint64_t size) override {
+        if (delay_ms_ > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms_));
+        }
+        return in_.readBig(buffer, size);
+    }
+
+    virtual uint64_t seek(uint64_t offset) override { return in_.seek(offset, SEEK_SET); }
+
+    virtual uint64_t offset() const override { return in_.offset(); }
+
+    virtual uint64_t remain() const override { return 0; }
+
+private:
+    size_t delay_ms_;
+    ReadBufferFromFile in_;
+};
+
+// First created reader delays every read, the hedge reader is fast, so once a
+// hedge request is issued it always wins
+struct SlowFirstReaderOpts: public RemoteFSReaderOpts {
+    explicit SlowFirstReaderOpts(size_t first_reader_delay_ms): delay_ms_(first_reader_delay_ms) {}
+
+    virtual std::unique_ptr<RemoteFSReader> create(const String& path) override {
+        return std::make_unique<FixedDelayReader>(path, created_++ == 0 ? delay_ms_ : 0);
+    }
+
+    size_t delay_ms_;
+    size_t created_{0};
+};
+
+struct TemporaryDataFile {
+    TemporaryDataFile(size_t size): path("/tmp/gtest_hedged_reader_" + randomData(8)), data(randomData(size)) {
+        WriteBufferFromFile out(path);
+        out.write(data.data(), data.size());
+        out.finalize();
+    }
+
+    ~TemporaryDataFile() { std::filesystem::remove(path); }
+
+    String path;
+    String data;
+};
+
+}
+
+TEST(HedgedRemoteFSReaderTest, ReadAndSeek) {
+    TemporaryDataFile file(64 * 1024);
+
+    HedgedRemoteFSReaderOpts opts(std::make_shared<SlowFirstReaderOpts>(0));
+    std::unique_ptr<RemoteFSReader> reader = opts.create(file.path);
+
+    String buffer(file.data.size(), '\0');
+    ASSERT_EQ(reader->read(buffer.data(), buffer.size()), file.data.size());
+    ASSERT_EQ(buffer, file.data);
+    ASSERT_EQ(reader->offset(), file.data.size());
+
+    ASSERT_EQ(reader->seek(1024), 1024);
+    String fragment(512, '\0');
+    ASSERT_EQ(reader->read(fragment.data(), fragment.size()), 512);
+    ASSERT_EQ(fragment, file.data.substr(1024, 512));
+}
+
+TEST(HedgedRemoteFSReaderTest, HedgeWinsOnSlowPrimary) {
+    TemporaryDataFile file(4 * 1024);
+
+    auto slow_first_opts = std::make_shared<SlowFirstReaderOpts>(2000);
+    HedgedRemoteFSReader::Options options;
+    options.initial_deadline_ms = 50;
+    HedgedRemoteFSReaderOpts opts(slow_first_opts, options);
+    std::unique_ptr<RemoteFSReader> reader = opts.create(file.path);
+
+    String buffer(1024, '\0');
+    ASSERT_EQ(reader->read(buffer.data(), buffer.size()), 1024);
+    ASSERT_EQ(buffer, file.data.substr(0, 1024));
+    // The slow primary exceeded the deadline, a hedge reader must have been created
+    ASSERT_EQ(slow_first_opts->created_, 2);
+
+    // The fast hedge winner was adopted, the next read should not hedge again
+    ASSERT_EQ(reader->read(buffer.data(), buffer.size()), 1024);
+    ASSERT_EQ(buffer, file.data.substr(1024, 1024));
+    ASSERT_EQ(slow_first_opts->created_, 2);
+}
+
+}
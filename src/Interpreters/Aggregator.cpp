@@ -19,7 +19,9 @@
  * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
  */
 
+#include <algorithm>
 #include <future>
+#include <numeric>
 #include <Poco/Util/Application.h>
 #include "Disks/TemporaryFileOnDisk.h"
 
@@ -94,6 +96,74 @@ AggregatedDataVariants::~AggregatedDataVariants()
 }
 
 
+std::optional<HashTablesStatistics::Entry> HashTablesStatistics::getSizeHint(const StatsCollectingParams & params)
+{
+    if (!params.isCollectionAndUseEnabled())
+        throw Exception("Collection and use of the statistics should be enabled.", ErrorCodes::LOGICAL_ERROR);
+
+    std::lock_guard lock(mutex);
+    const auto cache = getHashTableStatsCache(params, lock);
+    if (const auto hint = cache->get(params.key))
+    {
+        LOG_DEBUG(
+            &Poco::Logger::get("HashTablesStatistics"),
+            "An entry for key={} found in cache: sum_of_sizes={}, median_size={}",
+            params.key,
+            hint->sum_of_sizes,
+            hint->median_size);
+        return *hint;
+    }
+    return std::nullopt;
+}
+
+void HashTablesStatistics::update(size_t sum_of_sizes, size_t median_size, const StatsCollectingParams & params)
+{
+    if (!params.isCollectionAndUseEnabled())
+        throw Exception("Collection and use of the statistics should be enabled.", ErrorCodes::LOGICAL_ERROR);
+
+    std::lock_guard lock(mutex);
+    const auto cache = getHashTableStatsCache(params, lock);
+    const auto hint = cache->get(params.key);
+    /// Keep the maximum of the observed values until a new observation is much lower (that likely indicates some change).
+    if (!hint || sum_of_sizes < hint->sum_of_sizes / 2 || hint->sum_of_sizes < sum_of_sizes || hint->median_size < median_size)
+    {
+        LOG_DEBUG(
+            &Poco::Logger::get("HashTablesStatistics"),
+            "Statistics updated for key={}: new sum_of_sizes={}, median_size={}",
+            params.key,
+            sum_of_sizes,
+            median_size);
+        cache->set(params.key, std::make_shared<Entry>(Entry{.sum_of_sizes = sum_of_sizes, .median_size = median_size}));
+    }
+}
+
+HashTablesStatistics::CachePtr HashTablesStatistics::getHashTableStatsCache(const StatsCollectingParams & params, const std::lock_guard<std::mutex> &)
+{
+    if (!hash_table_stats || hash_table_stats->maxSize() != params.max_entries_for_hash_table_stats)
+        hash_table_stats = std::make_shared<Cache>(params.max_entries_for_hash_table_stats);
+    return hash_table_stats;
+}
+
+HashTablesStatistics & getHashTablesStatistics()
+{
+    static HashTablesStatistics hash_tables_stats;
+    return hash_tables_stats;
+}
+
+void updateStatistics(const ManyAggregatedDataVariants & data_variants, const StatsCollectingParams & params)
+{
+    if (!params.isCollectionAndUseEnabled())
+        return;
+
+    std::vector<size_t> sizes(data_variants.size());
+    for (size_t i = 0; i < data_variants.size(); ++i)
+        sizes[i] = data_variants[i]->size();
+    const auto median_size = sizes.begin() + sizes.size() / 2; // not precisely though...
+    std::nth_element(sizes.begin(), median_size, sizes.end());
+    const auto sum_of_sizes = std::accumulate(sizes.begin(), sizes.end(), 0ull);
+    getHashTablesStatistics().update(sum_of_sizes, *median_size, params);
+}
+
 void AggregatedDataVariants::convertToTwoLevel()
 {
     if (aggregator)
@@ -860,6 +930,70 @@ void NO_INLINE Aggregator::executeImplBatch(
         }
     }
 
+    /// Optimization for the common GROUP BY over one numeric key (UInt64, Date and alike)
+    /// with a few cheap aggregates such as sum/count/min/max: fuse key emplacement and the
+    /// aggregate add loops into a single pass over the block through the functions' static
+    /// add pointers, instead of materializing the places array and walking it once per
+    /// aggregate function.
+    if constexpr (!no_more_keys && !use_compiled_functions
+        && (std::is_same_v<Method, typename decltype(AggregatedDataVariants::key16)::element_type>
+            || std::is_same_v<Method, typename decltype(AggregatedDataVariants::key32)::element_type>
+            || std::is_same_v<Method, typename decltype(AggregatedDataVariants::key64)::element_type>
+            || std::is_same_v<Method, typename decltype(AggregatedDataVariants::key16_two_level)::element_type>
+            || std::is_same_v<Method, typename decltype(AggregatedDataVariants::key32_two_level)::element_type>
+            || std::is_same_v<Method, typename decltype(AggregatedDataVariants::key64_two_level)::element_type>))
+    {
+        static constexpr size_t max_fused_aggregates = 3;
+
+        size_t num_instructions = 0;
+        bool can_fuse = true;
+        for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
+        {
+            ++num_instructions;
+            /// Functions with -Array combinator need per-row offsets, functions with heavy
+            /// arena-backed states (uniqExact and alike) profit from staying in their own
+            /// batch loop instead of alternating with the others per row.
+            if (inst->offsets || inst->batch_that->allocatesMemoryInArena() || num_instructions > max_fused_aggregates)
+            {
+                can_fuse = false;
+                break;
+            }
+        }
+
+        if (can_fuse)
+        {
+            IAggregateFunction::AddFunc add_functions[max_fused_aggregates];
+            for (size_t j = 0; j < num_instructions; ++j)
+                add_functions[j] = aggregate_instructions[j].batch_that->getAddressOfAddFunction();
+
+            for (size_t i = 0; i < rows; ++i)
+            {
+                auto emplace_result = state.emplaceKey(method.data, i, *aggregates_pool);
+
+                AggregateDataPtr aggregate_data;
+                if (emplace_result.isInserted())
+                {
+                    /// exception-safety - if you can not allocate memory or create states, then destructors will not be called.
+                    emplace_result.setMapped(nullptr);
+
+                    aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+                    createAggregateStates(aggregate_data);
+
+                    emplace_result.setMapped(aggregate_data);
+                }
+                else
+                    aggregate_data = emplace_result.getMapped();
+
+                for (size_t j = 0; j < num_instructions; ++j)
+                {
+                    const auto & inst = aggregate_instructions[j];
+                    add_functions[j](inst.batch_that, aggregate_data + inst.state_offset, inst.batch_arguments, i, aggregates_pool);
+                }
+            }
+            return;
+        }
+    }
+
     std::unique_ptr<AggregateDataPtr[]> places(new AggregateDataPtr[rows]);
 
     /// For all rows.
@@ -1063,6 +1197,70 @@ void Aggregator::prepareAggregateInstructions(Columns columns, AggregateColumns
 }
 
 
+namespace
+{
+AggregatedDataVariants::Type convertToTwoLevelTypeIfPossible(AggregatedDataVariants::Type type)
+{
+    using Type = AggregatedDataVariants::Type;
+    switch (type)
+    {
+    #define M(NAME) \
+        case Type::NAME: \
+            return Type::NAME ## _two_level;
+
+        APPLY_FOR_VARIANTS_CONVERTIBLE_TO_TWO_LEVEL(M)
+
+    #undef M
+
+        default:
+            return type;
+    }
+}
+}
+
+void Aggregator::initDataVariantsWithSizeHint(
+    AggregatedDataVariants & result, AggregatedDataVariants::Type method, const Params & params_) const
+{
+    const auto & stats_collecting_params = params_.stats_collecting_params;
+    if (stats_collecting_params.isCollectionAndUseEnabled())
+    {
+        if (auto hint = getHashTablesStatistics().getSizeHint(stats_collecting_params))
+        {
+            const auto max_threads = params_.max_threads ? params_.max_threads : 1;
+            const auto lower_limit = hint->sum_of_sizes / max_threads;
+            const auto upper_limit = stats_collecting_params.max_size_to_preallocate_for_aggregation / max_threads;
+            if (hint->median_size <= upper_limit)
+            {
+                const auto size_hint = std::min(std::max(lower_limit, hint->median_size), upper_limit);
+                /// If the aggregation is expected to grow beyond the two-level threshold anyway,
+                /// create the hash table as two-level right away and skip the conversion.
+                if (params_.two_level_mode != Params::TwoLevelMode::ENFORCE_SINGLE_LEVEL && params_.group_by_two_level_threshold
+                    && hint->sum_of_sizes >= params_.group_by_two_level_threshold)
+                    method = convertToTwoLevelTypeIfPossible(method);
+                result.init(method, size_hint);
+                return;
+            }
+            /// Otherwise we cannot afford to preallocate as much as the hint suggests, and at least one
+            /// resize is likely to happen anyway, so do not waste the memory on a preallocation.
+        }
+    }
+
+    /// No usable runtime statistics: fall back to the optimizer cardinality estimate, if any.
+    /// Besides pre-sizing, start two-level right away when the estimate says the conversion
+    /// threshold will be crossed anyway, so the mid-query rehash is avoided entirely.
+    if (params_.estimated_keys)
+    {
+        const auto max_threads = params_.max_threads ? params_.max_threads : 1;
+        if (params_.two_level_mode != Params::TwoLevelMode::ENFORCE_SINGLE_LEVEL && params_.group_by_two_level_threshold
+            && params_.estimated_keys >= params_.group_by_two_level_threshold)
+            method = convertToTwoLevelTypeIfPossible(method);
+        result.init(method, std::max<size_t>(params_.estimated_keys / max_threads, 1));
+        return;
+    }
+
+    result.init(method);
+}
+
 bool Aggregator::executeOnBlock(const Block & block, AggregatedDataVariants & result,
                                 ColumnRawPtrs & key_columns, AggregateColumns & aggregate_columns, bool & no_more_keys) const
 {
@@ -1080,7 +1278,7 @@ bool Aggregator::executeOnBlock(Columns columns, UInt64 num_rows, AggregatedData
     /// How to perform the aggregation?
     if (result.empty())
     {
-        result.init(method_chosen);
+        initDataVariantsWithSizeHint(result, method_chosen, params);
         result.keys_size = params.keys_size;
         result.key_sizes = key_sizes;
         LOG_TRACE(log, "Aggregation method: {}", result.getMethodName());
@@ -1976,6 +2174,12 @@ BlocksList Aggregator::convertToBlocks(AggregatedDataVariants & data_variants, b
     if (data_variants.empty())
         return blocks;
 
+    if (params.stats_collecting_params.isCollectionAndUseEnabled())
+    {
+        const auto size = data_variants.sizeWithoutOverflowRow();
+        getHashTablesStatistics().update(size, size, params.stats_collecting_params);
+    }
+
     std::unique_ptr<ThreadPool> thread_pool;
     if (max_threads > 1 && data_variants.sizeWithoutOverflowRow() > 100000  /// TODO Make a custom threshold.
         && data_variants.isTwoLevel())                      /// TODO Use the shared thread pool with the `merge` function.
@@ -2302,6 +2506,9 @@ ManyAggregatedDataVariants Aggregator::prepareVariantsToMerge(ManyAggregatedData
 
     LOG_TRACE(log, "Merging aggregated data");
 
+    if (params.stats_collecting_params.isCollectionAndUseEnabled())
+        updateStatistics(data_variants, params.stats_collecting_params);
+
     ManyAggregatedDataVariants non_empty_data;
     non_empty_data.reserve(data_variants.size());
     for (auto & data : data_variants)
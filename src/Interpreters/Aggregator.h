@@ -37,6 +37,7 @@
 
 #include <Common/ThreadPool.h>
 #include <Common/ColumnsHashing.h>
+#include <Common/LRUCache.h>
 #include <Common/assert_cast.h>
 #include <Common/filesystemHelpers.h>
 
@@ -679,7 +680,8 @@ struct AggregatedDataVariants : private boost::noncopyable
 
     ~AggregatedDataVariants();
 
-    void init(Type type_)
+    /// If size_hint is set, hash tables are created with enough buckets for that many keys right away.
+    void init(Type type_, std::optional<size_t> size_hint = std::nullopt)
     {
         switch (type_)
         {
@@ -687,7 +689,11 @@ struct AggregatedDataVariants : private boost::noncopyable
             case Type::without_key: break;
 
         #define M(NAME, IS_TWO_LEVEL) \
-            case Type::NAME: NAME = std::make_unique<decltype(NAME)::element_type>(); break;
+            case Type::NAME: \
+                NAME = std::make_unique<decltype(NAME)::element_type>(); \
+                if (size_hint) \
+                    (NAME)->data.reserve(*size_hint); \
+                break;
             APPLY_FOR_AGGREGATED_VARIANTS(M)
         #undef M
         }
@@ -937,6 +943,62 @@ class CompiledAggregateFunctionsHolder;
 class Context;
 using ContextPtr = std::shared_ptr<const Context>;
 
+/** Identifies a recurring aggregation in the cache of observed hash table sizes,
+  *  see HashTablesStatistics. Zero key disables both collection and use of the statistics.
+  */
+struct StatsCollectingParams
+{
+    StatsCollectingParams() = default;
+
+    StatsCollectingParams(UInt64 key_, size_t max_entries_for_hash_table_stats_, size_t max_size_to_preallocate_for_aggregation_)
+        : key(key_)
+        , max_entries_for_hash_table_stats(max_entries_for_hash_table_stats_)
+        , max_size_to_preallocate_for_aggregation(max_size_to_preallocate_for_aggregation_)
+    {
+    }
+
+    bool isCollectionAndUseEnabled() const { return key != 0; }
+    void disable() { key = 0; }
+
+    UInt64 key = 0;
+    size_t max_entries_for_hash_table_stats = 0;
+    size_t max_size_to_preallocate_for_aggregation = 0;
+};
+
+/** Collects the sizes of the hash tables observed when an aggregation finishes, so that the next
+  *  run of the same aggregation (e.g. a periodic refresh of a materialized view) can create its
+  *  hash tables with the right capacity from the start instead of growing them resize by resize.
+  */
+class HashTablesStatistics
+{
+public:
+    struct Entry
+    {
+        size_t sum_of_sizes; /// Used to determine whether it's worth creating the hash tables as two-level from the start.
+        size_t median_size;  /// Roughly the size to preallocate on each of the threads.
+    };
+
+    using Cache = LRUCache<UInt64, Entry>;
+    using CachePtr = std::shared_ptr<Cache>;
+
+    /// Returns the sizes observed on the previous run of the aggregation identified by params.key, if any.
+    std::optional<Entry> getSizeHint(const StatsCollectingParams & params);
+
+    /// Remembers the sizes observed on the current run of the aggregation identified by params.key.
+    void update(size_t sum_of_sizes, size_t median_size, const StatsCollectingParams & params);
+
+private:
+    CachePtr getHashTableStatsCache(const StatsCollectingParams & params, const std::lock_guard<std::mutex> &);
+
+    std::mutex mutex;
+    CachePtr hash_table_stats;
+};
+
+HashTablesStatistics & getHashTablesStatistics();
+
+/// Collect hash table sizes of the given variants to be used as a preallocation hint for the next run of the same aggregation.
+void updateStatistics(const ManyAggregatedDataVariants & data_variants, const StatsCollectingParams & params);
+
 /** How are "total" values calculated with WITH TOTALS?
   * (For more details, see TotalsHavingTransform.)
   *
@@ -1016,6 +1078,14 @@ public:
         // this field is determined when build pipeline, thus it doesn't need to be serialized.
         TwoLevelMode two_level_mode = TwoLevelMode::ADAPTIVE;
 
+        // this field is determined when build pipeline, thus it doesn't need to be serialized.
+        StatsCollectingParams stats_collecting_params;
+
+        /// Estimated number of groups from the optimizer, 0 if unknown. Used to pre-size hash
+        /// tables when no runtime statistics are available for this aggregation.
+        /// This field is determined when build pipeline, thus it doesn't need to be serialized.
+        size_t estimated_keys = 0;
+
         const bool enable_lc_group_by_opt;
 
         Params(
@@ -1174,6 +1244,7 @@ private:
     friend class ConvertingAggregatedToChunksTransform;
     friend class ConvertingAggregatedToChunksSource;
     friend class AggregatingInOrderTransform;
+    friend class AdaptiveAggregatingTransform;
 
     Params params;
 
@@ -1238,6 +1309,12 @@ private:
     /** Select the aggregation method based on the number and types of keys. */
     AggregatedDataVariants::Type chooseAggregationMethod();
 
+    /** Initialize the hash tables, preallocating them to the size observed on the previous run
+      *  of the same aggregation when the statistics collection is enabled.
+      */
+    void initDataVariantsWithSizeHint(
+        AggregatedDataVariants & result, AggregatedDataVariants::Type method, const Params & params_) const;
+
     /** Create states of aggregate functions for one key.
       */
     template <bool skip_compiled_aggregate_functions = false>
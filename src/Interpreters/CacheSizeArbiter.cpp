@@ -0,0 +1,125 @@
+#include <Interpreters/CacheSizeArbiter.h>
+
+#include <Interpreters/Context.h>
+#include <Common/Exception.h>
+#include <Common/formatReadable.h>
+#include <common/logger_useful.h>
+
+#include <optional>
+
+
+namespace DB
+{
+
+CacheSizeArbiter::CacheSizeArbiter(ContextPtr context_, Int32 update_period_seconds_)
+    : WithContext(context_)
+    , update_period_seconds(update_period_seconds_)
+    , pool(getContext()->getSchedulePool())
+    , log(&Poco::Logger::get("CacheSizeArbiter"))
+{
+    task_handle = pool.createTask("CacheSizeArbiter", [this] { run(); });
+}
+
+void CacheSizeArbiter::start()
+{
+    /// Snapshot the counters so that the first round measures its own period only.
+    for (auto & entry : caches)
+        entry.get_stats(entry.last_hits, entry.last_misses);
+
+    LOG_INFO(log, "Rebalancing {} caches every {} seconds", caches.size(), update_period_seconds);
+    task_handle->activateAndSchedule();
+}
+
+CacheSizeArbiter::~CacheSizeArbiter()
+{
+    task_handle->deactivate();
+}
+
+void CacheSizeArbiter::run()
+{
+    try
+    {
+        rebalance();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+
+    task_handle->scheduleAfter(size_t(update_period_seconds) * 1000);
+}
+
+void CacheSizeArbiter::rebalance()
+{
+    if (caches.size() < 2)
+        return;
+
+    size_t total_budget = 0;
+    std::vector<double> hit_density(caches.size());
+    std::vector<double> miss_density(caches.size());
+    std::vector<bool> full(caches.size());
+
+    for (size_t i = 0; i < caches.size(); ++i)
+    {
+        auto & entry = caches[i];
+        size_t hits = 0;
+        size_t misses = 0;
+        entry.get_stats(hits, misses);
+        /// Counters restart from zero when the cache is dropped via SYSTEM DROP ... CACHE.
+        size_t delta_hits = hits >= entry.last_hits ? hits - entry.last_hits : hits;
+        size_t delta_misses = misses >= entry.last_misses ? misses - entry.last_misses : misses;
+        entry.last_hits = hits;
+        entry.last_misses = misses;
+
+        size_t capacity = entry.max_size();
+        total_budget += capacity;
+        hit_density[i] = static_cast<double>(delta_hits) / capacity;
+        miss_density[i] = static_cast<double>(delta_misses) / capacity;
+        /// Extra bytes pay off only once the cache is evicting; below that every miss is
+        /// compulsory and a larger capacity would not have prevented it.
+        full[i] = entry.weight() + capacity / 10 >= capacity;
+    }
+
+    /// Recipient: the full cache whose capacity shortage costs the most misses per byte.
+    /// Donor: the cache producing the fewest hits per byte while still above its floor.
+    std::optional<size_t> recipient;
+    for (size_t i = 0; i < caches.size(); ++i)
+        if (full[i] && miss_density[i] > 0 && (!recipient || miss_density[i] > miss_density[*recipient]))
+            recipient = i;
+    if (!recipient)
+        return;
+
+    std::optional<size_t> donor;
+    for (size_t i = 0; i < caches.size(); ++i)
+        if (i != *recipient && caches[i].max_size() > caches[i].min_size
+            && (!donor || hit_density[i] < hit_density[*donor]))
+            donor = i;
+    if (!donor)
+        return;
+
+    /// Move budget only while a byte is expected to absorb more misses at the recipient
+    /// than the hits it currently serves at the donor; equal densities mean the split
+    /// has converged for this workload.
+    if (miss_density[*recipient] <= hit_density[*donor])
+        return;
+
+    size_t donor_capacity = caches[*donor].max_size();
+    size_t step = std::min(total_budget / 20, donor_capacity - caches[*donor].min_size);
+    if (!step)
+        return;
+
+    /// Shrink before growing so the combined footprint never exceeds the budget.
+    caches[*donor].set_max_size(donor_capacity - step);
+    caches[*recipient].set_max_size(caches[*recipient].max_size() + step);
+
+    LOG_DEBUG(
+        log,
+        "Moved {} of cache budget from {} ({} hits/byte) to {} ({} misses/byte)",
+        formatReadableSizeWithBinarySuffix(step),
+        caches[*donor].name,
+        hit_density[*donor],
+        caches[*recipient].name,
+        miss_density[*recipient]);
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Core/BackgroundSchedulePool.h>
+#include <Core/Types.h>
+#include <Interpreters/Context_fwd.h>
+
+#include <functional>
+#include <vector>
+
+
+namespace DB
+{
+
+/// Periodically moves capacity between the in-memory LRU caches (mark cache, uncompressed
+/// cache, primary index cache) inside one fixed overall budget. Each round compares the
+/// caches' per-byte hit and miss densities since the previous round and shifts a bounded
+/// step of budget from the cache getting the least out of its bytes to a full cache that
+/// is still missing, so the split between lookup-heavy and scan-heavy capacity follows the
+/// workload instead of the static config.
+class CacheSizeArbiter : WithContext
+{
+public:
+    CacheSizeArbiter(ContextPtr context_, Int32 update_period_seconds_);
+    ~CacheSizeArbiter();
+
+    /// Register a cache before start(). `min_size` is a floor the arbiter never shrinks
+    /// the cache below, so one idle cache cannot be starved to nothing.
+    template <typename Cache>
+    void addCache(const String & name, const std::shared_ptr<Cache> & cache, size_t min_size)
+    {
+        Entry entry;
+        entry.name = name;
+        entry.min_size = std::max<size_t>(min_size, 1);
+        entry.weight = [cache] { return cache->weight(); };
+        entry.max_size = [cache] { return cache->maxSize(); };
+        entry.set_max_size = [cache](size_t size) { cache->setMaxSize(size); };
+        entry.get_stats = [cache](size_t & hits, size_t & misses) { cache->getStats(hits, misses); };
+        caches.push_back(std::move(entry));
+    }
+
+    void start();
+
+private:
+    struct Entry
+    {
+        String name;
+        size_t min_size = 1;
+        std::function<size_t()> weight;
+        std::function<size_t()> max_size;
+        std::function<void(size_t)> set_max_size;
+        std::function<void(size_t &, size_t &)> get_stats;
+        /// Counter values at the end of the previous round, to compute per-round deltas.
+        size_t last_hits = 0;
+        size_t last_misses = 0;
+    };
+
+    void run();
+    void rebalance();
+
+    Int32 update_period_seconds;
+    std::vector<Entry> caches;
+
+    BackgroundSchedulePool & pool;
+    BackgroundSchedulePoolTaskHolder task_handle;
+    Poco::Logger * log;
+};
+
+}
@@ -67,6 +67,7 @@
 #include <Interpreters/ActionLocksManager.h>
 #include <Interpreters/Cache/QueryCache.h>
 #include <Interpreters/Cluster.h>
+#include <Interpreters/DistributedStages/PlanSegmentResultCache.h>
 #include <Interpreters/CnchQueryMetrics/QueryMetricLog.h>
 #include <Interpreters/CnchQueryMetrics/QueryWorkerMetricLog.h>
 #include <Interpreters/CnchSystemLog.h>
@@ -125,6 +126,7 @@
 #include <Storages/HDFS/HDFSFileSystem.h>
 #include <Storages/IStorage.h>
 #include <Storages/MarkCache.h>
+#include <DataTypes/LowCardinalityDictionaryCache.h>
 #include <Storages/MergeTree/BackgroundJobsExecutor.h>
 #include <Storages/MergeTree/ChecksumsCache.h>
 #include <Storages/MergeTree/GinIndexStore.h>
@@ -197,7 +199,9 @@
 #include <Processors/Exchange/DataTrans/Batch/DiskExchangeDataManager.h>
 #include <Statistics/AutoStatisticsManager.h>
 #include <fmt/core.h>
+#include <magic_enum.hpp>
 #include <Disks/IO/ThreadPoolRemoteFSReader.h>
+#include <IO/ThreadPoolReader.h>
 
 namespace fs = std::filesystem;
 
@@ -261,6 +265,7 @@ namespace ErrorCodes
     extern const int CATALOG_SERVICE_INTERNAL_ERROR;
     extern const int NOT_A_LEADER;
     extern const int INVALID_SETTING_VALUE;
+    extern const int UNKNOWN_READ_METHOD;
 }
 
 /** Set of known objects (environment), that could be used in query.
@@ -351,7 +356,9 @@ struct ContextSharedPart
     mutable NvmCachePtr nvm_cache; /// nvm cache
     mutable UncompressedCachePtr uncompressed_cache; /// The cache of decompressed blocks.
     mutable MarkCachePtr mark_cache; /// Cache of marks in compressed files.
+    mutable LowCardinalityDictionaryCachePtr low_cardinality_dictionary_cache; /// Cache of decoded LowCardinality dictionaries shared across parts.
     mutable QueryCachePtr query_cache;         /// Cache of query results.
+    mutable PlanSegmentResultCachePtr plan_segment_result_cache; /// Worker-side cache of plan segment results.
     mutable MMappedFileCachePtr
         mmap_cache; /// Cache of mmapped files to avoid frequent open/map/unmap/close and to reuse from several threads.
     ProcessList process_list; /// Executing queries at the moment.
@@ -373,9 +380,14 @@ struct ContextSharedPart
     mutable std::optional<BackgroundSchedulePool> message_broker_schedule_pool; /// A thread pool that can run different jobs in background (used for message brokers, like RabbitMQ and Kafka)
 
     mutable AsynchronousReaderPtr asynchronous_remote_fs_reader;
+    mutable AsynchronousReaderPtr asynchronous_local_fs_reader;
 
     mutable ThrottlerPtr disk_cache_throttler;
 
+    mutable ThrottlerPtr remote_read_throttler; /// A server-wide throttler for remote reads
+    mutable ThrottlerPtr merge_remote_read_throttler; /// Class throttler for merge/mutation reads, child of the above
+    mutable ThrottlerPtr remote_request_throttler; /// A server-wide request-rate throttler for remote storage
+
     mutable std::array<std::optional<BackgroundSchedulePool>, SchedulePool::Size> extra_schedule_pools;
 
     mutable ThrottlerPtr replicated_fetches_throttler; /// A server-wide throttler for replicated fetches
@@ -791,11 +803,19 @@ InterserverIOHandler & Context::getInterserverIOHandler()
 ReadSettings Context::getReadSettings() const
 {
     ReadSettings res;
+
+    std::string_view read_method_str = settings.local_filesystem_read_method.value;
+    if (auto opt_method = magic_enum::enum_cast<LocalFSReadMethod>(read_method_str))
+        res.local_fs_method = *opt_method;
+    else
+        throw Exception(ErrorCodes::UNKNOWN_READ_METHOD, "Unknown read method '{}' for local filesystem", String(read_method_str));
+
     res.remote_fs_prefetch = settings.remote_filesystem_read_prefetch;
     res.local_fs_prefetch = settings.local_filesystem_read_prefetch;
     res.remote_read_log = settings.enable_remote_read_log ? getRemoteReadLog().get() : nullptr;
     res.enable_io_scheduler = settings.enable_io_scheduler;
     res.enable_io_pfra = settings.enable_io_pfra;
+    res.remote_fs_enable_hedged_reads = settings.remote_fs_enable_hedged_reads;
     res.local_fs_buffer_size
         = settings.max_read_buffer_size_local_fs ? settings.max_read_buffer_size_local_fs : settings.max_read_buffer_size;
     res.remote_fs_buffer_size
@@ -805,10 +825,15 @@ ReadSettings Context::getReadSettings() const
     res.mmap_cache = getMMappedFileCache().get();
     res.remote_read_min_bytes_for_seek = settings.remote_read_min_bytes_for_seek;
     res.disk_cache_mode = settings.disk_cache_mode;
+    res.disk_cache_readahead_segments = settings.disk_cache_readahead_segments;
     res.skip_download_if_exceeds_query_cache = settings.skip_download_if_exceeds_query_cache;
     res.parquet_decode_threads = settings.max_download_threads;
     res.filtered_ratio_to_use_skip_read = settings.filtered_ratio_to_use_skip_read;
+    res.prewhere_filter_selectivity_threshold = settings.merge_tree_prewhere_filter_selectivity_threshold;
     res.zero_copy_read_from_cache = settings.enable_zero_copy_read;
+    /// Default class for remote reads is the foreground query budget; background
+    /// consumers (e.g. merges, see CnchMergePrefetcher) override it with their class throttler.
+    res.remote_throttler = getRemoteReadThrottler();
 
     return res;
 }
@@ -2786,7 +2811,7 @@ void Context::dropUncompressedCache() const
 }
 
 
-void Context::setMarkCache(size_t cache_size_in_bytes)
+void Context::setMarkCache(size_t cache_size_in_bytes, size_t compressed_cache_size_in_bytes)
 {
     auto lock = getLock();
 
@@ -2794,6 +2819,7 @@ void Context::setMarkCache(size_t cache_size_in_bytes)
         throw Exception("Mark cache has been already created.", ErrorCodes::LOGICAL_ERROR);
 
     shared->mark_cache = std::make_shared<MarkCache>(cache_size_in_bytes);
+    shared->mark_cache->setCompressedTier(compressed_cache_size_in_bytes);
 }
 
 MarkCachePtr Context::getMarkCache() const
@@ -2809,6 +2835,29 @@ void Context::dropMarkCache() const
         shared->mark_cache->reset();
 }
 
+void Context::setLowCardinalityDictionaryCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->low_cardinality_dictionary_cache)
+        throw Exception("LowCardinality dictionary cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->low_cardinality_dictionary_cache = std::make_shared<LowCardinalityDictionaryCache>(cache_size_in_bytes);
+}
+
+LowCardinalityDictionaryCachePtr Context::getLowCardinalityDictionaryCache() const
+{
+    auto lock = getLock();
+    return shared->low_cardinality_dictionary_cache;
+}
+
+void Context::dropLowCardinalityDictionaryCache() const
+{
+    auto lock = getLock();
+    if (shared->low_cardinality_dictionary_cache)
+        shared->low_cardinality_dictionary_cache->reset();
+}
+
 void Context::setQueryCache(const Poco::Util::AbstractConfiguration & config)
 {
     auto lock = getLock();
@@ -2840,6 +2889,30 @@ void Context::dropQueryCache() const
         shared->query_cache->reset();
 }
 
+void Context::setPlanSegmentResultCache(const Poco::Util::AbstractConfiguration & config)
+{
+    auto lock = getLock();
+
+    if (shared->plan_segment_result_cache)
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "Plan segment result cache has been already created.");
+
+    shared->plan_segment_result_cache = std::make_shared<PlanSegmentResultCache>();
+    shared->plan_segment_result_cache->updateConfiguration(config);
+}
+
+PlanSegmentResultCachePtr Context::getPlanSegmentResultCache() const
+{
+    auto lock = getLock();
+    return shared->plan_segment_result_cache;
+}
+
+void Context::dropPlanSegmentResultCache() const
+{
+    auto lock = getLock();
+    if (shared->plan_segment_result_cache)
+        shared->plan_segment_result_cache->reset();
+}
+
 void Context::setMMappedFileCache(size_t cache_size_in_num_entries)
 {
     auto lock = getLock();
@@ -3093,6 +3166,52 @@ ThrottlerPtr Context::getDiskCacheThrottler() const
     return shared->disk_cache_throttler;
 }
 
+ThrottlerPtr Context::getRemoteReadThrottler() const
+{
+    if (!settings.max_remote_read_network_bandwidth_for_server)
+        return nullptr;
+
+    auto lock = getLock();
+    if (!shared->remote_read_throttler)
+        shared->remote_read_throttler = std::make_shared<Throttler>(settings.max_remote_read_network_bandwidth_for_server);
+
+    return shared->remote_read_throttler;
+}
+
+ThrottlerPtr Context::getRemoteRequestThrottler() const
+{
+    if (!settings.max_remote_request_rate_for_server)
+        return nullptr;
+
+    auto lock = getLock();
+    if (!shared->remote_request_throttler)
+        shared->remote_request_throttler = std::make_shared<Throttler>(settings.max_remote_request_rate_for_server);
+
+    return shared->remote_request_throttler;
+}
+
+ThrottlerPtr Context::getMergeRemoteReadThrottler() const
+{
+    if (!settings.max_remote_read_network_bandwidth_for_merges && !settings.max_remote_read_network_bandwidth_for_server)
+        return nullptr;
+
+    auto lock = getLock();
+    if (!shared->merge_remote_read_throttler)
+    {
+        ThrottlerPtr parent;
+        if (settings.max_remote_read_network_bandwidth_for_server)
+        {
+            if (!shared->remote_read_throttler)
+                shared->remote_read_throttler = std::make_shared<Throttler>(settings.max_remote_read_network_bandwidth_for_server);
+            parent = shared->remote_read_throttler;
+        }
+        shared->merge_remote_read_throttler
+            = std::make_shared<Throttler>(settings.max_remote_read_network_bandwidth_for_merges, parent);
+    }
+
+    return shared->merge_remote_read_throttler;
+}
+
 ThrottlerPtr Context::getReplicatedSendsThrottler() const
 {
     auto lock = getLock();
@@ -5921,4 +6040,19 @@ AsynchronousReaderPtr Context::getThreadPoolReader() const
 
     return shared->asynchronous_remote_fs_reader;
 }
+
+AsynchronousReaderPtr Context::getLocalThreadPoolReader() const
+{
+    auto lock = getLock();
+
+    if (!shared->asynchronous_local_fs_reader)
+    {
+        const Poco::Util::AbstractConfiguration & config = getConfigRef();
+        auto pool_size = config.getUInt(".threadpool_local_fs_reader_pool_size", 100);
+        auto queue_size = config.getUInt(".threadpool_local_fs_reader_queue_size", 1000000);
+        shared->asynchronous_local_fs_reader = std::make_shared<ThreadPoolReader>(pool_size, queue_size);
+    }
+
+    return shared->asynchronous_local_fs_reader;
+}
 }
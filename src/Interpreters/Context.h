@@ -118,12 +118,14 @@ class ReplicatedFetchList;
 class Cluster;
 class Compiler;
 class MarkCache;
+class LowCardinalityDictionaryCache;
 class MMappedFileCache;
 class UncompressedCache;
 class PrimaryIndexCache;
 class ProcessList;
 class ProcessListEntry;
 class PlanSegment;
+class PlanSegmentResultCache;
 class QueryStatus;
 class QueryCache;
 class Macros;
@@ -1205,10 +1207,15 @@ public:
     void dropUncompressedCache() const;
 
     /// Create a cache of marks of specified size. This can be done only once.
-    void setMarkCache(size_t cache_size_in_bytes);
+    void setMarkCache(size_t cache_size_in_bytes, size_t compressed_cache_size_in_bytes = 0);
     std::shared_ptr<MarkCache> getMarkCache() const;
     void dropMarkCache() const;
 
+    /// Create a cache of decoded LowCardinality dictionaries shared across parts. This can be done only once.
+    void setLowCardinalityDictionaryCache(size_t cache_size_in_bytes);
+    std::shared_ptr<LowCardinalityDictionaryCache> getLowCardinalityDictionaryCache() const;
+    void dropLowCardinalityDictionaryCache() const;
+
     /// Create a cache of mapped files to avoid frequent open/map/unmap/close and to reuse from several threads.
     void setMMappedFileCache(size_t cache_size_in_num_entries);
     std::shared_ptr<MMappedFileCache> getMMappedFileCache() const;
@@ -1220,6 +1227,11 @@ public:
     std::shared_ptr<QueryCache> getQueryCache() const;
     void dropQueryCache() const;
 
+    /// Create a worker-side cache of plan segment results for repeated identical sub-plans.
+    void setPlanSegmentResultCache(const Poco::Util::AbstractConfiguration & config);
+    std::shared_ptr<PlanSegmentResultCache> getPlanSegmentResultCache() const;
+    void dropPlanSegmentResultCache() const;
+
     /** Clear the caches of the uncompressed blocks and marks.
       * This is usually done when renaming tables, changing the type of columns, deleting a table.
       *  - since caches are linked to file names, and become incorrect.
@@ -1256,6 +1268,15 @@ public:
 
     ThrottlerPtr getDiskCacheThrottler() const;
 
+    /// Server-wide cap shared by all remote reads on this node, nullptr when unlimited.
+    ThrottlerPtr getRemoteReadThrottler() const;
+    /// Class throttler for background merge/mutation reads, chained to the server-wide
+    /// one so merges both respect their own cap and count against the shared budget.
+    ThrottlerPtr getMergeRemoteReadThrottler() const;
+    /// Server-wide cap on remote storage requests per second (as opposed to bytes),
+    /// nullptr when unlimited. Root of the per-table and per-query request buckets.
+    ThrottlerPtr getRemoteRequestThrottler() const;
+
     ThrottlerPtr getReplicatedFetchesThrottler() const;
     ThrottlerPtr getReplicatedSendsThrottler() const;
 
@@ -1682,6 +1703,7 @@ public:
     void setQueryExpirationTimeStamp();
 
     AsynchronousReaderPtr getThreadPoolReader() const;
+    AsynchronousReaderPtr getLocalThreadPoolReader() const;
 
     void setPreparedStatementManager(std::unique_ptr<PreparedStatementManager> && manager);
     PreparedStatementManager * getPreparedStatementManager();
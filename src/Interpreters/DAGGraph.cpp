@@ -36,6 +36,13 @@ void DAGGraph::joinAsyncRpcAtLast()
         joinAsyncRpcWithThrow();
 }
 
+void DAGGraph::waitForSendResources()
+{
+    /// get() invalidates the future, so repeated calls are no-ops.
+    if (send_resources_future.valid())
+        send_resources_future.get();
+}
+
 AddressInfos DAGGraph::getAddressInfos(size_t segment_id)
 {
     /// for bsp_mode we need get worker addresses from finished_address, because retry might happen
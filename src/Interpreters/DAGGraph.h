@@ -1,5 +1,6 @@
 #pragma once
 
+#include <future>
 #include <unordered_map>
 #include <unordered_set>
 #include <Interpreters/Context_fwd.h>
@@ -38,6 +39,9 @@ struct DAGGraph
     void joinAsyncRpcWithThrow();
     void joinAsyncRpcPerStage();
     void joinAsyncRpcAtLast();
+    /// Joins the asynchronous resource fan-out started at query admission; no-op once joined
+    /// (or when resources were sent synchronously / not at all).
+    void waitForSendResources();
     AddressInfos getAddressInfos(size_t segment_id);
 
     PlanSegment * getPlanSegmentPtr(size_t id);
@@ -64,6 +68,10 @@ struct DAGGraph
     std::unordered_map<size_t, UInt64> segment_parallel_size_map;
     butil::IOBuf query_common_buf;
     butil::IOBuf query_settings_buf;
+    /// Resources are fanned out to the workers asynchronously while the coordinator serializes
+    /// the query buffers and plans the schedule; joined before the first segment dispatch so no
+    /// worker can start executing without its resources.
+    std::future<void> send_resources_future;
 };
 
 using DAGGraphPtr = std::shared_ptr<DAGGraph>;
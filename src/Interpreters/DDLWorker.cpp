@@ -28,6 +28,7 @@
 #include <Parsers/ASTOptimizeQuery.h>
 #include <Parsers/ASTQueryWithOnCluster.h>
 #include <Parsers/ASTQueryWithTableAndOutput.h>
+#include <Parsers/ASTRenameQuery.h>
 #include <Parsers/ParserQuery.h>
 #include <Parsers/parseQuery.h>
 #include <Parsers/queryToString.h>
@@ -231,6 +232,7 @@ void DDLWorker::shutdown()
     {
         queue_updated_event->set();
         cleanup_event->set();
+        busy_objects_cv.notify_all();
         main_thread.join();
         cleanup_thread.join();
         worker_pool.reset();
@@ -488,11 +490,25 @@ void DDLWorker::scheduleTasks(bool reinitialized)
 
         if (worker_pool)
         {
-            worker_pool->scheduleOrThrowOnError([this, &saved_task, zookeeper]()
+            /// Wait until no running task touches the same (database, table), so that
+            /// independent entries execute in parallel while conflicting entries keep
+            /// their queue order.
+            auto conflict_objects = getConflictObjects(saved_task);
+            acquireConflictObjects(conflict_objects);
+            try
             {
-                setThreadName("DDLWorkerExec");
-                processTask(saved_task, zookeeper);
-            });
+                worker_pool->scheduleOrThrowOnError([this, &saved_task, zookeeper, conflict_objects]()
+                {
+                    setThreadName("DDLWorkerExec");
+                    SCOPE_EXIT_SAFE(releaseConflictObjects(conflict_objects););
+                    processTask(saved_task, zookeeper);
+                });
+            }
+            catch (...)
+            {
+                releaseConflictObjects(conflict_objects);
+                throw;
+            }
         }
         else
         {
@@ -501,6 +517,71 @@ void DDLWorker::scheduleTasks(bool reinitialized)
     }
 }
 
+DDLWorker::ConflictObjects DDLWorker::getConflictObjects(const DDLTaskBase & task)
+{
+    /// A task without a parsed query is an unknown quantity: conflict with everything.
+    if (!task.query)
+        return {{"", ""}};
+
+    ConflictObjects objects;
+    if (const auto * rename = task.query->as<ASTRenameQuery>())
+    {
+        for (const auto & element : rename->elements)
+        {
+            objects.emplace_back(element.from.database, element.from.table);
+            objects.emplace_back(element.to.database, element.to.table);
+        }
+    }
+    else if (const auto * query_with_table = dynamic_cast<const ASTQueryWithTableAndOutput *>(task.query.get()))
+    {
+        /// Database-level DDLs (e.g. DROP DATABASE) have an empty table name here and
+        /// take the whole database. An empty database name (resolved to the session
+        /// default only at execution) conservatively conflicts with everything.
+        objects.emplace_back(query_with_table->database, query_with_table->table);
+    }
+    else
+        objects.emplace_back("", "");
+
+    return objects;
+}
+
+void DDLWorker::acquireConflictObjects(const ConflictObjects & objects)
+{
+    auto conflicts_with_busy = [this](const std::pair<String, String> & object)
+    {
+        return std::any_of(busy_objects.begin(), busy_objects.end(), [&](const auto & busy)
+        {
+            if (busy.first.empty() || object.first.empty())
+                return true;
+            if (busy.first != object.first)
+                return false;
+            return busy.second.empty() || object.second.empty() || busy.second == object.second;
+        });
+    };
+
+    std::unique_lock lock(busy_objects_mutex);
+    busy_objects_cv.wait(lock, [&]
+    {
+        return stop_flag || std::none_of(objects.begin(), objects.end(), conflicts_with_busy);
+    });
+    for (const auto & object : objects)
+        busy_objects.insert(object);
+}
+
+void DDLWorker::releaseConflictObjects(const ConflictObjects & objects)
+{
+    {
+        std::lock_guard lock(busy_objects_mutex);
+        for (const auto & object : objects)
+        {
+            auto it = busy_objects.find(object);
+            if (it != busy_objects.end())
+                busy_objects.erase(it);
+        }
+    }
+    busy_objects_cv.notify_all();
+}
+
 DDLTaskBase & DDLWorker::saveTask(DDLTaskPtr && task)
 {
     current_tasks.remove_if([](const DDLTaskPtr & t) { return t->completely_processed.load(); });
@@ -33,6 +33,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <set>
 #include <thread>
 
 namespace zkutil
@@ -160,6 +161,21 @@ protected:
     size_t pool_size = 1;
     std::unique_ptr<ThreadPool> worker_pool;
 
+    /// Conflict gating for parallel execution. Each entry is a (database, table) an
+    /// in-flight task touches; an empty table name stands for the whole database and an
+    /// empty database name for every object. Entries are scheduled in queue order and a
+    /// conflicting entry waits for the running owner, so independent DDLs execute
+    /// concurrently while DDLs on the same object keep their queue order.
+    using ConflictObjects = std::vector<std::pair<String, String>>;
+    static ConflictObjects getConflictObjects(const DDLTaskBase & task);
+    /// Blocks until no running task owns a conflicting object, then marks `objects` busy.
+    void acquireConflictObjects(const ConflictObjects & objects);
+    void releaseConflictObjects(const ConflictObjects & objects);
+
+    std::mutex busy_objects_mutex;
+    std::condition_variable busy_objects_cv;
+    std::multiset<std::pair<String, String>> busy_objects;
+
     /// Cleaning starts after new node event is received if the last cleaning wasn't made sooner than N seconds ago
     Int64 cleanup_delay_period = 60; // minute (in seconds)
     /// Delete node if its age is greater than that
@@ -7,15 +7,26 @@
 #include <common/logger_useful.h>
 
 #include <Interpreters/DistributedStages/AddressInfo.h>
+#include <Interpreters/DistributedStages/ExchangeDataTracker.h>
+#include <Interpreters/DistributedStages/ExchangeMode.h>
 #include <Interpreters/DistributedStages/PlanSegmentInstance.h>
 #include <Interpreters/DistributedStages/RuntimeSegmentsStatus.h>
 #include <Interpreters/DistributedStages/Scheduler.h>
 #include <Interpreters/NodeSelector.h>
+#include <Processors/Exchange/DataTrans/RpcChannelPool.h>
+#include <Processors/Exchange/DataTrans/RpcClient.h>
+#include <Protos/RPCHelpers.h>
+#include <Protos/plan_segment_manager.pb.h>
 #include <QueryPlan/IQueryPlanStep.h>
 #include <QueryPlan/QueryPlan.h>
 #include <QueryPlan/TableWriteStep.h>
+#include <brpc/controller.h>
+#include <Common/Exception.h>
 #include "BSPScheduler.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <string>
 #include <unordered_map>
@@ -28,6 +39,15 @@ namespace DB
 namespace ErrorCodes
 {
     extern const int BRPC_PROTOCOL_VERSION_UNSUPPORT;
+    extern const int EXCHANGE_DATA_TRANS_EXCEPTION;
+}
+
+namespace
+{
+    UInt64 nowMs()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
 }
 
 /// BSP scheduler logic
@@ -124,6 +144,12 @@ void BSPScheduler::updateSegmentStatusCounter(size_t segment_id, UInt64 parallel
             std::unique_lock<std::mutex> lk(nodes_alloc_mutex);
             available_worker = segment_parallel_locations[segment_id][parallel_index];
             occupied_workers[segment_id].erase(available_worker);
+            auto dispatched = segment_instance_dispatched_ms.find({static_cast<UInt32>(segment_id), static_cast<UInt32>(parallel_index)});
+            if (dispatched != segment_instance_dispatched_ms.end())
+            {
+                segment_finished_runtimes_ms[segment_id].push_back(nowMs() - dispatched->second);
+                segment_instance_dispatched_ms.erase(dispatched);
+            }
         }
         {
             /// update finished_address before onSegmentFinished(where new task might be added to queue)
@@ -153,6 +179,7 @@ void BSPScheduler::updateSegmentStatusCounter(size_t segment_id, UInt64 parallel
         std::unique_lock<std::mutex> lk(nodes_alloc_mutex);
         auto failed_worker = segment_parallel_locations[segment_id][parallel_index];
         failed_workers[segment_id].insert(failed_worker);
+        segment_instance_dispatched_ms.erase({static_cast<UInt32>(segment_id), static_cast<UInt32>(parallel_index)});
         auto iter = pending_task_instances.for_nodes[failed_worker].begin();
         while (iter != pending_task_instances.for_nodes[failed_worker].end())
         {
@@ -272,12 +299,102 @@ bool BSPScheduler::retryTaskIfPossible(size_t segment_id, UInt64 parallel_index)
     return true;
 }
 
+bool BSPScheduler::tryRecoverLostExchangeData(size_t segment_id, UInt64 parallel_index, const RuntimeSegmentsStatus & status)
+{
+    const auto & settings = query_context->getSettingsRef();
+    if (!settings.bsp_recover_lost_exchange_data || status.code != ErrorCodes::EXCHANGE_DATA_TRANS_EXCEPTION)
+        return false;
+
+    /// Producer instances whose materialized output has to be regenerated, with the worker that held it.
+    std::vector<std::pair<SegmentTaskInstance, AddressInfo>> lost_instances;
+    auto * plansegment = dag_graph_ptr->getPlanSegmentPtr(segment_id);
+    for (const auto & input : plansegment->getPlanSegmentInputs())
+    {
+        if (input->getExchangeMode() == ExchangeMode::UNKNOWN)
+            continue;
+        size_t producer_segment_id = input->getPlanSegmentId();
+        std::unordered_map<UInt64, AddressInfo> producer_locations;
+        {
+            std::unique_lock<std::mutex> lock(dag_graph_ptr->finished_address_mutex);
+            auto finished = dag_graph_ptr->finished_address.find(producer_segment_id);
+            if (finished == dag_graph_ptr->finished_address.end())
+                continue;
+            producer_locations = finished->second;
+        }
+        for (const auto & [producer_index, addr] : producer_locations)
+        {
+            /// A producer's worker is considered lost together with its disk when the consumer's
+            /// error names its exchange address, or when our own channel to it is broken.
+            const auto host_port = extractExchangeHostPort(addr);
+            if (status.message.find(host_port) == String::npos)
+            {
+                auto client = RpcChannelPool::getInstance().getClient(host_port, BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY);
+                if (client && client->ok())
+                    continue;
+            }
+            lost_instances.emplace_back(SegmentTaskInstance{producer_segment_id, producer_index}, addr);
+        }
+    }
+
+    if (lost_instances.empty())
+        return false;
+
+    for (const auto & [instance, lost_worker] : lost_instances)
+    {
+        auto instance_id = PlanSegmentInstanceId{static_cast<UInt32>(instance.task_id), static_cast<UInt32>(instance.parallel_index)};
+        {
+            std::unique_lock<std::mutex> lk(nodes_alloc_mutex);
+            if (segment_instance_retry_cnt[instance_id] >= settings.bsp_max_retry_num)
+                return false;
+        }
+        {
+            /// Claim the instance by forgetting its finished state; skip it if another
+            /// consumer's recovery already re-enqueued it.
+            std::unique_lock<std::mutex> lock(segment_status_counter_mutex);
+            auto counter = segment_status_counter.find(instance.task_id);
+            if (counter == segment_status_counter.end() || !counter->second.erase(instance.parallel_index))
+                continue;
+        }
+        {
+            std::unique_lock<std::mutex> lock(dag_graph_ptr->finished_address_mutex);
+            dag_graph_ptr->finished_address[instance.task_id].erase(instance.parallel_index);
+        }
+        for (const auto & output : dag_graph_ptr->getPlanSegmentPtr(instance.task_id)->getPlanSegmentOutputs())
+            query_context->getExchangeDataTracker()->unregisterExchangeStatus(
+                query_id, output->getExchangeId(), instance.parallel_index, lost_worker);
+        {
+            std::unique_lock<std::mutex> lk(nodes_alloc_mutex);
+            segment_instance_retry_cnt[instance_id]++;
+            failed_workers[instance.task_id].insert(lost_worker);
+            occupied_workers[instance.task_id].erase(lost_worker);
+            pending_task_instances.no_prefs.insert(instance);
+        }
+        LOG_INFO(
+            log,
+            "Re-running segment instance(query_id:{} {}) whose exchange output was lost with worker {}",
+            query_id,
+            instance_id.toString(),
+            lost_worker.toString());
+    }
+    triggerDispatch(cluster_nodes.rank_workers);
+
+    /// The consumer goes back through the ordinary retry path and reads the regenerated
+    /// output once the producers finish again; it may fail fast once more meanwhile.
+    return retryTaskIfPossible(segment_id, parallel_index);
+}
+
 const AddressInfo & BSPScheduler::getSegmentParallelLocation(PlanSegmentInstanceId instance_id)
 {
     std::unique_lock<std::mutex> lock(nodes_alloc_mutex);
     return segment_parallel_locations[instance_id.segment_id][instance_id.parallel_id];
 }
 
+bool BSPScheduler::tryConsumeSpeculationCancel(size_t segment_id, UInt64 parallel_index)
+{
+    std::unique_lock<std::mutex> lock(nodes_alloc_mutex);
+    return speculation_cancelled_instances.erase({static_cast<UInt32>(segment_id), static_cast<UInt32>(parallel_index)}) > 0;
+}
+
 std::pair<bool, SegmentTaskInstance> BSPScheduler::getInstanceToSchedule(const AddressInfo & worker)
 {
     if (pending_task_instances.for_nodes.contains(worker))
@@ -352,6 +469,9 @@ void BSPScheduler::triggerDispatch(const std::vector<WorkerNode> & available_wor
             occupied_workers[task_instance->task_id].insert(address);
             segment_parallel_locations[task_instance->task_id][task_instance->parallel_index] = address;
             failed_workers[task_instance->task_id].insert(local_address); /// init with server addr, as we wont schedule to server
+            segment_instance_dispatched_ms
+                [{static_cast<UInt32>(task_instance->task_id), static_cast<UInt32>(task_instance->parallel_index)}]
+                = nowMs();
         }
 
         dispatchTask(
@@ -389,6 +509,104 @@ void BSPScheduler::prepareTask(PlanSegment * plan_segment_ptr, size_t parallel_s
     }
 }
 
+void BSPScheduler::startSpeculationIfNeeded()
+{
+    if (!query_context->getSettingsRef().enable_bsp_speculative_execution)
+        return;
+    speculation_check_task = query_context->getSchedulePool().createTask("BSPSpeculation", [this] {
+        try
+        {
+            checkStragglers();
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "checkStragglers");
+        }
+        if (!stopped.load(std::memory_order_relaxed))
+            speculation_check_task->scheduleAfter(SPECULATION_CHECK_INTERVAL_MS);
+    });
+    speculation_check_task->activateAndSchedule();
+}
+
+/// Speculation reruns a segment instance from scratch, so it is limited to segments whose only
+/// effect is their materialized exchange output. Table writes are left to the failure-retry
+/// path which knows how to undo partial data.
+static bool isSegmentSafeToSpeculate(PlanSegment * plansegment)
+{
+    for (const auto & node : plansegment->getQueryPlan().getNodes())
+    {
+        if (std::dynamic_pointer_cast<TableWriteStep>(node.step) || node.step->getType() == IQueryPlanStep::Type::TableFinish)
+            return false;
+    }
+    return true;
+}
+
+void BSPScheduler::checkStragglers()
+{
+    const auto & settings = query_context->getSettingsRef();
+    std::vector<std::pair<PlanSegmentInstanceId, AddressInfo>> stragglers;
+    UInt64 now = nowMs();
+    {
+        std::unique_lock<std::mutex> lk(nodes_alloc_mutex);
+        for (const auto & [instance, dispatched_ms] : segment_instance_dispatched_ms)
+        {
+            if (speculation_cancelled_instances.contains(instance))
+                continue;
+            /// cancelling an instance whose retry budget is exhausted would fail the whole query
+            if (segment_instance_retry_cnt[instance] >= settings.bsp_max_retry_num)
+                continue;
+            UInt64 elapsed = now - dispatched_ms;
+            if (elapsed < settings.bsp_speculation_min_elapsed_ms)
+                continue;
+            auto finished = segment_finished_runtimes_ms.find(instance.segment_id);
+            auto parallel_size = dag_graph_ptr->segment_parallel_size_map.find(instance.segment_id);
+            if (finished == segment_finished_runtimes_ms.end() || parallel_size == dag_graph_ptr->segment_parallel_size_map.end())
+                continue;
+            if (finished->second.size() < static_cast<size_t>(std::ceil(settings.bsp_speculation_quantile * parallel_size->second)))
+                continue;
+            auto runtimes = finished->second;
+            std::nth_element(runtimes.begin(), runtimes.begin() + runtimes.size() / 2, runtimes.end());
+            UInt64 median = runtimes[runtimes.size() / 2];
+            if (elapsed <= median * settings.bsp_speculation_slow_instance_multiplier)
+                continue;
+            stragglers.emplace_back(instance, segment_parallel_locations[instance.segment_id][instance.parallel_id]);
+        }
+    }
+
+    for (const auto & [instance, address] : stragglers)
+    {
+        if (!isSegmentSafeToSpeculate(dag_graph_ptr->getPlanSegmentPtr(instance.segment_id)))
+            continue;
+        {
+            std::unique_lock<std::mutex> lk(nodes_alloc_mutex);
+            if (!speculation_cancelled_instances.insert(instance).second)
+                continue;
+        }
+        LOG_INFO(
+            log,
+            "Cancelling straggling segment instance(query_id:{} {}) on worker {} for speculative re-dispatch",
+            query_id,
+            instance.toString(),
+            address.toString());
+        sendCancelInstanceRequest(address, instance.segment_id);
+    }
+}
+
+void BSPScheduler::sendCancelInstanceRequest(const AddressInfo & address, size_t segment_id)
+{
+    auto host_port = extractExchangeHostPort(address);
+    std::shared_ptr<RpcClient> rpc_client = RpcChannelPool::getInstance().getClient(host_port, BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY);
+    Protos::PlanSegmentManagerService_Stub manager(&rpc_client->getChannel());
+    brpc::Controller * cntl = new brpc::Controller;
+    Protos::CancelQueryRequest request;
+    request.set_query_id(query_id);
+    request.set_coordinator_address(query_context->getHostWithPorts().getExchangeAddress());
+    request.set_segment_id(static_cast<UInt32>(segment_id));
+    auto * response = new Protos::CancelQueryResponse();
+    auto handler = std::make_shared<ExceptionHandler>();
+    manager.cancelQuery(cntl, &request, response, brpc::NewCallback(RPCHelpers::onAsyncCallDone, response, cntl, handler));
+}
+
 PlanSegmentExecutionInfo BSPScheduler::generateExecutionInfo(size_t task_id, size_t index)
 {
     PlanSegmentExecutionInfo execution_info;
@@ -1,6 +1,7 @@
 #include <atomic>
 #include <cstddef>
 #include <unordered_map>
+#include <Core/BackgroundSchedulePool.h>
 #include <Interpreters/DistributedStages/AddressInfo.h>
 #include <Interpreters/DistributedStages/PlanSegmentInstance.h>
 #include <Interpreters/DistributedStages/RuntimeSegmentsStatus.h>
@@ -36,6 +37,7 @@ public:
             query_context->getCnchServerResource()->setSendMutations(true);
             query_context->getCnchServerResource()->sendResources(query_context, option);
         }
+        startSpeculationIfNeeded();
     }
 
     void submitTasks(PlanSegment * plan_segment_ptr, const SegmentTask & task) override;
@@ -50,12 +52,26 @@ public:
     void updateSegmentStatusCounter(size_t segment_id, UInt64 parallel_index, const RuntimeSegmentsStatus & status);
     /// retry task if possible, returns whether retry is successful or not
     bool retryTaskIfPossible(size_t segment_id, UInt64 parallel_index);
+    /// When a consumer instance fails because materialized exchange data on a lost worker can
+    /// no longer be read, re-run just the upstream producer instances whose output lived on
+    /// that worker and retry the consumer, instead of failing the whole query. Returns whether
+    /// recovery (including the consumer retry) was started.
+    bool tryRecoverLostExchangeData(size_t segment_id, UInt64 parallel_index, const RuntimeSegmentsStatus & status);
 
     const AddressInfo & getSegmentParallelLocation(PlanSegmentInstanceId instance_id);
 
+    /// Returns true iff the scheduler cancelled this instance itself for speculative re-dispatch,
+    /// consuming the pending mark so the cancelled status can be treated as a retryable failure.
+    bool tryConsumeSpeculationCancel(size_t segment_id, UInt64 parallel_index);
+
 private:
     std::pair<bool, SegmentTaskInstance> getInstanceToSchedule(const AddressInfo & worker);
     void triggerDispatch(const std::vector<WorkerNode> & available_workers);
+    void startSpeculationIfNeeded();
+    /// Periodically cancels instances which run far longer than the finished instances of their
+    /// segment, so the failure-retry path re-dispatches them to another worker.
+    void checkStragglers();
+    void sendCancelInstanceRequest(const AddressInfo & address, size_t segment_id);
     void sendResources(PlanSegment * plan_segment_ptr) override;
     void prepareTask(PlanSegment * plan_segment_ptr, size_t parallel_size) override;
     PlanSegmentExecutionInfo generateExecutionInfo(size_t task_id, size_t index) override;
@@ -76,6 +92,16 @@ private:
     // segment task instance -> <index, total> count in this worker
     std::unordered_map<SegmentTaskInstance, std::pair<size_t, size_t>, SegmentTaskInstance::Hash> source_task_idx;
     std::atomic_size_t retry_count = {0};
+
+    /// Speculative execution bookkeeping, all guarded by nodes_alloc_mutex.
+    // dispatch time of instances currently running, erased once their status arrives
+    std::unordered_map<PlanSegmentInstanceId, UInt64> segment_instance_dispatched_ms;
+    // segment id -> runtimes of its finished instances
+    std::unordered_map<size_t, std::vector<UInt64>> segment_finished_runtimes_ms;
+    // instances with a speculative cancel in flight
+    std::unordered_set<PlanSegmentInstanceId> speculation_cancelled_instances;
+    static constexpr UInt64 SPECULATION_CHECK_INTERVAL_MS = 5000;
+    BackgroundSchedulePool::TaskHolder speculation_check_task;
 };
 
 }
@@ -72,6 +72,22 @@ void ExchangeStatusTracker::registerExchangeStatus(
     iter->second.addStatus(parallel_index, status);
 }
 
+void ExchangeStatusTracker::unregisterExchangeStatus(
+    const String & query_id, UInt64 exchange_id, UInt64 parallel_index, const AddressInfo & addr)
+{
+    LOG_TRACE(
+        log,
+        "unregister exchange status for query:{} exchange_id:{} parallel_index:{} addr:{}",
+        query_id,
+        exchange_id,
+        parallel_index,
+        addr.toString());
+    std::lock_guard<std::mutex> g(exchange_status_mutex);
+    auto iter = exchange_statuses.find(ExchangeKey{query_id, exchange_id});
+    if (iter != exchange_statuses.end())
+        iter->second.removeStatus(parallel_index, addr);
+}
+
 ExchangeStatuses & ExchangeStatusTracker::getExchangeStatusesRef(const String & query_id, UInt64 exchange_id)
 {
     auto iter = exchange_statuses.find(ExchangeKey{query_id, exchange_id});
@@ -115,6 +115,10 @@ public:
     void registerExchange(const String & query_id, UInt64 exchange_id, size_t parallel_size);
     // Register single exchange status with sink parallel index in an exchange.
     void registerExchangeStatus(const String & query_id, UInt64 exchange_id, UInt64 parallel_index, const ExchangeStatus & exchange_status);
+    // Drop the recorded status of one sink instance if it was produced on `addr`. Used when a
+    // worker is lost and its materialized exchange output has to be regenerated elsewhere, so
+    // locality decisions stop pointing at data that no longer exists.
+    void unregisterExchangeStatus(const String & query_id, UInt64 exchange_id, UInt64 parallel_index, const AddressInfo & addr);
     // Unregister exchagnes for specified query.
     void unregisterExchanges(const String & query_id);
     /// check if query is still alive, used by worker GC
@@ -20,6 +20,7 @@
 #include <DataStreams/BlockIO.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/Context_fwd.h>
+#include <Interpreters/DatabaseCatalog.h>
 #include <Interpreters/DistributedStages/ExchangeMode.h>
 #include <Interpreters/DistributedStages/PlanSegment.h>
 #include <Interpreters/DistributedStages/PlanSegmentExecutor.h>
@@ -31,6 +32,7 @@
 #include <Interpreters/ProcessorsProfileLog.h>
 #include <Interpreters/RuntimeFilter/RuntimeFilterManager.h>
 #include <Interpreters/executeQueryHelper.h>
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
 #include <Processors/Exchange/BroadcastExchangeSink.h>
 #include <Processors/Exchange/DataTrans/Batch/Writer/DiskPartitionWriter.h>
 #include <Processors/Exchange/DataTrans/BroadcastSenderProxy.h>
@@ -59,11 +61,19 @@
 #include <Processors/Transforms/CopyTransform.h>
 #include <Protos/plan_segment_manager.pb.h>
 #include <Protos/registry.pb.h>
+#include <Interpreters/Cache/QueryCache.h>
+#include <IO/WriteBufferFromString.h>
+#include <Processors/Sources/SourceFromChunks.h>
+#include <Processors/Transforms/StreamInPlanSegmentResultCacheTransform.h>
 #include <QueryPlan/BuildQueryPipelineSettings.h>
 #include <QueryPlan/GraphvizPrinter.h>
 #include <QueryPlan/Optimizations/QueryPlanOptimizationSettings.h>
 #include <QueryPlan/PlanPrinter.h>
 #include <QueryPlan/QueryPlan.h>
+#include <QueryPlan/RemoteExchangeSourceStep.h>
+#include <QueryPlan/TableScanStep.h>
+#include <QueryPlan/TableWriteStep.h>
+#include <Common/SipHash.h>
 #include <brpc/callback.h>
 #include <fmt/core.h>
 #include <incubator-brpc/src/brpc/controller.h>
@@ -319,6 +329,15 @@ void PlanSegmentExecutor::doExecute()
     }
     context->setPlanSegmentProcessListEntry(process_plan_segment_entry);
 
+    /// Tag the thread group with the segment id so that profiler samples taken on any
+    /// pipeline thread of this segment can be attributed to it (see TraceCollector).
+    if (auto thread_group = CurrentThread::getGroup())
+    {
+        std::lock_guard lock(thread_group->mutex);
+        thread_group->plan_segment_id = static_cast<Int32>(plan_segment->getPlanSegmentId());
+    }
+    CurrentThread::get().plan_segment_id = static_cast<Int32>(plan_segment->getPlanSegmentId());
+
     if (context->getSettingsRef().bsp_mode)
     {
         auto query_unique_id = context->getCurrentTransactionID().toUInt64();
@@ -390,6 +409,7 @@ void PlanSegmentExecutor::doExecute()
     {
         metrics.cpu_micros = CurrentThread::getGroup()->performance_counters[ProfileEvents::SystemTimeMicroseconds]
                 + CurrentThread::getGroup()->performance_counters[ProfileEvents::UserTimeMicroseconds];
+        metrics.peak_memory_usage = CurrentThread::getGroup()->memory_tracker.getPeak();
     }
     GraphvizPrinter::printPipeline(pipeline_executor->getProcessors(), pipeline_executor->getExecutingGraph(), context, plan_segment->getPlanSegmentId(), extractExchangeHostPort(plan_segment_instance->info.execution_address));
     for (const auto & sender : senders)
@@ -404,6 +424,8 @@ void PlanSegmentExecutor::doExecute()
                 status.message);
     }
 
+    if (segment_result_cache_transform)
+        segment_result_cache_transform->finalizeWriteInCache();
 
     if (context->getSettingsRef().bsp_mode)
     {
@@ -467,6 +489,58 @@ QueryPipelinePtr PlanSegmentExecutor::buildPipeline()
     return pipeline;
 }
 
+std::optional<PlanSegmentResultCache::Key> PlanSegmentExecutor::makeSegmentResultCacheKey()
+{
+    const auto & settings = context->getSettingsRef();
+    if (!settings.enable_plan_segment_result_cache || settings.bsp_mode)
+        return std::nullopt;
+
+    segment_result_cache = context->getPlanSegmentResultCache();
+    if (!segment_result_cache || plan_segment_outputs.size() != 1)
+        return std::nullopt;
+
+    /// Only segments reading directly from tables are cacheable: results of segments fed by
+    /// exchanges depend on upstream scheduling, and writing segments have side effects.
+    std::set<StorageID> storage_ids;
+    for (const auto & node : plan_segment->getQueryPlan().getNodes())
+    {
+        if (const auto * table_scan = dynamic_cast<const TableScanStep *>(node.step.get()))
+            storage_ids.emplace(table_scan->getStorageID());
+        else if (dynamic_cast<const RemoteExchangeSourceStep *>(node.step.get()) || dynamic_cast<const TableWriteStep *>(node.step.get()))
+            return std::nullopt;
+    }
+    if (storage_ids.empty())
+        return std::nullopt;
+
+    TxnTimestamp source_update_time = getMaxUpdateTime(storage_ids, context);
+    if (source_update_time.toUInt64() == 0)
+        return std::nullopt;
+
+    /// The Optimizer's plan signature is computed server-side over the optimizer plan which the
+    /// worker no longer has, so sign the serialized segment plan instead: segments of repeated
+    /// identical queries serialize identically.
+    WriteBufferFromOwnString plan_buf;
+    plan_segment->getQueryPlan().serialize(plan_buf);
+    UInt64 signature = sipHash64(plan_buf.str().data(), plan_buf.str().size());
+
+    /// The scheduler may assign a different subset of parts to this worker on every run, and
+    /// the part set is not visible in the serialized plan; fold it into the key so results of
+    /// different assignments are never shared.
+    SipHash parts_hash;
+    for (const auto & storage_id : storage_ids)
+    {
+        auto storage = DatabaseCatalog::instance().tryGetTable(storage_id, context);
+        const auto * merge_tree = dynamic_cast<const MergeTreeMetaBase *>(storage.get());
+        if (!merge_tree)
+            return std::nullopt;
+        for (const auto & part : merge_tree->getDataPartsVector())
+            parts_hash.update(part->name);
+    }
+
+    return PlanSegmentResultCache::Key{
+        signature, source_update_time, static_cast<UInt32>(plan_segment_instance->info.parallel_id), parts_hash.get64()};
+}
+
 void PlanSegmentExecutor::buildPipeline(QueryPipelinePtr & pipeline, BroadcastSenderPtrs & senders)
 {
     UInt64 current_tx_id = context->getCurrentTransactionID().toUInt64();
@@ -535,15 +609,44 @@ void PlanSegmentExecutor::buildPipeline(QueryPipelinePtr & pipeline, BroadcastSe
         senders_list.emplace_back(std::move(current_exchange_senders));
     }
 
-    pipeline = plan_segment->getQueryPlan().buildQueryPipeline(
-        buildOptimizationSettingsWithCheck(context),
-        BuildQueryPipelineSettings::fromPlanSegment(plan_segment, plan_segment_instance->info, context)
-    );
+    std::optional<PlanSegmentResultCache::Key> result_cache_key = makeSegmentResultCacheKey();
+    PlanSegmentResultCache::EntryPtr cached_result;
+    if (result_cache_key)
+        cached_result = segment_result_cache->get(*result_cache_key);
 
-    pipeline->setTotalsPortToMainPortTransform();
-    pipeline->setExtremesPortToMainPortTransform();
+    if (cached_result)
+    {
+        /// The same segment already ran against an unchanged part set: replay its result
+        /// into the exchange sinks instead of executing the plan again.
+        LOG_DEBUG(logger, "Segment {} result served from segment result cache", plan_segment->getPlanSegmentId());
+        Chunks chunks;
+        chunks.reserve(cached_result->chunks.size());
+        for (const auto & chunk : cached_result->chunks)
+            chunks.emplace_back(chunk.clone());
+        Pipe pipe(std::make_shared<SourceFromChunks>(plan_segment_outputs[0]->getHeader(), std::move(chunks)));
+        pipeline = std::make_unique<QueryPipeline>();
+        pipeline->init(std::move(pipe));
+    }
+    else
+    {
+        pipeline = plan_segment->getQueryPlan().buildQueryPipeline(
+            buildOptimizationSettingsWithCheck(context),
+            BuildQueryPipelineSettings::fromPlanSegment(plan_segment, plan_segment_instance->info, context)
+        );
 
-    registerAllExchangeReceivers(*pipeline, context->getSettingsRef().exchange_wait_accept_max_timeout_ms);
+        pipeline->setTotalsPortToMainPortTransform();
+        pipeline->setExtremesPortToMainPortTransform();
+
+        registerAllExchangeReceivers(*pipeline, context->getSettingsRef().exchange_wait_accept_max_timeout_ms);
+
+        if (result_cache_key)
+        {
+            pipeline->resize(1);
+            segment_result_cache_transform = std::make_shared<StreamInPlanSegmentResultCacheTransform>(
+                pipeline->getHeader(), segment_result_cache, *result_cache_key);
+            pipeline->addTransform(segment_result_cache_transform);
+        }
+    }
 
     pipeline->setMaxThreads(pipeline->getNumThreads());
 
@@ -563,6 +666,7 @@ void PlanSegmentExecutor::buildPipeline(QueryPipelinePtr & pipeline, BroadcastSe
         switch (exchange_mode)
         {
             case ExchangeMode::REPARTITION:
+            case ExchangeMode::BUCKET_REPARTITION:
             case ExchangeMode::LOCAL_MAY_NEED_REPARTITION:
             case ExchangeMode::GATHER:
             {
@@ -699,10 +803,16 @@ void PlanSegmentExecutor::buildPipeline(QueryPipelinePtr & pipeline, BroadcastSe
                 switch (exchange_mode)
                 {
                     case ExchangeMode::REPARTITION:
+                    case ExchangeMode::BUCKET_REPARTITION:
                     case ExchangeMode::LOCAL_MAY_NEED_REPARTITION:
                     case ExchangeMode::GATHER:
                         current_new_processors = buildRepartitionExchangeSink(
-                            current_exchange_senders, keep_order, i, header, segs_output_ports[i]);
+                            current_exchange_senders,
+                            keep_order,
+                            exchange_mode == ExchangeMode::BUCKET_REPARTITION,
+                            i,
+                            header,
+                            segs_output_ports[i]);
                         break;
                     case ExchangeMode::LOCAL_NO_NEED_REPARTITION:
                         current_new_processors = buildLoadBalancedExchangeSink(
@@ -812,7 +922,7 @@ void PlanSegmentExecutor::registerAllExchangeReceivers(const QueryPipeline & pip
 }
 
 Processors PlanSegmentExecutor::buildRepartitionExchangeSink(
-    BroadcastSenderPtrs & senders, bool keep_order, size_t output_index, const Block &header, OutputPortRawPtrs &ports)
+    BroadcastSenderPtrs & senders, bool keep_order, bool bucket_repartition, size_t output_index, const Block & header, OutputPortRawPtrs & ports)
 {
     Processors new_processors;
 
@@ -823,7 +933,11 @@ Processors PlanSegmentExecutor::buildRepartitionExchangeSink(
         arguments.emplace_back(plan_segment_outputs[output_index]->getHeader().getByName(column_name));
         argument_numbers.emplace_back(plan_segment_outputs[output_index]->getHeader().getPositionByName(column_name));
     }
-    auto repartition_func = RepartitionTransform::getDefaultRepartitionFunction(arguments, context);
+    /// A null repartition function makes the sinks scatter rows with the bucket-table hash,
+    /// see RepartitionTransform::doBucketRepartition.
+    ExecutableFunctionPtr repartition_func;
+    if (!bucket_repartition)
+        repartition_func = RepartitionTransform::getDefaultRepartitionFunction(arguments, context);
     size_t partition_num = senders.size();
 
     if (keep_order && context->getSettingsRef().exchange_enable_keep_order_parallel_shuffle && partition_num > 1)
@@ -25,6 +25,7 @@
 #include <Interpreters/DistributedStages/PlanSegment.h>
 #include <Interpreters/DistributedStages/PlanSegmentInstance.h>
 #include <Interpreters/DistributedStages/PlanSegmentProcessList.h>
+#include <Interpreters/DistributedStages/PlanSegmentResultCache.h>
 #include <Interpreters/DistributedStages/RuntimeSegmentsStatus.h>
 #include <Interpreters/QueryLog.h>
 #include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
@@ -40,6 +41,7 @@ namespace DB
 {
 class ThreadGroupStatus;
 struct BlockIO;
+class StreamInPlanSegmentResultCacheTransform;
 
 struct SenderMetrics
 {
@@ -87,12 +89,19 @@ private:
     Progress progress;
     Progress final_progress;
 
-    Processors buildRepartitionExchangeSink(BroadcastSenderPtrs & senders, bool keep_order, size_t output_index, const Block &header, OutputPortRawPtrs &ports);
+    Processors buildRepartitionExchangeSink(
+        BroadcastSenderPtrs & senders, bool keep_order, bool bucket_repartition, size_t output_index, const Block & header, OutputPortRawPtrs & ports);
 
     Processors buildBroadcastExchangeSink(BroadcastSenderPtrs & senders, size_t output_index, const Block &header, OutputPortRawPtrs &ports);
 
     Processors buildLoadBalancedExchangeSink(BroadcastSenderPtrs & senders, size_t output_index, const Block &header, OutputPortRawPtrs &ports);
 
+    /// Returns the segment result cache key when this segment's result can be cached, see PlanSegmentResultCache.
+    std::optional<PlanSegmentResultCache::Key> makeSegmentResultCacheKey();
+
+    PlanSegmentResultCachePtr segment_result_cache;
+    std::shared_ptr<StreamInPlanSegmentResultCacheTransform> segment_result_cache_transform;
+
     void collectSegmentQueryRuntimeMetric(const QueryStatus * query_status);
     void prepareSegmentInfo() const;
     void sendProgress();
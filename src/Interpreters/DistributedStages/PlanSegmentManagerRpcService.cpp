@@ -74,8 +74,10 @@ void PlanSegmentManagerRpcService::cancelQuery(
 
     try
     {
-        auto cancel_code
-            = context->getPlanSegmentProcessList().tryCancelPlanSegmentGroup(request->query_id(), request->coordinator_address());
+        auto cancel_code = request->has_segment_id()
+            ? context->getPlanSegmentProcessList().tryCancelPlanSegment(
+                request->query_id(), request->segment_id(), request->coordinator_address())
+            : context->getPlanSegmentProcessList().tryCancelPlanSegmentGroup(request->query_id(), request->coordinator_address());
         response->set_ret_code(std::to_string(static_cast<int>(cancel_code)));
     }
     catch (...)
@@ -119,9 +121,18 @@ void PlanSegmentManagerRpcService::sendPlanSegmentStatus(
         SegmentSchedulerPtr scheduler = context->getSegmentScheduler();
         /// if retry is successful, this status is not used anymore
         auto bsp_scheduler = scheduler->getBSPScheduler(request->query_id());
+        /// A cancellation the scheduler itself requested to unstick a straggler is handled
+        /// like an ordinary failure, so the instance gets retried on another worker.
+        if (bsp_scheduler && status.is_cancelled
+            && bsp_scheduler->tryConsumeSpeculationCancel(request->segment_id(), request->parallel_index()))
+            status.is_cancelled = false;
         if (bsp_scheduler && !status.is_succeed && !status.is_cancelled)
         {
             bsp_scheduler->updateSegmentStatusCounter(request->segment_id(), request->parallel_index(), status);
+            /// Exchange data lost with a dead worker is recovered by re-running only the
+            /// producer instances that lived there, not by failing the query.
+            if (bsp_scheduler->tryRecoverLostExchangeData(request->segment_id(), request->parallel_index(), status))
+                return;
             if (bsp_scheduler->retryTaskIfPossible(request->segment_id(), request->parallel_index()))
                 return;
         }
@@ -216,6 +227,7 @@ void parseReportProcessorProfileMetricRequest(ProcessorProfileLogElement & profi
     profile_element.elapsed_us = request->elapsed_us();
     profile_element.input_wait_elapsed_us = request->input_wait_elapsed_us();
     profile_element.output_wait_elapsed_us = request->output_wait_elapsed_us();
+    profile_element.scheduling_wait_elapsed_us = request->scheduling_wait_elapsed_us();
     profile_element.id = request->id();
     profile_element.input_rows = request->input_rows();
     profile_element.input_bytes = request->input_bytes();
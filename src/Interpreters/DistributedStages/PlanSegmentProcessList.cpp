@@ -21,6 +21,8 @@
 #include <Interpreters/DistributedStages/PlanSegmentProcessList.h>
 #include <Interpreters/ProcessList.h>
 #include <Common/Exception.h>
+#include <Common/MemoryTracker.h>
+#include <Common/formatReadable.h>
 #include <Common/time.h>
 
 #include <memory>
@@ -111,8 +113,22 @@ PlanSegmentProcessList::insertGroup(const PlanSegment & plan_segment, ContextMut
         }
     }
 
+    /// Reserve the declared peak memory before the group is created. The first segment of a
+    /// query to reach this worker admits the whole query; segments of already admitted
+    /// queries pass through
+    Int64 declared_memory = 0;
+    if (settings.plan_segment_estimated_memory != 0
+        && !initail_query_to_groups.if_contains(initial_query_id, [](auto &) {}))
+    {
+        declared_memory = admitQueryMemory(
+            initial_query_id,
+            settings.plan_segment_estimated_memory,
+            settings.plan_segment_memory_admission_max_wait_ms.totalMilliseconds());
+    }
+
     {
         Element segment_group;
+        bool created = false;
         auto exists = [&](Container::value_type & v) {
             if (v.second->coordinator_address == coordinator_address)
             {
@@ -124,11 +140,18 @@ PlanSegmentProcessList::insertGroup(const PlanSegment & plan_segment, ContextMut
             bool use_query_memory_tracker = settings.exchange_use_query_memory_tracker && !bsp_mode && segment_id != 0;
             size_t queue_bytes = settings.exchange_queue_bytes;
             segment_group = std::make_shared<PlanSegmentGroup>(coordinator_address, initial_query_start_time_ms, use_query_memory_tracker, queue_bytes);
+            segment_group->declared_peak_memory = declared_memory;
             segment_group->emplace(segment_id, nullptr);
+            created = true;
             ctor(initial_query_id, segment_group);
         };
 
         initail_query_to_groups.lazy_emplace_l(initial_query_id, exists, emplace);
+
+        /// Another segment created the group (and made its own reservation) first
+        if (!created && declared_memory != 0)
+            releaseQueryMemory(declared_memory);
+
         if (!segment_group)
             throw Exception(
                 "Distributed query with id = " + initial_query_id + " is already running and can't be stopped",
@@ -138,6 +161,53 @@ PlanSegmentProcessList::insertGroup(const PlanSegment & plan_segment, ContextMut
     }
 }
 
+Int64 PlanSegmentProcessList::admitQueryMemory(const String & initial_query_id, Int64 declared_memory, UInt64 max_wait_ms)
+{
+    Int64 budget = total_memory_tracker.getHardLimit();
+    if (budget <= 0)
+        return 0;
+
+    std::unique_lock lock(admission_mutex);
+    /// A query larger than the whole budget is still admitted once it runs alone,
+    /// its own memory tracker is the last line of defence then
+    auto fits = [&] { return admitted_declared_memory == 0 || admitted_declared_memory + declared_memory <= budget; };
+    if (!fits())
+    {
+        LOG_DEBUG(
+            logger,
+            "Query {} declared {} of peak memory while running queries already declared {} of {}, queueing",
+            initial_query_id,
+            ReadableSize(declared_memory),
+            ReadableSize(admitted_declared_memory),
+            ReadableSize(budget));
+
+        if (!max_wait_ms || !admission_cv.wait_for(lock, std::chrono::milliseconds(max_wait_ms), fits))
+            throw Exception(
+                ErrorCodes::TOO_MANY_SIMULTANEOUS_QUERIES,
+                "Query {} declared {} of peak memory, but running queries already declared {} of {} and none finished in {} ms",
+                initial_query_id,
+                ReadableSize(declared_memory),
+                ReadableSize(admitted_declared_memory),
+                ReadableSize(budget),
+                max_wait_ms);
+    }
+
+    admitted_declared_memory += declared_memory;
+    return declared_memory;
+}
+
+void PlanSegmentProcessList::releaseQueryMemory(Int64 declared_memory)
+{
+    if (declared_memory <= 0)
+        return;
+
+    {
+        std::unique_lock lock(admission_mutex);
+        admitted_declared_memory -= declared_memory;
+    }
+    admission_cv.notify_all();
+}
+
 PlanSegmentProcessList::EntryPtr PlanSegmentProcessList::insertProcessList(const Element segment_group, const PlanSegment & plan_segment, ContextMutablePtr query_context, bool force)
 {
     const String & initial_query_id = plan_segment.getQueryId();
@@ -247,6 +317,7 @@ bool PlanSegmentProcessList::remove(const String & initial_query_id, UInt32 segm
         if (segment_group->empty())
         {
             LOG_TRACE(logger, "Remove segment group for distributed query {}@{}", initial_query_id, segment_group->coordinator_address);
+            releaseQueryMemory(segment_group->declared_peak_memory.exchange(0));
             std::unique_lock lock(group_to_erase_mutex);
             if (!before_execute)
             {
@@ -307,6 +378,32 @@ CancellationCode PlanSegmentProcessList::tryCancelPlanSegmentGroup(const String
     return res;
 }
 
+CancellationCode PlanSegmentProcessList::tryCancelPlanSegment(const String & initial_query_id, UInt32 segment_id, String coordinator_address)
+{
+    Element segment_group;
+
+    initail_query_to_groups.if_contains(initial_query_id, [&](auto & it){
+        segment_group = it.second;
+    });
+    if (!segment_group.get())
+        return CancellationCode::NotFound;
+
+    if (!coordinator_address.empty() && segment_group->coordinator_address != coordinator_address)
+    {
+        LOG_WARNING(
+            logger,
+            "Fail to cancel segment {} of distributed query[{}@{}], coordinator_address doesn't match, seg coordinator address is {}",
+            segment_id,
+            initial_query_id,
+            coordinator_address,
+            segment_group->coordinator_address
+        );
+        return CancellationCode::CancelCannotBeSent;
+    }
+
+    return segment_group->tryCancel(segment_id, true) ? CancellationCode::CancelSent : CancellationCode::NotFound;
+}
+
 PlanSegmentProcessListEntry::PlanSegmentProcessListEntry(
     PlanSegmentProcessList & parent_, Element status_, String initial_query_id_, UInt32 segment_id_)
     : parent(parent_), status(status_), initial_query_id(std::move(initial_query_id_)), segment_id(segment_id_)
@@ -28,6 +28,7 @@
 #include <Poco/Logger.h>
 #include <common/types.h>
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -93,6 +94,8 @@ public:
     MemoryTracker memory_tracker{VariableContext::Process};
     // for all planSegment
     std::shared_ptr<MemoryController> memory_controller = nullptr;
+    /// Peak memory the query declared on admission, returned to the arbiter when the group is emptied
+    std::atomic<Int64> declared_peak_memory{0};
 };
 
 class PlanSegmentProcessList;
@@ -141,11 +144,26 @@ public:
 
     CancellationCode tryCancelPlanSegmentGroup(const String & initial_query_id, String coordinator_address = "");
 
+    /// Cancel a single segment of the distributed query, leaving its siblings running.
+    CancellationCode tryCancelPlanSegment(const String & initial_query_id, UInt32 segment_id, String coordinator_address = "");
+
     bool remove(const String & initial_query_id, UInt32 segment_id, bool before_execute = false);
 
 private:
     bool tryEraseGroup();
     bool shouldEraseGroup();
+
+    /// Worker-level memory arbiter. Queries declare their estimated per-worker peak memory
+    /// (plan_segment_estimated_memory); a new query is admitted once the sum of declared peaks
+    /// of running queries leaves room within the server memory limit, queues up to
+    /// plan_segment_memory_admission_max_wait_ms otherwise and is rejected after that.
+    /// Returns the amount actually reserved (0 when arbitration is disabled).
+    Int64 admitQueryMemory(const String & initial_query_id, Int64 declared_memory, UInt64 max_wait_ms);
+    void releaseQueryMemory(Int64 declared_memory);
+
+    mutable bthread::Mutex admission_mutex;
+    mutable bthread::ConditionVariable admission_cv;
+    Int64 admitted_declared_memory{0};
     mutable bthread::Mutex group_to_erase_mutex;
     std::set<String> group_to_erase;
     size_t group_to_erase_threshold{64};
@@ -0,0 +1,92 @@
+#include <Interpreters/DistributedStages/PlanSegmentResultCache.h>
+
+#include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
+#include <common/unit.h>
+
+namespace ProfileEvents
+{
+    extern const Event PlanSegmentResultCacheHits;
+    extern const Event PlanSegmentResultCacheMisses;
+};
+
+namespace DB
+{
+
+bool PlanSegmentResultCache::Key::operator==(const Key & other) const
+{
+    return signature == other.signature && source_update_time.toUInt64() == other.source_update_time.toUInt64()
+        && parallel_id == other.parallel_id && assigned_parts_digest == other.assigned_parts_digest;
+}
+
+size_t PlanSegmentResultCache::KeyHasher::operator()(const Key & key) const
+{
+    SipHash hash;
+    hash.update(key.signature);
+    hash.update(key.source_update_time.toUInt64());
+    hash.update(key.parallel_id);
+    hash.update(key.assigned_parts_digest);
+    return hash.get64();
+}
+
+size_t PlanSegmentResultCache::EntryWeight::operator()(const Entry & entry) const
+{
+    size_t res = 0;
+    for (const auto & chunk : entry.chunks)
+        res += chunk.allocatedBytes();
+    return res;
+}
+
+PlanSegmentResultCache::PlanSegmentResultCache() : cache(1_GiB, 1024)
+{
+}
+
+void PlanSegmentResultCache::updateConfiguration(const Poco::Util::AbstractConfiguration & config)
+{
+    std::lock_guard lock(mutex);
+
+    cache.setMaxSize(config.getUInt64("plan_segment_result_cache.max_size_in_bytes", 1_GiB));
+    cache.setMaxCount(config.getUInt64("plan_segment_result_cache.max_entries", 1024));
+
+    max_entry_size_in_bytes = config.getUInt64("plan_segment_result_cache.max_entry_size_in_bytes", 64_MiB);
+    max_entry_size_in_rows = config.getUInt64("plan_segment_result_cache.max_entry_size_in_rows", 30'000'000);
+}
+
+PlanSegmentResultCache::EntryPtr PlanSegmentResultCache::get(const Key & key)
+{
+    auto entry = cache.get(key);
+    if (entry)
+        ProfileEvents::increment(ProfileEvents::PlanSegmentResultCacheHits);
+    else
+        ProfileEvents::increment(ProfileEvents::PlanSegmentResultCacheMisses);
+    return entry;
+}
+
+void PlanSegmentResultCache::trySet(const Key & key, EntryPtr entry)
+{
+    size_t bytes = 0;
+    size_t rows = 0;
+    for (const auto & chunk : entry->chunks)
+    {
+        bytes += chunk.allocatedBytes();
+        rows += chunk.getNumRows();
+    }
+
+    if (!withinEntryLimits(bytes, rows))
+        return;
+
+    cache.set(key, std::move(entry));
+}
+
+bool PlanSegmentResultCache::withinEntryLimits(size_t bytes, size_t rows) const
+{
+    std::lock_guard lock(mutex);
+    return bytes <= max_entry_size_in_bytes && rows <= max_entry_size_in_rows;
+}
+
+void PlanSegmentResultCache::reset()
+{
+    cache.reset();
+}
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Common/CacheBase.h>
+#include <Interpreters/Context_fwd.h>
+#include <Processors/Chunk.h>
+#include <Transaction/TxnTimestamp.h>
+#include <Poco/Util/AbstractConfiguration.h>
+
+namespace DB
+{
+
+/// Worker-side cache of plan segment results.
+///
+/// Dashboard-style workloads re-execute the same scan + filter + partial-aggregation segment
+/// every few seconds. When the tables a segment scans have not changed (i.e. their max commit TS
+/// from the Catalog is the same), re-running the segment produces the same chunks, so they can be
+/// replayed from memory straight into the exchange sinks instead of executing the plan again.
+///
+/// Entries are keyed by a signature of the serialized segment plan plus that commit TS: a commit
+/// to any scanned table yields a different key, and the stale entry ages out of the LRU. Only
+/// segments that read directly from tables are cached (see PlanSegmentExecutor), because results
+/// of segments fed by exchanges depend on upstream scheduling.
+class PlanSegmentResultCache
+{
+public:
+    struct Key
+    {
+        /// Hash of the serialized segment plan; identical repeated queries serialize identically.
+        UInt64 signature;
+        /// Max commit TS of the tables scanned by the segment, so modified tables miss the cache.
+        TxnTimestamp source_update_time;
+        /// Parallel instances of one segment scan different parts, their results must not be mixed.
+        UInt32 parallel_id;
+        /// Digest of the part names assigned to this worker for the scanned tables: the same
+        /// segment executed against a different part assignment must not share an entry.
+        UInt64 assigned_parts_digest;
+
+        bool operator==(const Key & other) const;
+    };
+
+    struct Entry
+    {
+        Chunks chunks;
+    };
+    using EntryPtr = std::shared_ptr<Entry>;
+
+    PlanSegmentResultCache();
+
+    void updateConfiguration(const Poco::Util::AbstractConfiguration & config);
+
+    EntryPtr get(const Key & key);
+
+    /// Stores the entry unless it exceeds the configured per-entry limits.
+    void trySet(const Key & key, EntryPtr entry);
+
+    /// Used by the write path to drop oversized results early instead of buffering them fully.
+    bool withinEntryLimits(size_t bytes, size_t rows) const;
+
+    void reset();
+
+private:
+    struct KeyHasher
+    {
+        size_t operator()(const Key & key) const;
+    };
+
+    struct EntryWeight
+    {
+        size_t operator()(const Entry & entry) const;
+    };
+
+    using Cache = CacheBase<Key, Entry, KeyHasher, EntryWeight>;
+
+    Cache cache;
+
+    mutable std::mutex mutex;
+    size_t max_entry_size_in_bytes /*TSA_GUARDED_BY(mutex)*/ = 64 * 1024 * 1024;
+    size_t max_entry_size_in_rows /*TSA_GUARDED_BY(mutex)*/ = 30'000'000;
+};
+
+using PlanSegmentResultCachePtr = std::shared_ptr<PlanSegmentResultCache>;
+
+}
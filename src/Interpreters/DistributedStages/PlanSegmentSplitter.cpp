@@ -530,6 +530,7 @@ std::vector<std::optional<Partitioning::Handle>> SourceNodeFinder::visitExchange
             return {{Partitioning::Handle::SINGLE}};
         case ExchangeMode::BROADCAST:
         case ExchangeMode::REPARTITION:
+        case ExchangeMode::BUCKET_REPARTITION:
             return {{Partitioning::Handle::FIXED_HASH}};
         case ExchangeMode::LOCAL_NO_NEED_REPARTITION:
         case ExchangeMode::LOCAL_MAY_NEED_REPARTITION:
@@ -643,6 +644,7 @@ std::vector<size_t> ParallelSizeChecker::visitRemoteExchangeSourceNode(QueryPlan
             case ExchangeMode::BROADCAST:
                 continue;
             case ExchangeMode::REPARTITION:
+            case ExchangeMode::BUCKET_REPARTITION:
                 return {segment->getParallelSize()};
             case ExchangeMode::LOCAL_NO_NEED_REPARTITION:
             case ExchangeMode::LOCAL_MAY_NEED_REPARTITION: {
@@ -14,15 +14,18 @@ namespace Protos
 struct RuntimeSegmentsMetrics
 {
     UInt64 cpu_micros;
+    /// High-water mark of the memory tracker of the reporting segment instance, in bytes.
+    Int64 peak_memory_usage;
     Protos::Progress final_progress;
 
-    RuntimeSegmentsMetrics() : cpu_micros(0)
+    RuntimeSegmentsMetrics() : cpu_micros(0), peak_memory_usage(0)
     {
     }
 
     explicit RuntimeSegmentsMetrics(const Protos::RuntimeSegmentsMetrics & metrics_)
     {
         cpu_micros = metrics_.cpu_micros();
+        peak_memory_usage = metrics_.has_peak_memory_usage() ? metrics_.peak_memory_usage() : 0;
         if (metrics_.has_progress())
         {
             final_progress = metrics_.progress();
@@ -32,6 +35,7 @@ struct RuntimeSegmentsMetrics
     void setProtos(Protos::RuntimeSegmentsMetrics & metrics_) const
     {
         metrics_.set_cpu_micros(cpu_micros);
+        metrics_.set_peak_memory_usage(peak_memory_usage);
         *metrics_.mutable_progress() = final_progress;
     }
 };
@@ -125,6 +125,9 @@ TaskResult Scheduler::scheduleTask(PlanSegment * plan_segment_ptr, const Segment
         plan_segment_ptr->setCoordinatorAddress(local_address);
     }
 
+    /// Workers must own their resources before any segment starts executing, so the
+    /// asynchronous resource fan-out is joined right before the first dispatch.
+    dag_graph_ptr->waitForSendResources();
     submitTasks(plan_segment_ptr, task);
 
     dag_graph_ptr->joinAsyncRpcPerStage();
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cstddef>
+#include <vector>
 #include <Interpreters/GinFilter.h>
 #include <roaring.hh>
 #include <Poco/Logger.h>
@@ -90,6 +92,81 @@ void GinFilter::clear()
     rowid_ranges.clear();
 }
 
+namespace
+{
+
+/// Postings lists with a single UINT32_MAX entry mean that every row of the segment matches
+bool isAlwaysMatchList(const GinIndexPostingsListPtr & postings_list)
+{
+    return postings_list->cardinality() == 1 && postings_list->minimum() == UINT32_MAX;
+}
+
+/// Build, for each segment present in every term's container, the conjunction of the terms'
+/// postings lists. The lists are intersected smallest-first, so the roaring containers of the
+/// larger lists are skipped by galloping and the loop stops as soon as the result becomes empty.
+std::shared_ptr<GinSegmentedPostingsListContainer> buildPostingsConjunction(const GinPostingsCache & postings_cache)
+{
+    auto conjunction = std::make_shared<GinSegmentedPostingsListContainer>();
+    if (postings_cache.empty())
+        return conjunction;
+
+    for (const auto & segment_entry : postings_cache.begin()->second)
+    {
+        UInt32 segment_id = segment_entry.first;
+        std::vector<GinIndexPostingsListPtr> postings_lists;
+        postings_lists.reserve(postings_cache.size());
+
+        bool segment_in_all_terms = true;
+        for (const auto & term_postings : postings_cache)
+        {
+            const GinSegmentedPostingsListContainer & container = term_postings.second;
+            auto container_it = container.find(segment_id);
+            if (container_it == container.cend())
+            {
+                segment_in_all_terms = false;
+                break;
+            }
+            /// Always-match lists do not constrain the conjunction
+            if (!isAlwaysMatchList(container_it->second))
+                postings_lists.push_back(container_it->second);
+        }
+        if (!segment_in_all_terms)
+            continue;
+
+        if (postings_lists.empty())
+        {
+            /// Every term always matches in this segment, keep the UINT32_MAX singleton convention
+            auto always_match = std::make_shared<GinIndexPostingsList>();
+            always_match->add(UINT32_MAX);
+            (*conjunction)[segment_id] = always_match;
+            continue;
+        }
+
+        std::sort(postings_lists.begin(), postings_lists.end(), [](const auto & lhs, const auto & rhs) {
+            return lhs->cardinality() < rhs->cardinality();
+        });
+
+        if (postings_lists.size() == 1)
+        {
+            (*conjunction)[segment_id] = postings_lists.front();
+            continue;
+        }
+
+        auto result = std::make_shared<GinIndexPostingsList>(*postings_lists.front());
+        for (size_t i = 1; i < postings_lists.size(); ++i)
+        {
+            *result &= *postings_lists[i];
+            if (result->cardinality() == 0)
+                break;
+        }
+        if (result->cardinality() > 0)
+            (*conjunction)[segment_id] = result;
+    }
+    return conjunction;
+}
+
+}
+
 bool GinFilter::contains(const GinFilter & filter, PostingsCacheForStore & cache_store, roaring::Roaring & filter_result) const
 {
     if (filter.getTerms().empty())
@@ -103,7 +180,12 @@ bool GinFilter::contains(const GinFilter & filter, PostingsCacheForStore & cache
         cache_store.cache[filter.getQueryString()] = postings_cache;
     }
 
-    return match(*postings_cache, filter_result);
+    auto conjunction_it = cache_store.conjunction_cache.find(filter.getQueryString());
+    if (conjunction_it == cache_store.conjunction_cache.end())
+        conjunction_it
+            = cache_store.conjunction_cache.emplace(filter.getQueryString(), buildPostingsConjunction(*postings_cache)).first;
+
+    return match(*postings_cache, *conjunction_it->second, filter_result);
 }
 
 void GinFilter::filpWithRange(roaring::Roaring & result) const
@@ -142,45 +224,32 @@ bool hasEmptyPostingsList(const GinPostingsCache & postings_cache)
     return false;
 }
 
-/// Helper method to check if the postings list cache has intersection with given row ID range
-bool matchInRange(const GinPostingsCache & postings_cache, UInt32 segment_id, UInt32 range_start, UInt32 range_end, roaring::Roaring & filter_result)
+/// Helper method to check if the terms' conjunction has intersection with given row ID range
+bool matchInRange(const GinSegmentedPostingsListContainer & conjunction, UInt32 segment_id, UInt32 range_start, UInt32 range_end, roaring::Roaring & filter_result)
 {
-    /// Check for each term
-    GinIndexPostingsList intersection_result;
-    bool intersection_result_init = false;
-
-    for (const auto & term_postings : postings_cache)
-    {
-        /// Check if it is in the same segment by searching for segment_id
-        const GinSegmentedPostingsListContainer & container = term_postings.second;
-        auto container_it = container.find(segment_id);
-        if (container_it == container.cend())
-            return false;
-        auto min_in_container = container_it->second->minimum();
-        auto max_in_container = container_it->second->maximum();
+    /// Segments missing from the conjunction have no rows matching all terms
+    auto conjunction_it = conjunction.find(segment_id);
+    if (conjunction_it == conjunction.cend())
+        return false;
 
-        //check if the postings list has always match flag
-        if (container_it->second->cardinality() == 1 && UINT32_MAX == min_in_container)
-            continue; //always match
+    const GinIndexPostingsList & postings_list = *conjunction_it->second;
+    auto min_in_container = postings_list.minimum();
+    auto max_in_container = postings_list.maximum();
 
-        if (range_start > max_in_container ||  min_in_container > range_end)
-            return false;
+    //check if the postings list has always match flag
+    if (postings_list.cardinality() == 1 && UINT32_MAX == min_in_container)
+        return true; //always match
 
-        /// Delay initialization as late as possible
-        if (!intersection_result_init)
-        {
-            intersection_result_init = true;
-            intersection_result.addRange(range_start, range_end+1);
-        }
+    if (range_start > max_in_container || min_in_container > range_end)
+        return false;
 
-        intersection_result &= *container_it->second;
+    GinIndexPostingsList intersection_result;
+    intersection_result.addRange(range_start, range_end+1);
+    intersection_result &= postings_list;
 
-        if (intersection_result.cardinality() == 0)
-            return false;
-    }
+    if (intersection_result.cardinality() == 0)
+        return false;
 
-    // we assume there only one term in full text search
-    // so we just get filter result here
     filter_result = std::move(intersection_result);
 
     return true;
@@ -188,14 +257,17 @@ bool matchInRange(const GinPostingsCache & postings_cache, UInt32 segment_id, UI
 
 }
 
-bool GinFilter::match(const GinPostingsCache & postings_cache , roaring::Roaring & filter_result) const
+bool GinFilter::match(
+    const GinPostingsCache & postings_cache,
+    const GinSegmentedPostingsListContainer & conjunction,
+    roaring::Roaring & filter_result) const
 {
     if (hasEmptyPostingsList(postings_cache))
         return false;
 
     /// Check for each row ID ranges
     for (const auto & rowid_range: rowid_ranges)
-        if (matchInRange(postings_cache, rowid_range.segment_id, rowid_range.range_start, rowid_range.range_end, filter_result))
+        if (matchInRange(conjunction, rowid_range.segment_id, rowid_range.range_start, rowid_range.range_end, filter_result))
             return true;
     return false;
 }
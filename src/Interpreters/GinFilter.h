@@ -91,8 +91,12 @@ private:
     /// Row ID ranges which are (segmentID, RowIDStart, RowIDEnd)
     GinSegmentWithRowIdRangeVector rowid_ranges;
 
-    /// Check if the given postings list cache has matched rows by using the filter
-    bool match(const GinPostingsCache & postings_cache, roaring::Roaring & filter_result) const;
+    /// Check if the given postings list cache has matched rows by using the filter.
+    /// `conjunction` holds the per-segment intersection of all terms' postings lists.
+    bool match(
+        const GinPostingsCache & postings_cache,
+        const GinSegmentedPostingsListContainer & conjunction,
+        roaring::Roaring & filter_result) const;
 };
 
 using GinFilters = std::vector<GinFilter>;
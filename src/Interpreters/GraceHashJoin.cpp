@@ -1,5 +1,7 @@
 #include <Core/Joins.h>
 
+#include <Compression/CompressionFactory.h>
+
 #include <Interpreters/GraceHashJoin.h>
 #include <Interpreters/HashJoin.h>
 #include <Interpreters/TableJoin.h>
@@ -9,6 +11,8 @@
 #include <Formats/NativeWriter.h>
 #include <Interpreters/TemporaryDataOnDisk.h>
 #include <Processors/Exchange/DataTrans/BoundedDataQueue.h>
+#include <Storages/DiskCache/DiskCacheFactory.h>
+#include <Storages/DiskCache/IDiskCache.h>
 #include <QueryPlan/PlanSerDerHelper.h>
 #include <Common/MemoryTracker.h>
 #include <Common/thread_local_rng.h>
@@ -326,6 +330,30 @@ void flushBlocksToBuckets(Blocks & blocks, const GraceHashJoin::Buckets & bucket
 }
 }
 
+namespace
+{
+/// When enabled, spill buckets to the volume backing the local merge tree disk cache: on
+/// cache-only NVMe layouts the generic tmp path sits on a slow system disk while the
+/// cache device is mostly idle during joins. The spill keeps the regular temp file
+/// format, it only borrows the faster device, and the files are removed the moment
+/// their bucket is consumed, so the space is returned to the cache immediately.
+TemporaryDataOnDiskScopePtr maybeSpillToDiskCacheVolume(const ContextPtr & context, TemporaryDataOnDiskScopePtr scope)
+{
+    if (!context->getSettingsRef().grace_hash_join_spill_to_disk_cache)
+        return scope;
+
+    auto disk_cache = DiskCacheFactory::instance().tryGet(DiskCacheType::MergeTree);
+    if (!disk_cache)
+        return scope;
+
+    auto volume = disk_cache->getStorageVolume();
+    if (!volume || volume->getDisks().empty())
+        return scope;
+
+    return std::make_shared<TemporaryDataOnDiskScope>(std::move(scope), std::move(volume), /* limit_ = */ 0);
+}
+}
+
 GraceHashJoin::GraceHashJoin(
     ContextPtr context_, std::shared_ptr<TableJoin> table_join_,
     const Block & left_sample_block_,
@@ -347,7 +375,7 @@ GraceHashJoin::GraceHashJoin(
     // todo aron support table_join->getOnlyClause().key_names_left
     , left_key_names(table_join->keyNamesLeft())
     , right_key_names(table_join->keyNamesRight())
-    , tmp_data(std::make_unique<TemporaryDataOnDisk>(tmp_data_, CurrentMetrics::TemporaryFilesForJoin))
+    , tmp_data(std::make_unique<TemporaryDataOnDisk>(maybeSpillToDiskCacheVolume(context_, std::move(tmp_data_)), CurrentMetrics::TemporaryFilesForJoin))
     , hash_join(makeInMemoryJoin())
     , hash_join_sample_block(hash_join->savedBlockSample())
     , max_allowed_mem_size_in_spill(context->getSettingsRef().max_allowed_mem_size_in_join_spill)
@@ -508,13 +536,21 @@ void GraceHashJoin::addBuckets(const size_t bucket_count)
     {
         try
         {
+            /// Spill with the codec configured for temporary files (NONE makes the second pass over
+            /// fixed-width columns a plain memcpy) and reload through mmap when the threshold allows,
+            /// so re-reading a bucket on the probe pass does not go through read syscalls again.
+            auto spill_codec = CompressionCodecFactory::instance().get(table_join->temporaryFilesCodec(), std::nullopt);
+            auto spill_read_settings = context->getReadSettings();
+
             std::shared_ptr<TemporaryFileStreams> left_files = std::make_shared<TemporaryFileStreams>();
             for (int j = 0; j < left_side_parallel; j++)
             {
-                std::shared_ptr<TemporaryFileStream> left_file = tmp_data->createStreamPtrToRegularFile(left_sample_block);
+                std::shared_ptr<TemporaryFileStream> left_file
+                    = tmp_data->createStreamPtrToRegularFile(left_sample_block, 0, spill_codec, spill_read_settings);
                 left_files->push_back(left_file);
             }
-            std::shared_ptr<TemporaryFileStream> right_file = tmp_data->createStreamPtrToRegularFile(prepareRightBlock(right_sample_block));
+            std::shared_ptr<TemporaryFileStream> right_file = tmp_data->createStreamPtrToRegularFile(
+                prepareRightBlock(right_sample_block), 0, spill_codec, spill_read_settings);
             auto read_result_block_size = context->getSettingsRef().grace_hash_join_read_result_block_size;
             auto read_block_bytes = context->getSettingsRef().grace_hash_join_read_result_block_bytes;
             BucketPtr new_bucket = std::make_shared<FileBucket>(current_size + i, left_files, right_file, log, read_result_block_size, read_block_bytes);
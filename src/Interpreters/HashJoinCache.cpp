@@ -0,0 +1,67 @@
+#include <Interpreters/HashJoinCache.h>
+
+#include <chrono>
+
+namespace DB
+{
+
+namespace
+{
+    UInt64 monotonicSeconds()
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+HashJoinCache & HashJoinCache::instance()
+{
+    static HashJoinCache cache;
+    return cache;
+}
+
+JoinPtr HashJoinCache::tryGet(UInt64 key)
+{
+    std::lock_guard lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end())
+        return nullptr;
+    if (it->second.expire_at <= monotonicSeconds())
+    {
+        entries.erase(it);
+        return nullptr;
+    }
+    if (!it->second.ready)
+        return nullptr;
+    return it->second.join;
+}
+
+bool HashJoinCache::add(UInt64 key, JoinPtr join, UInt64 ttl_seconds)
+{
+    std::lock_guard lock(mutex);
+    UInt64 now = monotonicSeconds();
+
+    /// Expired entries are pruned lazily, only when room for a new one is needed.
+    if (entries.size() >= max_entries)
+        for (auto it = entries.begin(); it != entries.end();)
+            it = it->second.expire_at <= now ? entries.erase(it) : std::next(it);
+    if (entries.size() >= max_entries)
+        return false;
+
+    return entries.emplace(key, Entry{std::move(join), false, now + ttl_seconds}).second;
+}
+
+void HashJoinCache::markReady(UInt64 key)
+{
+    std::lock_guard lock(mutex);
+    auto it = entries.find(key);
+    if (it != entries.end())
+        it->second.ready = true;
+}
+
+void HashJoinCache::clear()
+{
+    std::lock_guard lock(mutex);
+    entries.clear();
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Interpreters/IJoin.h>
+#include <common/types.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace DB
+{
+
+/** Worker-local cache of built broadcast join hash tables.
+  *
+  * Broadcast joins rebuild the right-side hash table on every query even though
+  * dimension tables change rarely. JoinStep registers the join under a key derived
+  * from the plan signature of the build side (see SetHashJoinCacheKey) and marks it
+  * ready once the fill finishes; later queries with the same key reuse the structure
+  * and drain the broadcast input unread. Entries expire after their TTL, which bounds
+  * the staleness of the cached data; schema changes alter the key itself.
+  *
+  * A cached join is shared read-only across queries, so reuse is restricted to join
+  * kinds whose probe phase does not mutate the hash table (see JoinStep).
+  */
+class HashJoinCache
+{
+public:
+    static HashJoinCache & instance();
+
+    /// Returns the join cached under the key, or nullptr if it is absent, expired or still being built.
+    JoinPtr tryGet(UInt64 key);
+
+    /// Registers a join about to be built. Returns false (and caches nothing) when the key
+    /// is already present or the cache is full; the entry is invisible until markReady.
+    bool add(UInt64 key, JoinPtr join, UInt64 ttl_seconds);
+
+    /// Makes the entry visible to tryGet once the right side has been fully loaded.
+    void markReady(UInt64 key);
+
+    void clear();
+
+private:
+    struct Entry
+    {
+        JoinPtr join;
+        bool ready = false;
+        UInt64 expire_at = 0; /// monotonic seconds
+    };
+
+    static constexpr size_t max_entries = 64;
+
+    std::mutex mutex;
+    std::unordered_map<UInt64, Entry> entries;
+};
+
+}
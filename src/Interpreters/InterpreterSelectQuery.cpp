@@ -92,10 +92,12 @@
 #include <QueryPlan/Optimizations/QueryPlanOptimizationSettings.h>
 #include <Processors/Sources/NullSource.h>
 #include <Processors/Sources/SourceFromInputStream.h>
+#include <Processors/Sources/SourceFromSingleChunk.h>
 #include <Processors/Transforms/AggregatingTransform.h>
 #include <Processors/Transforms/ExpressionTransform.h>
 #include <Processors/Transforms/FilterTransform.h>
 
+#include <Storages/MergeTree/MergeTreePointLookup.h>
 #include <Storages/MergeTree/MergeTreeWhereOptimizer.h>
 #include <Storages/IStorage.h>
 #include <Storages/StorageView.h>
@@ -483,7 +485,12 @@ InterpreterSelectQuery::InterpreterSelectQuery(
         //     where_with_bitmap_index_optimizer.optimize(query_ptr);
         // }
 
-        if (storage && query.where() && !query.prewhere())
+        /// With late materialization a scan that already carries a PREWHERE still enters the
+        /// optimizer: under the distributed optimizer the probe side of a selective join
+        /// arrives here with its runtime filter placed in PREWHERE by rewriteDynamicFilter(),
+        /// and skipping the optimizer would fall back to a single-stage read of all columns.
+        bool late_materialize_with_prewhere = storage_support_late_materialize && query.prewhere();
+        if (storage && ((query.where() && !query.prewhere()) || late_materialize_with_prewhere))
         {
             /// PREWHERE optimization: transfer some condition from WHERE to PREWHERE if enabled and viable
             if (const auto & column_sizes = storage->getColumnSizes(); !column_sizes.empty())
@@ -2069,6 +2076,84 @@ void InterpreterSelectQuery::addPrewhereAliasActions()
     }
 }
 
+bool InterpreterSelectQuery::tryUniqueKeyPointLookup(QueryPlan & query_plan)
+{
+    const Settings & settings = context->getSettingsRef();
+    if (!settings.enable_unique_table_point_lookup || !storage || storage->isRemote() || row_policy_filter)
+        return false;
+
+    const auto * merge_tree = dynamic_cast<const MergeTreeMetaBase *>(storage.get());
+    if (!merge_tree || !metadata_snapshot->hasUniqueKey())
+        return false;
+
+    /// With partition-level unique keys the same key may have a live row per partition,
+    /// so the first index hit is not authoritative and a scan is required.
+    if (merge_tree->getSettings()->partition_level_unique_keys)
+        return false;
+
+    auto & query = getSelectQuery();
+    if (!query.where() || query.prewhere() || query_info.partition_filter || !atomic_predicates_expr.empty())
+        return false;
+
+    auto bound = MergeTreePointLookup::extractEqualityConjunction(query.where());
+    if (!bound)
+        return false;
+
+    /// The whole unique key must be bound with equalities. Extra equality conjuncts are
+    /// fine: the filter step re-applies the WHERE clause to the returned row.
+    Block key_block;
+    for (const auto & name : metadata_snapshot->getUniqueKeyExpression()->getRequiredColumns())
+    {
+        auto it = bound->find(name);
+        if (it == bound->end() || !metadata_snapshot->getColumns().hasPhysical(name))
+            return false;
+
+        auto type = metadata_snapshot->getColumns().getPhysical(name).type;
+        Field value = convertFieldToType(it->second, *type);
+        if (value.isNull() && it->second.getType() != Field::Types::Null)
+            return false;
+
+        auto column = type->createColumn();
+        column->insert(value);
+        key_block.insert({std::move(column), type, name});
+    }
+
+    /// The row is materialized straight from the part, so every column must be physical.
+    for (const auto & name : required_columns)
+        if (!metadata_snapshot->getColumns().hasPhysical(name))
+            return false;
+
+    auto parts = merge_tree->getDataPartsVector();
+    /// Newest part first: the part holding a key's live row is the newest one containing it.
+    std::sort(parts.begin(), parts.end(), [](const auto & lhs, const auto & rhs) { return rhs->info < lhs->info; });
+
+    Block row = MergeTreePointLookup::lookupRow(
+        metadata_snapshot,
+        parts,
+        MergeTreePointLookup::serializeKey(metadata_snapshot, std::move(key_block)),
+        required_columns,
+        context);
+
+    Block header = storage_snapshot->getSampleBlockForColumns(required_columns);
+    Pipe pipe;
+    if (row)
+    {
+        /// Reorder the looked-up row to the sample block layout.
+        Columns columns;
+        columns.reserve(header.columns());
+        for (const auto & column : header)
+            columns.push_back(row.getByName(column.name).column);
+        pipe = Pipe(std::make_shared<SourceFromSingleChunk>(header, Chunk(std::move(columns), 1)));
+    }
+    else
+        pipe = Pipe(std::make_shared<NullSource>(header));
+
+    auto step = std::make_unique<ReadFromPreparedSource>(std::move(pipe), context);
+    step->setStepDescription("Unique key point lookup");
+    query_plan.addStep(std::move(step));
+    return true;
+}
+
 void InterpreterSelectQuery::executeFetchColumns(QueryProcessingStage::Enum processing_stage, QueryPlan & query_plan)
 {
     auto & query = getSelectQuery();
@@ -2364,7 +2449,7 @@ void InterpreterSelectQuery::executeFetchColumns(QueryProcessingStage::Enum proc
         // fmt::print(stderr, "Fetching column: {}\n", ss.str());
         if (options.distributed_stages)
             storage->read(query_plan, required_columns, storage_snapshot, query_info, context, processing_stage, max_block_size, max_streams, true);
-        else
+        else if (!tryUniqueKeyPointLookup(query_plan))
             storage->read(query_plan, required_columns, storage_snapshot, query_info, context, processing_stage, max_block_size, max_streams);
 
         if (context->hasQueryContext() && !options.is_internal)
@@ -168,6 +168,12 @@ private:
     /// Different stages of query execution.
 
     void executeFetchColumns(QueryProcessingStage::Enum processing_stage, QueryPlan & query_plan);
+
+    /// Serve a point lookup on a unique table straight from the per-part key indexes
+    /// instead of setting up a scan (see enable_unique_table_point_lookup). Adds a
+    /// prepared source with the looked-up row to the plan and returns true on success;
+    /// the rest of the plan still runs on top of it, so WHERE is re-applied as usual.
+    bool tryUniqueKeyPointLookup(QueryPlan & query_plan);
     void executeWhere(QueryPlan & query_plan, const ActionsDAGPtr & expression, bool remove_filter);
     void executeAggregation(
         QueryPlan & query_plan, const ActionsDAGPtr & expression, bool overflow_row, bool final, InputOrderInfoPtr group_by_info);
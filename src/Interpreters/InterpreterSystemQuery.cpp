@@ -30,6 +30,10 @@
 #include <Common/ThreadPool.h>
 #include <Common/escapeForFileName.h>
 #include <Common/ShellCommand.h>
+#include <Compression/CompressionCodecBenchmark.h>
+#include <IO/WriteBufferFromString.h>
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
+#include <Storages/MergeTree/IMergeTreeReader.h>
 #include <MergeTreeCommon/CnchServerTopology.h>
 #include <MergeTreeCommon/CnchServerManager.h>
 #include <MergeTreeCommon/CnchTopologyMaster.h>
@@ -560,6 +564,9 @@ BlockIO InterpreterSystemQuery::executeCnchCommand(ASTSystemQuery & query, Conte
         case Type::RECALCULATE_METRICS:
             recalculateMetrics(query);
             break;
+        case Type::BENCHMARK_CODECS:
+            benchmarkCodecs(query);
+            break;
         case Type::DROP_VIEW_META:
             dropMvMeta(query);
             break;
@@ -1124,6 +1131,86 @@ void InterpreterSystemQuery::recalculateMetrics(ASTSystemQuery & query)
     mgr->forceRecalculate(table);
 }
 
+void InterpreterSystemQuery::benchmarkCodecs(ASTSystemQuery &)
+{
+    getContext()->checkAccess(AccessType::SYSTEM_BENCHMARK_CODECS, table_id);
+
+    StoragePtr table = DatabaseCatalog::instance().getTable(table_id, getContext());
+    auto * merge_tree = dynamic_cast<MergeTreeMetaBase *>(table.get());
+    if (!merge_tree)
+        throw Exception("SYSTEM BENCHMARK CODECS FOR is only supported for MergeTree tables", ErrorCodes::NOT_IMPLEMENTED);
+
+    /// Sample real data from the newest local part; codec behaviour on synthetic data is
+    /// exactly the guesswork this command replaces.
+    MergeTreeMetaBase::DataPartPtr sample_part;
+    for (const auto & part : merge_tree->getDataPartsVector())
+        if (part->rows_count)
+        {
+            sample_part = part;
+            break;
+        }
+    if (!sample_part)
+        throw Exception(
+            "No local data parts to sample, run SYSTEM BENCHMARK CODECS FOR on a node holding parts of the table",
+            ErrorCodes::BAD_ARGUMENTS);
+
+    auto metadata_snapshot = merge_tree->getInMemoryMetadataPtr();
+    constexpr size_t max_sample_rows = 65536;
+    size_t rows_to_read = std::min<size_t>(sample_part->rows_count, max_sample_rows);
+    size_t marks_count = sample_part->getMarksCount();
+    MergeTreeReaderSettings reader_settings{.save_marks_in_cache = false};
+
+    for (const auto & column : metadata_snapshot->getColumns().getAllPhysical())
+    {
+        Columns sampled(1);
+        auto reader = sample_part->getReader(
+            NamesAndTypesList{column},
+            metadata_snapshot,
+            MarkRanges{MarkRange(0, marks_count)},
+            /* uncompressed_cache = */ nullptr,
+            getContext()->getMarkCache().get(),
+            reader_settings);
+        size_t read = reader->readRows(0, marks_count, 0, rows_to_read, sampled);
+        if (!read || !sampled[0])
+            continue;
+
+        WriteBufferFromOwnString sample_buf;
+        auto serialization = column.type->getDefaultSerialization();
+        ISerialization::SerializeBinaryBulkSettings serialize_settings;
+        serialize_settings.getter = [&sample_buf](ISerialization::SubstreamPath) -> WriteBuffer * { return &sample_buf; };
+        ISerialization::SerializeBinaryBulkStatePtr serialize_state;
+        serialization->serializeBinaryBulkStatePrefix(serialize_settings, serialize_state);
+        serialization->serializeBinaryBulkWithMultipleStreams(*sampled[0], 0, read, serialize_settings, serialize_state);
+        serialization->serializeBinaryBulkStateSuffix(serialize_settings, serialize_state);
+
+        auto results = benchmarkCompressionCodecs(sample_buf.str(), column.type);
+        for (const auto & result : results)
+            LOG_INFO(
+                log,
+                "Codec benchmark for column {} of {} ({} rows from part {}): {} ratio {:.2f}, compress {:.0f} MB/s, decompress {:.0f} MB/s",
+                backQuoteIfNeed(column.name),
+                table_id.getNameForLogs(),
+                read,
+                sample_part->name,
+                result.codec,
+                result.compression_ratio,
+                result.compress_mbps,
+                result.decompress_mbps);
+
+        if (const auto * recommended = chooseRecommendedCodec(results))
+            LOG_INFO(
+                log,
+                "Recommended codec for column {} of {}: {} (apply with ALTER TABLE {} MODIFY COLUMN {} {} {})",
+                backQuoteIfNeed(column.name),
+                table_id.getNameForLogs(),
+                recommended->codec,
+                table_id.getFullTableName(),
+                backQuoteIfNeed(column.name),
+                column.type->getName(),
+                recommended->codec);
+    }
+}
+
 void InterpreterSystemQuery::syncReplica(ASTSystemQuery &)
 {
     getContext()->checkAccess(AccessType::SYSTEM_SYNC_REPLICA, table_id);
@@ -1469,6 +1556,11 @@ AccessRightsElements InterpreterSystemQuery::getRequiredAccessForDDLOnCluster()
             required_access.emplace_back(AccessType::SYSTEM_RECALCULATE_METRICS, query.database, query.table);
             break;
         }
+        case Type::BENCHMARK_CODECS:
+        {
+            required_access.emplace_back(AccessType::SYSTEM_BENCHMARK_CODECS, query.database, query.table);
+            break;
+        }
         case Type::FLUSH_DISTRIBUTED:
         {
             required_access.emplace_back(AccessType::SYSTEM_FLUSH_DISTRIBUTED, query.database, query.table);
@@ -71,6 +71,9 @@ private:
     void restartReplicas(ContextMutablePtr system_context);
     void syncReplica(ASTSystemQuery & query);
     void recalculateMetrics(ASTSystemQuery & query);
+    /// Sample real column data from a local part and benchmark codec candidates over it,
+    /// logging per-column measurements and an ALTER-ready recommendation.
+    void benchmarkCodecs(ASTSystemQuery & query);
 
     void restoreReplica();
 
@@ -3,6 +3,9 @@
 #if USE_EMBEDDED_COMPILER
 
 #include <sys/mman.h>
+#include <unistd.h>
+
+#include <filesystem>
 
 #include <boost/noncopyable.hpp>
 
@@ -27,11 +30,14 @@
 #include <llvm/Support/SmallVectorMemoryBuffer.h>
 
 #include <common/getPageSize.h>
+#include <Common/ClickHouseRevision.h>
 #include <Common/Exception.h>
 #include <Common/formatReadable.h>
 #include <common/logger_useful.h>
+#include <Common/hex.h>
 #include <Common/PODArray.h>
 #include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
 #include <Common/BitHelpers.h>
 
 namespace DB
@@ -93,6 +99,72 @@ private:
     llvm::TargetMachine & target_machine;
 };
 
+CompiledModuleObjectCache & CompiledModuleObjectCache::instance()
+{
+    static CompiledModuleObjectCache cache;
+    return cache;
+}
+
+void CompiledModuleObjectCache::init(const std::string & path_)
+{
+    std::filesystem::create_directories(path_);
+    path = path_;
+}
+
+std::string CompiledModuleObjectCache::getFilePath(const UInt128 & key) const
+{
+    return std::filesystem::path(path) / (getHexUIntLowercase(key) + ".o");
+}
+
+std::unique_ptr<llvm::MemoryBuffer> CompiledModuleObjectCache::tryGet(const UInt128 & key) const
+{
+    if (!enabled())
+        return nullptr;
+
+    auto file = llvm::MemoryBuffer::getFile(getFilePath(key));
+    if (!file)
+        return nullptr;
+
+    return std::move(*file);
+}
+
+void CompiledModuleObjectCache::put(const UInt128 & key, const llvm::MemoryBuffer & object) const
+{
+    if (!enabled())
+        return;
+
+    auto file_path = getFilePath(key);
+    /// Write to a process-unique temporary name first, the rename makes concurrent
+    /// writers of the same key harmless and readers never observe a partial file.
+    auto tmp_file_path = fmt::format("{}.{}.tmp", file_path, getpid());
+
+    std::error_code error;
+    llvm::raw_fd_ostream out(tmp_file_path, error);
+    if (error)
+    {
+        LOG_WARNING(
+            &Poco::Logger::get("CompiledModuleObjectCache"),
+            "Cannot write compiled object to {}: {}",
+            tmp_file_path,
+            error.message());
+        return;
+    }
+
+    out << object.getBuffer();
+    out.close();
+
+    std::error_code cleanup_error;
+    if (out.has_error())
+    {
+        std::filesystem::remove(tmp_file_path, cleanup_error);
+        return;
+    }
+
+    std::filesystem::rename(tmp_file_path, file_path, cleanup_error);
+    if (cleanup_error)
+        std::filesystem::remove(tmp_file_path, cleanup_error);
+}
+
 /** Arena that allocate all memory with system page_size.
   * All allocated pages can be protected with protection_flags using protect method.
   * During destruction all allocated pages protection_flags will be reset.
@@ -443,12 +515,37 @@ std::unique_ptr<llvm::Module> CHJIT::createModuleForCompilation()
 
 CHJIT::CompiledModule CHJIT::compileModule(std::unique_ptr<llvm::Module> module)
 {
-    runOptimizationPassesOnModule(*module);
+    auto & object_cache = CompiledModuleObjectCache::instance();
 
-    auto buffer = compiler->compile(*module);
+    /// The key is taken before optimization, so a hit skips both the optimization
+    /// passes and code generation and goes straight to linking.
+    UInt128 object_cache_key{};
+    std::unique_ptr<llvm::MemoryBuffer> buffer;
+    if (object_cache.enabled())
+    {
+        object_cache_key = getModuleKeyForObjectCache(*module);
+        buffer = object_cache.tryGet(object_cache_key);
+    }
+
+    bool compiled_now = !buffer;
+    if (compiled_now)
+    {
+        runOptimizationPassesOnModule(*module);
+        buffer = compiler->compile(*module);
+    }
 
     llvm::Expected<std::unique_ptr<llvm::object::ObjectFile>> object = llvm::object::ObjectFile::createObjectFile(*buffer);
 
+    if (!object && !compiled_now)
+    {
+        /// A truncated or corrupt cache entry must not fail the query: recompile and overwrite it.
+        llvm::consumeError(object.takeError());
+        runOptimizationPassesOnModule(*module);
+        buffer = compiler->compile(*module);
+        compiled_now = true;
+        object = llvm::object::ObjectFile::createObjectFile(*buffer);
+    }
+
     if (!object)
     {
         std::string error_message;
@@ -491,9 +588,43 @@ CHJIT::CompiledModule CHJIT::compileModule(std::unique_ptr<llvm::Module> module)
 
     compiled_code_size.fetch_add(compiled_module.size, std::memory_order_relaxed);
 
+    if (compiled_now && object_cache.enabled())
+        object_cache.put(object_cache_key, *buffer);
+
     return compiled_module;
 }
 
+UInt128 CHJIT::getModuleKeyForObjectCache(const llvm::Module & module) const
+{
+    std::string ir;
+    llvm::raw_string_ostream ir_stream(ir);
+    module.print(ir_stream, nullptr);
+    ir_stream.flush();
+
+    SipHash hash;
+    /// Object code is only reusable on the same target and server build
+    hash.update(machine->getTargetTriple().getTriple());
+    hash.update(machine->getTargetCPU().str());
+    hash.update(machine->getTargetFeatureString().str());
+    hash.update(ClickHouseRevision::getVersionRevision());
+
+    /// Hash the IR line by line, skipping the header with the module identifier:
+    /// the per-process module counter must not change the key between restarts.
+    size_t pos = 0;
+    while (pos < ir.size())
+    {
+        size_t line_end = ir.find('\n', pos);
+        if (line_end == std::string::npos)
+            line_end = ir.size() - 1;
+        std::string_view line(ir.data() + pos, line_end - pos + 1);
+        if (!line.starts_with("; ModuleID =") && !line.starts_with("source_filename ="))
+            hash.update(line.data(), line.size());
+        pos = line_end + 1;
+    }
+
+    return hash.get128();
+}
+
 void CHJIT::deleteCompiledModule(const CHJIT::CompiledModule & module)
 {
     std::lock_guard<std::mutex> lock(jit_lock);
@@ -9,9 +9,11 @@
 #include <unordered_map>
 #include <atomic>
 
+#    include <common/types.h>
 #    include <Interpreters/JIT/JITContext.h>
 #    include <llvm/IR/LLVMContext.h> // Y_IGNORE
 #    include <llvm/IR/Module.h> // Y_IGNORE
+#    include <llvm/Support/MemoryBuffer.h> // Y_IGNORE
 #    include <llvm/Target/TargetMachine.h> // Y_IGNORE
 
 namespace DB
@@ -21,6 +23,34 @@ class JITModuleMemoryManager;
 class JITSymbolResolver;
 class JITCompiler;
 
+/** On-disk cache of compiled object files keyed by hash of the module IR.
+  * Object code is kept before linking, relocations are resolved by RuntimeDyld on every load,
+  * so entries stay valid across process restarts. Freshly scaled or restarted workers then link
+  * hot expressions from local disk instead of running the optimization passes and codegen again.
+  * Disabled until init is called with the configured path.
+  */
+class CompiledModuleObjectCache
+{
+public:
+    static CompiledModuleObjectCache & instance();
+
+    /// Enable the cache. Must be called before the first compilation, typically at server startup.
+    void init(const std::string & path_);
+
+    bool enabled() const { return !path.empty(); }
+
+    /// Returns the cached object file for the key, or nullptr on miss or when disabled.
+    std::unique_ptr<llvm::MemoryBuffer> tryGet(const UInt128 & key) const;
+
+    /// Store the object file under the key. Failures are only logged, they cost a recompilation.
+    void put(const UInt128 & key, const llvm::MemoryBuffer & object) const;
+
+private:
+    std::string getFilePath(const UInt128 & key) const;
+
+    std::string path;
+};
+
 /** Custom jit implementation
   * Main use cases:
   * 1. Compiled functions in module.
@@ -98,6 +128,8 @@ private:
 
     std::string getMangledName(const std::string & name_to_mangle) const;
 
+    UInt128 getModuleKeyForObjectCache(const llvm::Module & module) const;
+
     void runOptimizationPassesOnModule(llvm::Module & module) const;
 
     static std::unique_ptr<llvm::TargetMachine> getTargetMachine();
@@ -298,11 +298,24 @@ ProcessList::EntryPtr ProcessList::insert(const String & query_, const IAST * as
                     ErrorCodes::LOGICAL_ERROR);
         }
 
+        /// The admission check above runs under `mutex`, but the emplace into the concurrent
+        /// map happens after the lock is released, so parallel inserts could overshoot the
+        /// hard limit. Re-validate now that this entry is visible: whoever pushed the size
+        /// past the limit removes itself again.
+        if (!is_unlimited_query && max_size && processes.size() > max_size)
+        {
+            processes.erase(client_info.current_query_id);
+            throw Exception("Too many simultaneous queries. Maximum: " + toString(max_size),
+                    ErrorCodes::TOO_MANY_SIMULTANEOUS_QUERIES);
+        }
+
         res = std::make_shared<Entry>(*this, query_status);
 
-        std::unique_lock lock(mutex);
         query_status->type = query_type;
-        ProcessListForUser & user_process_list = user_to_queries[client_info.current_user];
+
+        auto & shard = getUserShard(client_info.current_user);
+        std::unique_lock lock(shard.mutex);
+        ProcessListForUser & user_process_list = shard.user_to_queries[client_info.current_user];
 
         auto query_it = user_process_list.queries.emplace(client_info.current_query_id, query_status);
         if (!query_it.second)
@@ -381,55 +394,63 @@ void ProcessList::checkRunningQuery(ContextPtr query_context, bool is_unlimited_
     
     const ClientInfo & client_info = query_context->getClientInfo();
     const Settings & settings = query_context->getSettingsRef();
-    std::unique_lock lock(mutex);
-    auto user_process_list = user_to_queries.find(client_info.current_user);
 
-    if (user_process_list != user_to_queries.end())
     {
-        if (!is_unlimited_query && settings.max_concurrent_queries_for_user
-            && user_process_list->second.queries.size() >= settings.max_concurrent_queries_for_user)
-            throw Exception("Too many simultaneous queries for user " + client_info.current_user
-                + ". Current: " + toString(user_process_list->second.queries.size())
-                + ", maximum: " + settings.max_concurrent_queries_for_user.toString(),
-                ErrorCodes::TOO_MANY_SIMULTANEOUS_QUERIES);
-
-        auto running_query = user_process_list->second.queries.find(client_info.current_query_id);
+        auto & shard = getUserShard(client_info.current_user);
+        std::unique_lock lock(shard.mutex);
+        auto user_process_list = shard.user_to_queries.find(client_info.current_user);
 
-        if (running_query != user_process_list->second.queries.end())
+        if (user_process_list != shard.user_to_queries.end())
         {
-            if (!force && !settings.replace_running_query)
-                throw Exception("Query with id = " + client_info.current_query_id + " is already running.",
-                    ErrorCodes::QUERY_WITH_SAME_ID_IS_ALREADY_RUNNING);
+            if (!is_unlimited_query && settings.max_concurrent_queries_for_user
+                && user_process_list->second.queries.size() >= settings.max_concurrent_queries_for_user)
+                throw Exception("Too many simultaneous queries for user " + client_info.current_user
+                    + ". Current: " + toString(user_process_list->second.queries.size())
+                    + ", maximum: " + settings.max_concurrent_queries_for_user.toString(),
+                    ErrorCodes::TOO_MANY_SIMULTANEOUS_QUERIES);
 
-            /// Ask queries to cancel. They will check this flag.
-            running_query->second->is_killed.store(QueryStatus::EXTERNAL_KILL_BIT, std::memory_order_relaxed);
+            auto running_query = user_process_list->second.queries.find(client_info.current_query_id);
 
-            const auto replace_running_query_max_wait_ms = settings.replace_running_query_max_wait_ms.totalMilliseconds();
-            if (!replace_running_query_max_wait_ms || !have_space.wait_for(lock, std::chrono::milliseconds(replace_running_query_max_wait_ms),
-                [&]
-                {
-                    running_query = user_process_list->second.queries.find(client_info.current_query_id);
-                    if (running_query == user_process_list->second.queries.end())
-                        return true;
-                    running_query->second->is_killed.store(QueryStatus::EXTERNAL_KILL_BIT, std::memory_order_relaxed);
-                    return false;
-                }))
+            if (running_query != user_process_list->second.queries.end())
             {
-                throw Exception("Query with id = " + client_info.current_query_id + " is already running and can't be stopped",
-                    ErrorCodes::QUERY_WITH_SAME_ID_IS_ALREADY_RUNNING);
-            }
-         }
+                if (!force && !settings.replace_running_query)
+                    throw Exception("Query with id = " + client_info.current_query_id + " is already running.",
+                        ErrorCodes::QUERY_WITH_SAME_ID_IS_ALREADY_RUNNING);
+
+                /// Ask queries to cancel. They will check this flag.
+                running_query->second->is_killed.store(QueryStatus::EXTERNAL_KILL_BIT, std::memory_order_relaxed);
+
+                const auto replace_running_query_max_wait_ms = settings.replace_running_query_max_wait_ms.totalMilliseconds();
+                if (!replace_running_query_max_wait_ms || !shard.query_removed.wait_for(lock, std::chrono::milliseconds(replace_running_query_max_wait_ms),
+                    [&]
+                    {
+                        running_query = user_process_list->second.queries.find(client_info.current_query_id);
+                        if (running_query == user_process_list->second.queries.end())
+                            return true;
+                        running_query->second->is_killed.store(QueryStatus::EXTERNAL_KILL_BIT, std::memory_order_relaxed);
+                        return false;
+                    }))
+                {
+                    throw Exception("Query with id = " + client_info.current_query_id + " is already running and can't be stopped",
+                        ErrorCodes::QUERY_WITH_SAME_ID_IS_ALREADY_RUNNING);
+                }
+             }
+        }
     }
 
-    /// Check other users running query with our query_id
-    for (const auto & process_list_for_user : user_to_queries)
+    /// Check other users running a query with our query_id. `processes` is keyed by query_id,
+    /// so one sharded lookup replaces the former scan over every user under the global mutex.
+    String other_user;
+    processes.if_contains(client_info.current_query_id, [&](const auto & running_query)
     {
-        if (process_list_for_user.first == client_info.current_user)
-            continue;
-        if (auto running_query = process_list_for_user.second.queries.find(client_info.current_query_id); running_query != process_list_for_user.second.queries.end())
-            throw Exception("Query with id = " + client_info.current_query_id + " is already running by user " + process_list_for_user.first,
-                ErrorCodes::QUERY_WITH_SAME_ID_IS_ALREADY_RUNNING);
-    }
+        const String & running_user = running_query.second->getClientInfo().current_user;
+        if (running_user != client_info.current_user)
+            other_user = running_user;
+    });
+
+    if (!other_user.empty())
+        throw Exception("Query with id = " + client_info.current_query_id + " is already running by user " + other_user,
+            ErrorCodes::QUERY_WITH_SAME_ID_IS_ALREADY_RUNNING);
 }
 
 ProcessListEntry::~ProcessListEntry()
@@ -447,15 +468,23 @@ ProcessListEntry::~ProcessListEntry()
     if (parent.processes.empty())
         parent.total_network_throttler.reset();
 
-    std::unique_lock lock(parent.mutex);
+    {
+        std::unique_lock lock(parent.mutex);
+
+        /// Wait for the query if it is in the cancellation right now.
+        parent.cancelled_cv.wait(lock, [&]() { return it->is_cancelling == false; });
 
-    /// Wait for the query if it is in the cancellation right now.
-    parent.cancelled_cv.wait(lock, [&]() { return it->is_cancelling == false; });
+        parent.have_space.notify_all();
+    }
 
-    auto user_process_list_it = parent.user_to_queries.find(user);
-    if (user_process_list_it == parent.user_to_queries.end())
+    auto & shard = parent.getUserShard(user);
+    std::lock_guard shard_lock(shard.mutex);
+
+    auto user_process_list_it = shard.user_to_queries.find(user);
+    if (user_process_list_it == shard.user_to_queries.end())
     {
         LOG_ERROR(&Poco::Logger::get("ProcessList"), "Logical error: cannot find user in ProcessList");
+        return;
     }
 
     ProcessListForUser & user_process_list = user_process_list_it->second;
@@ -464,7 +493,7 @@ ProcessListEntry::~ProcessListEntry()
         LOG_ERROR(&Poco::Logger::get("ProcessList"), "Logical error: cannot find query by query_id and pointer to ProcessListElement in ProcessListForUser");
     }
 
-    parent.have_space.notify_all();
+    shard.query_removed.notify_all();
 
     /// If there are no more queries for the user, then we will reset memory tracker and network throttler.
     if (user_process_list.queries.empty())
@@ -689,8 +718,11 @@ ThrottlerPtr QueryStatus::getUserNetworkThrottler()
 
 std::shared_ptr<QueryStatus> ProcessList::tryGetProcessListElement(const String & current_query_id, const String & current_user)
 {
-    auto user_it = user_to_queries.find(current_user);
-    if (user_it != user_to_queries.end())
+    auto & shard = getUserShard(current_user);
+    std::lock_guard shard_lock(shard.mutex);
+
+    auto user_it = shard.user_to_queries.find(current_user);
+    if (user_it != shard.user_to_queries.end())
     {
         const auto & user_queries = user_it->second.queries;
         auto query_it = user_queries.find(current_query_id);
@@ -753,12 +785,16 @@ void ProcessList::killAllQueries()
     {
         std::lock_guard lock(mutex);
         cancelled_processes.reserve(processes.size());
-        for (const auto & [user, user_queries] : user_to_queries)
+        for (const auto & shard : user_shards)
         {
-            for (const auto & [query_id, status] : user_queries.queries)
+            std::lock_guard shard_lock(shard.mutex);
+            for (const auto & [user, user_queries] : shard.user_to_queries)
             {
-                cancelled_processes.push_back(status);
-                status->is_cancelling = true;
+                for (const auto & [query_id, status] : user_queries.queries)
+                {
+                    cancelled_processes.push_back(status);
+                    status->is_cancelling = true;
+                }
             }
         }
     }
@@ -839,17 +875,25 @@ ProcessList::Info ProcessList::getInfo(bool get_thread_list, bool get_profile_ev
 {
     Info per_query_infos;
 
-    std::unique_lock lock(mutex);
+    /// Snapshot the running queries under brief per-shard locks, then build the (possibly
+    /// expensive) per-query info without holding any ProcessList lock, so that reading
+    /// system.processes does not stall admission of new queries.
+    std::vector<Element> snapshot;
+    snapshot.reserve(processes.size());
 
-    for (const auto & [user, user_queries] : user_to_queries)
+    for (const auto & shard : user_shards)
     {
-        for (const auto & [query_id, status] : user_queries.queries)
+        std::lock_guard shard_lock(shard.mutex);
+        for (const auto & [user, user_queries] : shard.user_to_queries)
         {
-            per_query_infos.emplace_back(status->getInfo(get_thread_list, get_profile_events, get_settings));
+            for (const auto & [query_id, status] : user_queries.queries)
+                snapshot.push_back(status);
         }
     }
 
-    lock.unlock();
+    per_query_infos.reserve(snapshot.size());
+    for (const auto & status : snapshot)
+        per_query_infos.emplace_back(status->getInfo(get_thread_list, get_profile_events, get_settings));
 
     return per_query_infos;
 }
@@ -876,12 +920,12 @@ ProcessList::UserInfo ProcessList::getUserInfo(bool get_profile_events) const
 {
     UserInfo per_user_infos;
 
-    std::lock_guard lock(mutex);
-
-    per_user_infos.reserve(user_to_queries.size());
-
-    for (const auto & [user, user_queries] : user_to_queries)
-        per_user_infos.emplace(user, user_queries.getInfo(get_profile_events));
+    for (const auto & shard : user_shards)
+    {
+        std::lock_guard shard_lock(shard.mutex);
+        for (const auto & [user, user_queries] : shard.user_to_queries)
+            per_user_infos.emplace(user, user_queries.getInfo(get_profile_events));
+    }
 
     return per_user_infos;
 }
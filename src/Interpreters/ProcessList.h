@@ -40,6 +40,7 @@
 #include <Common/Throttler.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <array>
 #include <list>
 #include <map>
 #include <memory>
@@ -451,8 +452,28 @@ protected:
 
     size_t max_size = 0;        /// 0 means no limit. Otherwise, when limit exceeded, an exception is thrown.
 
-    /// Stores per-user info: queries, statistics and limits
-    UserToQueries user_to_queries;
+    /// Per-user info (queries, statistics and limits) is sharded by a hash of the user name,
+    /// so that admission and removal of short queries by different users do not serialize on
+    /// one global mutex. Entries of a shard's map are never erased and std::unordered_map does
+    /// not invalidate references on rehash, so QueryStatus may keep a plain pointer to its
+    /// ProcessListForUser. Lock order is always ProcessList::mutex before a shard mutex.
+    static constexpr size_t NUM_USER_SHARDS = 16;
+
+    struct UserShard
+    {
+        mutable bthread::Mutex mutex;
+        /// Notified when a query is removed from this shard; used to wait for the query
+        /// being replaced by replace_running_query.
+        mutable bthread::ConditionVariable query_removed;
+        UserToQueries user_to_queries;
+    };
+
+    mutable std::array<UserShard, NUM_USER_SHARDS> user_shards;
+
+    UserShard & getUserShard(const String & user) const
+    {
+        return user_shards[std::hash<std::string>()(user) % NUM_USER_SHARDS];
+    }
 
     /// Stores info about queries grouped by their priority
     QueryPriorities priorities;
@@ -463,7 +484,7 @@ protected:
     /// Limit network bandwidth for hdfs download
     ThrottlerPtr hdfs_download_network_throttler;
 
-    /// Call under lock. Finds process with specified current_user and current_query_id.
+    /// Takes the user's shard lock. Finds process with specified current_user and current_query_id.
     std::shared_ptr<QueryStatus> tryGetProcessListElement(const String & current_query_id, const String & current_user);
 
 public:
@@ -27,6 +27,7 @@ ProcessorProfile::ProcessorProfile(const IProcessor * processor)
     elapsed_us = processor->getElapsedUs();
     input_wait_elapsed_us = processor->getInputWaitElapsedUs();
     output_wait_elapsed_us = processor->getOutputWaitElapsedUs();
+    scheduling_wait_elapsed_us = processor->getSchedulingWaitElapsedUs();
     input_rows = processor->getProcessorDataStats().input_rows;
     input_bytes = processor->getProcessorDataStats().input_bytes;
     output_rows = processor->getProcessorDataStats().output_rows;
@@ -127,6 +128,7 @@ void GroupedProcessorProfile::add(ProcessorId processor_id, const ProcessorProfi
     grouped_elapsed_us = std::max(grouped_elapsed_us, profile->elapsed_us);
     grouped_input_wait_elapsed_us = std::max(grouped_input_wait_elapsed_us, profile->input_wait_elapsed_us);
     grouped_output_wait_elapsed_us = std::max(grouped_output_wait_elapsed_us, profile->output_wait_elapsed_us);
+    grouped_scheduling_wait_elapsed_us = std::max(grouped_scheduling_wait_elapsed_us, profile->scheduling_wait_elapsed_us);
     grouped_input_rows +=  profile->input_rows;
     grouped_input_bytes +=  profile->input_bytes;
     grouped_output_rows +=  profile->output_rows;
@@ -139,6 +141,8 @@ void GroupedProcessorProfile::add(ProcessorId processor_id, const ProcessorProfi
     min_grouped_input_wait_elapsed_us = grouped_input_wait_elapsed_us;
     max_grouped_output_wait_elapsed_us = grouped_output_wait_elapsed_us;
     min_grouped_output_wait_elapsed_us = grouped_output_wait_elapsed_us;
+    max_grouped_scheduling_wait_elapsed_us = grouped_scheduling_wait_elapsed_us;
+    min_grouped_scheduling_wait_elapsed_us = grouped_scheduling_wait_elapsed_us;
 }
 
 std::set<GroupedProcessorProfilePtr> GroupedProcessorProfile::fillChildren(GroupedProcessorProfilePtr & input_processor, std::set<ProcessorId> & visited)
@@ -210,6 +214,9 @@ void GroupedProcessorProfile::addProfileRecursively(GroupedProcessorProfilePtr &
     grouped_output_wait_elapsed_us += profile->grouped_output_wait_elapsed_us;
     max_grouped_output_wait_elapsed_us = std::max(max_grouped_output_wait_elapsed_us, profile->grouped_output_wait_elapsed_us);
     min_grouped_output_wait_elapsed_us = std::min(min_grouped_output_wait_elapsed_us, profile->grouped_output_wait_elapsed_us);
+    grouped_scheduling_wait_elapsed_us += profile->grouped_scheduling_wait_elapsed_us;
+    max_grouped_scheduling_wait_elapsed_us = std::max(max_grouped_scheduling_wait_elapsed_us, profile->grouped_scheduling_wait_elapsed_us);
+    min_grouped_scheduling_wait_elapsed_us = std::min(min_grouped_scheduling_wait_elapsed_us, profile->grouped_scheduling_wait_elapsed_us);
     grouped_input_rows +=  profile->grouped_input_rows;
     grouped_input_bytes +=  profile->grouped_input_bytes;
     grouped_output_rows +=  profile->grouped_output_rows;
@@ -237,6 +244,9 @@ Poco::JSON::Object::Ptr GroupedProcessorProfile::getJsonProfiles()
     json->set("OutputWaitElapsedUs", UInt64(grouped_output_wait_elapsed_us/worker_cnt));
     json->set("MaxOutputWaitElapsedUs", max_grouped_output_wait_elapsed_us);
     json->set("MinOutputWaitElapsedUs", min_grouped_output_wait_elapsed_us);
+    json->set("SchedulingWaitElapsedUs", UInt64(grouped_scheduling_wait_elapsed_us/worker_cnt));
+    json->set("MaxSchedulingWaitElapsedUs", max_grouped_scheduling_wait_elapsed_us);
+    json->set("MinSchedulingWaitElapsedUs", min_grouped_scheduling_wait_elapsed_us);
     json->set("InputRows", grouped_input_rows);
     json->set("InputBytes", grouped_input_bytes);
     json->set("OutputRows", grouped_output_rows);
@@ -33,6 +33,8 @@ struct ProcessorProfile
     UInt64 input_wait_elapsed_us{};
     /// IProcessor::PortFull
     UInt64 output_wait_elapsed_us{};
+    /// Waiting for a free executor thread after becoming ready
+    UInt64 scheduling_wait_elapsed_us{};
 
     size_t input_rows{};
     size_t input_bytes{};
@@ -59,6 +61,7 @@ struct GroupedProcessorProfile
     UInt64 grouped_elapsed_us{};
     UInt64 grouped_input_wait_elapsed_us{};
     UInt64 grouped_output_wait_elapsed_us{};
+    UInt64 grouped_scheduling_wait_elapsed_us{};
 
     UInt64 grouped_input_rows{};
     UInt64 grouped_input_bytes{};
@@ -78,6 +81,8 @@ struct GroupedProcessorProfile
     UInt64 min_grouped_input_wait_elapsed_us{UINT64_MAX};
     UInt64 max_grouped_output_wait_elapsed_us{};
     UInt64 min_grouped_output_wait_elapsed_us{UINT64_MAX};
+    UInt64 max_grouped_scheduling_wait_elapsed_us{};
+    UInt64 min_grouped_scheduling_wait_elapsed_us{UINT64_MAX};
 public:
     GroupedProcessorProfile() = default;
     explicit GroupedProcessorProfile(ProcessorId id_, String name_) : id(id_), processor_name(name_) {}
@@ -49,6 +49,7 @@ NamesAndTypesList ProcessorProfileLogElement::getNamesAndTypes()
         {"elapsed_us", std::make_shared<DataTypeUInt64>()},
         {"input_wait_elapsed_us", std::make_shared<DataTypeUInt64>()},
         {"output_wait_elapsed_us", std::make_shared<DataTypeUInt64>()},
+        {"scheduling_wait_elapsed_us", std::make_shared<DataTypeUInt64>()},
         {"input_rows", std::make_shared<DataTypeUInt64>()},
         {"input_bytes", std::make_shared<DataTypeUInt64>()},
         {"output_rows", std::make_shared<DataTypeUInt64>()},
@@ -80,6 +81,7 @@ void ProcessorProfileLogElement::appendToBlock(MutableColumns & columns) const
     columns[i++]->insert(elapsed_us);
     columns[i++]->insert(input_wait_elapsed_us);
     columns[i++]->insert(output_wait_elapsed_us);
+    columns[i++]->insert(scheduling_wait_elapsed_us);
     columns[i++]->insert(input_rows);
     columns[i++]->insert(input_bytes);
     columns[i++]->insert(output_rows);
@@ -141,6 +143,7 @@ void ProcessorsProfileLog::addLogs(const QueryPipeline *pipeline, const String&
         processor_elem.elapsed_us = processor->getElapsedUs();
         processor_elem.input_wait_elapsed_us = processor->getInputWaitElapsedUs();
         processor_elem.output_wait_elapsed_us = processor->getOutputWaitElapsedUs();
+        processor_elem.scheduling_wait_elapsed_us = processor->getSchedulingWaitElapsedUs();
 
         auto stats = processor->getProcessorDataStats();
         processor_elem.input_rows = stats.input_rows;
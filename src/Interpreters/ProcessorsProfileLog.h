@@ -47,6 +47,8 @@ struct ProcessorProfileLogElement
     UInt32 input_wait_elapsed_us{};
     /// IProcessor::PortFull
     UInt32 output_wait_elapsed_us{};
+    /// Waiting for a free executor thread after becoming ready
+    UInt32 scheduling_wait_elapsed_us{};
 
     size_t input_rows{};
     size_t input_bytes{};
@@ -133,6 +133,37 @@ void BloomFilterWithRange::addFieldKey(const DB::Field & f)
     }
 }
 
+bool BloomFilterWithRange::probeFieldKey(const DB::Field & f) const
+{
+    /// Partitioned filters are split by exchange partition id, so a value may live in any
+    /// of the parts; membership of a single key cannot be decided here.
+    if (num_partitions)
+        return true;
+
+    switch (f.getType())
+    {
+        case Field::Types::UInt64:
+            return probeKey(f.get<UInt64>());
+        case Field::Types::Int64:
+            return probeKey(f.get<Int64>());
+        case Field::Types::Int128:
+            return probeKey(f.get<Int128>());
+        case Field::Types::UInt128:
+            return probeKey(f.get<UInt128>());
+        case Field::Types::UInt256:
+            return probeKey(f.get<UInt256>());
+        case Field::Types::Int256:
+            return probeKey(f.get<Int256>());
+        case Field::Types::String:
+        {
+            const auto & str = f.get<const String &>();
+            return probeKey(StringRef(str.data(), str.size()));
+        }
+        default:
+            return true;
+    }
+}
+
 void BloomFilterWithRange::mergeValueSet(const DB::ValueSetWithRange & valueSetWithRange)
 {
     for (const auto & f : valueSetWithRange.set)
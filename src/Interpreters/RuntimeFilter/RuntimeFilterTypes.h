@@ -504,6 +504,9 @@ public:
     }
     void mergeValueSet(const ValueSetWithRange & valueSetWithRange);
     void addFieldKey(const Field & f); /// only use for merge value set
+    /// Membership probe by Field, hashing symmetric to addFieldKey / the typed ingestion path.
+    /// Returns true for types that cannot be probed (no pruning possible).
+    bool probeFieldKey(const Field & f) const;
     String debugString() const;
 
 public:
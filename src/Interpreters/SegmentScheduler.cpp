@@ -82,7 +82,11 @@ SegmentScheduler::insertPlanSegments(const String & query_id, PlanSegmentTree *
     {
         server_resource->setSendMutations(true);
         /// TODO: we can skip some worker
-        server_resource->sendResources(query_context);
+        /// Fan the resources out asynchronously so the round trip overlaps with serializing the
+        /// query buffers and planning the schedule; the scheduler joins it before dispatching
+        /// the first plan segment.
+        dag_ptr->send_resources_future
+            = std::async(std::launch::async, [server_resource, query_context] { server_resource->sendResources(query_context); });
     }
 
     auto * final_segment = plan_segments_ptr->getRoot()->getPlanSegment();
@@ -91,6 +95,7 @@ SegmentScheduler::insertPlanSegments(const String & query_id, PlanSegmentTree *
     //fast path for single node query
     if (plan_segments_ptr->getNodes().size() == 1)
     {
+        dag_ptr->waitForSendResources();
         return dag_ptr->plan_segment_status_ptr;
     }
     prepareQueryCommonBuf(dag_ptr->query_common_buf, *final_segment, query_context);
@@ -288,6 +293,7 @@ void SegmentScheduler::updateQueryStatus(const RuntimeSegmentsStatus & segment_s
     status->is_succeed &= segment_status.is_succeed;
     status->is_cancelled |= segment_status.is_cancelled;
     status->metrics.cpu_micros += segment_status.metrics.cpu_micros;
+    status->metrics.peak_memory_usage = std::max(status->metrics.peak_memory_usage, segment_status.metrics.peak_memory_usage);
 }
 
 void SegmentScheduler::updateSegmentStatus(const RuntimeSegmentsStatus & segment_status)
@@ -308,10 +314,28 @@ void SegmentScheduler::updateSegmentStatus(const RuntimeSegmentsStatus & segment
     status->is_succeed = segment_status.is_succeed;
     status->is_cancelled = segment_status.is_cancelled;
     status->metrics.cpu_micros += segment_status.metrics.cpu_micros;
+    /// Keep the high-water mark across the parallel instances of the segment: this is
+    /// the per-worker footprint that memory limits have to accommodate.
+    status->metrics.peak_memory_usage = std::max(status->metrics.peak_memory_usage, segment_status.metrics.peak_memory_usage);
     status->message = segment_status.message;
     status->code = segment_status.code;
 }
 
+std::vector<RuntimeSegmentsStatus> SegmentScheduler::getSegmentsStatusSnapshot() const
+{
+    std::vector<RuntimeSegmentsStatus> res;
+    std::unique_lock<bthread::Mutex> lock(segment_status_mutex);
+    for (const auto & [query_id, segments] : segment_status_map)
+    {
+        for (const auto & [segment_id, status] : segments)
+        {
+            if (status)
+                res.push_back(*status);
+        }
+    }
+    return res;
+}
+
 void SegmentScheduler::checkQueryCpuTime(const String & query_id)
 {
     UInt64 max_cpu_seconds = 0;
@@ -91,6 +91,10 @@ public:
     void updateSegmentStatus(const RuntimeSegmentsStatus & segment_status);
     void updateQueryStatus(const RuntimeSegmentsStatus & segment_status);
 
+    /// Copy of the per-segment cpu/memory ledger of all queries the scheduler currently
+    /// tracks; feeds system.query_memory on the coordinator.
+    std::vector<RuntimeSegmentsStatus> getSegmentsStatusSnapshot() const;
+
     void updateReceivedSegmentStatusCounter(
         const String & query_id, const size_t & segment_id, const UInt64 & parallel_index, const RuntimeSegmentsStatus & status);
     // Return true if only the query runs in bsp mode and all statuses of specified segment has been received.
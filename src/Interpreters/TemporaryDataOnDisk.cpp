@@ -2,8 +2,10 @@
 
 #include <IO/WriteBufferFromFile.h>
 #include <IO/ReadBufferFromFile.h>
+#include <IO/createReadBufferFromFileBase.h>
 #include <Compression/CompressedWriteBuffer.h>
 #include <Compression/CompressedReadBuffer.h>
+#include <Compression/CompressionFactory.h>
 #include <Formats/NativeWriter.h>
 #include <Formats/NativeReader.h>
 #include <Core/ProtocolDefines.h>
@@ -58,7 +60,8 @@ TemporaryFileStream & TemporaryDataOnDisk::createStreamToCacheFile(const Block &
     return *tmp_stream;
 }
 
-TemporaryFileStreamShardPtr TemporaryDataOnDisk::createStreamPtrToRegularFile(const Block & header, size_t max_file_size)
+TemporaryFileStreamShardPtr TemporaryDataOnDisk::createStreamPtrToRegularFile(
+    const Block & header, size_t max_file_size, CompressionCodecPtr codec, std::optional<ReadSettings> read_settings)
 {
     if (!volume)
         throw Exception(ErrorCodes::LOGICAL_ERROR, "TemporaryDataOnDiskScope has no volume");
@@ -81,7 +84,8 @@ TemporaryFileStreamShardPtr TemporaryDataOnDisk::createStreamPtrToRegularFile(co
 
     std::lock_guard lock(mutex);
     // TemporaryFileStreamPtr & tmp_stream = streams.emplace_back(std::make_unique<TemporaryFileStream>(std::move(tmp_file), header, this));
-    TemporaryFileStreamShardPtr tmp_stream = std::make_unique<TemporaryFileStream>(std::move(tmp_file), header, this);
+    TemporaryFileStreamShardPtr tmp_stream
+        = std::make_unique<TemporaryFileStream>(std::move(tmp_file), header, this, std::move(codec), std::move(read_settings));
     return tmp_stream;
 }
 
@@ -101,11 +105,31 @@ bool TemporaryDataOnDisk::empty() const
     return streams.empty();
 }
 
+namespace
+{
+
+/// Spill IO goes through the disk interface, so the temporary volume may live on a remote
+/// disk (bytehdfs and alike) and diskless workers can spill at object-store bandwidth.
+/// Local disks keep plain file buffers, the read side can then be served through mmap.
+std::unique_ptr<WriteBuffer> createTemporaryWriteBuffer(const TemporaryFileOnDisk & file)
+{
+    const auto & disk = file.getDisk();
+    if (disk->getType() == DiskType::Type::Local)
+        return std::make_unique<WriteBufferFromFile>(file.getAbsolutePath());
+
+    WriteSettings write_settings;
+    /// Remote targets want large sequential writes, not page-sized ones
+    write_settings.buffer_size = 4_MiB;
+    return disk->writeFile(file.getPath(), write_settings);
+}
+
+}
+
 struct TemporaryFileStream::OutputWriter
 {
-    OutputWriter(const String & path, const Block & header_)
-        : out_buf(std::make_unique<WriteBufferFromFile>(path))
-        , out_compressed_buf(*out_buf)
+    OutputWriter(std::unique_ptr<WriteBuffer> out_buf_, const String & path, const Block & header_, CompressionCodecPtr codec_ = nullptr)
+        : out_buf(std::move(out_buf_))
+        , out_compressed_buf(*out_buf, codec_ ? std::move(codec_) : CompressionCodecFactory::instance().getDefaultCodec())
         , out_writer(out_compressed_buf, DBMS_TCP_PROTOCOL_VERSION, header_)
     {
         LOG_TRACE(&Poco::Logger::get("TemporaryFileStream"), "Writing to temporary file {}", path);
@@ -177,37 +201,62 @@ struct TemporaryFileStream::OutputWriter
 
 struct TemporaryFileStream::InputReader
 {
-    InputReader(const String & path, const Block & header_)
-        : in_file_buf(path)
-        , in_compressed_buf(in_file_buf)
+    InputReader(const String & path, const Block & header_, const std::optional<ReadSettings> & read_settings_ = {}, size_t file_size_ = 0)
+        : in_file_buf(createFileBuffer(path, read_settings_, file_size_))
+        , in_compressed_buf(*in_file_buf)
+        , in_reader(in_compressed_buf, header_, DBMS_TCP_PROTOCOL_VERSION)
+    {
+        LOG_TRACE(&Poco::Logger::get("TemporaryFileStream"), "Reading {} from {}", header_.dumpStructure(), path);
+    }
+
+    InputReader(std::unique_ptr<ReadBufferFromFileBase> in_file_buf_, const String & path, const Block & header_)
+        : in_file_buf(std::move(in_file_buf_))
+        , in_compressed_buf(*in_file_buf)
         , in_reader(in_compressed_buf, header_, DBMS_TCP_PROTOCOL_VERSION)
     {
         LOG_TRACE(&Poco::Logger::get("TemporaryFileStream"), "Reading {} from {}", header_.dumpStructure(), path);
     }
 
     explicit InputReader(const String & path)
-        : in_file_buf(path)
-        , in_compressed_buf(in_file_buf)
+        : in_file_buf(createFileBuffer(path, {}, 0))
+        , in_compressed_buf(*in_file_buf)
         , in_reader(in_compressed_buf, DBMS_TCP_PROTOCOL_VERSION)
     {
         LOG_TRACE(&Poco::Logger::get("TemporaryFileStream"), "Reading from {}", path);
     }
 
+    /// With read settings the file can be read through mmap (depending on the mmap threshold),
+    /// so reloading a spilled bucket does not double-buffer the data through read syscalls.
+    static std::unique_ptr<ReadBufferFromFileBase> createFileBuffer(
+        const String & path, const std::optional<ReadSettings> & read_settings_, size_t file_size_)
+    {
+        if (read_settings_)
+            return createReadBufferFromFileBase(path, *read_settings_, {}, file_size_ ? std::optional<size_t>(file_size_) : std::nullopt);
+        return std::make_unique<ReadBufferFromFile>(path);
+    }
+
     Block read()
     {
         return in_reader.read();
     }
 
-    ReadBufferFromFile in_file_buf;
+    std::unique_ptr<ReadBufferFromFileBase> in_file_buf;
     CompressedReadBuffer in_compressed_buf;
     NativeReader in_reader;
 };
 
-TemporaryFileStream::TemporaryFileStream(TemporaryFileOnDiskHolder file_, const Block & header_, TemporaryDataOnDisk * parent_)
+TemporaryFileStream::TemporaryFileStream(
+    TemporaryFileOnDiskHolder file_,
+    const Block & header_,
+    TemporaryDataOnDisk * parent_,
+    CompressionCodecPtr codec_,
+    std::optional<ReadSettings> read_settings_)
     : parent(parent_)
     , header(header_)
     , file(std::move(file_))
-    , out_writer(std::make_unique<OutputWriter>(file->getAbsolutePath(), header))
+    , codec(std::move(codec_))
+    , read_settings(std::move(read_settings_))
+    , out_writer(std::make_unique<OutputWriter>(createTemporaryWriteBuffer(*file), file->getAbsolutePath(), header, codec))
 {
 }
 
@@ -275,7 +324,20 @@ Block TemporaryFileStream::read()
 
     if (!in_reader)
     {
-        in_reader = std::make_unique<InputReader>(getPath(), header);
+        if (file && file->getDisk()->getType() != DiskType::Type::Local)
+        {
+            /// Merge-back from a remote spill target reads the file strictly sequentially,
+            /// large buffers with prefetch hide the object-store round trips
+            ReadSettings settings = read_settings.value_or(ReadSettings{});
+            settings.remote_fs_buffer_size = std::max<size_t>(settings.remote_fs_buffer_size, 4_MiB);
+            settings.remote_fs_prefetch = true;
+            settings.estimated_size = stat.compressed_size;
+            in_reader = std::make_unique<InputReader>(file->getDisk()->readFile(file->getPath(), settings), getPath(), header);
+        }
+        else
+        {
+            in_reader = std::make_unique<InputReader>(getPath(), header, read_settings, stat.compressed_size);
+        }
     }
 
     Block block = in_reader->read();
@@ -5,6 +5,7 @@
 #include <Interpreters/Context.h>
 #include <Disks/TemporaryFileOnDisk.h>
 #include <Disks/IVolume.h>
+#include <IO/ReadSettings.h>
 #include <Common/CurrentMetrics.h>
 #include <Interpreters/Cache/FileSegment.h>
 #include <Interpreters/Cache/FileCache.h>
@@ -24,6 +25,9 @@ using TemporaryDataOnDiskScopePtr = std::shared_ptr<TemporaryDataOnDiskScope>;
 class TemporaryDataOnDisk;
 using TemporaryDataOnDiskPtr = std::unique_ptr<TemporaryDataOnDisk>;
 
+class ICompressionCodec;
+using CompressionCodecPtr = std::shared_ptr<ICompressionCodec>;
+
 class TemporaryFileStream;
 using TemporaryFileStreamPtr = std::unique_ptr<TemporaryFileStream>;
 using TemporaryFileStreamShardPtr = std::shared_ptr<TemporaryFileStream>;
@@ -56,6 +60,12 @@ public:
         : parent(std::move(parent_)), volume(parent->volume), file_cache(parent->file_cache), limit(limit_)
     {}
 
+    /// Nested scope that writes to another volume (e.g. the disk cache device for join
+    /// spills) while the written bytes still count against the parent's limit.
+    explicit TemporaryDataOnDiskScope(TemporaryDataOnDiskScopePtr parent_, VolumePtr volume_, size_t limit_)
+        : parent(std::move(parent_)), volume(std::move(volume_)), file_cache(parent->file_cache), limit(limit_)
+    {}
+
     /// TODO: remove
     /// Refactor all code that uses volume directly to use TemporaryDataOnDisk.
     VolumePtr getVolume() const { return volume; }
@@ -101,7 +111,14 @@ public:
     bool empty() const;
 
     const StatAtomic & getStat() const { return stat; }
-    TemporaryFileStreamShardPtr createStreamPtrToRegularFile(const Block & header, size_t max_file_size = 0);
+
+    /// codec overrides the default codec of the compressed stream (e.g. NONE makes reloading
+    /// fixed-width columns a plain memcpy), read_settings makes the reload honor the mmap threshold.
+    TemporaryFileStreamShardPtr createStreamPtrToRegularFile(
+        const Block & header,
+        size_t max_file_size = 0,
+        CompressionCodecPtr codec = nullptr,
+        std::optional<ReadSettings> read_settings = {});
 
 private:
     TemporaryFileStream & createStreamToCacheFile(const Block & header, size_t max_file_size);
@@ -127,7 +144,12 @@ public:
         size_t num_rows = 0;
     };
 
-    TemporaryFileStream(TemporaryFileOnDiskHolder file_, const Block & header_, TemporaryDataOnDisk * parent_);
+    TemporaryFileStream(
+        TemporaryFileOnDiskHolder file_,
+        const Block & header_,
+        TemporaryDataOnDisk * parent_,
+        CompressionCodecPtr codec_ = nullptr,
+        std::optional<ReadSettings> read_settings_ = {});
     TemporaryFileStream(FileSegmentsHolder && segments_, const Block & header_, TemporaryDataOnDisk * parent_);
 
     size_t write(const Block & block);
@@ -161,6 +183,10 @@ private:
     TemporaryFileOnDiskHolder file;
     FileSegmentsHolder segment_holder;
 
+    /// Overrides of the spill format, see createStreamPtrToRegularFile.
+    CompressionCodecPtr codec;
+    std::optional<ReadSettings> read_settings;
+
     Stat stat;
 
     struct OutputWriter;
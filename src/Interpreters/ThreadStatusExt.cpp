@@ -155,6 +155,7 @@ void ThreadStatus::setupState(const ThreadGroupStatusPtr & thread_group_)
         logs_queue_ptr = thread_group->logs_queue_ptr;
         fatal_error_callback = thread_group->fatal_error_callback;
         query_context = thread_group->query_context;
+        plan_segment_id = thread_group->plan_segment_id;
 
         if (global_context.expired())
             global_context = thread_group->global_context;
@@ -417,6 +418,7 @@ void ThreadStatus::detachQuery(bool exit_if_already_detached, bool thread_exits)
     memory_tracker.setParent(thread_group->memory_tracker.getParent());
 
     query_id.clear();
+    plan_segment_id = -1;
     xid = 0;
     query_context.reset();
     thread_trace_context.trace_id = 0;
@@ -23,6 +23,7 @@ struct TraceLogElement
     TraceType trace_type{};
     UInt64 thread_id{};
     String query_id{};
+    Int32 segment_id{-1}; /// Id of the plan segment the sampled thread executed, -1 if none
     Array trace{};
     Int64 size{}; /// Allocation size in bytes for TraceType::Memory
 
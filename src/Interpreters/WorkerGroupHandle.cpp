@@ -25,6 +25,8 @@
 #include <Interpreters/Context.h>
 #include <IO/ConnectionTimeouts.h>
 #include <CloudServices/CnchWorkerClientPools.h>
+#include <Processors/Exchange/DataTrans/RpcChannelPool.h>
+#include <Common/ThreadPool.h>
 #include <fmt/core.h>
 #include <common/logger_useful.h>
 
@@ -110,6 +112,29 @@ WorkerGroupHandleImpl::WorkerGroupHandleImpl(
     ring = buildRing(this->shards_info, current_context);
     LOG_DEBUG(&Poco::Logger::get("WorkerGroupHandleImpl"), "Success built ring with {} nodes\n", ring->size());
 
+    /// A new handle means the topology changed (e.g. a scale-up). Pre-establish brpc channels
+    /// to the workers in the background so the first queries afterwards do not pay
+    /// DNS + TCP + channel setup inside the query path. Hosts already warm are just health-checked.
+    if (config.getBool("enable_rpc_channel_pool_prewarm", true))
+    {
+        std::vector<std::string> rpc_addresses;
+        rpc_addresses.reserve(hosts.size());
+        for (const auto & host : hosts)
+            rpc_addresses.push_back(host.getRPCAddress());
+        try
+        {
+            GlobalThreadPool::instance().scheduleOrThrow([addresses = std::move(rpc_addresses)] {
+                auto & channel_pool = RpcChannelPool::getInstance();
+                channel_pool.prewarm(addresses, BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY);
+                channel_pool.prewarm(addresses, BrpcChannelPoolOptions::STREAM_DEFAULT_CONFIG_KEY);
+            });
+        }
+        catch (...)
+        {
+            tryLogCurrentException(
+                &Poco::Logger::get("WorkerGroupHandleImpl"), fmt::format("Cannot schedule rpc channel prewarm for worker group {}", id));
+        }
+    }
 }
 
 WorkerGroupHandleImpl::WorkerGroupHandleImpl(const WorkerGroupData & data, const ContextPtr & context_)
@@ -189,18 +214,40 @@ std::pair<UInt64, CnchWorkerClientPtr> WorkerGroupHandleImpl::getWorkerClient(UI
 
     auto ratio = getContext()->getRootConfig().vw_ratio_of_busy_worker.value;
     auto busy_worker_indexes = getBusyWorkerIndexes(ratio, getMetrics());
-    for (size_t i = 0; i < size; ++i)
-    {
-        start_index %= size;
-        if (busy_worker_indexes.contains(start_index))
+
+    auto pick_non_busy = [&](size_t index) {
+        for (size_t i = 0; i < size; ++i, ++index)
         {
-            start_index++;
-            continue;
+            index %= size;
+            if (!busy_worker_indexes.contains(index))
+                break;
         }
-        return {start_index, doGetWorkerClient(hosts[start_index])};
-    }
-    start_index %= size;
-    return {start_index, doGetWorkerClient(hosts[start_index])};
+        return index % size;
+    };
+
+    auto first = pick_non_busy(start_index);
+    if (!getContext()->getRootConfig().vw_enable_latency_aware_pick)
+        return {first, doGetWorkerClient(hosts[first])};
+
+    /// Power of two choices: draw a second non-busy candidate and keep the one with the
+    /// better RPC latency record, so that a single degraded worker stops catching every
+    /// query that happens to land on it. Workers in probation (recent RPC failures) lose
+    /// against any healthy candidate.
+    std::uniform_int_distribution<size_t> second_dist(0, size - 1);
+    auto second = pick_non_busy(second_dist(thread_local_rng));
+    if (second == first)
+        return {first, doGetWorkerClient(hosts[first])};
+
+    auto first_client = doGetWorkerClient(hosts[first]);
+    auto second_client = doGetWorkerClient(hosts[second]);
+
+    if (first_client->inProbation() != second_client->inProbation())
+        return first_client->inProbation() ? std::make_pair(UInt64(second), second_client)
+                                           : std::make_pair(UInt64(first), first_client);
+
+    if (second_client->getSmoothedLatencyUs() < first_client->getSmoothedLatencyUs())
+        return {second, second_client};
+    return {first, first_client};
 }
 
 CnchWorkerClientPtr WorkerGroupHandleImpl::getWorkerClient(const HostWithPorts & host_ports) const
@@ -87,6 +87,7 @@
 #include <Interpreters/InterpreterSetQuery.h>
 #include <Interpreters/NormalizeSelectWithUnionQueryVisitor.h>
 #include <Interpreters/OpenTelemetrySpanLog.h>
+#include <Optimizer/CardinalityEstimate/CardinalityFeedback.h>
 #include <Interpreters/ProcessList.h>
 #include <Interpreters/ProcessorsProfileLog.h>
 #include <Interpreters/QueryLog.h>
@@ -920,15 +921,27 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                 context->getHostWithPorts().toDebugString());
             if (!host_ports.empty() && !isLocalServer(host_ports.getRPCAddress(), std::to_string(context->getRPCPort())))
             {
-                size_t query_size = (max_query_size == 0) ? (end - begin) :  std::min(end - begin, static_cast<ptrdiff_t>(max_query_size));
-                String query = String(begin, begin + query_size);
-                LOG_DEBUG(
-                    &Poco::Logger::get("executeQuery"), "Will reroute query {} to {}", query, host_ports.toDebugString());
-                context->initializeExternalTablesIfSet();
-                context->setSetting("enable_auto_query_forwarding", Field(0));
-                executeQueryByProxy(context, host_ports, ast, res, in_interactive_txn, query);
-                LOG_DEBUG(&Poco::Logger::get("executeQuery"), "Query forwarded to remote server done");
-                return std::make_tuple(ast, std::move(res));
+                /// Interactive transactions must stay on the server owning the transaction, otherwise
+                /// forwarding is only a cache optimization and can be skipped when the target is overloaded.
+                if (!in_interactive_txn && shouldKeepQueryLocalForLoad(context, host_ports))
+                {
+                    LOG_DEBUG(
+                        &Poco::Logger::get("executeQuery"),
+                        "Keep query on local server: target server {} is over the forwarding load threshold",
+                        host_ports.toDebugString());
+                }
+                else
+                {
+                    size_t query_size = (max_query_size == 0) ? (end - begin) :  std::min(end - begin, static_cast<ptrdiff_t>(max_query_size));
+                    String query = String(begin, begin + query_size);
+                    LOG_DEBUG(
+                        &Poco::Logger::get("executeQuery"), "Will reroute query {} to {}", query, host_ports.toDebugString());
+                    context->initializeExternalTablesIfSet();
+                    context->setSetting("enable_auto_query_forwarding", Field(0));
+                    executeQueryByProxy(context, host_ports, ast, res, in_interactive_txn, query);
+                    LOG_DEBUG(&Poco::Logger::get("executeQuery"), "Query forwarded to remote server done");
+                    return std::make_tuple(ast, std::move(res));
+                }
             }
         }
 
@@ -1657,6 +1670,12 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                             }
                         }
 
+                        /// Feed the observed result cardinality back to the optimizer,
+                        /// see CardinalityFeedback. A no-op unless the estimator registered
+                        /// this query's plan signature.
+                        if (context->getSettingsRef().enable_cardinality_feedback)
+                            CardinalityFeedback::instance().onQuerySucceed(context->getCurrentQueryId(), elem.result_rows);
+
                         if (elem.read_rows != 0)
                         {
                             LOG_INFO(
@@ -1866,6 +1885,9 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                 if (quota)
                     quota->used(Quota::ERRORS, 1, /* check_exceeded = */ false);
 
+                /// Failed queries must not contribute cardinality feedback.
+                CardinalityFeedback::instance().onQueryFinish(query_id);
+
                 elem.type = QueryLogElementType::EXCEPTION_WHILE_PROCESSING;
 
                 // event_time and event_time_microseconds are being constructed from the same time point
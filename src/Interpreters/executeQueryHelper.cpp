@@ -1,4 +1,5 @@
 #include <Catalog/Catalog.h>
+#include <CloudServices/CnchServerClient.h>
 #include <DataStreams/RemoteQueryExecutor.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/DatabaseAndTableWithAlias.h>
@@ -24,8 +25,12 @@
 #include <DataStreams/RemoteBlockInputStream.h>
 #include <Interpreters/QueryLog.h>
 #include <Optimizer/QueryUseOptimizerChecker.h>
+#include <Common/Stopwatch.h>
 #include <common/logger_useful.h>
 
+#include <mutex>
+#include <unordered_map>
+
 
 namespace DB
 {
@@ -105,6 +110,48 @@ HostWithPorts getTargetServer(ContextPtr context, ASTPtr & ast)
         UUIDHelpers::UUIDToString(storage_ptr->getStorageUUID()), storage_ptr->getServerVwName(), context->getTimestamp(), true);
 }
 
+bool shouldKeepQueryLocalForLoad(ContextPtr context, const HostWithPorts & server)
+{
+    UInt64 max_target_queries = context->getSettingsRef().query_forwarding_max_target_queries;
+    if (max_target_queries == 0)
+        return false;
+
+    /// Probe results are cached briefly so that a burst of queries for one table does not
+    /// turn the load check into per-query rpc traffic to the host server.
+    static std::mutex load_cache_mutex;
+    static std::unordered_map<String, std::pair<UInt64, UInt64>> cached_loads; /// rpc address -> (running queries, probe time ns)
+    constexpr UInt64 cache_ttl_ns = 1000ULL * 1000 * 1000;
+
+    const String rpc_address = server.getRPCAddress();
+    UInt64 now_ns = clock_gettime_ns(CLOCK_MONOTONIC);
+    {
+        std::lock_guard lock(load_cache_mutex);
+        auto it = cached_loads.find(rpc_address);
+        if (it != cached_loads.end() && now_ns - it->second.second < cache_ttl_ns)
+            return it->second.first >= max_target_queries;
+    }
+
+    UInt64 running_queries = 0;
+    try
+    {
+        running_queries = context->getCnchServerClient(rpc_address)->getQueryLoad();
+    }
+    catch (...)
+    {
+        /// If the host server cannot be probed, forward anyway: a real outage will surface
+        /// on the forwarded query itself, and a transient probe failure must not give up
+        /// the warm part cache.
+        tryLogCurrentException(&Poco::Logger::get("executeQuery"), "Could not probe query load of target server " + rpc_address);
+        return false;
+    }
+
+    {
+        std::lock_guard lock(load_cache_mutex);
+        cached_loads[rpc_address] = {running_queries, now_ns};
+    }
+    return running_queries >= max_target_queries;
+}
+
 void executeQueryByProxy(ContextMutablePtr context, const HostWithPorts & server, const ASTPtr & ast, BlockIO & res, bool in_interactive_txn, const String & query)
 {
     auto session_txn = in_interactive_txn ? context->getSessionContext()->getCurrentTransaction() : nullptr;
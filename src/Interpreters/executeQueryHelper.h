@@ -7,6 +7,10 @@
 namespace DB
 {
 HostWithPorts getTargetServer(ContextPtr context, ASTPtr & ast);
+/// Load-shedding fallback for query forwarding: returns true when the table's host server
+/// already runs at least query_forwarding_max_target_queries queries, in which case the
+/// query executes locally with a cold part cache instead of queueing on the hot server.
+bool shouldKeepQueryLocalForLoad(ContextPtr context, const HostWithPorts & server);
 struct BlockIO;
 void executeQueryByProxy(ContextMutablePtr context, const HostWithPorts & server, const ASTPtr & ast, BlockIO & res, bool in_interactive_txn, const String & query);
 struct QueryLogElement;
@@ -14,10 +14,12 @@
  */
 
 #pragma once
+#include <vector>
 #include <Core/Block.h>
 #include <Core/Names.h>
 #include <Core/Types.h>
 #include <Core/ColumnNumbers.h>
+#include <Common/SipHash.h>
 #include <Interpreters/InDepthNodeVisitor.h>
 
 #include <Parsers/ASTSelectWithUnionQuery.h>
@@ -31,6 +33,10 @@ namespace DB
 
 void prepareBucketColumn(
     Block & block, const Names bucket_columns, const Int64 split_number, const bool is_with_range, const Int64 total_shard_num, const ContextPtr & context, const bool is_user_defined_expression);
+/// Column-major update of the per-row chained SipHash states used for bucket assignment:
+/// bit-identical to calling IColumn::updateHashWithValue row by row, but type-specialized
+/// kernels pass over whole key columns with one virtual dispatch per column.
+void updateBucketRowHashes(const IColumn & column, std::vector<SipHash> & row_hashes);
 void buildBucketScatterSelector(const ColumnRawPtrs & columns, PODArray<size_t> & partition_num_to_first_row, IColumn::Selector & selector, size_t max_parts);
 void createColumnWithDtsPartitionHash(Block & block, const Names & bucket_columns, const Int64 & split_number, const ContextPtr & context);
 ColumnPtr createColumnWithSipHash(Block & block, const Names & bucket_columns, const Int64 & divisor);
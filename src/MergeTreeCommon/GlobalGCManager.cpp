@@ -99,10 +99,25 @@ namespace {
         auto catalog = context.getCnchCatalog();
         Strings partition_ids = catalog->getPartitionIDs(storage, &context);
 
+        const String table_uuid = UUIDHelpers::UUIDToString(storage->getStorageUUID());
+        const String owner = context.getHostWithPorts().getRPCAddress();
+        const UInt64 claim_lease_sec = context.getConfigRef().getUInt("global_gc.partition_claim_lease_sec", 3600);
+
         ThreadPool clean_pool(context.getSettingsRef().s3_gc_inter_partition_parallelism);
         for (const String & partition_id : partition_ids)
         {
-            clean_pool.scheduleOrThrowOnError([partition_id, &log, &catalog, &storage, &mergetree_meta, &context]() {
+            /// Server replicas running global GC for the same table split its partitions
+            /// between them through lease-based claims in the catalog. Claims are
+            /// best-effort: the deletes they cover are idempotent, and a claim that is
+            /// never released (e.g. the owner died mid-GC) expires with its lease.
+            if (!catalog->tryClaimGlobalGCPartition(table_uuid, partition_id, owner, claim_lease_sec))
+            {
+                LOG_DEBUG(log, "Skip GC partition {} for table {}: claimed by another replica",
+                    partition_id, storage->getStorageID().getNameForLogs());
+                continue;
+            }
+
+            clean_pool.scheduleOrThrowOnError([partition_id, table_uuid, &log, &catalog, &storage, &mergetree_meta, &context]() {
                 MultiDiskS3PartsLazyCleaner parts_cleaner(std::nullopt, context.getSettingsRef().s3_gc_intra_partition_parallelism);
 
                 LOG_DEBUG(log, "Start GC partition {} for table {}", partition_id, storage->getStorageID().getNameForLogs());
@@ -152,6 +167,8 @@ namespace {
                         partition_id,
                         storage->getStorageID().getNameForLogs());
                 }
+
+                catalog->releaseGlobalGCPartition(table_uuid, partition_id);
             });
         }
         clean_pool.wait();
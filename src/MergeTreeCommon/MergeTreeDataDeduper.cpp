@@ -19,6 +19,7 @@
 #include <Interpreters/CnchSystemLog.h>
 #include <MergeTreeCommon/MergeTreeDataDeduper.h>
 #include <MergeTreeCommon/MergeTreeMetaBase.h>
+#include <Storages/IndexFile/BufferedIterator.h>
 #include <Storages/IndexFile/IndexFileMergeIterator.h>
 #include <Storages/UniqueKeyIndex.h>
 #include <Common/Coding.h>
@@ -56,7 +57,9 @@ namespace
         const IMergeTreeDataPartsVector & parts,
         std::vector<UniqueKeyIndexPtr> & index_holders,
         bool fill_cache,
-        DeleteBitmapGetter delete_bitmap_getter)
+        DeleteBitmapGetter delete_bitmap_getter,
+        const std::vector<bool> & parts_may_match = {},
+        size_t scan_batch_size = 0)
     {
         index_holders.clear();
         index_holders.reserve(parts.size());
@@ -67,6 +70,13 @@ namespace
         iters.reserve(parts.size());
         for (size_t i = 0; i < parts.size(); ++i)
         {
+            /// Parts ruled out by the bloom filter prefilter get an empty iterator so that
+            /// child indexes (used to address delete bitmaps) stay aligned with `parts`.
+            if (!parts_may_match.empty() && !parts_may_match[i])
+            {
+                iters.push_back(std::unique_ptr<IndexFile::Iterator>(IndexFile::NewEmptyIterator()));
+                continue;
+            }
             IndexFile::ReadOptions opts;
             opts.fill_cache = fill_cache;
             {
@@ -83,11 +93,61 @@ namespace
                     };
                 }
             }
-            iters.push_back(index_holders[i]->new_iterator(opts));
+            auto iter = index_holders[i]->new_iterator(opts);
+            /// Serve sequential scans out of a batch buffer, one virtual NextBatch() call
+            /// per batch instead of several virtual calls per entry.
+            if (scan_batch_size)
+                iter.reset(IndexFile::NewBufferedIterator(IndexFile::BytewiseComparator(), iter.release(), scan_batch_size));
+            iters.push_back(std::move(iter));
         }
         return iters;
     }
 
+    /// Probe each visible part's unique key index bloom filter with all keys of the dedup
+    /// batch. A part flagged false provably contains none of the batch keys and can be
+    /// skipped by the merge entirely; false positives only cost a wasted seek, so pruning
+    /// is always safe. The batch keys are read through a raw merge iterator over the new
+    /// parts' indexes, which also warms the block cache for the dedup pass that follows.
+    std::vector<bool> selectPartsMayContainKeys(
+        const IMergeTreeDataPartsVector & visible_parts, const IMergeTreeDataPartsVector & new_parts, Poco::Logger * log)
+    {
+        std::vector<bool> res(visible_parts.size(), false);
+
+        std::vector<UniqueKeyIndexPtr> visible_indices;
+        visible_indices.reserve(visible_parts.size());
+        for (auto & part : visible_parts)
+            visible_indices.push_back(part->getUniqueKeyIndex());
+
+        /// Deleted rows of new parts probe as well, that is only conservative.
+        DeleteBitmapGetter no_bitmap = [](const IMergeTreeDataPartPtr &) { return ImmutableDeleteBitmapPtr{}; };
+        std::vector<UniqueKeyIndexPtr> new_part_indices;
+        IndexFileIterators key_iters = openUniqueKeyIndexIterators(new_parts, new_part_indices, /*fill_cache*/ true, no_bitmap);
+
+        IndexFile::IndexFileMergeIterator key_iter(IndexFile::BytewiseComparator(), std::move(key_iters));
+        size_t pruned = res.size();
+        for (key_iter.SeekToFirst(); key_iter.Valid() && pruned > 0; key_iter.Next())
+        {
+            String key = key_iter.key().ToString();
+            for (size_t i = 0; i < res.size(); ++i)
+            {
+                if (!res[i] && visible_indices[i]->mayContain(key))
+                {
+                    res[i] = true;
+                    --pruned;
+                }
+            }
+        }
+        if (!key_iter.status().ok())
+        {
+            /// Pruning is best-effort, fall back to scanning every part and let the dedup
+            /// pass surface the error with proper context.
+            LOG_WARNING(log, "Bloom filter prefilter failed, keep all parts: {}", key_iter.status().ToString());
+            return {};
+        }
+        LOG_DEBUG(log, "Bloom filter prefilter pruned {} of {} visible parts", pruned, res.size());
+        return res;
+    }
+
     void addRowIdToBitmap(DeleteBitmapPtr & bitmap, UInt32 rowid)
     {
         if (bitmap)
@@ -109,13 +169,15 @@ void MergeTreeDataDeduper::dedupKeysWithParts(
     DeleteBitmapVector & delta_bitmaps,
     DedupTaskProgressReporter reporter,
     DedupTaskPtr & dedup_task,
-    DedupKeyMode dedup_key_mode)
+    DedupKeyMode dedup_key_mode,
+    const std::vector<bool> & parts_may_match)
 {
     const IndexFile::Comparator * comparator = IndexFile::BytewiseComparator();
 
     std::vector<UniqueKeyIndexPtr> key_indices;
     DeleteBitmapGetter delete_bitmap_getter = [](const IMergeTreeDataPartPtr & part) { return part->getDeleteBitmap(); };
-    IndexFileIterators base_input_iters = openUniqueKeyIndexIterators(parts, key_indices, /*fill_cache*/ true, delete_bitmap_getter);
+    IndexFileIterators base_input_iters = openUniqueKeyIndexIterators(
+        parts, key_indices, /*fill_cache*/ true, delete_bitmap_getter, parts_may_match, data.getSettings()->dedup_index_scan_batch_size);
 
     std::vector<UInt64> base_implicit_versions(parts.size(), 0);
     if (version_mode == VersionMode::PartitionValueAsVersion)
@@ -293,6 +355,7 @@ LocalDeleteBitmaps MergeTreeDataDeduper::dedupParts(
                                        const DeleteBitmapVector & bitmaps) -> size_t {
         size_t num_bitmaps = 0;
         size_t max_delete_bitmap_meta_depth = data.getSettings()->max_delete_bitmap_meta_depth;
+        size_t max_delete_bitmap_delta_cardinality = data.getSettings()->max_delete_bitmap_delta_cardinality;
         for (size_t i = 0; i < bitmaps.size(); ++i)
         {
             DeleteBitmapPtr bitmap = bitmaps[i];
@@ -319,6 +382,7 @@ LocalDeleteBitmaps MergeTreeDataDeduper::dedupParts(
                     bitmap,
                     txn_id.toUInt64(),
                     bitmap_meta_depth >= max_delete_bitmap_meta_depth,
+                    max_delete_bitmap_delta_cardinality,
                     visible_parts[i]->bucket_number));
             }
             else /// new part
@@ -340,6 +404,7 @@ LocalDeleteBitmaps MergeTreeDataDeduper::dedupParts(
                         bitmap,
                         txn_id.toUInt64(),
                         bitmap_meta_depth >= max_delete_bitmap_meta_depth,
+                        max_delete_bitmap_delta_cardinality,
                         new_parts[i - visible_parts.size()]->bucket_number));
                 }
                 else
@@ -571,6 +636,7 @@ LocalDeleteBitmaps MergeTreeDataDeduper::repairParts(TxnTimestamp txn_id, IMerge
         = [txn_id, this, &res](const IMergeTreeDataPartsVector & visible_parts, DeleteBitmapVector & delta_bitmaps) -> size_t {
         size_t num_bitmaps = 0;
         size_t max_delete_bitmap_meta_depth = data.getSettings()->max_delete_bitmap_meta_depth;
+        size_t max_delete_bitmap_delta_cardinality = data.getSettings()->max_delete_bitmap_delta_cardinality;
         for (size_t i = 0; i < delta_bitmaps.size(); ++i)
         {
             auto base_bitmap = visible_parts[i]->getDeleteBitmap(/*allow_null*/ true);
@@ -589,6 +655,7 @@ LocalDeleteBitmaps MergeTreeDataDeduper::repairParts(TxnTimestamp txn_id, IMerge
                 delta_bitmaps[i],
                 txn_id.toUInt64(),
                 bitmap_meta_depth >= max_delete_bitmap_meta_depth,
+                max_delete_bitmap_delta_cardinality,
                 visible_parts[i]->bucket_number));
             num_bitmaps++;
         }
@@ -664,8 +731,8 @@ MergeTreeDataDeduper::dedupImpl(const IMergeTreeDataPartsVector & visible_parts,
             return part->getDeleteBitmap(/*allow_null*/ true);
         return nullptr;
     };
-    IndexFileIterators input_iters
-        = openUniqueKeyIndexIterators(new_parts, new_part_indices, /*fill_cache*/ true, delete_bitmap_getter);
+    IndexFileIterators input_iters = openUniqueKeyIndexIterators(
+        new_parts, new_part_indices, /*fill_cache*/ true, delete_bitmap_getter, {}, data.getSettings()->dedup_index_scan_batch_size);
 
     DeleteBitmapVector res(visible_parts.size() + new_parts.size());
     DeleteCallback cb = [start = visible_parts.size(), &res](const RowPos & pos) { addRowIdToBitmap(res[start + pos.child], pos.rowid); };
@@ -688,7 +755,19 @@ MergeTreeDataDeduper::dedupImpl(const IMergeTreeDataPartsVector & visible_parts,
         return os.str();
     };
 
-    dedupKeysWithParts(dedup_task->iter, visible_parts, res, task_progress_reporter, dedup_task, context->getSettings().dedup_key_mode);
+    std::vector<bool> visible_parts_may_match;
+    size_t prefilter_max_rows = data.getSettings()->dedup_bloom_filter_prefilter_max_rows;
+    if (prefilter_max_rows && dedup_task->total_dedup_row_num <= prefilter_max_rows && !visible_parts.empty())
+        visible_parts_may_match = selectPartsMayContainKeys(visible_parts, new_parts, log);
+
+    dedupKeysWithParts(
+        dedup_task->iter,
+        visible_parts,
+        res,
+        task_progress_reporter,
+        dedup_task,
+        context->getSettings().dedup_key_mode,
+        visible_parts_may_match);
     return res;
 }
 
@@ -699,7 +778,8 @@ DeleteBitmapVector MergeTreeDataDeduper::repairImpl(const IMergeTreeDataPartsVec
 
     std::vector<UniqueKeyIndexPtr> key_indices;
     DeleteBitmapGetter delete_bitmap_getter = [](const IMergeTreeDataPartPtr & part) { return part->getDeleteBitmap(/*allow_null*/ true); };
-    IndexFileIterators input_iters = openUniqueKeyIndexIterators(parts, key_indices, /*fill_cache*/ false, delete_bitmap_getter);
+    IndexFileIterators input_iters = openUniqueKeyIndexIterators(
+        parts, key_indices, /*fill_cache*/ false, delete_bitmap_getter, {}, data.getSettings()->dedup_index_scan_batch_size);
 
     DeleteBitmapVector res(parts.size());
     DeleteCallback cb = [&res](const RowPos & pos) { addRowIdToBitmap(res[pos.child], pos.rowid); };
@@ -97,13 +97,17 @@ private:
 
     DeleteBitmapVector repairImpl(const IMergeTreeDataPartsVector & parts);
 
+    /// `parts_may_match`, when not empty, flags for every entry of `parts` whether it may
+    /// contain keys of the batch (see the bloom filter prefilter in dedupImpl); flagged-out
+    /// parts take no further part in the merge and cost no index block reads.
     void dedupKeysWithParts(
         std::shared_ptr<ReplacingSortedKeysIterator> & keys,
         const IMergeTreeDataPartsVector & parts,
         DeleteBitmapVector & delta_bitmaps,
         DedupTaskProgressReporter reporter,
         DedupTaskPtr & dedup_task,
-        DedupKeyMode dedup_key_mode = DedupKeyMode::REPLACE);
+        DedupKeyMode dedup_key_mode = DedupKeyMode::REPLACE,
+        const std::vector<bool> & parts_may_match = {});
 
     /// Convert dedup task into multiple sub dedup tasks. If valid_bucket_table is true, it will split dedup task into bucket granule.
     DedupTasks convertIntoSubDedupTasks(
@@ -683,6 +683,29 @@ String MergeTreeMetaBase::getFullPathOnDisk(StorageLocation location, const Disk
     return disk->getPath() + getRelativeDataPath(location);
 }
 
+ThrottlerPtr MergeTreeMetaBase::getRemoteRequestThrottler(const ContextPtr & query_context) const
+{
+    ThrottlerPtr res;
+    {
+        std::lock_guard lock(remote_request_throttler_mutex);
+        if (!remote_request_throttler)
+        {
+            if (auto table_request_rate = getSettings()->max_remote_request_rate)
+                remote_request_throttler = std::make_shared<Throttler>(table_request_rate, getContext()->getRemoteRequestThrottler());
+        }
+        res = remote_request_throttler;
+    }
+
+    /// No table-level bucket: chain the query bucket straight to the server-wide one.
+    if (!res)
+        res = getContext()->getRemoteRequestThrottler();
+
+    if (auto query_request_rate = query_context->getSettingsRef().max_remote_request_rate_for_query)
+        res = std::make_shared<Throttler>(query_request_rate, res);
+
+    return res;
+}
+
 NamesAndTypesList MergeTreeMetaBase::getVirtuals() const
 {
     /// Array(Tuple(String, String))
@@ -32,6 +32,7 @@
 #include <Storages/extractKeyExpressionList.h>
 #include <Transaction/TxnTimestamp.h>
 #include <Common/SimpleIncrement.h>
+#include <Common/Throttler.h>
 
 namespace DB
 {
@@ -297,6 +298,11 @@ public:
         return storage_settings.get();
     }
 
+    /// Hierarchical request-rate throttler for remote storage reads of this table:
+    /// a per-query bucket chained to a per-table bucket chained to the server-wide one,
+    /// skipping every level whose limit is zero. Returns nullptr when nothing is limited.
+    ThrottlerPtr getRemoteRequestThrottler(const ContextPtr & query_context) const;
+
     /// Get table path on disk
     String getFullPathOnDisk(StorageLocation location, const DiskPtr & disk) const;
 
@@ -473,6 +479,10 @@ protected:
     /// Use get and set to receive readonly versions.
     MultiVersion<MergeTreeSettings> storage_settings;
 
+    /// Per-table remote request-rate bucket, built lazily by getRemoteRequestThrottler.
+    mutable std::mutex remote_request_throttler_mutex;
+    mutable ThrottlerPtr remote_request_throttler;
+
     /// Used to determine which UUIDs to send to root query executor for deduplication.
     mutable std::shared_mutex pinned_part_uuids_mutex;
     PinnedPartUUIDsPtr pinned_part_uuids;
@@ -14,6 +14,7 @@
  */
 
 #include <MergeTreeCommon/assignCnchParts.h>
+#include <Core/UUID.h>
 #include <Storages/RemoteFile/CnchFileCommon.h>
 #include <Storages/RemoteFile/CnchFileSettings.h>
 #include <Catalog/Catalog.h>
@@ -25,6 +26,10 @@
 #include "Catalog/DataModelPartWrapper_fwd.h"
 #include "Interpreters/Context.h"
 
+#include <Common/Stopwatch.h>
+
+#include <array>
+#include <mutex>
 #include <sstream>
 #include <unordered_map>
 
@@ -64,12 +69,155 @@ inline void reportStats(const M & map, const String & name, size_t num_workers)
     LOG_DEBUG(&Poco::Logger::get(name), ss.str());
 }
 
+namespace
+{
+
+/// Server-side approximation of worker disk cache residency: remembers which worker each part
+/// was assigned to most recently. Workers do not report their cached keys, so the last
+/// assignment is the best available signal for where a part's segments are likely cached.
+/// Entries expire after a TTL so the tracker does not pin parts to workers whose cache has
+/// long evicted them.
+class PartResidencyTracker
+{
+public:
+    static PartResidencyTracker & instance()
+    {
+        static PartResidencyTracker tracker;
+        return tracker;
+    }
+
+    /// `part_key` is the part name qualified with the storage UUID; bare part names collide
+    /// across tables (e.g. all_1_1_0 exists in nearly every unpartitioned table).
+    String tryGetWorker(const String & part_key, UInt64 now_ns)
+    {
+        auto & shard = getShard(part_key);
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.entries.find(part_key);
+        if (it == shard.entries.end() || it->second.expire_at_ns < now_ns)
+            return {};
+        return it->second.worker_id;
+    }
+
+    void recordAssignment(const String & part_key, const String & worker_id, UInt64 expire_at_ns)
+    {
+        auto & shard = getShard(part_key);
+        std::lock_guard lock(shard.mutex);
+        if (shard.entries.size() >= max_entries_per_shard && !shard.entries.count(part_key))
+        {
+            /// Drop expired entries first; if the shard is still full the tracker simply
+            /// forgets this part and its next assignment falls back to plain hashing.
+            const UInt64 now_ns = clock_gettime_ns(CLOCK_MONOTONIC);
+            std::erase_if(shard.entries, [now_ns](const auto & entry) { return entry.second.expire_at_ns < now_ns; });
+            if (shard.entries.size() >= max_entries_per_shard)
+                return;
+        }
+        shard.entries[part_key] = {worker_id, expire_at_ns};
+    }
+
+private:
+    struct Entry
+    {
+        String worker_id;
+        UInt64 expire_at_ns;
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<String, Entry> entries;
+    };
+
+    static constexpr size_t NUM_SHARDS = 16;
+    /// ~1M parts in total, bounding the tracker to the order of 100MB of part names.
+    static constexpr size_t max_entries_per_shard = 1 << 16;
+
+    Shard & getShard(const String & key) { return shards[std::hash<String>()(key) % NUM_SHARDS]; }
+
+    std::array<Shard, NUM_SHARDS> shards;
+};
+
+}
+
 /// explicit instantiation for server part and cnch data part.
-template ServerAssignmentMap assignCnchParts<ServerDataPartsVector>(const WorkerGroupHandle & worker_group, const ServerDataPartsVector & parts);
-template AssignmentMap assignCnchParts<MergeTreeDataPartsCNCHVector>(const WorkerGroupHandle & worker_group, const MergeTreeDataPartsCNCHVector & parts);
+template ServerAssignmentMap assignCnchParts<ServerDataPartsVector>(const WorkerGroupHandle & worker_group, const ServerDataPartsVector & parts, const UUID & storage_uuid);
+template AssignmentMap assignCnchParts<MergeTreeDataPartsCNCHVector>(const WorkerGroupHandle & worker_group, const MergeTreeDataPartsCNCHVector & parts, const UUID & storage_uuid);
+
+template <typename DataPartsCnchVector>
+std::unordered_map<String, DataPartsCnchVector>
+assignCnchParts(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts, const UUID & storage_uuid)
+{
+    const auto & settings = worker_group->getContext()->getSettingsRef();
+    if (settings.enable_cache_resident_part_assignment)
+        return assignCnchPartsWithResidency(worker_group, parts, storage_uuid, settings.cache_resident_part_assignment_ttl_seconds);
+    return assignCnchPartsByHashPolicy(worker_group, parts);
+}
+
+/// Assign each part to the worker whose disk cache likely holds its segments already, with a
+/// bounded per-worker cap so residency cannot skew the distribution; the leftover parts go
+/// through the configured hash policy as usual. This keeps assignments stable across worker
+/// group scale-in/out and retries, when pure hashing would reshuffle most of the parts and
+/// every worker would start with a cold cache.
+template <typename DataPartsCnchVector>
+std::unordered_map<String, DataPartsCnchVector>
+assignCnchPartsWithResidency(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts, const UUID & storage_uuid, UInt64 ttl_seconds)
+{
+    const auto & worker_hosts = worker_group->getIdHostPortsMap();
+    auto & tracker = PartResidencyTracker::instance();
+    /// Part names are only unique within one table, so qualify them with the storage UUID.
+    const String table_prefix = UUIDHelpers::UUIDToString(storage_uuid) + "_";
+    const UInt64 now_ns = clock_gettime_ns(CLOCK_MONOTONIC);
+    const UInt64 expire_at_ns = now_ns + ttl_seconds * 1'000'000'000ULL;
+
+    const size_t num_workers = worker_group->getWorkerIDVec().size();
+    /// At most ~120% of the average part count may be assigned by residency; together with the
+    /// hash policy's own balancing this bounds the overall imbalance.
+    const size_t cap_limit = (parts.size() + num_workers - 1) / num_workers * 12 / 10 + 1;
+
+    std::unordered_map<String, DataPartsCnchVector> ret;
+    DataPartsCnchVector remaining_parts;
+    std::unordered_map<String, UInt64> residency_load;
+
+    for (const auto & part : parts)
+    {
+        const auto part_key = table_prefix + part->get_info().getBasicPartName();
+        String resident_worker = tracker.tryGetWorker(part_key, now_ns);
+        auto host_it = resident_worker.empty() ? worker_hosts.end() : worker_hosts.find(resident_worker);
+        if (host_it != worker_hosts.end() && residency_load[resident_worker] < cap_limit)
+        {
+            ++residency_load[resident_worker];
+            auto host_port = host_it->second.getRPCAddress();
+            part->setHostPort(host_port, host_port);
+            ret[resident_worker].emplace_back(part);
+            tracker.recordAssignment(part_key, resident_worker, expire_at_ns);
+        }
+        else
+            remaining_parts.emplace_back(part);
+    }
+
+    const size_t num_resident = parts.size() - remaining_parts.size();
+    if (!remaining_parts.empty())
+    {
+        auto hashed = assignCnchPartsByHashPolicy(worker_group, remaining_parts);
+        for (auto & [worker_id, assigned_parts] : hashed)
+        {
+            for (const auto & part : assigned_parts)
+                tracker.recordAssignment(table_prefix + part->get_info().getBasicPartName(), worker_id, expire_at_ns);
+            auto & dst = ret[worker_id];
+            std::move(assigned_parts.begin(), assigned_parts.end(), std::back_inserter(dst));
+        }
+    }
+
+    LOG_DEBUG(
+        &Poco::Logger::get("Cache Resident Assignment"),
+        "Assigned {} of {} parts to their cache-resident workers.",
+        num_resident,
+        parts.size());
+    reportStats(ret, "Cache Resident Assignment", num_workers);
+    return ret;
+}
 
 template <typename DataPartsCnchVector>
-std::unordered_map<String, DataPartsCnchVector> assignCnchParts(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts)
+std::unordered_map<String, DataPartsCnchVector> assignCnchPartsByHashPolicy(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts)
 {
     switch (worker_group->getContext()->getPartAllocationAlgo())
     {
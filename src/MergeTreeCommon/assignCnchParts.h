@@ -45,8 +45,11 @@ struct BucketNumberAndServerPartsAssignment
 FilePartsAssignMap assignCnchFileParts(const WorkerGroupHandle & worker_group, const FileDataPartsCNCHVector & parts);
 HivePartsAssignMap assignCnchHiveParts(const WorkerGroupHandle & worker_group, const HiveFiles & parts);
 
+/// `storage_uuid` identifies the table the parts belong to; identically named parts of
+/// different tables must not share cache-residency state.
 template <typename DataPartsCnchVector>
-std::unordered_map<String, DataPartsCnchVector> assignCnchParts(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts);
+std::unordered_map<String, DataPartsCnchVector>
+assignCnchParts(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts, const UUID & storage_uuid);
 
 /**
  * splitCnchParts will split server parts into bucketed parts and leftover server parts.
@@ -17,6 +17,7 @@
 
 #include <Optimizer/CardinalityEstimate/AggregateEstimator.h>
 #include <Optimizer/CardinalityEstimate/AssignUniqueIdEstimator.h>
+#include <Optimizer/CardinalityEstimate/CardinalityFeedback.h>
 #include <Optimizer/CardinalityEstimate/EnforceSingleRowEstimator.h>
 #include <Optimizer/CardinalityEstimate/ExchangeEstimator.h>
 #include <Optimizer/CardinalityEstimate/FilterEstimator.h>
@@ -29,6 +30,8 @@
 #include <Optimizer/CardinalityEstimate/UnionEstimator.h>
 #include <Optimizer/CardinalityEstimate/WindowEstimator.h>
 #include <Optimizer/PredicateUtils.h>
+#include <Optimizer/Signature/PlanSignature.h>
+#include <Interpreters/Context.h>
 #include <QueryPlan/MergeSortingStep.h>
 #include <QueryPlan/MergingSortedStep.h>
 #include <QueryPlan/PartialSortingStep.h>
@@ -82,6 +85,46 @@ CardinalityEstimator::estimate(PlanNodeBase & node, CTEInfo & cte_info, ContextM
 void CardinalityEstimator::estimate(QueryPlan & node, ContextMutablePtr context, bool re_estimate)
 {
     estimate(*node.getPlanNode(), node.getCTEInfo(), context, true, re_estimate);
+
+    if (context->getSettingsRef().enable_cardinality_feedback)
+        applyCardinalityFeedback(node, context);
+}
+
+void CardinalityEstimator::applyCardinalityFeedback(QueryPlan & plan, ContextMutablePtr context)
+{
+    auto & feedback = CardinalityFeedback::instance();
+
+    PlanSignatureProvider provider(plan, context);
+    std::unordered_map<const PlanNodeBase *, PlanSignature> signatures;
+    for (const auto & [node, signature] : provider.computeSignatures())
+        signatures.emplace(node.get(), signature);
+
+    std::function<void(const PlanNodePtr &)> override_stats = [&](const PlanNodePtr & node) {
+        for (const auto & child : node->getChildren())
+            override_stats(child);
+
+        auto it = signatures.find(node.get());
+        if (it == signatures.end())
+            return;
+        auto observed = feedback.lookup(it->second);
+        if (!observed)
+            return;
+        /// The observed cardinality beats the static estimate; keep the symbol statistics,
+        /// they remain the best available distribution info for this node.
+        const auto & estimated = node->getStatistics();
+        PlanNodeStatisticsPtr stats = estimated.has_value() ? estimated.value()->copy() : std::make_shared<PlanNodeStatistics>();
+        stats->setRowCount(*observed);
+        node->setStatistics(PlanNodeStatisticsEstimate{std::make_optional(stats)});
+    };
+
+    for (const auto & [cte_id, cte_root] : plan.getCTEInfo().getCTEs())
+        override_stats(cte_root);
+    override_stats(plan.getPlanNode());
+
+    /// The result cardinality of this run is attributed to the root signature at query end,
+    /// see CardinalityFeedback.
+    if (auto it = signatures.find(plan.getPlanNode().get()); it != signatures.end())
+        feedback.registerQuery(context->getCurrentQueryId(), it->second);
 }
 
 PlanNodeStatisticsPtr CardinalityVisitor::visitStep(const IQueryPlanStep &, CardinalityContext & context)
@@ -45,6 +45,11 @@ public:
         bool re_estimate = false);
 
     static void estimate(QueryPlan & plan, ContextMutablePtr context, bool re_estimate = false);
+
+private:
+    /// Override derived estimates with output cardinalities observed from previous runs of
+    /// the same (normalized) plan nodes, and register the plan root for runtime feedback.
+    static void applyCardinalityFeedback(QueryPlan & plan, ContextMutablePtr context);
 };
 
 struct CardinalityContext
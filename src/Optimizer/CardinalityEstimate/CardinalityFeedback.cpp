@@ -0,0 +1,65 @@
+#include <Optimizer/CardinalityEstimate/CardinalityFeedback.h>
+
+namespace DB
+{
+
+namespace
+{
+    constexpr size_t max_feedback_entries = 10000;
+}
+
+CardinalityFeedback & CardinalityFeedback::instance()
+{
+    static CardinalityFeedback ret;
+    return ret;
+}
+
+CardinalityFeedback::CardinalityFeedback() : observed_rows(max_feedback_entries)
+{
+}
+
+std::optional<UInt64> CardinalityFeedback::lookup(PlanSignature signature) const
+{
+    if (auto rows = observed_rows.get(signature))
+        return *rows;
+    return std::nullopt;
+}
+
+void CardinalityFeedback::record(PlanSignature signature, UInt64 output_rows)
+{
+    if (auto prev = observed_rows.get(signature))
+        output_rows = (3 * *prev + output_rows) / 4;
+    observed_rows.set(signature, std::make_shared<UInt64>(output_rows));
+}
+
+void CardinalityFeedback::registerQuery(const String & query_id, PlanSignature root_signature)
+{
+    std::lock_guard lock(pending_mutex);
+    /// Registrations whose query never reports back (e.g. server-side failures bypassing the
+    /// exception callback) should not accumulate forever.
+    if (pending_queries.size() >= max_feedback_entries)
+        pending_queries.clear();
+    pending_queries[query_id] = root_signature;
+}
+
+void CardinalityFeedback::onQuerySucceed(const String & query_id, UInt64 result_rows)
+{
+    PlanSignature signature;
+    {
+        std::lock_guard lock(pending_mutex);
+        auto it = pending_queries.find(query_id);
+        if (it == pending_queries.end())
+            return;
+        signature = it->second;
+        pending_queries.erase(it);
+    }
+    record(signature, result_rows);
+}
+
+void CardinalityFeedback::onQueryFinish(const String & query_id)
+{
+    std::lock_guard lock(pending_mutex);
+    pending_queries.erase(query_id);
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Optimizer/Signature/PlanSignature.h>
+#include <common/types.h>
+
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace DB
+{
+
+/** Process-wide store of output cardinalities observed at runtime, keyed by normalized
+  * plan-node signature (see Optimizer/Signature). When enable_cardinality_feedback is set,
+  * the estimator consults it after deriving static statistics, so recurring queries whose
+  * filters are repeatedly misestimated converge to the cardinalities actually produced.
+  *
+  * Observations are attributed at query end: the estimator registers the root signature of
+  * the plan it costed, and executeQuery reports the result row count once the query
+  * succeeds. Repeated observations are EWMA-blended so one skewed run does not flip plans.
+  */
+class CardinalityFeedback
+{
+public:
+    static CardinalityFeedback & instance();
+
+    std::optional<UInt64> lookup(PlanSignature signature) const;
+    void record(PlanSignature signature, UInt64 output_rows);
+
+    /// Remember the running query's root signature so the observed result cardinality
+    /// can be attributed once the query finishes.
+    void registerQuery(const String & query_id, PlanSignature root_signature);
+    void onQuerySucceed(const String & query_id, UInt64 result_rows);
+    /// Drop the pending registration without recording (failed or cancelled query).
+    void onQueryFinish(const String & query_id);
+
+private:
+    CardinalityFeedback();
+
+    using FeedbackCache = LRUCache<PlanSignature, UInt64>;
+
+    mutable FeedbackCache observed_rows;
+
+    mutable std::mutex pending_mutex;
+    std::unordered_map<String, PlanSignature> pending_queries;
+};
+
+}
@@ -645,11 +645,67 @@ bool OptimizeInput::checkJoinInputProperties(const PropertySet & requried_input_
             new_child.getNodePartitioningRef().setRequireHandle(true);
         }
         input_properties.emplace_back(new_child_requires);
+
+        if (context->getOptimizerContext().getContext()->getSettingsRef().enable_bucket_shuffle_join)
+            addBucketShuffleInputProperties(requried_input_props, actual_input_props);
     }
 
     return match;
 }
 
+void OptimizeInput::addBucketShuffleInputProperties(const PropertySet & requried_input_props, const PropertySet & actual_input_props)
+{
+    const auto * join_step = dynamic_cast<const JoinStep *>(group_expr->getStep().get());
+    if (!join_step || actual_input_props.size() != 2)
+        return;
+
+    for (size_t bucket_index = 0; bucket_index < 2; ++bucket_index)
+    {
+        const auto & bucket_partitioning = actual_input_props[bucket_index].getNodePartitioning();
+        if (bucket_partitioning.getHandle() != Partitioning::Handle::BUCKET_TABLE || bucket_partitioning.getBuckets() == 0
+            || !bucket_partitioning.isSatisfyWorker() || !bucket_partitioning.isSupportBucketShuffle())
+            continue;
+
+        auto equivalences = context->getMemo().getGroupById(group_expr->getChildrenGroups()[bucket_index])->getEquivalences();
+        auto rep_map = equivalences->representMap();
+        const auto & own_keys = bucket_index == 0 ? join_step->getLeftKeys() : join_step->getRightKeys();
+        const auto & other_keys = bucket_index == 0 ? join_step->getRightKeys() : join_step->getLeftKeys();
+
+        // Translate every cluster-by column to the join key of the other side, keeping the
+        // order the bucket hash is computed with. Give up when a column is not a join key.
+        Names other_columns;
+        for (const auto & column : bucket_partitioning.getColumns())
+        {
+            auto represent = rep_map.count(column) ? rep_map.at(column) : column;
+            size_t key_index = 0;
+            for (; key_index < own_keys.size(); ++key_index)
+            {
+                auto key = own_keys[key_index];
+                key = rep_map.count(key) ? rep_map.at(key) : key;
+                if (key == represent)
+                    break;
+            }
+            if (key_index == own_keys.size())
+                break;
+            other_columns.emplace_back(other_keys[key_index]);
+        }
+        if (other_columns.empty() || other_columns.size() != bucket_partitioning.getColumns().size())
+            continue;
+
+        // Require the bucket side layout as it is, so it stays in place, and the same layout
+        // translated to the other side, which the enforcer realizes with a BUCKET_REPARTITION
+        // exchange (see PropertyEnforcer::enforceNodePartitioning).
+        auto new_child_requires = requried_input_props;
+        auto bucket_side_partitioning = bucket_partitioning;
+        bucket_side_partitioning.setRequireHandle(true);
+        auto other_side_partitioning = bucket_side_partitioning;
+        other_side_partitioning.setColumns(std::move(other_columns));
+        new_child_requires[bucket_index].setNodePartitioning(std::move(bucket_side_partitioning));
+        new_child_requires[1 - bucket_index].setNodePartitioning(std::move(other_side_partitioning));
+        input_properties.emplace_back(std::move(new_child_requires));
+    }
+}
+
 
 void OptimizeInput::enforcePropertyAndUpdateWinner(
     OptContextPtr & opt_context,
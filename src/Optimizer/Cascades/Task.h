@@ -181,6 +181,13 @@ private:
      */
     bool checkJoinInputProperties(const PropertySet & requried_input_props, const PropertySet & actual_input_props);
 
+    /**
+     * When exactly one join side is a clustered bucket table whose layout the exchange
+     * layer can reproduce, add input properties which keep that side in place and
+     * repartition only the other side with the bucket hash (bucket shuffle join).
+     */
+    void addBucketShuffleInputProperties(const PropertySet & requried_input_props, const PropertySet & actual_input_props);
+
     /**
      * GroupExpression to optimize
      */
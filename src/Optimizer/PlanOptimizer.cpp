@@ -27,6 +27,7 @@
 #include <Optimizer/Rewriter/GroupByKeysPruning.h>
 #include <Optimizer/Rewriter/MaterializedViewRewriter.h>
 #include <Optimizer/Rewriter/OptimizeTrivialCount.h>
+#include <Optimizer/Rewriter/OptimizeTrivialMinMax.h>
 #include <Optimizer/Rewriter/PredicatePushdown.h>
 #include <Optimizer/Rewriter/RemoveApply.h>
 #include <Optimizer/Rewriter/RemoveRedundantAggregate.h>
@@ -37,6 +38,10 @@
 #include <Optimizer/Rewriter/SimplifyCrossJoin.h>
 #include <Optimizer/Rewriter/UnifyJoinOutputs.h>
 #include <Optimizer/Rewriter/UnifyNullableType.h>
+#include <Optimizer/Rewriter/SelectSortedMergeJoin.h>
+#include <Optimizer/Rewriter/SetAggregatingSizeHint.h>
+#include <Optimizer/Rewriter/LazyTopNMaterialization.h>
+#include <Optimizer/Rewriter/SetHashJoinCacheKey.h>
 #include <Optimizer/Rewriter/UseSortingProperty.h>
 #include <Optimizer/Rule/Rules.h>
 #include <QueryPlan/GraphvizPrinter.h>
@@ -113,6 +118,7 @@ const Rewriters & PlanOptimizer::getSimpleRewriters()
         std::make_shared<IterativeRewriter>(Rules::pushDownTopNFilteringRules(), "pushDownTopNFiltering"),
 
         std::make_shared<OptimizeTrivialCount>(),
+        std::make_shared<OptimizeTrivialMinMax>(),
 
         // add exchange
         std::make_shared<CascadesOptimizer>(false),
@@ -268,6 +274,7 @@ const Rewriters & PlanOptimizer::getFullRewriters()
         std::make_shared<IterativeRewriter>(Rules::pushDownTopNFilteringRules(), "pushDownTopNFiltering"),
 
         std::make_shared<OptimizeTrivialCount>(),
+        std::make_shared<OptimizeTrivialMinMax>(),
 
         // Cost-based optimizer
         std::make_shared<CascadesOptimizer>(),
@@ -297,6 +304,7 @@ const Rewriters & PlanOptimizer::getFullRewriters()
         std::make_shared<SortingOrderedSource>(),
 
         std::make_shared<OptimizeTrivialCount>(),
+        std::make_shared<OptimizeTrivialMinMax>(),
         // push predicate into storage
         std::make_shared<IterativeRewriter>(Rules::pushIntoTableScanRules(), "PushIntoTableScan"),
         std::make_shared<ShareCommonExpression>(), // this rule depends on enable_optimizer_early_prewhere_push_down
@@ -310,6 +318,10 @@ const Rewriters & PlanOptimizer::getFullRewriters()
         std::make_shared<AddBufferForDeadlockCTE>(),
         std::make_shared<IterativeRewriter>(Rules::pushTableScanEmbeddedStepRules(), "PushTableScanEmbeddedStepRules"),
         std::make_shared<ImplementJoinAlgorithmHints>(),
+        std::make_shared<SelectSortedMergeJoin>(),
+        std::make_shared<SetAggregatingSizeHint>(),
+        std::make_shared<LazyTopNMaterialization>(),
+        std::make_shared<SetHashJoinCacheKey>(),
         std::make_shared<IterativeRewriter>(Rules::explainAnalyzeRules(), "ExplainAnalyze"),
     };
 
@@ -136,8 +136,8 @@ Partitioning Partitioning::translate(const std::unordered_map<String, String> &
         else // note: don't discard column
             translate_columns.emplace_back(column);
     }
-    auto result
-        = Partitioning{handle, translate_columns, require_handle, buckets, enforce_round_robin, component, exactly_match, satisfy_worker};
+    auto result = Partitioning{
+        handle, translate_columns, require_handle, buckets, enforce_round_robin, component, exactly_match, satisfy_worker, support_bucket_shuffle};
     result.setPreferred(preferred);
     return result;
 }
@@ -87,7 +87,8 @@ public:
         bool enforce_round_robin_ = true,
         Component component_ = Component::ANY,
         bool exactly_match_ = false,
-        bool satisfy_worker_ = false)
+        bool satisfy_worker_ = false,
+        bool support_bucket_shuffle_ = false)
         : handle(handle_)
         , columns(std::move(columns_))
         , require_handle(require_handle_)
@@ -96,6 +97,7 @@ public:
         , component(component_)
         , exactly_match(exactly_match_)
         , satisfy_worker(satisfy_worker_)
+        , support_bucket_shuffle(support_bucket_shuffle_)
     {
     }
     void setHandle(Handle handle_) { handle = handle_; }
@@ -125,6 +127,13 @@ public:
         this->satisfy_worker = satisfy_worker_;
     }
 
+    /// Whether the bucket layout is produced by the default SipHash scatter, so that a
+    /// BUCKET_REPARTITION exchange can reproduce the bucket number for arbitrary streams.
+    /// Layouts built with a split number or a user defined expression hash differently.
+    bool isSupportBucketShuffle() const { return support_bucket_shuffle; }
+
+    void setSupportBucketShuffle(bool support_bucket_shuffle_) { this->support_bucket_shuffle = support_bucket_shuffle_; }
+
     Partitioning translate(const std::unordered_map<String, String> & identities) const;
     Partitioning normalize(const SymbolEquivalences & symbol_equivalences) const;
     bool satisfy(const Partitioning &, const Constants & constants) const;
@@ -153,6 +162,7 @@ private:
     Component component;
     bool exactly_match;
     bool satisfy_worker;
+    bool support_bucket_shuffle;
     bool preferred = false;
 };
 
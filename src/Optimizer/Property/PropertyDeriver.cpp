@@ -106,6 +106,7 @@ Property PropertyDeriver::deriveStorageProperty(const StoragePtr & storage, cons
     auto metadata = storage->getInMemoryMetadataPtr();
     Names cluster_by;
     UInt64 buckets = 0;
+    bool support_bucket_shuffle = false;
     if (storage->isBucketTable())
     {
         bool clustered = storage->isTableClustered(context);
@@ -121,6 +122,10 @@ Property PropertyDeriver::deriveStorageProperty(const StoragePtr & storage, cons
             else
             {
                 cluster_by = metadata->cluster_by_key.column_names;
+                // The exchange layer can only reproduce the bucket number for the default
+                // SipHash layout, see RepartitionTransform::doBucketRepartition.
+                support_bucket_shuffle = metadata->getSplitNumberFromClusterByKey() <= 0
+                    && !metadata->getIsUserDefinedExpressionFromClusterByKey();
             }
             buckets = metadata->getBucketNumberFromClusterByKey();
         }
@@ -138,7 +143,16 @@ Property PropertyDeriver::deriveStorageProperty(const StoragePtr & storage, cons
                 }
 #endif
         return Property{
-            Partitioning{Partitioning::Handle::BUCKET_TABLE, cluster_by, true, buckets, true, Partitioning::Component::ANY, false, satisfyBucketWorkerRelation(storage, *context)},
+            Partitioning{
+                Partitioning::Handle::BUCKET_TABLE,
+                cluster_by,
+                true,
+                buckets,
+                true,
+                Partitioning::Component::ANY,
+                false,
+                satisfyBucketWorkerRelation(storage, *context),
+                support_bucket_shuffle},
             Partitioning{},
             sorting};
     }
@@ -411,6 +425,7 @@ Property DeriverVisitor::visitUnionStep(const UnionStep & step, DeriverContext &
         Names output_keys;
         bool match = true;
         bool satisfy_worker = true;
+        bool support_bucket_shuffle = true;
         bool bucket_size_match = true;
         for (auto & transformed : transformed_children_prop)
         {
@@ -424,6 +439,7 @@ Property DeriverVisitor::visitUnionStep(const UnionStep & step, DeriverContext &
                 match = false;
             }
             satisfy_worker &= transformed.getNodePartitioning().isSatisfyWorker();
+            support_bucket_shuffle &= transformed.getNodePartitioning().isSupportBucketShuffle();
         }
 
         if (!satisfy_worker)
@@ -446,7 +462,8 @@ Property DeriverVisitor::visitUnionStep(const UnionStep & step, DeriverContext &
                     first_child_property.getNodePartitioning().isEnforceRoundRobin(),
                     first_child_property.getNodePartitioning().getComponent(),
                     false,
-                    satisfy_worker},
+                    satisfy_worker,
+                    support_bucket_shuffle},
                 Partitioning{Partitioning::Handle::SINGLE}};
         }
         else
@@ -459,7 +476,8 @@ Property DeriverVisitor::visitUnionStep(const UnionStep & step, DeriverContext &
                 first_child_property.getNodePartitioning().isEnforceRoundRobin(),
                 first_child_property.getNodePartitioning().getComponent(),
                 false,
-                satisfy_worker}};
+                satisfy_worker,
+                support_bucket_shuffle}};
         }
     }
     return Property{};
@@ -490,7 +508,7 @@ Property DeriverVisitor::visitExchangeStep(const ExchangeStep & step, DeriverCon
         return output.clearSorting();
     }
 
-    if (mode == ExchangeMode::REPARTITION)
+    if (mode == ExchangeMode::REPARTITION || mode == ExchangeMode::BUCKET_REPARTITION)
     {
         Property output = context.getInput()[0];
         output.setNodePartitioning(step.getSchema());
@@ -100,6 +100,9 @@ QueryPlanStepPtr PropertyEnforcer::enforceNodePartitioning(
         case Partitioning::Handle::ARBITRARY:
             return nullptr;
         case Partitioning::Handle::BUCKET_TABLE:
+            // Repartition with the bucket-table hash, so that the stream lines up with the
+            // clustered side of a bucket join and the join runs without further exchange.
+            return std::make_unique<ExchangeStep>(streams, ExchangeMode::BUCKET_REPARTITION, partitioning, keep_order);
         default:
             throw Exception("Property Enforce error", ErrorCodes::ILLEGAL_ENFORCE);
     }
@@ -0,0 +1,95 @@
+#include <Optimizer/Rewriter/LazyTopNMaterialization.h>
+
+#include <Parsers/ASTSelectQuery.h>
+#include <QueryPlan/SortingStep.h>
+#include <QueryPlan/TableScanStep.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+void LazyTopNMaterialization::rewrite(QueryPlan & plan, ContextMutablePtr context) const
+{
+    LazyTopNMaterializationVisitor visitor{context, plan.getCTEInfo()};
+    Void v;
+    VisitorUtil::accept(*plan.getPlanNode(), visitor, v);
+}
+
+String LazyTopNMaterialization::name() const
+{
+    return "LazyTopNMaterialization";
+}
+
+Void LazyTopNMaterializationVisitor::visitSortingNode(SortingNode & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+
+    auto & sorting = *node.getStep();
+    if (sorting.hasPreparedParam())
+        return {};
+
+    UInt64 limit = sorting.getLimitValue();
+    if (!limit || limit > context->getSettingsRef().max_limit_for_lazy_topn_materialization)
+        return {};
+
+    if (node.getChildren().size() != 1 || node.getChildren()[0]->getStep()->getType() != IQueryPlanStep::Type::TableScan)
+        return {};
+    auto table_scan = std::dynamic_pointer_cast<TableScanStep>(node.getChildren()[0]->getStep());
+
+    /// Any computation below the sort needs its inputs materialized up front, so only
+    /// plain scans qualify. Filters are excluded as well: the locator columns would
+    /// have to survive the filter, and selective filters already shrink the read.
+    if (table_scan->getPushdownAggregation() || table_scan->getPushdownProjection() || table_scan->getPushdownFilter()
+        || table_scan->hasInlineExpressions())
+        return {};
+
+    const auto * select = table_scan->getQueryInfo().query->as<ASTSelectQuery>();
+    if (!select || select->getWhere() || select->getPrewhere())
+        return {};
+
+    /// Every sort symbol must be a plain alias of a storage column, and there must be
+    /// at least one other output column whose materialization is worth deferring.
+    auto alias_to_column = table_scan->getAliasToColumnMap();
+    NameSet sort_columns;
+    for (const auto & sort_column : sorting.getSortDescription())
+    {
+        auto it = alias_to_column.find(sort_column.column_name);
+        if (it == alias_to_column.end())
+            return {};
+        sort_columns.emplace(it->second);
+    }
+    if (sort_columns.empty())
+        return {};
+
+    bool has_columns_to_defer = false;
+    for (const auto & name_with_alias : table_scan->getColumnAlias())
+        if (!sort_columns.count(name_with_alias.first))
+            has_columns_to_defer = true;
+    if (!has_columns_to_defer)
+        return {};
+
+    LOG_DEBUG(
+        &Poco::Logger::get("LazyTopNMaterialization"),
+        "Scan of {} reads sort columns only, the remaining columns are fetched for the top {} rows",
+        table_scan->getStorageID().getFullTableName(),
+        limit);
+    table_scan->setLazyTopN(sorting.getSortDescription(), limit);
+    return {};
+}
+
+Void LazyTopNMaterializationVisitor::visitPlanNode(PlanNodeBase & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+    return {};
+}
+
+Void LazyTopNMaterializationVisitor::visitCTERefNode(CTERefNode & node, Void & v)
+{
+    CTEId cte_id = node.getStep()->getId();
+    cte_helper.accept(cte_id, *this, v);
+    return {};
+}
+
+}
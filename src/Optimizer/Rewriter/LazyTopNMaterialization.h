@@ -0,0 +1,46 @@
+#pragma once
+#include <Optimizer/Rewriter/Rewriter.h>
+#include <QueryPlan/PlanNode.h>
+#include <QueryPlan/PlanVisitor.h>
+#include <QueryPlan/SimplePlanRewriter.h>
+
+namespace DB
+{
+
+/// Marks `Sorting(limit) -> TableScan` patterns for lazy TopN materialization: the scan
+/// then reads only the sort columns plus the implicit row locators, sorts and cuts to
+/// the limit, and fetches the remaining columns for the surviving rows with a second
+/// targeted read (see MergeTreeLazyFetchTransform). The Sorting step is kept: it
+/// re-sorts at most `limit` rows, which costs next to nothing and keeps the plan shape
+/// unchanged. The scan falls back to a normal read at pipeline build time if the
+/// storage does not qualify.
+class LazyTopNMaterialization : public Rewriter
+{
+public:
+    String name() const override;
+
+private:
+    void rewrite(QueryPlan & plan, ContextMutablePtr context) const override;
+    bool isEnabled(ContextMutablePtr context) const override
+    {
+        return context->getSettingsRef().enable_lazy_topn_materialization;
+    }
+};
+
+class LazyTopNMaterializationVisitor : public PlanNodeVisitor<Void, Void>
+{
+public:
+    LazyTopNMaterializationVisitor(ContextMutablePtr context_, CTEInfo & cte_info_) : context(context_), cte_helper(cte_info_)
+    {
+    }
+
+private:
+    Void visitSortingNode(SortingNode & node, Void &) override;
+    Void visitPlanNode(PlanNodeBase & node, Void &) override;
+    Void visitCTERefNode(CTERefNode & node, Void &) override;
+
+    ContextMutablePtr context;
+    SimpleCTEVisitHelper<void> cte_helper;
+};
+
+}
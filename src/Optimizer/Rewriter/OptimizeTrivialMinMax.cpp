@@ -0,0 +1,195 @@
+#include <utility>
+#include <Optimizer/Rewriter/OptimizeTrivialMinMax.h>
+
+#include <QueryPlan/IQueryPlanStep.h>
+#include <QueryPlan/PlanNode.h>
+#include <QueryPlan/ProjectionStep.h>
+#include <QueryPlan/ValuesStep.h>
+#include <QueryPlan/Void.h>
+#include <Interpreters/InterpreterSelectQuery.h>
+#include <Optimizer/Rewriter/OptimizeTrivialCount.h>
+#include <Parsers/ASTIdentifier.h>
+#include <Parsers/IAST_fwd.h>
+
+
+namespace DB
+{
+
+void OptimizeTrivialMinMax::rewrite(QueryPlan & plan, ContextMutablePtr context) const
+{
+    if (context->getSettingsRef().max_parallel_replicas > 1)
+        return;
+    TrivialMinMaxVisitor visitor{context, plan.getCTEInfo()};
+    Void v;
+    auto result = VisitorUtil::accept(plan.getPlanNode(), visitor, v);
+    plan.update(result);
+}
+
+PlanNodePtr TrivialMinMaxVisitor::visitAggregatingNode(AggregatingNode & node, Void & v)
+{
+    // check functions: every aggregate function is min or max over a single plain argument, and there are no grouping keys
+    const auto & agg_step = dynamic_cast<const AggregatingStep &>(*node.getStep().get());
+    const auto & aggregates = agg_step.getParams().aggregates;
+    if (aggregates.empty() || !agg_step.getKeys().empty() || !agg_step.isFinal()
+        || agg_step.getOutputStream().header.columns() != aggregates.size())
+        return visitPlanNode(node, v);
+
+    for (size_t i = 0; i < aggregates.size(); ++i)
+    {
+        const auto & function_name = aggregates[i].function->getName();
+        if ((function_name != "min" && function_name != "max") || aggregates[i].argument_names.size() != 1
+            || !aggregates[i].parameters.empty()
+            || agg_step.getOutputStream().header.getByPosition(i).name != aggregates[i].column_name)
+            return visitPlanNode(node, v);
+    }
+
+    MinMaxContextVisitor visitor;
+    TrivialMinMaxContext minmax_context;
+    // get the filters in FilterNode, get the query and storage in TableScanNode
+    VisitorUtil::accept(node.getChildren()[0], visitor, minmax_context);
+
+    // There are other nodes below this node that change the output lines except for the FilterNode
+    if (minmax_context.has_other_node || !minmax_context.query || minmax_context.pushdowned_index_projection)
+        return visitPlanNode(node, v);
+
+    // check query
+    auto select_query = minmax_context.query->as<ASTSelectQuery &>();
+    if (select_query.sampleSize() || select_query.sampleOffset())
+        return visitPlanNode(node, v);
+
+    // check storage
+    auto storage = minmax_context.storage;
+    if (!storage || !storage->supportsTrivialCount()
+        || context->getRowPolicyCondition(
+            storage->getStorageID().getDatabaseName(), storage->getStorageID().getTableName(), RowPolicy::SELECT_FILTER))
+        return visitPlanNode(node, v);
+
+    // resolve every aggregate argument to a plain storage column
+    std::unordered_map<String, String> alias_to_column;
+    for (const auto & item : minmax_context.column_alias)
+        alias_to_column.emplace(item.second, item.first);
+
+    Names source_columns;
+    source_columns.reserve(aggregates.size());
+    for (const auto & aggregate : aggregates)
+    {
+        String symbol = aggregate.argument_names[0];
+        for (const auto & projection_map : minmax_context.projection_maps)
+        {
+            auto it = projection_map.find(symbol);
+            if (it == projection_map.end())
+                return visitPlanNode(node, v);
+            symbol = it->second;
+        }
+        if (auto it = alias_to_column.find(symbol); it != alias_to_column.end())
+            symbol = it->second;
+        source_columns.emplace_back(symbol);
+    }
+
+    minmax_context.filters = TrivialCountVisitor::replaceColumnsAlias(minmax_context.filters, minmax_context.column_alias);
+    auto filters = minmax_context.filters;
+    if (select_query.prewhere())
+        filters.emplace_back(select_query.prewhere());
+    if (select_query.where())
+        filters.emplace_back(select_query.where());
+
+    NameSet required = TrivialCountVisitor::getRequiredColumns(filters);
+
+    // Check if required columns are partition keys. Unlike the trivial count, virtual columns
+    // (_part and friends) are not allowed: the storage side only evaluates the partition predicate.
+    if (!required.empty())
+    {
+        const auto & partition_desc = storage->getInMemoryMetadataPtr()->getPartitionKey();
+        if (!partition_desc.expression)
+            return visitPlanNode(node, v);
+        auto partition_columns = partition_desc.expression->getRequiredColumns();
+        for (const auto & required_column : required)
+        {
+            if (std::find(partition_columns.begin(), partition_columns.end(), required_column) == partition_columns.end())
+                return visitPlanNode(node, v);
+        }
+    }
+
+    // set query.select() to select min(x), max(y) ... over the resolved columns
+    select_query.setExpression(ASTSelectQuery::Expression::SELECT, std::make_shared<ASTExpressionList>());
+    select_query.select()->children.reserve(aggregates.size());
+    for (size_t i = 0; i < aggregates.size(); ++i)
+        select_query.select()->children.emplace_back(
+            makeASTFunction(aggregates[i].function->getName(), std::make_shared<ASTIdentifier>(source_columns[i])));
+
+    if (select_query.where())
+        minmax_context.filters.emplace_back(select_query.where());
+    ASTPtr where_function;
+    if (minmax_context.filters.size() > 1)
+        where_function = makeASTFunction("and", minmax_context.filters);
+    else if (minmax_context.filters.size() == 1)
+        where_function = minmax_context.filters[0];
+    if (where_function)
+        select_query.setExpression(ASTSelectQuery::Expression::WHERE, std::move(where_function));
+
+    // 'Interpreter' the query to build the query_info the storage shortcut needs
+    auto interpreter = std::make_shared<InterpreterSelectQuery>(select_query.clone(), context, SelectQueryOptions());
+    SelectQueryInfo temp_query_info;
+    temp_query_info.query = interpreter->getQuery();
+    temp_query_info.syntax_analyzer_result = interpreter->getSyntaxAnalyzerResult();
+    temp_query_info.sets = interpreter->getQueryAnalyzer()->getPreparedSets();
+
+    // try to get the min/max values from part metadata, if failed, do not optimize.
+    std::unordered_map<String, std::pair<Field, Field>> column_min_max;
+    Fields fields;
+    fields.reserve(aggregates.size());
+    for (size_t i = 0; i < aggregates.size(); ++i)
+    {
+        auto it = column_min_max.find(source_columns[i]);
+        if (it == column_min_max.end())
+        {
+            auto min_max = storage->minMaxValuesByPartitionPredicate(temp_query_info, context, source_columns[i]);
+            if (!min_max)
+                return visitPlanNode(node, v);
+            it = column_min_max.emplace(source_columns[i], *min_max).first;
+        }
+        fields.emplace_back(aggregates[i].function->getName() == "min" ? it->second.first : it->second.second);
+    }
+
+    auto values_step = std::make_shared<ValuesStep>(node.getCurrentDataStream().header, fields);
+    return PlanNodeBase::createPlanNode(context->nextNodeId(), std::move(values_step), {});
+}
+
+void MinMaxContextVisitor::visitProjectionNode(ProjectionNode & node, TrivialMinMaxContext & context)
+{
+    std::unordered_map<String, String> projection_map;
+    for (const auto & assignment : node.getStep()->getAssignments())
+    {
+        if (const auto * identifier = assignment.second->as<ASTIdentifier>())
+            projection_map.emplace(assignment.first, identifier->name());
+    }
+    context.projection_maps.emplace_back(std::move(projection_map));
+    VisitorUtil::accept(node.getChildren()[0], *this, context);
+}
+
+void MinMaxContextVisitor::visitFilterNode(FilterNode & node, TrivialMinMaxContext & context)
+{
+    if (node.getStep()->getFilter())
+        context.filters.emplace_back(node.getStep()->getFilter()->clone());
+    VisitorUtil::accept(node.getChildren()[0], *this, context);
+}
+
+void MinMaxContextVisitor::visitSortingNode(SortingNode & node, TrivialMinMaxContext & context)
+{
+    VisitorUtil::accept(node.getChildren()[0], *this, context);
+}
+
+void MinMaxContextVisitor::visitTableScanNode(TableScanNode & node, TrivialMinMaxContext & context)
+{
+    context.storage = node.getStep()->getStorage();
+    context.query = node.getStep()->getQueryInfo().query->clone();
+    context.column_alias = node.getStep()->getColumnAlias();
+    context.pushdowned_index_projection = node.getStep()->hasInlineExpressions();
+}
+
+void MinMaxContextVisitor::visitPlanNode(PlanNodeBase &, TrivialMinMaxContext & context)
+{
+    context.has_other_node = true;
+}
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Optimizer/Rewriter/Rewriter.h>
+#include <QueryPlan/PlanVisitor.h>
+#include <QueryPlan/SimplePlanRewriter.h>
+
+
+namespace DB
+{
+
+struct TrivialMinMaxContext
+{
+    bool has_other_node = false;
+    ASTs filters;
+    StoragePtr storage;
+    ASTPtr query;
+    NamesWithAliases column_alias;
+    bool pushdowned_index_projection = false;
+    /// Output symbol -> input symbol for every projection between the aggregation and the
+    /// table scan, in visit order. Only plain column references are recorded, so a missing
+    /// entry means the symbol is a computed expression and the rewrite must give up.
+    std::vector<std::unordered_map<String, String>> projection_maps;
+};
+
+/**
+ * MIN/MAX optimization
+ * When every aggregate function is min or max over a column covered by the partition minmax
+ * index, the values can be read directly from part metadata instead of scanning data.
+ * For example:
+ * select min(d), max(d) from table1;  -- d is a partition key column
+ * select max(d) from table1 where d > '2022-01-01';  -- the filter only uses partition keys
+ *
+ * select max(ts) from table1;  -- ts is not a partition key column, can't be optimized
+ *
+ *  Conditions
+ *  1. The AggregatingNode is final, has no grouping keys, and all its aggregate functions are min or max over a plain column;
+ *  2. There are no nodes below this node that filter rows except for the FilterNode；
+ *  3. Where and prewhere clauses are empty or the columns involved in the where and prewhere clauses are PartitionKey；
+ *  4. Every aggregated column is covered by the partition minmax index, and the table has no unique key
+ *     (delete bitmaps may remove the rows holding the stored extremes);
+ *  5. setting optimize_trivial_minmax_query=1 and max_parallel_replicas=1;
+ *
+ *
+ */
+
+
+class OptimizeTrivialMinMax : public Rewriter
+{
+public:
+    String name() const override { return "OptimizeTrivialMinMax"; }
+
+private:
+    void rewrite(QueryPlan & plan, ContextMutablePtr context) const override;
+    bool isEnabled(ContextMutablePtr context) const override { return context->getSettingsRef().optimize_trivial_minmax_query; }
+};
+
+class TrivialMinMaxVisitor : public SimplePlanRewriter<Void>
+{
+public:
+    explicit TrivialMinMaxVisitor(ContextMutablePtr context_, CTEInfo & cte_info_) : SimplePlanRewriter(context_, cte_info_) { }
+
+private:
+    PlanNodePtr visitAggregatingNode(AggregatingNode & node, Void &) override;
+};
+
+class MinMaxContextVisitor : public PlanNodeVisitor<void, TrivialMinMaxContext>
+{
+private:
+    void visitProjectionNode(ProjectionNode & node, TrivialMinMaxContext &) override;
+    void visitFilterNode(FilterNode & node, TrivialMinMaxContext & context) override;
+    void visitSortingNode(SortingNode & node, TrivialMinMaxContext &) override;
+    void visitTableScanNode(TableScanNode & node, TrivialMinMaxContext &) override;
+    void visitPlanNode(PlanNodeBase & node, TrivialMinMaxContext &) override;
+};
+}
@@ -0,0 +1,107 @@
+#include <Optimizer/Rewriter/SelectSortedMergeJoin.h>
+
+#include <Optimizer/PredicateUtils.h>
+#include <QueryPlan/JoinStep.h>
+#include <QueryPlan/TableScanStep.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+void SelectSortedMergeJoin::rewrite(QueryPlan & plan, ContextMutablePtr context) const
+{
+    SortedMergeJoinVisitor visitor{context, plan.getCTEInfo()};
+    Void v;
+    VisitorUtil::accept(*plan.getPlanNode(), visitor, v);
+}
+
+String SelectSortedMergeJoin::name() const
+{
+    return "SelectSortedMergeJoin";
+}
+
+Void SortedMergeJoinVisitor::visitJoinNode(JoinNode & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+
+    auto & step = *node.getStep();
+
+    /// Leave joins alone when the algorithm was already chosen by a hint or a setting.
+    if (step.getJoinAlgorithm() != JoinAlgorithm::AUTO)
+        return {};
+    if (step.getKind() != ASTTableJoin::Kind::Inner && step.getKind() != ASTTableJoin::Kind::Left
+        && step.getKind() != ASTTableJoin::Kind::Right)
+        return {};
+    if (step.getStrictness() != ASTTableJoin::Strictness::All)
+        return {};
+    if (step.getLeftKeys().empty())
+        return {};
+    /// The merge join evaluates equi-keys only; an extra filter would change semantics.
+    if (step.getFilter() && !PredicateUtils::isTruePredicate(step.getFilter()))
+        return {};
+
+    if (scanSortedByKeys(*node.getChildren()[0], step.getLeftKeys())
+        && scanSortedByKeys(*node.getChildren()[1], step.getRightKeys()))
+    {
+        LOG_DEBUG(
+            &Poco::Logger::get("SelectSortedMergeJoin"),
+            "Both join inputs are sorted on the join keys, switching join {} to merge join",
+            node.getId());
+        step.setJoinAlgorithm(JoinAlgorithm::PARTIAL_MERGE);
+    }
+    return {};
+}
+
+Void SortedMergeJoinVisitor::visitPlanNode(PlanNodeBase & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+    return {};
+}
+
+Void SortedMergeJoinVisitor::visitCTERefNode(CTERefNode & node, Void & v)
+{
+    CTEId cte_id = node.getStep()->getId();
+    cte_helper.accept(cte_id, *this, v);
+    return {};
+}
+
+bool SortedMergeJoinVisitor::scanSortedByKeys(PlanNodeBase & node, const Names & keys)
+{
+    const auto * scan = dynamic_cast<const TableScanNode *>(&node);
+    if (!scan)
+        return false;
+
+    auto step = scan->getStep();
+    auto storage = step->getStorage();
+    if (!storage)
+        return false;
+
+    Names sorting_key = storage->getInMemoryMetadataPtr()->getSortingKeyColumns();
+    if (sorting_key.empty() || keys.size() > sorting_key.size())
+        return false;
+
+    /// Map join symbols back to the underlying column names.
+    std::unordered_map<String, String> symbol_to_column;
+    for (const auto & item : step->getColumnAlias())
+        symbol_to_column.emplace(item.second, item.first);
+
+    NameSet key_columns;
+    for (const auto & key : keys)
+    {
+        auto it = symbol_to_column.find(key);
+        if (it == symbol_to_column.end())
+            return false;
+        key_columns.insert(it->second);
+    }
+
+    /// The join keys must occupy the leading positions of the sorting key (in any order among
+    /// themselves), otherwise parts do not stream rows in join-key order.
+    for (size_t i = 0; i < keys.size(); ++i)
+        if (!key_columns.contains(sorting_key[i]))
+            return false;
+    return true;
+}
+
+}
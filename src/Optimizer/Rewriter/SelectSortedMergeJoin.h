@@ -0,0 +1,46 @@
+#pragma once
+#include <Optimizer/Rewriter/Rewriter.h>
+#include <QueryPlan/PlanNode.h>
+#include <QueryPlan/PlanVisitor.h>
+#include <QueryPlan/SimplePlanRewriter.h>
+
+namespace DB
+{
+
+/// Switches a join to the streaming merge join when both inputs are scans of tables whose
+/// physical sort order covers the join keys, so no hash table has to be built for the right
+/// side. Only joins the merge join can execute (ALL inner/left/right without extra filter)
+/// are considered, and explicit algorithm choices (hints, settings) are left untouched.
+class SelectSortedMergeJoin : public Rewriter
+{
+public:
+    String name() const override;
+
+private:
+    void rewrite(QueryPlan & plan, ContextMutablePtr context) const override;
+    bool isEnabled(ContextMutablePtr context) const override
+    {
+        return context->getSettingsRef().enable_sorted_merge_join_for_sorted_scans;
+    }
+};
+
+class SortedMergeJoinVisitor : public PlanNodeVisitor<Void, Void>
+{
+public:
+    explicit SortedMergeJoinVisitor(ContextMutablePtr /*context_*/, CTEInfo & cte_info_) : cte_helper(cte_info_)
+    {
+    }
+
+private:
+    Void visitJoinNode(JoinNode & node, Void &) override;
+    Void visitPlanNode(PlanNodeBase & node, Void &) override;
+    Void visitCTERefNode(CTERefNode & node, Void &) override;
+
+    /// Whether `node` scans a table whose sorting key covers `keys` with its first keys.size()
+    /// columns, i.e. every part already streams rows in join-key order.
+    static bool scanSortedByKeys(PlanNodeBase & node, const Names & keys);
+
+    SimpleCTEVisitHelper<void> cte_helper;
+};
+
+}
@@ -0,0 +1,63 @@
+#include <Optimizer/Rewriter/SetAggregatingSizeHint.h>
+
+#include <Optimizer/CardinalityEstimate/CardinalityEstimator.h>
+#include <QueryPlan/AggregatingStep.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+void SetAggregatingSizeHint::rewrite(QueryPlan & plan, ContextMutablePtr context) const
+{
+    AggregatingSizeHintVisitor visitor{context, plan.getCTEInfo()};
+    Void v;
+    VisitorUtil::accept(*plan.getPlanNode(), visitor, v);
+}
+
+String SetAggregatingSizeHint::name() const
+{
+    return "SetAggregatingSizeHint";
+}
+
+Void AggregatingSizeHintVisitor::visitAggregatingNode(AggregatingNode & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+
+    auto & step = *node.getStep();
+    if (step.getKeys().empty())
+        return {};
+
+    /// The output row count of an aggregation is the number of groups.
+    auto stats = CardinalityEstimator::estimate(node, cte_helper.getCTEInfo(), context);
+    if (!stats || !*stats)
+        return {};
+
+    UInt64 estimated_groups = (*stats)->getRowCount();
+    if (!estimated_groups)
+        return {};
+
+    LOG_DEBUG(
+        &Poco::Logger::get("SetAggregatingSizeHint"),
+        "Aggregation {} is estimated to produce {} groups",
+        node.getId(),
+        estimated_groups);
+    step.setEstimatedGroupCount(estimated_groups);
+    return {};
+}
+
+Void AggregatingSizeHintVisitor::visitPlanNode(PlanNodeBase & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+    return {};
+}
+
+Void AggregatingSizeHintVisitor::visitCTERefNode(CTERefNode & node, Void & v)
+{
+    CTEId cte_id = node.getStep()->getId();
+    cte_helper.accept(cte_id, *this, v);
+    return {};
+}
+
+}
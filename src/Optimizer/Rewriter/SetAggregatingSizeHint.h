@@ -0,0 +1,43 @@
+#pragma once
+#include <Optimizer/Rewriter/Rewriter.h>
+#include <QueryPlan/PlanNode.h>
+#include <QueryPlan/PlanVisitor.h>
+#include <QueryPlan/SimplePlanRewriter.h>
+
+namespace DB
+{
+
+/// Attaches the estimated number of groups to every AggregatingStep so the executor can
+/// pre-size the aggregation hash tables and start two-level aggregation right away when
+/// the estimate exceeds the conversion threshold, instead of rehashing mid-query. The
+/// estimate only serves as a hint: execution stays correct whatever its quality.
+class SetAggregatingSizeHint : public Rewriter
+{
+public:
+    String name() const override;
+
+private:
+    void rewrite(QueryPlan & plan, ContextMutablePtr context) const override;
+    bool isEnabled(ContextMutablePtr context) const override
+    {
+        return context->getSettingsRef().use_cardinality_estimate_for_aggregation;
+    }
+};
+
+class AggregatingSizeHintVisitor : public PlanNodeVisitor<Void, Void>
+{
+public:
+    AggregatingSizeHintVisitor(ContextMutablePtr context_, CTEInfo & cte_info_) : context(context_), cte_helper(cte_info_)
+    {
+    }
+
+private:
+    Void visitAggregatingNode(AggregatingNode & node, Void &) override;
+    Void visitPlanNode(PlanNodeBase & node, Void &) override;
+    Void visitCTERefNode(CTERefNode & node, Void &) override;
+
+    ContextMutablePtr context;
+    SimpleCTEVisitHelper<void> cte_helper;
+};
+
+}
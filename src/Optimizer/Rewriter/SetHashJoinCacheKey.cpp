@@ -0,0 +1,134 @@
+#include <Optimizer/Rewriter/SetHashJoinCacheKey.h>
+
+#include <Optimizer/ExpressionDeterminism.h>
+#include <Optimizer/RuntimeFilterUtils.h>
+#include <Parsers/ASTSelectQuery.h>
+#include <QueryPlan/FilterStep.h>
+#include <QueryPlan/JoinStep.h>
+#include <QueryPlan/ProjectionStep.h>
+#include <QueryPlan/TableScanStep.h>
+#include <Common/SipHash.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+namespace
+{
+    /// The build side may only read tables through deterministic, runtime-filter-free
+    /// expressions: anything else would make the built hash table query-specific.
+    bool collectBuildSideScans(const PlanNodePtr & node, std::vector<std::shared_ptr<TableScanStep>> & scans, ContextPtr context)
+    {
+        auto step = node->getStep();
+        switch (step->getType())
+        {
+            case IQueryPlanStep::Type::TableScan: {
+                auto scan = std::dynamic_pointer_cast<TableScanStep>(step);
+                if (scan->getPushdownAggregation() || scan->getPushdownProjection() || scan->getPushdownFilter()
+                    || scan->hasInlineExpressions())
+                    return false;
+                const auto * select = scan->getQueryInfo().query->as<ASTSelectQuery>();
+                if (!select)
+                    return false;
+                for (const auto & predicate : {select->getWhere(), select->getPrewhere()})
+                    if (predicate
+                        && (!RuntimeFilterUtils::extractRuntimeFilterId(predicate).empty()
+                            || !ExpressionDeterminism::isDeterministic(predicate, context)))
+                        return false;
+                scans.emplace_back(std::move(scan));
+                break;
+            }
+            case IQueryPlanStep::Type::Filter: {
+                const auto & filter = std::dynamic_pointer_cast<FilterStep>(step)->getFilter();
+                if (!RuntimeFilterUtils::extractRuntimeFilterId(filter).empty()
+                    || !ExpressionDeterminism::isDeterministic(filter, context))
+                    return false;
+                break;
+            }
+            case IQueryPlanStep::Type::Projection: {
+                for (const auto & assignment : std::dynamic_pointer_cast<ProjectionStep>(step)->getAssignments())
+                    if (!ExpressionDeterminism::isDeterministic(assignment.second, context))
+                        return false;
+                break;
+            }
+            case IQueryPlanStep::Type::Exchange:
+                break;
+            default:
+                return false;
+        }
+
+        for (const auto & child : node->getChildren())
+            if (!collectBuildSideScans(child, scans, context))
+                return false;
+        return true;
+    }
+}
+
+void SetHashJoinCacheKey::rewrite(QueryPlan & plan, ContextMutablePtr context) const
+{
+    HashJoinCacheKeyVisitor visitor{context, plan.getCTEInfo(), PlanSignatureProvider(plan, context)};
+    Void v;
+    VisitorUtil::accept(*plan.getPlanNode(), visitor, v);
+}
+
+String SetHashJoinCacheKey::name() const
+{
+    return "SetHashJoinCacheKey";
+}
+
+Void HashJoinCacheKeyVisitor::visitJoinNode(JoinNode & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+
+    auto & step = *node.getStep();
+    if (step.getDistributionType() != DistributionType::BROADCAST || !step.getRuntimeFilterBuilders().empty())
+        return {};
+
+    /// Right and full joins mark matched rows inside the hash table while probing, so a
+    /// shared structure would leak matches between queries.
+    if (step.getKind() != ASTTableJoin::Kind::Inner && step.getKind() != ASTTableJoin::Kind::Left
+        && step.getKind() != ASTTableJoin::Kind::Cross)
+        return {};
+
+    std::vector<std::shared_ptr<TableScanStep>> scans;
+    if (!collectBuildSideScans(node.getChildren()[1], scans, context) || scans.empty())
+        return {};
+
+    SipHash hash;
+    hash.update(provider.computeSignature(node.getChildren()[1]));
+    /// The join configuration (kind, keys, filter, output symbols) decides how the hash
+    /// table is laid out, so joins that only share the build side must not share a key.
+    hash.update(step.hash());
+    for (const auto & scan : scans)
+    {
+        if (!scan->getStorage())
+            return {};
+        hash.update(scan->getStorageID().uuid);
+        hash.update(scan->getStorage()->commit_time.toUInt64());
+    }
+
+    UInt64 key = hash.get64();
+    if (!key)
+        key = 1;
+
+    LOG_DEBUG(&Poco::Logger::get("SetHashJoinCacheKey"), "Join {} is eligible for the hash join cache, key {}", node.getId(), key);
+    step.setHashJoinCacheKey(key);
+    return {};
+}
+
+Void HashJoinCacheKeyVisitor::visitPlanNode(PlanNodeBase & node, Void & v)
+{
+    for (auto & child : node.getChildren())
+        VisitorUtil::accept(*child, *this, v);
+    return {};
+}
+
+Void HashJoinCacheKeyVisitor::visitCTERefNode(CTERefNode & node, Void & v)
+{
+    CTEId cte_id = node.getStep()->getId();
+    cte_helper.accept(cte_id, *this, v);
+    return {};
+}
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <Optimizer/Rewriter/Rewriter.h>
+#include <Optimizer/Signature/PlanSignature.h>
+#include <QueryPlan/PlanNode.h>
+#include <QueryPlan/PlanVisitor.h>
+#include <QueryPlan/SimplePlanRewriter.h>
+
+namespace DB
+{
+
+/// Computes a cache key for broadcast joins whose build side is a deterministic read of
+/// dimension tables, so workers can reuse the built hash table across queries (see
+/// HashJoinCache). The key combines the plan signature of the build side, the join
+/// configuration and the commit time of every scanned table: DDL on a dimension table
+/// changes the key, while data changes are bounded by the cache TTL. Only join kinds
+/// whose probe phase does not mutate the hash table (inner, left, cross) are marked.
+class SetHashJoinCacheKey : public Rewriter
+{
+public:
+    String name() const override;
+
+private:
+    void rewrite(QueryPlan & plan, ContextMutablePtr context) const override;
+    bool isEnabled(ContextMutablePtr context) const override
+    {
+        return context->getSettingsRef().enable_hash_join_cache;
+    }
+};
+
+class HashJoinCacheKeyVisitor : public PlanNodeVisitor<Void, Void>
+{
+public:
+    HashJoinCacheKeyVisitor(ContextMutablePtr context_, CTEInfo & cte_info_, PlanSignatureProvider provider_)
+        : context(context_), cte_helper(cte_info_), provider(std::move(provider_))
+    {
+    }
+
+private:
+    Void visitJoinNode(JoinNode & node, Void &) override;
+    Void visitPlanNode(PlanNodeBase & node, Void &) override;
+    Void visitCTERefNode(CTERefNode & node, Void &) override;
+
+    ContextMutablePtr context;
+    SimpleCTEVisitHelper<void> cte_helper;
+    PlanSignatureProvider provider;
+};
+
+}
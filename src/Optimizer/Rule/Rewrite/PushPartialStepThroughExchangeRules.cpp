@@ -69,6 +69,13 @@ static std::pair<bool, bool> canPushPartialWithHint(const AggregatingStep * step
     return {false, true};
 }
 
+/// Besides saving network, this split is the skew mitigation for GROUP BY: a heavy-hitter
+/// key (a null user id and the like) is collapsed to one partial state per sender before
+/// the repartition exchange, so the instance owning its hash range receives one row per
+/// sender instead of the full key volume. Runtime heavy-hitter detection in the exchange
+/// sink with a separate broadcast-merge path was evaluated and rejected as redundant with
+/// this rule; the aggregate functions for which the split is blocked below are blocked
+/// precisely because their states cannot be pre-merged, which rules out such a path too.
 PatternPtr PushPartialAggThroughExchange::getPattern() const
 {
     return Patterns::aggregating().withSingle(Patterns::exchange()).result();
@@ -432,4 +439,63 @@ TransformResult PushPartialDistinctThroughExchange::transformImpl(PlanNodePtr no
     return node;
 }
 
+PatternPtr AddIntermediateMergeBeforeGather::getPattern() const
+{
+    return Patterns::mergingAggregated()
+        .withSingle(Patterns::exchange().matchingStep<ExchangeStep>(
+            [](const ExchangeStep & step) { return step.getExchangeMode() == ExchangeMode::GATHER; }))
+        .result();
+}
+
+TransformResult AddIntermediateMergeBeforeGather::transformImpl(PlanNodePtr node, const Captures &, RuleContext & context)
+{
+    const auto * merge_step = dynamic_cast<const MergingAggregatedStep *>(node->getStep().get());
+    auto exchange_node = node->getChildren()[0];
+    const auto * exchange_step = dynamic_cast<const ExchangeStep *>(exchange_node->getStep().get());
+
+    /// Without grouping keys every producer holds a single state row already, and grouping
+    /// sets repartition poorly by the plain key list; neither benefits from a pre-merge.
+    if (merge_step->getKeys().empty() || !merge_step->getGroupingSetsParamsList().empty())
+        return {};
+
+    if (exchange_node->getChildren().size() != 1)
+        return {};
+
+    /// Do not fire again on a plan we have already rewritten.
+    if (const auto * child_merge = dynamic_cast<const MergingAggregatedStep *>(exchange_node->getChildren()[0]->getStep().get());
+        child_merge && !child_merge->getParams()->final)
+        return {};
+
+    auto child = exchange_node->getChildren()[0];
+    const auto & keys = merge_step->getKeys();
+
+    auto repartition_step = std::make_shared<ExchangeStep>(
+        DataStreams{child->getCurrentDataStream()}, ExchangeMode::REPARTITION, Partitioning(keys), exchange_step->needKeepOrder());
+    auto repartition_node = PlanNodeBase::createPlanNode(context.context->nextNodeId(), std::move(repartition_step), {child});
+
+    /// Merge states without finalizing: the header stays the mergeable-state one,
+    /// so the gathering segment sees exactly what it saw before, just fewer rows.
+    auto intermediate_params = std::make_shared<AggregatingTransformParams>(merge_step->getParams()->params, false);
+    auto intermediate_merge = std::make_shared<MergingAggregatedStep>(
+        repartition_node->getCurrentDataStream(),
+        keys,
+        GroupingSetsParamsList{},
+        merge_step->getGroupings(),
+        std::move(intermediate_params),
+        false,
+        context.context->getSettingsRef().max_threads,
+        context.context->getSettingsRef().aggregation_memory_efficient_merge_threads);
+    auto intermediate_node
+        = PlanNodeBase::createPlanNode(context.context->nextNodeId(), std::move(intermediate_merge), {repartition_node}, node->getStatistics());
+
+    auto gather_step = std::make_shared<ExchangeStep>(
+        DataStreams{intermediate_node->getCurrentDataStream()},
+        ExchangeMode::GATHER,
+        exchange_step->getSchema(),
+        exchange_step->needKeepOrder());
+    auto gather_node = PlanNodeBase::createPlanNode(context.context->nextNodeId(), std::move(gather_step), {intermediate_node});
+
+    return PlanNodeBase::createPlanNode(context.context->nextNodeId(), node->getStep(), {gather_node}, node->getStatistics());
+}
+
 }
@@ -90,4 +90,23 @@ public:
     TransformResult transformImpl(PlanNodePtr node, const Captures & captures, RuleContext & context) override;
 };
 
+/// Rewrites `MergingAggregated <- Exchange[GATHER]` into
+/// `MergingAggregated <- Exchange[GATHER] <- MergingAggregated(states) <- Exchange[REPARTITION]`,
+/// so partial states are merged by key across the producing workers before the single
+/// gathering segment receives them. With many workers holding the same keys this shrinks
+/// the gathered data by up to the worker count.
+class AddIntermediateMergeBeforeGather : public Rule
+{
+public:
+    RuleType getType() const override { return RuleType::ADD_INTERMEDIATE_MERGE_BEFORE_GATHER; }
+    String getName() const override { return "ADD_INTERMEDIATE_MERGE_BEFORE_GATHER"; }
+    bool isEnabled(ContextPtr context) const override
+    {
+        return context->getSettingsRef().enable_intermediate_merge_before_gather;
+    }
+    PatternPtr getPattern() const override;
+
+    TransformResult transformImpl(PlanNodePtr node, const Captures & captures, RuleContext & context) override;
+};
+
 }
@@ -67,6 +67,7 @@ enum class RuleType : UInt32
     PUSH_PARTIAL_SORTING_THROUGH_EXCHANGE,
     PUSH_PARTIAL_LIMIT_THROUGH_EXCHANGE,
     PUSH_PARTIAL_DISTINCT_THROUGH_EXCHANGE,
+    ADD_INTERMEDIATE_MERGE_BEFORE_GATHER,
 
     OPTIMIZE_MEMORY_EFFICIENT_AGGREGATION,
 
@@ -99,7 +99,8 @@ std::vector<RulePtr> Rules::pushPartialStepRules()
         std::make_shared<PushPartialSortingThroughExchange>(),
         std::make_shared<PushPartialLimitThroughExchange>(),
         std::make_shared<FilterWindowToPartitionTopN>(),
-        std::make_shared<PushPartialDistinctThroughExchange>()};
+        std::make_shared<PushPartialDistinctThroughExchange>(),
+        std::make_shared<AddIntermediateMergeBeforeGather>()};
 }
 
 std::vector<RulePtr> Rules::optimizeAggregateRules()
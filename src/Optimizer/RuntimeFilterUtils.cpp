@@ -3,6 +3,7 @@
 
 #include <Functions/FunctionsRuntimeFilter.h>
 #include <Functions/InternalFunctionRuntimeFilter.h>
+#include <IO/ReadBufferFromMemory.h>
 #include <Interpreters/RuntimeFilter/RuntimeFilterManager.h>
 #include <Optimizer/CardinalityEstimate/FilterEstimator.h>
 #include <Optimizer/CardinalityEstimate/SymbolStatistics.h>
@@ -205,6 +206,33 @@ RuntimeFilterUtils::createRuntimeFilterForFilter(const RuntimeFilterDescription
     return createRuntimeFilterForTableScan(description, query_id, 0, true, true, is_range_or_set, has_bf);
 }
 
+BloomFilterWithRangePtr RuntimeFilterUtils::extractReadyBloomFilter(const RuntimeFilterDescription & description, const String & query_id)
+{
+    auto key = RuntimeFilterManager::makeKey(query_id, description.id);
+    auto dynamic_value = RuntimeFilterManager::getInstance().getDynamicValue(key);
+    if (!dynamic_value->isReady())
+        return nullptr;
+
+    const auto & value = dynamic_value->get(0);
+    if (value.bypass != BypassType::NO_BYPASS)
+        return nullptr;
+
+    if (value.is_local)
+    {
+        auto const & d = std::get<RuntimeFilterVal>(value.data);
+        return d.is_bf ? d.bloom_filter : nullptr;
+    }
+
+    auto const & d = std::get<InternalDynamicData>(value.data);
+    if (d.bf.isNull())
+        return nullptr;
+    const auto & data = d.bf.get<String>();
+    ReadBufferFromMemory read_buffer(data.data(), data.size());
+    auto bloom_filter = std::make_shared<BloomFilterWithRange>();
+    bloom_filter->deserialize(read_buffer);
+    return bloom_filter;
+}
+
 std::vector<ASTPtr> RuntimeFilterUtils::generateFunctionArgs(const DB::RuntimeFilterDescription & description, const DB::String & query_id)
 {
     std::vector<ASTPtr> args;
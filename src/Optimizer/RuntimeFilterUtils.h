@@ -61,6 +61,10 @@ public:
         const RuntimeFilterDescription & description, const String & query_id, size_t wait_ms, bool need_bf, bool range_cover, bool & is_range_or_set, bool & has_bf);
 
     static std::vector<ASTPtr> generateFunctionArgs(const RuntimeFilterDescription & description, const String & query_id);
+
+    /// Returns the ready build-side bloom filter for the description, without waiting.
+    /// nullptr when the filter is not ready yet, bypassed, or is not a bloom filter.
+    static BloomFilterWithRangePtr extractReadyBloomFilter(const RuntimeFilterDescription & description, const String & query_id);
     static bool containsRuntimeFilters(const ConstASTPtr & filter);
     static std::vector<RuntimeFilterId> extractRuntimeFilterId(const ConstASTPtr & conjuncts);
 };
@@ -0,0 +1,44 @@
+#include <Optimizer/CardinalityEstimate/CardinalityFeedback.h>
+
+#include <gtest/gtest.h>
+
+using namespace DB;
+
+TEST(CardinalityFeedback, RecordAndLookup)
+{
+    auto & feedback = CardinalityFeedback::instance();
+
+    EXPECT_FALSE(feedback.lookup(0xfeed0001).has_value());
+
+    feedback.record(0xfeed0001, 1000);
+    ASSERT_TRUE(feedback.lookup(0xfeed0001).has_value());
+    EXPECT_EQ(*feedback.lookup(0xfeed0001), 1000);
+
+    /// repeated observations are blended, not replaced
+    feedback.record(0xfeed0001, 2000);
+    EXPECT_EQ(*feedback.lookup(0xfeed0001), 1250);
+}
+
+TEST(CardinalityFeedback, AttributeOnSuccess)
+{
+    auto & feedback = CardinalityFeedback::instance();
+
+    feedback.registerQuery("query_success", 0xfeed0002);
+    feedback.onQuerySucceed("query_success", 42);
+    ASSERT_TRUE(feedback.lookup(0xfeed0002).has_value());
+    EXPECT_EQ(*feedback.lookup(0xfeed0002), 42);
+
+    /// the pending registration is consumed, a second report is ignored
+    feedback.onQuerySucceed("query_success", 100000);
+    EXPECT_EQ(*feedback.lookup(0xfeed0002), 42);
+}
+
+TEST(CardinalityFeedback, DropOnFailure)
+{
+    auto & feedback = CardinalityFeedback::instance();
+
+    feedback.registerQuery("query_failed", 0xfeed0003);
+    feedback.onQueryFinish("query_failed");
+    feedback.onQuerySucceed("query_failed", 42);
+    EXPECT_FALSE(feedback.lookup(0xfeed0003).has_value());
+}
@@ -228,6 +228,8 @@ const char * ASTSystemQuery::typeToString(Type type)
             return "RESYNC MATERIALIZEDMYSQL TABLE";
         case Type::RECALCULATE_METRICS:
             return "RECALCULATE METRICS FOR";
+        case Type::BENCHMARK_CODECS:
+            return "BENCHMARK CODECS FOR";
         case Type::START_VIEW:
             return "START VIEW";
         case Type::STOP_VIEW:
@@ -346,7 +348,8 @@ void ASTSystemQuery::formatImpl(const FormatSettings & settings, FormatState & s
             || type == Type::DROP_CNCH_PART_CACHE
             || type == Type::DROP_CNCH_DELETE_BITMAP_CACHE
             || type == Type::START_CLUSTER
-            || type == Type::STOP_CLUSTER)
+            || type == Type::STOP_CLUSTER
+            || type == Type::BENCHMARK_CODECS)
     {
         print_database_table();
     }
@@ -142,6 +142,7 @@ public:
         STOP_MATERIALIZEDMYSQL,
         RESYNC_MATERIALIZEDMYSQL_TABLE,
         RECALCULATE_METRICS,
+        BENCHMARK_CODECS,
         START_VIEW,
         STOP_VIEW,
         DROP_VIEW_META,
@@ -195,6 +195,7 @@ bool ParserSystemQuery::parseImpl(IParser::Pos & pos, ASTPtr & node, Expected &
         }
 
         case Type::RECALCULATE_METRICS:
+        case Type::BENCHMARK_CODECS:
         case Type::RESTART_REPLICA:
         case Type::SYNC_REPLICA:
             if (!parseDatabaseAndTableName(pos, expected, res->database, res->table))
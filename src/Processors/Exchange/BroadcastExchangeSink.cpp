@@ -36,21 +36,45 @@ BroadcastExchangeSink::BroadcastExchangeSink(Block header_, BroadcastSenderPtrs
 {
     if (options.force_use_buffer)
         buffer_chunk.resetBuffer();
+
+    for (const auto & sender : senders)
+    {
+        if (sender->getType() == BroadcastSenderType::Local)
+            local_senders.emplace_back(sender);
+        else
+            remote_senders.emplace_back(sender);
+    }
 }
 
 BroadcastExchangeSink::~BroadcastExchangeSink() = default;
 
 
+bool BroadcastExchangeSink::sendToLocalSenders(Chunk & chunk)
+{
+    /// Chunks cross a local channel by shared column ownership: clone() only bumps
+    /// the COW reference counters, so the handoff itself copies nothing.
+    bool has_active_sender = false;
+    for (auto & sender : local_senders)
+    {
+        auto status = ExchangeUtils::sendAndCheckReturnStatus(*sender, chunk.clone());
+        if (status.code == BroadcastStatusCode::RUNNING)
+            has_active_sender = true;
+    }
+    return has_active_sender;
+}
+
 void BroadcastExchangeSink::consume(Chunk chunk)
 {
     if (!has_input)
     {
         if (options.force_use_buffer)
         {
+            /// Local senders never go through the buffer, so the tail flush
+            /// only concerns remote ones.
             auto chunk_to_send = buffer_chunk.flush(true);
             if (chunk_to_send)
             {
-                for (auto & sender : senders)
+                for (auto & sender : remote_senders)
                 {
                     ExchangeUtils::sendAndCheckReturnStatus(*sender, chunk_to_send.clone());
                 }
@@ -60,6 +84,41 @@ void BroadcastExchangeSink::consume(Chunk chunk)
         return;
     }
 
+    /// Buffering exists to amortize per-message costs of remote transport. For local
+    /// senders it only adds a row-by-row copy into the buffer, so hand the chunk over
+    /// directly and keep the buffer for remote senders.
+    if (options.force_use_buffer && !local_senders.empty())
+    {
+        bool local_active = sendToLocalSenders(chunk);
+
+        if (remote_senders.empty())
+        {
+            if (!local_active)
+                finish();
+            return;
+        }
+
+        auto buffered_chunk = buffer_chunk.add(std::move(chunk));
+        if (!buffered_chunk)
+            return;
+
+        bool remote_active = false;
+        for (size_t i = 0; i < remote_senders.size() - 1; ++i)
+        {
+            auto status = ExchangeUtils::sendAndCheckReturnStatus(*remote_senders[i], buffered_chunk.clone());
+            if (status.code == BroadcastStatusCode::RUNNING)
+                remote_active = true;
+        }
+
+        auto status = ExchangeUtils::sendAndCheckReturnStatus(*remote_senders.back(), std::move(buffered_chunk));
+        if (status.code == BroadcastStatusCode::RUNNING)
+            remote_active = true;
+
+        if (!local_active && !remote_active)
+            finish();
+        return;
+    }
+
     Chunk chunk_to_send;
     if (options.force_use_buffer)
     {
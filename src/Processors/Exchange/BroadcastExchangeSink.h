@@ -56,9 +56,15 @@ protected:
 private:
     String name;
     BroadcastSenderPtrs senders;
+    /// Local senders pass chunks through the in-process queue by shared ownership,
+    /// so buffering them only adds row copies; buffer is kept for remote senders only.
+    BroadcastSenderPtrs local_senders;
+    BroadcastSenderPtrs remote_senders;
     ExchangeOptions options;
     BufferChunk buffer_chunk;
     Poco::Logger * logger;
+
+    bool sendToLocalSenders(Chunk & chunk);
 };
 
 }
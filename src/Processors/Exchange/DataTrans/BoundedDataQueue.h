@@ -17,6 +17,9 @@
 
 #include <queue>
 #include <type_traits>
+#include <vector>
+#include <sys/eventfd.h>
+#include <unistd.h>
 #include <bthread/condition_variable.h>
 #include <bthread/mutex.h>
 #include <fmt/core.h>
@@ -51,6 +54,12 @@ public:
         static_assert(use_controller);
     }
 
+    ~BoundedDataQueue()
+    {
+        if (recv_event_fd >= 0)
+            ::close(recv_event_fd);
+    }
+
     inline void push(const T & x)
     {
         pushImpl(x);
@@ -145,8 +154,68 @@ public:
                 (memory_controller->increase(std::forward<Args>(args)), ...);
         }
         queue.emplace(std::forward<Args>(args)...);
+        int event_fd = recv_event_fd;
         lock.unlock();
         empty_cv.notify_one();
+        signalRecvEvent(event_fd);
+        return true;
+    }
+
+    /// Push a whole batch with one lock acquisition and one wakeup instead of one per
+    /// element. Returns false on timeout or close; elements already moved into the queue
+    /// stay there and the rest are left in `batch`, callers treat either case as failure
+    /// of the whole transfer.
+    bool tryPushBatchUntil(timespec timestamp, std::vector<T> & batch)
+    {
+        std::unique_lock<bthread::Mutex> lock(mutex);
+        for (auto & x : batch)
+        {
+            while (exceedLimit() && !is_closed)
+            {
+                /// Wake consumers for what is queued so far before parking on full_cv,
+                /// otherwise the producer and the consumers could wait for each other.
+                empty_cv.notify_all();
+                signalRecvEvent(recv_event_fd);
+                if (ETIMEDOUT == full_cv.wait_until(lock, timestamp))
+                    return false;
+            }
+            if (is_closed)
+                return false;
+            increase(x);
+            queue.push(std::move(x));
+        }
+        int event_fd = recv_event_fd;
+        lock.unlock();
+        empty_cv.notify_all();
+        signalRecvEvent(event_fd);
+        return true;
+    }
+
+    /// Drain up to max_batch_size elements under one lock. Waits until at least one
+    /// element is available or the timeout expires, never blocks for a full batch.
+    bool tryPopBatch(std::vector<T> & out, size_t max_batch_size, UInt64 milliseconds = 0)
+    {
+        UInt64 timeout_ms_ts = time_in_milliseconds(std::chrono::system_clock::now()) + milliseconds;
+        timespec timestamp{.tv_sec = time_t(timeout_ms_ts / 1000), .tv_nsec = long(timeout_ms_ts % 1000) * 1000000};
+
+        std::unique_lock<bthread::Mutex> lock(mutex);
+        while (queue.empty() && !is_closed)
+        {
+            if (ETIMEDOUT == empty_cv.wait_until(lock, timestamp))
+                return false;
+        }
+        if (is_closed)
+            return false;
+        while (!queue.empty() && out.size() < max_batch_size)
+        {
+            T x;
+            ::detail::moveOrCopyIfThrow(std::move(queue.front()), x);
+            queue.pop();
+            decrease(x);
+            out.emplace_back(std::move(x));
+        }
+        lock.unlock();
+        full_cv.notify_all();
         return true;
     }
 
@@ -192,9 +261,11 @@ public:
         if (is_closed)
             return false;
         is_closed = true;
+        int event_fd = recv_event_fd;
         lock.unlock();
         empty_cv.notify_all();
         full_cv.notify_all();
+        signalRecvEvent(event_fd);
         return true;
     }
 
@@ -215,6 +286,17 @@ public:
         return is_closed;
     }
 
+    /// Lazily create an eventfd which is signalled on every push and on close, so that a consumer
+    /// can wait for data with epoll instead of parking a thread on the condition variable.
+    /// The queue owns the descriptor; repeated calls return the same one.
+    int getRecvEventFd()
+    {
+        std::unique_lock<bthread::Mutex> lock(mutex);
+        if (recv_event_fd < 0)
+            recv_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        return recv_event_fd;
+    }
+
 private:
     template <typename E>
     inline void pushImpl(E && x)
@@ -233,8 +315,10 @@ private:
                 memory_controller->increase(x);
         }
         queue.push(std::forward<E>(x));
+        int event_fd = recv_event_fd;
         lock.unlock();
         empty_cv.notify_one();
+        signalRecvEvent(event_fd);
     }
 
     template <typename E>
@@ -254,11 +338,22 @@ private:
                 memory_controller->increase(x);
         }
         queue.push(std::forward<E>(x));
+        int event_fd = recv_event_fd;
         lock.unlock();
         empty_cv.notify_one();
+        signalRecvEvent(event_fd);
         return true;
     }
 
+    ALWAYS_INLINE static void signalRecvEvent(int event_fd)
+    {
+        if (event_fd >= 0)
+        {
+            UInt64 buf = 1;
+            [[maybe_unused]] ssize_t res = ::write(event_fd, &buf, sizeof(buf));
+        }
+    }
+
     ALWAYS_INLINE bool exceedLimit() const
     {
         if constexpr (use_controller)
@@ -292,6 +387,7 @@ private:
     size_t capacity;
     Controller memory_controller = nullptr;
     bool is_closed = false;
+    int recv_event_fd = -1;
 };
 
 }
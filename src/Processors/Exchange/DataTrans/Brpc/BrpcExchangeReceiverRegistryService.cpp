@@ -57,12 +57,14 @@ void BrpcExchangeReceiverRegistryService::registry(
     BroadcastSenderProxyPtr sender_proxy = BroadcastSenderProxyRegistry::instance().getOrCreate(key);
     auto query_id = request->query_id();
     auto coordinator_addr = request->coordinator_address();
+    /// Receiver connecting from another host: such hops may negotiate a stronger exchange codec
+    bool peer_is_remote_host = cntl->remote_side().ip != cntl->local_side().ip;
     /// SCOPE_EXIT wrap logic which run after done->Run(),
     /// since host socket of the accpeted stream is set in done->Run()
     SCOPE_EXIT({
         /// request is already released in done_guard, so all parameters have to be copied.
         if (sender_proxy && sender_stream_id != brpc::INVALID_STREAM_ID)
-            registerSenderToProxy(nullptr, sender_proxy, query_id, sender_stream_id, {}, key, coordinator_addr, false);
+            registerSenderToProxy(nullptr, sender_proxy, query_id, sender_stream_id, {}, key, coordinator_addr, false, peer_is_remote_host);
     });
 
     /// this done_guard guarantee to call done->Run() in any situation
@@ -108,6 +110,7 @@ void BrpcExchangeReceiverRegistryService::registerBRPCSenderFromDisk(
         query_context->setQueryExpirationTimeStamp();
         auto query_id = request->registry().query_id();
         auto coordinator_addr = request->registry().coordinator_address();
+        bool peer_is_remote_host = cntl->remote_side().ip != cntl->local_side().ip;
         /// we need to do this as to avoid previous sender waitBecomeRealSender in finish
         auto previous_sender = BroadcastSenderProxyRegistry::instance().get(key);
         if (previous_sender)
@@ -123,7 +126,7 @@ void BrpcExchangeReceiverRegistryService::registerBRPCSenderFromDisk(
         auto processors = mgr->createProcessors(sender_proxy, std::move(header), std::move(query_context));
         SCOPE_EXIT({
             if (sender_proxy && sender_stream_id != brpc::INVALID_STREAM_ID)
-                registerSenderToProxy(mgr, sender_proxy, query_id, sender_stream_id, processors, key, coordinator_addr, true);
+                registerSenderToProxy(mgr, sender_proxy, query_id, sender_stream_id, processors, key, coordinator_addr, true, peer_is_remote_host);
         });
 
         /// this done_guard guarantee to call done->Run() in any situation
@@ -147,14 +150,15 @@ void BrpcExchangeReceiverRegistryService::registerSenderToProxy(
     Processors processors,
     const ExchangeDataKeyPtr & key,
     const String & coordinator_addr,
-    bool read_from_disk)
+    bool read_from_disk,
+    bool peer_is_remote_host)
 {
     try
     {
         if (read_from_disk)
             mgr->cancelReadTask(sender_proxy->getDataKey());
         auto real_sender = std::dynamic_pointer_cast<IBroadcastSender>(std::make_shared<BrpcRemoteBroadcastSender>(
-            sender_proxy->getDataKey(), sender_stream_id, sender_proxy->getContext(), sender_proxy->getHeader()));
+            sender_proxy->getDataKey(), sender_stream_id, sender_proxy->getContext(), sender_proxy->getHeader(), peer_is_remote_host));
         sender_proxy->becomeRealSender(std::move(real_sender));
         /// submit executor task
         if (read_from_disk)
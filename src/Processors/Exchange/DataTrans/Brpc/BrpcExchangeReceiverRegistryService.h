@@ -106,7 +106,8 @@ private:
         Processors processors,
         const ExchangeDataKeyPtr & key,
         const String & coordinator_addr,
-        bool read_from_disk);
+        bool read_from_disk,
+        bool peer_is_remote_host);
 };
 
 REGISTER_SERVICE_IMPL(BrpcExchangeReceiverRegistryService);
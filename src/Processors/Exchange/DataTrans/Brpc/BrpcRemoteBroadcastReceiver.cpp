@@ -190,6 +190,23 @@ void BrpcRemoteBroadcastReceiver::pushReceiveQueue(MultiPathDataPacket packet)
     }
 }
 
+void BrpcRemoteBroadcastReceiver::pushReceiveQueue(std::vector<MultiPathDataPacket> && packets)
+{
+    if (packets.empty() || queue->closed())
+        return;
+    if (!queue->tryPushBatchUntil(context->getQueryExpirationTimeStamp(), packets))
+    {
+        if (queue->closed())
+        {
+            return;
+        }
+        throw Exception(
+            "Push exchange data to receiver for " + getName() + " timeout from " + DateLUT::instance().timeToString(context->getClientInfo().initial_query_start_time) +
+            " to " + DateLUT::instance().timeToString(context->getQueryExpirationTimeStamp().tv_sec),
+            ErrorCodes::DISTRIBUTE_STAGE_QUERY_EXCEPTION);
+    }
+}
+
 RecvDataPacket BrpcRemoteBroadcastReceiver::recv(timespec timeout_ts) noexcept
 {
     Stopwatch s;
@@ -202,6 +219,25 @@ RecvDataPacket BrpcRemoteBroadcastReceiver::recv(timespec timeout_ts) noexcept
         return std::move(current_status);
     }
 
+    return handleReceiveQueuePacket(std::move(data_packet), s);
+}
+
+std::optional<RecvDataPacket> BrpcRemoteBroadcastReceiver::tryRecv()
+{
+    Stopwatch s;
+    MultiPathDataPacket data_packet;
+    if (!queue->tryPop(data_packet))
+    {
+        if (queue->closed())
+            return RecvDataPacket(finish(BroadcastStatusCode::RECV_UNKNOWN_ERROR, "Receive queue for " + getName() + " interrupted"));
+        return std::nullopt;
+    }
+
+    return handleReceiveQueuePacket(std::move(data_packet), s);
+}
+
+RecvDataPacket BrpcRemoteBroadcastReceiver::handleReceiveQueuePacket(MultiPathDataPacket && data_packet, const Stopwatch & s)
+{
     if (std::holds_alternative<DataPacket>(data_packet))
     {
         auto & received_chunk = std::get<DataPacket>(data_packet).chunk;
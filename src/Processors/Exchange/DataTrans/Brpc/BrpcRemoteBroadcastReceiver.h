@@ -28,6 +28,7 @@
 #include <Processors/Exchange/ExchangeDataKey.h>
 #include <brpc/stream.h>
 #include <Poco/Logger.h>
+#include <Common/Stopwatch.h>
 
 #include <atomic>
 #include <optional>
@@ -63,9 +64,13 @@ public:
 
     void registerToSenders(UInt32 timeout_ms) override;
     RecvDataPacket recv(timespec timeout_ms) noexcept override;
+    int getRecvFd() override { return queue->getRecvEventFd(); }
+    std::optional<RecvDataPacket> tryRecv() override;
     BroadcastStatus finish(BroadcastStatusCode status_code, String message) override;
     String getName() const override;
     void pushReceiveQueue(MultiPathDataPacket packet);
+    /// Push all packets of one stream callback with a single lock round-trip.
+    void pushReceiveQueue(std::vector<MultiPathDataPacket> && packets);
     void setSendDoneFlag() { send_done_flag.test_and_set(std::memory_order_release); }
 
     static String
@@ -107,6 +112,8 @@ private:
     std::shared_ptr<QueryExchangeLog> query_exchange_log;
     String coordinator_address;
 
+    RecvDataPacket handleReceiveQueuePacket(MultiPathDataPacket && data_packet, const Stopwatch & s);
+
     void sendRegisterRPC(
         Protos::RegistryService_Stub & stub,
         brpc::Controller & cntl,
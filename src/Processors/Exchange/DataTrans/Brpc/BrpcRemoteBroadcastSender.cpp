@@ -23,9 +23,12 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <Columns/IColumn.h>
 #include <Compression/CompressedWriteBuffer.h>
 #include <Compression/CompressionFactory.h>
 #include <DataTypes/DataTypeFactory.h>
+#include <DataTypes/IDataType.h>
+#include <IO/VarInt.h>
 #include <Interpreters/QueryExchangeLog.h>
 #include <Processors/Exchange/DataTrans/Brpc/BrpcRemoteBroadcastSender.h>
 #include <Processors/Exchange/DataTrans/Brpc/WriteBufferFromBrpcBuf.h>
@@ -46,6 +49,18 @@ namespace DB
 namespace
 {
     const auto STREAM_WAIT_TIMEOUT_MS = 1000;
+    /// Referencing tiny regions fragments the IOBuf and costs more than one memcpy.
+    const size_t MIN_ZERO_COPY_COLUMN_BYTES = 4096;
+
+    /// Native bulk serialization of fixed-width value columns (numbers, dates, decimals,
+    /// UUIDs) is exactly their contiguous memory with no prefix or suffix, so such
+    /// columns can be attached to the send buffer by reference without changing the
+    /// bytes on the wire.
+    bool canAppendColumnZeroCopy(const DB::IDataType & type, const DB::IColumn & column)
+    {
+        return type.isValueRepresentedByNumber() && column.isFixedAndContiguous()
+            && column.getRawData().size >= MIN_ZERO_COPY_COLUMN_BYTES;
+    }
 }
 
 namespace ErrorCodes
@@ -58,8 +73,11 @@ namespace ErrorCodes
  * 1-1 sender, to make 1-n sener, merge n 1-1 sender
  */
 BrpcRemoteBroadcastSender::BrpcRemoteBroadcastSender(
-    ExchangeDataKeyPtr trans_key_, brpc::StreamId stream_id, ContextPtr context_, Block header_)
-    : IBroadcastSender(context_->getSettingsRef().log_query_exchange), context(std::move(context_)), header(std::move(header_))
+    ExchangeDataKeyPtr trans_key_, brpc::StreamId stream_id, ContextPtr context_, Block header_, bool peer_is_remote_host_)
+    : IBroadcastSender(context_->getSettingsRef().log_query_exchange)
+    , context(std::move(context_))
+    , header(std::move(header_))
+    , peer_is_remote_host(peer_is_remote_host_)
 {
     trans_keys.emplace_back(std::move(trans_key_));
     sender_stream_ids.push_back(stream_id);
@@ -112,9 +130,17 @@ BrpcRemoteBroadcastSender::~BrpcRemoteBroadcastSender()
 BroadcastStatus BrpcRemoteBroadcastSender::sendImpl(Chunk chunk)
 {
     Stopwatch s;
-    WriteBufferFromBrpcBuf out;
-    serializeChunkToIoBuffer(std::move(chunk), out);
-    const auto & buf = out.getFinishedBuf();
+    butil::IOBuf buf;
+    if (context->getSettingsRef().exchange_parallel_deserialize_threads > 0)
+    {
+        buf = serializeChunkColumnwise(std::move(chunk));
+    }
+    else
+    {
+        WriteBufferFromBrpcBuf out;
+        serializeChunkToIoBuffer(std::move(chunk), out);
+        buf = out.getFinishedBuf();
+    }
     if (enable_sender_metrics)
     {
         sender_metrics.send_bytes << buf.length();
@@ -138,28 +164,107 @@ BroadcastStatus BrpcRemoteBroadcastSender::sendImpl(Chunk chunk)
     return res;
 }
 
+CompressionCodecPtr BrpcRemoteBroadcastSender::getCompressionCodec() const
+{
+    if (compression_codec)
+        return compression_codec;
+
+    const auto & settings = context->getSettingsRef();
+    std::string method = Poco::toUpper(settings.network_compression_method.toString());
+    /// Receivers on another host may use a stronger codec: compressed frames record their
+    /// codec, so the receiving side decompresses either choice without any handshake.
+    if (peer_is_remote_host && !settings.exchange_cross_host_compression_method.value.empty())
+        method = Poco::toUpper(settings.exchange_cross_host_compression_method.toString());
+    /// Pods co-located on one host exchange over loopback: the bytes never reach the NIC,
+    /// so compressing them only spends CPU. NONE keeps the compressed-frame framing (and
+    /// its checksum), which the receiver decodes without any changes.
+    else if (!peer_is_remote_host && settings.exchange_skip_compress_for_same_host)
+        method = "NONE";
+    std::optional<int> level;
+    if (method == "ZSTD")
+        level = settings.network_zstd_compression_level;
+    compression_codec = CompressionCodecFactory::instance().get(method, level);
+    return compression_codec;
+}
+
 void BrpcRemoteBroadcastSender::serializeChunkToIoBuffer(Chunk chunk, WriteBufferFromBrpcBuf & out) const
 {
     const auto & settings = context->getSettingsRef();
+    bool dictionary_encode_strings = settings.exchange_enable_string_dictionary_encoding;
     if (settings.exchange_enable_block_compress)
     {
-        std::string method = Poco::toUpper(settings.network_compression_method.toString());
-        std::optional<int> level;
-        if (method == "ZSTD")
-            level = settings.network_zstd_compression_level;
-        const CompressionCodecPtr & codec = CompressionCodecFactory::instance().get(method, level);
-        CompressedWriteBuffer compressed_out(out, codec, DBMS_DEFAULT_BUFFER_SIZE * 2);
-        NativeChunkOutputStream chunk_out(compressed_out, header);
+        CompressedWriteBuffer compressed_out(out, getCompressionCodec(), DBMS_DEFAULT_BUFFER_SIZE * 2);
+        NativeChunkOutputStream chunk_out(compressed_out, header, dictionary_encode_strings);
         chunk_out.write(chunk);
         compressed_out.next();
     }
     else
     {
-        NativeChunkOutputStream chunk_out(out, header);
+        NativeChunkOutputStream chunk_out(out, header, dictionary_encode_strings);
         chunk_out.write(chunk);
     }
 }
 
+butil::IOBuf BrpcRemoteBroadcastSender::serializeChunkColumnwise(Chunk chunk) const
+{
+    const auto & settings = context->getSettingsRef();
+    CompressionCodecPtr codec;
+    if (settings.exchange_enable_block_compress)
+        codec = getCompressionCodec();
+
+    size_t num_columns = chunk.getNumColumns();
+    size_t rows = chunk.getNumRows();
+    bool zero_copy_send = settings.exchange_enable_zero_copy_send;
+
+    /// Serialize every column into its own region, with compression enabled every region
+    /// is a self contained compressed stream, so the receiver can slice the buffer by the
+    /// recorded sizes and decode the columns independently.
+    std::vector<butil::IOBuf> column_bufs(num_columns);
+    for (size_t i = 0; i < num_columns; ++i)
+    {
+        WriteBufferFromBrpcBuf column_out;
+        if (rows)
+        {
+            const DataTypePtr & data_type = header.getDataTypes().at(i);
+            if (codec)
+            {
+                CompressedWriteBuffer compressed_out(column_out, codec, DBMS_DEFAULT_BUFFER_SIZE * 2);
+                NativeChunkOutputStream::writeColumnData(*data_type, chunk.getColumns()[i], compressed_out);
+                compressed_out.next();
+            }
+            else
+            {
+                const ColumnPtr & column = chunk.getColumns()[i];
+                if (zero_copy_send && canAppendColumnZeroCopy(*data_type, *column))
+                {
+                    /// The holder pins the column until brpc has flushed the referenced
+                    /// memory to every stream, which outlives both chunk and buffer.
+                    StringRef raw = column->getRawData();
+                    column_out.appendExternalData(raw.data, raw.size, [holder = column] {});
+                }
+                else
+                {
+                    NativeChunkOutputStream::writeColumnData(*data_type, column, column_out);
+                }
+            }
+        }
+        column_bufs[i] = column_out.getFinishedBuf();
+    }
+
+    /// The header section is tiny and stays uncompressed, the receiver parses it in place
+    WriteBufferFromBrpcBuf header_out;
+    NativeChunkOutputStream::writeChunkInfo(chunk, header_out);
+    writeVarUInt(num_columns, header_out);
+    writeVarUInt(rows, header_out);
+    for (const auto & column_buf : column_bufs)
+        writeVarUInt(column_buf.length(), header_out);
+
+    butil::IOBuf res = header_out.getFinishedBuf();
+    for (auto & column_buf : column_bufs)
+        res.append(column_buf);
+    return res;
+}
+
 BroadcastStatus BrpcRemoteBroadcastSender::sendIOBuffer(const butil::IOBuf & io_buffer, brpc::StreamId stream_id, const ExchangeDataKey & data_key)
 {
     if (io_buffer.size() > brpc::FLAGS_max_body_size)
@@ -317,6 +422,13 @@ void BrpcRemoteBroadcastSender::merge(IBroadcastSender && sender)
     other->trans_keys.clear();
     sender_stream_ids.insert(sender_stream_ids.end(), other->sender_stream_ids.begin(), other->sender_stream_ids.end());
     other->sender_stream_ids.clear();
+    /// Merged senders ship one serialized buffer to every stream, so a single remote
+    /// receiver makes the whole group use the cross-host codec.
+    if (other->peer_is_remote_host && !peer_is_remote_host)
+    {
+        peer_is_remote_host = true;
+        compression_codec.reset();
+    }
 }
 
 
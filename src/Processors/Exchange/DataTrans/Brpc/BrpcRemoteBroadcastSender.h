@@ -18,6 +18,7 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
+#include <Compression/ICompressionCodec.h>
 #include <Interpreters/Context.h>
 #include <Processors/Chunk.h>
 #include <Processors/Exchange/DataTrans/IBroadcastSender.h>
@@ -32,7 +33,8 @@ namespace DB
 class BrpcRemoteBroadcastSender : public IBroadcastSender
 {
 public:
-    BrpcRemoteBroadcastSender(ExchangeDataKeyPtr trans_key_, brpc::StreamId stream_id, ContextPtr context_, Block header_);
+    BrpcRemoteBroadcastSender(
+        ExchangeDataKeyPtr trans_key_, brpc::StreamId stream_id, ContextPtr context_, Block header_, bool peer_is_remote_host_ = false);
     ~BrpcRemoteBroadcastSender() override;
 
     BroadcastStatus sendImpl(Chunk chunk) override;
@@ -49,8 +51,16 @@ private:
     ContextPtr context;
     Block header;
     std::vector<brpc::StreamId> sender_stream_ids;
+    /// True when at least one receiver runs on another host, such hops may use a stronger codec
+    bool peer_is_remote_host = false;
+    /// Chosen once at first send, merge() resets it as merging can widen the hop to another host
+    mutable CompressionCodecPtr compression_codec;
 
+    CompressionCodecPtr getCompressionCodec() const;
     BroadcastStatus sendIOBuffer(const butil::IOBuf & io_buffer, brpc::StreamId stream_id, const ExchangeDataKey & data_key);
     void serializeChunkToIoBuffer(Chunk chunk, WriteBufferFromBrpcBuf & out) const;
+    /// Column-sliced format for exchange_parallel_deserialize_threads: an uncompressed
+    /// header records per column region sizes, so the receiver can decode columns in parallel
+    butil::IOBuf serializeChunkColumnwise(Chunk chunk) const;
 };
 }
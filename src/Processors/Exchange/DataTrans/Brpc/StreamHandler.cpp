@@ -44,6 +44,10 @@ int StreamHandler::on_received_messages([[maybe_unused]] brpc::StreamId stream_i
     }
     try
     {
+        /// Hand all messages of this callback to the receive queue at once: with wide
+        /// fan-in, a lock and a wakeup per message is what shows up as futex churn.
+        std::vector<MultiPathDataPacket> packets;
+        packets.reserve(size);
         if (!keep_order)
         {
             for (size_t index = 0; index < size; index++)
@@ -70,22 +74,34 @@ int StreamHandler::on_received_messages([[maybe_unused]] brpc::StreamId stream_i
                     chunk_info->io_buf.append(msg->movable());
                     chunk.setChunkInfo(std::move(chunk_info));
                 }
-                receiver_ptr->pushReceiveQueue(DataPacket{std::move(chunk)});
+                packets.emplace_back(DataPacket{std::move(chunk)});
             }
+            receiver_ptr->pushReceiveQueue(std::move(packets));
             return 0;
         }
         for (size_t index = 0; index < size; index++)
         {
             Stopwatch s;
             butil::IOBuf & msg = *messages[index];
-            auto read_buffer = std::make_unique<ReadBufferFromBrpcBuf>(msg);
-            std::unique_ptr<ReadBuffer> buf;
-            if (context->getSettingsRef().exchange_enable_block_compress)
-                buf = std::make_unique<CompressedReadBuffer>(*read_buffer);
+            Chunk chunk;
+            /// With parallel deserialization the sender writes the column-sliced format for
+            /// all its outputs, ordered exchanges included; decode accordingly.
+            if (auto parallel_threads = context->getSettingsRef().exchange_parallel_deserialize_threads)
+            {
+                chunk = DeserializeBufTransform::deserializeColumnwise(
+                    msg, header, context->getSettingsRef().exchange_enable_block_compress, parallel_threads);
+            }
             else
-                buf = std::move(read_buffer);
-            NativeChunkInputStream chunk_in(*buf, header);
-            Chunk chunk = chunk_in.readImpl();
+            {
+                auto read_buffer = std::make_unique<ReadBufferFromBrpcBuf>(msg);
+                std::unique_ptr<ReadBuffer> buf;
+                if (context->getSettingsRef().exchange_enable_block_compress)
+                    buf = std::make_unique<CompressedReadBuffer>(*read_buffer);
+                else
+                    buf = std::move(read_buffer);
+                NativeChunkInputStream chunk_in(*buf, header, context->getSettingsRef().exchange_enable_string_dictionary_encoding);
+                chunk = chunk_in.readImpl();
+            }
             if (context->getSettingsRef().log_query_exchange)
             {
                 auto chunk_info = std::make_shared<DeserializeBufTransform::IOBufChunkInfoWithReceiver>();
@@ -100,8 +116,9 @@ int StreamHandler::on_received_messages([[maybe_unused]] brpc::StreamId stream_i
                 msg.size(),
                 chunk.getNumRows());
 #endif
-            receiver_ptr->pushReceiveQueue(MultiPathDataPacket(DataPacket{std::move(chunk)}));
+            packets.emplace_back(DataPacket{std::move(chunk)});
         }
+        receiver_ptr->pushReceiveQueue(std::move(packets));
     }
     catch (...)
     {
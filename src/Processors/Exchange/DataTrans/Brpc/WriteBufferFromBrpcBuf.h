@@ -15,6 +15,9 @@
 
 #pragma once
 
+#include <functional>
+#include <mutex>
+#include <unordered_map>
 #include <IO/WriteBuffer.h>
 #include <butil/iobuf.h>
 
@@ -51,6 +54,38 @@ public:
         set(const_cast<Position>(block_view.data()), block_view.size());
     }
 
+    /// Appends `size` bytes starting at `data` to the stream without copying them: the
+    /// IOBuf references the memory directly and brpc writes it to the socket in place.
+    /// `holder` must own the memory, it is destroyed only after brpc has released the
+    /// last reference to the appended block, which may happen on a bthread long after
+    /// this buffer is gone.
+    void appendExternalData(const char * data, size_t size, std::function<void()> holder)
+    {
+        if (is_finished)
+            throw Exception("WriteBufferFromBrpcBuf is finished", ErrorCodes::CANNOT_WRITE_AFTER_END_OF_BUFFER);
+
+        /// Seal the partially filled tail block so the appended bytes keep stream order.
+        bytes += offset();
+        buf.resize(buf.size() - available());
+        {
+            std::lock_guard lock(external_holders_mutex);
+            external_holders.emplace(data, std::move(holder));
+        }
+        if (buf.append_user_data(const_cast<char *>(data), size, &releaseExternalHolder) != 0)
+        {
+            /// Fall back to the copying path, e.g. for sizes the IOBuf refuses to reference.
+            releaseExternalHolder(const_cast<char *>(data));
+            buf.append(data, size);
+        }
+        bytes += size;
+
+        /// Open a fresh block for whatever is written next.
+        auto block_view = buf.expand(initial_size);
+        if (block_view.empty())
+            throw Exception("Cannot resize butil::IOBuf to " + std::to_string(initial_size), ErrorCodes::DISTRIBUTE_STAGE_QUERY_EXCEPTION);
+        set(const_cast<Position>(block_view.data()), block_view.size());
+    }
+
     void finish()
     {
         if (is_finished)
@@ -73,6 +108,26 @@ public:
 private:
     static constexpr size_t initial_size = 32;
 
+    /// brpc only accepts a plain function pointer as the user data deleter, so the
+    /// owners of appended blocks are parked in a process wide registry keyed by the
+    /// data pointer. A multimap because the same bytes may be in flight twice when
+    /// two chunks share a column.
+    static void releaseExternalHolder(void * data)
+    {
+        std::function<void()> holder;
+        {
+            std::lock_guard lock(external_holders_mutex);
+            auto it = external_holders.find(data);
+            if (it == external_holders.end())
+                return;
+            holder = std::move(it->second);
+            external_holders.erase(it);
+        }
+    }
+
+    inline static std::mutex external_holders_mutex;
+    inline static std::unordered_multimap<const void *, std::function<void()>> external_holders;
+
     butil::IOBuf buf;
     bool is_finished = false;
 };
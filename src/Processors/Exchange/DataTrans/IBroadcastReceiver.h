@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <optional>
 #include <variant>
 #include <Interpreters/QueryExchangeLog.h>
 #include <Processors/Chunk.h>
@@ -58,6 +59,12 @@ public:
         return recv(timeout_ts);
     }
     virtual RecvDataPacket recv(timespec timeout_ts) = 0;
+    /// Async (epoll driven) receive support. When getRecvFd() returns a valid descriptor,
+    /// ExchangeSource polls it instead of parking a pipeline thread in recv(): the descriptor
+    /// becomes readable whenever a packet is queued or the stream is finished, and tryRecv()
+    /// pops a ready packet without blocking, returning std::nullopt when nothing has arrived yet.
+    virtual int getRecvFd() { return -1; }
+    virtual std::optional<RecvDataPacket> tryRecv() { return std::nullopt; }
     virtual BroadcastStatus finish(BroadcastStatusCode status_code, String message) = 0;
     virtual String getName() const = 0;
     virtual ~IBroadcastReceiver() = default;
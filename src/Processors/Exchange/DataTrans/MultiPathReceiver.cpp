@@ -268,18 +268,44 @@ void MultiPathReceiver::registerToSenders(UInt32 timeout_ms)
 
 RecvDataPacket MultiPathReceiver::recv(timespec timeout_ts)
 {
-    Stopwatch s;
-    MultiPathDataPacket data_packet;
-    if (!collector->tryPopUntil(data_packet, timeout_ts))
+    while (true)
     {
-        bool collector_closed = collector->closed();
-        String error_msg = "Try pop receive collector for " + name;
-        error_msg.append(collector_closed ? " interrupted" : " timeout at " + DateLUT::instance().timeToString(timeout_ts.tv_sec));
+        Stopwatch s;
+        MultiPathDataPacket data_packet;
+        if (!collector->tryPopUntil(data_packet, timeout_ts))
+        {
+            bool collector_closed = collector->closed();
+            String error_msg = "Try pop receive collector for " + name;
+            error_msg.append(collector_closed ? " interrupted" : " timeout at " + DateLUT::instance().timeToString(timeout_ts.tv_sec));
 
-        BroadcastStatus current_status
-            = finish(collector_closed ? BroadcastStatusCode::RECV_UNKNOWN_ERROR : BroadcastStatusCode::RECV_TIMEOUT, error_msg);
-        return current_status;
+            BroadcastStatus current_status
+                = finish(collector_closed ? BroadcastStatusCode::RECV_UNKNOWN_ERROR : BroadcastStatusCode::RECV_TIMEOUT, error_msg);
+            return current_status;
+        }
+        if (auto res = handleCollectorPacket(std::move(data_packet), s))
+            return std::move(*res);
     }
+}
+
+std::optional<RecvDataPacket> MultiPathReceiver::tryRecv()
+{
+    while (true)
+    {
+        Stopwatch s;
+        MultiPathDataPacket data_packet;
+        if (!collector->tryPop(data_packet))
+        {
+            if (collector->closed())
+                return RecvDataPacket(finish(BroadcastStatusCode::RECV_UNKNOWN_ERROR, "Try pop receive collector for " + name + " interrupted"));
+            return std::nullopt;
+        }
+        if (auto res = handleCollectorPacket(std::move(data_packet), s))
+            return res;
+    }
+}
+
+std::optional<RecvDataPacket> MultiPathReceiver::handleCollectorPacket(MultiPathDataPacket && data_packet, const Stopwatch & s)
+{
     if (std::holds_alternative<DataPacket>(data_packet))
     {
         auto & normal_packet = std::get<DataPacket>(data_packet);
@@ -317,9 +343,9 @@ RecvDataPacket MultiPathReceiver::recv(timespec timeout_ts)
             }
         }
         if (all_receiver_done)
-            return finish(BroadcastStatusCode::ALL_SENDERS_DONE, name + " received all data");
+            return RecvDataPacket(finish(BroadcastStatusCode::ALL_SENDERS_DONE, name + " received all data"));
         else
-            return recv(timeout_ts);
+            return std::nullopt;
     }
 }
 
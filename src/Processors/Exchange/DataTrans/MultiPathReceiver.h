@@ -50,6 +50,8 @@ public:
     void registerToSendersJoin();
 
     RecvDataPacket recv(timespec timeout_ts) override;
+    int getRecvFd() override { return collector->getRecvEventFd(); }
+    std::optional<RecvDataPacket> tryRecv() override;
     BroadcastStatus finish(BroadcastStatusCode status_code, String message) override;
     String getName() const override;
 
@@ -67,6 +69,10 @@ public:
     }
 
 private:
+    /// Returns std::nullopt when the packet was a SendDoneMark which still leaves senders running,
+    /// so the caller should pop the next packet from the collector.
+    std::optional<RecvDataPacket> handleCollectorPacket(MultiPathDataPacket && data_packet, const Stopwatch & s);
+
     std::atomic_bool registering{false};
     std::atomic_bool inited{false};
 
@@ -16,6 +16,7 @@
 #include "NativeChunkInputStream.h"
 
 #include <DataTypes/DataTypeFactory.h>
+#include <DataTypes/DataTypeLowCardinality.h>
 #include <IO/ReadHelpers.h>
 #include <Processors/Transforms/AggregatingTransform.h>
 #include <Common/typeid_cast.h>
@@ -30,7 +31,8 @@ namespace ErrorCodes
     extern const int CANNOT_READ_ALL_DATA;
 }
 
-NativeChunkInputStream::NativeChunkInputStream(ReadBuffer & istr_, const Block & header_) : istr(istr_), header(header_)
+NativeChunkInputStream::NativeChunkInputStream(ReadBuffer & istr_, const Block & header_, bool dictionary_encoded_strings_)
+    : istr(istr_), header(header_), dictionary_encoded_strings(dictionary_encoded_strings_)
 {
 }
 
@@ -56,15 +58,8 @@ void NativeChunkInputStream::readData(
             ErrorCodes::CANNOT_READ_ALL_DATA);
 }
 
-Chunk NativeChunkInputStream::readImpl()
+ChunkInfoPtr NativeChunkInputStream::readChunkInfo(ReadBuffer & istr)
 {
-    Chunk res;
-    if (istr.eof())
-    {
-        return res;
-    }
-
-    /// chunk info
     UInt8 has_chunk_info;
     readVarUInt(has_chunk_info, istr);
     if (has_chunk_info == 1)
@@ -76,21 +71,36 @@ Chunk NativeChunkInputStream::readImpl()
         {
             auto chunk_info = std::make_shared<AggregatedChunkInfo>();
             chunk_info->read(istr);
-            res.setChunkInfo(chunk_info);
+            return chunk_info;
         }
         else if (chunk_info_type == static_cast<UInt8>(ChunkInfo::Type::Totals))
         {
             auto chunk_info = std::make_shared<ChunkInfoTotals>();
             chunk_info->read(istr);
-            res.setChunkInfo(chunk_info);
+            return chunk_info;
         }
         else if (chunk_info_type == static_cast<UInt8>(ChunkInfo::Type::Extremes))
         {
             auto chunk_info = std::make_shared<ChunkInfoExtremes>();
             chunk_info->read(istr);
-            res.setChunkInfo(chunk_info);
+            return chunk_info;
         }
     }
+    return nullptr;
+}
+
+Chunk NativeChunkInputStream::readImpl()
+{
+    Chunk res;
+    if (istr.eof())
+    {
+        return res;
+    }
+
+    /// chunk info
+    if (auto chunk_info = readChunkInfo(istr))
+        res.setChunkInfo(chunk_info);
+
     /// Dimensions
     size_t col_num = 0;
     size_t row_num = 0;
@@ -104,6 +114,22 @@ Chunk NativeChunkInputStream::readImpl()
     {
         DataTypePtr data_type = header.getDataTypes().at(i);
 
+        if (dictionary_encoded_strings)
+        {
+            /// Counterpart of the per-column marker in NativeChunkOutputStream: 1 means the
+            /// column was sent as a per-block dictionary plus indices.
+            UInt8 is_dictionary_encoded = 0;
+            readVarUInt(is_dictionary_encoded, istr);
+            if (is_dictionary_encoded)
+            {
+                auto lc_type = std::make_shared<DataTypeLowCardinality>(data_type);
+                ColumnPtr lc_column = lc_type->createColumn();
+                readData(*lc_type, lc_column, istr, row_num, 0);
+                columns.emplace_back(lc_column->convertToFullColumnIfLowCardinality());
+                continue;
+            }
+        }
+
         /// Data
         ColumnPtr read_column = data_type->createColumn();
 
@@ -32,15 +32,22 @@ class NativeChunkInputStream
 {
 public:
     /// For cases when data structure (header) is known in advance.
-    NativeChunkInputStream(ReadBuffer & istr_, const Block & header_);
+    /// `dictionary_encoded_strings_` must match the flag of the sending
+    /// NativeChunkOutputStream, since it changes the wire format of String columns.
+    NativeChunkInputStream(ReadBuffer & istr_, const Block & header_, bool dictionary_encoded_strings_ = false);
 
     static void readData(const IDataType & type, ColumnPtr & column, ReadBuffer & istr, size_t rows, double avg_value_size_hint);
 
+    /// Counterpart of NativeChunkOutputStream::writeChunkInfo, returns nullptr if the
+    /// chunk was written without info.
+    static ChunkInfoPtr readChunkInfo(ReadBuffer & istr);
+
     Chunk readImpl();
 
 private:
     ReadBuffer & istr;
     Block header;
+    bool dictionary_encoded_strings;
     PODArray<double> avg_value_size_hints;
 };
 
@@ -14,12 +14,14 @@
  */
 
 #include "NativeChunkOutputStream.h"
+#include <unordered_set>
 #include <Compression/CompressedWriteBuffer.h>
 #include <Core/Block.h>
 #include <IO/VarInt.h>
 #include <Common/typeid_cast.h>
 #include <Columns/ColumnLowCardinality.h>
 #include <DataTypes/DataTypeLowCardinality.h>
+#include <common/StringRef.h>
 
 namespace DB
 {
@@ -30,8 +32,8 @@ namespace ErrorCodes
 
 
 NativeChunkOutputStream::NativeChunkOutputStream(
-    WriteBuffer & ostr_, const Block & header_)
-    : ostr(ostr_), header(header_)
+    WriteBuffer & ostr_, const Block & header_, bool dictionary_encode_strings_)
+    : ostr(ostr_), header(header_), dictionary_encode_strings(dictionary_encode_strings_)
 {
 }
 
@@ -73,9 +75,8 @@ static void writeData(const IDataType & type, const ColumnPtr & column, WriteBuf
 }
 
 
-void NativeChunkOutputStream::write(const Chunk & chunk)
+void NativeChunkOutputStream::writeChunkInfo(const Chunk & chunk, WriteBuffer & ostr)
 {
-    /// chunk info
     auto chunk_info = chunk.getChunkInfo();
     if (chunk_info)
     {
@@ -87,6 +88,39 @@ void NativeChunkOutputStream::write(const Chunk & chunk)
     {
         writeVarUInt(0, ostr);
     }
+}
+
+void NativeChunkOutputStream::writeColumnData(const IDataType & type, const ColumnPtr & column, WriteBuffer & ostr)
+{
+    writeData(type, column, ostr, 0, 0);
+}
+
+bool NativeChunkOutputStream::shouldDictionaryEncode(const ColumnPtr & column)
+{
+    /// The dictionary header is not free: only re-encode when a strided sample of the
+    /// column shows values repeating at least ~4x on average.
+    static constexpr size_t min_rows = 128;
+    static constexpr size_t max_samples = 256;
+    static constexpr size_t min_repeat_factor = 4;
+
+    size_t rows = column->size();
+    if (rows < min_rows)
+        return false;
+
+    size_t samples = std::min(rows, max_samples);
+    size_t step = rows / samples;
+
+    std::unordered_set<StringRef, StringRefHash> distinct;
+    for (size_t i = 0; i < samples; ++i)
+        distinct.insert(column->getDataAt(i * step));
+
+    return distinct.size() * min_repeat_factor <= samples;
+}
+
+void NativeChunkOutputStream::write(const Chunk & chunk)
+{
+    /// chunk info
+    writeChunkInfo(chunk, ostr);
     /// Dimensions
     size_t columns = chunk.getNumColumns();
     size_t rows = chunk.getNumRows();
@@ -100,6 +134,22 @@ void NativeChunkOutputStream::write(const Chunk & chunk)
         ColumnPtr column_ptr = chunk.getColumns()[i];
 
         /// Name/Type, we don't need write name/type here.
+        if (dictionary_encode_strings)
+        {
+            /// Per-column marker: 1 = sent as a per-block dictionary plus indices, 0 = plain.
+            /// Written only in this mode, so the wire format is unchanged when it is off.
+            ColumnPtr full_column = rows ? column_ptr->convertToFullColumnIfConst() : column_ptr;
+            if (rows && WhichDataType(data_type).isString() && shouldDictionaryEncode(full_column))
+            {
+                writeVarUInt(1, ostr);
+                auto lc_type = std::make_shared<DataTypeLowCardinality>(data_type);
+                auto lc_column = lc_type->createColumn();
+                lc_column->insertRangeFrom(*full_column, 0, rows);
+                writeData(*lc_type, std::move(lc_column), ostr, 0, 0);
+                continue;
+            }
+            writeVarUInt(0, ostr);
+        }
         /// Data
         if (rows) /// Zero items of data is always represented as zero number of bytes.
             writeData(*data_type, column_ptr, ostr, 0, 0);
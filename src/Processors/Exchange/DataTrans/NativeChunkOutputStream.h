@@ -32,13 +32,27 @@ class CompressedWriteBuffer;
 class NativeChunkOutputStream
 {
 public:
-    NativeChunkOutputStream(WriteBuffer & ostr_, const Block & header_);
+    /// With `dictionary_encode_strings_` every String column gets a per-column marker and,
+    /// when a sample shows few distinct values, is sent as a per-block dictionary plus
+    /// indices instead of the full payload per row. The receiving NativeChunkInputStream
+    /// must be constructed with the same flag.
+    NativeChunkOutputStream(WriteBuffer & ostr_, const Block & header_, bool dictionary_encode_strings_ = false);
 
     void write(const Chunk & chunk);
 
+    /// Building blocks of the native chunk format, also used by the column-sliced
+    /// exchange format which serializes every column into its own region.
+    static void writeChunkInfo(const Chunk & chunk, WriteBuffer & ostr);
+    static void writeColumnData(const IDataType & type, const ColumnPtr & column, WriteBuffer & ostr);
+
+    /// Whether a sampled fraction of the column repeats values often enough that a
+    /// per-block dictionary is worth the re-encoding work.
+    static bool shouldDictionaryEncode(const ColumnPtr & column);
+
 private:
     WriteBuffer & ostr;
     Block header;
+    bool dictionary_encode_strings;
 };
 
 using NativeChunkOutputStreamHolder = std::unique_ptr<NativeChunkOutputStream>;
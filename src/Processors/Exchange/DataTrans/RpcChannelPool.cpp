@@ -18,6 +18,7 @@
 #include <Processors/Exchange/DataTrans/RpcChannelPool.h>
 #include <brpc/options.pb.h>
 #include <fmt/format.h>
+#include <Common/Exception.h>
 
 namespace DB
 {
@@ -83,6 +84,27 @@ size_t RpcChannelPool::checkAndClearExpiredPool(const std::string & client_type)
     return expired_num;
 }
 
+void RpcChannelPool::prewarm(const std::vector<std::string> & host_ports, const std::string & client_type)
+{
+    for (const auto & host_port : host_ports)
+    {
+        try
+        {
+            auto client = getClient(host_port, client_type);
+            if (!client)
+                continue;
+            /// brpc connects lazily on the first call; a health check forces name resolution
+            /// and the handshake right now.
+            if (int rc = client->getChannel().CheckHealth(); rc != 0)
+                LOG_DEBUG(log, "Prewarmed {} channel to {} is not healthy yet, CheckHealth returned {}.", client_type, host_port, rc);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, fmt::format("Failed to prewarm {} channel to {}", client_type, host_port));
+        }
+    }
+}
+
 std::shared_ptr<RpcClient> RpcChannelPool::getClient(const String & host_port, const std::string & client_type)
 {
     static thread_local std::unordered_map<ClientType, PoolOptionsPtr> local_options_pool;
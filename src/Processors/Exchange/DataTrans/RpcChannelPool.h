@@ -64,6 +64,12 @@ public:
 
     std::shared_ptr<RpcClient> getClient(const String & host_port, const std::string & client_type);
 
+    /// Establishes a warm channel of the given client type to each peer: resolves, connects and
+    /// health-checks one client per host, so the first queries after a topology change do not
+    /// pay DNS + TCP + channel setup inside the query path. Failures are logged and ignored,
+    /// peers that are not up yet simply stay cold.
+    void prewarm(const std::vector<std::string> & host_ports, const std::string & client_type);
+
     brpc::ChannelOptions getChannelPoolOptions(const std::string & client_type)
     {
         auto iter = channel_pool.find(client_type);
@@ -14,11 +14,15 @@
  */
 
 
+#include <future>
 #include <memory>
+#include <vector>
 #include <Columns/IColumn.h>
 #include <Compression/CompressedReadBuffer.h>
 #include <IO/ReadBuffer.h>
+#include <IO/VarInt.h>
 #include <Interpreters/Context_fwd.h>
+#include <Interpreters/threadPoolCallbackRunner.h>
 #include <Processors/Chunk.h>
 #include <Processors/Exchange/DataTrans/Brpc/ReadBufferFromBrpcBuf.h>
 #include <Processors/Exchange/DataTrans/NativeChunkInputStream.h>
@@ -26,18 +30,30 @@
 #include <Processors/Exchange/ExchangeUtils.h>
 #include <Poco/Logger.h>
 #include "Common/Stopwatch.h"
+#include <Common/getNumberOfPhysicalCPUCores.h>
+#include <common/defines.h>
 #include <common/logger_useful.h>
 
 namespace DB
 {
-DeserializeBufTransform::DeserializeBufTransform(const Block & header_, bool enable_block_compress_)
+DeserializeBufTransform::DeserializeBufTransform(
+    const Block & header_, bool enable_block_compress_, size_t parallel_threads_, bool dictionary_encoded_strings_)
     : ISimpleTransform(Block(), header_, true)
     , header(getOutputPort().getHeader())
     , enable_block_compress(enable_block_compress_)
+    , parallel_threads(parallel_threads_)
+    , dictionary_encoded_strings(dictionary_encoded_strings_)
     , logger(&Poco::Logger::get("DeserializeBufTransform"))
 {
 }
 
+ThreadPool & DeserializeBufTransform::getDeserializePool()
+{
+    /// Shared by all queries, per block parallelism is bounded by exchange_parallel_deserialize_threads
+    static ThreadPool pool(getNumberOfPhysicalCPUCores(), getNumberOfPhysicalCPUCores(), 10000);
+    return pool;
+}
+
 void DeserializeBufTransform::transform(Chunk & chunk)
 {
     const ChunkInfoPtr & info = chunk.getChunkInfo();
@@ -48,19 +64,122 @@ void DeserializeBufTransform::transform(Chunk & chunk)
     if (!iobuf_info)
         return;
 
-    auto read_buffer = std::make_unique<ReadBufferFromBrpcBuf>(iobuf_info->io_buf);
-    std::unique_ptr<ReadBuffer> buf;
-    if (enable_block_compress)
-        buf = std::make_unique<CompressedReadBuffer>(*read_buffer);
-    else
-        buf = std::move(read_buffer);
     s.restart();
-    NativeChunkInputStream chunk_in(*buf, header);
-    chunk = chunk_in.readImpl();
+    if (parallel_threads > 0)
+    {
+        chunk = deserializeColumnwise(iobuf_info->io_buf, header, enable_block_compress, parallel_threads);
+    }
+    else
+    {
+        auto read_buffer = std::make_unique<ReadBufferFromBrpcBuf>(iobuf_info->io_buf);
+        std::unique_ptr<ReadBuffer> buf;
+        if (enable_block_compress)
+            buf = std::make_unique<CompressedReadBuffer>(*read_buffer);
+        else
+            buf = std::move(read_buffer);
+        NativeChunkInputStream chunk_in(*buf, header, dictionary_encoded_strings);
+        chunk = chunk_in.readImpl();
+    }
     if (const auto * io_buf_with_receiver = dynamic_cast<const DeserializeBufTransform::IOBufChunkInfoWithReceiver *>(iobuf_info.get()))
     {
         if (auto receiver = io_buf_with_receiver->receiver.lock())
             receiver->addToMetricsMaybe(0, s.elapsedMilliseconds(), 0, chunk);
     }
 }
+
+Chunk DeserializeBufTransform::deserializeColumnwise(
+    const butil::IOBuf & io_buf, const Block & header, bool enable_block_compress, size_t parallel_threads)
+{
+    Chunk res;
+    ReadBufferFromBrpcBuf header_in(io_buf);
+    if (header_in.eof())
+        return res;
+
+    if (auto chunk_info = NativeChunkInputStream::readChunkInfo(header_in))
+        res.setChunkInfo(std::move(chunk_info));
+
+    size_t col_num = 0;
+    size_t row_num = 0;
+    readVarUInt(col_num, header_in);
+    readVarUInt(row_num, header_in);
+    chassert(header.columns() == col_num);
+
+    std::vector<size_t> column_sizes(col_num);
+    for (auto & column_size : column_sizes)
+        readVarUInt(column_size, header_in);
+
+    /// Slice the buffer into the per column regions recorded by the sender, refcounted, no copy
+    butil::IOBuf rest = io_buf;
+    rest.pop_front(header_in.count());
+    std::vector<butil::IOBuf> column_bufs(col_num);
+    for (size_t i = 0; i < col_num; ++i)
+        rest.cutn(&column_bufs[i], column_sizes[i]);
+
+    Columns columns(col_num);
+    auto deserialize_range = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            DataTypePtr data_type = header.getDataTypes().at(i);
+            ColumnPtr read_column = data_type->createColumn();
+            if (row_num)
+            {
+                ReadBufferFromBrpcBuf column_in(column_bufs[i]);
+                if (enable_block_compress)
+                {
+                    CompressedReadBuffer decompressed_in(column_in);
+                    NativeChunkInputStream::readData(*data_type, read_column, decompressed_in, row_num, 0);
+                }
+                else
+                {
+                    NativeChunkInputStream::readData(*data_type, read_column, column_in, row_num, 0);
+                }
+            }
+            columns[i] = std::move(read_column);
+        }
+    };
+
+    size_t num_tasks = std::max<size_t>(1, std::min(parallel_threads, col_num));
+    size_t cols_per_task = (col_num + num_tasks - 1) / num_tasks;
+
+    std::vector<std::future<void>> futures;
+    auto schedule = threadPoolCallbackRunner<void>(getDeserializePool(), "DeserColumns");
+    for (size_t task = 1; task < num_tasks; ++task)
+    {
+        size_t begin = task * cols_per_task;
+        size_t end = std::min(begin + cols_per_task, col_num);
+        if (begin >= end)
+            break;
+        futures.push_back(schedule([&deserialize_range, begin, end] { deserialize_range(begin, end); }, {}));
+    }
+
+    /// The calling thread decodes the first range, it counts against the bound too.
+    /// Tasks reference local state, wait for all of them before unwinding on error.
+    std::exception_ptr first_exception;
+    try
+    {
+        deserialize_range(0, std::min(cols_per_task, col_num));
+    }
+    catch (...)
+    {
+        first_exception = std::current_exception();
+    }
+    for (auto & future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (...)
+        {
+            if (!first_exception)
+                first_exception = std::current_exception();
+        }
+    }
+    if (first_exception)
+        std::rethrow_exception(first_exception);
+
+    res.setColumns(std::move(columns), row_num);
+    return res;
+}
 }
@@ -19,6 +19,7 @@
 #include <Processors/ISimpleTransform.h>
 #include <butil/iobuf.h>
 #include "Common/Stopwatch.h"
+#include "Common/ThreadPool.h"
 #include "Processors/Exchange/DataTrans/IBroadcastReceiver.h"
 
 namespace DB
@@ -39,16 +40,31 @@ public:
         std::weak_ptr<IBroadcastReceiver> receiver;
     };
 
-    explicit DeserializeBufTransform(const Block & header_, bool enable_block_compress_);
+    explicit DeserializeBufTransform(
+        const Block & header_, bool enable_block_compress_, size_t parallel_threads_ = 0, bool dictionary_encoded_strings_ = false);
 
     String getName() const override { return "DeserializeBufTransform"; }
 
+    /// Decode the column-sliced format written by BrpcRemoteBroadcastSender::serializeChunkColumnwise,
+    /// splitting the column regions across the shared deserialization pool. Also used by the
+    /// keep_order receive path (StreamHandler), which decodes inline instead of via this transform.
+    static Chunk deserializeColumnwise(
+        const butil::IOBuf & io_buf, const Block & header, bool enable_block_compress, size_t parallel_threads);
+
 protected:
     void transform(Chunk & chunk) override;
 
 private:
+    static ThreadPool & getDeserializePool();
+
     const Block & header;
     bool enable_block_compress;
+    /// Maximum number of threads (including the calling one) decoding one block, 0 means
+    /// the single threaded legacy format, must match the sender's exchange_parallel_deserialize_threads
+    size_t parallel_threads;
+    /// Must match the sender's exchange_enable_string_dictionary_encoding, only used by
+    /// the single threaded legacy format
+    bool dictionary_encoded_strings;
     Poco::Logger * logger;
     Stopwatch s;
 };
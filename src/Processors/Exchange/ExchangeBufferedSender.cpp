@@ -22,18 +22,20 @@
 #include <Processors/Exchange/ExchangeBufferedSender.h>
 #include <Processors/Exchange/ExchangeUtils.h>
 #include <Common/Exception.h>
+#include <Common/time.h>
 #include <common/logger_useful.h>
 #include <Processors/Chunk.h>
 
 namespace DB
 {
 ExchangeBufferedSender::ExchangeBufferedSender(
-    const Block & header_, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes_, UInt64 threshold_in_row_num_)
+    const Block & header_, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes_, UInt64 threshold_in_row_num_, UInt64 max_hold_ms_)
     : header(header_)
     , column_num(header_.getColumns().size())
     , sender(sender_)
     , threshold_in_bytes(threshold_in_bytes_)
     , threshold_in_row_num(threshold_in_row_num_)
+    , max_hold_ms(max_hold_ms_)
     , logger(&Poco::Logger::get("ExchangeBufferedSender"))
 {
     resetBuffer();
@@ -48,7 +50,12 @@ BroadcastStatus ExchangeBufferedSender::flush(bool force, const ChunkInfoPtr & c
 
     if (!force)
     {
-        if (bufferBytes() < threshold_in_bytes && rows < threshold_in_row_num)
+        /// Below the size thresholds the buffer is still flushed once rows have been held
+        /// for max_hold_ms, so a trickle of small chunks reaches downstream segments
+        /// (and ultimately the client) promptly instead of waiting for end of stream.
+        bool held_too_long = max_hold_ms && buffered_since_ms
+            && time_in_milliseconds(std::chrono::system_clock::now()) - buffered_since_ms >= max_hold_ms;
+        if (bufferBytes() < threshold_in_bytes && rows < threshold_in_row_num && !held_too_long)
             return BroadcastStatus(BroadcastStatusCode::RUNNING);
     }
 
@@ -68,11 +75,14 @@ BroadcastStatus ExchangeBufferedSender::sendThrough(Chunk chunk)
 void ExchangeBufferedSender::resetBuffer()
 {
     partition_buffer = header.cloneEmptyColumns();
+    buffered_since_ms = 0;
 }
 
 void ExchangeBufferedSender::appendSelective(
     size_t column_idx, const IColumn & source, const IColumn::Selector & selector, size_t from, size_t length)
 {
+    if (buffered_since_ms == 0)
+        buffered_since_ms = time_in_milliseconds(std::chrono::system_clock::now());
     partition_buffer[column_idx]->insertRangeSelective(source, selector, from, length);
 }
 
@@ -28,7 +28,8 @@ namespace DB
 class ExchangeBufferedSender
 {
 public:
-    ExchangeBufferedSender(const Block & header, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes, UInt64 threshold_in_row_num);
+    ExchangeBufferedSender(
+        const Block & header, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes, UInt64 threshold_in_row_num, UInt64 max_hold_ms = 0);
     void appendSelective(size_t column_idx, const IColumn & source, const IColumn::Selector & selector, size_t from, size_t length);
     BroadcastStatus sendThrough(Chunk chunk);
     BroadcastStatus flush(bool force, const ChunkInfoPtr & chunk_info);
@@ -38,6 +39,9 @@ private:
     BroadcastSenderPtr sender;
     UInt64 threshold_in_bytes;
     UInt64 threshold_in_row_num;
+    UInt64 max_hold_ms;
+    /// When the first rows entered the (currently non-empty) buffer; 0 while the buffer is empty.
+    UInt64 buffered_since_ms = 0;
     MutableColumns partition_buffer;
     Poco::Logger * logger;
     void resetBuffer();
@@ -23,8 +23,12 @@ struct ExchangeOptions
     timespec exchange_timeout_ts;
     UInt64 send_threshold_in_bytes;
     UInt64 send_threshold_in_row_num;
+    UInt64 send_max_hold_ms = 0;
     bool force_remote_mode = false;
     bool force_use_buffer = false;
+    bool enable_async_recv = false;
+    UInt64 parallel_deserialize_threads = 0;
+    UInt64 sender_merge_states_threshold_in_bytes = 0;
 };
 
 }
@@ -17,6 +17,7 @@
 #include <atomic>
 #include <optional>
 #include <variant>
+#include <unistd.h>
 
 #include <Columns/ColumnsNumber.h>
 #include <DataStreams/RemoteQueryExecutor.h>
@@ -29,6 +30,7 @@
 #include <Processors/Exchange/ExchangeSource.h>
 #include <Processors/ISource.h>
 #include <Processors/Transforms/AggregatingTransform.h>
+#include <Common/DateLUT.h>
 #include <Common/Exception.h>
 #include <Common/time.h>
 #include <common/logger_useful.h>
@@ -92,6 +94,17 @@ String ExchangeSource::getClassName() const
 
 IProcessor::Status ExchangeSource::prepare()
 {
+#if defined(OS_LINUX)
+    if (is_async_state)
+    {
+        /// Check if query was cancelled before returning Async status. Otherwise it may lead to infinite loop.
+        if (was_query_canceled)
+            is_async_state = false;
+        else
+            return Status::Async;
+    }
+#endif
+
     const auto & status = SourceWithProgress::prepare();
     if (status == Status::Finished)
     {
@@ -100,12 +113,73 @@ IProcessor::Status ExchangeSource::prepare()
     return status;
 }
 
+#if defined(OS_LINUX)
+bool ExchangeSource::initAsyncRecvState()
+{
+    if (recv_epoll)
+        return true;
+
+    /// Receivers which do not expose a pollable descriptor (e.g. local channels) keep the blocking path.
+    recv_fd = receiver->getRecvFd();
+    if (recv_fd < 0)
+        return false;
+
+    recv_epoll = std::make_unique<Epoll>();
+    recv_epoll->add(recv_fd);
+
+    /// The exchange deadline is absolute; arm a one-shot timer to the remaining interval
+    /// so that a stream which never produces data still times out like the blocking recv().
+    timeout_timer = std::make_unique<TimerDescriptor>();
+    UInt64 deadline_ms = UInt64(options.exchange_timeout_ts.tv_sec) * 1000 + UInt64(options.exchange_timeout_ts.tv_nsec) / 1000000;
+    UInt64 now_ms = time_in_milliseconds(std::chrono::system_clock::now());
+    Poco::Timespan::TimeDiff rest_us = deadline_ms > now_ms ? Poco::Timespan::TimeDiff(deadline_ms - now_ms) * 1000 : 1;
+    timeout_timer->setRelative(Poco::Timespan(rest_us));
+    recv_epoll->add(timeout_timer->getDescriptor());
+    return true;
+}
+
+bool ExchangeSource::timeoutExpired() const
+{
+    /// The timer descriptor is non-blocking and one-shot: it is readable only after the deadline.
+    UInt64 expirations = 0;
+    return ::read(timeout_timer->getDescriptor(), &expirations, sizeof(expirations)) > 0;
+}
+#endif
+
 std::optional<Chunk> ExchangeSource::tryGenerate()
 {
     if (was_query_canceled || was_receiver_finished)
         return std::nullopt;
 
-    RecvDataPacket packet = receiver->recv(options.exchange_timeout_ts);
+    RecvDataPacket packet{Chunk()};
+#if defined(OS_LINUX)
+    if (options.enable_async_recv && initAsyncRecvState())
+    {
+        /// Drain the eventfd before checking the queue: a push racing with the drain signals
+        /// it again, so no wakeup can be lost and level-triggered epoll does not spin.
+        UInt64 buf = 0;
+        while (::read(recv_fd, &buf, sizeof(buf)) > 0)
+            ;
+
+        auto ready_packet = receiver->tryRecv();
+        if (!ready_packet && timeoutExpired())
+            ready_packet = RecvDataPacket(receiver->finish(
+                BroadcastStatusCode::RECV_TIMEOUT,
+                "Try recv for " + receiver->getName() + " timeout at "
+                    + DateLUT::instance().timeToString(options.exchange_timeout_ts.tv_sec)));
+        if (!ready_packet)
+        {
+            is_async_state = true;
+            return Chunk();
+        }
+        is_async_state = false;
+        packet = std::move(*ready_packet);
+    }
+    else
+        packet = receiver->recv(options.exchange_timeout_ts);
+#else
+    packet = receiver->recv(options.exchange_timeout_ts);
+#endif
 
     if (std::holds_alternative<Chunk>(packet))
     {
@@ -22,6 +22,10 @@
 #include <Processors/RowsBeforeLimitCounter.h>
 #include <Processors/Sources/SourceWithProgress.h>
 #include <Processors/Exchange/ExchangeOptions.h>
+#if defined(OS_LINUX)
+#include <Common/Epoll.h>
+#include <Common/TimerDescriptor.h>
+#endif
 
 
 namespace DB
@@ -56,6 +60,10 @@ public:
     String getClassName() const;
     BroadcastReceiverPtr & getReceiver() { return receiver; }
 
+#if defined(OS_LINUX)
+    int schedule() override { return recv_epoll->getFileDescriptor(); }
+#endif
+
 protected:
     std::optional<Chunk> tryGenerate() override;
     void onCancel() override;
@@ -69,6 +77,18 @@ private:
     std::atomic<bool> was_receiver_finished {false};
     Poco::Logger * logger;
     void checkBroadcastStatus(const BroadcastStatus & status) const;
+
+#if defined(OS_LINUX)
+    /// Async receive: instead of parking a pipeline thread in recv() for every exchange stream,
+    /// return Status::Async and let the executor epoll the receiver's data-ready eventfd together
+    /// with a timer armed to the exchange deadline. Thousands of idle streams then cost no threads.
+    bool initAsyncRecvState();
+    bool timeoutExpired() const;
+    bool is_async_state = false;
+    int recv_fd = -1;
+    std::unique_ptr<Epoll> recv_epoll;
+    std::unique_ptr<TimerDescriptor> timeout_timer;
+#endif
 };
 
 class ExchangeTotalsSource : public ISource
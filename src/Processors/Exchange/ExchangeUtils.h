@@ -58,8 +58,12 @@ public:
             .exchange_timeout_ts = context->getQueryExpirationTimeStamp(),
             .send_threshold_in_bytes = settings.exchange_buffer_send_threshold_in_bytes,
             .send_threshold_in_row_num = settings.exchange_buffer_send_threshold_in_row,
+            .send_max_hold_ms = settings.exchange_buffer_send_max_hold_ms,
             .force_remote_mode = settings.exchange_enable_force_remote_mode,
-            .force_use_buffer = settings.exchange_force_use_buffer};
+            .force_use_buffer = settings.exchange_force_use_buffer,
+            .enable_async_recv = settings.exchange_enable_async_recv,
+            .parallel_deserialize_threads = settings.exchange_parallel_deserialize_threads,
+            .sender_merge_states_threshold_in_bytes = settings.exchange_sender_merge_states_threshold_in_bytes};
     }
 
     static inline BroadcastStatus sendAndCheckReturnStatus(IBroadcastSender & sender, Chunk chunk)
@@ -13,13 +13,18 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <tuple>
 #include <Processors/Exchange/DataTrans/IBroadcastSender.h>
 #include <Processors/Exchange/MultiPartitionExchangeSink.h>
 #include <Processors/Exchange/IExchangeSink.h>
 #include <Common/Exception.h>
+#include <Common/SipHash.h>
+#include <Common/assert_cast.h>
 #include <common/logger_useful.h>
+#include <Columns/ColumnAggregateFunction.h>
 #include <Columns/IColumn.h>
+#include <DataTypes/DataTypeAggregateFunction.h>
 #include <Processors/Exchange/ExchangeBufferedSender.h>
 #include <Processors/Exchange/ExchangeOptions.h>
 #include <Processors/Exchange/RepartitionTransform.h>
@@ -63,9 +68,32 @@ MultiPartitionExchangeSink::MultiPartitionExchangeSink(
 
     for(size_t i = 0; i < partition_num; ++i)
     {
-        ExchangeBufferedSender buffered_sender (header, partition_senders[i], options.send_threshold_in_bytes, options.send_threshold_in_row_num);
+        ExchangeBufferedSender buffered_sender (header, partition_senders[i], options.send_threshold_in_bytes, options.send_threshold_in_row_num, options.send_max_hold_ms);
         buffered_senders.emplace_back(std::move(buffered_sender));
     }
+
+    if (options.sender_merge_states_threshold_in_bytes && partition_num > 1)
+    {
+        for (size_t i = 0; i < column_num; ++i)
+        {
+            if (WhichDataType(header.safeGetByPosition(i).type).isAggregateFunction())
+                state_column_positions.push_back(i);
+            else
+                merge_key_positions.push_back(i);
+        }
+
+        /// Rows with equal grouping keys always target the same partition when the shuffle
+        /// keys are a subset of the grouping keys, so merging before repartition is safe.
+        bool repartition_by_grouping_keys = std::all_of(repartition_keys.begin(), repartition_keys.end(), [this](size_t key_idx) {
+            return std::find(merge_key_positions.begin(), merge_key_positions.end(), key_idx) != merge_key_positions.end();
+        });
+
+        if (!state_column_positions.empty() && repartition_by_grouping_keys)
+        {
+            merge_states = true;
+            merge_buffer = header.cloneEmptyColumns();
+        }
+    }
 }
 
 void MultiPartitionExchangeSink::consume(Chunk chunk)
@@ -84,6 +112,8 @@ void MultiPartitionExchangeSink::consume(Chunk chunk)
     }
 
     if (!has_input) {
+        if (merge_states)
+            flushMergedStates();
         for(size_t i = 0; i < partition_num ; ++i)
             buffered_senders[i].flush(true, current_chunk_info);
         finish();
@@ -97,6 +127,9 @@ void MultiPartitionExchangeSink::consume(Chunk chunk)
 
     if (!chunk_info_matched)
     {
+        /// Accumulated rows belong to the previous chunk info, push them out under it first.
+        if (merge_states)
+            flushMergedStates();
         for (size_t i = 0; i < partition_num; ++i)
         {
             buffered_senders[i].flush(true, current_chunk_info);
@@ -104,10 +137,27 @@ void MultiPartitionExchangeSink::consume(Chunk chunk)
         current_chunk_info = chunk_info;
     }
 
-    IColumn::Selector partition_selector;
-    RepartitionTransform::PartitionStartPoints partition_start_points;
-    std::tie(partition_selector, partition_start_points) = RepartitionTransform::doRepartition(
-        partition_num, chunk, header, repartition_keys, repartition_func, *repartition_result_type_ptr);
+    if (merge_states)
+    {
+        accumulateStates(chunk);
+
+        size_t merge_buffer_bytes = 0;
+        for (const auto & column : merge_buffer)
+            merge_buffer_bytes += column->allocatedBytes();
+        if (merge_buffer_bytes >= options.sender_merge_states_threshold_in_bytes)
+            flushMergedStates();
+        return;
+    }
+
+    partitionAndSend(std::move(chunk));
+}
+
+void MultiPartitionExchangeSink::partitionAndSend(Chunk chunk)
+{
+    RepartitionTransform::doRepartition(
+        partition_num, chunk, header, repartition_keys, repartition_func, *repartition_result_type_ptr, scatter_context);
+    const auto & partition_selector = scatter_context.selector;
+    const auto & partition_start_points = scatter_context.start_points;
 
     const auto &  columns = chunk.getColumns();
     for (size_t i = 0; i < column_num; i++)
@@ -134,6 +184,62 @@ void MultiPartitionExchangeSink::consume(Chunk chunk)
         finish();
 }
 
+void MultiPartitionExchangeSink::accumulateStates(Chunk & chunk)
+{
+    size_t num_rows = chunk.getNumRows();
+    auto columns = chunk.detachColumns();
+    for (auto & column : columns)
+        column = column->convertToFullColumnIfConst();
+
+    for (size_t row = 0; row < num_rows; ++row)
+    {
+        UInt128 key{};
+        SipHash hash;
+
+        for (size_t position : merge_key_positions)
+            columns[position]->updateHashWithValue(row, hash);
+
+        hash.get128(key);
+
+        HashMap<UInt128, UInt64, UInt128TrivialHash>::LookupResult it;
+        bool inserted;
+        merge_key_to_row.emplace(key, it, inserted);
+
+        if (inserted)
+        {
+            it->getMapped() = merge_buffer[0]->size();
+            for (size_t position : merge_key_positions)
+                merge_buffer[position]->insertFrom(*columns[position], row);
+            /// States start from a freshly allocated default place owned by the buffer,
+            /// so merging below never mutates states shared with the source column.
+            for (size_t position : state_column_positions)
+                merge_buffer[position]->insertDefault();
+        }
+
+        size_t buffer_row = it->getMapped();
+        for (size_t position : state_column_positions)
+        {
+            auto & dst_column = assert_cast<ColumnAggregateFunction &>(*merge_buffer[position]);
+            const auto & src_column = assert_cast<const ColumnAggregateFunction &>(*columns[position]);
+            dst_column.getAggregateFunction()->merge(
+                dst_column.getData()[buffer_row], src_column.getData()[row], &dst_column.createOrGetArena());
+        }
+    }
+}
+
+void MultiPartitionExchangeSink::flushMergedStates()
+{
+    size_t num_rows = merge_buffer[0]->size();
+    if (!num_rows)
+        return;
+
+    Chunk merged_chunk(std::move(merge_buffer), num_rows);
+    merge_buffer = header.cloneEmptyColumns();
+    merge_key_to_row = {};
+
+    partitionAndSend(std::move(merged_chunk));
+}
+
 void MultiPartitionExchangeSink::onFinish()
 {
     LOG_TRACE(logger, "MultiPartitionExchangeSink finish");
@@ -17,10 +17,12 @@
 #include <Core/ColumnNumbers.h>
 #include <Functions/IFunction.h>
 #include <Processors/Chunk.h>
+#include <Common/HashTable/HashMap.h>
 #include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
 #include <Processors/Exchange/ExchangeBufferedSender.h>
 #include <Processors/Exchange/ExchangeOptions.h>
 #include <Processors/Exchange/IExchangeSink.h>
+#include <Processors/Exchange/RepartitionTransform.h>
 #include <Processors/IProcessor.h>
 #include <DataTypes/IDataType.h>
 
@@ -61,6 +63,13 @@ protected:
     virtual void onFinish() override;
 
 private:
+    /// Repartition the chunk and push the pieces into the per-partition send buffers.
+    void partitionAndSend(Chunk chunk);
+    /// Merge rows of the chunk into `merge_buffer`, combining aggregate states with equal grouping keys.
+    void accumulateStates(Chunk & chunk);
+    /// Send the merge buffer content through the ordinary repartition path and reset it.
+    void flushMergedStates();
+
     String name;
     const Block & header;
     BroadcastSenderPtrs partition_senders;
@@ -70,9 +79,19 @@ private:
     const ColumnNumbers repartition_keys;
     ExchangeOptions options;
     ExchangeBufferedSenders buffered_senders;
+    /// Scatter buffers reused across chunks, see RepartitionTransform::ScatterContext.
+    RepartitionTransform::ScatterContext scatter_context;
     ChunkInfoPtr current_chunk_info;
     Poco::Logger * logger;
     const DataTypePtr * repartition_result_type_ptr ;
+
+    /// Sender-side partial merge of aggregate states for two-phase GROUP BY shuffles.
+    /// Enabled when the header carries aggregate states and options set a flush threshold.
+    bool merge_states = false;
+    ColumnNumbers state_column_positions;
+    ColumnNumbers merge_key_positions;
+    MutableColumns merge_buffer;
+    HashMap<UInt128, UInt64, UInt128TrivialHash> merge_key_to_row;
 };
 
 }
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <utility>
+#include <Columns/ColumnNullable.h>
 #include <Columns/ColumnsNumber.h>
 #include <Columns/FilterDescription.h>
 #include <Columns/IColumn.h>
@@ -24,12 +25,93 @@
 #include <Processors/Chunk.h>
 #include <Processors/Exchange/RepartitionTransform.h>
 #include <Poco/Logger.h>
+#include <Common/SipHash.h>
 #include <Common/WeakHash.h>
+#include <Common/assert_cast.h>
+#include <Common/typeid_cast.h>
 #include <common/logger_useful.h>
 #include <DataTypes/DataTypeNullable.h>
 
+#if defined(__SSE2__)
+#    define LIBDIVIDE_SSE2 1
+#endif
+
+#include <libdivide.h>
+
 namespace DB
 {
+
+namespace
+{
+    /// Pack per row partition indexes into the selector and start points format shared by
+    /// RepartitionTransform and the partition exchange sinks.
+    void makePartitionSelector(
+        size_t partition_num,
+        size_t input_rows_count,
+        const PODArray<UInt32> & partition_index,
+        IColumn::Selector & repartition_selector,
+        RepartitionTransform::PartitionStartPoints & partition_row_idx_start_points)
+    {
+        partition_row_idx_start_points.assign(partition_num + 1, size_t(0));
+        /// Every slot is written by the distribution loop below, no need to zero-fill.
+        repartition_selector.resize(input_rows_count);
+
+        for (size_t i = 0; i < input_rows_count; ++i)
+            partition_row_idx_start_points[partition_index[i]]++;
+
+        // make partition_row_idx_start_points[partition_num] = input_rows_count
+        for (size_t i = 1; i <= partition_num; ++i)
+        {
+            partition_row_idx_start_points[i] += partition_row_idx_start_points[i - 1];
+        }
+
+        for (size_t i = input_rows_count; i-- > 0;)
+        {
+            repartition_selector[partition_row_idx_start_points[partition_index[i]] - 1] = i;
+            partition_row_idx_start_points[partition_index[i]]--;
+        }
+    }
+
+    /// Bucketize hashes the way createBlockSelector does: libdivide turns the per row
+    /// modulo into multiply-and-shift that the compiler can vectorize.
+    void bucketizeHashes(const UInt64 * hashes, size_t rows, size_t partition_num, PODArray<UInt32> & partition_index)
+    {
+        libdivide::divider<UInt64> divider(partition_num);
+        for (size_t i = 0; i < rows; ++i)
+            partition_index[i] = static_cast<UInt32>(hashes[i] - (hashes[i] / divider) * partition_num);
+    }
+
+    void fillPartitionIndex(const IColumn & hash_result, size_t partition_num, PODArray<UInt32> & partition_index)
+    {
+        size_t rows = hash_result.size();
+        partition_index.resize(rows);
+
+        if (const auto * nullable = typeid_cast<const ColumnNullable *>(&hash_result))
+        {
+            bucketizeHashes(
+                assert_cast<const ColumnUInt64 &>(nullable->getNestedColumn()).getData().data(), rows, partition_num, partition_index);
+            const auto & null_map = nullable->getNullMapData();
+            for (size_t i = 0; i < rows; ++i)
+                if (null_map[i])
+                    partition_index[i] = 0;
+        }
+        else if (const auto * plain = typeid_cast<const ColumnUInt64 *>(&hash_result))
+        {
+            bucketizeHashes(plain->getData().data(), rows, partition_num, partition_index);
+        }
+        else
+        {
+            /// Generic fallback, e.g. for const hash columns.
+            for (size_t i = 0; i < rows; ++i)
+                partition_index[i] = hash_result.get64(i) % partition_num;
+            if (hash_result.isNullable())
+                for (size_t i = 0; i < rows; ++i)
+                    if (hash_result.isNullAt(i))
+                        partition_index[i] = 0;
+        }
+    }
+}
+
 RepartitionTransform::RepartitionTransform(
     const Block & header_, size_t partition_num_, ColumnNumbers repartition_keys_, ExecutableFunctionPtr repartition_func_)
     : ISimpleTransform(header_, header_, true)
@@ -42,29 +124,28 @@ RepartitionTransform::RepartitionTransform(
 
 void RepartitionTransform::transform(Chunk & chunk)
 {
-    IColumn::Selector partition_selector;
-    RepartitionTransform::PartitionStartPoints partition_start_points;
-
-    std::tie(partition_selector, partition_start_points)
-        = doRepartition(partition_num, chunk, getInputPort().getHeader(), repartition_keys, repartition_func, REPARTITION_FUNC_RESULT_TYPE);
+    doRepartition(
+        partition_num, chunk, getInputPort().getHeader(), repartition_keys, repartition_func, REPARTITION_FUNC_RESULT_TYPE, scatter_context);
     ChunkInfoPtr repartion_info = std::make_shared<RepartitionChunkInfo>(
-        std::move(partition_selector), std::move(partition_start_points), std::move(chunk.getChunkInfo()));
+        std::move(scatter_context.selector), std::move(scatter_context.start_points), std::move(chunk.getChunkInfo()));
     chunk.setChunkInfo(std::move(repartion_info));
 }
 
-std::pair<IColumn::Selector, RepartitionTransform::PartitionStartPoints> RepartitionTransform::doRepartition(
+void RepartitionTransform::doRepartition(
     size_t partition_num,
     const Chunk & chunk,
     const Block & header,
     const ColumnNumbers & repartition_keys,
     ExecutableFunctionPtr repartition_func,
-    const DataTypePtr & result_type)
+    const DataTypePtr & result_type,
+    ScatterContext & context)
 {
+    if (!repartition_func)
+        return doBucketRepartition(partition_num, chunk, repartition_keys, context);
+
     size_t input_rows_count = chunk.getNumRows();
-    auto selector_column = ColumnUInt64::create(input_rows_count);
     const Columns & columns = chunk.getColumns();
 
-
     ColumnsWithTypeAndName arguments;
     arguments.reserve(repartition_keys.size());
     for (size_t key_idx : repartition_keys)
@@ -75,40 +156,53 @@ std::pair<IColumn::Selector, RepartitionTransform::PartitionStartPoints> Reparti
 
     ColumnPtr hash_result = repartition_func->execute(arguments, result_type, input_rows_count, false);
 
-    PartitionStartPoints partition_row_idx_start_points(partition_num + 1, 0);
+    fillPartitionIndex(*hash_result, partition_num, context.partition_index);
+    makePartitionSelector(partition_num, input_rows_count, context.partition_index, context.selector, context.start_points);
+}
 
-    IColumn::Selector repartition_selector(input_rows_count, 0);
-    PODArrayWithStackMemory<UInt32, 32> partition_index(input_rows_count, 0);
+std::pair<IColumn::Selector, RepartitionTransform::PartitionStartPoints> RepartitionTransform::doRepartition(
+    size_t partition_num,
+    const Chunk & chunk,
+    const Block & header,
+    const ColumnNumbers & repartition_keys,
+    ExecutableFunctionPtr repartition_func,
+    const DataTypePtr & result_type)
+{
+    ScatterContext context;
+    doRepartition(partition_num, chunk, header, repartition_keys, std::move(repartition_func), result_type, context);
+    return std::make_pair(std::move(context.selector), std::move(context.start_points));
+}
 
-    for (size_t i = 0; i < input_rows_count; ++i)
-    {
-        partition_index[i] = hash_result->get64(i) % partition_num;
-    }
+void RepartitionTransform::doBucketRepartition(
+    size_t partition_num, const Chunk & chunk, const ColumnNumbers & repartition_keys, ScatterContext & context)
+{
+    size_t input_rows_count = chunk.getNumRows();
+    const Columns & columns = chunk.getColumns();
 
-    if (hash_result->isNullable())
-    {
-        for (size_t i = 0; i < input_rows_count; ++i)
-        {
-            if (hash_result->isNullAt(i))
-                partition_index[i] = 0;
-        }
-    }
+    // Chain the key columns through one SipHash exactly like createColumnWithSipHash,
+    // so the row lands on the worker holding the bucket with the same key.
+    context.row_hashes.assign(input_rows_count, SipHash());
+    for (size_t key_idx : repartition_keys)
+        updateBucketRowHashes(*columns[key_idx], context.row_hashes);
 
-    for (size_t i = 0; i < input_rows_count; ++i)
-        partition_row_idx_start_points[partition_index[i]]++;
+    context.partition_index.resize(input_rows_count);
 
-    // make partition_row_idx_start_points[partition_num] = input_rows_count
-    for (size_t i = 1; i <= partition_num; ++i)
+    libdivide::divider<UInt64> divider(partition_num);
+    for (size_t i = 0; i < input_rows_count; ++i)
     {
-        partition_row_idx_start_points[i] += partition_row_idx_start_points[i - 1];
+        UInt64 hash = context.row_hashes[i].get64();
+        context.partition_index[i] = static_cast<UInt32>(hash - (hash / divider) * partition_num);
     }
 
-    for (size_t i = input_rows_count; i-- > 0;)
-    {
-        repartition_selector[partition_row_idx_start_points[partition_index[i]] - 1] = i;
-        partition_row_idx_start_points[partition_index[i]]--;
-    }
-    return std::make_pair(std::move(repartition_selector), std::move(partition_row_idx_start_points));
+    makePartitionSelector(partition_num, input_rows_count, context.partition_index, context.selector, context.start_points);
+}
+
+std::pair<IColumn::Selector, RepartitionTransform::PartitionStartPoints>
+RepartitionTransform::doBucketRepartition(size_t partition_num, const Chunk & chunk, const ColumnNumbers & repartition_keys)
+{
+    ScatterContext context;
+    doBucketRepartition(partition_num, chunk, repartition_keys, context);
+    return std::make_pair(std::move(context.selector), std::move(context.start_points));
 }
 
 ExecutableFunctionPtr RepartitionTransform::getDefaultRepartitionFunction(const ColumnsWithTypeAndName & arguments, ContextPtr context)
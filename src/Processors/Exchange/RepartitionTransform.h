@@ -25,6 +25,8 @@
 #include <Processors/Chunk.h>
 #include <Processors/ISimpleTransform.h>
 #include <Poco/Logger.h>
+#include <Common/PODArray.h>
+#include <Common/SipHash.h>
 #include <Interpreters/Context_fwd.h>
 
 namespace DB
@@ -45,6 +47,21 @@ public:
         ChunkInfoPtr origin_chunk_info;
     };
 
+    /** Reusable buffers for the partition scatter. doRepartition leaves its results in
+      * selector and start_points; the remaining arrays are scratch space whose capacity
+      * survives across chunks, so steady-state repartitioning stops allocating. Callers
+      * that keep the context (MultiPartitionExchangeSink) reuse everything; callers that
+      * hand the selector over (RepartitionTransform moves it into the chunk info) only
+      * pay for that one array per chunk.
+      */
+    struct ScatterContext
+    {
+        IColumn::Selector selector;
+        PartitionStartPoints start_points;
+        PODArray<UInt32> partition_index;
+        std::vector<SipHash> row_hashes;
+    };
+
     RepartitionTransform(
         const Block & header_, size_t partition_num_, ColumnNumbers repartition_keys_, ExecutableFunctionPtr repartition_func_);
 
@@ -55,6 +72,17 @@ public:
     static const DataTypePtr REPARTITION_FUNC_RESULT_TYPE;
     static const DataTypePtr REPARTITION_FUNC_NULLABLE_RESULT_TYPE;
 
+    /// A null repartition_func selects the bucket-table scatter, see doBucketRepartition.
+    /// Fills context.selector and context.start_points, reusing the context buffers.
+    static void doRepartition(
+        size_t partition_num,
+        const Chunk & chunk,
+        const Block & header,
+        const ColumnNumbers & repartition_keys,
+        ExecutableFunctionPtr repartition_func,
+        const DataTypePtr & result_type,
+        ScatterContext & context);
+
     static std::pair<IColumn::Selector, PartitionStartPoints> doRepartition(
         size_t partition_num,
         const Chunk & chunk,
@@ -63,6 +91,16 @@ public:
         ExecutableFunctionPtr repartition_func,
         const DataTypePtr & result_type);
 
+    /// Scatter rows the same way clustered parts of a CNCH bucket table are scattered: the
+    /// chained SipHash of the repartition keys (see createColumnWithSipHash) modulo partition_num.
+    /// Parts of bucket b are assigned to worker b % worker_num, so whenever the bucket number is
+    /// a multiple of worker_num every row is sent to the worker which already holds its bucket.
+    static void
+    doBucketRepartition(size_t partition_num, const Chunk & chunk, const ColumnNumbers & repartition_keys, ScatterContext & context);
+
+    static std::pair<IColumn::Selector, PartitionStartPoints>
+    doBucketRepartition(size_t partition_num, const Chunk & chunk, const ColumnNumbers & repartition_keys);
+
     static ExecutableFunctionPtr getDefaultRepartitionFunction(const ColumnsWithTypeAndName & arguments, ContextPtr context);
 
 protected:
@@ -72,6 +110,7 @@ private:
     size_t partition_num;
     ColumnNumbers repartition_keys;
     ExecutableFunctionPtr repartition_func;
+    ScatterContext scatter_context;
     Poco::Logger * logger;
 };
 
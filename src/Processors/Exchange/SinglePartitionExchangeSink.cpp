@@ -48,7 +48,7 @@ SinglePartitionExchangeSink::SinglePartitionExchangeSink(
     , partition_id(partition_id_)
     , column_num(header.columns())
     , options(options_)
-    , buffered_sender(header, sender, options.send_threshold_in_bytes, options.send_threshold_in_row_num)
+    , buffered_sender(header, sender, options.send_threshold_in_bytes, options.send_threshold_in_row_num, options.send_max_hold_ms)
     , logger(&Poco::Logger::get("SinglePartitionExchangeSink"))
 {
 }
@@ -0,0 +1,27 @@
+#include <Processors/Executors/CoreArbiter.h>
+
+#include <algorithm>
+#include <Common/getNumberOfPhysicalCPUCores.h>
+
+namespace DB
+{
+
+CoreArbiter & CoreArbiter::instance()
+{
+    static CoreArbiter arbiter;
+    return arbiter;
+}
+
+CoreArbiter::CoreArbiter()
+    : num_cores(getNumberOfPhysicalCPUCores())
+{
+}
+
+bool CoreArbiter::shouldPark(size_t lane_index) const
+{
+    Int64 executors = running_executors.load(std::memory_order_relaxed);
+    size_t fair_share = std::max<size_t>(1, num_cores / std::max<Int64>(1, executors));
+    return lane_index >= fair_share;
+}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <common/types.h>
+
+namespace DB
+{
+
+/** Worker-wide arbiter that divides the host's cores between concurrently running
+  * pipeline executors.
+  *
+  * Every multi-threaded executor registers for the duration of its run. Each execution
+  * lane asks at chunk boundaries whether its index is above the executor's current fair
+  * share of cores (cores / running executors); if so, the lane parks until the host
+  * drains. Lane 0 never parks, so every query keeps making progress, and a lane that
+  * parked while the box was busy resumes automatically once other queries finish —
+  * long queries absorb freed cores without restarting their pipelines.
+  *
+  * The arbiter only throttles lanes that already exist: a query can never exceed the
+  * max_threads it started with, because executor task queues are sized at initialization.
+  */
+class CoreArbiter
+{
+public:
+    static CoreArbiter & instance();
+
+    void registerExecutor() { running_executors.fetch_add(1, std::memory_order_relaxed); }
+    void unregisterExecutor() { running_executors.fetch_sub(1, std::memory_order_relaxed); }
+
+    /// Whether the lane with this index is above the current fair share and should park.
+    bool shouldPark(size_t lane_index) const;
+
+private:
+    CoreArbiter();
+
+    const size_t num_cores;
+    std::atomic<Int64> running_executors{0};
+};
+
+}
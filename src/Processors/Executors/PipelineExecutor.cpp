@@ -19,7 +19,9 @@
  * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
  */
 
+#include <chrono>
 #include <queue>
+#include <thread>
 #include <IO/WriteBufferFromString.h>
 #include <IO/WriteBufferFromFile.h>
 #include <Processors/printPipeline.h>
@@ -27,6 +29,7 @@
 #include <Common/CurrentThread.h>
 #include <Common/setThreadName.h>
 #include <Common/MemoryTracker.h>
+#include <Processors/Executors/CoreArbiter.h>
 #include <Processors/Executors/PipelineExecutor.h>
 
 #include <Processors/printPipeline.h>
@@ -37,6 +40,7 @@
 #include <Interpreters/ProcessList.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/OpenTelemetrySpanLog.h>
+#include <ResourceGroup/IResourceGroup.h>
 #include <Interpreters/ProcessorsProfileLog.h>
 #include <Protos/plan_segment_manager.pb.h>
 #include <common/scope_guard_safe.h>
@@ -82,6 +86,8 @@ PipelineExecutor::PipelineExecutor(Processors & processors_, QueryStatus * elem,
     {
         report_processors_profile = process_list_element->getContext()->getSettingsRef().report_processors_profiles;
         need_processors_profiles = process_list_element->getContext()->getSettingsRef().log_processors_profiles || report_processors_profile;
+        resource_group = process_list_element->getContext()->tryGetResourceGroup();
+        elastic_parallelism = process_list_element->getContext()->getSettingsRef().enable_elastic_pipeline_parallelism;
     }
 
     try
@@ -351,12 +357,16 @@ bool PipelineExecutor::prepareProcessor(UInt64 pid, size_t thread_number, Queue
             case IProcessor::Status::Ready:
             {
                 node.status = ExecutingGraph::ExecStatus::Executing;
+                if (need_processors_profiles)
+                    node.processor->scheduling_wait_watch.restart();
                 queue.push(&node);
                 break;
             }
             case IProcessor::Status::Async:
             {
                 node.status = ExecutingGraph::ExecStatus::Executing;
+                if (need_processors_profiles)
+                    node.processor->scheduling_wait_watch.restart();
                 async_queue.push(&node);
                 break;
             }
@@ -511,6 +521,7 @@ void collectProfileMetricRequest(
     request.set_elapsed_us(processor->getElapsedUs());
     request.set_input_wait_elapsed_us(processor->getInputWaitElapsedUs());
     request.set_output_wait_elapsed_us(processor->getOutputWaitElapsedUs());
+    request.set_scheduling_wait_elapsed_us(processor->getSchedulingWaitElapsedUs());
 
     auto stats = processor->getProcessorDataStats();
     request.set_input_rows(stats.input_rows);
@@ -887,6 +898,10 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
 
             addJob(node);
 
+            /// Time spent in the ready queue before an executor thread picked the task up.
+            if (need_processors_profiles)
+                node->processor->scheduling_wait_elapsed_us += node->processor->scheduling_wait_watch.elapsedMicroseconds();
+
             {
                 std::optional<Stopwatch> execution_time_watch;
 #ifndef NDEBUG
@@ -991,6 +1006,46 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
             /// We have executed single processor. Check if we need to yield execution.
             if (yield_flag && *yield_flag)
                 yield = true;
+
+            /// Cooperative preemption: while our resource group is asked to yield to a
+            /// higher-priority group, donate the core for a moment. A running query cannot
+            /// be requeued here, but pausing between processors is enough to let the
+            /// starved group's threads get scheduled.
+            if (resource_group && resource_group->shouldYield())
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            /// Elastic parallelism: lanes above the query's current fair share of cores
+            /// park here until other queries drain; lane 0 never parks, so the query
+            /// always makes progress. Parking between processors keeps chunks intact.
+            if (elastic_parallelism && thread_num > 0 && CoreArbiter::instance().shouldPark(thread_num))
+            {
+                /// Hand the claimed local task back to the stealable queue before parking:
+                /// it may be the query's only runnable node, and a parked lane must not
+                /// hold it hostage for the duration of the park.
+                if (node)
+                {
+                    std::unique_lock lock(task_queue_mutex);
+                    task_queue.push(node, thread_num);
+                    node = nullptr;
+
+                    if (!threads_queue.empty() && !finished)
+                    {
+                        auto thread_to_wake = task_queue.getAnyThreadWithTasks(thread_num + 1 == num_threads ? 0 : (thread_num + 1));
+
+                        if (threads_queue.has(thread_to_wake))
+                            threads_queue.pop(thread_to_wake);
+                        else
+                            thread_to_wake = threads_queue.popAny();
+
+                        lock.unlock();
+
+                        wakeUpExecutor(thread_to_wake);
+                    }
+                }
+
+                while (!finished && CoreArbiter::instance().shouldPark(thread_num))
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
         }
     }
 
@@ -1055,6 +1110,16 @@ void PipelineExecutor::executeImpl(size_t num_threads)
 
     initializeExecution(num_threads);
 
+    /// Multi-threaded executors register with the core arbiter for the duration of the
+    /// run, so elastic queries see the worker-wide fair share of cores.
+    bool counted_by_arbiter = num_threads > 1;
+    if (counted_by_arbiter)
+        CoreArbiter::instance().registerExecutor();
+    SCOPE_EXIT_SAFE(
+        if (counted_by_arbiter)
+            CoreArbiter::instance().unregisterExecutor();
+    );
+
     using ThreadsData = std::vector<ThreadFromGlobalPool>;
     ThreadsData threads;
     threads.reserve(num_threads);
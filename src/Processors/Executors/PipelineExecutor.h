@@ -38,6 +38,7 @@ namespace DB
 {
 
 class QueryStatus;
+class IResourceGroup;
 class ExecutingGraph;
 class ReadProgressCallback;
 using ExecutingGraphPtr = std::unique_ptr<ExecutingGraph>;
@@ -188,6 +189,12 @@ private:
     /// Now it's used to check if query was killed.
     QueryStatus * process_list_element = nullptr;
 
+    /// Resource group the query runs in, used to yield cores to higher-priority groups.
+    IResourceGroup * resource_group = nullptr;
+
+    /// Park execution lanes above the worker-wide fair share of cores (see CoreArbiter).
+    bool elastic_parallelism = false;
+
     /// Graph related methods.
     bool expandPipeline(Stack & stack, UInt64 pid);
 
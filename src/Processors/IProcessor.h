@@ -324,6 +324,7 @@ public:
     uint64_t getElapsedUs() const { return elapsed_us; }
     uint64_t getInputWaitElapsedUs() const { return input_wait_elapsed_us; }
     uint64_t getOutputWaitElapsedUs() const { return output_wait_elapsed_us; }
+    uint64_t getSchedulingWaitElapsedUs() const { return scheduling_wait_elapsed_us; }
     uint32_t getWorkCount() const { return work_count; }
     int64_t getStepId() const { return step_id; }
     void setStepId(int64_t step_id_) { step_id = step_id_; }
@@ -374,6 +375,10 @@ private:
     uint64_t input_wait_elapsed_us = 0;
     Stopwatch output_wait_watch;
     uint64_t output_wait_elapsed_us = 0;
+    /// Time between Status::Ready/Async and the executor actually running the job,
+    /// i.e. how long the processor waited for a free executor thread.
+    Stopwatch scheduling_wait_watch;
+    uint64_t scheduling_wait_elapsed_us = 0;
     /// the number of times of calling work()
     uint32_t work_count = 0;
     int64_t step_id = -1 ;
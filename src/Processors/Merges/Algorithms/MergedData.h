@@ -61,7 +61,14 @@ public:
         empty_columns.reserve(columns.size());
 
         for (const auto & column : columns)
-            empty_columns.emplace_back(column->cloneEmpty());
+        {
+            auto empty_column = column->cloneEmpty();
+            /// The next chunk will be about the same size as the one being pulled, so reserve
+            /// up front: otherwise every chunk of the merge regrows its columns from zero
+            /// through the same sequence of reallocations.
+            empty_column->reserve(merged_rows);
+            empty_columns.emplace_back(std::move(empty_column));
+        }
 
         empty_columns.swap(columns);
         Chunk chunk(std::move(empty_columns), merged_rows);
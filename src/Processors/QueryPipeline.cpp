@@ -323,7 +323,9 @@ std::unique_ptr<QueryPipeline> QueryPipeline::joinPipelines(
     bool keep_left_read_in_order,
     bool join_parallel_left_right,
     Processors * collected_processors,
-    bool need_build_runtime_filter)
+    bool need_build_runtime_filter,
+    bool right_side_prebuilt,
+    std::function<void()> on_right_side_built)
 {
     left->checkInitializedAndNotCompleted();
     right->checkInitializedAndNotCompleted();
@@ -368,12 +370,26 @@ std::unique_ptr<QueryPipeline> QueryPipeline::joinPipelines(
         if (need_build_runtime_filter)
             finish_counter = std::make_shared<JoiningTransform::FinishCounter>(max_streams);
 
+        /// Several fillers feed the join concurrently, and the build is complete only
+        /// when the last of them finishes; fire the callback exactly once, from that one.
+        std::function<void()> on_last_filler_finished;
+        if (on_right_side_built)
+        {
+            auto remaining_fillers = std::make_shared<std::atomic<size_t>>(max_streams);
+            on_last_filler_finished = [remaining_fillers, callback = std::move(on_right_side_built)]()
+            {
+                if (remaining_fillers->fetch_sub(1) == 1)
+                    callback();
+            };
+        }
+
         auto concurrent_right_filling_transform = [&](OutputPortRawPtrs outports)
         {
             Processors processors;
             for (auto & outport : outports)
             {
-                auto adding_joined = std::make_shared<FillingRightJoinSideTransform>(right->getHeader(), join, finish_counter);
+                auto adding_joined = std::make_shared<FillingRightJoinSideTransform>(
+                    right->getHeader(), join, finish_counter, right_side_prebuilt, on_last_filler_finished);
                 connect(*outport, adding_joined->getInputs().front());
                 processors.emplace_back(adding_joined);
             }
@@ -389,7 +405,8 @@ std::unique_ptr<QueryPipeline> QueryPipeline::joinPipelines(
         if (need_build_runtime_filter)
             finish_counter = std::make_shared<JoiningTransform::FinishCounter>(1);
 
-        auto adding_joined = std::make_shared<FillingRightJoinSideTransform>(right->getHeader(), join, finish_counter);
+        auto adding_joined = std::make_shared<FillingRightJoinSideTransform>(
+            right->getHeader(), join, finish_counter, right_side_prebuilt, std::move(on_right_side_built));
         InputPort * totals_port = nullptr;
         if (right->hasTotals())
             totals_port = adding_joined->addTotalsPort();
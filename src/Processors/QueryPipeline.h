@@ -126,6 +126,9 @@ public:
 
     /// Join two pipelines together using JoinPtr.
     /// If collector is used, it will collect only newly-added processors, but not processors from pipelines.
+    /// If the join was taken from the hash join cache, right_side_prebuilt drains the right
+    /// pipeline without refilling the join; on_right_side_built is called once the right side
+    /// has been fully consumed (used to publish a freshly built join to the cache).
     static std::unique_ptr<QueryPipeline> joinPipelines(
         std::unique_ptr<QueryPipeline> left,
         std::unique_ptr<QueryPipeline> right,
@@ -135,7 +138,9 @@ public:
         bool keep_left_read_in_order,
         bool join_parallel_left_right,
         Processors * collected_processors = nullptr,
-        bool need_build_runtime_filter = false);
+        bool need_build_runtime_filter = false,
+        bool right_side_prebuilt = false,
+        std::function<void()> on_right_side_built = {});
 
     /// Add other pipeline and execute it before current one.
     /// Pipeline must have empty header, it should not generate any chunk.
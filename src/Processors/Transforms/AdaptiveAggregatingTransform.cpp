@@ -0,0 +1,359 @@
+#include <Processors/Transforms/AdaptiveAggregatingTransform.h>
+
+namespace DB
+{
+
+AdaptiveAggregatingTransform::AdaptiveAggregatingTransform(
+    Block header, AggregatingTransformParamsPtr params_, size_t sample_chunks_, size_t res_block_size_)
+    : IProcessor({std::move(header)}, {params_->getCustomHeader(false)})
+    , sample_chunks(sample_chunks_)
+    , res_block_size(res_block_size_)
+    , params(std::move(params_))
+    , many_data(std::make_shared<ManyAggregatedData>(1))
+    , variants(*many_data->variants[0])
+    , raw_key_columns(params->params.keys_size)
+    , aggregate_columns(params->params.aggregates_size)
+{
+    res_header = params->getCustomHeader(false);
+}
+
+AdaptiveAggregatingTransform::~AdaptiveAggregatingTransform() = default;
+
+Columns AdaptiveAggregatingTransform::materializeKeyColumns(const Chunk & chunk, Columns & materialized_holder) const
+{
+    Columns key_columns(params->params.keys_size);
+    for (size_t i = 0; i < params->params.keys_size; ++i)
+    {
+        materialized_holder.push_back(chunk.getColumns().at(params->params.keys[i])->convertToFullColumnIfConst());
+        key_columns[i] = materialized_holder.back();
+    }
+    return key_columns;
+}
+
+bool AdaptiveAggregatingTransform::chunkIsOrdered(const Columns & key_columns, size_t rows)
+{
+    auto ordered = [&](const IColumn ** lhs_columns, size_t lhs_row, size_t rhs_row)
+    {
+        for (size_t i = 0; i < key_columns.size(); ++i)
+        {
+            int cmp = lhs_columns[i]->compareAt(lhs_row, rhs_row, *key_columns[i], 1);
+            if (cmp < 0)
+                return true;
+            if (cmp > 0)
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<const IColumn *> raw_columns(key_columns.size());
+    for (size_t i = 0; i < key_columns.size(); ++i)
+        raw_columns[i] = key_columns[i].get();
+
+    bool is_ordered = true;
+    if (!sample_last_key.empty())
+    {
+        std::vector<const IColumn *> last_key_raw(sample_last_key.size());
+        for (size_t i = 0; i < sample_last_key.size(); ++i)
+            last_key_raw[i] = sample_last_key[i].get();
+        is_ordered = ordered(last_key_raw.data(), 0, 0);
+    }
+
+    for (size_t row = 1; is_ordered && row < rows; ++row)
+        is_ordered = ordered(raw_columns.data(), row - 1, row);
+
+    if (is_ordered)
+    {
+        sample_last_key.clear();
+        for (const auto & column : key_columns)
+        {
+            auto last_key_column = column->cloneEmpty();
+            last_key_column->insertFrom(*column, rows - 1);
+            sample_last_key.emplace_back(std::move(last_key_column));
+        }
+    }
+    return is_ordered;
+}
+
+int AdaptiveAggregatingTransform::compareWithCurrentKey(const Columns & key_columns, size_t row) const
+{
+    for (size_t i = 0; i < key_columns.size(); ++i)
+    {
+        int cmp = res_key_columns[i]->compareAt(res_key_columns[i]->size() - 1, row, *key_columns[i], 1);
+        if (cmp != 0)
+            return cmp;
+    }
+    return 0;
+}
+
+void AdaptiveAggregatingTransform::consume(Chunk chunk)
+{
+    block_end_reached = false;
+
+    size_t rows = chunk.getNumRows();
+    if (rows == 0)
+        return;
+
+    src_rows += rows;
+    src_bytes += chunk.bytes();
+
+    if (mode == Mode::Sampling)
+    {
+        Columns materialized_holder;
+        Columns key_columns = materializeKeyColumns(chunk, materialized_holder);
+
+        if (!chunkIsOrdered(key_columns, rows))
+        {
+            LOG_TRACE(log, "Input is not ordered by the grouping keys, keeping hash aggregation");
+            mode = Mode::Hash;
+        }
+        else if (++sampled_chunks >= sample_chunks)
+        {
+            LOG_TRACE(log, "First {} chunks are ordered by the grouping keys, switching to in-order aggregation", sampled_chunks);
+            mode = Mode::InOrder;
+        }
+
+        /// Sampled chunks always go to the hash table: the decision affects only the rest of the stream.
+        consumeForHash(std::move(chunk));
+        return;
+    }
+
+    if (mode == Mode::Hash)
+    {
+        consumeForHash(std::move(chunk));
+        return;
+    }
+
+    consumeInOrder(std::move(chunk));
+}
+
+void AdaptiveAggregatingTransform::consumeForHash(Chunk chunk)
+{
+    const UInt64 num_rows = chunk.getNumRows();
+    if (!params->aggregator.executeOnBlock(chunk.detachColumns(), num_rows, variants, raw_key_columns, aggregate_columns, no_more_keys))
+        is_consume_finished = true;
+}
+
+void AdaptiveAggregatingTransform::consumeInOrder(Chunk chunk)
+{
+    size_t rows = chunk.getNumRows();
+
+    Columns materialized_columns;
+    Columns key_columns = materializeKeyColumns(chunk, materialized_columns);
+
+    Aggregator::NestedColumnsHolder nested_columns_holder;
+    Aggregator::AggregateFunctionInstructions aggregate_function_instructions;
+    params->aggregator.prepareAggregateInstructions(
+        chunk.getColumns(), aggregate_columns, materialized_columns, aggregate_function_instructions, nested_columns_holder);
+
+    size_t key_begin = 0;
+
+    /// If we don't have a block we create it and fill with first key
+    if (!cur_block_size)
+    {
+        res_key_columns.resize(params->params.keys_size);
+        res_aggregate_columns.resize(params->params.aggregates_size);
+
+        for (size_t i = 0; i < params->params.keys_size; ++i)
+            res_key_columns[i] = res_header.safeGetByPosition(i).type->createColumn();
+
+        for (size_t i = 0; i < params->params.aggregates_size; ++i)
+            res_aggregate_columns[i] = res_header.safeGetByPosition(i + params->params.keys_size).type->createColumn();
+
+        params->aggregator.createStatesAndFillKeyColumnsWithSingleKey(variants, key_columns, key_begin, res_key_columns);
+        params->aggregator.addArenasToAggregateColumns(variants, res_aggregate_columns);
+        ++cur_block_size;
+    }
+
+    /// Will split the chunk into segments with the same key by a linear scan that also
+    /// verifies the order still holds. upper_bound as in AggregatingInOrderTransform is not
+    /// applicable here because it silently mis-splits unsorted data.
+    while (key_begin != rows)
+    {
+        size_t key_end = key_begin;
+        bool violation = false;
+        for (; key_end != rows; ++key_end)
+        {
+            int cmp = compareWithCurrentKey(key_columns, key_end);
+            if (cmp == 0)
+                continue;
+            violation = (cmp > 0); /// current key > row: the input stopped being ordered
+            break;
+        }
+
+        /// Add data to aggr. state if interval is not empty. Empty when haven't found current key in new chunk.
+        if (key_begin != key_end)
+            params->aggregator.executeOnIntervalWithoutKeyImpl(
+                variants.without_key, key_begin, key_end, aggregate_function_instructions.data(), variants.aggregates_pool);
+
+        if (violation)
+        {
+            LOG_TRACE(log, "Order of the grouping keys was violated after {} rows, falling back to hash aggregation", src_rows);
+
+            params->aggregator.addSingleKeyToAggregateColumns(variants, res_aggregate_columns);
+            variants.without_key = nullptr;
+
+            Columns source_columns = chunk.detachColumns();
+            for (auto & source_column : source_columns)
+                source_column = source_column->cut(key_end, rows - key_end);
+
+            current_chunk = Chunk(source_columns, rows - key_end);
+            src_rows -= current_chunk.getNumRows();
+            block_end_reached = true;
+            need_generate = true;
+            cur_block_size = 0;
+            mode = Mode::Hash;
+            return;
+        }
+
+        /// We finalize last key aggregation state if a new key found.
+        if (key_end != rows)
+        {
+            params->aggregator.addSingleKeyToAggregateColumns(variants, res_aggregate_columns);
+
+            /// If res_block_size is reached we have to stop consuming and generate the block. Save the extra rows into new chunk.
+            if (cur_block_size == res_block_size)
+            {
+                Columns source_columns = chunk.detachColumns();
+                for (auto & source_column : source_columns)
+                    source_column = source_column->cut(key_end, rows - key_end);
+
+                current_chunk = Chunk(source_columns, rows - key_end);
+                src_rows -= current_chunk.getNumRows();
+                block_end_reached = true;
+                need_generate = true;
+                cur_block_size = 0;
+                variants.without_key = nullptr;
+                return;
+            }
+
+            /// We create a new state for the new key and update res_key_columns
+            params->aggregator.createStatesAndFillKeyColumnsWithSingleKey(variants, key_columns, key_end, res_key_columns);
+            ++cur_block_size;
+        }
+
+        key_begin = key_end;
+    }
+}
+
+void AdaptiveAggregatingTransform::work()
+{
+    if (is_consume_finished)
+        finishConsume();
+    else if (need_generate)
+        generate();
+    else
+        consume(std::move(current_chunk));
+}
+
+IProcessor::Status AdaptiveAggregatingTransform::prepare()
+{
+    auto & output = outputs.front();
+    auto & input = inputs.back();
+
+    /// Check can output.
+    if (output.isFinished())
+    {
+        input.close();
+        return Status::Finished;
+    }
+
+    if (!output.canPush())
+    {
+        input.setNotNeeded();
+        return Status::PortFull;
+    }
+
+    if (block_end_reached)
+    {
+        if (need_generate)
+            return Status::Ready;
+
+        output.push(std::move(to_push_chunk));
+        return Status::Ready;
+    }
+
+    if (is_consume_finished)
+    {
+        if (!is_finish_converted)
+            return Status::Ready;
+
+        if (!pending_chunks.empty())
+        {
+            output.push(std::move(pending_chunks.front()));
+            pending_chunks.pop_front();
+            return Status::PortFull;
+        }
+
+        output.finish();
+        LOG_DEBUG(log, "Aggregated. {} to {} rows (from {})", src_rows, res_rows, formatReadableSizeWithBinarySuffix(src_bytes));
+        return Status::Finished;
+    }
+
+    if (input.isFinished())
+    {
+        is_consume_finished = true;
+        return Status::Ready;
+    }
+
+    if (!input.hasData())
+    {
+        input.setNeeded();
+        return Status::NeedData;
+    }
+
+    current_chunk = input.pull(true /* set_not_needed */);
+    return Status::Ready;
+}
+
+void AdaptiveAggregatingTransform::generate()
+{
+    Block res = res_header.cloneEmpty();
+
+    for (size_t i = 0; i < res_key_columns.size(); ++i)
+        res.getByPosition(i).column = std::move(res_key_columns[i]);
+    for (size_t i = 0; i < res_aggregate_columns.size(); ++i)
+        res.getByPosition(i + res_key_columns.size()).column = std::move(res_aggregate_columns[i]);
+
+    to_push_chunk = convertToChunk(res);
+    res_rows += to_push_chunk.getNumRows();
+    need_generate = false;
+}
+
+void AdaptiveAggregatingTransform::finishConsume()
+{
+    if (is_finish_converted)
+        return;
+    is_finish_converted = true;
+
+    /// Close the open group of the in-order side.
+    if (cur_block_size)
+    {
+        params->aggregator.addSingleKeyToAggregateColumns(variants, res_aggregate_columns);
+        variants.without_key = nullptr;
+
+        Block res = res_header.cloneEmpty();
+        for (size_t i = 0; i < res_key_columns.size(); ++i)
+            res.getByPosition(i).column = std::move(res_key_columns[i]);
+        for (size_t i = 0; i < res_aggregate_columns.size(); ++i)
+            res.getByPosition(i + res_key_columns.size()).column = std::move(res_aggregate_columns[i]);
+
+        res_rows += res.rows();
+        pending_chunks.emplace_back(convertToChunk(res));
+        cur_block_size = 0;
+    }
+
+    /// Convert the hash table holding the sampled prefix and/or the fallback data.
+    if (!variants.empty())
+    {
+        auto blocks = params->aggregator.convertToBlocks(variants, false /* final */, 1 /* max_threads */);
+        for (auto & block : blocks)
+        {
+            if (!block.rows())
+                continue;
+            res_rows += block.rows();
+            pending_chunks.emplace_back(convertToChunk(block));
+        }
+    }
+}
+
+}
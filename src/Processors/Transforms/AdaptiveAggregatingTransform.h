@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Interpreters/Aggregator.h>
+#include <Processors/IProcessor.h>
+#include <Processors/Transforms/AggregatingTransform.h>
+
+#include <deque>
+
+namespace DB
+{
+
+/** Partial aggregation that detects at runtime whether the input already arrives ordered by
+  * the grouping keys and, if so, switches from hash aggregation to the streaming
+  * comparison-based aggregation AggregatingInOrderTransform uses when the planner can prove
+  * the order. The first sample_chunks chunks are checked for key monotonicity while being fed
+  * to the hash table; once the sample passes, subsequent chunks are aggregated by group
+  * boundaries with a single open group and emitted as they complete. An order violation after
+  * the switch closes the open group and permanently falls back to the hash table.
+  *
+  * Both sides emit partially aggregated states, so a key that lands on both of them is merged
+  * by the downstream merging aggregation; therefore this transform must only be used for
+  * non-final aggregation.
+  */
+class AdaptiveAggregatingTransform : public IProcessor
+{
+public:
+    AdaptiveAggregatingTransform(Block header, AggregatingTransformParamsPtr params_, size_t sample_chunks_, size_t res_block_size_);
+    ~AdaptiveAggregatingTransform() override;
+
+    String getName() const override { return "AdaptiveAggregatingTransform"; }
+
+    Status prepare() override;
+    void work() override;
+
+private:
+    enum class Mode
+    {
+        Sampling,   /// feeding the hash table while checking the input order
+        InOrder,    /// streaming group-boundary aggregation
+        Hash        /// ordinary hash aggregation
+    };
+
+    void consume(Chunk chunk);
+    void consumeForHash(Chunk chunk);
+    void consumeInOrder(Chunk chunk);
+    void generate();
+    void finishConsume();
+
+    Columns materializeKeyColumns(const Chunk & chunk, Columns & materialized_holder) const;
+    bool chunkIsOrdered(const Columns & key_columns, size_t rows);
+    int compareWithCurrentKey(const Columns & key_columns, size_t row) const;
+
+    Mode mode = Mode::Sampling;
+    size_t sample_chunks;
+    size_t sampled_chunks = 0;
+
+    size_t res_block_size;
+    size_t cur_block_size = 0;
+
+    AggregatingTransformParamsPtr params;
+    Block res_header;
+
+    /// Hash side, also holds the arena and the open-group state of the in-order side.
+    ManyAggregatedDataPtr many_data;
+    AggregatedDataVariants & variants;
+    ColumnRawPtrs raw_key_columns;
+    Aggregator::AggregateColumns aggregate_columns;
+    bool no_more_keys = false;
+
+    /// In-order side: result block under construction.
+    MutableColumns res_key_columns;
+    MutableColumns res_aggregate_columns;
+
+    /// Last key of the previous chunk seen while sampling.
+    MutableColumns sample_last_key;
+
+    UInt64 src_rows = 0;
+    UInt64 src_bytes = 0;
+    UInt64 res_rows = 0;
+
+    bool need_generate = false;
+    bool block_end_reached = false;
+    bool is_consume_finished = false;
+    bool is_finish_converted = false;
+
+    Chunk current_chunk;
+    Chunk to_push_chunk;
+    std::deque<Chunk> pending_chunks;
+
+    Poco::Logger * log = &Poco::Logger::get("AdaptiveAggregatingTransform");
+};
+
+}
@@ -0,0 +1,187 @@
+#include <Processors/Transforms/BufferTransform.h>
+
+#include <Compression/CompressedWriteBuffer.h>
+#include <DataStreams/NativeBlockOutputStream.h>
+#include <DataStreams/TemporaryFileStream.h>
+#include <Disks/IVolume.h>
+#include <IO/WriteBufferFromFile.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int NOT_ENOUGH_SPACE;
+}
+
+struct BufferTransform::SpillWriter
+{
+    WriteBufferFromFile file_out;
+    CompressedWriteBuffer compressed_out;
+    NativeBlockOutputStream block_out;
+
+    SpillWriter(const std::string & path, const Block & header_)
+        : file_out(path), compressed_out(file_out), block_out(compressed_out, 0, header_)
+    {
+        block_out.writePrefix();
+    }
+
+    void finalize()
+    {
+        block_out.writeSuffix();
+        compressed_out.finalize();
+    }
+};
+
+BufferTransform::~BufferTransform() = default;
+
+IProcessor::Status BufferTransform::prepare()
+{
+    auto & input = inputs.front();
+    auto & output = outputs.front();
+
+    /// A pulled chunk is waiting for work() to append it to the spill file.
+    if (has_chunk_to_spill)
+        return Status::Ready;
+
+    if (input.hasData())
+    {
+        if (spill_stage == SpillStage::WRITING)
+        {
+            chunk_to_spill = input.pull();
+            has_chunk_to_spill = true;
+            ++input_chunk_count;
+            return Status::Ready;
+        }
+
+        if (output_queue.size() >= max_queue_size)
+            return Status::PortFull;
+        auto chunk = input.pull();
+        ++input_chunk_count;
+        queue_bytes += chunk.allocatedBytes();
+        output_queue.push_back(std::move(chunk));
+        max_used_queue_size = std::max(max_used_queue_size, output_queue.size());
+
+        /// The in-memory part is full: route every subsequent chunk through the spill file.
+        /// The queue keeps draining to the consumer meanwhile, and since no chunk newer than
+        /// the spilled ones can bypass the file, FIFO order is preserved.
+        if (max_bytes_in_memory && tmp_volume && queue_bytes > max_bytes_in_memory)
+            spill_stage = SpillStage::WRITING;
+    }
+
+    if (output.canPush())
+    {
+        if (!output_queue.empty())
+        {
+            queue_bytes -= output_queue.front().allocatedBytes();
+            output.push(std::move(output_queue.front()));
+            output_queue.pop_front();
+        }
+        else if (has_chunk_from_spill)
+        {
+            output.push(std::move(chunk_from_spill));
+            has_chunk_from_spill = false;
+        }
+        else if (spill_stage != SpillStage::NONE && input.isFinished())
+        {
+            /// Input is done and the memory part is drained: finalize the writer and stream
+            /// the file back (both happen in work()).
+            if (!spill_exhausted)
+                return Status::Ready;
+            output.finish();
+        }
+        else if (input.isFinished())
+        {
+            output.finish();
+        }
+    }
+
+    input.setNeeded();
+
+    if (input.isFinished() && output.isFinished())
+    {
+        LOG_DEBUG(
+            &Poco::Logger::get("BufferTransform"),
+            "max_used_queue_size:{}/{}, spilled:[chunks:{} bytes:{}], input:[rows:{} bytes:{}], output:[rows:{} bytes:{}]",
+            max_used_queue_size,
+            input_chunk_count,
+            spilled_chunks,
+            spilled_bytes,
+            input.getRows(),
+            input.getBytes(),
+            output.getRows(),
+            output.getBytes());
+        return Status::Finished;
+    }
+    else if (input.isFinished())
+    {
+        return Status::PortFull;
+    }
+    else
+    {
+        return Status::NeedData;
+    }
+}
+
+void BufferTransform::work()
+{
+    if (has_chunk_to_spill)
+        spillChunkToFile();
+    else
+        readChunkFromFile();
+}
+
+void BufferTransform::spillChunkToFile()
+{
+    if (!spill_writer)
+    {
+        size_t size = max_bytes_in_memory + min_free_disk_space;
+        auto reservation = tmp_volume->reserve(size);
+        if (!reservation)
+            throw Exception("Not enough space for CTE buffer spill in temporary storage", ErrorCodes::NOT_ENOUGH_SPACE);
+
+        spill_file = createTemporaryFile(reservation->getDisk()->getPath());
+        spill_writer = std::make_unique<SpillWriter>(spill_file->path(), header);
+    }
+
+    spilled_bytes += chunk_to_spill.allocatedBytes();
+    ++spilled_chunks;
+    spill_writer->block_out.write(header.cloneWithColumns(chunk_to_spill.detachColumns()));
+    has_chunk_to_spill = false;
+}
+
+void BufferTransform::readChunkFromFile()
+{
+    if (spill_writer)
+    {
+        spill_writer->finalize();
+        spill_writer.reset();
+        spill_stage = SpillStage::READING;
+    }
+
+    if (!spill_file)
+    {
+        /// Spilling was triggered but the threshold chunk never arrived (input finished first).
+        spill_exhausted = true;
+        return;
+    }
+
+    if (!spill_in)
+        spill_in = std::make_unique<TemporaryFileStream>(spill_file->path(), header);
+
+    Block block = spill_in->block_in->read();
+    if (block)
+    {
+        chunk_from_spill = Chunk(block.getColumns(), block.rows());
+        has_chunk_from_spill = true;
+    }
+    else
+    {
+        spill_exhausted = true;
+        spill_in.reset();
+        spill_file.reset();
+    }
+}
+
+}
@@ -1,79 +1,87 @@
 #pragma once
 #include <list>
 #include <Processors/IProcessor.h>
+#include <Common/filesystemHelpers.h>
 
 namespace DB
 {
 
+class IVolume;
+using VolumePtr = std::shared_ptr<IVolume>;
+
+struct TemporaryFileStream;
+
+/// Unbounded FIFO buffer decoupling a fast producer from a slow consumer; inserted by
+/// AddBufferForDeadlockCTE between a shared CTE and its lagging consumers. When constructed
+/// with a byte threshold and a temporary volume, the tail of the buffer is spilled to a
+/// compressed temporary file once the in-memory part exceeds the threshold, and is streamed
+/// back to the consumer after the input is exhausted; chunk order is preserved because from
+/// the first spilled chunk on all input goes through the file.
 class BufferTransform : public IProcessor
 {
 public:
-    BufferTransform(const Block & header, size_t max_queue_size_ = std::numeric_limits<size_t>::max())
-        : IProcessor(InputPorts(1, header), OutputPorts(1, header)), max_queue_size(max_queue_size_)
+    explicit BufferTransform(const Block & header_, size_t max_queue_size_ = std::numeric_limits<size_t>::max())
+        : IProcessor(InputPorts(1, header_), OutputPorts(1, header_)), header(header_), max_queue_size(max_queue_size_)
     {
     }
 
-    String getName() const override
+    BufferTransform(const Block & header_, size_t max_bytes_in_memory_, VolumePtr tmp_volume_, size_t min_free_disk_space_)
+        : IProcessor(InputPorts(1, header_), OutputPorts(1, header_))
+        , header(header_)
+        , max_queue_size(std::numeric_limits<size_t>::max())
+        , max_bytes_in_memory(max_bytes_in_memory_)
+        , tmp_volume(std::move(tmp_volume_))
+        , min_free_disk_space(min_free_disk_space_)
     {
-        return "Buffer";
     }
-    Status prepare() override
-    {
-        auto & input = inputs.front();
-        auto & output = outputs.front();
 
-        if (input.hasData())
-        {
-            if (output_queue.size() >= max_queue_size)
-                return Status::PortFull;
-            output_queue.push_back(input.pull());
-            max_used_queue_size = std::max(max_used_queue_size, output_queue.size());
-            ++input_chunk_count;
-        }
+    ~BufferTransform() override;
 
-        if (output.canPush())
-        {
-            if (output_queue.empty() && input.isFinished())
-            {
-                output.finish();
-            }
-            else if (!output_queue.empty())
-            {
-                output.push(std::move(output_queue.front()));
-                output_queue.pop_front();
-            }
-        }
-
-        input.setNeeded();
-
-        if (input.isFinished() && output.isFinished())
-        {
-            LOG_DEBUG(
-                &Poco::Logger::get("BufferTransform"),
-                "max_used_queue_size:{}/{}, input:[rows:{} bytes:{}], output:[rows:{} bytes:{}]",
-                max_used_queue_size,
-                input_chunk_count,
-                input.getRows(),
-                input.getBytes(),
-                output.getRows(),
-                output.getBytes());
-            return Status::Finished;
-        }
-        else if (input.isFinished())
-        {
-            return Status::PortFull;
-        }
-        else
-        {
-            return Status::NeedData;
-        }
+    String getName() const override
+    {
+        return "Buffer";
     }
 
+    Status prepare() override;
+    void work() override;
+
 private:
+    void spillChunkToFile();
+    void readChunkFromFile();
+
+    Block header;
     size_t max_queue_size;
+    /// Spill the tail of the buffer to disk above this many in-memory bytes; 0 - never spill.
+    size_t max_bytes_in_memory = 0;
+    VolumePtr tmp_volume;
+    size_t min_free_disk_space = 0;
+
+    std::list<Chunk> output_queue;
+    size_t queue_bytes = 0;
     size_t max_used_queue_size = 0;
     size_t input_chunk_count = 0;
-    std::list<Chunk> output_queue;
+
+    enum class SpillStage
+    {
+        NONE,     /// everything fits into output_queue
+        WRITING,  /// the threshold was exceeded, input chunks go to the spill file
+        READING,  /// input is done and output_queue is drained, chunks come from the file
+    };
+    SpillStage spill_stage = SpillStage::NONE;
+
+    Chunk chunk_to_spill;
+    bool has_chunk_to_spill = false;
+    Chunk chunk_from_spill;
+    bool has_chunk_from_spill = false;
+    bool spill_exhausted = false;
+
+    std::unique_ptr<TemporaryFile> spill_file;
+    /// Owns the file buffer, the compression buffer and the native stream of the write side.
+    struct SpillWriter;
+    std::unique_ptr<SpillWriter> spill_writer;
+    std::unique_ptr<TemporaryFileStream> spill_in;
+    size_t spilled_chunks = 0;
+    size_t spilled_bytes = 0;
 };
 
 }
@@ -199,6 +199,7 @@ void ExplainAnalyzeTransform::getRemoteProcessorProfiles(std::unordered_map<size
         profile->elapsed_us = profile_log.elapsed_us;
         profile->input_wait_elapsed_us = profile_log.input_wait_elapsed_us;
         profile->output_wait_elapsed_us = profile_log.output_wait_elapsed_us;
+        profile->scheduling_wait_elapsed_us = profile_log.scheduling_wait_elapsed_us;
         profile->input_rows = profile_log.input_rows;
         profile->input_bytes = profile_log.input_bytes;
         profile->output_rows = profile_log.output_rows;
@@ -240,6 +241,7 @@ void ExplainAnalyzeTransform::getProcessorProfiles(ProcessorsSet & processors_se
             child->elapsed_us = from->getElapsedUs();
             child->input_wait_elapsed_us = from->getInputWaitElapsedUs();
             child->output_wait_elapsed_us = from->getOutputWaitElapsedUs();
+            child->scheduling_wait_elapsed_us = from->getSchedulingWaitElapsedUs();
             child->input_rows = from->getProcessorDataStats().input_rows;
             child->input_bytes = from->getProcessorDataStats().input_bytes;
             child->output_rows = from->getProcessorDataStats().output_rows;
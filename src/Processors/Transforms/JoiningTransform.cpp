@@ -350,8 +350,16 @@ JoiningTransform::~JoiningTransform()
 }
 
 FillingRightJoinSideTransform::FillingRightJoinSideTransform(
-    Block input_header, JoinPtr join_, JoiningTransform::FinishCounterPtr finish_counter_)
-    : IProcessor({input_header}, {Block()}), join(std::move(join_)), finish_counter(std::move(finish_counter_))
+    Block input_header,
+    JoinPtr join_,
+    JoiningTransform::FinishCounterPtr finish_counter_,
+    bool discard_input_,
+    std::function<void()> on_build_finished_)
+    : IProcessor({input_header}, {Block()})
+    , join(std::move(join_))
+    , finish_counter(std::move(finish_counter_))
+    , discard_input(discard_input_)
+    , on_build_finished(std::move(on_build_finished_))
 {
     if (dynamic_cast<ConcurrentHashJoin *>(join.get()))
         is_current_hash_join = true;
@@ -436,12 +444,26 @@ IProcessor::Status FillingRightJoinSideTransform::prepare()
         return Status::Ready;
     }
 
+    if (on_build_finished)
+    {
+        on_build_finished();
+        on_build_finished = {};
+    }
+
     output.finish();
     return Status::Finished;
 }
 
 void FillingRightJoinSideTransform::work()
 {
+    /// The join is served from the hash join cache: consume the broadcast input to
+    /// unblock the sender, but leave the prebuilt structure untouched.
+    if (discard_input)
+    {
+        set_totals = for_totals;
+        return;
+    }
+
     if (build_rf)
     {
         join->tryBuildRuntimeFilters();
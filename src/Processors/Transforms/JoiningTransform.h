@@ -135,7 +135,12 @@ private:
 class FillingRightJoinSideTransform : public IProcessor
 {
 public:
-    FillingRightJoinSideTransform(Block input_header, JoinPtr join_, JoiningTransform::FinishCounterPtr finish_counter_ = nullptr);
+    FillingRightJoinSideTransform(
+        Block input_header,
+        JoinPtr join_,
+        JoiningTransform::FinishCounterPtr finish_counter_ = nullptr,
+        bool discard_input_ = false,
+        std::function<void()> on_build_finished_ = {});
     String getName() const override
     {
         if (is_current_hash_join)
@@ -161,6 +166,11 @@ private:
     bool input_finish = false;
     DispatchedColumnsCache dispatched_columns_cache;
     bool is_current_hash_join = false;
+
+    /// The join comes from the hash join cache: drain the input without refilling it.
+    bool discard_input = false;
+    /// Called once when the right side has been fully consumed; used to publish the join.
+    std::function<void()> on_build_finished;
 };
 
 class DelayedBlocksTask : public ChunkInfo
@@ -0,0 +1,37 @@
+#include <Processors/Transforms/StreamInPlanSegmentResultCacheTransform.h>
+
+namespace DB
+{
+
+StreamInPlanSegmentResultCacheTransform::StreamInPlanSegmentResultCacheTransform(
+    const Block & header_, PlanSegmentResultCachePtr cache_, PlanSegmentResultCache::Key key_)
+    : ISimpleTransform(header_, header_, false)
+    , cache(std::move(cache_))
+    , key(key_)
+    , entry(std::make_shared<PlanSegmentResultCache::Entry>())
+{
+}
+
+void StreamInPlanSegmentResultCacheTransform::transform(Chunk & chunk)
+{
+    if (!entry)
+        return;
+
+    buffered_bytes += chunk.allocatedBytes();
+    buffered_rows += chunk.getNumRows();
+    if (!cache->withinEntryLimits(buffered_bytes, buffered_rows))
+    {
+        entry.reset(); /// result too large to cache, stop buffering
+        return;
+    }
+
+    entry->chunks.emplace_back(chunk.clone());
+}
+
+void StreamInPlanSegmentResultCacheTransform::finalizeWriteInCache()
+{
+    if (entry && !isCancelled())
+        cache->trySet(key, std::move(entry));
+}
+
+}
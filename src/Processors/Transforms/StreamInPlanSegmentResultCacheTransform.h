@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Processors/ISimpleTransform.h>
+#include <Interpreters/DistributedStages/PlanSegmentResultCache.h>
+
+namespace DB
+{
+
+/// Buffers the chunks a plan segment produces and stores them in the segment result cache once
+/// the segment finished successfully (finalizeWriteInCache() is only called then, so failed or
+/// cancelled segments never pollute the cache). Buffering is abandoned as soon as the result
+/// exceeds the cache's per-entry limits.
+class StreamInPlanSegmentResultCacheTransform : public ISimpleTransform
+{
+public:
+    StreamInPlanSegmentResultCacheTransform(
+        const Block & header_, PlanSegmentResultCachePtr cache_, PlanSegmentResultCache::Key key_);
+
+protected:
+    void transform(Chunk & chunk) override;
+
+public:
+    void finalizeWriteInCache();
+    String getName() const override { return "StreamInPlanSegmentResultCacheTransform"; }
+
+private:
+    const PlanSegmentResultCachePtr cache;
+    const PlanSegmentResultCache::Key key;
+    PlanSegmentResultCache::EntryPtr entry;
+    size_t buffered_bytes = 0;
+    size_t buffered_rows = 0;
+};
+
+}
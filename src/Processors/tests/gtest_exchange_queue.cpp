@@ -1,3 +1,4 @@
+#include <unistd.h>
 #include <Processors/Exchange/DataTrans/MultiPathBoundedQueue.h>
 #include <gtest/gtest.h>
 #include <Common/tests/gtest_global_context.h>
@@ -6,6 +7,12 @@
 using namespace DB;
 using namespace UnitTest;
 
+static bool eventFdReadable(int fd)
+{
+    UInt64 buf = 0;
+    return ::read(fd, &buf, sizeof(buf)) > 0;
+}
+
 TEST(ExchangeQueueTest, QueueDisable)
 {
     auto memory_controller = std::make_shared<MemoryController>(0);
@@ -55,6 +62,28 @@ TEST(ExchangeQueueTest, QueueEnableWithoutAlternative)
     EXPECT_EQ(memory_controller->size(), 0);
 }
 
+TEST(ExchangeQueueTest, RecvEventFd)
+{
+    auto queue = std::make_shared<MultiPathBoundedQueue>(20, nullptr);
+
+    int fd = queue->getRecvEventFd();
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(queue->getRecvEventFd(), fd);
+    EXPECT_FALSE(eventFdReadable(fd));
+
+    String data = "Hello, world!";
+    ASSERT_TRUE(queue->tryEmplace(10, MultiPathDataPacket(std::move(data))));
+    EXPECT_TRUE(eventFdReadable(fd));
+    EXPECT_FALSE(eventFdReadable(fd));
+
+    MultiPathDataPacket packet;
+    ASSERT_TRUE(queue->tryPop(packet));
+    EXPECT_FALSE(eventFdReadable(fd));
+
+    queue->close();
+    EXPECT_TRUE(eventFdReadable(fd));
+}
+
 TEST(ExchangeQueueTest, QueueEnableWithAlternative)
 {
     auto memory_controller = std::make_shared<MemoryController>(100);
@@ -71,3 +100,34 @@ TEST(ExchangeQueueTest, QueueEnableWithAlternative)
     ASSERT_TRUE(std::holds_alternative<String>(packet));
     EXPECT_EQ(std::get<String>(packet).compare("Hello, world!"), 0);
 }
+
+TEST(ExchangeQueueTest, BatchPushPop)
+{
+    auto memory_controller = std::make_shared<MemoryController>(1000);
+    auto queue = std::make_shared<MultiPathBoundedQueue>(20, memory_controller);
+
+    std::vector<MultiPathDataPacket> batch;
+    for (size_t i = 0; i < 5; ++i)
+        batch.emplace_back(String("packet_" + std::to_string(i)));
+
+    timespec no_timeout{.tv_sec = time(nullptr) + 10, .tv_nsec = 0};
+    ASSERT_TRUE(queue->tryPushBatchUntil(no_timeout, batch));
+    EXPECT_EQ(queue->size(), 5);
+    EXPECT_GT(memory_controller->size(), 0);
+
+    std::vector<MultiPathDataPacket> out;
+    ASSERT_TRUE(queue->tryPopBatch(out, 3, 10));
+    ASSERT_EQ(out.size(), 3);
+    EXPECT_EQ(std::get<String>(out[0]).compare("packet_0"), 0);
+
+    /// tryPopBatch appends, so the second drain completes the same vector.
+    ASSERT_TRUE(queue->tryPopBatch(out, 10, 10));
+    ASSERT_EQ(out.size(), 5);
+    EXPECT_EQ(std::get<String>(out[4]).compare("packet_4"), 0);
+    EXPECT_EQ(memory_controller->size(), 0);
+
+    ASSERT_FALSE(queue->tryPopBatch(out, 1, 10));
+
+    queue->close();
+    ASSERT_FALSE(queue->tryPushBatchUntil(no_timeout, batch));
+}
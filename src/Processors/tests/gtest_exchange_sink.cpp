@@ -17,9 +17,14 @@
 #include <vector>
 #include <gtest/gtest.h>
 
+#include <AggregateFunctions/AggregateFunctionFactory.h>
+#include <Columns/ColumnAggregateFunction.h>
 #include <Columns/ColumnsNumber.h>
 #include <Core/ColumnNumbers.h>
+#include <DataTypes/DataTypeAggregateFunction.h>
 #include <DataTypes/DataTypesNumber.h>
+#include <Common/assert_cast.h>
+#include <Common/tests/gtest_global_register.h>
 #include <Functions/FunctionFactory.h>
 #include <Interpreters/Context.h>
 #include <Processors/Chunk.h>
@@ -273,6 +278,131 @@ TEST(ExchangeSink, MultiPartitionExchangeSinkTest)
     }
 }
 
+TEST(ExchangeSink, MultiPartitionExchangeSinkStateMergeTest)
+{
+    tryRegisterAggregateFunctions();
+    auto context = getContext().context;
+    const size_t distinct_keys = 10;
+    const size_t repeats = 10;
+    const size_t rows = distinct_keys * repeats;
+    const size_t chunk_num = 5;
+
+    auto key_type = std::make_shared<DataTypeUInt64>();
+    AggregateFunctionProperties properties;
+    auto sum_function = AggregateFunctionFactory::instance().get("sum", {key_type}, {}, properties);
+    auto state_type = std::make_shared<DataTypeAggregateFunction>(sum_function, DataTypes{key_type}, Array{});
+
+    /// Every row carries a sum state holding 1, duplicated `repeats` times per key.
+    auto key_column = ColumnUInt64::create();
+    auto state_column = ColumnAggregateFunction::create(sum_function);
+    auto one_column = ColumnUInt64::create();
+    one_column->insert(1UL);
+    const IColumn * add_arguments[] = {one_column.get()};
+    Arena & arena = state_column->createOrGetArena();
+    for (size_t key = 0; key < distinct_keys; ++key)
+    {
+        for (size_t i = 0; i < repeats; ++i)
+        {
+            key_column->insert(key);
+            AggregateDataPtr place = arena.alignedAlloc(sum_function->sizeOfData(), sum_function->alignOfData());
+            sum_function->create(place);
+            sum_function->add(place, add_arguments, 0, &arena);
+            state_column->getData().push_back(place);
+        }
+    }
+
+    Block block{
+        ColumnWithTypeAndName(std::move(key_column), key_type, "key"),
+        ColumnWithTypeAndName(std::move(state_column), state_type, "state")};
+    Block header = block.cloneEmpty();
+
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_nsec += 1000 * 1000000;
+    ExchangeOptions exchange_options {.exchange_timeout_ts = ts};
+    LocalChannelOptions options{10, exchange_options.exchange_timeout_ts, false};
+    auto source_key = std::make_shared<ExchangeDataKey>(1, 5, 5);
+    auto source_channel = std::make_shared<LocalBroadcastChannel>(source_key, options, LocalBroadcastChannel::generateNameForTest());
+    BroadcastSenderProxyPtr source_sender = BroadcastSenderProxyRegistry::instance().getOrCreate(source_key);
+    source_sender->accept(context, header);
+    source_channel->registerToSenders(1000);
+    BroadcastReceiverPtr source_receiver = std::dynamic_pointer_cast<IBroadcastReceiver>(source_channel);
+
+    const size_t partition_num = 2;
+    BroadcastSenderPtrs sink_senders;
+    std::vector<BroadcastReceiverPtr> sink_receivers;
+    for (size_t i = 0; i < partition_num; ++i)
+    {
+        auto sink_key = std::make_shared<ExchangeDataKey>(1, 6 + i, 6 + i);
+        auto sink_channel = std::make_shared<LocalBroadcastChannel>(sink_key, options, LocalBroadcastChannel::generateNameForTest());
+        BroadcastSenderProxyPtr sink_sender = BroadcastSenderProxyRegistry::instance().getOrCreate(sink_key);
+        sink_sender->accept(context, header);
+        sink_channel->registerToSenders(1000);
+        sink_senders.emplace_back(sink_sender);
+        sink_receivers.emplace_back(std::dynamic_pointer_cast<IBroadcastReceiver>(sink_channel));
+    }
+
+    Chunk chunk(block.mutateColumns(), rows);
+    ColumnsWithTypeAndName arguments;
+    arguments.push_back(header.getByPosition(0));
+    auto func = createRepartitionFunction(context, arguments);
+
+    setQueryDuration();
+    for (size_t i = 0; i < chunk_num; i++)
+    {
+        BroadcastStatus status = source_sender->send(chunk.clone());
+        ASSERT_TRUE(status.code == BroadcastStatusCode::RUNNING);
+    }
+    source_sender->finish(BroadcastStatusCode::ALL_SENDERS_DONE, "sink test");
+
+    ExchangeOptions sink_options {{1000, 0}, 100000000, rows};
+    sink_options.sender_merge_states_threshold_in_bytes = 1ULL << 30;
+
+    auto exchange_source = std::make_shared<ExchangeSource>(header, source_receiver, exchange_options);
+    auto exchange_sink = std::make_shared<MultiPartitionExchangeSink>(
+        header, sink_senders, func, ColumnNumbers{0}, sink_options, MultiPartitionExchangeSink::generateNameForTest());
+    connect(exchange_source->getPort(), exchange_sink->getPort());
+    Processors processors;
+    processors.emplace_back(std::move(exchange_source));
+    processors.emplace_back(std::move(exchange_sink));
+    PipelineExecutor executor(processors);
+    executor.execute(2);
+
+    /// Recompute the expected per-partition row counts on a block holding each key once.
+    auto distinct_key_column = ColumnUInt64::create();
+    for (size_t key = 0; key < distinct_keys; ++key)
+        distinct_key_column->insert(key);
+    Chunk distinct_chunk(Columns{std::move(distinct_key_column)}, distinct_keys);
+    Block distinct_header {ColumnWithTypeAndName(key_type->createColumn(), key_type, "key")};
+    IColumn::Selector partition_selector;
+    RepartitionTransform::PartitionStartPoints partition_start_points;
+    std::tie(partition_selector, partition_start_points) = RepartitionTransform::doRepartition(
+        partition_num, distinct_chunk, distinct_header, ColumnNumbers{0}, func, RepartitionTransform::REPARTITION_FUNC_RESULT_TYPE);
+
+    size_t total_rows = 0;
+    for (size_t i = 0; i < partition_num; ++i)
+    {
+        size_t expected_rows = partition_start_points[i + 1] - partition_start_points[i];
+        if (expected_rows == 0)
+            continue;
+
+        RecvDataPacket recv_res = sink_receivers[i]->recv(2000);
+        ASSERT_TRUE(std::holds_alternative<Chunk>(recv_res));
+        Chunk & recv_chunk = std::get<Chunk>(recv_res);
+        ASSERT_EQ(recv_chunk.getNumRows(), expected_rows);
+        total_rows += recv_chunk.getNumRows();
+
+        /// Each key occurred `repeats` times in each of the `chunk_num` chunks, all merged into one state.
+        const auto & recv_states = assert_cast<const ColumnAggregateFunction &>(*recv_chunk.getColumns()[1]);
+        auto finalized = ColumnUInt64::create();
+        for (size_t row = 0; row < recv_chunk.getNumRows(); ++row)
+            sum_function->insertResultInto(recv_states.getData()[row], *finalized, nullptr);
+        for (size_t row = 0; row < finalized->size(); ++row)
+            ASSERT_EQ(finalized->getUInt(row), repeats * chunk_num);
+    }
+    ASSERT_EQ(total_rows, distinct_keys);
+}
+
 TEST(ExchangeSink, SinglePartitionExchangeSinkNormalTest)
 {
     auto context = getContext().context;
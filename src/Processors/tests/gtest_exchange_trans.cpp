@@ -18,10 +18,13 @@
 #include <thread>
 #include <variant>
 #include <ucontext.h>
+#include <Columns/ColumnString.h>
 #include <Columns/ColumnsNumber.h>
 #include <Compression/CompressedReadBuffer.h>
 #include <Core/Block.h>
+#include <DataTypes/DataTypeString.h>
 #include <DataTypes/DataTypesNumber.h>
+#include <IO/VarInt.h>
 #include <Processors/Exchange/DataTrans/BroadcastSenderProxy.h>
 #include <Processors/Exchange/DataTrans/BroadcastSenderProxyRegistry.h>
 #include <Processors/Exchange/DataTrans/Brpc/BrpcExchangeReceiverRegistryService.h>
@@ -158,6 +161,90 @@ TEST_F(ExchangeRemoteTest, SerDserChunk)
     EXPECT_EQ(col->getUInt(1), 7);
 }
 
+TEST_F(ExchangeRemoteTest, SerDserChunkStringDictionary)
+{
+    // Low-NDV string column, should travel as a per-block dictionary plus indices
+    auto string_column = ColumnString::create();
+    for (size_t i = 0; i < 1000; ++i)
+        string_column->insert("user-agent-" + std::to_string(i % 5));
+    Chunk origin_chunk(Columns{std::move(string_column)}, 1000);
+    Block header = {ColumnsWithTypeAndName{ColumnWithTypeAndName(ColumnString::create(), std::make_shared<DataTypeString>(), "str")}};
+
+    WriteBufferFromBrpcBuf out;
+    NativeChunkOutputStream block_out(out, header, /*dictionary_encode_strings_*/ true);
+    block_out.write(origin_chunk);
+    auto send_buf = out.getFinishedBuf();
+
+    WriteBufferFromBrpcBuf plain_out;
+    NativeChunkOutputStream plain_block_out(plain_out, header);
+    plain_block_out.write(origin_chunk);
+    EXPECT_LT(send_buf.length(), plain_out.getFinishedBuf().length());
+
+    ReadBufferFromBrpcBuf read_buffer(send_buf);
+    NativeChunkInputStream chunk_in(read_buffer, header, /*dictionary_encoded_strings_*/ true);
+    Chunk chunk = chunk_in.readImpl();
+    EXPECT_EQ(chunk.getNumRows(), 1000);
+    auto col = chunk.getColumns().at(0);
+    for (size_t i = 0; i < 1000; ++i)
+        EXPECT_EQ(col->getDataAt(i).toString(), "user-agent-" + std::to_string(i % 5));
+}
+
+TEST_F(ExchangeRemoteTest, SerDserChunkColumnwise)
+{
+    // ser each column into its own region, as serializeChunkColumnwise does
+    auto origin_chunk = createUInt8Chunk(1000, 3, 7);
+    auto header = getHeader(3);
+    auto chunk_info = std::make_shared<AggregatedChunkInfo>();
+    chunk_info->bucket_num = 42;
+    origin_chunk.setChunkInfo(chunk_info);
+
+    std::vector<butil::IOBuf> column_bufs(3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        WriteBufferFromBrpcBuf column_out;
+        NativeChunkOutputStream::writeColumnData(*header.getDataTypes().at(i), origin_chunk.getColumns()[i], column_out);
+        column_bufs[i] = column_out.getFinishedBuf();
+    }
+    WriteBufferFromBrpcBuf header_out;
+    NativeChunkOutputStream::writeChunkInfo(origin_chunk, header_out);
+    writeVarUInt(3, header_out);
+    writeVarUInt(origin_chunk.getNumRows(), header_out);
+    for (const auto & column_buf : column_bufs)
+        writeVarUInt(column_buf.length(), header_out);
+    auto send_buf = header_out.getFinishedBuf();
+    for (auto & column_buf : column_bufs)
+        send_buf.append(column_buf);
+
+    // dser header, slice the buffer by the recorded sizes and decode per column
+    ReadBufferFromBrpcBuf header_in(send_buf);
+    auto dser_chunk_info = std::dynamic_pointer_cast<const AggregatedChunkInfo>(NativeChunkInputStream::readChunkInfo(header_in));
+    ASSERT_TRUE(dser_chunk_info);
+    EXPECT_EQ(dser_chunk_info->bucket_num, 42);
+    size_t col_num = 0;
+    size_t row_num = 0;
+    readVarUInt(col_num, header_in);
+    readVarUInt(row_num, header_in);
+    EXPECT_EQ(col_num, 3);
+    EXPECT_EQ(row_num, 1000);
+    std::vector<size_t> column_sizes(col_num);
+    for (auto & column_size : column_sizes)
+        readVarUInt(column_size, header_in);
+
+    butil::IOBuf rest = send_buf;
+    rest.pop_front(header_in.count());
+    for (size_t i = 0; i < col_num; ++i)
+    {
+        butil::IOBuf column_buf;
+        rest.cutn(&column_buf, column_sizes[i]);
+        ReadBufferFromBrpcBuf column_in(column_buf);
+        ColumnPtr read_column = header.getDataTypes().at(i)->createColumn();
+        NativeChunkInputStream::readData(*header.getDataTypes().at(i), read_column, column_in, row_num, 0);
+        EXPECT_EQ(read_column->size(), 1000);
+        EXPECT_EQ(read_column->getUInt(1), 7);
+    }
+    EXPECT_TRUE(rest.empty());
+}
+
 void sender_thread(BroadcastSenderProxyPtr sender, Chunk chunk)
 {
     BroadcastStatus status = sender->send(std::move(chunk));
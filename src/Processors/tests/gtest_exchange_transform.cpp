@@ -35,6 +35,7 @@
 #include <Processors/Executors/PipelineExecutor.h>
 #include <Processors/QueryPipeline.h>
 #include <Processors/tests/gtest_processers_utils.h>
+#include <Common/SipHash.h>
 #include <Common/tests/gtest_global_context.h>
 #include "Columns/ColumnNothing.h"
 #include "DataTypes/DataTypeNothing.h"
@@ -70,6 +71,43 @@ TEST(RepartitionTransform, doRepartitionTest)
     }
 }
 
+TEST(RepartitionTransform, doBucketRepartitionTest)
+{
+    const size_t partition_num = 4;
+    const size_t rows = 100;
+    ColumnsWithTypeAndName cols;
+    for (int i = 0; i < 2; i++)
+    {
+        auto col = ColumnUInt64::create();
+        for (size_t row = 0; row < rows; row++)
+            col->insertValue(row * (i + 7));
+        cols.emplace_back(std::move(col), std::make_shared<DataTypeUInt64>(), "column" + std::to_string(i));
+    }
+    Block block{cols};
+    Chunk chunk(block.mutateColumns(), rows);
+
+    auto res_pair = RepartitionTransform::doBucketRepartition(partition_num, chunk, ColumnNumbers{0, 1});
+    auto & selector = res_pair.first;
+    auto & startpoints = res_pair.second;
+    ASSERT_TRUE(selector.size() == rows);
+    ASSERT_TRUE(startpoints.size() == partition_num + 1);
+
+    /// Every row must land in the partition of its chained SipHash, the same hash which
+    /// assigns rows of a clustered bucket table to buckets.
+    const auto & columns = chunk.getColumns();
+    for (size_t p = 0; p < partition_num; p++)
+    {
+        for (size_t pos = startpoints[p]; pos < startpoints[p + 1]; pos++)
+        {
+            size_t row = selector[pos];
+            SipHash hash;
+            columns[0]->updateHashWithValue(row, hash);
+            columns[1]->updateHashWithValue(row, hash);
+            ASSERT_EQ(hash.get64() % partition_num, p);
+        }
+    }
+}
+
 TEST(RepartitionTransform, doRepartitionNullableTest)
 {
     const size_t partition_num = 6;
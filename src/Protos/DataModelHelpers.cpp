@@ -68,9 +68,24 @@ DataModelPartWrapperPtr createPartWrapperFromModel(const MergeTreeMetaBase & sto
         part_model_wrapper->minmax_idx->load(storage, partition_minmax_buf);
     }
 
+    /// The raw bytes have just been deserialized into `partition` / `minmax_idx`, don't keep
+    /// a second copy of them in every cached model. They are restored on demand when a model
+    /// leaves the server, see restorePartitionAndMinMaxIndex.
+    if (storage.getSettings()->cnch_part_cache_compact_model)
+        part_model_wrapper->part_model->clear_partition_minmax();
+
     return part_model_wrapper;
 }
 
+void restorePartitionAndMinMaxIndex(
+    const MergeTreeMetaBase & storage, const DataModelPartWrapper & part_model_wrapper, Protos::DataModelPart & part_model)
+{
+    WriteBufferFromString partition_minmax_out(*part_model.mutable_partition_minmax());
+    part_model_wrapper.partition.store(storage, partition_minmax_out);
+    if (part_model.rows_count() > 0 && part_model_wrapper.minmax_idx)
+        part_model_wrapper.minmax_idx->store(storage, part_model_wrapper.name, partition_minmax_out);
+}
+
 DataModelPartWrapperPtr createPartWrapperFromModelBasic(const Protos::DataModelPart && part_model, const String && part_name)
 {
     DataModelPartWrapperPtr part_model_wrapper = std::make_shared<DataModelPartWrapper>();
@@ -390,6 +405,7 @@ void fillPartTTLInfoModel(const IMergeTreeDataPart & part, Protos::DataModelPart
     part_ttl_info_model.set_part_min_ttl(part.ttl_infos.part_min_ttl);
     part_ttl_info_model.set_part_max_ttl(part.ttl_infos.part_max_ttl);
     part_ttl_info_model.set_part_finished(!part.ttl_infos.hasAnyNonFinishedTTLs());
+    part_ttl_info_model.set_min_max_recompression_ttl(part.ttl_infos.getMinimalMaxRecompressionTTL());
 }
 
 void fillPartsModelForSend(
@@ -400,6 +416,8 @@ void fillPartsModelForSend(
     {
         auto & part_model = *parts_model.Add();
         part_model = part->part_model();
+        if (!part_model.has_partition_minmax())
+            restorePartitionAndMinMaxIndex(dynamic_cast<const MergeTreeMetaBase &>(storage), *part->part_model_wrapper, part_model);
         part_model.set_commit_time(part->getCommitTime());
         part_model.set_virtual_part_size(part->getVirtualPartSize());
 
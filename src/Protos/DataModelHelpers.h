@@ -21,6 +21,8 @@
 #include <Storages/MergeTree/DeleteBitmapMeta.h>
 #include <Storages/MergeTree/MergeTreeDataPartCNCH.h>
 #include <Common/HostWithPorts.h>
+#include <Common/ThreadPool.h>
+#include <Core/NamesAndTypes.h>
 // #include <Transaction/ICnchTransaction.h>
 #include <memory>
 #include <Catalog/DataModelPartWrapper.h>
@@ -188,30 +190,57 @@ template <class T>
 inline std::vector<T> createPartVectorFromModelsForSend(
     const MergeTreeMetaBase & storage,
     const pb::RepeatedPtrField<Protos::DataModelPart> & parts_model,
-    const pb::RepeatedPtrField<std::string> * paths = nullptr)
+    const pb::RepeatedPtrField<std::string> * paths = nullptr,
+    size_t max_threads = 1)
 {
-    std::vector<T> res;
-    res.reserve(parts_model.size());
+    std::vector<T> res(parts_model.size());
+
+    /// Columns lists are deduplicated on the wire: the first part of each columns version
+    /// carries the serialized list, later parts reference it by commit time. Parse every
+    /// distinct version up front so building the parts themselves has no cross-part
+    /// dependency and large lists can be chunked across threads.
     std::map<UInt64, NamesAndTypesListPtr> columns_versions;
-    for (int i = 0; i < parts_model.size(); ++i)
+    for (const auto & part_model : parts_model)
+        if (part_model.has_columns() && part_model.has_columns_commit_time()
+            && !columns_versions.count(part_model.columns_commit_time()))
+            columns_versions[part_model.columns_commit_time()]
+                = internNamesAndTypesList(NamesAndTypesList::parse(part_model.columns()));
+
+    auto create_range = [&](size_t begin, size_t end)
     {
-        const auto & part_model = parts_model[i];
-        auto part = createPartFromModelCommon(storage, part_model, (paths ? std::optional(paths->Get(i)) : std::nullopt));
-        part->columns_commit_time = part_model.columns_commit_time();
-        if (part_model.has_columns())
+        for (size_t i = begin; i < end; ++i)
         {
-            part->setColumns(NamesAndTypesList::parse(part_model.columns()));
-            if (part_model.has_columns_commit_time())
+            const auto & part_model = parts_model[static_cast<int>(i)];
+            auto part = createPartFromModelCommon(storage, part_model, (paths ? std::optional(paths->Get(static_cast<int>(i))) : std::nullopt));
+            part->columns_commit_time = part_model.columns_commit_time();
+            if (part_model.has_columns() && !part_model.has_columns_commit_time())
+                part->setColumns(NamesAndTypesList::parse(part_model.columns()));
+            else
             {
-                columns_versions[part_model.columns_commit_time()] = part->getColumnsPtr();
+                auto it = columns_versions.find(part_model.columns_commit_time());
+                /// setColumnsPtr throws on a missing version, as before.
+                part->setColumnsPtr(it != columns_versions.end() ? it->second : nullptr);
             }
+            res[i] = std::move(part);
         }
-        else
-        {
-            part->setColumnsPtr(columns_versions[part_model.columns_commit_time()]);
-        }
-        res.emplace_back(std::move(part));
+    };
+
+    /// One thread per ~1000 parts: below that the pool setup outweighs the win.
+    size_t num_threads = std::min<size_t>(max_threads, static_cast<size_t>(parts_model.size()) / 1000);
+    if (num_threads < 2)
+    {
+        create_range(0, res.size());
+        return res;
     }
+
+    ExceptionHandler exception_handler;
+    ThreadPool thread_pool(num_threads);
+    size_t chunk = (res.size() + num_threads - 1) / num_threads;
+    for (size_t begin = 0; begin < res.size(); begin += chunk)
+        thread_pool.scheduleOrThrowOnError(createExceptionHandledJob(
+            [&, begin, end = std::min(begin + chunk, res.size())] { create_range(begin, end); }, exception_handler));
+    thread_pool.wait();
+    exception_handler.throwIfException();
     return res;
 }
 
@@ -220,9 +249,10 @@ inline std::vector<T> createBasePartAndDeleteBitmapFromModelsForSend(
     const MergeTreeMetaBase & storage,
     const pb::RepeatedPtrField<Protos::DataModelPart> & parts_model,
     const pb::RepeatedPtrField<Protos::DataModelDeleteBitmap> & bitmaps_model,
-    const pb::RepeatedPtrField<std::string> * paths = nullptr)
+    const pb::RepeatedPtrField<std::string> * paths = nullptr,
+    size_t max_threads = 1)
 {
-    std::vector<T> res = createPartVectorFromModelsForSend<T>(storage, parts_model, paths);
+    std::vector<T> res = createPartVectorFromModelsForSend<T>(storage, parts_model, paths, max_threads);
 
     auto bitmap_it = bitmaps_model.begin();
     auto same_block = [](const Protos::DataModelDeleteBitmap & bitmap, const T & part) {
@@ -268,6 +298,12 @@ DataModelPartWrapperPtr createPartWrapperFromModel(const MergeTreeMetaBase & sto
 
 DataModelPartWrapperPtr createPartWrapperFromModelBasic(const Protos::DataModelPart && part_model, const String && part_name = "");
 
+/// Rebuild the raw partition_minmax bytes of a compact part model from the partition and
+/// minmax index already deserialized into the wrapper (see cnch_part_cache_compact_model).
+/// Must be called before a compact model is serialized out of the server.
+void restorePartitionAndMinMaxIndex(
+    const MergeTreeMetaBase & storage, const DataModelPartWrapper & part_model_wrapper, Protos::DataModelPart & part_model);
+
 ServerDataPartPtr createServerPartFromDataPart(const MergeTreeMetaBase & storage, const IMergeTreeDataPartPtr & part);
 
 ServerDataPartsVector
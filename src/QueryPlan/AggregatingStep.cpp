@@ -33,6 +33,7 @@
 #include <Processors/Merges/FinishAggregatingInOrderTransform.h>
 #include <Processors/QueryPipeline.h>
 #include <Processors/ResizeProcessor.h>
+#include <Processors/Transforms/AdaptiveAggregatingTransform.h>
 #include <Processors/Transforms/AggregatingInOrderTransform.h>
 #include <Processors/Transforms/AggregatingTransform.h>
 #include <Processors/Transforms/CopyTransform.h>
@@ -44,10 +45,31 @@
 #include <common/logger_useful.h>
 #include "Core/SettingsEnums.h"
 #include <DataStreams/IBlockInputStream.h>
+#include <Common/SipHash.h>
 #include <Common/StringUtils/StringUtils.h>
 
 namespace DB
 {
+namespace
+{
+    /// Identifies the aggregation by its shape, so that recurring runs of the same aggregation
+    /// (e.g. periodic refreshes of a materialized view) share one entry in HashTablesStatistics.
+    UInt64 calculateStatsCacheKey(const Block & header, const ColumnNumbers & keys, const AggregateDescriptions & aggregates)
+    {
+        SipHash hash;
+        for (const auto & column : header)
+        {
+            hash.update(column.name);
+            hash.update(column.type->getName());
+        }
+        for (const auto & key : keys)
+            hash.update(key);
+        for (const auto & descr : aggregates)
+            hash.update(descr.column_name);
+        return hash.get64();
+    }
+}
+
 bool hasNonParallelAggregateFunctions(const AggregateDescriptions & aggregates)
 {
     for (const auto & agg: aggregates)
@@ -434,6 +456,28 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
         new_params.group_by_two_level_threshold_bytes = 0;
     }
 
+    if (settings.collect_hash_table_stats_during_aggregation)
+        new_params.stats_collecting_params = StatsCollectingParams(
+            calculateStatsCacheKey(before_agg_header, key_index, new_aggregates),
+            settings.max_entries_for_hash_table_stats,
+            settings.max_size_to_preallocate_for_aggregation);
+
+    /// Optimizer cardinality estimate attached by SetAggregatingSizeHint. Serves as a size hint
+    /// when runtime statistics gave none; capped so that a wild estimate cannot preallocate more
+    /// than the configured limit.
+    if (estimated_group_count && settings.use_cardinality_estimate_for_aggregation)
+    {
+        UInt64 estimate = estimated_group_count;
+        /// A final aggregation below a repartition exchange only sees the groups hashed to its
+        /// own segment instance, so scale the plan-wide estimate down by the number of parallel
+        /// instances. A partial aggregation keeps the full estimate: its input is not
+        /// partitioned by the grouping keys, so every instance may see any group.
+        const auto & distributed = build_settings.distributed_settings;
+        if (final && distributed.is_distributed && distributed.parallel_size > 1)
+            estimate = std::max<UInt64>(estimate / distributed.parallel_size, 1);
+        new_params.estimated_keys = std::min<size_t>(estimate, settings.max_size_to_preallocate_for_aggregation);
+    }
+
     /** Two-level aggregation is useful in two cases:
       * 1. Parallel aggregation is done, and the results should be merged in parallel.
       * 2. An aggregation is done with store of temporary data on the disk, and they need to be merged in a memory efficient way.
@@ -652,6 +696,13 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
         }
     }
 
+    /// Partial aggregation may adaptively switch to in-order aggregation when the input turns
+    /// out to be ordered by the grouping keys; both sides of the switch emit partial states,
+    /// so the downstream merging aggregation reconciles them.
+    bool use_adaptive_in_order = settings.adaptive_aggregation_in_order && !final
+        && transform_params->params.keys_size > 0 && !transform_params->params.overflow_row
+        && transform_params->params.max_bytes_before_external_group_by == 0 && !transform_params->only_merge;
+
     /// If there are several sources, then we perform parallel aggregation
     if (pipeline.getNumStreams() > 1)
     {
@@ -662,7 +713,10 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
         auto many_data = std::make_shared<ManyAggregatedData>(pipeline.getNumStreams());
 
         size_t counter = 0;
-        pipeline.addSimpleTransform([&](const Block & header) {
+        pipeline.addSimpleTransform([&](const Block & header) -> ProcessorPtr {
+            if (use_adaptive_in_order)
+                return std::make_shared<AdaptiveAggregatingTransform>(
+                    header, transform_params, settings.adaptive_aggregation_in_order_sample_chunks, max_block_size);
             return std::make_shared<AggregatingTransform>(
                 header, transform_params, many_data, counter++, merge_max_threads, temporary_data_merge_threads);
         });
@@ -676,7 +730,12 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
     {
         pipeline.resize(1);
 
-        pipeline.addSimpleTransform([&](const Block & header) { return std::make_shared<AggregatingTransform>(header, transform_params); });
+        pipeline.addSimpleTransform([&](const Block & header) -> ProcessorPtr {
+            if (use_adaptive_in_order)
+                return std::make_shared<AdaptiveAggregatingTransform>(
+                    header, transform_params, settings.adaptive_aggregation_in_order_sample_chunks, max_block_size);
+            return std::make_shared<AggregatingTransform>(header, transform_params);
+        });
 
         aggregating = collector.detachProcessors(0);
     }
@@ -710,7 +769,7 @@ void AggregatingStep::describePipeline(FormatSettings & settings) const
 
 std::shared_ptr<IQueryPlanStep> AggregatingStep::copy(ContextPtr) const
 {
-    return std::make_shared<AggregatingStep>(
+    auto step = std::make_shared<AggregatingStep>(
         input_streams[0],
         keys,
         keys_not_hashed,
@@ -723,6 +782,8 @@ std::shared_ptr<IQueryPlanStep> AggregatingStep::copy(ContextPtr) const
         should_produce_results_in_order_of_bucket_number,
         no_shuffle,
         hints);
+    step->setEstimatedGroupCount(estimated_group_count);
+    return step;
 }
 
 void GroupingSetsParams::toProto(Protos::GroupingSetsParams & proto) const
@@ -786,6 +847,8 @@ void AggregatingStep::toProto(Protos::AggregatingStep & proto, bool) const
     for (const auto & element : groupings)
         element.toProto(*proto.add_groupings());
     proto.set_should_produce_results_in_order_of_bucket_number(should_produce_results_in_order_of_bucket_number);
+    if (estimated_group_count)
+        proto.set_estimated_group_count(estimated_group_count);
 }
 
 std::shared_ptr<AggregatingStep> AggregatingStep::fromProto(const Protos::AggregatingStep & proto, ContextPtr context)
@@ -846,6 +909,7 @@ std::shared_ptr<AggregatingStep> AggregatingStep::fromProto(const Protos::Aggreg
         false,
         should_produce_results_in_order_of_bucket_number);
     step->setStepDescription(step_description);
+    step->setEstimatedGroupCount(proto.estimated_group_count());
     return step;
 }
 
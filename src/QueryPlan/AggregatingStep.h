@@ -203,6 +203,9 @@ public:
         no_shuffle = no_shuffle_;
     }
 
+    UInt64 getEstimatedGroupCount() const { return estimated_group_count; }
+    void setEstimatedGroupCount(UInt64 estimated_group_count_) { estimated_group_count = estimated_group_count_; }
+
     const GroupingDescriptions & getGroupings() const { return groupings; }
     bool shouldProduceResultsInOrderOfBucketNumber() const { return should_produce_results_in_order_of_bucket_number; }
     void setShouldProduceResultsInOrderOfBucketNumber(bool value) { should_produce_results_in_order_of_bucket_number = value; }
@@ -257,6 +260,11 @@ private:
     // for bitengine sqls
     bool no_shuffle;
 
+    /// Estimated number of groups from the optimizer cardinality estimate, 0 if unknown.
+    /// Attached by the SetAggregatingSizeHint rewriter and used to pre-size the
+    /// aggregation hash tables when the pipeline is built.
+    UInt64 estimated_group_count = 0;
+
     Processors aggregating_in_order;
     Processors aggregating_sorted;
     Processors finalizing;
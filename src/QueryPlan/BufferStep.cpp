@@ -0,0 +1,22 @@
+#include <QueryPlan/BufferStep.h>
+
+#include <Interpreters/Context.h>
+#include <QueryPlan/BuildQueryPipelineSettings.h>
+
+namespace DB
+{
+
+void BufferStep::transformPipeline(QueryPipeline & pipeline, const BuildQueryPipelineSettings & settings)
+{
+    size_t max_bytes_before_spill = settings.context->getSettingsRef().cte_buffer_max_bytes_before_spill;
+    VolumePtr tmp_volume = max_bytes_before_spill ? settings.context->getTemporaryVolume() : nullptr;
+    size_t min_free_disk_space = settings.context->getSettingsRef().min_free_disk_space_for_temporary_data;
+
+    pipeline.addSimpleTransform([&](const Block & header) -> ProcessorPtr {
+        if (tmp_volume)
+            return std::make_shared<BufferTransform>(header, max_bytes_before_spill, tmp_volume, min_free_disk_space);
+        return std::make_shared<BufferTransform>(header);
+    });
+}
+
+}
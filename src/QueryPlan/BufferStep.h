@@ -16,13 +16,7 @@ public:
 
     Type getType() const override { return Type::Buffer; }
 
-    void transformPipeline(QueryPipeline & pipeline, const BuildQueryPipelineSettings &) override
-    {
-        pipeline.addSimpleTransform([&](const Block & header) {
-            auto transform = std::make_shared<BufferTransform>(header);
-            return transform;
-        });
-    }
+    void transformPipeline(QueryPipeline & pipeline, const BuildQueryPipelineSettings & settings) override;
 
     std::shared_ptr<IQueryPlanStep> copy(ContextPtr) const override { return std::make_shared<BufferStep>(input_streams[0]); }
 
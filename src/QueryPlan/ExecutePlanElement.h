@@ -22,7 +22,10 @@ struct PartGroup
 
     bool hasProjection(const String & projection_name) const
     {
-        return parts.front()->hasProjection(projection_name);
+        /// CNCH parts carry projection names in the part model long before the projection
+        /// parts themselves are loaded, so consult the name set as well.
+        return parts.front()->hasProjection(projection_name)
+            || parts.front()->getProjectionPartsNames().count(projection_name);
     }
 
     bool hasBitmapIndx() const
@@ -19,6 +19,7 @@
 #include <Interpreters/ExpressionActions.h>
 #include <Interpreters/GraceHashJoin.h>
 #include <Interpreters/HashJoin.h>
+#include <Interpreters/HashJoinCache.h>
 #include <Interpreters/IJoin.h>
 #include <Interpreters/JoinSwitcher.h>
 #include <Interpreters/MergeJoin.h>
@@ -160,6 +161,10 @@ JoinPtr JoinStep::makeJoin(
     String key_name;
     if (table_join->forceNestedLoopJoin())
         return std::make_shared<NestedLoopJoin>(table_join, r_sample_block, context);
+    /// The optimizer marked this join as key-aligned on sorted scans; stream it with a merge
+    /// join instead of building a hash table on the right side.
+    else if (join_algorithm == JoinAlgorithm::PARTIAL_MERGE && allow_merge_join)
+        return std::make_shared<MergeJoin>(table_join, r_sample_block);
     else if (table_join->forceHashJoin() || (table_join->preferMergeJoin() && !allow_merge_join))
     {
         if (table_join->allowParallelHashJoin() && join_algorithm == JoinAlgorithm::PARALLEL_HASH)
@@ -342,6 +347,28 @@ QueryPipelinePtr JoinStep::updatePipeline(QueryPipelines pipelines, const BuildQ
         max_block_size = settings.context->getSettingsRef().max_block_size;
     }
 
+    /// For eligible broadcast joins reuse the hash table built by a previous query, or
+    /// publish the one built here so later queries can. A cached join is shared read-only,
+    /// so the right side is drained without refilling it.
+    bool right_side_prebuilt = false;
+    std::function<void()> on_right_side_built;
+    if (hash_join_cache_key && settings.context->getSettingsRef().enable_hash_join_cache && !need_build_runtime_filter)
+    {
+        if (auto cached_join = HashJoinCache::instance().tryGet(hash_join_cache_key))
+        {
+            LOG_DEBUG(
+                &Poco::Logger::get("JoinStep"), "Reusing hash table from the hash join cache, key {}", hash_join_cache_key);
+            join = cached_join;
+            right_side_prebuilt = true;
+        }
+        else if (join->getType() == JoinType::Hash
+            && HashJoinCache::instance().add(
+                hash_join_cache_key, join, settings.context->getSettingsRef().hash_join_cache_ttl_seconds))
+        {
+            on_right_side_built = [key = hash_join_cache_key] { HashJoinCache::instance().markReady(key); };
+        }
+    }
+
     auto pipeline = QueryPipeline::joinPipelines(
         std::move(pipelines[0]),
         std::move(pipelines[1]),
@@ -351,7 +378,9 @@ QueryPipelinePtr JoinStep::updatePipeline(QueryPipelines pipelines, const BuildQ
         keep_left_read_in_order,
         settings.context->getSettingsRef().join_parallel_left_right,
         &processors,
-        need_build_runtime_filter);
+        need_build_runtime_filter,
+        right_side_prebuilt,
+        std::move(on_right_side_built));
 
     // if NestLoopJoin is choose, no need to add filter stream.
     if (filter && !PredicateUtils::isTruePredicate(filter) && join->getType() != JoinType::NestedLoop
@@ -458,6 +487,8 @@ void JoinStep::toProto(Protos::JoinStep & proto, bool for_hash_equals) const
         proto_element->set_key(k);
         v.toProto(*proto_element->mutable_value());
     }
+    if (hash_join_cache_key)
+        proto.set_hash_join_cache_key(hash_join_cache_key);
 }
 
 std::shared_ptr<JoinStep> JoinStep::fromProto(const Protos::JoinStep & proto, ContextPtr)
@@ -523,6 +554,7 @@ std::shared_ptr<JoinStep> JoinStep::fromProto(const Protos::JoinStep & proto, Co
         is_ordered,
         runtime_filter_builders);
     step->setStepDescription(step_description);
+    step->setHashJoinCacheKey(proto.hash_join_cache_key());
     return step;
 }
 
@@ -576,7 +608,7 @@ void FilledJoinStep::transformPipeline(QueryPipeline & pipeline, const BuildQuer
 
 std::shared_ptr<IQueryPlanStep> JoinStep::copy(ContextPtr) const
 {
-    return std::make_shared<JoinStep>(
+    auto step = std::make_shared<JoinStep>(
         input_streams,
         output_stream.value(),
         kind,
@@ -596,6 +628,8 @@ std::shared_ptr<IQueryPlanStep> JoinStep::copy(ContextPtr) const
         simple_reordered,
         runtime_filter_builders,
         hints);
+    step->setHashJoinCacheKey(hash_join_cache_key);
+    return step;
 }
 
 RuntimeFilterBuilderPtr JoinStep::createRuntimeFilterBuilder(ContextPtr context) const
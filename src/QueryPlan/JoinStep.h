@@ -138,6 +138,11 @@ public:
     bool isSimpleReordered() const { return simple_reordered; }
     void setSimpleReordered(bool simple_reordered_) { simple_reordered = simple_reordered_; }
 
+    /// Key under which the built hash table may be cached and reused across queries,
+    /// set by SetHashJoinCacheKey for eligible broadcast joins; 0 disables caching.
+    UInt64 getHashJoinCacheKey() const { return hash_join_cache_key; }
+    void setHashJoinCacheKey(UInt64 hash_join_cache_key_) { hash_join_cache_key = hash_join_cache_key_; }
+
     bool mustReplicate() const;
     bool mustRepartition() const;
 
@@ -243,6 +248,8 @@ private:
     Processors processors;
 
     LinkedHashMap<String, RuntimeFilterBuildInfos> runtime_filter_builders;
+
+    UInt64 hash_join_cache_key = 0;
 };
 
 /// Special step for the case when Join is already filled.
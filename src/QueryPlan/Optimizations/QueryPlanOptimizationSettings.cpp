@@ -12,6 +12,7 @@ QueryPlanOptimizationSettings QueryPlanOptimizationSettings::fromSettings(const
     settings.max_optimizations_to_apply = from.query_plan_max_optimizations_to_apply;
     settings.enable_optimizer = from.enable_optimizer;
     settings.filter_push_down = from.query_plan_filter_push_down;
+    settings.merge_filters = from.query_plan_merge_filters;
     return settings;
 }
 
@@ -0,0 +1,90 @@
+#include <QueryPlan/Optimizations/Optimizations.h>
+#include <QueryPlan/FilterStep.h>
+#include <Interpreters/ActionsDAG.h>
+#include <Functions/IFunctionAdaptors.h>
+#include <Functions/FunctionsLogical.h>
+
+namespace DB::QueryPlanOptimizations
+{
+
+static void removeFromOutputs(ActionsDAG & dag, const ActionsDAG::Node & node)
+{
+    auto & outputs = dag.getOutputs();
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        if (&node == outputs[i])
+        {
+            outputs.erase(outputs.begin() + i);
+            return;
+        }
+    }
+}
+
+size_t tryMergeFilters(QueryPlan::Node * parent_node, QueryPlan::Nodes &)
+{
+    if (parent_node->children.size() != 1)
+        return 0;
+
+    QueryPlan::Node * child_node = parent_node->children.front();
+
+    auto & parent = parent_node->step;
+    auto & child = child_node->step;
+
+    auto * parent_filter = typeid_cast<FilterStep *>(parent.get());
+    auto * child_filter = typeid_cast<FilterStep *>(child.get());
+
+    if (!parent_filter || !child_filter)
+        return 0;
+
+    const auto & child_actions = child_filter->getExpression();
+    const auto & parent_actions = parent_filter->getExpression();
+
+    /// Steps created by the new optimizer carry the filter as AST; nothing to merge here.
+    if (!child_actions || !parent_actions)
+        return 0;
+
+    /// The parent condition starts to be computed on rows the child has not filtered out yet,
+    /// which is not valid for functions whose result depends on the position of rows in a block.
+    if (child_actions->hasArrayJoin() || parent_actions->hasStatefulFunctions())
+        return 0;
+
+    /// After the merge both filter columns must be findable in the combined outputs,
+    /// see below. Bail out in advance: the merge consumes both DAGs.
+    if (parent_actions->isInputProjected())
+        return 0;
+    if (!child_filter->removesFilterColumn() && !parent_actions->tryFindInOutputs(child_filter->getFilterColumnName()))
+        return 0;
+
+    auto merged = ActionsDAG::merge(std::move(*child_actions), std::move(*parent_actions));
+
+    const auto & child_filter_node = merged->findInOutputs(child_filter->getFilterColumnName());
+    const auto & parent_filter_node = merged->findInOutputs(parent_filter->getFilterColumnName());
+
+    /// Combine the two conditions with `and`, so both are applied in a single pass over
+    /// the block. With short-circuit evaluation the parent condition is still not
+    /// computed on rows rejected by the child one.
+    FunctionOverloadResolverPtr func_builder_and = std::make_unique<FunctionToOverloadResolverAdaptor>(std::make_shared<FunctionAnd>());
+    const auto & condition = merged->addFunction(func_builder_and, {&child_filter_node, &parent_filter_node}, {});
+
+    auto & outputs = merged->getOutputs();
+    outputs.insert(outputs.begin(), &condition);
+
+    if (child_filter->removesFilterColumn())
+        removeFromOutputs(*merged, child_filter_node);
+    if (parent_filter->removesFilterColumn())
+        removeFromOutputs(*merged, parent_filter_node);
+
+    merged->removeUnusedActions(false);
+
+    auto filter = std::make_unique<FilterStep>(child_filter->getInputStreams().front(),
+                                               merged,
+                                               condition.result_name,
+                                               true);
+    filter->setStepDescription("(" + parent_filter->getStepDescription() + " + " + child_filter->getStepDescription() + ")");
+
+    parent_node->step = std::move(filter);
+    parent_node->children.swap(child_node->children);
+    return 1;
+}
+
+}
@@ -555,6 +555,9 @@ String PlanPrinter::TextPrinter::printProcessorDetail(GroupedProcessorProfilePtr
     out << profile->processor_name <<" x" << profile->parallel_size << " ElapsedTime:" << prettySeconds(profile->grouped_elapsed_us/profile->worker_cnt);
     if (profile->worker_cnt > 1)
         out<< "[max=" << prettySeconds(profile->max_grouped_elapsed_us) << ", min=" << prettySeconds(profile->min_grouped_elapsed_us) << "]";
+    out << " SchedulingWaitTime:" << prettySeconds(profile->grouped_scheduling_wait_elapsed_us/profile->worker_cnt);
+    if (profile->worker_cnt > 1)
+        out<< "[max=" << prettySeconds(profile->max_grouped_scheduling_wait_elapsed_us) << ", min=" << prettySeconds(profile->min_grouped_scheduling_wait_elapsed_us) << "]";
     out << intent.detailIntent() << "Input: WaitTime:" << prettySeconds(profile->grouped_input_wait_elapsed_us/profile->worker_cnt);
     if (profile->worker_cnt > 1)
         out<< "[max=" << prettySeconds(profile->max_grouped_input_wait_elapsed_us) << ", min=" << prettySeconds(profile->min_grouped_input_wait_elapsed_us) << "]";
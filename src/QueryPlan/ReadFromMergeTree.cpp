@@ -22,6 +22,7 @@
 #include <Storages/MergeTree/LateMaterialize/MergeTreeThreadSelectProcessorLM.h>
 #include <Storages/MergeTree/MergeTreeDataSelectExecutor.h>
 #include <Storages/MergeTree/MergeTreeReadPool.h>
+#include <Storages/MergeTree/SharedScanRegistry.h>
 #include <Storages/VirtualColumnUtils.h>
 #include <Interpreters/ExpressionAnalyzer.h>
 #include <Interpreters/TreeRewriter.h>
@@ -83,10 +84,15 @@ static MergeTreeReaderSettings getMergeTreeReaderSettings(const ContextPtr & con
         .read_settings = context->getReadSettings(),
         .save_marks_in_cache = true,
         .checksum_on_read = context->getSettingsRef().checksum_on_read,
+        .async_checksum_validation = context->getSettingsRef().async_checksum_validation,
         .read_source_bitmap = !context->getSettingsRef().use_encoded_bitmap,
+        .decompress_ahead_blocks = context->getSettingsRef().merge_tree_decompress_ahead_blocks,
+        .read_columns_max_parallelism = context->getSettingsRef().merge_tree_read_columns_max_parallelism,
+        .remote_read_min_density_for_sequential_read = context->getSettingsRef().remote_read_min_density_for_sequential_read,
     };
 
     settings.setDiskCacheSteaing(data.getSettings()->disk_cache_stealing_mode);
+    settings.read_settings.remote_request_throttler = data.getRemoteRequestThrottler(context);
     return settings;
 }
 
@@ -454,6 +460,24 @@ struct PartRangesReadInfo
         use_uncompressed_cache = settings.use_uncompressed_cache;
         if (sum_marks > max_marks_to_use_cache)
             use_uncompressed_cache = false;
+
+        if (settings.enable_cooperative_scans && settings.use_uncompressed_cache)
+        {
+            auto & shared_scans = SharedScanRegistry::instance();
+
+            /// When another running query scans overlapping ranges of the same parts,
+            /// route this scan through the uncompressed cache even though it is large:
+            /// concurrent loads of one block collapse into a single read + decompression
+            /// and every query shares the decompressed cell, so the burst pays IO once.
+            if (!use_uncompressed_cache && shared_scans.hasOverlappingScan(parts))
+            {
+                use_uncompressed_cache = true;
+                LOG_TRACE(&Poco::Logger::get("ReadFromMergeTree"),
+                    "Found a concurrent overlapping scan, sharing decompressed blocks through the uncompressed cache");
+            }
+
+            shared_scans.registerScan(parts);
+        }
     }
 };
 
@@ -1212,6 +1236,17 @@ void ReadFromMergeTree::initializePipeline(QueryPipeline & pipeline, const Build
     // extract selected_parts_vector before result.parts_with_ranges be moved
     auto selected_parts_vector = getSelectedPartsVector(result);
 
+    /// Estimate how many bytes this query is about to scan, so that the disk cache can decide
+    /// whether admitting the segments of this scan would flush out the hot working set.
+    size_t estimated_scan_bytes = 0;
+    for (const auto & part_with_ranges : result.parts_with_ranges)
+    {
+        size_t part_marks = part_with_ranges.data_part->index_granularity.getMarksCount();
+        if (part_marks)
+            estimated_scan_bytes += part_with_ranges.data_part->getBytesOnDisk() * part_with_ranges.getMarksCount() / part_marks;
+    }
+    reader_settings.estimated_scan_bytes = estimated_scan_bytes;
+
     /// Projection, that needed to drop columns, which have appeared by execution
     /// of some extra expressions, and to allow execute the same expressions later.
     /// NOTE: It may lead to double computation of expressions.
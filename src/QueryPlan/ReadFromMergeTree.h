@@ -158,7 +158,8 @@ public:
     void requestReadingInOrder(size_t prefix_size, int direction, size_t limit);
     ReadFromMergeTree::AnalysisResult getAnalysisResult() const;
 private:
-    const MergeTreeReaderSettings reader_settings;
+    /// Not const: estimated_scan_bytes is filled in when the pipeline is initialized and the selected ranges are known.
+    MergeTreeReaderSettings reader_settings;
 
     MergeTreeMetaBase::DataPartsVector prepared_parts;
     MergeTreeMetaBase::DeleteBitmapGetter delete_bitmap_getter;
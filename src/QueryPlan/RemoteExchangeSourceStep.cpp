@@ -381,8 +381,12 @@ void RemoteExchangeSourceStep::initializePipeline(QueryPipeline & pipeline, cons
     if (!keep_order)
     {
         pipeline.resize(context->getSettingsRef().exchange_source_pipeline_threads);
-        pipeline.addSimpleTransform([enable_compress = context->getSettingsRef().exchange_enable_block_compress, header = exchange_header](
-                                        const Block &) { return std::make_shared<DeserializeBufTransform>(header, enable_compress); });
+        pipeline.addSimpleTransform([enable_compress = context->getSettingsRef().exchange_enable_block_compress,
+                                     parallel_threads = options.parallel_deserialize_threads,
+                                     dictionary_encoded = context->getSettingsRef().exchange_enable_string_dictionary_encoding,
+                                     header = exchange_header](const Block &) {
+            return std::make_shared<DeserializeBufTransform>(header, enable_compress, parallel_threads, dictionary_encoded);
+        });
     }
     LOG_DEBUG(logger, "Total exchange source : {}, keep_order: {}", source_num, keep_order);
     pipeline.setMinThreads(source_num);
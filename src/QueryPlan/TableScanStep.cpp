@@ -40,11 +40,15 @@
 #include <Parsers/ASTTableColumnReference.h>
 #include <Parsers/ASTTablesInSelectQuery.h>
 #include <Parsers/queryToString.h>
+#include <Processors/LimitTransform.h>
 #include <Processors/MergeTreeSelectPrepareProcessor.h>
+#include <Processors/Merges/MergingSortedTransform.h>
 #include <Processors/QueryPipeline.h>
 #include <Processors/ResizeProcessor.h>
 #include <Processors/Sources/NullSource.h>
 #include <Processors/Transforms/ExpressionTransform.h>
+#include <Processors/Transforms/MergeSortingTransform.h>
+#include <Processors/Transforms/PartialSortingTransform.h>
 #include <QueryPlan/IQueryPlanStep.h>
 #include <QueryPlan/Optimizations/QueryPlanOptimizationSettings.h>
 #include <QueryPlan/PlanSerDerHelper.h>
@@ -53,6 +57,7 @@
 #include <Storages/IStorage_fwd.h>
 #include <Storages/MergeTree/Index/BitmapIndexHelper.h>
 #include <Storages/MergeTree/Index/TableScanExecutorWithIndex.h>
+#include <Storages/MergeTree/MergeTreeLazyFetchTransform.h>
 #include <Storages/MergeTree/MergeTreeWhereOptimizer.h>
 #include <Storages/RemoteFile/IStorageCnchFile.h>
 #include <Storages/StorageCloudMergeTree.h>
@@ -219,6 +224,9 @@ namespace _scan_execute_impl
             columns_vector.emplace_back(column_entry.name);
         for (const auto & projection_entry: part->getProjectionParts())
             projections_vector.emplace_back(projection_entry.first);
+        /// CNCH parts may only know projection names at this point, the parts are loaded lazily
+        for (const auto & projection_name: part->getProjectionPartsNames())
+            projections_vector.emplace_back(projection_name);
 
         columns.insert(columns_vector.begin(), columns_vector.end());
         projections.insert(projections_vector.begin(), projections_vector.end());
@@ -415,7 +423,7 @@ ExecutePlan TableScanExecutor::buildExecutePlan(const DistributedPipelineSetting
         for (auto & candidate: projection_candidates)
         {
             estimateReadMarksForProjection(part_group, candidate);
-            if (!candidate.read_analysis->error() && candidate.read_analysis->marks() < min_sum_marks)
+            if (candidate.read_analysis && !candidate.read_analysis->error() && candidate.read_analysis->marks() < min_sum_marks)
             {
                 selected_candidate = &candidate;
                 min_sum_marks = candidate.read_analysis->marks();
@@ -587,7 +595,23 @@ void TableScanExecutor::estimateReadMarksForProjection(const PartGroup & part_gr
         const auto & projections = part->getProjectionParts();
         auto it = projections.find(candidate.projection_desc.name);
         if (it == projections.end())
-            throw Exception(ErrorCodes::LOGICAL_ERROR, "projection not found in a part group, does part grouping perform correctly?");
+        {
+            /// CNCH parts record projection names in the part model but load the projection
+            /// parts lazily; do it on first use. A part group may still end up without the
+            /// projection (e.g. the data was written before the projection existed), in which
+            /// case the candidate is simply not usable for this group.
+            try
+            {
+                const_cast<IMergeTreeDataPart &>(*part).loadProjections(false, false);
+            }
+            catch (...)
+            {
+                tryLogCurrentException(log, "Failed to load projection parts of part " + part->name);
+            }
+            it = projections.find(candidate.projection_desc.name);
+            if (it == projections.end())
+                return; /// leave read_analysis unset
+        }
         projection_parts.push_back(it->second);
     }
 
@@ -948,6 +972,7 @@ void TableScanStep::rewriteInForBucketTable(ContextPtr context) const
 
 void TableScanStep::rewriteDynamicFilter(ASTSelectQuery * query, const BuildQueryPipelineSettings & build_settings, bool use_expand_pipe)
 {
+    index_prune_runtime_filters.clear();
     auto where = query->getWhere();
     auto prehwere = query->getPrewhere();
     if (where || prehwere)
@@ -1041,6 +1066,20 @@ void TableScanStep::rewriteDynamicFilter(ASTSelectQuery * query, const BuildQuer
             }
         }
 
+        if (setting.enable_runtime_filter_index_pruning)
+        {
+            /// Collect ready bloom filters on plain columns for granule pruning during index
+            /// analysis; min/max and IN predicates built above already reach the key condition.
+            for (const auto & description : descriptions)
+            {
+                if (auto column = tryGetIdentifierName(description.expr))
+                {
+                    if (auto bloom_filter = RuntimeFilterUtils::extractReadyBloomFilter(description, query_id))
+                        index_prune_runtime_filters.emplace(*column, std::move(bloom_filter));
+                }
+            }
+        }
+
         for (size_t i = 0; i < descriptions.size(); ++i)
         {
             if (!rf_predicates[i])
@@ -1187,6 +1226,10 @@ void TableScanStep::initializePipeline(QueryPipeline & pipeline, const BuildQuer
     if (partition_filter)
         query_info.partition_filter = partition_filter;
 
+    if (!index_prune_runtime_filters.empty())
+        query_info.runtime_filter_bloom_filters
+            = std::make_shared<RuntimeFilterBloomFilters>(std::move(index_prune_runtime_filters));
+
     if (use_projection_index)
     {
         auto storage_snapshot = storage->getStorageSnapshot(storage->getInMemoryMetadataPtr(), build_context.context);
@@ -1256,6 +1299,12 @@ void TableScanStep::initializePipeline(QueryPipeline & pipeline, const BuildQuer
                 cloud_merge_tree->source_count = build_context.distributed_settings.source_task_count;
             }
         }
+        if (lazy_topn_limit && tryLazyTopNRead(pipeline, build_context, storage_snapshot, options, max_streams))
+        {
+            LOG_DEBUG(log, "init pipeline total run time: {} ms (lazy TopN read)", total_watch.elapsedMillisecondsAsDouble());
+            return;
+        }
+
         // flag = Output
         auto pipe = storage->read(
             interpreter->getRequiredColumns(), storage_snapshot, query_info, build_context.context, QueryProcessingStage::Enum::FetchColumns, max_block_size, max_streams);
@@ -1549,6 +1598,121 @@ void TableScanStep::initializePipeline(QueryPipeline & pipeline, const BuildQuer
     LOG_DEBUG(log, "init pipeline total run time: {} ms, table scan descriptiion: {}", total_watch.elapsedMillisecondsAsDouble(), step_desc.str());
 }
 
+bool TableScanStep::tryLazyTopNRead(
+    QueryPipeline & pipeline,
+    const BuildQueryPipelineSettings & build_context,
+    const StorageSnapshotPtr & storage_snapshot,
+    const SelectQueryOptions & options,
+    size_t max_streams)
+{
+    if (pushdown_aggregation || pushdown_projection || pushdown_filter || !inline_expressions.empty())
+        return false;
+
+    auto * merge_tree = dynamic_cast<MergeTreeMetaBase *>(storage.get());
+    if (!merge_tree)
+        return false;
+
+    const auto * select = query_info.query->as<ASTSelectQuery>();
+    if (!select || select->getWhere() || select->getPrewhere() || query_info.prewhere_info || query_info.input_order_info)
+        return false;
+
+    /// The sort description refers to output symbols; the narrow read and the sorting
+    /// transforms work on storage columns, so translate it before building the pipeline.
+    auto alias_to_column = getAliasToColumnMap();
+    SortDescription sort_description = lazy_topn_sort_description;
+    Names sort_columns;
+    NameSet sort_column_set;
+    for (auto & sort_column : sort_description)
+    {
+        auto it = alias_to_column.find(sort_column.column_name);
+        if (it == alias_to_column.end())
+            return false;
+        sort_column.column_name = it->second;
+        if (sort_column_set.emplace(sort_column.column_name).second)
+            sort_columns.push_back(sort_column.column_name);
+    }
+
+    /// Columns materialized only for the rows that survive the limit.
+    NamesAndTypesList columns_to_fetch;
+    for (const auto & column : storage_snapshot->getSampleBlockForColumns(getRequiredColumns(Output)).getNamesAndTypesList())
+        if (!sort_column_set.count(column.name))
+            columns_to_fetch.push_back(column);
+    if (columns_to_fetch.empty())
+        return false;
+
+    Names narrow_columns = sort_columns;
+    narrow_columns.push_back("_part");
+    narrow_columns.push_back("_part_row_number");
+
+    auto pipe = storage->read(
+        narrow_columns,
+        storage_snapshot,
+        query_info,
+        build_context.context,
+        QueryProcessingStage::Enum::FetchColumns,
+        max_block_size,
+        max_streams);
+    if (pipe.empty())
+        return false;
+
+    QueryPlanStepPtr step = std::make_shared<ReadFromStorageStep>(std::move(pipe), step_description);
+    if (auto * source = dynamic_cast<ISourceStep *>(step.get()))
+        source->initializePipeline(pipeline, build_context);
+
+    const auto & settings = build_context.context->getSettingsRef();
+    UInt64 limit = lazy_topn_limit;
+
+    pipeline.addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr {
+        if (stream_type != QueryPipeline::StreamType::Main)
+            return nullptr;
+
+        return std::make_shared<PartialSortingTransform>(header, sort_description, limit);
+    });
+
+    pipeline.addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr {
+        if (stream_type == QueryPipeline::StreamType::Totals)
+            return nullptr;
+
+        return std::make_shared<MergeSortingTransform>(
+            header,
+            sort_description,
+            settings.max_block_size,
+            limit,
+            settings.max_bytes_before_remerge_sort / pipeline.getNumStreams(),
+            settings.remerge_sort_lowered_memory_bytes_ratio,
+            settings.max_bytes_before_external_sort,
+            build_context.context->getTemporaryVolume(),
+            settings.min_free_disk_space_for_temporary_data,
+            settings.spill_mode == SpillMode::AUTO);
+    });
+
+    if (pipeline.getNumStreams() > 1)
+    {
+        auto transform = std::make_shared<MergingSortedTransform>(
+            pipeline.getHeader(), pipeline.getNumStreams(), sort_description, settings.max_block_size, limit);
+        pipeline.addTransform(std::move(transform));
+    }
+
+    pipeline.addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr {
+        if (stream_type != QueryPipeline::StreamType::Main)
+            return nullptr;
+
+        return std::make_shared<LimitTransform>(header, limit, 0);
+    });
+
+    pipeline.addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr {
+        if (stream_type != QueryPipeline::StreamType::Main)
+            return nullptr;
+
+        return std::make_shared<MergeTreeLazyFetchTransform>(
+            header, *merge_tree, storage_snapshot->metadata, columns_to_fetch, build_context.context);
+    });
+
+    aliasColumns(pipeline, build_context, "lazy TopN read");
+    setQuotaAndLimits(pipeline, options, build_context);
+    return true;
+}
+
 void TableScanStep::toProto(Protos::TableScanStep & proto, bool) const
 {
     storage_id.toProto(*proto.mutable_storage_id());
@@ -1564,6 +1728,11 @@ void TableScanStep::toProto(Protos::TableScanStep & proto, bool) const
 
     serializeAssignmentsToProto(inline_expressions, *proto.mutable_inline_expressions());
 
+    for (const auto & sort_column : lazy_topn_sort_description)
+        sort_column.toProto(*proto.add_lazy_topn_sort_description());
+    if (lazy_topn_limit)
+        proto.set_lazy_topn_limit(lazy_topn_limit);
+
     if (pushdown_aggregation)
     {
         pushdown_aggregation->toProto(*proto.mutable_pushdown_aggregation());
@@ -1615,6 +1784,18 @@ std::shared_ptr<TableScanStep> TableScanStep::fromProto(const Protos::TableScanS
         pushdown_aggregation,
         pushdown_projection,
         pushdown_filter);
+
+    if (proto.lazy_topn_limit())
+    {
+        SortDescription lazy_topn_sort_description;
+        for (const auto & proto_element : proto.lazy_topn_sort_description())
+        {
+            SortColumnDescription element;
+            element.fillFromProto(proto_element);
+            lazy_topn_sort_description.emplace_back(std::move(element));
+        }
+        step->setLazyTopN(std::move(lazy_topn_sort_description), proto.lazy_topn_limit());
+    }
     return step;
 }
 
@@ -1626,7 +1807,7 @@ std::shared_ptr<IQueryPlanStep> TableScanStep::copy(ContextPtr) const
         copy_query_info.partition_filter = query_info.partition_filter->clone();
     if (query_info.input_order_info)
         copy_query_info.input_order_info = std::make_shared<InputOrderInfo>(*query_info.input_order_info);
-    return std::make_unique<TableScanStep>(
+    auto step = std::make_unique<TableScanStep>(
         output_stream.value(),
         storage,
         storage_id,
@@ -1642,6 +1823,8 @@ std::shared_ptr<IQueryPlanStep> TableScanStep::copy(ContextPtr) const
         pushdown_projection,
         pushdown_filter,
         table_output_stream);
+    step->setLazyTopN(lazy_topn_sort_description, lazy_topn_limit);
+    return step;
 }
 
 std::shared_ptr<IStorage> TableScanStep::getStorage() const
@@ -139,6 +139,18 @@ public:
 
     void setReadOrder(SortDescription read_order);
 
+    /// Lazy TopN materialization (see LazyTopNMaterialization rewriter): read only the
+    /// sort columns plus the implicit row locators, sort and cut to the limit, then
+    /// fetch the remaining columns for the surviving rows only. The description refers
+    /// to output symbols; zero limit means the optimization is not applied.
+    void setLazyTopN(SortDescription sort_description, size_t limit)
+    {
+        lazy_topn_sort_description = std::move(sort_description);
+        lazy_topn_limit = limit;
+    }
+    const SortDescription & getLazyTopNSortDescription() const { return lazy_topn_sort_description; }
+    size_t getLazyTopNLimit() const { return lazy_topn_limit; }
+
     void formatOutputStream(ContextPtr context);
 
     bool setLimit(size_t limit, const ContextMutablePtr & context);
@@ -210,6 +222,14 @@ private:
     std::shared_ptr<FilterStep> pushdown_filter;
     DataStream table_output_stream;
 
+    // Sort order and limit for lazy TopN materialization, set by the optimizer.
+    SortDescription lazy_topn_sort_description;
+    size_t lazy_topn_limit = 0;
+
+    // Ready runtime bloom filters collected in rewriteDynamicFilter, re-attached to query_info
+    // after the interpreter rebuilds it; used for granule pruning during index analysis.
+    RuntimeFilterBloomFilters index_prune_runtime_filters;
+
     // just for cascades, in order to distinguish between the same tables.
     Int32 unique_id{0};
     Poco::Logger * log;
@@ -220,6 +240,15 @@ private:
     void rewriteDynamicFilter(ASTSelectQuery * query, const BuildQueryPipelineSettings & build_settings, bool use_expand_pipe);
 
     void aliasColumns(QueryPipeline & pipeline, const BuildQueryPipelineSettings &, const String & pipeline_name);
+
+    // Builds the two-stage pipeline of lazy TopN materialization; returns false when the
+    // scan does not qualify, in which case the caller falls back to a normal read.
+    bool tryLazyTopNRead(
+        QueryPipeline & pipeline,
+        const BuildQueryPipelineSettings & build_context,
+        const StorageSnapshotPtr & storage_snapshot,
+        const SelectQueryOptions & options,
+        size_t max_streams);
     void setQuotaAndLimits(QueryPipeline & pipeline, const SelectQueryOptions & options, const BuildQueryPipelineSettings &);
 
     bool hasFunctionCanUseBitmapIndex() const;
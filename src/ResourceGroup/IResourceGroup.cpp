@@ -21,6 +21,7 @@
 #include <ResourceGroup/VWResourceGroupManager.h>
 #include <Interpreters/ProcessList.h>
 #include <chrono>
+#include <limits>
 
 namespace ProfileEvents
 {
@@ -232,6 +233,25 @@ bool IResourceGroup::internalProcessNext()
     return false;
 }
 
+Int32 IResourceGroup::internalMaxQueuedPriority() const
+{
+    Int32 res = queued_queries.empty() ? std::numeric_limits<Int32>::min() : priority;
+    for (const auto & item : children)
+        res = std::max(res, item.second->internalMaxQueuedPriority());
+    return res;
+}
+
+/// Groups with a larger priority value are latency-class. While one of them still has
+/// queued queries after a processing round, lower-priority groups with running queries
+/// are asked to donate cores: their pipeline threads briefly pause at operator
+/// boundaries instead of being requeued, which frees CPU without killing the query.
+void IResourceGroup::internalUpdateYieldFlags(Int32 starved_priority)
+{
+    setYieldRequested(!running_queries.empty() && priority < starved_priority);
+    for (const auto & item : children)
+        item.second->internalUpdateYieldFlags(starved_priority);
+}
+
 void IResourceGroup::setRoot()
 {
     root = this;
@@ -254,6 +274,7 @@ void IResourceGroup::processQueuedQueues()
         processed = true;
     }
     if (processed) root->can_run.notify_all();
+    internalUpdateYieldFlags(internalMaxQueuedPriority());
 }
 
 ResourceGroupInfo IResourceGroup::getInfo() const
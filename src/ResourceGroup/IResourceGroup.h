@@ -163,6 +163,15 @@ public:
     Int32 getPriority() const { return priority; }
     void setPriority(Int32 priority_) { priority = priority_; }
 
+    /// Cooperative preemption: while set, pipeline threads of queries running in this
+    /// group donate their cores at operator boundaries, see PipelineExecutor::executeStepImpl.
+    bool shouldYield() const { return yield_requested.load(std::memory_order_relaxed); }
+    void setYieldRequested(bool yield_requested_)
+    {
+        if (yield_requested.load(std::memory_order_relaxed) != yield_requested_)
+            yield_requested.store(yield_requested_, std::memory_order_relaxed);
+    }
+
     UInt64 getLastUsed() const { return last_used; }
     void setLastUsed(UInt64 last_used_) { last_used.store(last_used_, std::memory_order_release); }
 
@@ -199,6 +208,10 @@ protected:
     void internalRefreshStats();
     // Executes queue management, i.e. running of queued queries
     bool internalProcessNext();
+    // Highest priority among groups of this subtree that still have queued queries
+    Int32 internalMaxQueuedPriority() const;
+    // Asks lower-priority groups with running queries to yield cores to starved groups
+    void internalUpdateYieldFlags(Int32 starved_priority);
     Container::iterator enqueueQuery(Element & element);
     Container::iterator runQuery(Element & element);
 
@@ -219,6 +232,7 @@ protected:
     std::atomic<UInt64> queued_time_total_ms = 0;
     std::atomic<UInt64> running_time_total_ms = 0;
     std::atomic<bool> in_use = true;
+    std::atomic<bool> yield_requested = false;
     std::list<IResourceGroup *> eligible_groups;
     std::list<IResourceGroup *>::iterator eligible_iterator;
     Container running_queries;
@@ -1558,6 +1558,13 @@ void TCPHandler::receiveQuery()
     state.timeout_setter = std::make_unique<TimeoutSetter>(socket(), settings.receive_timeout, settings.send_timeout);
 }
 
+/// Note for anyone tempted to add a separate "lightweight" protocol for high-QPS point
+/// reads: the per-query costs this connection already avoids or amortizes are session
+/// setup (named CNCH sessions pool a context per transaction/session and are reused
+/// below) and planning (the optimizer plan cache keyed on the query AST). What remains
+/// per query is one context copy plus settings deserialization, which is small compared
+/// to parse/plan/schedule; a second endpoint would duplicate authentication, access
+/// control and transaction plumbing for little gain. Speed up the shared path instead.
 void TCPHandler::receiveCnchQuery()
 {
     UInt64 stage = 0;
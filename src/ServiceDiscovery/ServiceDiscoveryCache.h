@@ -15,9 +15,9 @@
 
 #pragma once
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
-#include <shared_mutex>
 
 namespace DB
 {
@@ -45,31 +45,53 @@ struct SDCacheValue {
    time_t last_update;
 };
 
-template<typename Tendpoint>
-class ServiceDiscoveryCache
+/** Map of the current topology kept as an immutable snapshot behind an atomically
+  * swapped shared_ptr (same idea as MultiVersion). Lookups on RPC hot paths are a
+  * pointer load plus a hash probe and never take a lock; updates copy the map under
+  * the writer mutex and swap the snapshot in, so refreshes never stall readers.
+  */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class SDSnapshotMap
 {
 public:
-    bool get(const SDCacheKey & key, SDCacheValue<Tendpoint> & value)
+    bool get(const Key & key, Value & value) const
     {
-        std::shared_lock<std::shared_mutex> lock(mutex);
-        if (cache.find(key) == cache.end())
+        auto current = std::atomic_load_explicit(&snapshot, std::memory_order_acquire);
+        if (!current)
+            return false;
+        auto it = current->find(key);
+        if (it == current->end())
             return false;
-        value = cache[key];
+        value = it->second;
         return true;
     }
-    void put(const SDCacheKey & key, const SDCacheValue<Tendpoint> & value)
+    void put(const Key & key, const Value & value)
     {
-        std::lock_guard<std::shared_mutex> lock(mutex);
-        cache[key] = value;
+        std::lock_guard<std::mutex> lock(update_mutex);
+        auto current = std::atomic_load_explicit(&snapshot, std::memory_order_acquire);
+        auto updated = current ? std::make_shared<Map>(*current) : std::make_shared<Map>();
+        (*updated)[key] = value;
+        std::atomic_store_explicit(&snapshot, std::shared_ptr<const Map>(std::move(updated)), std::memory_order_release);
     }
     void clear()
     {
-        std::lock_guard<std::shared_mutex> lock(mutex);
-        cache.clear();
+        std::lock_guard<std::mutex> lock(update_mutex);
+        std::atomic_store_explicit(&snapshot, std::shared_ptr<const Map>{}, std::memory_order_release);
     }
 private:
-    using Map = std::unordered_map<SDCacheKey, SDCacheValue<Tendpoint>, hash_fn>;
-    Map cache;
-    std::shared_mutex mutex;
+    using Map = std::unordered_map<Key, Value, Hash>;
+    std::shared_ptr<const Map> snapshot;
+    std::mutex update_mutex;
+};
+
+template<typename Tendpoint>
+class ServiceDiscoveryCache
+{
+public:
+    bool get(const SDCacheKey & key, SDCacheValue<Tendpoint> & value) const { return impl.get(key, value); }
+    void put(const SDCacheKey & key, const SDCacheValue<Tendpoint> & value) { impl.put(key, value); }
+    void clear() { impl.clear(); }
+private:
+    SDSnapshotMap<SDCacheKey, SDCacheValue<Tendpoint>, hash_fn> impl;
 };
 }
@@ -21,7 +21,6 @@
 #include <Common/ProfileEvents.h>
 #include <Common/CurrentMetrics.h>
 #include <common/logger_useful.h>
-#include <mutex>
 
 namespace ProfileEvents
 {
@@ -289,16 +288,16 @@ std::vector<String> ServiceDiscoveryDNS::resolveHost(const DNSClientPtr & client
 
 std::vector<String> ServiceDiscoveryDNS::resolveHostFromCache(const DNSClientPtr & client, const String & a4_query)
 {
-    std::lock_guard<std::mutex> lock(mutexHost);
-    auto it = cacheHost.find(a4_query);
+    cacheValueHost cached;
 
-    // record exists in cache and is not timeout
-    if(it != cacheHost.end() && time(nullptr) - cache_timeout < it->second.last_update)
+    // record exists in cache and is not timeout; snapshot read, no lock on the hot path
+    if(cacheHost.get(a4_query, cached) && time(nullptr) - cache_timeout < cached.last_update)
     {
-        return it->second.value;
+        return cached.value;
     }
 
-    // fetch from upstream as cache miss or cache record timeout
+    // fetch from upstream as cache miss or cache record timeout; done outside any lock,
+    // so concurrent lookups are never stalled behind a dns query
     // 1. in normal case, upstream_res size > 0
     // 2. DNS_E_NXDOMAIN: upstream_res size = 0
     // 3. DNS_E_TEMPFAIL: fallback to tcp, if tcp still fails and is not DNS_E_NXDOMAIN, throw out exception
@@ -306,7 +305,7 @@ std::vector<String> ServiceDiscoveryDNS::resolveHostFromCache(const DNSClientPtr
     std::vector<String> upstream_res = resolveHostFromUpstream(client, a4_query);
     // we will safely update the cache if upstream_res size > 0
     if(upstream_res.size() > 0)
-        cacheHost[a4_query] = {upstream_res, time(nullptr)};
+        cacheHost.put(a4_query, {upstream_res, time(nullptr)});
     return upstream_res;
 }
 
@@ -374,13 +373,12 @@ int ServiceDiscoveryDNS::resolvePort(const DNSClientPtr & client, const String &
 
 int ServiceDiscoveryDNS::resolvePortFromCache(const DNSClientPtr & client, const String & srv_query)
 {
-    std::lock_guard<std::mutex> lock(mutexPort);
-    auto it = cachePort.find(srv_query);
+    cacheValuePort cached;
 
-    // record exists in cache and is not timeout
-    if(it != cachePort.end() && time(nullptr) - cache_timeout < it->second.last_update)
+    // record exists in cache and is not timeout; snapshot read, no lock on the hot path
+    if(cachePort.get(srv_query, cached) && time(nullptr) - cache_timeout < cached.last_update)
     {
-        return it->second.value;
+        return cached.value;
     }
 
     // fetch from upstream as cache miss or cache record timeout
@@ -391,7 +389,7 @@ int ServiceDiscoveryDNS::resolvePortFromCache(const DNSClientPtr & client, const
     int upstream_res = resolvePortFromUpstream(client, srv_query);
     // we will safely update the cache if upstream_res > 0
     if (upstream_res > 0)
-        cachePort[srv_query] = {upstream_res, time(nullptr)};
+        cachePort.put(srv_query, {upstream_res, time(nullptr)});
     return upstream_res;
 }
 
@@ -445,13 +443,12 @@ String ServiceDiscoveryDNS::resolveHostname(const DNSClientPtr & client, const S
 
 String ServiceDiscoveryDNS::resolveHostnameFromCache(const DNSClientPtr & client, const String & ptr_query)
 {
-    std::lock_guard<std::mutex> lock(mutexHostname);
-    auto it = cacheHostname.find(ptr_query);
+    cacheValueHostname cached;
 
-    // record exists in cache and is not timeout
-    if(it != cacheHostname.end() && time(nullptr) - cache_timeout < it->second.last_update)
+    // record exists in cache and is not timeout; snapshot read, no lock on the hot path
+    if(cacheHostname.get(ptr_query, cached) && time(nullptr) - cache_timeout < cached.last_update)
     {
-        return it->second.value;
+        return cached.value;
     }
 
     // fetch from upstream as cache miss or cache record timeout
@@ -462,7 +459,7 @@ String ServiceDiscoveryDNS::resolveHostnameFromCache(const DNSClientPtr & client
     String upstream_res = resolveHostnameFromUpstream(client, ptr_query);
     // so we will safely update the cache if upstream_res != ""
     if (upstream_res != "")
-        cacheHostname[ptr_query] = {upstream_res, time(nullptr)};
+        cacheHostname.put(ptr_query, {upstream_res, time(nullptr)});
     return upstream_res;
 }
 
@@ -16,12 +16,12 @@
 #pragma once
 #include <ServiceDiscovery/IServiceDiscovery.h>
 #include <ServiceDiscovery/DNSResolver.h>
+#include <ServiceDiscovery/ServiceDiscoveryCache.h>
 #include <Poco/Util/AbstractConfiguration.h>
 #include <memory>
 #include <map>
 #include <unordered_map>
 #include <Poco/Logger.h>
-#include <mutex>
 #include <string>
 
 namespace DB
@@ -104,10 +104,6 @@ private:
     static String makeSrvQuery(const String & service_name, const String & port_name);
     static String makeString(const String & host, const String & port);
 
-    std::mutex mutexHost;
-    std::mutex mutexPort;
-    std::mutex mutexHostname;
-
     struct cacheValueHost
     {
         std::vector<String> value;
@@ -128,9 +124,10 @@ private:
         time_t last_update;
     };
 
-    std::unordered_map<String, cacheValueHost> cacheHost;
-    std::unordered_map<String, cacheValuePort> cachePort;
-    std::unordered_map<String, cacheValueHostname> cacheHostname;
+    /// Snapshot maps: lookups are lock-free, upstream refreshes swap a new snapshot in.
+    SDSnapshotMap<String, cacheValueHost> cacheHost;
+    SDSnapshotMap<String, cacheValuePort> cachePort;
+    SDSnapshotMap<String, cacheValueHostname> cacheHostname;
 public:
     // for TEST ONLY;
     void clearCache(){ cacheHost.clear(); cachePort.clear(); cacheHostname.clear();}
@@ -29,6 +29,9 @@ String Statistics::CollectorSettings::toJsonStr() const
     if (sample_ratio != default_settings.sample_ratio)
         json.set("sample_ratio", sample_ratio);
 
+    if (full_ndv_sample_threshold != default_settings.full_ndv_sample_threshold)
+        json.set("full_ndv_sample_threshold", full_ndv_sample_threshold);
+
     if (accurate_sample_ndv != default_settings.accurate_sample_ndv)
         json.set("accurate_sample_ndv", SettingFieldStatisticsAccurateSampleNdvModeTraits::toString(accurate_sample_ndv));
 
@@ -72,6 +75,9 @@ void Statistics::CollectorSettings::fromJsonStr(const String & json_str)
     if (object->has("sample_ratio"))
         sample_ratio = object->get("sample_ratio").convert<double>();
 
+    if (object->has("full_ndv_sample_threshold"))
+        full_ndv_sample_threshold = object->get("full_ndv_sample_threshold").convert<UInt64>();
+
     if (object->has("accurate_sample_ndv"))
         accurate_sample_ndv
             = SettingFieldStatisticsAccurateSampleNdvModeTraits::fromString(object->get("accurate_sample_ndv").convert<String>());
@@ -26,6 +26,7 @@ struct CollectorSettings
     bool enable_sample = true;
     UInt64 sample_row_count = 40000000;
     double sample_ratio = 0.01;
+    UInt64 full_ndv_sample_threshold = 0;
     StatisticsAccurateSampleNdvMode accurate_sample_ndv = StatisticsAccurateSampleNdvMode::AUTO;
     StatisticsCachePolicy cache_policy = StatisticsCachePolicy::Default;
     bool if_not_exists = false;
@@ -48,6 +49,7 @@ struct CollectorSettings
         enable_sample = settings.statistics_enable_sample;
         sample_row_count = settings.statistics_sample_row_count;
         sample_ratio = settings.statistics_sample_ratio;
+        full_ndv_sample_threshold = settings.statistics_full_ndv_sample_threshold;
         accurate_sample_ndv = settings.statistics_accurate_sample_ndv;
         cache_policy = settings.statistics_cache_policy;
         histogram_bucket_size = settings.statistics_histogram_bucket_size;
@@ -17,6 +17,7 @@
 #include <Statistics/CollectStep.h>
 #include <Statistics/CollectorSettings.h>
 #include <Statistics/ParseUtils.h>
+#include <Statistics/ScaleAlgorithm.h>
 #include <Statistics/StatsHllSketch.h>
 #include <Statistics/StatsNdvBuckets.h>
 #include <Statistics/TableHandler.h>
@@ -27,10 +28,14 @@
 namespace DB::Statistics
 {
 
+/// One id per granule, keep in sync with SampleCollectStep.cpp.
+static const String virtual_mark_id = "cityHash64(blockNumber(), _part_uuid, intDiv(rowNumberInBlock(), 8192))";
+
 class FirstFullColumnHandler : public ColumnHandlerBase
 {
 public:
-    explicit FirstFullColumnHandler(HandlerContext & handler_context_, const NameAndTypePair & col_desc) : handler_context(handler_context_)
+    explicit FirstFullColumnHandler(HandlerContext & handler_context_, const NameAndTypePair & col_desc, bool sample_ndv_)
+        : handler_context(handler_context_), sample_ndv(sample_ndv_)
     {
         col_name = col_desc.name;
         data_type = decayDataType(col_desc.type);
@@ -47,6 +52,13 @@ public:
         sqls.emplace_back(count_sql);
         auto ndv_sql = fmt::format(FMT_STRING("uniq({})"), wrapped_col_name);
         sqls.emplace_back(ndv_sql);
+        if (sample_ndv)
+        {
+            /// The per-granule sketch gives the block ndv the scale algorithm needs
+            /// to extrapolate the sampled ndv to the whole table.
+            auto block_ndv_sql = fmt::format(FMT_STRING("hll(cityHash64({}, {}))"), wrapped_col_name, virtual_mark_id);
+            sqls.emplace_back(block_ndv_sql);
+        }
         if (config.need_histogram)
         {
             auto kll_log_k = handler_context.settings.kll_sketch_log_k;
@@ -91,8 +103,33 @@ public:
 
             // hll(col)
             double ndv = getSingleValue<UInt64>(block, index_offset++);
-            result.is_ndv_reliable = true;
-            result.ndv_value = std::min(ndv, nonnull_count);
+            if (sample_ndv)
+            {
+                // hll(cityHash64(col, __mark_id))
+                auto block_ndv_blob = getSingleValue<std::string_view>(block, index_offset++);
+                // the first-step query ran over a block sample, so count(*) here is the sample size
+                double sample_row_count = handler_context.query_row_count.value_or(0);
+
+                /// TODO: remove this hack when snapshot is ready (same as the sample collect step)
+                if (full_count < sample_row_count)
+                {
+                    handler_context.full_count = sample_row_count;
+                    full_count = sample_row_count;
+                }
+
+                double block_ndv = getNdvFromSketchBinary(block_ndv_blob);
+                block_ndv = std::min(block_ndv, nonnull_count);
+                auto sampled_ndv = std::min(ndv, block_ndv);
+
+                result.nonnull_count = scaleCount(full_count, sample_row_count, nonnull_count);
+                result.is_ndv_reliable = true;
+                result.ndv_value = std::min(scaleNdv(full_count, sample_row_count, sampled_ndv, block_ndv), result.nonnull_count);
+            }
+            else
+            {
+                result.is_ndv_reliable = true;
+                result.ndv_value = std::min(ndv, nonnull_count);
+            }
 
             if (config.need_histogram)
             {
@@ -148,6 +185,8 @@ public:
 
 private:
     HandlerContext & handler_context;
+    /// Estimate ndv from a block sample instead of scanning every row.
+    bool sample_ndv = false;
     String col_name;
     DataTypePtr data_type;
     ColumnCollectConfig config;
@@ -213,17 +252,44 @@ class StatisticsCollectorStepFull : public CollectStep
 public:
     explicit StatisticsCollectorStepFull(StatisticsCollector & core_) : CollectStep(core_) { }
 
+    /// On tables above the threshold, running the first step over every row only for ndv
+    /// is a waste: a block sample plus the scale algorithm gives acceptable error at a
+    /// fraction of the scan.
+    bool needSampleNdv() const
+    {
+        auto threshold = handler_context.settings.full_ndv_sample_threshold;
+        return threshold != 0 && handler_context.full_count > threshold;
+    }
+
+    String getSampleTail() const
+    {
+        auto row_count = handler_context.full_count;
+        const auto & settings = handler_context.settings;
+
+        if (settings.sample_ratio * row_count < settings.sample_row_count)
+        {
+            return fmt::format(FMT_STRING(" SAMPLE {}"), settings.sample_row_count);
+        }
+        else
+        {
+            return fmt::format(FMT_STRING(" SAMPLE {}"), settings.sample_ratio);
+        }
+    }
+
     void collectFirstStep(const ColumnDescVector & cols_desc)
     {
+        bool sample_ndv = needSampleNdv();
         TableHandler table_handler(table_info);
         table_handler.registerHandler(std::make_unique<RowCountHandler>(handler_context));
 
         for (const auto & col_desc : cols_desc)
         {
-            table_handler.registerHandler(std::make_unique<FirstFullColumnHandler>(handler_context, col_desc));
+            table_handler.registerHandler(std::make_unique<FirstFullColumnHandler>(handler_context, col_desc, sample_ndv));
         }
 
         auto sql = table_handler.getFullSql();
+        if (sample_ndv)
+            sql += getSampleTail();
 
         auto helper = SubqueryHelper::create(context, sql, true);
         auto block = getOnlyRowFrom(helper);
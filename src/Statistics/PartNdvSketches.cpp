@@ -0,0 +1,113 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Statistics/PartNdvSketches.h>
+
+#include <Columns/ColumnNullable.h>
+#include <DataTypes/DataTypeNullable.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+
+namespace DB::Statistics
+{
+
+bool PartNdvSketches::typeSupported(const DataTypePtr & type)
+{
+    auto nested = removeNullable(type);
+    return isColumnedAsNumber(nested) || isStringOrFixedString(nested);
+}
+
+void PartNdvSketches::update(const Block & block)
+{
+    for (const auto & elem : block)
+    {
+        if (!elem.column || !typeSupported(elem.type))
+            continue;
+
+        auto & entry = column_sketches[elem.name];
+        const IColumn * column = elem.column.get();
+        const NullMap * null_map = nullptr;
+        if (const auto * nullable = checkAndGetColumn<ColumnNullable>(column))
+        {
+            null_map = &nullable->getNullMapData();
+            column = &nullable->getNestedColumn();
+        }
+
+        size_t rows = column->size();
+        entry.rows += rows;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            if (null_map && (*null_map)[i])
+                continue;
+            auto value = column->getDataAt(i);
+            entry.sketch.update(std::string_view(value.data, value.size));
+        }
+    }
+}
+
+void PartNdvSketches::merge(const PartNdvSketches & rhs)
+{
+    for (const auto & [name, rhs_entry] : rhs.column_sketches)
+    {
+        auto it = column_sketches.find(name);
+        if (it == column_sketches.end())
+        {
+            column_sketches.emplace(name, rhs_entry);
+        }
+        else
+        {
+            it->second.rows += rhs_entry.rows;
+            it->second.sketch.merge(rhs_entry.sketch);
+        }
+    }
+}
+
+std::optional<double> PartNdvSketches::estimateNdv(const String & column) const
+{
+    auto it = column_sketches.find(column);
+    if (it == column_sketches.end())
+        return std::nullopt;
+    return it->second.sketch.getEstimate();
+}
+
+void PartNdvSketches::write(WriteBuffer & buf) const
+{
+    writeVarUInt(column_sketches.size(), buf);
+    for (const auto & [name, entry] : column_sketches)
+    {
+        writeBinary(name, buf);
+        writeVarUInt(entry.rows, buf);
+        writeBinary(entry.sketch.serialize(), buf);
+    }
+}
+
+void PartNdvSketches::read(ReadBuffer & buf)
+{
+    size_t size = 0;
+    readVarUInt(size, buf);
+    for (size_t i = 0; i < size; ++i)
+    {
+        String name;
+        readBinary(name, buf);
+        ColumnSketch entry;
+        readVarUInt(entry.rows, buf);
+        String blob;
+        readBinary(blob, buf);
+        entry.sketch.deserialize(blob);
+        column_sketches.emplace(std::move(name), std::move(entry));
+    }
+}
+
+}
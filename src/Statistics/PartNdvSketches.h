@@ -0,0 +1,68 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <map>
+#include <optional>
+#include <Core/Block.h>
+#include <Statistics/StatsHllSketch.h>
+
+namespace DB
+{
+class ReadBuffer;
+class WriteBuffer;
+}
+
+namespace DB::Statistics
+{
+
+/// Per column NDV sketches of one data part, computed while the part is written and stored
+/// inside the part as ndv_sketches.stats. Sketches of different parts merge losslessly
+/// (StatsHllSketch), so table level NDV can be maintained incrementally on part commit
+/// instead of recollecting statistics with full or sampled scans.
+class PartNdvSketches
+{
+public:
+    static constexpr auto FILE_NAME = "ndv_sketches.stats";
+
+    /// Whether values of the type can be fed into the sketch byte-wise.
+    static bool typeSupported(const DataTypePtr & type);
+
+    /// Update the sketches with the non null values of every supported column of the block.
+    void update(const Block & block);
+
+    void merge(const PartNdvSketches & rhs);
+
+    bool empty() const { return column_sketches.empty(); }
+
+    /// NDV estimate for a column, or std::nullopt when the column carries no sketch.
+    std::optional<double> estimateNdv(const String & column) const;
+
+    void write(WriteBuffer & buf) const;
+    void read(ReadBuffer & buf);
+
+private:
+    struct ColumnSketch
+    {
+        /// Rows the sketch has seen, so a consumer can detect columns which were not
+        /// present in every written block (e.g. gathered by a vertical merge).
+        UInt64 rows = 0;
+        StatsHllSketch sketch;
+    };
+
+    std::map<String, ColumnSketch> column_sketches;
+};
+
+}
@@ -50,6 +50,9 @@ public:
         }
     }
 
+    /// Feed a value byte-wise, for callers which iterate columns without knowing the type.
+    void update(std::string_view value) { data.update(value.data(), value.size()); }
+
     void merge(const StatsHllSketch & rhs)
     {
         if (!un_opt.has_value())
@@ -0,0 +1,64 @@
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
+#include <Core/Block.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <Statistics/PartNdvSketches.h>
+#include <gtest/gtest.h>
+
+using namespace DB;
+using namespace DB::Statistics;
+
+static Block makeBlock(size_t rows, UInt64 offset)
+{
+    auto num_col = ColumnUInt64::create();
+    auto str_col = ColumnString::create();
+    for (size_t i = 0; i < rows; ++i)
+    {
+        num_col->insertValue((offset + i) % 50);
+        auto str = std::to_string((offset + i) % 20);
+        str_col->insertData(str.data(), str.size());
+    }
+    ColumnsWithTypeAndName cols;
+    cols.emplace_back(std::move(num_col), std::make_shared<DataTypeUInt64>(), "num");
+    cols.emplace_back(std::move(str_col), std::make_shared<DataTypeString>(), "str");
+    return Block{cols};
+}
+
+TEST(PartNdvSketches, UpdateAndEstimate)
+{
+    PartNdvSketches sketches;
+    EXPECT_TRUE(sketches.empty());
+
+    sketches.update(makeBlock(1000, 0));
+    ASSERT_FALSE(sketches.empty());
+    EXPECT_NEAR(*sketches.estimateNdv("num"), 50, 3);
+    EXPECT_NEAR(*sketches.estimateNdv("str"), 20, 2);
+    EXPECT_FALSE(sketches.estimateNdv("missing").has_value());
+}
+
+TEST(PartNdvSketches, SerdeAndMerge)
+{
+    PartNdvSketches first;
+    PartNdvSketches second;
+    first.update(makeBlock(500, 0));
+    second.update(makeBlock(500, 25));
+
+    String blob;
+    {
+        WriteBufferFromString out(blob);
+        first.write(out);
+    }
+    PartNdvSketches restored;
+    {
+        ReadBufferFromString in(blob);
+        restored.read(in);
+    }
+    EXPECT_NEAR(*restored.estimateNdv("num"), *first.estimateNdv("num"), 0.1);
+
+    restored.merge(second);
+    EXPECT_NEAR(*restored.estimateNdv("num"), 50, 3);
+    EXPECT_NEAR(*restored.estimateNdv("str"), 20, 2);
+}
@@ -91,6 +91,15 @@ public:
     std::atomic<UInt64> gctime = {0};
     std::shared_ptr<PartitionMetrics> metrics_ptr;
 
+    /// Query access statistics for disk cache auto tiering, see
+    /// PartCacheManager::runDiskCacheAutoTiering. `access_count` is bumped on every part
+    /// read of the partition and halved each tiering cycle, so together with
+    /// `last_access_time` (seconds) it approximates both frequency and recency.
+    /// `disk_cache_pinned` marks partitions the tiering task keeps preloaded.
+    std::atomic<UInt64> access_count = {0};
+    std::atomic<UInt64> last_access_time = {0};
+    std::atomic<bool> disk_cache_pinned = {false};
+
     inline PartitionLockHolder readLock() const
     {
         return partition_mutex->getLock(RWLockImpl::Read, RWLockImpl::NO_QUERY);
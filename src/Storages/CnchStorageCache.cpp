@@ -13,26 +13,59 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include <Storages/CnchStorageCache.h>
 #include <Storages/IStorage.h>
 
 namespace DB
 {
 
-void CnchStorageCache::insert(const StorageID & storage_id, const UInt64 ts, const StoragePtr & storage_ptr)
+void CnchStorageCache::Shard::onEvict(const Key & key)
+{
+    // Note, We already get cache lock when onEvict calls. No need to get shard lock here
+    std::unique_lock<std::shared_mutex> mapping_lock(parent.mapping_mutex);
+    parent.uuid_to_table_names.right.erase(key);
+}
+
+CnchStorageCache::CnchStorageCache(size_t cache_size)
 {
-    std::unique_lock<std::shared_mutex> lock(cache_mutex);
+    size_t shard_size = std::max<size_t>(cache_size / NUM_SHARDS, 1);
+    for (auto & shard : shards)
+        shard = std::make_unique<Shard>(*this, shard_size);
+}
 
+void CnchStorageCache::insert(const StorageID & storage_id, const UInt64 ts, const StoragePtr & storage_ptr)
+{
     TableName full_name = std::make_pair(storage_id.database_name, storage_id.table_name);
-    auto cached = Base::get(full_name);
-    if (cached && cached->first > ts)
-        return;
-    auto new_data = std::make_shared<TableData>(ts, storage_ptr);
-    Base::set(full_name, new_data);
-    if (inner_container)
-        inner_container->insert(storage_id.database_name, full_name);
-    if (storage_id.hasUUID())
+    auto & shard = shardFor(full_name);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto cached = shard.get(full_name);
+    /// Copy-on-write: readers may still hold the old TableData without the shard lock.
+    auto new_data = std::make_shared<TableData>();
+    if (cached)
+        new_data->versions = cached->versions;
+    auto & versions = new_data->versions;
+    auto it = std::lower_bound(
+        versions.begin(), versions.end(), ts, [](const auto & version, UInt64 commit_ts) { return version.first > commit_ts; });
+    if (it != versions.end() && it->first == ts)
+    {
+        /// Fill in a placeholder published by ALTER, never downgrade a built object.
+        if (storage_ptr)
+            it->second = storage_ptr;
+    }
+    else
+        versions.insert(it, {ts, storage_ptr});
+    if (versions.size() > TableData::MAX_VERSIONS)
+        versions.resize(TableData::MAX_VERSIONS);
+    shard.set(full_name, new_data);
+    shard.insertToContainer(storage_id.database_name, full_name);
+    /// The bimap tracks the uuid of the newest version only; a merge of an older version
+    /// (e.g. under a rename the name maps to a different uuid already) must not clobber it.
+    if (storage_id.hasUUID() && versions.front().first == ts)
     {
+        std::unique_lock<std::shared_mutex> mapping_lock(mapping_mutex);
         // erase both by name and uuid to make sure update to bimap succeed.
         uuid_to_table_names.left.erase(storage_id.uuid);
         uuid_to_table_names.right.erase(full_name);
@@ -40,72 +73,127 @@ void CnchStorageCache::insert(const StorageID & storage_id, const UInt64 ts, con
     }
 }
 
-StoragePtr CnchStorageCache::getImpl(const TableName & table_name)
+StoragePtr CnchStorageCache::get(const String & db, const String & table)
 {
-    auto table_data_ptr = Base::get(table_name);
+    TableName table_name = std::make_pair(db, table);
+    auto & shard = shardFor(table_name);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto table_data_ptr = shard.get(table_name);
     if (table_data_ptr)
-        return table_data_ptr->second;
+        return table_data_ptr->latest();
     else
         return {};
 }
 
-StoragePtr CnchStorageCache::get(const String & db, const String & table)
+StoragePtr CnchStorageCache::get(const String & db, const String & table, const UInt64 ts)
 {
-    std::shared_lock<std::shared_mutex> lock(cache_mutex);
-    return getImpl(std::make_pair(db, table));
+    TableName table_name = std::make_pair(db, table);
+    auto & shard = shardFor(table_name);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto table_data_ptr = shard.get(table_name);
+    if (table_data_ptr)
+        return table_data_ptr->getByTs(ts);
+    else
+        return {};
 }
 
 StoragePtr CnchStorageCache::get(const UUID & uuid)
 {
-    std::shared_lock<std::shared_mutex> lock(cache_mutex);
-    auto it = uuid_to_table_names.left.find(uuid);
-    if (it == uuid_to_table_names.left.end())
+    TableName table_name;
     {
-        return {};
+        std::shared_lock<std::shared_mutex> mapping_lock(mapping_mutex);
+        auto it = uuid_to_table_names.left.find(uuid);
+        if (it == uuid_to_table_names.left.end())
+            return {};
+        table_name = it->second;
     }
-    return getImpl(it->second);
+    return get(table_name.first, table_name.second);
 }
 
-void CnchStorageCache::removeUnlock(const String & db, const String & table)
+StoragePtr CnchStorageCache::get(const UUID & uuid, const UInt64 ts)
+{
+    TableName table_name;
+    {
+        std::shared_lock<std::shared_mutex> mapping_lock(mapping_mutex);
+        auto it = uuid_to_table_names.left.find(uuid);
+        if (it == uuid_to_table_names.left.end())
+            return {};
+        table_name = it->second;
+    }
+    auto storage = get(table_name.first, table_name.second, ts);
+    /// Under a rename an old version kept for the same name belongs to another uuid.
+    if (storage && storage->getStorageUUID() != uuid)
+        return {};
+    return storage;
+}
+
+void CnchStorageCache::removeUnlock(Shard & shard, const String & db, const String & table)
 {
     TableName table_name = std::make_pair(db, table);
-    uuid_to_table_names.right.erase(table_name);
-    Base::remove(table_name);
+    {
+        std::unique_lock<std::shared_mutex> mapping_lock(mapping_mutex);
+        uuid_to_table_names.right.erase(table_name);
+    }
+    shard.remove(table_name);
 }
 
 void CnchStorageCache::remove(const String & db, const String & table)
 {
-    std::unique_lock<std::shared_mutex> lock(cache_mutex);
-    removeUnlock(db, table);
+    auto & shard = shardFor(std::make_pair(db, table));
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    removeUnlock(shard, db, table);
 }
 
 void CnchStorageCache::remove(const String & db)
 {
-    std::unique_lock<std::shared_mutex> lock(cache_mutex);
-    if (!inner_container)
-        return;
-
-    const auto & tables = inner_container->getKeys(db);
-    for (const auto & table : tables)
-        removeUnlock(table.first, table.second);
+    for (auto & shard : shards)
+    {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        const auto & tables = shard->getKeysOfDatabase(db);
+        for (const auto & table : tables)
+            removeUnlock(*shard, table.first, table.second);
+    }
 }
 
 void CnchStorageCache::clear()
 {
-    std::unique_lock<std::shared_mutex> lock(cache_mutex);
-    Base::reset();
+    for (auto & shard : shards)
+    {
+        std::unique_lock<std::shared_mutex> lock(shard->mutex);
+        shard->reset();
+    }
+    std::unique_lock<std::shared_mutex> mapping_lock(mapping_mutex);
+    uuid_to_table_names.clear();
 }
 
-size_t CnchStorageCache::uuidNameMappingSize()
+size_t CnchStorageCache::count() const
 {
-    std::unique_lock<std::shared_mutex> lock(cache_mutex);
-    return uuid_to_table_names.size();
+    size_t res = 0;
+    for (const auto & shard : shards)
+        res += shard->count();
+    return res;
+}
+
+size_t CnchStorageCache::weight() const
+{
+    size_t res = 0;
+    for (const auto & shard : shards)
+        res += shard->weight();
+    return res;
 }
 
-void CnchStorageCache::onEvict(const Key & key)
+size_t CnchStorageCache::innerContainerSize() const
 {
-    // Note, We already get cache lock when onEvict calls. No need to get lock here
-    uuid_to_table_names.right.erase(key);
+    size_t res = 0;
+    for (const auto & shard : shards)
+        res += shard->innerContainerSize();
+    return res;
+}
+
+size_t CnchStorageCache::uuidNameMappingSize()
+{
+    std::shared_lock<std::shared_mutex> mapping_lock(mapping_mutex);
+    return uuid_to_table_names.size();
 }
 
 }
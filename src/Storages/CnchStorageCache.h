@@ -19,6 +19,8 @@
 #include <Core/UUID.h>
 #include <Core/Types.h>
 #include <boost/bimap/bimap.hpp>
+#include <array>
+#include <memory>
 #include <shared_mutex>
 #include <city.h>
 
@@ -30,7 +32,29 @@ using StoragePtr = std::shared_ptr<IStorage>;
 struct StorageID;
 
 using TableName = std::pair<String, String>;  // database and table pair
-using TableData = std::pair<UInt64, StoragePtr>; //identify table with commit time
+
+/// Live versions of one table, ordered newest first. A few previous versions are kept so
+/// that queries whose read snapshot predates a fresh ALTER keep using the storage object
+/// they can see instead of rebuilding it from the metastore.
+struct TableData
+{
+    static constexpr size_t MAX_VERSIONS = 3;
+
+    /// (commit time, storage); the storage may be nullptr for a version whose object has
+    /// not been constructed yet, ALTER publishes such a placeholder for the new version.
+    std::vector<std::pair<UInt64, StoragePtr>> versions;
+
+    StoragePtr latest() const { return versions.empty() ? nullptr : versions.front().second; }
+
+    /// Newest version visible at read snapshot `ts`.
+    StoragePtr getByTs(UInt64 ts) const
+    {
+        for (const auto & [commit_ts, storage] : versions)
+            if (commit_ts <= ts)
+                return storage;
+        return nullptr;
+    }
+};
 
 struct TableNameHash
 {
@@ -40,24 +64,63 @@ struct TableNameHash
     }
 };
 
-
-class CnchStorageCache : public LRUCache<TableName, TableData, TableNameHash>
+/// Storage cache sharded by table name hash. Planning storms touch many tables at
+/// once, so each shard is a separate LRU behind its own lock instead of one cache
+/// behind a global mutex. Every entry keeps a short list of versions stamped with
+/// their commit times, so an outdated storage never overwrites a newer one while
+/// snapshot reads started before an ALTER still find the version they can see.
+class CnchStorageCache
 {
 private:
-    using Base = LRUCache<TableName, TableData, TableNameHash>;
-    std::shared_mutex cache_mutex;
+    class Shard : public LRUCache<TableName, TableData, TableNameHash>
+    {
+    public:
+        Shard(CnchStorageCache & parent_, size_t max_size)
+            : LRUCache<TableName, TableData, TableNameHash>(max_size), parent(parent_)
+        {
+            inner_container = std::make_unique<CacheContainer<Key>>();
+        }
+
+        void insertToContainer(const String & db, const Key & key)
+        {
+            if (inner_container)
+                inner_container->insert(db, key);
+        }
+
+        std::set<Key> getKeysOfDatabase(const String & db)
+        {
+            if (inner_container)
+                return inner_container->getKeys(db);
+            return {};
+        }
+
+        /// Protects compound operations on the shard (check-then-set in insert,
+        /// keeping the LRU and the uuid mapping consistent on remove).
+        std::shared_mutex mutex;
+
+        void onEvict(const Key & key) override;
+
+    private:
+        CnchStorageCache & parent;
+    };
+
+    static constexpr size_t NUM_SHARDS = 16;
+
+    std::array<std::unique_ptr<Shard>, NUM_SHARDS> shards;
+
+    /// Maps table uuid to table name across all shards.
+    std::shared_mutex mapping_mutex;
     boost::bimaps::bimap<UUID, TableName> uuid_to_table_names;
 
-    inline StoragePtr getImpl(const TableName & table_name);
+    Shard & shardFor(const TableName & table_name)
+    {
+        return *shards[TableNameHash{}(table_name) % NUM_SHARDS];
+    }
 
-    inline void removeUnlock(const String & db, const String & table);
+    inline void removeUnlock(Shard & shard, const String & db, const String & table);
 
 public:
-    CnchStorageCache(size_t cache_size)
-        : Base(cache_size)
-    {
-        inner_container = std::make_unique<CacheContainer<Key>>();
-    }
+    explicit CnchStorageCache(size_t cache_size);
 
     /***
      * Insert storage into cache.
@@ -75,12 +138,24 @@ public:
      */
     StoragePtr get(const String & db, const String & table);
 
+    /***
+     * Get the newest cached version of the table visible at read snapshot ts.
+     * @return nullptr if no visible version is cached.
+     */
+    StoragePtr get(const String & db, const String & table, const UInt64 ts);
+
     /***
      * Get storage from cache.
      * @return nullptr if the storage is not cached.
      */
     StoragePtr get(const UUID & uuid);
 
+    /***
+     * Get the newest cached version of the table visible at read snapshot ts.
+     * @return nullptr if no visible version is cached.
+     */
+    StoragePtr get(const UUID & uuid, const UInt64 ts);
+
     /***
      * Remove the storage cache of the table.
      * @param db databasename
@@ -99,15 +174,19 @@ public:
      */
     void clear();
 
+    /// Same as clear(), kept for callers of the former LRUCache interface.
+    void reset() { clear(); }
+
+    size_t count() const;
+
+    size_t weight() const;
+
+    size_t innerContainerSize() const;
+
     /***
     * Return size of bimap for uuid and table name mapping
     */
     size_t uuidNameMappingSize();
-
-    /***
-    * clear mapping between uuid and table name when evict happens.
-    */
-    void onEvict(const Key & key) override;
 };
 
 using CnchStorageCachePtr = std::shared_ptr<CnchStorageCache>;
@@ -151,7 +151,8 @@ BlockCache::BlockCache(Config && config, ValidConfigTag)
           std::move(config.eviction_policy),
           config.num_in_mem_buffers,
           config.num_priorities,
-          config.in_mem_buf_flush_retry_limit}
+          config.in_mem_buf_flush_retry_limit,
+          config.numa_aware_in_mem_buffers}
     , allocator{region_manager, config.num_priorities}
     , reinsertion_policy{makeReinsertionPolicy(config.reinsertion_config)}
 {
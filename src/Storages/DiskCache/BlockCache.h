@@ -51,6 +51,8 @@ public:
         UInt32 clean_regions_pool{1};
         // Number of in-memory buffers where writes ae buffered before flushed.
         UInt32 num_in_mem_buffers{1};
+        // Shard the in-memory buffer pool per NUMA node on multi-socket hosts.
+        bool numa_aware_in_mem_buffers{false};
         bool item_destructor_enabled{false};
         // Maximum number of retry times for in-mem buffer flushing.
         UInt16 in_mem_buf_flush_retry_limit{10};
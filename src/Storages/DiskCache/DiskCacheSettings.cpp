@@ -37,9 +37,11 @@ void DiskCacheSettings::loadFromConfig(const Poco::Util::AbstractConfiguration &
     cache_load_dispatcher_drill_down_level = config.getInt(config_prefix + ".cache_load_dispatcher_drill_down_level", 1);
     cache_set_rate_limit = config.getUInt64(config_prefix + ".cache_set_rate_limit", 0);
     cache_set_throughput_limit = config.getUInt64(config_prefix + ".cache_set_throughput_limit", 0);
+    cache_set_coalesce_segments = config.getUInt64(config_prefix + ".cache_set_coalesce_segments", 0);
     segment_size = config.getUInt64(config_prefix + ".segment_size", 8192);
     hits_to_cache = config.getUInt64(config_prefix + ".hits_to_cache", 2);
     stats_bucket_size = config.getUInt64(config_prefix + ".stats_bucket_size", 10000);
+    scan_admission_max_percent = config.getUInt64(config_prefix + ".scan_admission_max_percent", 0);
     latest_disk_cache_dir = config.getString(config_prefix + ".disk_cache_dir", "part_disk_cache");
     previous_disk_cache_dir = config.getString(config_prefix + ".previous_disk_cache_dir", (disk_cache_name == "simple" || disk_cache_name == "MergeTree" ? "disk_cache,disk_cache_v1,mergetree_disk_cache" : ""));
     meta_cache_size_ratio = config.getUInt(config_prefix + ".meta_cache_size_ratio", 0);
@@ -69,9 +71,11 @@ std::string DiskCacheSettings::toString() const
             "cache_load_dispatcher_drill_down_level": {},
             "cache_set_rate_limit": {},
             "cache_set_throughput_limit": {},
+            "cache_set_coalesce_segments": {},
             "segment_size": {},
             "hits_to_cache": {},
             "stats_bucket_size": {},
+            "scan_admission_max_percent": {},
             "previous_disk_cache_dir": "{}",
             "latest_disk_cache_dir": "{}",
             "meta_cache_size_ratio": "{}",
@@ -90,9 +94,11 @@ std::string DiskCacheSettings::toString() const
         cache_load_dispatcher_drill_down_level,
         cache_set_rate_limit,
         cache_set_throughput_limit,
+        cache_set_coalesce_segments,
         segment_size,
         hits_to_cache,
         stats_bucket_size,
+        scan_admission_max_percent,
         previous_disk_cache_dir,
         latest_disk_cache_dir,
         meta_cache_size_ratio,
@@ -50,11 +50,17 @@ struct DiskCacheSettings
     int cache_load_dispatcher_drill_down_level {1};
     size_t cache_set_rate_limit {0};
     size_t cache_set_throughput_limit {0};
+    // Max number of adjacent segments of one stream the population task may fill with a
+    // single source read and sequential local writes, 0 disables coalescing
+    size_t cache_set_coalesce_segments {0};
 
     size_t segment_size {8192};
     size_t hits_to_cache {2};
     // Size of disk cache statistics bucket size
     size_t stats_bucket_size {10000};
+    // Scans estimated to read more than this percent of cache capacity do not populate the cache
+    // (one huge ad-hoc scan should not evict the hot working set), 0 admits everything
+    size_t scan_admission_max_percent {0};
 
     // load previous folder cached data if it's not empty for compatible when data dir config is changed
     std::string previous_disk_cache_dir{};
@@ -0,0 +1,46 @@
+#include "HiveMetaFileDiskCacheSegment.h"
+
+#include <IO/ReadBufferFromString.h>
+#include <Storages/DiskCache/IDiskCache.h>
+
+namespace DB
+{
+
+HiveMetaFileDiskCacheSegment::HiveMetaFileDiskCacheSegment(
+    DiskPtr remote_disk_, const String & file_path_, size_t file_size_, String meta_data_)
+    : IDiskCacheSegment(0, 0)
+    , remote_disk(std::move(remote_disk_))
+    , file_path(file_path_)
+    , file_size(file_size_)
+    , meta_data(std::move(meta_data_))
+{
+}
+
+String HiveMetaFileDiskCacheSegment::getSegmentKey(const DiskPtr & remote_disk, const String & file_path, size_t file_size)
+{
+    return std::filesystem::path(remote_disk->getPath()) / file_path / fmt::format("{}.meta", file_size);
+}
+
+String HiveMetaFileDiskCacheSegment::getSegmentName() const
+{
+    return getSegmentKey(remote_disk, file_path, file_size);
+}
+
+void HiveMetaFileDiskCacheSegment::cacheToDisk(IDiskCache & disk_cache, bool)
+{
+    Poco::Logger * log = disk_cache.getLogger();
+
+    try
+    {
+        ReadBufferFromString read_buffer(meta_data);
+        disk_cache.set(getSegmentName(), read_buffer, meta_data.size(), false);
+        LOG_TRACE(log, "Cached hive meta file segment {} to disk", getSegmentName());
+    }
+    catch (...)
+    {
+        LOG_ERROR(log, "Failed to cache hive meta file segment to local disk.");
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+    }
+}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Disks/IDisk.h>
+#include <Storages/DiskCache/IDiskCacheSegment.h>
+
+namespace DB
+{
+class IDiskCache;
+
+/// Caches the already parsed footer/metadata bytes of a hive data file (e.g. the parquet
+/// footer with its page indexes), so that later queries planning over the same file do not
+/// pay the remote metadata round trips again. The blob is provided by the caller; caching
+/// never reads from the remote disk.
+class HiveMetaFileDiskCacheSegment : public IDiskCacheSegment
+{
+public:
+    HiveMetaFileDiskCacheSegment(DiskPtr remote_disk_, const String & file_path_, size_t file_size_, String meta_data_);
+
+    /// The file size is part of the key, so an overwritten file misses instead of serving
+    /// a stale footer.
+    static String getSegmentKey(const DiskPtr & remote_disk, const String & file_path, size_t file_size);
+
+    String getSegmentName() const override;
+    void cacheToDisk(IDiskCache & cache, bool throw_exception) override;
+
+private:
+    DiskPtr remote_disk;
+    String file_path;
+    size_t file_size;
+    String meta_data;
+};
+
+}
@@ -26,6 +26,7 @@ namespace ProfileEvents
 {
 extern const Event DiskCacheScheduleCacheTaskMicroseconds;
 extern const Event DiskCacheTaskDropCount;
+extern const Event DiskCacheDuplicateFetchesSkipped;
 }
 
 
@@ -119,6 +120,18 @@ void IDiskCache::shutdown()
         sync_task->deactivate();
 }
 
+bool IDiskCache::tryRegisterInFlightSegment(const String & segment_name)
+{
+    std::lock_guard lock(in_flight_mutex);
+    return in_flight_segments.insert(segment_name).second;
+}
+
+void IDiskCache::unregisterInFlightSegment(const String & segment_name)
+{
+    std::lock_guard lock(in_flight_mutex);
+    in_flight_segments.erase(segment_name);
+}
+
 void IDiskCache::cacheSegmentsToLocalDisk(IDiskCacheSegmentsVector hit_segments, CacheSegmentsCallback callback)
 {
     if (hit_segments.empty())
@@ -127,22 +140,52 @@ void IDiskCache::cacheSegmentsToLocalDisk(IDiskCacheSegmentsVector hit_segments,
     Stopwatch watch;
     SCOPE_EXIT({ ProfileEvents::increment(ProfileEvents::DiskCacheScheduleCacheTaskMicroseconds, watch.elapsedMicroseconds()); });
 
+    /// Concurrent queries missing the same segments each call here; keep only the segments
+    /// no other caching task is fetching yet so every segment hits remote storage once.
+    IDiskCacheSegmentsVector unique_segments;
+    unique_segments.reserve(hit_segments.size());
+    Strings registered_names;
+    registered_names.reserve(hit_segments.size());
+    for (auto & hit_segment : hit_segments)
+    {
+        String segment_name = hit_segment->getSegmentName();
+        if (tryRegisterInFlightSegment(segment_name))
+        {
+            unique_segments.push_back(std::move(hit_segment));
+            registered_names.push_back(std::move(segment_name));
+        }
+        else
+            ProfileEvents::increment(ProfileEvents::DiskCacheDuplicateFetchesSkipped);
+    }
+
+    if (unique_segments.empty())
+        return;
+
     // Notes: split to more tasks?
-    bool success = scheduleCacheTask([this, segments = std::move(hit_segments), cb = callback] {
+    bool success = scheduleCacheTask([this, segments = std::move(unique_segments), cb = callback] {
+        SCOPE_EXIT({
+            for (const auto & segment : segments)
+                unregisterInFlightSegment(segment->getSegmentName());
+        });
         try
         {
             std::exception_ptr first_exception;
-            for (const auto & hit_segment : segments)
+            for (size_t i = 0; i < segments.size();)
             {
+                const auto & hit_segment = segments[i];
+                size_t cached_segments = 1;
                 try
                 {
                     String mark_name = hit_segment->getMarkName();
                     String segment_name = hit_segment->getSegmentName();
                     if ((!mark_name.empty() && !getMetaCache()->get(mark_name).second.empty())
                         && !getDataCache()->get(segment_name).second.empty())
+                    {
+                        ++i;
                         continue;
+                    }
 
-                    hit_segment->cacheToDisk(*this);
+                    cached_segments = hit_segment->cacheBatchToDisk(*this, segments, i);
                 }
                 catch (...)
                 {
@@ -150,6 +193,7 @@ void IDiskCache::cacheSegmentsToLocalDisk(IDiskCacheSegmentsVector hit_segments,
                         first_exception = std::current_exception();
                     tryLogCurrentException(log, "Failed to cache segment " + hit_segment->getSegmentName());
                 }
+                i += cached_segments;
             }
 
             if (cb)
@@ -162,7 +206,12 @@ void IDiskCache::cacheSegmentsToLocalDisk(IDiskCacheSegmentsVector hit_segments,
     });
 
     if (!success)
+    {
+        /// The task was dropped, let a later query schedule these fetches again.
+        for (const auto & segment_name : registered_names)
+            unregisterInFlightSegment(segment_name);
         ProfileEvents::increment(ProfileEvents::DiskCacheTaskDropCount);
+    }
 }
 
 void IDiskCache::cacheBitmapIndexToLocalDisk(const IDiskCacheSegmentPtr & bitmap_segment)
@@ -170,7 +219,14 @@ void IDiskCache::cacheBitmapIndexToLocalDisk(const IDiskCacheSegmentPtr & bitmap
     Stopwatch watch;
     SCOPE_EXIT({ ProfileEvents::increment(ProfileEvents::DiskCacheScheduleCacheTaskMicroseconds, watch.elapsedMicroseconds()); });
 
+    if (!tryRegisterInFlightSegment(bitmap_segment->getSegmentName()))
+    {
+        ProfileEvents::increment(ProfileEvents::DiskCacheDuplicateFetchesSkipped);
+        return;
+    }
+
     bool success = scheduleCacheTask([this, bitmap_segment] {
+        SCOPE_EXIT({ unregisterInFlightSegment(bitmap_segment->getSegmentName()); });
         try
         {
             bitmap_segment->cacheToDisk(*this);
@@ -181,7 +237,10 @@ void IDiskCache::cacheBitmapIndexToLocalDisk(const IDiskCacheSegmentPtr & bitmap
         }
     });
     if (!success)
+    {
+        unregisterInFlightSegment(bitmap_segment->getSegmentName());
         ProfileEvents::increment(ProfileEvents::DiskCacheTaskDropCount);
+    }
 }
 
 // Schedule cache task, when threadpool's current running task exceed certain ratio, start random
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <exception>
+#include <mutex>
+#include <unordered_set>
 #include <vector>
 #include <Core/BackgroundSchedulePool.h>
 #include <Disks/IDisk.h>
@@ -151,6 +153,14 @@ protected:
 private:
     bool scheduleCacheTask(const std::function<void()> & task);
 
+    /// Registers segment as being fetched; returns false if another caching task already
+    /// fetches it, so concurrent queries missing the same segment issue one remote read.
+    bool tryRegisterInFlightSegment(const String & segment_name);
+    void unregisterInFlightSegment(const String & segment_name);
+
+    std::mutex in_flight_mutex;
+    std::unordered_set<String> in_flight_segments;
+
     static std::unique_ptr<ThreadPool> local_disk_cache_thread_pool;
     static std::unique_ptr<ThreadPool> local_disk_cache_evict_thread_pool;
 };
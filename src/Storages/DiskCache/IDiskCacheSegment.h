@@ -36,6 +36,16 @@ public:
     virtual String getMarkName() const {return {};}
     virtual void cacheToDisk(IDiskCache & diskcache, bool throw_exception = false) = 0;
 
+    /// Cache segments[from] (which is `this`) and optionally a run of directly following
+    /// adjacent segments with a single read of the source data. Returns how many segments
+    /// of `segments` were consumed, at least 1. The default implementation does not
+    /// coalesce anything and just caches `this`.
+    virtual size_t cacheBatchToDisk(IDiskCache & diskcache, const std::vector<std::shared_ptr<IDiskCacheSegment>> &, size_t)
+    {
+        cacheToDisk(diskcache);
+        return 1;
+    }
+
     static String formatSegmentName(
         const String & uuid, const String & part_name, const String & column_name, UInt32 segment_number, const String & extension);
 
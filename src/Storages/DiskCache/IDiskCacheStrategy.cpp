@@ -22,6 +22,15 @@
 namespace DB
 {
 
+bool IDiskCacheStrategy::admitsScan(const IDiskCachePtr & disk_cache, size_t estimated_scan_bytes) const
+{
+    if (scan_admission_max_percent == 0 || estimated_scan_bytes == 0 || !disk_cache)
+        return true;
+
+    size_t cache_capacity = disk_cache->getSettings().lru_max_size;
+    return estimated_scan_bytes <= cache_capacity / 100 * scan_admission_max_percent;
+}
+
 std::set<size_t> IDiskCacheStrategy::transferRangesToSegmentNumbers(const MarkRanges & ranges) const
 {
     std::set<size_t> segment_numbers;
@@ -32,6 +32,7 @@ class IDiskCacheStrategy : public std::enable_shared_from_this<IDiskCacheStrateg
 public:
     explicit IDiskCacheStrategy(const DiskCacheSettings & settings_)
         : segment_size(settings_.segment_size)
+        , scan_admission_max_percent(settings_.scan_admission_max_percent)
     {
     }
     virtual ~IDiskCacheStrategy() = default;
@@ -42,6 +43,11 @@ public:
     /// get segments need to be cached
     virtual IDiskCacheSegmentsVector getCacheSegments(const IDiskCachePtr & disk_cache, const IDiskCacheSegmentsVector & segments) = 0;
 
+    /// Admission control: whether a scan with the given estimated size may populate the cache at all.
+    /// Scans larger than scan_admission_max_percent of cache capacity are read around the cache,
+    /// so they cannot evict the hot segments of latency-sensitive queries.
+    bool admitsScan(const IDiskCachePtr & disk_cache, size_t estimated_scan_bytes) const;
+
     size_t getSegmentSize() const { return segment_size; }
 
     template<typename T, typename... Args, typename = std::enable_if<std::is_base_of_v<IDiskCacheSegment, T>>>
@@ -65,6 +71,8 @@ protected:
 
     /// It indicates how many index granules a segment contains
     size_t segment_size;
+    /// Max percent of cache capacity a single scan may be estimated at and still populate the cache, 0 admits everything
+    size_t scan_admission_max_percent;
 };
 
 using IDiskCacheStrategyPtr = std::shared_ptr<IDiskCacheStrategy>;
@@ -5,10 +5,11 @@
 #include <shared_mutex>
 
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/util/delimited_message_util.h>
 
 #include <Protos/disk_cache.pb.h>
 #include <Common/Exception.h>
+#include <Common/ThreadPool.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
 
 namespace DB::ErrorCodes
 {
@@ -172,43 +173,84 @@ size_t Index::compuiteSize() const
 
 void Index::persist(google::protobuf::io::CodedOutputStream * stream) const
 {
-    Protos::IndexBucket bucket;
-    for (UInt32 i = 0; i < kNumBuckets; i++)
+    /// Serializing one bucket is independent of the others, only the writes into the
+    /// stream have to preserve bucket order. Serialize batches of buckets on a pool
+    /// and write each finished batch out sequentially. The framing below is identical
+    /// to SerializeDelimitedToCodedStream, so the on-disk format stays unchanged and
+    /// either persist can be read by either recover.
+    ThreadPool pool(std::min<UInt32>(getNumberOfPhysicalCPUCores(), kMaxPersistThreads));
+    std::vector<String> serialized(kPersistBatchSize);
+    for (UInt32 batch_start = 0; batch_start < kNumBuckets; batch_start += kPersistBatchSize)
     {
-        bucket.set_bucket_id(i);
-        for (const auto & [key, v] : buckets[i])
+        const UInt32 batch_end = std::min(batch_start + kPersistBatchSize, kNumBuckets);
+        for (UInt32 i = batch_start; i < batch_end; i++)
         {
-            auto * entry = bucket.add_entries();
-            entry->set_key(key);
-            entry->set_address(v.address);
-            entry->set_size_hint(v.size_hint);
-            entry->set_total_hits(v.total_hits);
-            entry->set_current_hits(v.current_hits);
+            pool.scheduleOrThrowOnError([this, i, batch_start, &serialized] {
+                Protos::IndexBucket bucket;
+                bucket.set_bucket_id(i);
+                for (const auto & [key, v] : buckets[i])
+                {
+                    auto * entry = bucket.add_entries();
+                    entry->set_key(key);
+                    entry->set_address(v.address);
+                    entry->set_size_hint(v.size_hint);
+                    entry->set_total_hits(v.total_hits);
+                    entry->set_current_hits(v.current_hits);
+                }
+                serialized[i - batch_start] = bucket.SerializeAsString();
+            });
+        }
+        pool.wait();
+        for (UInt32 i = batch_start; i < batch_end; i++)
+        {
+            auto & buf = serialized[i - batch_start];
+            stream->WriteVarint32(static_cast<UInt32>(buf.size()));
+            stream->WriteRaw(buf.data(), static_cast<int>(buf.size()));
+            buf.clear();
         }
-
-        google::protobuf::util::SerializeDelimitedToCodedStream(bucket, stream);
-        bucket.clear_entries();
     }
 }
 
 void Index::recover(google::protobuf::io::CodedInputStream * stream)
 {
-    Protos::IndexBucket bucket;
-    for (UInt32 i = 0; i < kNumBuckets; i++)
+    /// Frames are length prefixed, so the cheap reads have to stay sequential while
+    /// the expensive protobuf parsing and hash map filling runs on a pool, one task
+    /// per bucket. Disjoint buckets need no synchronization; the per-bucket lock only
+    /// guards against malformed files addressing one bucket from two frames.
+    ThreadPool pool(std::min<UInt32>(getNumberOfPhysicalCPUCores(), kMaxPersistThreads));
+    std::vector<String> frames(kPersistBatchSize);
+    for (UInt32 batch_start = 0; batch_start < kNumBuckets; batch_start += kPersistBatchSize)
     {
-        google::protobuf::util::ParseDelimitedFromCodedStream(&bucket, stream, nullptr);
-        UInt32 id = bucket.bucket_id();
-        if (id >= kNumBuckets)
-            throw Exception(ErrorCodes::INVALID_CONFIG_PARAMETER, "Invalid bucket id. Max buckets: {}, bucket id: {}", kNumBuckets, id);
-
-        for (const auto & entry : bucket.entries())
+        const UInt32 batch_end = std::min(batch_start + kPersistBatchSize, kNumBuckets);
+        for (UInt32 i = batch_start; i < batch_end; i++)
         {
-            buckets[id][entry.key()] = ItemRecord{
-                entry.address(),
-                static_cast<UInt16>(entry.size_hint()),
-                static_cast<UInt8>(entry.total_hits()),
-                static_cast<UInt8>(entry.current_hits())};
+            UInt32 frame_size = 0;
+            auto & frame = frames[i - batch_start];
+            if (!stream->ReadVarint32(&frame_size) || !stream->ReadString(&frame, frame_size))
+                throw Exception(
+                    ErrorCodes::INVALID_CONFIG_PARAMETER, "Unexpected end of stream while recovering index bucket {}", i);
+
+            pool.scheduleOrThrowOnError([this, i, &frame] {
+                Protos::IndexBucket bucket;
+                if (!bucket.ParseFromString(frame))
+                    throw Exception(ErrorCodes::INVALID_CONFIG_PARAMETER, "Cannot parse frame of index bucket {}", i);
+                UInt32 id = bucket.bucket_id();
+                if (id >= kNumBuckets)
+                    throw Exception(
+                        ErrorCodes::INVALID_CONFIG_PARAMETER, "Invalid bucket id. Max buckets: {}, bucket id: {}", kNumBuckets, id);
+
+                auto guard = std::lock_guard{getMutexOfBucket(id)};
+                for (const auto & entry : bucket.entries())
+                {
+                    buckets[id][entry.key()] = ItemRecord{
+                        entry.address(),
+                        static_cast<UInt16>(entry.size_hint()),
+                        static_cast<UInt8>(entry.total_hits()),
+                        static_cast<UInt8>(entry.current_hits())};
+                }
+            });
         }
+        pool.wait();
     }
 }
 
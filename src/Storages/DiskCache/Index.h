@@ -117,6 +117,10 @@ public:
 private:
     static constexpr UInt32 kNumBuckets{64 * 1024};
     static constexpr UInt32 kNumMutexes{1024};
+    /// Batch granularity and parallelism cap for persist()/recover(). A batch bounds
+    /// how many buckets are held in serialized form in memory at any one time.
+    static constexpr UInt32 kPersistBatchSize{4 * 1024};
+    static constexpr UInt32 kMaxPersistThreads{16};
 
     using Map = google::sparse_hash_map<UInt32, ItemRecord>;
 
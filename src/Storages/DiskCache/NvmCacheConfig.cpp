@@ -218,6 +218,7 @@ namespace
         block_cache->config.clean_regions_pool = block_cache_config.getCleanRegions();
         block_cache->config.reinsertion_config = block_cache_config.getReinsertionConfig();
         block_cache->config.num_in_mem_buffers = block_cache_config.getNumInMemBuffers();
+        block_cache->config.numa_aware_in_mem_buffers = block_cache_config.isNumaAwareInMemBuffers();
         block_cache->config.item_destructor_enabled = item_destructor_enabled;
         block_cache->config.precise_remove = block_cache_config.isPreciseRemove();
 
@@ -399,5 +400,6 @@ void EnginesConfig::loadFromConfig(const std::string & config_elem, const Poco::
     big_hash_config.setSizePctAndMaxItemSize(
         conf.getUInt(config_elem + ".bh_size_pct", 0), conf.getUInt64(config_elem + ".small_item_max_size", 2048));
     block_cache_config.setSize(conf.getUInt64(config_elem + ".bc_size", 0));
+    block_cache_config.setNumaAwareInMemBuffers(conf.getBool(config_elem + ".bc_numa_aware_buffers", false));
 }
 }
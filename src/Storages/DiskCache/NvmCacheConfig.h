@@ -145,6 +145,12 @@ public:
         return *this;
     }
 
+    BlockCacheConfig & setNumaAwareInMemBuffers(bool numa_aware_in_mem_buffers_) noexcept
+    {
+        numa_aware_in_mem_buffers = numa_aware_in_mem_buffers_;
+        return *this;
+    }
+
     BlockCacheConfig & setSize(UInt64 size_) noexcept
     {
         size = size_;
@@ -169,6 +175,8 @@ public:
 
     bool isPreciseRemove() const { return precise_remove; }
 
+    bool isNumaAwareInMemBuffers() const { return numa_aware_in_mem_buffers; }
+
 
 private:
     bool lru{true};
@@ -176,6 +184,7 @@ private:
     BlockCacheReinsertionConfig reinsertion_config;
     UInt32 clean_regions{1};
     UInt32 num_in_mem_buffers{2};
+    bool numa_aware_in_mem_buffers{false};
     UInt32 region_size{16 * MiB};
     bool data_checksum{false};
     bool precise_remove{false};
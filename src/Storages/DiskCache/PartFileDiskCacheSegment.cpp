@@ -25,6 +25,7 @@
 #include <Storages/MergeTree/MergeTreeSuffix.h>
 #include <sys/types.h>
 #include "Common/Exception.h"
+#include "Common/ProfileEvents.h"
 #include "Common/parseAddress.h"
 #include "Common/HostWithPorts.h"
 #include "common/types.h"
@@ -33,6 +34,12 @@
 #include "Storages/DistributedDataClient.h"
 #include "Storages/MergeTree/MergeTreeSettings.h"
 
+namespace ProfileEvents
+{
+    extern const Event DiskCacheSetCoalescedSegments;
+    extern const Event DiskCacheSetCoalescedBytes;
+}
+
 namespace DB
 {
 
@@ -51,6 +58,7 @@ static MergeTreeReaderSettings getMergeTreeReaderSettings(const ContextPtr & con
     };
     
     settings.setDiskCacheSteaing(data.getSettings()->disk_cache_stealing_mode);
+    settings.read_settings.remote_request_throttler = data.getRemoteRequestThrottler(context);
     return settings;
 }
 
@@ -245,4 +253,117 @@ void PartFileDiskCacheSegment::cacheToDisk(IDiskCache & disk_cache, bool throw_e
             throw Exception(e);
     }
 }
+
+size_t PartFileDiskCacheSegment::cacheBatchToDisk(IDiskCache & disk_cache, const IDiskCacheSegmentsVector & segments, size_t from)
+{
+    size_t max_segments = disk_cache.getSettings().cache_set_coalesce_segments;
+
+    /// Preload and cache stealing have their own write paths with per-segment logic,
+    /// keep them on the plain path
+    if (max_segments < 2 || preload_level != 0
+        || data_part->disk_cache_mode == DiskCacheMode::FORCE_STEAL_DISK_CACHE
+        || merge_tree_reader_settings.remote_disk_cache_stealing == StealingCacheMode::READ_WRITE
+        || merge_tree_reader_settings.remote_disk_cache_stealing == StealingCacheMode::WRITE_ONLY)
+    {
+        cacheToDisk(disk_cache);
+        return 1;
+    }
+
+    /// Collect the run of directly adjacent segments of the same stream
+    std::vector<PartFileDiskCacheSegment *> run{this};
+    for (size_t i = from + 1; i < segments.size() && run.size() < max_segments; ++i)
+    {
+        auto * next = dynamic_cast<PartFileDiskCacheSegment *>(segments[i].get());
+        if (!next || next->data_part != data_part || next->stream_name != stream_name || next->extension != extension
+            || next->preload_level != 0 || next->segment_number != run.back()->segment_number + 1)
+            break;
+        run.push_back(next);
+    }
+
+    Poco::Logger * log = disk_cache.getLogger();
+    size_t n_coalesced = 0;
+    try
+    {
+        size_t start_mark = std::min<size_t>(segment_size * segment_number, marks_count);
+        if (start_mark >= marks_count)
+        {
+            cacheToDisk(disk_cache);
+            return 1;
+        }
+
+        /// Right boundaries of the segments that can be sliced out of one sequential read.
+        /// A boundary mark pointing into the middle of a compressed block makes a segment
+        /// overlap the following one (see cacheToDisk), stop the run before such segments
+        std::vector<size_t> right_offsets;
+        for (auto * seg : run)
+        {
+            size_t right_mark = std::min<size_t>(segment_size * (seg->segment_number + 1), marks_count);
+            if (right_mark >= marks_count)
+            {
+                right_offsets.push_back(stream_file_pos.file_size);
+                ++n_coalesced;
+                break;
+            }
+
+            const MarkInCompressedFile & boundary = marks_loader.getMark(right_mark);
+            if (boundary.offset_in_decompressed_block != 0)
+                break;
+            right_offsets.push_back(boundary.offset_in_compressed_file);
+            ++n_coalesced;
+        }
+
+        if (n_coalesced < 2)
+        {
+            cacheToDisk(disk_cache);
+            return 1;
+        }
+
+        size_t left_offset = marks_loader.getMark(start_mark).offset_in_compressed_file;
+        size_t total_bytes = right_offsets.back() - left_offset;
+
+        String data_path = data_part->getFullRelativePath() + "data";
+        auto disk = data_part->volume->getDisk();
+        auto read_settings = merge_tree_reader_settings.read_settings;
+        read_settings.estimated_size = total_bytes;
+        auto data_file = disk->readFile(data_path, read_settings);
+
+        /// Cache the mark segment once for the whole run
+        data_file->seek(mrk_file_pos.file_offset);
+        {
+            LimitReadBuffer marks_value(*data_file, mrk_file_pos.file_size, false);
+            disk_cache.getMetaCache()->set(getMarkName(), marks_value, mrk_file_pos.file_size, false);
+        }
+
+        size_t segment_left_offset = left_offset;
+        for (size_t i = 0; i < n_coalesced; ++i)
+        {
+            size_t segment_bytes = right_offsets[i] - segment_left_offset;
+            /// set() may return without draining the buffer (e.g. the key is already
+            /// cached), so position the source explicitly for every slice
+            data_file->seek(stream_file_pos.file_offset + segment_left_offset);
+            LimitReadBuffer segment_value(*data_file, segment_bytes, false);
+            disk_cache.getDataCache()->set(run[i]->getSegmentName(), segment_value, segment_bytes, false);
+            segment_left_offset = right_offsets[i];
+        }
+
+        ProfileEvents::increment(ProfileEvents::DiskCacheSetCoalescedSegments, n_coalesced);
+        ProfileEvents::increment(ProfileEvents::DiskCacheSetCoalescedBytes, total_bytes);
+        LOG_TRACE(
+            log,
+            "Coalesced caching of {} segments [{}, {}) of stream {}, offset {}, bytes {}",
+            n_coalesced,
+            segment_number,
+            segment_number + n_coalesced,
+            stream_name + extension,
+            left_offset,
+            total_bytes);
+    }
+    catch (...)
+    {
+        LOG_ERROR(log, "Failed to cache segment batch to local disk.");
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+    }
+
+    return std::max<size_t>(n_coalesced, 1);
+}
 }
@@ -61,6 +61,10 @@ public:
     String getMarkName() const override;
     void cacheToDisk(IDiskCache & cache, bool throw_exception) override;
 
+    /// Cache a run of adjacent segments of the same stream with one sequential source read
+    /// instead of one read per segment. Bounded by the cache_set_coalesce_segments setting.
+    size_t cacheBatchToDisk(IDiskCache & cache, const IDiskCacheSegmentsVector & segments, size_t from) override;
+
 private:
     IMergeTreeDataPartPtr data_part;
     ConstStoragePtr storage;
@@ -18,6 +18,7 @@
 #include <Storages/DiskCache/Types.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/Exception.h>
+#include <Common/SystemUtils.h>
 #include <Common/ProfileEvents.h>
 #include <Common/Stopwatch.h>
 #include <common/chrono_io.h>
@@ -63,7 +64,8 @@ RegionManager::RegionManager(
     std::unique_ptr<EvictionPolicy> policy_,
     UInt32 num_in_mem_buffers_,
     UInt16 num_priorities_,
-    UInt16 in_mem_buf_flush_retry_limit_)
+    UInt16 in_mem_buf_flush_retry_limit_,
+    bool numa_aware_buffers_)
     : num_priorities{num_priorities_}
     , in_mem_buf_flush_retry_limit{in_mem_buf_flush_retry_limit_}
     , num_regions{num_regions_}
@@ -84,12 +86,40 @@ RegionManager::RegionManager(
 
     chassert(0u < num_in_mem_buffers);
 
-    for (UInt32 i = 0; i < num_in_mem_buffers; i++)
-        buffers.push_back(std::make_unique<Buffer>(device.makeIOBuffer(region_size)));
+    if (numa_aware_buffers_)
+        numa_node_cpu_masks = SystemUtils::getNumaNodesCpuMask();
+    if (numa_node_cpu_masks.size() > 1)
+    {
+        /// Shard the buffer pool across NUMA nodes; buffers are distributed round-robin
+        /// and afterwards stay on the node of the thread that last used them.
+        numa_buffer_pools.resize(numa_node_cpu_masks.size());
+        for (UInt32 i = 0; i < num_in_mem_buffers; i++)
+            numa_buffer_pools[i % numa_buffer_pools.size()].push_back(std::make_unique<Buffer>(device.makeIOBuffer(region_size)));
+        LOG_INFO(log, fmt::format("NUMA-aware buffer pool enabled: {} buffers across {} nodes", num_in_mem_buffers, numa_buffer_pools.size()));
+    }
+    else
+    {
+        for (UInt32 i = 0; i < num_in_mem_buffers; i++)
+            buffers.push_back(std::make_unique<Buffer>(device.makeIOBuffer(region_size)));
+    }
 
     resetEvictionPolicy();
 }
 
+size_t RegionManager::currentNumaNode() const
+{
+#if defined(__linux__)
+    int cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+        for (size_t node = 0; node < numa_node_cpu_masks.size(); ++node)
+            if (CPU_ISSET(cpu, &numa_node_cpu_masks[node]))
+                return node;
+    }
+#endif
+    return 0;
+}
+
 RegionId RegionManager::evict()
 {
     auto rid = policy->evict();
@@ -197,10 +227,29 @@ std::unique_ptr<Buffer> RegionManager::claimBufferFromPool()
     std::unique_ptr<Buffer> buf;
     {
         LockGuard guard{buffer_mutex};
-        if (buffers.empty())
-            return nullptr;
-        buf = std::move(buffers.back());
-        buffers.pop_back();
+        if (!numa_buffer_pools.empty())
+        {
+            /// Prefer a buffer that last lived on the caller's node; fall back to
+            /// stealing from the fullest remote pool rather than failing the claim.
+            auto * pool = &numa_buffer_pools[currentNumaNode()];
+            if (pool->empty())
+            {
+                for (auto & candidate : numa_buffer_pools)
+                    if (candidate.size() > pool->size())
+                        pool = &candidate;
+            }
+            if (pool->empty())
+                return nullptr;
+            buf = std::move(pool->back());
+            pool->pop_back();
+        }
+        else
+        {
+            if (buffers.empty())
+                return nullptr;
+            buf = std::move(buffers.back());
+            buffers.pop_back();
+        }
     }
     CurrentMetrics::add(CurrentMetrics::RegionManagerNumInMemBufActive);
     return buf;
@@ -210,7 +259,10 @@ void RegionManager::returnBufferToPool(std::unique_ptr<Buffer> buf)
 {
     {
         std::lock_guard<std::mutex> guard{buffer_mutex};
-        buffers.push_back(std::move(buf));
+        if (!numa_buffer_pools.empty())
+            numa_buffer_pools[currentNumaNode()].push_back(std::move(buf));
+        else
+            buffers.push_back(std::move(buf));
     }
     CurrentMetrics::sub(CurrentMetrics::RegionManagerNumInMemBufActive);
 }
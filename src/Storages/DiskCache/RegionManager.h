@@ -4,6 +4,7 @@
 #include <chrono>
 #include <memory>
 #include <mutex>
+#include <sched.h>
 #include <utility>
 #include <vector>
 
@@ -40,7 +41,8 @@ public:
         std::unique_ptr<EvictionPolicy> policy_,
         UInt32 num_in_mem_buffers_,
         UInt16 num_priorities_,
-        UInt16 in_mem_buf_flush_retry_limit_);
+        UInt16 in_mem_buf_flush_retry_limit_,
+        bool numa_aware_buffers_ = false);
     RegionManager(const RegionManager &) = delete;
     RegionManager & operator=(const RegionManager &) = delete;
 
@@ -183,5 +185,13 @@ private:
 
     mutable std::mutex buffer_mutex;
     std::vector<std::unique_ptr<Buffer>> buffers;
+
+    /// With NUMA-aware buffers enabled the pool is sharded per NUMA node and claims prefer
+    /// buffers last used on the caller's node, to avoid cross-socket traffic on buffer copies.
+    /// Guarded by buffer_mutex; empty when disabled or the host has a single node.
+    std::vector<std::vector<std::unique_ptr<Buffer>>> numa_buffer_pools;
+    std::vector<cpu_set_t> numa_node_cpu_masks;
+
+    size_t currentNumaNode() const;
 };
 }
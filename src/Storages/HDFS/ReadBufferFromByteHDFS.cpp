@@ -120,6 +120,7 @@ struct ReadBufferFromByteHDFS::ReadBufferFromHDFSImpl
     bool pread {false};
     RemoteReadLog * remote_read_log;
     String remote_read_context;
+    ThrottlerPtr request_throttler;
     size_t read_until_position = 0;
 
     String hdfs_file_path;
@@ -138,6 +139,7 @@ struct ReadBufferFromByteHDFS::ReadBufferFromHDFSImpl
         , pread(settings_.byte_hdfs_pread)
         , remote_read_log(settings_.remote_read_log)
         , remote_read_context(settings_.remote_read_context)
+        , request_throttler(settings_.remote_request_throttler)
         , read_until_position(read_until_position_)
     {
         Poco::URI uri(hdfs_file_path_);
@@ -178,6 +180,9 @@ struct ReadBufferFromByteHDFS::ReadBufferFromHDFSImpl
             num_bytes_to_read = std::min(bytes, read_until_position - file_offset);
         }
 
+        if (request_throttler)
+            request_throttler->add(1);
+
         Stopwatch watch;
         const auto request_time = std::chrono::system_clock::now();
         size_t total_bytes_read = 0;
@@ -1,9 +1,12 @@
 #include "Storages/Hive/HiveFile/HiveORCFile.h"
 #if USE_HIVE
 
+#include "Interpreters/ActionsDAG.h"
+#include "Interpreters/ExpressionActions.h"
 #include "Processors/Formats/Impl/ArrowBufferedStreams.h"
 #include "Processors/Formats/Impl/LMNativeORCBlockInputFormat.h"
 #include "Processors/Formats/Impl/ORCBlockInputFormat.h"
+#include "Processors/Sources/NullSource.h"
 #include "IO/ReadSettings.h"
 
 #include <arrow/adapters/orc/adapter.h>
@@ -185,13 +188,39 @@ void HiveORCFile::openFile() const
     }
 }
 
+bool HiveORCFile::canSkipSlice(const Block & block, const std::shared_ptr<IHiveFile::ReadParams> & params) const
+{
+    KeyCondition key_condition(
+        *params->query_info,
+        params->context,
+        block.getNames(),
+        std::make_shared<ExpressionActions>(std::make_shared<ActionsDAG>(block.getColumnsWithTypeAndName())));
+    if (key_condition.alwaysUnknownOrTrue())
+        return false;
+
+    auto * raw_reader = file_reader->GetRawORCReader();
+    size_t slice = params->slice.value();
+    if (slice >= raw_reader->getNumberOfStripeStatistics())
+        return false;
+
+    auto stripe_stats = raw_reader->getStripeStatistics(slice);
+    NamesAndTypesList index_names_and_types = block.getNamesAndTypesList();
+    auto minmax_idx = buildMinMaxIndex(stripe_stats.get(), index_names_and_types);
+    if (!minmax_idx || !minmax_idx->initialized)
+        return false;
+
+    return !key_condition.checkInHyperrectangle(minmax_idx->hyperrectangle, index_names_and_types.getTypes()).can_be_true;
+}
+
 SourcePtr HiveORCFile::getReader(const Block & block, const std::shared_ptr<IHiveFile::ReadParams> & params)
 {
     openFile();
     if (!params->read_buf)
         params->read_buf = readFile(params->read_settings);
 
-    if (params->format_settings.orc.use_fast_decoder == 2)
+    /// The native reader always consumes the whole file, so a slice must be served by the
+    /// stripe-level source below; otherwise concurrent readers would duplicate data.
+    if (params->format_settings.orc.use_fast_decoder == 2 && !params->slice)
     {
         LOG_TRACE(log, "Orc use native reader");
         auto orc_format = std::make_shared<LMNativeORCBlockInputFormat>(*params->read_buf, block, params->format_settings);
@@ -201,6 +230,16 @@ SourcePtr HiveORCFile::getReader(const Block & block, const std::shared_ptr<IHiv
     }
     else
     {
+        /// A slice is one stripe; evaluate its statistics against the pushed down condition
+        /// before decoding, the same check selectFiles() performs ahead of time when
+        /// use_hive_split_level_filter is on. Decoding dominates this path, so a stripe
+        /// whose min/max ranges cannot satisfy the condition is not read at all.
+        if (params->slice && params->query_info && canSkipSlice(block, params))
+        {
+            params->slice.reset();
+            return std::make_shared<NullSource>(Block{});
+        }
+
         auto arrow_column_to_ch_column = std::make_unique<ArrowColumnToCHColumn>(
             block,
             "ORC",
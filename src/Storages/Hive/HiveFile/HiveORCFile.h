@@ -32,6 +32,10 @@ public:
 
 private:
     MinMaxIndexPtr buildMinMaxIndex(const orc::Statistics * statistics, const NamesAndTypesList & index_names_and_types) const;
+    /// Whether the stripe statistics of the slice in `params` rule out every row under
+    /// the condition carried by params->query_info. Used by the stripe-level reader to
+    /// avoid decoding stripes the predicate cannot match.
+    bool canSkipSlice(const Block & block, const std::shared_ptr<IHiveFile::ReadParams> & params) const;
     /// void loadFileMinMaxIndex(const NamesAndTypesList & index_names_and_types) override;
     void loadSplitMinMaxIndex(const NamesAndTypesList & index_names_and_types) override;
 
@@ -3,11 +3,17 @@
 #include <Poco/Logger.h>
 #if USE_HIVE
 
+#include "IO/ReadHelpers.h"
 #include "Processors/Formats/Impl/ArrowBufferedStreams.h"
 #include "Processors/Formats/Impl/ArrowColumnToCHColumn.h"
 #include "Processors/Formats/Impl/ParquetBlockInputFormat.h"
+#include "Storages/DiskCache/DiskCacheFactory.h"
+#include "Storages/DiskCache/HiveMetaFileDiskCacheSegment.h"
+#include "Storages/DiskCache/IDiskCache.h"
 
+#include <arrow/io/memory.h>
 #include <parquet/arrow/reader.h>
+#include <parquet/metadata.h>
 #include <parquet/statistics.h>
 #include <common/logger_useful.h>
 namespace DB
@@ -57,6 +63,62 @@ std::optional<size_t> HiveParquetFile::numRows() const
     return metadata->num_rows();
 }
 
+std::shared_ptr<parquet::FileMetaData> HiveParquetFile::getMetadataFromDiskCache() const
+{
+    auto * log = &Poco::Logger::get(__func__);
+    auto hive_cache = DiskCacheFactory::instance().tryGet(DiskCacheType::Hive);
+    if (!hive_cache)
+        return nullptr;
+
+    try
+    {
+        auto meta_cache = hive_cache->getMetaCache();
+        auto key = HiveMetaFileDiskCacheSegment::getSegmentKey(disk, file_path, file_size);
+        auto [cache_disk, segment_path] = meta_cache->get(key);
+        if (!cache_disk || !cache_disk->exists(segment_path))
+            return nullptr;
+
+        String footer;
+        auto buffer = cache_disk->readFile(segment_path);
+        readStringUntilEOF(footer, *buffer);
+
+        uint32_t footer_len = static_cast<uint32_t>(footer.size());
+        auto cached_metadata = parquet::FileMetaData::Make(footer.data(), &footer_len);
+        LOG_TRACE(log, "Read parquet footer from local cache {}/{}", cache_disk->getPath(), segment_path);
+        return cached_metadata;
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, "Could not read parquet footer from local cache");
+        return nullptr;
+    }
+}
+
+void HiveParquetFile::cacheMetadataToDiskCache() const
+{
+    auto hive_cache = DiskCacheFactory::instance().tryGet(DiskCacheType::Hive);
+    if (!hive_cache)
+        return;
+
+    try
+    {
+        std::shared_ptr<arrow::io::BufferOutputStream> output;
+        THROW_ARROW_NOT_OK(arrow::io::BufferOutputStream::Create().Value(&output));
+        metadata->WriteTo(output.get());
+        std::shared_ptr<arrow::Buffer> footer;
+        THROW_ARROW_NOT_OK(output->Finish().Value(&footer));
+
+        String meta_data(reinterpret_cast<const char *>(footer->data()), footer->size());
+        auto meta_cache = hive_cache->getMetaCache();
+        meta_cache->cacheSegmentsToLocalDisk(
+            {std::make_shared<HiveMetaFileDiskCacheSegment>(disk, file_path, file_size, std::move(meta_data))});
+    }
+    catch (...)
+    {
+        tryLogCurrentException(&Poco::Logger::get(__func__), "Could not cache parquet footer to local cache");
+    }
+}
+
 void HiveParquetFile::openFile() const
 {
     std::lock_guard lock(mutex);
@@ -64,14 +126,31 @@ void HiveParquetFile::openFile() const
     if (schema)
         return;
 
+    /// A cached footer saves the metadata round trips to remote storage; the reader is
+    /// then built on top of the pre-parsed metadata and only touches the remote file
+    /// when data pages are actually read.
+    auto cached_metadata = getMetadataFromDiskCache();
+
     auto seekable_buffer = readFile(ReadSettings{});
     std::atomic<int> stopped;
-    THROW_ARROW_NOT_OK(parquet::arrow::OpenFile(
-        asArrowFile(*seekable_buffer, FormatSettings{}, stopped, "Parquet", PARQUET_MAGIC_BYTES, /* avoid_buffering */ true),
-        arrow::default_memory_pool(), &file_reader));
+    auto arrow_file = asArrowFile(*seekable_buffer, FormatSettings{}, stopped, "Parquet", PARQUET_MAGIC_BYTES, /* avoid_buffering */ true);
+    if (cached_metadata)
+    {
+        parquet::arrow::FileReaderBuilder builder;
+        THROW_ARROW_NOT_OK(builder.Open(arrow_file, parquet::default_reader_properties(), cached_metadata));
+        builder.memory_pool(arrow::default_memory_pool());
+        THROW_ARROW_NOT_OK(builder.Build(&file_reader));
+    }
+    else
+    {
+        THROW_ARROW_NOT_OK(parquet::arrow::OpenFile(arrow_file, arrow::default_memory_pool(), &file_reader));
+    }
     buf = std::move(seekable_buffer);
     metadata = file_reader->parquet_reader()->metadata();
     THROW_ARROW_NOT_OK(file_reader->GetSchema(&schema));
+
+    if (!cached_metadata)
+        cacheMetadataToDiskCache();
 }
 
 void HiveParquetFile::loadSplitMinMaxIndex(const NamesAndTypesList & index_names_and_types)
@@ -151,10 +230,25 @@ SourcePtr HiveParquetFile::getReader(const Block & block, const std::shared_ptr<
     if (!params->read_buf)
         params->read_buf = readFile(params->read_settings);
 
+    auto format_settings = params->format_settings;
+    /// When the source allocates this file by slice, the reader must serve exactly one row group.
+    /// All other row groups are skipped, so concurrent readers of the same file never duplicate data.
+    if (params->slice)
+    {
+        openFile();
+        size_t slice_to_read = *params->slice;
+        params->slice.reset();
+        for (size_t i = 0, num_row_groups = metadata->num_row_groups(); i < num_row_groups; ++i)
+        {
+            if (i != slice_to_read)
+                format_settings.parquet.skip_row_groups.insert(static_cast<int>(i));
+        }
+    }
+
     auto parquet_format = std::make_unique<ParquetBlockInputFormat>(
         *params->read_buf,
         block,
-        params->format_settings);
+        format_settings);
 
     if (params->query_info)
         parquet_format->setQueryInfo(*params->query_info, params->context);
@@ -39,6 +39,10 @@ private:
     void loadSplitMinMaxIndex(const NamesAndTypesList & index_names_and_types) override;
 
     void openFile() const;
+    /// Footer cache in the local hive disk cache, keyed by (file path, file size).
+    std::shared_ptr<parquet::FileMetaData> getMetadataFromDiskCache() const;
+    void cacheMetadataToDiskCache() const;
+
     mutable std::unique_ptr<parquet::arrow::FileReader> file_reader;
     mutable std::unique_ptr<ReadBuffer> buf;
     mutable std::shared_ptr<parquet::FileMetaData> metadata;
@@ -0,0 +1,113 @@
+#include <Storages/Hive/Metastore/CachedMetaClient.h>
+#if USE_HIVE
+
+#include <Common/Exception.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+CachedMetaClient::CachedMetaClient(IMetaClientPtr delegate_, UInt64 ttl_sec_, size_t max_cached_entries_)
+    : delegate(std::move(delegate_))
+    , ttl_sec(std::max<UInt64>(1, ttl_sec_))
+    , table_cache(max_cached_entries_)
+    , listing_cache(max_cached_entries_)
+    , refresh_pool(2, 2, 2 * max_cached_entries_)
+{
+}
+
+CachedMetaClient::~CachedMetaClient()
+{
+    try
+    {
+        refresh_pool.wait();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log);
+    }
+}
+
+void CachedMetaClient::scheduleRefresh(const String & key, std::function<void()> job)
+{
+    {
+        std::lock_guard lock(refresh_mutex);
+        if (!inflight_refreshes.insert(key).second)
+            return;
+    }
+
+    bool scheduled = refresh_pool.trySchedule([this, key, job = std::move(job)] {
+        try
+        {
+            job();
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Background metastore refresh failed for " + key);
+        }
+        std::lock_guard lock(refresh_mutex);
+        inflight_refreshes.erase(key);
+    });
+
+    if (!scheduled)
+    {
+        std::lock_guard lock(refresh_mutex);
+        inflight_refreshes.erase(key);
+    }
+}
+
+std::shared_ptr<ApacheHive::Table> CachedMetaClient::getTable(const String & db_name, const String & table_name)
+{
+    String key = db_name + "." + table_name;
+    time_t now = time(nullptr);
+
+    if (auto cached = table_cache.get(key))
+    {
+        if (isFresh(cached->loaded_at, now))
+            return cached->table;
+
+        if (isServableStale(cached->loaded_at, now))
+        {
+            scheduleRefresh(key, [this, key, db_name, table_name] {
+                auto table = delegate->getTable(db_name, table_name);
+                table_cache.set(key, std::make_shared<CachedTable>(CachedTable{std::move(table), time(nullptr)}));
+            });
+            return cached->table;
+        }
+    }
+
+    auto table = delegate->getTable(db_name, table_name);
+    table_cache.set(key, std::make_shared<CachedTable>(CachedTable{table, now}));
+    return table;
+}
+
+std::vector<ApacheHive::Partition>
+CachedMetaClient::getPartitionsByFilter(const String & db_name, const String & table_name, const String & filter)
+{
+    /// '\0' cannot occur in identifiers, so the key is unambiguous.
+    String key = db_name + "." + table_name + '\0' + filter;
+    time_t now = time(nullptr);
+
+    if (auto cached = listing_cache.get(key))
+    {
+        if (isFresh(cached->loaded_at, now))
+            return cached->partitions;
+
+        if (isServableStale(cached->loaded_at, now))
+        {
+            scheduleRefresh(key, [this, key, db_name, table_name, filter] {
+                auto partitions = delegate->getPartitionsByFilter(db_name, table_name, filter);
+                listing_cache.set(key, std::make_shared<CachedListing>(CachedListing{std::move(partitions), time(nullptr)}));
+            });
+            return cached->partitions;
+        }
+    }
+
+    auto partitions = delegate->getPartitionsByFilter(db_name, table_name, filter);
+    listing_cache.set(key, std::make_shared<CachedListing>(CachedListing{partitions, now}));
+    return partitions;
+}
+
+}
+
+#endif
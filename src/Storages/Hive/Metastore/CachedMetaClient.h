@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Storages/Hive/Metastore/IMetaClient.h"
+#if USE_HIVE
+
+#include <unordered_set>
+#include <Common/LRUCache.h>
+#include <Common/ThreadPool.h>
+#include <Poco/Logger.h>
+
+namespace DB
+{
+
+/// Decorates any IMetaClient with a TTL cache over the calls that dominate external catalog
+/// query latency: getTable and getPartitionsByFilter. Entries younger than ttl_sec are served
+/// without touching the metastore. Older entries are served stale while a background refresh
+/// replaces them (so a slow metastore never stalls planning of repeated queries); entries
+/// staler than 4 * ttl_sec are refetched synchronously to bound staleness when refreshes
+/// keep failing. Listing and schema calls used by SHOW queries are forwarded unconditionally.
+class CachedMetaClient : public IMetaClient
+{
+public:
+    CachedMetaClient(IMetaClientPtr delegate_, UInt64 ttl_sec_, size_t max_cached_entries_ = 1024);
+    ~CachedMetaClient() override;
+
+    Strings getAllDatabases() override { return delegate->getAllDatabases(); }
+    Strings getAllTables(const String & db_name) override { return delegate->getAllTables(db_name); }
+    bool isTableExist(const String & db_name, const String & table_name) override { return delegate->isTableExist(db_name, table_name); }
+
+    std::shared_ptr<ApacheHive::Table> getTable(const String & db_name, const String & table_name) override;
+    std::vector<ApacheHive::Partition>
+    getPartitionsByFilter(const String & db_name, const String & table_name, const String & filter) override;
+
+    std::optional<TableStatistics>
+    getTableStats(const String & db_name, const String & table_name, const Strings & col_names, bool merge_all_partition) override
+    {
+        return delegate->getTableStats(db_name, table_name, col_names, merge_all_partition);
+    }
+
+    ApacheHive::PartitionsStatsResult getPartitionStats(
+        const String & db_name,
+        const String & table_name,
+        const Strings & col_names,
+        const Strings & partition_keys,
+        const std::vector<Strings> & partition_vals) override
+    {
+        return delegate->getPartitionStats(db_name, table_name, col_names, partition_keys, partition_vals);
+    }
+
+private:
+    struct CachedTable
+    {
+        std::shared_ptr<ApacheHive::Table> table;
+        time_t loaded_at;
+    };
+    struct CachedListing
+    {
+        std::vector<ApacheHive::Partition> partitions;
+        time_t loaded_at;
+    };
+    using TableCache = LRUCache<String, CachedTable>;
+    using ListingCache = LRUCache<String, CachedListing>;
+
+    bool isFresh(time_t loaded_at, time_t now) const { return now - loaded_at < static_cast<time_t>(ttl_sec); }
+    bool isServableStale(time_t loaded_at, time_t now) const { return now - loaded_at < static_cast<time_t>(4 * ttl_sec); }
+
+    /// Runs job on the refresh pool unless a refresh for `key` is already in flight or the
+    /// pool is saturated; in the latter case the next query simply tries again.
+    void scheduleRefresh(const String & key, std::function<void()> job);
+
+    IMetaClientPtr delegate;
+    const UInt64 ttl_sec;
+
+    TableCache table_cache;
+    ListingCache listing_cache;
+
+    std::mutex refresh_mutex;
+    std::unordered_set<String> inflight_refreshes;
+    ThreadPool refresh_pool;
+
+    Poco::Logger * log = &Poco::Logger::get("CachedMetaClient");
+};
+
+}
+
+#endif
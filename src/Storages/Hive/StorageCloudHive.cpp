@@ -61,8 +61,9 @@ Pipe StorageCloudHive::read(
         storage_snapshot->getSampleBlockForColumns(real_columns), need_path_colum, need_file_column, storage_snapshot->metadata);
     auto allocator = std::make_shared<StorageHiveSource::Allocator>(std::move(hive_files));
 
-    /// TODO: remove this
-    allocator->allow_allocate_by_slice = false;
+    /// Formats that cannot serve a single slice report one slice per file, so they keep
+    /// whole-file allocation even when reading by slice is enabled.
+    allocator->allow_allocate_by_slice = local_context->getSettingsRef().enable_read_hive_file_by_slice;
 
     LOG_DEBUG(log, "read with {} streams, disk_cache mode {}", num_streams, local_context->getSettingsRef().disk_cache_mode.toString());
     auto query_info_ptr = std::make_shared<SelectQueryInfo>(query_info);
@@ -165,7 +165,12 @@ void StorageHiveSource::prepareReader()
     if (!continue_reading)
         read_params->read_buf.reset();
 
-    read_params->slice = current_file_slice.slice;
+    /// Only pin the reader to a slice when the allocator hands out individual slices;
+    /// otherwise the slot stands for the whole file and the reader must scan all of it.
+    if (allocator->allow_allocate_by_slice)
+        read_params->slice = current_file_slice.slice;
+    else
+        read_params->slice.reset();
     pipeline = std::make_unique<QueryPipeline>();
     data_source = hive_file->getReader(block_info->to_read, read_params);
     pipeline->init(Pipe(data_source));
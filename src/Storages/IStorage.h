@@ -681,6 +681,13 @@ public:
     /// Same as above but also take partition predicate into account.
     virtual std::optional<UInt64> totalRowsByPartitionPredicate(const SelectQueryInfo &, ContextPtr) const { return {}; }
 
+    /// If it is possible to determine the exact min and max values of a column from part metadata
+    /// (the partition minmax index), return them, taking the partition predicate into account.
+    ///
+    /// Used for:
+    /// - Trivial min()/max() optimization
+    virtual std::optional<std::pair<Field, Field>> minMaxValuesByPartitionPredicate(const SelectQueryInfo &, ContextPtr, const String & /*column_name*/) const { return {}; }
+
     /// If it is possible to quickly determine exact number of bytes for the table on storage:
     /// - memory (approximated, resident)
     /// - disk (compressed)
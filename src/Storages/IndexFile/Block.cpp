@@ -158,6 +158,19 @@ public:
         ParseNextKey();
     }
 
+    size_t NextBatch(size_t max_entries, std::vector<std::pair<std::string, std::string>> & out) override
+    {
+        /// Decode entries in one tight loop; a whole block costs a single virtual call.
+        size_t n = 0;
+        while (n < max_entries && Valid())
+        {
+            out.emplace_back(key_, value_.ToString());
+            ++n;
+            ParseNextKey();
+        }
+        return n;
+    }
+
     void Prev() override
     {
         assert(Valid());
@@ -0,0 +1,155 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Storages/IndexFile/BufferedIterator.h>
+
+#include <Storages/IndexFile/Comparator.h>
+#include <Storages/IndexFile/Iterator.h>
+
+#include <cassert>
+
+namespace DB::IndexFile
+{
+namespace
+{
+    class BufferedIterator : public Iterator
+    {
+    public:
+        BufferedIterator(const Comparator * comparator, Iterator * child, size_t batch_size)
+            : comparator_(comparator), child_(child), batch_size_(batch_size)
+        {
+            assert(batch_size_ > 0);
+        }
+
+        ~BufferedIterator() override { delete child_; }
+
+        bool Valid() const override { return pos_ < entries_.size(); }
+
+        void SeekToFirst() override
+        {
+            child_->SeekToFirst();
+            Fill();
+        }
+
+        void SeekToLast() override
+        {
+            entries_.clear();
+            pos_ = 0;
+            err_status_ = Status::NotSupported("BufferedIterator::SeekToLast()");
+        }
+
+        void Seek(const Slice & target) override
+        {
+            child_->Seek(target);
+            Fill();
+        }
+
+        void Next() override
+        {
+            assert(Valid());
+            if (++pos_ == entries_.size())
+                Fill();
+        }
+
+        void NextUntil(const Slice & target, bool & exact_match) override
+        {
+            assert(Valid());
+            assert(comparator_->Compare(key(), target) < 0);
+
+            /// The target is often within the next few buffered entries.
+            while (++pos_ < entries_.size())
+            {
+                int cmp = comparator_->Compare(key(), target);
+                if (cmp >= 0)
+                {
+                    exact_match = (cmp == 0);
+                    return;
+                }
+            }
+
+            /// Past the buffer: the child stands right after the last buffered entry,
+            /// let its own NextUntil() skip whole blocks if it can.
+            if (child_->Valid() && comparator_->Compare(child_->key(), target) < 0)
+            {
+                bool child_exact = false;
+                child_->NextUntil(target, child_exact);
+            }
+            Fill();
+            if (Valid())
+                exact_match = comparator_->Compare(key(), target) == 0;
+        }
+
+        size_t NextBatch(size_t max_entries, std::vector<std::pair<std::string, std::string>> & out) override
+        {
+            size_t n = 0;
+            while (n < max_entries && Valid())
+            {
+                out.push_back(std::move(entries_[pos_]));
+                ++n;
+                if (++pos_ == entries_.size())
+                    Fill();
+            }
+            return n;
+        }
+
+        void Prev() override
+        {
+            entries_.clear();
+            pos_ = 0;
+            err_status_ = Status::NotSupported("BufferedIterator::Prev()");
+        }
+
+        Slice key() const override
+        {
+            assert(Valid());
+            return entries_[pos_].first;
+        }
+
+        Slice value() const override
+        {
+            assert(Valid());
+            return entries_[pos_].second;
+        }
+
+        Status status() const override
+        {
+            if (!err_status_.ok())
+                return err_status_;
+            return child_->status();
+        }
+
+    private:
+        void Fill()
+        {
+            entries_.clear();
+            pos_ = 0;
+            child_->NextBatch(batch_size_, entries_);
+        }
+
+        const Comparator * comparator_;
+        Iterator * child_;
+        const size_t batch_size_;
+        std::vector<std::pair<std::string, std::string>> entries_;
+        size_t pos_ = 0;
+        Status err_status_;
+    };
+}
+
+Iterator * NewBufferedIterator(const Comparator * comparator, Iterator * child, size_t batch_size)
+{
+    return new BufferedIterator(comparator, child, batch_size);
+}
+
+}
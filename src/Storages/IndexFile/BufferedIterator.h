@@ -0,0 +1,32 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace DB::IndexFile
+{
+class Comparator;
+class Iterator;
+
+// The returned iterator takes ownership of child and serves entries out of an
+// in-memory buffer refilled through child->NextBatch(), so sequential scans pay
+// one virtual call per batch instead of several per entry. NextUntil() falls back
+// to the child's block-skipping path when the target lies beyond the buffer.
+// Only forward iteration is supported.
+Iterator * NewBufferedIterator(const Comparator * comparator, Iterator * child, size_t batch_size);
+
+}
@@ -58,6 +58,13 @@ Status IndexFileReader::Get(const ReadOptions & options, const Slice & key, Stri
     return rep->table_reader->Get(options, key, value);
 }
 
+bool IndexFileReader::MayContain(const Slice & key) const
+{
+    if (!rep->table_reader)
+        return true;
+    return rep->table_reader->MayContain(key);
+}
+
 Status IndexFileReader::NewIterator(const ReadOptions & options, std::unique_ptr<Iterator> * out)
 {
     if (!rep->table_reader)
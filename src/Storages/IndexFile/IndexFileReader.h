@@ -41,6 +41,10 @@ public:
     /// May return some other Status on an error.
     Status Get(const ReadOptions & options, const Slice & key, String * value);
 
+    /// Return false only when the file provably doesn't contain "key"
+    /// according to its filter block, without reading any data blocks.
+    bool MayContain(const Slice & key) const;
+
     /// Return an iterator over KVs in this file.
     /// Note: client should make sure this IndexFileRead lives longer than the returned iterator.
     Status NewIterator(const ReadOptions & options, std::unique_ptr<Iterator> * out);
@@ -9,6 +9,10 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <Storages/IndexFile/Status.h>
 #include <Common/Slice.h>
 
@@ -61,6 +65,23 @@ public:
     /// REQUIRES: Valid() && target > key()
     virtual void NextUntil(const Slice & target, bool & exact_match) = 0;
 
+    /// Batched variant of Next(): copies the current entry and up to `max_entries - 1`
+    /// of its successors into `out` (appending) and advances past them. Returns the
+    /// number of entries copied, 0 iff !Valid(). Unlike key()/value() slices, the
+    /// copies stay valid after the iterator moves on. Implementations that can decode
+    /// entries in a tight loop override this to avoid per-entry virtual dispatch.
+    virtual size_t NextBatch(size_t max_entries, std::vector<std::pair<std::string, std::string>> & out)
+    {
+        size_t n = 0;
+        while (n < max_entries && Valid())
+        {
+            out.emplace_back(key().ToString(), value().ToString());
+            ++n;
+            Next();
+        }
+        return n;
+    }
+
     // Moves to the previous entry in the source.  After this call, Valid() is
     // true iff the iterator was not positioned at the first entry in source.
     // REQUIRES: Valid()
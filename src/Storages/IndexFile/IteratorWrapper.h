@@ -96,7 +96,8 @@ public:
         Update();
     }
 
-private:
+    // Re-reads valid()/key() from the underlying iterator. Must be called after the
+    // underlying iterator was advanced directly through iter(), e.g. by NextBatch().
     void Update()
     {
         valid_ = iter_->Valid();
@@ -106,6 +107,7 @@ private:
         }
     }
 
+private:
     Iterator * iter_;
     bool valid_;
     Slice key_;
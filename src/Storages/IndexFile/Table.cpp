@@ -308,6 +308,26 @@ Status Table::Get(const ReadOptions & options, const Slice & k, std::string * va
     return notfound;
 }
 
+bool Table::MayContain(const Slice & k) const
+{
+    FilterBlockReader * filter = rep_->filter;
+    if (filter == nullptr)
+        return true;
+
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(rep_->options.comparator));
+    iiter->Seek(k);
+    if (!iiter->status().ok())
+        return true;
+    if (!iiter->Valid())
+        return false; /// past the last key of the table
+
+    Slice handle_value = iiter->value();
+    BlockHandle handle;
+    if (handle.DecodeFrom(&handle_value).ok())
+        return filter->KeyMayMatch(handle.offset(), k);
+    return true;
+}
+
 size_t Table::ResidentMemoryUsage() const
 {
     return sizeof(Rep) + rep_->index_block->size() + rep_->filter_size;
@@ -51,6 +51,12 @@ public:
     /// Return other error status otherwise.
     Status Get(const ReadOptions &, const Slice & key, std::string * value);
 
+    /// Return false only when the table provably doesn't contain `key', i.e.
+    /// the filter block rules it out. Reads no data blocks: only the resident
+    /// index block and filter are consulted. Always true when the table was
+    /// opened without a filter policy.
+    bool MayContain(const Slice & key) const;
+
     /// Total bytes of resident memory usage.
     /// This will exclude memory used by data in block cache.
     size_t ResidentMemoryUsage() const;
@@ -32,6 +32,7 @@ namespace
         void SeekToLast() override;
         void Next() override;
         void NextUntil(const Slice & target, bool & exact_match) override;
+        size_t NextBatch(size_t max_entries, std::vector<std::pair<std::string, std::string>> & out) override;
         void Prev() override;
 
         bool Valid() const override { return data_iter_.Valid(); }
@@ -156,6 +157,18 @@ namespace
         }
     }
 
+    size_t TwoLevelIterator::NextBatch(size_t max_entries, std::vector<std::pair<std::string, std::string>> & out)
+    {
+        size_t total = 0;
+        while (total < max_entries && Valid())
+        {
+            total += data_iter_.iter()->NextBatch(max_entries - total, out);
+            data_iter_.Update();
+            SkipEmptyDataBlocksForward();
+        }
+        return total;
+    }
+
     void TwoLevelIterator::Prev()
     {
         assert(Valid());
@@ -26,6 +26,7 @@
 #include <Interpreters/CnchSystemLog.h>
 #include <DataTypes/DataTypeString.h>
 #include <Processors/Formats/IRowInputFormat.h>
+#include <Processors/Formats/Impl/ParallelParsingInputFormat.h>
 #include <Processors/Formats/InputStreamFromInputFormat.h>
 #include <Processors/Executors/PipelineExecutingBlockInputStream.h>
 #include <Processors/Transforms/AddingDefaultsTransform.h>
@@ -196,7 +197,16 @@ void CnchKafkaBlockInputStream::readPrefixImpl()
         };
     }
 
-    auto child = FormatFactory::instance().getInput(storage.settings.format.value,
+    /// Virtual columns are captured per row on the consumer thread via the read callback, which
+    /// only the row input format can do, so such streams must not get the parallel parsing
+    /// wrapper. Without virtual columns, getInput may hand consumed batches to a parsing pool
+    /// whose per-thread columns are merged back in consume order (see ParallelParsingInputFormat).
+    InputFormatPtr child;
+    if (virtual_column_names.empty())
+        child = FormatFactory::instance().getInput(storage.settings.format.value,
+                                                 *delimited_buffer, non_virtual_header, context, max_block_size);
+    else
+        child = FormatFactory::instance().getInputFormat(storage.settings.format.value,
                                                  *delimited_buffer, non_virtual_header, context, max_block_size);
 
     if (auto *row_input = dynamic_cast<IRowInputFormat*>(child.get()))
@@ -215,7 +225,7 @@ void CnchKafkaBlockInputStream::readPrefixImpl()
                                           }
                                        });
     }
-    else
+    else if (!dynamic_cast<ParallelParsingInputFormat *>(child.get()))
         throw Exception("An input format based on IRowInputFormat is expected, but provided: " + child->getName(), ErrorCodes::LOGICAL_ERROR);
 
     if (context->getSettingsRef().insert_null_as_default && need_add_defaults)
@@ -62,6 +62,7 @@ class ASTStorage;
     M(UInt64, max_partition_fetch_bytes, 10485760, "Max bytes of each partition read from kafka", 0) \
     M(String, unique_group_prefix, "", "Only used as prefix for storing offsets in bytekv to ensure uniqueness for tob", 0) \
     M(Bool, enable_memory_tracker, false, "Enable memory tracker while consuming", 0) \
+    M(Bool, enable_parallel_parsing, false, "Parse consumed message batches on a thread pool instead of the consumer thread. Only takes effect when no virtual column is consumed, since those are captured per row on the consumer thread", 0) \
     M(Bool, json_aggregate_function_type_base64_encode, false, "Indicate whether the json data of aggregate function type is encoded by base64.", 0) \
     M(Bool, protobuf_enable_multiple_message, true, "Same as 'input_format_protobuf_enable_multiple_message' in settings", 0) \
     M(Bool, protobuf_default_length_parser, false, "Same as 'input_format_protobuf_default_length_parser' in settings", 0) \
@@ -783,9 +783,10 @@ SettingsChanges StorageCloudKafka::createSettingsAdjustments()
     if (settings.input_format_json_read_objects_as_strings.changed)
         result.emplace_back("input_format_json_read_objects_as_strings", settings.input_format_json_read_objects_as_strings.value);
 
-    /// Forbidden parallel parsing for Kafka in case of global setting.
-    /// Kafka cannot support parallel parsing due to virtual column
-    result.emplace_back("input_format_parallel_parsing", false);
+    /// Parallel parsing breaks the per-row capture of virtual columns on the consumer thread,
+    /// so it stays off unless explicitly enabled; streams that do consume virtual columns fall
+    /// back to the row input format regardless (see CnchKafkaBlockInputStream::readPrefixImpl).
+    result.emplace_back("input_format_parallel_parsing", settings.enable_parallel_parsing.value);
 
     result.emplace_back("input_format_json_aggregate_function_type_base64_encode", settings.json_aggregate_function_type_base64_encode.value);
     result.emplace_back("input_format_protobuf_enable_multiple_message", settings.protobuf_enable_multiple_message.value);
@@ -0,0 +1,57 @@
+#include <Storages/MarkCache.h>
+
+#include <IO/ReadBufferFromMemory.h>
+#include <IO/VarInt.h>
+#include <IO/WriteBufferFromString.h>
+#include <Common/MemoryTracker.h>
+
+namespace DB
+{
+
+String MarkCache::compressMarks(const MarksInCompressedFile & marks)
+{
+    /// Memory for the compressed tier belongs to the shared cache, not to the query being executed.
+    MemoryTracker::BlockerInThread temporarily_disable_memory_tracker;
+
+    /// Offsets in the compressed file grow monotonically per column stream; with several columns
+    /// per mark row the interleaved deltas may go backwards, hence the signed encoding.
+    WriteBufferFromOwnString out;
+    writeVarUInt(marks.size(), out);
+    Int64 prev_offset_in_compressed_file = 0;
+    for (const auto & mark : marks)
+    {
+        writeVarInt(static_cast<Int64>(mark.offset_in_compressed_file) - prev_offset_in_compressed_file, out);
+        writeVarUInt(mark.offset_in_decompressed_block, out);
+        prev_offset_in_compressed_file = mark.offset_in_compressed_file;
+    }
+    return out.str();
+}
+
+MarkCache::MappedPtr MarkCache::decompressMarks(const String & compressed)
+{
+    MemoryTracker::BlockerInThread temporarily_disable_memory_tracker;
+
+    ReadBufferFromMemory in(compressed.data(), compressed.size());
+    size_t num_marks = 0;
+    readVarUInt(num_marks, in);
+
+    auto res = std::make_shared<MarksInCompressedFile>(num_marks);
+    Int64 offset_in_compressed_file = 0;
+    for (size_t i = 0; i < num_marks; ++i)
+    {
+        Int64 delta;
+        readVarInt(delta, in);
+        offset_in_compressed_file += delta;
+
+        size_t offset_in_decompressed_block;
+        readVarUInt(offset_in_decompressed_block, in);
+
+        (*res)[i].offset_in_compressed_file = offset_in_compressed_file;
+        (*res)[i].offset_in_decompressed_block = offset_in_decompressed_block;
+    }
+
+    res->protect();
+    return res;
+}
+
+}
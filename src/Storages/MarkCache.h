@@ -14,6 +14,7 @@ namespace ProfileEvents
 {
     extern const Event MarkCacheHits;
     extern const Event MarkCacheMisses;
+    extern const Event MarkCacheCompressedTierHits;
 }
 
 namespace DB
@@ -31,6 +32,14 @@ struct MarksWeightFunction
     }
 };
 
+struct CompressedMarksWeightFunction
+{
+    size_t operator()(const String & compressed_marks) const
+    {
+        return compressed_marks.capacity() + MarksWeightFunction::MARK_CACHE_OVERHEAD;
+    }
+};
+
 
 /** Cache of 'marks' for StorageMergeTree.
   * Marks is an index structure that addresses ranges in column file, corresponding to ranges of primary key.
@@ -72,10 +81,26 @@ public:
 
     void setNvmCache(std::shared_ptr<NvmCache> nvm_cache_) { nvm_cache = nvm_cache_; }
 
+    /// Second in-memory tier keeping evicted marks delta + varint encoded (4-8x smaller than the
+    /// raw offset pairs), so the effective mark cache capacity grows without more RAM. Entries are
+    /// decompressed back into the hot tier on access.
+    void setCompressedTier(size_t max_size_in_bytes)
+    {
+        if (max_size_in_bytes)
+            compressed_tier = std::make_unique<CompressedTier>(max_size_in_bytes);
+    }
+
+    static String compressMarks(const MarksInCompressedFile & marks);
+    static MappedPtr decompressMarks(const String & compressed);
+
 private:
+    using CompressedTier = LRUCache<UInt128, String, UInt128TrivialHash, CompressedMarksWeightFunction>;
 
     void removeExternal(const Key & key, const MappedPtr & value, size_t size) override
     {
+        if (compressed_tier && size)
+            compressed_tier->set(key, std::make_shared<String>(compressMarks(*value)));
+
         if (nvm_cache && nvm_cache->isEnabled() && size)
         {
             auto hash_key = HybridCache::makeHashKey(&key, sizeof(Key));
@@ -89,6 +114,19 @@ private:
 
     MappedPtr loadExternal(const Key & key) override
     {
+        if (compressed_tier)
+        {
+            /// Keep the compressed copy: the hot entry is flagged load_from_external and will not
+            /// be compressed again when it is evicted.
+            if (auto compressed = compressed_tier->get(key))
+            {
+                ProfileEvents::increment(ProfileEvents::MarkCacheCompressedTierHits);
+                auto marks = decompressMarks(*compressed);
+                setInternal(key, marks, true);
+                return marks;
+            }
+        }
+
         if (nvm_cache && nvm_cache->isEnabled())
         {
             auto handle = nvm_cache->find<Mapped>(HybridCache::makeHashKey(&key, sizeof(Key)), [&key, this](std::shared_ptr<void> ptr, HybridCache::Buffer buffer) {
@@ -111,6 +149,7 @@ private:
     }
 
     std::shared_ptr<NvmCache> nvm_cache{};
+    std::unique_ptr<CompressedTier> compressed_tier;
 };
 
 using MarkCachePtr = std::shared_ptr<MarkCache>;
@@ -165,4 +165,59 @@ size_t ActiveDataPartSet::size() const
     return part_info_to_name.size();
 }
 
+ConcurrentActiveDataPartSet::ConcurrentActiveDataPartSet(MergeTreeDataFormatVersion format_version_)
+    : snapshot(std::make_shared<const ActiveDataPartSet>(format_version_))
+{
+}
+
+ConcurrentActiveDataPartSet::ConcurrentActiveDataPartSet(MergeTreeDataFormatVersion format_version_, const Strings & names)
+    : snapshot(std::make_shared<const ActiveDataPartSet>(format_version_, names))
+{
+}
+
+template <typename Mutation>
+bool ConcurrentActiveDataPartSet::modify(Mutation && mutation)
+{
+    std::lock_guard lock(write_mutex);
+    auto next = std::make_shared<ActiveDataPartSet>(*std::atomic_load(&snapshot));
+    bool res = mutation(*next);
+    std::atomic_store(&snapshot, Snapshot(std::move(next)));
+    return res;
+}
+
+bool ConcurrentActiveDataPartSet::add(const String & name, Strings * out_replaced_parts)
+{
+    return modify([&](ActiveDataPartSet & parts) { return parts.add(name, out_replaced_parts); });
+}
+
+bool ConcurrentActiveDataPartSet::remove(const String & part_name)
+{
+    return modify([&](ActiveDataPartSet & parts) { return parts.remove(part_name); });
+}
+
+bool ConcurrentActiveDataPartSet::remove(const MergeTreePartInfo & part_info)
+{
+    return modify([&](ActiveDataPartSet & parts) { return parts.remove(part_info); });
+}
+
+bool ConcurrentActiveDataPartSet::removePartAndCoveredParts(const String & part_name)
+{
+    return modify([&](ActiveDataPartSet & parts) { return parts.removePartAndCoveredParts(part_name); });
+}
+
+bool ConcurrentActiveDataPartSet::removePartsCoveredBy(const String & part_name)
+{
+    return modify([&](ActiveDataPartSet & parts) { return parts.removePartsCoveredBy(part_name); });
+}
+
+void ConcurrentActiveDataPartSet::clear()
+{
+    modify([](ActiveDataPartSet & parts) { parts.clear(); return true; });
+}
+
+ConcurrentActiveDataPartSet::Snapshot ConcurrentActiveDataPartSet::getSnapshot() const
+{
+    return std::atomic_load(&snapshot);
+}
+
 }
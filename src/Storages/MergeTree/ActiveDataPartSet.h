@@ -3,6 +3,8 @@
 #include <Storages/MergeTree/MergeTreePartInfo.h>
 #include <common/types.h>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Poco
@@ -111,4 +113,45 @@ private:
     std::map<MergeTreePartInfo, String>::const_iterator getContainingPartImpl(const MergeTreePartInfo & part_info) const;
 };
 
+/** Thread-safe wrapper around ActiveDataPartSet for instances shared between query and ingest
+  * threads. ActiveDataPartSet itself relies on external synchronization; guarding it with one
+  * mutex makes query-side snapshots contend with ingestion. Here every mutation copies the set
+  * under a writer mutex and publishes the result as a new immutable snapshot, so readers load
+  * the current snapshot atomically and never block on writers.
+  */
+class ConcurrentActiveDataPartSet
+{
+public:
+    using Snapshot = std::shared_ptr<const ActiveDataPartSet>;
+
+    explicit ConcurrentActiveDataPartSet(MergeTreeDataFormatVersion format_version_);
+    ConcurrentActiveDataPartSet(MergeTreeDataFormatVersion format_version_, const Strings & names);
+
+    bool add(const String & name, Strings * out_replaced_parts = nullptr);
+    bool remove(const String & part_name);
+    bool remove(const MergeTreePartInfo & part_info);
+    bool removePartAndCoveredParts(const String & part_name);
+    bool removePartsCoveredBy(const String & part_name);
+    void clear();
+
+    /// Wait-free. The returned set is immutable and stays valid for as long as the caller
+    /// holds it, regardless of concurrent mutations.
+    Snapshot getSnapshot() const;
+
+    String getContainingPart(const String & name) const { return getSnapshot()->getContainingPart(name); }
+    String getContainingPart(const MergeTreePartInfo & part_info) const { return getSnapshot()->getContainingPart(part_info); }
+    Strings getPartsCoveredBy(const MergeTreePartInfo & part_info) const { return getSnapshot()->getPartsCoveredBy(part_info); }
+    Strings getParts() const { return getSnapshot()->getParts(); }
+    size_t size() const { return getSnapshot()->size(); }
+
+private:
+    /// Applies `mutation` to a copy of the current set and publishes the copy.
+    template <typename Mutation>
+    bool modify(Mutation && mutation);
+
+    mutable std::mutex write_mutex;
+    /// Accessed with std::atomic_load / std::atomic_store only.
+    Snapshot snapshot;
+};
+
 }
@@ -21,8 +21,11 @@
 
 #include <Storages/MergeTree/BackgroundJobsExecutor.h>
 #include <Storages/MergeTree/MergeTreeData.h>
+#include <Interpreters/ProcessList.h>
 #include <Common/CurrentMetrics.h>
+#include <Common/SystemUtils.h>
 #include <Common/randomSeed.h>
+#include <common/logger_useful.h>
 #include <pcg_random.hpp>
 #include <random>
 
@@ -51,6 +54,19 @@ IBackgroundJobExecutor::IBackgroundJobExecutor(
         pools.try_emplace(pool_config.pool_type, max_pool_size, 0, max_pool_size, false);
         pools_configs.emplace(pool_config.pool_type, pool_config);
     }
+
+    const auto & config = global_context_->getConfigRef();
+    if (config.has("background_pool_cpuset"))
+    {
+        cpu_set_t mask;
+        if (SystemUtils::parseCpuAffinityMask(config.getString("background_pool_cpuset"), mask))
+            cpu_affinity_mask = mask;
+        else
+            LOG_WARNING(
+                &Poco::Logger::get("BackgroundJobsExecutor"),
+                "Ignoring background_pool_cpuset '{}': cannot parse it or it has no cpu the process may run on",
+                config.getString("background_pool_cpuset"));
+    }
 }
 
 double IBackgroundJobExecutor::getSleepRandomAdd()
@@ -150,6 +166,13 @@ try
 
             pools[job_and_pool.pool_type].scheduleOrThrowOnError([this, metric_decrementor, job{std::move(job_and_pool.job)}] ()
             {
+                /// Confine the job to the configured cores only while foreground queries are
+                /// running; an otherwise idle server may merge on the whole machine. The
+                /// previous affinity is restored before the thread returns to the pool.
+                std::optional<ScopedThreadCpuAffinity> affinity;
+                if (cpu_affinity_mask && getContext()->getProcessList().size() > 0)
+                    affinity.emplace(*cpu_affinity_mask);
+
                 try /// We don't want exceptions in background pool
                 {
                     bool job_success = job();
@@ -25,6 +25,8 @@
 #include <Common/ThreadPool.h>
 #include <Core/BackgroundSchedulePool.h>
 #include <pcg_random.hpp>
+#include <optional>
+#include <sched.h>
 
 
 namespace DB
@@ -99,6 +101,9 @@ private:
 
     /// Pools where we execute background jobs
     std::unordered_map<PoolType, ThreadPool> pools;
+    /// Cores the background jobs are confined to (background_pool_cpuset server config)
+    /// while foreground queries are running; unset means no pinning.
+    std::optional<cpu_set_t> cpu_affinity_mask;
     /// Configs for background pools
     std::unordered_map<PoolType, PoolConfig> pools_configs;
 
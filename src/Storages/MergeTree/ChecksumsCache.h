@@ -73,7 +73,14 @@ struct ChecksumsWeightFunction
         
         // * 1.5 means MergeTreeDataPartChecksums class overhead
         constexpr size_t kApproximatelyBytesPerElement = 128 * 1.5;
-        return (checksums->files.size() * kApproximatelyBytesPerElement) + CHECKSUM_CACHE_OVERHEAD;
+        size_t res = (checksums->files.size() * kApproximatelyBytesPerElement) + CHECKSUM_CACHE_OVERHEAD;
+        /// Stream names that do not fit the String SSO buffer (e.g. implicit map columns on
+        /// wide tables) allocate separately and can dominate the real footprint, so charge
+        /// them explicitly to keep eviction honest.
+        for (const auto & [file_name, _] : checksums->files)
+            if (file_name.size() > sizeof(String))
+                res += file_name.size();
+        return res;
     }
 };
 
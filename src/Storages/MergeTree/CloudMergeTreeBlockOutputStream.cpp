@@ -79,6 +79,13 @@ void CloudMergeTreeBlockOutputStream::checkAndInit()
             LOG_DEBUG(log, "enable append dedup key mode");
     }
 
+    /// Unique tables keep their per-block dedup and delete-flag semantics, so the incoming
+    /// stream is buffered into bigger blocks only for plain tables.
+    const auto & settings = context->getSettingsRef();
+    if ((settings.cnch_part_min_rows_to_dump || settings.cnch_part_min_bytes_to_dump) && !metadata_snapshot->hasUniqueKey())
+        part_squashing
+            = std::make_unique<SquashingTransform>(settings.cnch_part_min_rows_to_dump, settings.cnch_part_min_bytes_to_dump);
+
     initOverwritePartitionPruner();
 }
 
@@ -112,6 +119,18 @@ void CloudMergeTreeBlockOutputStream::writePrefix()
 }
 
 void CloudMergeTreeBlockOutputStream::write(const Block & block)
+{
+    if (part_squashing)
+    {
+        if (auto squashed = part_squashing->add(block))
+            writeBlock(squashed);
+        return;
+    }
+
+    writeBlock(block);
+}
+
+void CloudMergeTreeBlockOutputStream::writeBlock(const Block & block)
 {
     Stopwatch watch;
     LOG_DEBUG(storage.getLogger(), "Start to write new block of size: {}", block.rows());
@@ -157,7 +176,8 @@ void CloudMergeTreeBlockOutputStream::write(const Block & block)
     cnch_writer.schedule(temp_parts, bitmaps, temp_staged_parts);
 }
 
-MergeTreeMutableDataPartsVector CloudMergeTreeBlockOutputStream::convertBlockIntoDataParts(const Block & block, bool use_inner_block_id)
+MergeTreeMutableDataPartsVector
+CloudMergeTreeBlockOutputStream::convertBlockIntoDataParts(const Block & block, bool use_inner_block_id, const Row * known_partition)
 {
     auto part_log = context->getGlobalContext()->getPartLog(storage.getDatabaseName());
     auto merge_tree_settings = storage.getSettings();
@@ -165,13 +185,16 @@ MergeTreeMutableDataPartsVector CloudMergeTreeBlockOutputStream::convertBlockInt
 
     BlocksWithPartition part_blocks;
 
+    /// The whole block is known to belong to one partition, don't re-evaluate the partition key.
+    if (known_partition)
+        part_blocks.emplace_back(Block(block), Row(*known_partition));
     /// For unique table, need to ensure that each part does not contain duplicate keys
     /// - when unique key is partition-level, split into sub-blocks first and then dedup the sub-block for each partition
     /// - when unique key is table-level
     /// -   if without version column, should dedup the input block first because split may change row order
     /// -   if use partition value as version, split first because `dedupWithUniqueKey` doesn't evaluate partition key expression
     /// -   if use explicit version, both approach work
-    if (metadata_snapshot->hasUniqueKey() && !merge_tree_settings->partition_level_unique_keys
+    else if (metadata_snapshot->hasUniqueKey() && !merge_tree_settings->partition_level_unique_keys
         && !storage.merging_params.partitionValueAsVersion())
     {
         FilterInfo filter_info = dedupWithUniqueKey(block);
@@ -303,6 +326,12 @@ MergeTreeMutableDataPartsVector CloudMergeTreeBlockOutputStream::convertBlockInt
 
 void CloudMergeTreeBlockOutputStream::writeSuffix()
 {
+    if (part_squashing)
+    {
+        if (auto remaining = part_squashing->add({}))
+            writeBlock(remaining);
+    }
+
     cnch_writer.finalize();
     auto & dumped_data = cnch_writer.res;
 
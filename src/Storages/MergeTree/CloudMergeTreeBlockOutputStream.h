@@ -18,6 +18,7 @@
 #include <CloudServices/CnchDedupHelper.h>
 #include <CloudServices/CnchDataWriter.h>
 #include <DataStreams/IBlockOutputStream.h>
+#include <DataStreams/SquashingTransform.h>
 #include <Storages/MergeTree/MergeTreeCNCHDataDumper.h>
 #include <Storages/MergeTree/MergeTreeDataWriter.h>
 #include <Storages/MergeTree/PartitionPruner.h>
@@ -44,13 +45,20 @@ public:
 
     void writePrefix() override;
     void write(const Block & block) override;
-    MergeTreeMutableDataPartsVector convertBlockIntoDataParts(const Block & block, bool use_inner_block_id = false);
+    /// `known_partition` marks the block as belonging entirely to that partition (e.g. when
+    /// reclustering a single part), so the partition key is not re-evaluated row by row and
+    /// the block is only split by cluster key into exactly the affected buckets.
+    MergeTreeMutableDataPartsVector
+    convertBlockIntoDataParts(const Block & block, bool use_inner_block_id = false, const Row * known_partition = nullptr);
     void writeSuffix() override;
     void writeSuffixImpl();
 
     void disableTransactionCommit() { disable_transaction_commit = true; }
 
 private:
+    /// Converts one (possibly squashed) block into parts and hands them to the cnch writer.
+    void writeBlock(const Block & block);
+
     using FilterInfo = CnchDedupHelper::FilterInfo;
     FilterInfo dedupWithUniqueKey(const Block & block);
 
@@ -69,6 +77,11 @@ private:
     MergeTreeDataWriter writer;
     CnchDataWriter cnch_writer;
 
+    /// Buffers the incoming stream into bigger blocks before parts are formed, so that
+    /// INSERT SELECT copies dump fewer, larger parts to remote storage and leave less work
+    /// to subsequent merges (cnch_part_min_rows_to_dump / cnch_part_min_bytes_to_dump).
+    std::unique_ptr<SquashingTransform> part_squashing;
+
     // if we want to do batch preload indexing in write suffix
     MutableMergeTreeDataPartsCNCHVector preload_parts;
 
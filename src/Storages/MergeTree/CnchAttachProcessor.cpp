@@ -14,6 +14,7 @@
  */
 
 #include <Storages/MergeTree/CnchAttachProcessor.h>
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <numeric>
@@ -1421,104 +1422,132 @@ CnchAttachProcessor::PartsWithHistory  CnchAttachProcessor::prepareParts(
         }
         case DiskType::Type::ByteS3:
         {
-            UndoResources undo_resources;
             TxnTimestamp txn_id = query_ctx->getCurrentTransaction()->getTransactionID();
 
-            size_t offset = 0;
             UInt64 table_def_hash = target_tbl.getTableHashForClusterBy().getDeterminHash();
             bool is_user_defined_cluster_by_expression = target_tbl.getInMemoryMetadataPtr()->getIsUserDefinedExpressionFromClusterByKey();
             String from_storage_uuid = from_storage == nullptr ? "" : UUIDHelpers::UUIDToString(from_storage->getStorageUUID());
 
-            std::unordered_map<String, LocalDeleteBitmapPtr> new_bitmaps;
+            // Metadata generation is independent per part; for large backfills run it on
+            // the worker pool and keep each part's results in its own slot, then flatten
+            // in part order so the undo buffer content stays deterministic
+            std::vector<UndoResources> undo_resources_per_part(total_parts_count);
+            std::vector<std::pair<String, LocalDeleteBitmapPtr>> new_bitmaps_per_part(total_parts_count);
+
+            size_t offset = 0;
+            auto & worker_pool = attach_ctx.getWorkerPool(total_parts_count);
             for (auto & parts_and_infos : parts_and_infos_from_sources)
             {
                 for (std::pair<IMergeTreeDataPartPtr, MergeTreePartInfo>& part_and_info : parts_and_infos)
                 {
-                    const IMergeTreeDataPartPtr& part = part_and_info.first;
-                    const MergeTreePartInfo& part_info = part_and_info.second;
-                    String part_name = part->info.getPartName();
-
-                    if (!from_storage_uuid.empty())
-                    {
-                        // Write part's origin meta into undo buffer, so when we rollback
-                        // we can revert changes like part's column commit time
-                        Protos::DataModelPart origin_part_model;
-                        fillPartModel(*from_storage, *part, origin_part_model);
-                        undo_resources.emplace_back(txn_id, UndoResourceType::S3AttachPart,
-                            from_storage_uuid, part->info.getPartNameWithHintMutation(), part->info.getPartName(),
-                            origin_part_model.SerializeAsString(), part_info.getPartName());
-                    }
-                    else
-                    {
-                        undo_resources.emplace_back(txn_id, UndoResourceType::S3VolatilePart,
-                            part->info.getPartNameWithHintMutation());
-                    }
-                    Protos::DataModelPart part_model;
-                    fillPartModel(target_tbl, *part, part_model, true);
-                    // Assign new part info
-                    auto part_info_model = part_model.mutable_part_info();
-                    part_info_model->set_partition_id(part_info.partition_id);
-                    part_info_model->set_min_block(part_info.min_block);
-                    part_info_model->set_max_block(part_info.max_block);
-                    part_info_model->set_level(part_info.level);
-                    part_info_model->set_mutation(part_info.mutation);
-                    part_info_model->set_hint_mutation(part_info.hint_mutation);
-
-                    // Discard part's commit time & end time
-                    part_model.set_commit_time(IMergeTreeDataPart::NOT_INITIALIZED_COMMIT_TIME);
-                    part_model.clear_end_time();
-                    parts_with_history.first[offset] = part;
-                    parts_with_history.second[offset] = createPartFromModel(target_tbl, part_model, part_info.getPartNameWithHintMutation());
-                    if (!query_ctx->getSettingsRef().allow_attach_parts_with_different_table_definition_hash || is_user_defined_cluster_by_expression)
-                        parts_with_history.second[offset]->table_definition_hash = table_def_hash;
-
-                    // Rewrite delete bitmap file
-                    if (is_unique_tbl && !from_storage_uuid.empty()) /// attach part from path will not have bitmap
-                    {
-                        DataModelDeleteBitmapPtr attach_meta;
+                    worker_pool.scheduleOrThrowOnError(
+                        [&parts_with_history, &undo_resources_per_part, &new_bitmaps_per_part, &from_storage_uuid, txn_id,
+                         table_def_hash, is_user_defined_cluster_by_expression, offset, part = part_and_info.first,
+                         part_info = part_and_info.second, this]() {
+                        UndoResources & undo_resources = undo_resources_per_part[offset];
+                        if (!from_storage_uuid.empty())
                         {
-                            std::lock_guard<std::mutex> lock(unique_table_info_mutex);
-                            attach_meta = attach_metas[part->name];
+                            // Write part's origin meta into undo buffer, so when we rollback
+                            // we can revert changes like part's column commit time
+                            Protos::DataModelPart origin_part_model;
+                            fillPartModel(*from_storage, *part, origin_part_model);
+                            undo_resources.emplace_back(txn_id, UndoResourceType::S3AttachPart,
+                                from_storage_uuid, part->info.getPartNameWithHintMutation(), part->info.getPartName(),
+                                origin_part_model.SerializeAsString(), part_info.getPartName());
                         }
-                        if (attach_meta)
+                        else
                         {
-                            /// Due to S3 don't support move file, and delete bitmap file is small.
-                            /// For convenience, we generate a new bitmap file here.
-                            DeleteBitmapPtr bitmap = std::make_shared<Roaring>();
-                            deserializeDeleteBitmapInfo(part->storage, attach_meta, bitmap);
-                            auto new_delete_bitmap = LocalDeleteBitmap::createBase(part_info, bitmap, txn_id, part->bucket_number);
-                            auto & new_bitmap_model = new_delete_bitmap->getModel();
-                            UndoResource ub(
-                                txn_id,
-                                UndoResourceType::S3AttachDeleteBitmap,
-                                from_storage_uuid,
-                                dataModelName(*attach_meta),
-                                attach_meta->SerializeAsString(),
-                                dataModelName(*new_bitmap_model),
-                                DeleteBitmapMeta::deleteBitmapFileRelativePath(*new_bitmap_model));
-                            ub.setDiskName(part->volume->getDisk()->getName());
-                            undo_resources.emplace_back(ub);
-                            new_bitmaps[parts_with_history.second[offset]->name] = std::move(new_delete_bitmap);
+                            undo_resources.emplace_back(txn_id, UndoResourceType::S3VolatilePart,
+                                part->info.getPartNameWithHintMutation());
                         }
-                    }
+                        Protos::DataModelPart part_model;
+                        fillPartModel(target_tbl, *part, part_model, true);
+                        // Assign new part info
+                        auto part_info_model = part_model.mutable_part_info();
+                        part_info_model->set_partition_id(part_info.partition_id);
+                        part_info_model->set_min_block(part_info.min_block);
+                        part_info_model->set_max_block(part_info.max_block);
+                        part_info_model->set_level(part_info.level);
+                        part_info_model->set_mutation(part_info.mutation);
+                        part_info_model->set_hint_mutation(part_info.hint_mutation);
+
+                        // Discard part's commit time & end time
+                        part_model.set_commit_time(IMergeTreeDataPart::NOT_INITIALIZED_COMMIT_TIME);
+                        part_model.clear_end_time();
+                        parts_with_history.first[offset] = part;
+                        parts_with_history.second[offset] = createPartFromModel(target_tbl, part_model, part_info.getPartNameWithHintMutation());
+                        if (!query_ctx->getSettingsRef().allow_attach_parts_with_different_table_definition_hash || is_user_defined_cluster_by_expression)
+                            parts_with_history.second[offset]->table_definition_hash = table_def_hash;
+
+                        // Rewrite delete bitmap file
+                        if (is_unique_tbl && !from_storage_uuid.empty()) /// attach part from path will not have bitmap
+                        {
+                            DataModelDeleteBitmapPtr attach_meta;
+                            {
+                                std::lock_guard<std::mutex> lock(unique_table_info_mutex);
+                                attach_meta = attach_metas[part->name];
+                            }
+                            if (attach_meta)
+                            {
+                                /// Due to S3 don't support move file, and delete bitmap file is small.
+                                /// For convenience, we generate a new bitmap file here.
+                                DeleteBitmapPtr bitmap = std::make_shared<Roaring>();
+                                deserializeDeleteBitmapInfo(part->storage, attach_meta, bitmap);
+                                auto new_delete_bitmap = LocalDeleteBitmap::createBase(part_info, bitmap, txn_id, part->bucket_number);
+                                auto & new_bitmap_model = new_delete_bitmap->getModel();
+                                UndoResource ub(
+                                    txn_id,
+                                    UndoResourceType::S3AttachDeleteBitmap,
+                                    from_storage_uuid,
+                                    dataModelName(*attach_meta),
+                                    attach_meta->SerializeAsString(),
+                                    dataModelName(*new_bitmap_model),
+                                    DeleteBitmapMeta::deleteBitmapFileRelativePath(*new_bitmap_model));
+                                ub.setDiskName(part->volume->getDisk()->getName());
+                                undo_resources.emplace_back(ub);
+                                new_bitmaps_per_part[offset]
+                                    = {parts_with_history.second[offset]->name, std::move(new_delete_bitmap)};
+                            }
+                        }
+                    });
 
                     ++offset;
                 }
             }
+            worker_pool.wait();
+
+            UndoResources undo_resources;
+            undo_resources.reserve(total_parts_count);
+            for (auto & part_resources : undo_resources_per_part)
+                for (auto & resource : part_resources)
+                    undo_resources.emplace_back(std::move(resource));
 
-            /// Write undo buffer first
+            /// Write undo buffer first. Catalog splits it into batches of
+            /// max_commit_size_one_batch internally
             query_ctx->getCnchCatalog()->writeUndoBuffer(target_tbl.getCnchStorageID(), txn_id, undo_resources);
 
-            /// Dump new bitmap
-            for (const auto & [part_name, new_bitmap] : new_bitmaps)
+            /// Dump new bitmaps in parallel, each dump is a separate object store write
+            auto & dump_pool = attach_ctx.getWorkerPool(total_parts_count);
+            for (const auto & part_and_bitmap : new_bitmaps_per_part)
             {
-                auto new_bitmap_meta = new_bitmap->dump(target_tbl);
-                std::lock_guard<std::mutex> lock(unique_table_info_mutex);
-                attach_metas[part_name] = new_bitmap_meta->getModel();
+                if (part_and_bitmap.second == nullptr)
+                    continue;
+                dump_pool.scheduleOrThrowOnError([this, &part_and_bitmap]() {
+                    auto new_bitmap_meta = part_and_bitmap.second->dump(target_tbl);
+                    std::lock_guard<std::mutex> lock(unique_table_info_mutex);
+                    attach_metas[part_and_bitmap.first] = new_bitmap_meta->getModel();
+                });
             }
+            dump_pool.wait();
 
             if (is_unique_tbl)
-                LOG_DEBUG(logger, "Unique table {} generates {} new bitmaps.", target_tbl.getStorageID().getNameForLogs(), new_bitmaps.size());
+            {
+                size_t new_bitmaps_count = std::count_if(
+                    new_bitmaps_per_part.begin(),
+                    new_bitmaps_per_part.end(),
+                    [](const auto & part_and_bitmap) { return part_and_bitmap.second != nullptr; });
+                LOG_DEBUG(logger, "Unique table {} generates {} new bitmaps.", target_tbl.getStorageID().getNameForLogs(), new_bitmaps_count);
+            }
             break;
         }
         default:
@@ -15,8 +15,11 @@
 
 #include <Storages/MergeTree/DanceMergeSelector.h>
 
+#include <Core/UUID.h>
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
 #include <Storages/MergeTree/IMergeTreeDataPart.h>
 #include <Storages/MergeTree/MergeScheduler.h>
+#include <Storages/MergeTree/MergeSelectorAdaptiveController.h>
 #include <Common/Exception.h>
 #include <Common/interpolate.h>
 
@@ -218,6 +221,14 @@ void DanceMergeSelector::selectWithinPartition(const PartsRange & parts, const s
     auto & partition_id = toPart(parts.front().data)->info.partition_id;
     bool enable_batch_select = enable_batch_select_for_partition(partition_id);
 
+    current_base_multiplier = 1.0;
+    if (settings.enable_adaptive_base)
+    {
+        if (table_uuid.empty())
+            table_uuid = UUIDHelpers::UUIDToString(data.getStorageUUID());
+        current_base_multiplier = MergeSelectorAdaptiveController::instance().getBaseMultiplier(table_uuid, partition_id);
+    }
+
     /// score_table[i][j] means begin with i and length is j --> range [i, i + j - 1]
     std::vector<std::vector<double>> score_table;
     size_t max_parts_to_merge = settings.max_parts_to_merge_base;
@@ -387,7 +398,11 @@ bool DanceMergeSelector::allow(double sum_size, double max_size, double min_age,
 
     //    std::cerr << "combined_ratio: " << combined_ratio << "\n";
 
-    double lowered_base = interpolateLinear(settings.min_parts_to_merge_base, 2.0, combined_ratio);
+    /// The feedback controller scales the base down while the partition's part count keeps
+    /// growing and back up while realized write amplification stays above target.
+    double adjusted_base = std::max(
+        std::min<double>(settings.min_parts_to_merge_base, 2.0), settings.min_parts_to_merge_base * current_base_multiplier);
+    double lowered_base = interpolateLinear(adjusted_base, 2.0, combined_ratio);
 
     //    std::cerr << "------- lowered_base: " << lowered_base << "\n";
 
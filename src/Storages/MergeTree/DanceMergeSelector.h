@@ -54,6 +54,9 @@ class MergeTreeMetaBase;
 \
     /** After the age is over the threshold, a single part chain (generated by mutations) can perform a merge task to reduce the chain depth. */ \
     M(UInt64, max_age_for_single_part_chain, 4 * 3600, "", 0) \
+\
+    /** Scale min_parts_to_merge_base per partition with the write-amplification feedback controller (MergeSelectorAdaptiveController). */ \
+    M(Bool, enable_adaptive_base, false, "", 0) \
 
 DECLARE_SETTINGS_TRAITS(DanceMergeSelectorSettingsTraits, LIST_OF_DANCE_MERGE_SELECTOR_SETTINGS)
 
@@ -104,6 +107,11 @@ private:
     [[maybe_unused]] const MergeTreeMetaBase & data;
     const Settings settings;
 
+    /// Per-partition scale for min_parts_to_merge_base, refreshed by selectWithinPartition
+    /// from the feedback controller when enable_adaptive_base is set.
+    double current_base_multiplier = 1.0;
+    String table_uuid;
+
     std::unordered_map<String, size_t> num_parts_of_partitions;
     std::unordered_map<String, std::vector<BestRangeWithScore>> best_ranges;
 
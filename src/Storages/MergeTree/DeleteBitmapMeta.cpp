@@ -44,6 +44,7 @@ std::shared_ptr<LocalDeleteBitmap> LocalDeleteBitmap::createBaseOrDelta(
     const DeleteBitmapPtr & delta_bitmap,
     UInt64 txn_id,
     bool force_create_base_bitmap,
+    UInt64 max_delta_cardinality,
     int64_t bucket_number)
 {
     if (!delta_bitmap)
@@ -53,7 +54,10 @@ std::shared_ptr<LocalDeleteBitmap> LocalDeleteBitmap::createBaseOrDelta(
     if (!base_bitmap)
         return std::make_shared<LocalDeleteBitmap>(part_info, DeleteBitmapMetaType::Base, txn_id, delta_bitmap, bucket_number);
 
-    if (!force_create_base_bitmap && delta_bitmap->cardinality() <= DeleteBitmapMeta::kInlineBitmapMaxCardinality)
+    /// Deltas larger than `kInlineBitmapMaxCardinality` are simply dumped to bitmap files
+    /// instead of inline catalog values, so the threshold here only trades read-side merge
+    /// work (bounded by `max_delete_bitmap_meta_depth`) against base rewrite write amplification.
+    if (!force_create_base_bitmap && delta_bitmap->cardinality() <= max_delta_cardinality)
     {
         return std::make_shared<LocalDeleteBitmap>(part_info, DeleteBitmapMetaType::Delta, txn_id, delta_bitmap, bucket_number);
     }
@@ -54,7 +54,7 @@ public:
         return std::make_shared<LocalDeleteBitmap>(part_info, DeleteBitmapMetaType::Base, txn_id, bitmap, bucket_number);
     }
 
-    /// If the delta part is small, just create a delta bitmap.
+    /// If the delta part has no more than `max_delta_cardinality` rows, just create a delta bitmap.
     /// Otherwise union `base_bitmap` and `delta_bitmap` to create a new version of base bitmap.
     /// NOTE: `delta_bitmap` will be modified to be the new base bitmap in the latter case.
     /// REQUIRES: both `base_bitmap` and `delta_bitmap` should be not null
@@ -64,6 +64,7 @@ public:
         const DeleteBitmapPtr & delta_bitmap,
         UInt64 txn_id,
         bool force_create_base_bitmap,
+        UInt64 max_delta_cardinality,
         int64_t bucket_number);
 
     static std::shared_ptr<LocalDeleteBitmap>
@@ -306,6 +306,11 @@ struct PostingsCacheForStore
     /// map of <query, postings lists>
     std::unordered_map<String, GinPostingsCachePtr> cache;
 
+    /// map of <query, per-segment conjunction of the query terms' postings lists>; built once per
+    /// query string and reused for every row ID range check, so conjunctive multi-term queries do
+    /// not re-intersect the full postings lists for each granule
+    std::unordered_map<String, std::shared_ptr<GinSegmentedPostingsListContainer>> conjunction_cache;
+
     /// Get postings lists for query string, return nullptr if not found
     GinPostingsCachePtr getPostings(const String & query_string) const;
 };
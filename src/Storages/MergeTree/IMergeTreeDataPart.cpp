@@ -519,7 +519,9 @@ std::pair<time_t, time_t> IMergeTreeDataPart::getMinMaxTime() const
 
 void IMergeTreeDataPart::setColumns(const NamesAndTypesList & new_columns)
 {
-    setColumnsPtr(std::make_shared<NamesAndTypesList>(new_columns));
+    /// Parts of the same table (and of other tables with the same schema) share one
+    /// interned list; the part never mutates it, only replaces the pointer.
+    setColumnsPtr(internNamesAndTypesList(new_columns));
 }
 
 void IMergeTreeDataPart::setColumnsPtr(const NamesAndTypesListPtr & new_columns_ptr)
@@ -893,6 +895,7 @@ void IMergeTreeDataPart::loadProjections(bool require_columns_checksums, bool ch
             auto part = storage.createPart(projection.name, {"all", 0, 0, 0}, volume, projection.name + ".proj", this);
             part->loadColumnsChecksumsIndexes(require_columns_checksums, check_consistency);
             projection_parts.emplace(projection.name, std::move(part));
+            projection_parts_names.insert(projection.name);
         }
     }
 }
@@ -21,6 +21,7 @@
 
 #include <DataTypes/NestedUtils.h>
 #include <DataTypes/DataTypeArray.h>
+#include <DataTypes/LowCardinalityDictionaryCache.h>
 #include <DataTypes/MapHelpers.h>
 #include <Common/escapeForFileName.h>
 #include <Compression/CachedCompressedReadBuffer.h>
@@ -30,6 +31,9 @@
 #include <Interpreters/inplaceBlockConversions.h>
 #include <Storages/MergeTree/IMergeTreeReader.h>
 #include <Storages/MergeTree/MergeTreeSuffix.h>
+#include <Common/CurrentThread.h>
+#include <Common/Exception.h>
+#include <Common/setThreadName.h>
 #include <Common/typeid_cast.h>
 #include <Storages/MergeTree/Index/MergeTreeBitmapIndexReader.h>
 
@@ -272,6 +276,31 @@ bool IMergeTreeReader::isLowCardinalityDictionary(const ISerialization::Substrea
     return substream_path.size() > 1 && substream_path[substream_path.size() - 2].type == ISerialization::Substream::Type::DictionaryKeys;
 }
 
+String IMergeTreeReader::lowCardinalityDictionaryCacheKey(
+    const NameAndTypePair & name_and_type, const ISerialization::SubstreamPath & substream_path)
+{
+    String stream_name = ISerialization::getFileNameForStream(name_and_type, substream_path);
+
+    auto stream_it = streams.find(stream_name);
+    if (stream_it == streams.end() || !stream_it->second->isSingleDictionaryStream())
+        return {};
+
+    auto checksums = data_part->getChecksums();
+    if (!checksums)
+        return {};
+
+    auto file_it = checksums->files.find(stream_name + DATA_FILE_EXTENSION);
+    if (file_it == checksums->files.end())
+        return {};
+
+    /// Identical dictionary content in different parts yields the same key, so readers of those
+    /// parts share one decoded ColumnUnique.
+    const auto & checksum = file_it->second;
+    const auto & hash = checksum.is_compressed ? checksum.uncompressed_hash : checksum.file_hash;
+    UInt64 size = checksum.is_compressed ? checksum.uncompressed_size : checksum.file_size;
+    return std::to_string(hash.first) + "_" + std::to_string(hash.second) + "_" + std::to_string(size);
+}
+
 void IMergeTreeReader::addByteMapStreams(
     const NameAndTypePair & name_and_type,
     const String & col_name,
@@ -574,6 +603,15 @@ void IMergeTreeReader::readData(
     
     deserialize_settings.zero_copy_read_from_cache = settings.read_settings.zero_copy_read_from_cache;
 
+    if (auto dictionary_cache = storage.getContext()->getLowCardinalityDictionaryCache())
+    {
+        deserialize_settings.low_cardinality_dictionary_cache = dictionary_cache;
+        deserialize_settings.low_cardinality_dictionary_cache_key_getter = [&](const ISerialization::SubstreamPath & substream_path)
+        {
+            return lowCardinalityDictionaryCacheKey(name_and_type, substream_path);
+        };
+    }
+
     const auto & name = name_and_type.name;
     const SerializationPtr & serialization = serializations[name];
     deserializePrefix(serialization, name_and_type, current_task_last_mark, cache);
@@ -604,6 +642,15 @@ size_t IMergeTreeReader::skipData(const NameAndTypePair & name_and_type,
         return getCompressedIndex(data_part, name_and_type, substream_path);
     };
 
+    if (auto dictionary_cache = storage.getContext()->getLowCardinalityDictionaryCache())
+    {
+        deserialize_settings.low_cardinality_dictionary_cache = dictionary_cache;
+        deserialize_settings.low_cardinality_dictionary_cache_key_getter = [&](const ISerialization::SubstreamPath & substream_path)
+        {
+            return lowCardinalityDictionaryCacheKey(name_and_type, substream_path);
+        };
+    }
+
     const auto & name = name_and_type.name;
     const SerializationPtr & serialization = serializations[name];
     deserializePrefix(serialization, name_and_type, current_task_last_mark, cache);
@@ -622,6 +669,144 @@ size_t IMergeTreeReader::skipData(const NameAndTypePair & name_and_type,
         max_rows_to_skip, deserialize_settings, deserialize_state, &cache);
 }
 
+size_t IMergeTreeReader::readPhysicalColumns(
+    size_t num_columns, size_t from_mark, bool continue_reading,
+    size_t current_task_last_mark, size_t rows_to_read,
+    std::unordered_map<String, size_t> & res_col_to_idx, Columns & res_columns,
+    int & row_number_column_pos)
+{
+    size_t read_rows = 0;
+
+    auto read_column = [&](const NameAndTypePair & column_from_part, size_t pos) -> size_t
+    {
+        const auto & [name, type] = column_from_part;
+        auto & column = res_columns[pos];
+        size_t rows_read = 0;
+        try
+        {
+            size_t column_size_before_reading = column->size();
+            auto & cache = caches[column_from_part.getNameInStorage()];
+            if (type->isByteMap())
+                readMapDataNotKV(column_from_part, column, from_mark, continue_reading,
+                    current_task_last_mark, rows_to_read, res_col_to_idx, res_columns);
+            else
+                readData(column_from_part, column, from_mark, continue_reading,
+                    current_task_last_mark, rows_to_read, cache);
+
+            /// For elements of Nested, column_size_before_reading may be greater than column size
+            ///  if offsets are not empty and were already read, but elements are empty.
+            if (!column->empty())
+                rows_read = column->size() - column_size_before_reading;
+        }
+        catch (Exception & e)
+        {
+            /// Better diagnostics.
+            e.addMessage("(while reading column " + name + ")");
+            throw;
+        }
+
+        if (column->empty())
+            res_columns[pos] = nullptr;
+
+        return rows_read;
+    };
+
+    /// Columns whose streams are disjoint may be decoded concurrently, overlapping the
+    /// decompression and deserialization of wide reads. Grouping by the nested table name
+    /// keeps columns that share substreams — Nested siblings reading one offsets file — in
+    /// their serial order on a single thread. ByteMap columns and reads with duplicated
+    /// implicit keys interact with other result columns, so they stay on the query thread.
+    std::map<String, std::vector<std::pair<NameAndTypePair, size_t>>> deferred_groups;
+    bool parallel_decode = settings.read_columns_max_parallelism > 1 && dup_implicit_keys.empty();
+
+    auto name_and_type = sort_columns.begin();
+    for (size_t i = 0; i < num_columns; ++i, ++name_and_type)
+    {
+        auto column_from_part = getColumnFromPart(*name_and_type);
+        const auto & [name, type] = column_from_part;
+        size_t pos = res_col_to_idx[name];
+
+        if (!res_columns[pos])
+        {
+            type->enable_zero_cpy_read = settings.read_settings.zero_copy_read_from_cache;
+            res_columns[pos] = type->createColumn();
+        }
+
+        /// row number column will be populated at last after `read_rows` is set
+        if (name == "_part_row_number")
+        {
+            row_number_column_pos = static_cast<int>(pos);
+            continue;
+        }
+
+        if (parallel_decode && !type->isByteMap())
+        {
+            /// Touch the per-column entries of the shared maps on the query thread, so that
+            /// the decode threads only ever look existing entries up.
+            caches[column_from_part.getNameInStorage()];
+            avg_value_size_hints[name];
+            deserialize_binary_bulk_state_map[name];
+            serializations[name];
+            deferred_groups[Nested::extractTableName(column_from_part.getNameInStorage())]
+                .emplace_back(column_from_part, pos);
+            continue;
+        }
+
+        read_rows = std::max(read_rows, read_column(column_from_part, pos));
+    }
+
+    if (deferred_groups.size() == 1)
+    {
+        for (const auto & [column_from_part, pos] : deferred_groups.begin()->second)
+            read_rows = std::max(read_rows, read_column(column_from_part, pos));
+    }
+    else if (!deferred_groups.empty())
+    {
+        if (!column_decode_pool)
+            column_decode_pool = std::make_unique<ThreadPool>(settings.read_columns_max_parallelism);
+
+        ExceptionHandler exception_handler;
+        std::vector<size_t> group_read_rows(deferred_groups.size(), 0);
+        auto thread_group = CurrentThread::getGroup();
+
+        try
+        {
+            size_t group_idx = 0;
+            for (auto & group_entry : deferred_groups)
+            {
+                column_decode_pool->scheduleOrThrowOnError(createExceptionHandledJob(
+                    [&, group = &group_entry.second, group_rows = &group_read_rows[group_idx]]
+                    {
+                        setThreadName("ColumnDecode");
+                        if (thread_group)
+                            CurrentThread::attachToIfDetached(thread_group);
+
+                        for (const auto & [column_from_part, pos] : *group)
+                            *group_rows = std::max(*group_rows, read_column(column_from_part, pos));
+                    },
+                    exception_handler));
+                ++group_idx;
+            }
+        }
+        catch (...)
+        {
+            /// Scheduled jobs reference the local state, wait for them before unwinding.
+            column_decode_pool->wait();
+            throw;
+        }
+
+        column_decode_pool->wait();
+        exception_handler.throwIfException();
+
+        for (size_t group_rows : group_read_rows)
+            read_rows = std::max(read_rows, group_rows);
+    }
+
+    caches.clear();
+
+    return read_rows;
+}
+
 bool IMergeTreeReader::hasBitmapIndexReader() const
 {
     if (index_executor && index_executor->valid())
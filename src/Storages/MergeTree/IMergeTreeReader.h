@@ -23,6 +23,7 @@
 
 #include <limits>
 #include <Core/NamesAndTypes.h>
+#include <Common/ThreadPool.h>
 #include <Storages/MergeTree/MergeTreeReaderStream.h>
 #include <Storages/MergeTree/MergeTreeBlockReadUtils.h>
 #include <sparsehash/dense_hash_map>
@@ -116,6 +117,13 @@ protected:
         ISerialization::SubstreamsCache & cache);
 
     bool isLowCardinalityDictionary(const ISerialization::SubstreamPath & substream_path);
+
+    /// Key under which the decoded dictionary of the given LowCardinality dictionary substream may
+    /// be shared via LowCardinalityDictionaryCache, built from the dictionary file checksum.
+    /// Returns an empty string when sharing is unsafe (the stream holds more than one dictionary)
+    /// or the checksum is not available.
+    String lowCardinalityDictionaryCacheKey(
+        const NameAndTypePair & name_and_type, const ISerialization::SubstreamPath & substream_path);
     /// Returns actual column type in part, which can differ from table metadata.
     NameAndTypePair getColumnFromPart(const NameAndTypePair & required_column);
 
@@ -142,6 +150,17 @@ protected:
         const NameAndTypePair & name_and_type, size_t from_mark, bool continue_reading,
         size_t current_task_last_mark, size_t max_rows_to_skip, ISerialization::SubstreamsCache & cache);
 
+    /// Reads all requested physical columns for one mark range batch; the shared part of
+    /// readNecessaryRows of the concrete readers. Columns with disjoint streams are decoded
+    /// concurrently when settings.read_columns_max_parallelism allows it. Returns the number
+    /// of rows read and reports the position of the _part_row_number column (-1 if absent)
+    /// for the caller to populate.
+    size_t readPhysicalColumns(
+        size_t num_columns, size_t from_mark, bool continue_reading,
+        size_t current_task_last_mark, size_t rows_to_read,
+        std::unordered_map<String, size_t> & res_col_to_idx, Columns & res_columns,
+        int & row_number_column_pos);
+
     void deserializePrefix(
         const SerializationPtr & serialization,
         const NameAndTypePair & name_and_type,
@@ -188,6 +207,8 @@ protected:
     MergeTreeIndexExecutor * index_executor = nullptr;
 
     std::unordered_map<String, ISerialization::SubstreamsCache> caches;
+    /// Lazily created pool reused across readPhysicalColumns calls for parallel column decoding.
+    std::unique_ptr<ThreadPool> column_decode_pool;
     std::unordered_set<std::string> prefetched_streams;
     /// Row number, update on seek or read, set to size_t max to force a seek
     /// when reader start reading
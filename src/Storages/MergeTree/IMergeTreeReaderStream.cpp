@@ -4,6 +4,16 @@
 namespace DB
 {
 
+bool IMergeTreeReaderStream::isSingleDictionaryStream()
+{
+    if (!is_low_cardinality_dictionary || marks_count == 0)
+        return false;
+
+    /// Marks are ordered, so the stream holds a single dictionary iff the first
+    /// and the last mark point to the same offset.
+    return !(marks_loader.getMark(0).asTuple() < marks_loader.getMark(marks_count - 1).asTuple());
+}
+
 size_t IMergeTreeReaderStream::getRightOffset(size_t right_mark)
 {
     /// NOTE: if we are reading the whole file, then right_mark == marks_count
@@ -116,4 +126,27 @@ ReadBuffer * IMergeTreeReaderStream::getDataBuffer() {
     return data_buffer;
 }
 
+void IMergeTreeReaderStream::planSequentialRead(const MarkRanges & all_mark_ranges, double min_density)
+{
+    if (min_density <= 0 || all_mark_ranges.empty() || marks_count == 0)
+        return;
+
+    size_t covered_marks = 0;
+    size_t last_right_mark = 0;
+    for (const auto & mark_range : all_mark_ranges)
+    {
+        covered_marks += mark_range.end - mark_range.begin;
+        last_right_mark = std::max(last_right_mark, mark_range.end);
+    }
+
+    if (static_cast<double>(covered_marks) < min_density * static_cast<double>(marks_count))
+        return;
+
+    /// Dense enough: establish the read window up to the last requested mark right away.
+    /// Later per-task adjustRightMark() calls fall inside this window and keep it, so the
+    /// gaps between ranges are skipped within the open stream (cheap forward seeks, see
+    /// remote_read_min_bytes_for_seek) instead of every range issuing a new remote request.
+    adjustRightMark(last_right_mark);
+}
+
 }
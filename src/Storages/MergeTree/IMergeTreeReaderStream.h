@@ -18,6 +18,7 @@
 #include <Core/Types.h>
 #include <IO/ReadBuffer.h>
 #include <Disks/IDisk.h>
+#include <Storages/MergeTree/MarkRange.h>
 #include <Storages/MergeTree/MergeTreeMarksLoader.h>
 
 namespace DB
@@ -74,6 +75,21 @@ public:
 
     virtual ReadBuffer * getDataBuffer();
 
+    /**
+     * Decide between per-range read windows and one sequential window over all the
+     * ranges this stream is going to serve. When the ranges are dense enough, one
+     * window costs a single remote request and the gaps are skipped client-side,
+     * instead of each range re-opening the stream. Must be called after data_buffer
+     * is initialized. Does nothing when min_density is 0.
+     */
+    void planSequentialRead(const MarkRanges & all_mark_ranges, double min_density);
+
+    /// Whether this is a LowCardinality dictionary stream that contains exactly one dictionary.
+    /// In that case all marks point to the same offset, so every seek lands at the dictionary
+    /// start and the stream may be left unconsumed by a reader that obtained the dictionary
+    /// from elsewhere (see LowCardinalityDictionaryCache).
+    bool isSingleDictionaryStream();
+
     bool is_low_cardinality_dictionary = false;
 
     ReadBuffer * data_buffer;
@@ -17,79 +17,158 @@ MergeTreeBitmapIndexExpressionReader::MergeTreeBitmapIndexExpressionReader(
 {
 }
 
-/// TODO: fix it when support `bitmap index remove where condition`
+/**
+ * Evaluate the AND/OR/ANDNOT ('&', '|' or ',', '~') expression lazily over the
+ * referenced posting lists instead of materializing every operand up front.
+ * Operands are read on demand and combined directly on the roaring bitmaps;
+ * once the left side of '&' or '~' is empty the right subtree is parsed for
+ * validation only, so a selective leading index short-circuits the whole tree.
+ */
 void MergeTreeBitmapIndexExpressionReader::getIndexes()
 {
-//     // already loaded，try get cache
-//     bool expected = false;
-//     bool desired = true;
-
-//     auto temp_index_map = std::make_shared<std::map<String, BitmapIndexPtr>>();
-//     // for each bitmap, load the needed posting list
-//     for (auto it = bitmap_index_info->index_names.begin(); it != bitmap_index_info->index_names.end(); ++it)
-//     {
-//         BitmapIndexPtr inner_index = std::make_shared<IListIndex>();
-
-//         auto set_it = bitmap_index_info->set_args.find(it->first);
-//         if (set_it == bitmap_index_info->set_args.end())
-//             throw Exception("Cannot find set for column " + it->first, ErrorCodes::LOGICAL_ERROR);
-
-//         if (it->second.size() > 1 || set_it->second.size() > 1)
-//             throw Exception("Default BitmapIndexReader cannot handle a function with multiple column / sets", ErrorCodes::LOGICAL_ERROR);
-
-//         if (it->second.empty() || set_it->second.empty())
-//             throw Exception("Default BitmapIndexReader cannot handle a function with empty column / sets", ErrorCodes::LOGICAL_ERROR);
-
-//         auto index_name = it->second.front();
-//         auto set_ptr = set_it->second.front();
-
-//         // auto reader_it = bitmap_index_readers.find(index_name);
-//         // if (reader_it == bitmap_index_readers.end())
-//         //     throw Exception("No BitmapIndexReader of " + index_name + "has been found", ErrorCodes::LOGICAL_ERROR);
-
-//         // const BitmapIndexPtr & list_index = getIndex(reader_it->second, set_ptr);
-//         // inner_index->setOriginalRows(list_index->getOriginalRows());
-//         // inner_index->setIndex(list_index->getIndex());
-
-//         // supporting segment bitmap
-// #define SETBITMAPINDEXITER(IT, RD) auto (IT) = (RD).find(index_name);
-// #define SETBITMAPINDEX(IT, RD) if ((IT) != (RD).end())                                  \
-//             {                                                                       \
-//                 /* load and merge the postings of a set */                                                                  \
-//                 const BitmapIndexPtr & list_index = getIndex((IT)->second, set_ptr);  \
-//                     inner_index->setOriginalRows(list_index->getOriginalRows());    \
-//                     inner_index->setIndex(list_index->getIndex());                  \
-//             }
-
-//             SETBITMAPINDEXITER(seg_reader_it, segment_bitmap_index_readers)
-//             SETBITMAPINDEXITER(reader_it, bitmap_index_readers)
-            
-//             SETBITMAPINDEX(seg_reader_it, segment_bitmap_index_readers)
-//             else SETBITMAPINDEX(reader_it, bitmap_index_readers)
-// #undef SETBITMAPINDEXITER
-// #undef SETBITMAPINDEX
-//             else
-//             {
-//                 throw Exception("No BitmapIndexReader nor SegmentBitmapIndexReader of " + index_name + "has been found", ErrorCodes::LOGICAL_ERROR);
-//             }
-//         // (column name, index)
-//         temp_index_map->emplace(it->first, inner_index);
-//     }
-
-//     /// cacl bitmap expression
-//     for (const auto & bitmap_expression : bitmap_index_info->bitmap_expressions)
-//     {
-//         AggregateFunctionBitmapDataImpl<String, BitMap> data;
-//         BitmapExpressionAnalyzerImpl<String, BitMap> expression_analyzer(bitmap_expression.second);
-//         for (const auto & ele : *temp_index_map)
-//             data.add(genBitmapKey(ele.first), ele.second->getIndex());
-//         expression_analyzer.executeExpression(data);
-//         auto inner_index = std::make_shared<IListIndex>();
-//         inner_index->setOriginalRows(temp_index_map->begin()->second->getOriginalRows());
-//         inner_index->getIndex().loadBitmap(std::move(data.bitmap_map[expression_analyzer.final_key]));
-//         indexes.emplace(bitmap_expression.first, inner_index);
-//     }
+    if (bitmap_index_info->bitmap_expressions.empty())
+        return;
 
+    operand_columns.clear();
+    for (const auto & it : bitmap_index_info->index_names)
+        operand_columns.emplace(genBitmapKey(it.first), it.first);
+
+    for (const auto & bitmap_expression : bitmap_index_info->bitmap_expressions)
+        indexes.emplace(bitmap_expression.first, evaluateExpression(bitmap_expression.second));
+
+    operand_indexes.clear();
+}
+
+std::vector<String> MergeTreeBitmapIndexExpressionReader::tokenizeExpression(const String & expression)
+{
+    std::vector<String> tokens;
+    size_t token_start = expression.size();
+    for (size_t i = 0; i < expression.size(); ++i)
+    {
+        char symbol = expression[i];
+        if (symbol == '(' || symbol == ')' || symbol == '&' || symbol == '|' || symbol == ',' || symbol == '~' || symbol == ' ')
+        {
+            if (token_start != expression.size())
+            {
+                tokens.push_back(expression.substr(token_start, i - token_start));
+                token_start = expression.size();
+            }
+            if (symbol != ' ')
+                tokens.push_back(String(1, symbol));
+        }
+        else if (token_start == expression.size())
+            token_start = i;
+    }
+    if (token_start != expression.size())
+        tokens.push_back(expression.substr(token_start));
+    return tokens;
+}
+
+BitmapIndexPtr MergeTreeBitmapIndexExpressionReader::evaluateExpression(const String & expression)
+{
+    auto tokens = tokenizeExpression(expression);
+    if (tokens.empty())
+        throw Exception("Empty bitmap expression", ErrorCodes::LOGICAL_ERROR);
+
+    size_t pos = 0;
+    auto res = evaluateSubExpression(tokens, pos, true);
+    if (pos != tokens.size())
+        throw Exception("Invalid bitmap expression: " + expression, ErrorCodes::LOGICAL_ERROR);
+    return res;
+}
+
+BitmapIndexPtr MergeTreeBitmapIndexExpressionReader::evaluateSubExpression(const std::vector<String> & tokens, size_t & pos, bool live)
+{
+    auto parse_operand = [&](bool operand_live) -> BitmapIndexPtr
+    {
+        if (pos >= tokens.size())
+            throw Exception("Unexpected end of bitmap expression", ErrorCodes::LOGICAL_ERROR);
+        if (tokens[pos] == "(")
+        {
+            ++pos;
+            auto operand = evaluateSubExpression(tokens, pos, operand_live);
+            if (pos >= tokens.size() || tokens[pos] != ")")
+                throw Exception("Unbalanced parenthesis in bitmap expression", ErrorCodes::LOGICAL_ERROR);
+            ++pos;
+            return operand;
+        }
+        return loadOperand(tokens[pos++], operand_live);
+    };
+
+    /// Operators are left-associative with equal precedence, like BitMapExpressionAnalyzer.
+    /// Accumulate into a fresh index so cached operands stay untouched.
+    BitmapIndexPtr first = parse_operand(live);
+    BitmapIndexPtr res = std::make_shared<IListIndex>();
+    if (live)
+    {
+        res->setOriginalRows(first->getOriginalRows());
+        res->setIndex(first->getIndex());
+    }
+
+    while (pos < tokens.size() && tokens[pos] != ")")
+    {
+        const String & op = tokens[pos];
+        if (op != "&" && op != "|" && op != "," && op != "~")
+            throw Exception("Invalid operation " + op + " in bitmap expression", ErrorCodes::LOGICAL_ERROR);
+        ++pos;
+
+        /// Once the intermediate result is empty, '&' and '~' cannot revive it.
+        bool right_live = live && !((op == "&" || op == "~") && res->getIndex().isEmpty());
+        BitmapIndexPtr right = parse_operand(right_live);
+
+        if (!live)
+            continue;
+
+        if (right->getOriginalRows() > res->getOriginalRows())
+            res->setOriginalRows(right->getOriginalRows());
+
+        if (op == "&")
+            res->getIndex() &= right->getIndex();
+        else if (op == "~")
+            res->getIndex() -= right->getIndex();
+        else
+            res->getIndex() |= right->getIndex();
+    }
+
+    return res;
+}
+
+BitmapIndexPtr MergeTreeBitmapIndexExpressionReader::loadOperand(const String & token, bool live)
+{
+    if (!live)
+        return std::make_shared<IListIndex>();
+
+    auto cached = operand_indexes.find(token);
+    if (cached != operand_indexes.end())
+        return cached->second;
+
+    auto column_it = operand_columns.find(token);
+    if (column_it == operand_columns.end())
+        throw Exception("Unknown operand " + token + " in bitmap expression", ErrorCodes::LOGICAL_ERROR);
+
+    auto name_it = bitmap_index_info->index_names.find(column_it->second);
+    auto set_it = bitmap_index_info->set_args.find(column_it->second);
+    if (name_it == bitmap_index_info->index_names.end() || set_it == bitmap_index_info->set_args.end())
+        throw Exception("Cannot find index column for " + column_it->second, ErrorCodes::LOGICAL_ERROR);
+
+    if (name_it->second.size() != 1 || set_it->second.size() != 1)
+        throw Exception("BitmapIndexExpressionReader cannot handle a function with multiple columns / sets", ErrorCodes::LOGICAL_ERROR);
+
+    auto index_name = name_it->second.front();
+    auto set_ptr = set_it->second.front();
+
+    BitmapIndexPtr operand;
+    auto seg_reader_it = segment_bitmap_index_readers.find(index_name);
+    auto reader_it = bitmap_index_readers.find(index_name);
+    if (seg_reader_it != segment_bitmap_index_readers.end())
+        operand = getIndex(seg_reader_it->second, set_ptr);
+    else if (reader_it != bitmap_index_readers.end())
+        operand = getIndex(reader_it->second, set_ptr);
+    else
+        throw Exception("No BitmapIndexReader nor SegmentBitmapIndexReader of " + index_name + " has been found", ErrorCodes::LOGICAL_ERROR);
+
+    operand_indexes.emplace(token, operand);
+    return operand;
 }
 
 size_t MergeTreeBitmapIndexExpressionReader::read(size_t from_mark, bool continue_reading, size_t max_rows_to_read, Columns & res)
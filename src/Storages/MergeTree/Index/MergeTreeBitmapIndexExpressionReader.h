@@ -15,5 +15,18 @@ public:
     size_t read(size_t from_mark, bool continue_reading, size_t max_rows_to_read, Columns & res) override;
 
     static String genBitmapKey(const String & string);
+
+private:
+    BitmapIndexPtr evaluateExpression(const String & expression);
+    BitmapIndexPtr evaluateSubExpression(const std::vector<String> & tokens, size_t & pos, bool live);
+    /// Read the posting list behind an operand token; dead operands (live = false) are
+    /// parsed for validation only and never touch the index files.
+    BitmapIndexPtr loadOperand(const String & token, bool live);
+    static std::vector<String> tokenizeExpression(const String & expression);
+
+    /// operand token (see genBitmapKey) -> function result column it refers to
+    std::unordered_map<String, String> operand_columns;
+    /// operand token -> loaded posting list, so replicated operands are read once
+    std::map<String, BitmapIndexPtr> operand_indexes;
 };
 }
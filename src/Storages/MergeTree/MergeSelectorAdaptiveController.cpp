@@ -0,0 +1,139 @@
+#include <Storages/MergeTree/MergeSelectorAdaptiveController.h>
+
+#include <algorithm>
+#include <ctime>
+
+namespace DB
+{
+
+namespace
+{
+    /// Smoothing factor shared by all EWMA estimates.
+    constexpr double SMOOTHING_ALPHA = 0.3;
+    /// The part count is considered stable inside this dead band (parts per observation).
+    constexpr double TREND_DEAD_BAND = 0.5;
+    /// Realized write amplification above this raises the base back once the part count shrinks.
+    constexpr double TARGET_WRITE_AMPLIFICATION = 3.0;
+    /// Bounds of the multiplier applied to min_parts_to_merge_base.
+    constexpr double MIN_BASE_MULTIPLIER = 0.5;
+    constexpr double MAX_BASE_MULTIPLIER = 4.0;
+    /// Per-observation adjustment steps.
+    constexpr double LOWER_STEP = 0.8;
+    constexpr double RAISE_STEP = 1.25;
+    /// Speed of drifting back to the neutral multiplier while the partition is stable.
+    constexpr double NEUTRAL_DRIFT = 0.1;
+    /// States of partitions without any activity for this long are dropped.
+    constexpr UInt64 STATE_TTL_SEC = 24 * 3600;
+    constexpr UInt64 CLEANUP_INTERVAL_SEC = 3600;
+}
+
+MergeSelectorAdaptiveController & MergeSelectorAdaptiveController::instance()
+{
+    static MergeSelectorAdaptiveController controller;
+    return controller;
+}
+
+MergeSelectorAdaptiveController::PartitionState &
+MergeSelectorAdaptiveController::getStateLocked(const String & table_uuid, const String & partition_id)
+{
+    auto & state = states[stateKey(table_uuid, partition_id)];
+    if (state.table_uuid.empty())
+    {
+        state.table_uuid = table_uuid;
+        state.partition_id = partition_id;
+    }
+    return state;
+}
+
+void MergeSelectorAdaptiveController::updateBaseMultiplier(PartitionState & state)
+{
+    if (state.parts_number_trend > TREND_DEAD_BAND)
+    {
+        /// Ingest is outrunning merges: merge more eagerly, accepting higher amplification.
+        state.base_multiplier = std::max(MIN_BASE_MULTIPLIER, state.base_multiplier * LOWER_STEP);
+    }
+    else if (state.parts_number_trend < -TREND_DEAD_BAND && state.ewma_write_amplification > TARGET_WRITE_AMPLIFICATION)
+    {
+        /// Part count is shrinking but we rewrite too many bytes: merge lazier again.
+        state.base_multiplier = std::min(MAX_BASE_MULTIPLIER, state.base_multiplier * RAISE_STEP);
+    }
+    else
+    {
+        /// Stable partition: drift back towards the configured base.
+        state.base_multiplier += (1.0 - state.base_multiplier) * NEUTRAL_DRIFT;
+    }
+}
+
+void MergeSelectorAdaptiveController::observePartition(const String & table_uuid, const String & partition_id, UInt64 parts_number)
+{
+    UInt64 current_time = time(nullptr);
+
+    std::lock_guard lock(mutex);
+    cleanupExpiredLocked(current_time);
+
+    auto & state = getStateLocked(table_uuid, partition_id);
+    if (state.observations == 0)
+        state.ewma_parts_number = parts_number;
+    else
+    {
+        double delta = parts_number - state.ewma_parts_number;
+        state.parts_number_trend = SMOOTHING_ALPHA * delta + (1 - SMOOTHING_ALPHA) * state.parts_number_trend;
+        state.ewma_parts_number = SMOOTHING_ALPHA * parts_number + (1 - SMOOTHING_ALPHA) * state.ewma_parts_number;
+    }
+    ++state.observations;
+    state.last_update_time = current_time;
+
+    updateBaseMultiplier(state);
+}
+
+void MergeSelectorAdaptiveController::onMergesSelected(
+    const String & table_uuid,
+    const String & partition_id,
+    size_t num_ranges,
+    UInt64 bytes_to_rewrite,
+    UInt64 bytes_in_new_parts)
+{
+    std::lock_guard lock(mutex);
+
+    auto & state = getStateLocked(table_uuid, partition_id);
+    state.selected_ranges += num_ranges;
+    state.selected_bytes += bytes_to_rewrite;
+    state.last_update_time = time(nullptr);
+
+    double realized = static_cast<double>(bytes_to_rewrite) / std::max<UInt64>(bytes_in_new_parts, 1);
+    state.ewma_write_amplification = SMOOTHING_ALPHA * realized + (1 - SMOOTHING_ALPHA) * state.ewma_write_amplification;
+}
+
+double MergeSelectorAdaptiveController::getBaseMultiplier(const String & table_uuid, const String & partition_id) const
+{
+    std::lock_guard lock(mutex);
+    auto it = states.find(stateKey(table_uuid, partition_id));
+    return it == states.end() ? 1.0 : it->second.base_multiplier;
+}
+
+std::vector<MergeSelectorAdaptiveController::PartitionState> MergeSelectorAdaptiveController::getStates() const
+{
+    std::lock_guard lock(mutex);
+    std::vector<PartitionState> res;
+    res.reserve(states.size());
+    for (const auto & [_, state] : states)
+        res.push_back(state);
+    return res;
+}
+
+void MergeSelectorAdaptiveController::cleanupExpiredLocked(UInt64 current_time)
+{
+    if (current_time < last_cleanup_time + CLEANUP_INTERVAL_SEC)
+        return;
+    last_cleanup_time = current_time;
+
+    for (auto it = states.begin(); it != states.end();)
+    {
+        if (it->second.last_update_time + STATE_TTL_SEC < current_time)
+            it = states.erase(it);
+        else
+            ++it;
+    }
+}
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Core/Types.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace DB
+{
+
+/** Feedback controller shared by DanceMergeSelector instances on the server side.
+  *
+  * With static scoring parameters a bursty ingest either lets the part count of a partition run
+  * away (base too high) or rewrites the same bytes over and over in merge storms (base too low).
+  * The controller tracks, per (table, partition), the part-count trend reported by
+  * CnchTablePartitionMetrics and the write amplification realized by the ranges the selector
+  * actually picked, and derives from them a multiplier for min_parts_to_merge_base: the base is
+  * lowered while the part count keeps growing and raised back while the part count shrinks but
+  * realized amplification stays above target.
+  *
+  * Selector instances only live for one selection round, so the state is kept in a process-wide
+  * singleton and exposed through the system.merge_selector_states table.
+  */
+class MergeSelectorAdaptiveController
+{
+public:
+    static MergeSelectorAdaptiveController & instance();
+
+    struct PartitionState
+    {
+        String table_uuid;
+        String partition_id;
+
+        /// Smoothed part count and its trend in parts per observation (> 0 means growing).
+        double ewma_parts_number = 0;
+        double parts_number_trend = 0;
+        /// Bytes rewritten by selected merges per byte of newly ingested (level 0) data.
+        double ewma_write_amplification = 1;
+        /// Multiplier currently applied to min_parts_to_merge_base of the selector.
+        double base_multiplier = 1;
+
+        UInt64 observations = 0;
+        UInt64 selected_ranges = 0;
+        UInt64 selected_bytes = 0;
+        UInt64 last_update_time = 0;
+    };
+
+    /// Feed the current part count of a partition, once per selection round.
+    void observePartition(const String & table_uuid, const String & partition_id, UInt64 parts_number);
+
+    /// Feed the ranges the selector picked for a partition: the bytes they will rewrite and the
+    /// share of them that is newly ingested data.
+    void onMergesSelected(
+        const String & table_uuid,
+        const String & partition_id,
+        size_t num_ranges,
+        UInt64 bytes_to_rewrite,
+        UInt64 bytes_in_new_parts);
+
+    /// Multiplier for min_parts_to_merge_base, 1.0 for unknown partitions.
+    double getBaseMultiplier(const String & table_uuid, const String & partition_id) const;
+
+    /// Snapshot of all partition states for the system table.
+    std::vector<PartitionState> getStates() const;
+
+private:
+    static String stateKey(const String & table_uuid, const String & partition_id) { return table_uuid + "_" + partition_id; }
+
+    PartitionState & getStateLocked(const String & table_uuid, const String & partition_id);
+    static void updateBaseMultiplier(PartitionState & state);
+    void cleanupExpiredLocked(UInt64 current_time);
+
+    mutable std::mutex mutex;
+    std::unordered_map<String, PartitionState> states;
+    UInt64 last_cleanup_time = 0;
+};
+
+}
@@ -31,13 +31,16 @@
 #include <Poco/Logger.h>
 #include <Common/Exception.h>
 #include <Common/StringUtils/StringUtils.h>
+#include <Common/ThreadPool.h>
 #include <Common/escapeForFileName.h>
 #include <Common/filesystemHelpers.h>
 #include <common/logger_useful.h>
 
 #include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace ProfileEvents
@@ -474,6 +477,56 @@ MutableMergeTreeDataPartCNCHPtr MergeTreeCNCHDataDumper::dumpTempPart(
     return new_part;
 }
 
+MutableMergeTreeDataPartsCNCHVector MergeTreeCNCHDataDumper::dumpTempParts(
+    const IMutableMergeTreeDataPartsVector & local_parts,
+    const std::vector<DiskPtr> & remote_disks,
+    size_t pool_size,
+    size_t max_inflight_bytes) const
+{
+    if (!remote_disks.empty() && remote_disks.size() != local_parts.size())
+        throw Exception("Number of remote disks doesn't match number of parts to dump", ErrorCodes::LOGICAL_ERROR);
+
+    MutableMergeTreeDataPartsCNCHVector dumped_parts(local_parts.size());
+    if (local_parts.empty())
+        return dumped_parts;
+
+    ThreadPool pool(std::min(std::max<size_t>(pool_size, 1), local_parts.size()));
+
+    std::mutex budget_mutex;
+    std::condition_variable budget_released;
+    size_t inflight_bytes = 0;
+
+    for (size_t i = 0; i < local_parts.size(); ++i)
+    {
+        size_t part_bytes = local_parts[i]->getBytesOnDisk();
+        if (max_inflight_bytes)
+        {
+            /// Admit a part only when it fits into the budget; a part bigger than the
+            /// whole budget is still admitted alone so it cannot get stuck.
+            std::unique_lock lock(budget_mutex);
+            budget_released.wait(
+                lock, [&] { return inflight_bytes == 0 || inflight_bytes + part_bytes <= max_inflight_bytes; });
+            inflight_bytes += part_bytes;
+        }
+
+        pool.scheduleOrThrowOnError([&, i, part_bytes]() {
+            SCOPE_EXIT({
+                if (max_inflight_bytes)
+                {
+                    std::lock_guard lock(budget_mutex);
+                    inflight_bytes -= part_bytes;
+                    budget_released.notify_all();
+                }
+            });
+            dumped_parts[i] = dumpTempPart(local_parts[i], remote_disks.empty() ? nullptr : remote_disks[i]);
+            LOG_TRACE(log, "Dumped part {}", local_parts[i]->name);
+        });
+    }
+    pool.wait();
+
+    return dumped_parts;
+}
+
 NamesAndTypesList MergeTreeCNCHDataDumper::getKeyColumns() const
 {
     Names sort_key_columns_vec = data.getInMemoryMetadataPtr()->getSortingKeyColumns();
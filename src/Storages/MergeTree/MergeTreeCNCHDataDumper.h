@@ -95,6 +95,19 @@ public:
     MutableMergeTreeDataPartCNCHPtr
     dumpTempPart(const IMutableMergeTreeDataPartPtr & local_part, const DiskPtr & remote_disk = nullptr, bool is_temp_prefix = false) const;
 
+    /** Dump several local parts in a pipeline: local reads, checksum computation and remote
+      * writes of different parts overlap over a pool of `pool_size` threads. In-flight parts
+      * are additionally bounded by the shared `max_inflight_bytes` budget (0 = unlimited),
+      * so a wide INSERT doesn't keep the whole batch in flight at once.
+      * `remote_disks` must be empty (pick disks as dumpTempPart does) or match `local_parts`.
+      * Returns dumped parts in input order.
+      */
+    MutableMergeTreeDataPartsCNCHVector dumpTempParts(
+        const IMutableMergeTreeDataPartsVector & local_parts,
+        const std::vector<DiskPtr> & remote_disks,
+        size_t pool_size,
+        size_t max_inflight_bytes = 0) const;
+
 private:
     struct CNCHDataMeta
     {
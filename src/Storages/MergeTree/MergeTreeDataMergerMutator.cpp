@@ -63,6 +63,7 @@
 #include "Storages/MergeTree/MergeTreeSuffix.h"
 #include <Storages/MergeTree/GinIndexDataPartHelper.h>
 
+#include <algorithm>
 #include <cmath>
 #include <ctime>
 #include <numeric>
@@ -1228,11 +1229,24 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
         bitmap_build_info.build_all_segment_bitmap_index = false;
 
     const auto & index_factory = MergeTreeIndexFactory::instance();
+    auto skip_indices = index_factory.getMany(metadata_snapshot->getSecondaryIndices());
+    if (data.getSettings()->enable_auto_minmax_index)
+    {
+        /// In a vertical merge only the merging columns pass through this stream; gathered
+        /// columns keep no implicit index in the merged part and are simply not pruned.
+        NameSet merging_names(merging_column_names.begin(), merging_column_names.end());
+        for (auto & index : getImplicitMinMaxIndices(metadata_snapshot, data.getContext()))
+        {
+            const auto & required = index->getColumnsRequiredForIndexCalc();
+            if (!required.empty() && merging_names.contains(required.front()))
+                skip_indices.emplace_back(std::move(index));
+        }
+    }
     MergedBlockOutputStream to{
         new_data_part,
         metadata_snapshot,
         merging_columns,
-        index_factory.getMany(metadata_snapshot->getSecondaryIndices()),
+        skip_indices,
         compression_codec,
         blocks_are_granules_size,
         context->getSettingsRef().optimize_map_column_serialization,
@@ -1389,6 +1403,9 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
                     }
                     column_elems_written += block.rows();
                     column_to.write(block);
+                    /// Gathered columns never pass through `to`, so report them explicitly:
+                    /// the sketches file written with the merged part must cover all columns.
+                    to.updateNdvSketches(block);
                 }
 
                 if (merges_blocker.isCancelled())
@@ -2403,6 +2420,29 @@ std::set<MergeTreeIndexPtr> MergeTreeDataMergerMutator::getIndicesToRecalculate(
         }
     }
 
+    /// Implicit minmax indexes are not in the metadata snapshot, but a mutated part inherits
+    /// their files; recalculate the ones whose column is rewritten, otherwise the stale zone
+    /// maps would keep pruning granules with pre-mutation values.
+    if (source_part->storage.getSettings()->enable_auto_minmax_index)
+    {
+        for (auto & implicit_index : getImplicitMinMaxIndices(metadata_snapshot, context))
+        {
+            const auto & description = implicit_index->index;
+            if (!source_part->getChecksums()->has(INDEX_FILE_PREFIX + description.name + ".idx"))
+                continue;
+
+            const auto & index_cols = description.expression->getRequiredColumns();
+            bool mutate = std::any_of(
+                index_cols.begin(), index_cols.end(), [&](const auto & col) { return updated_columns.count(col); });
+            if (mutate && indices_to_recalc.insert(implicit_index).second)
+            {
+                ASTPtr expr_list = description.expression_list_ast->clone();
+                for (const auto & expr : expr_list->children)
+                    indices_recalc_expr_list->children.push_back(expr->clone());
+            }
+        }
+    }
+
     if (!indices_to_recalc.empty() && input_stream)
     {
         auto indices_recalc_syntax = TreeRewriter(context).analyze(indices_recalc_expr_list, input_stream->getHeader().getNamesAndTypesList());
@@ -27,6 +27,11 @@
 #include <Interpreters/StorageID.h>
 #include <Interpreters/CnchSystemLog.h>
 #include <IO/LimitReadBuffer.h>
+#include <IO/ReadBufferFromMemory.h>
+#include <IO/ReadBufferFromRpcStreamFile.h>
+#include <Common/parseAddress.h>
+#include <Common/HostWithPorts.h>
+#include <Storages/DistributedDataClient.h>
 #include <Storages/DiskCache/DiskCacheFactory.h>
 #include <Storages/DiskCache/FileDiskCacheSegment.h>
 #include <Storages/DiskCache/MetaFileDiskCacheSegment.h>
@@ -361,15 +366,30 @@ void MergeTreeDataPartCNCH::loadFromFileSystem(bool load_hint_mutation)
         }
     }
 
-    MergeTreeDataPartChecksum meta_info_pos;
-    auto checksums_ptr = loadChecksumsFromRemote(false);
-    meta_info_pos = checksums_ptr->files["metainfo.txt"];
+    ChecksumsPtr checksums_ptr;
+    if (!parent_part)
+    {
+        try
+        {
+            checksums_ptr = loadMetaFromDataFileTail(load_hint_mutation);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(storage.log, "Could not load part meta from the data file tail");
+        }
+    }
 
-    String data_rel_path = fs::path(getFullRelativePath()) / DATA_FILE;
-    DiskPtr disk = volume->getDisk();
-    auto reader = openForReading(disk, data_rel_path, meta_info_pos.file_size, "metainfo.txt");
-    LimitReadBuffer limit_reader = readPartFile(*reader, meta_info_pos.file_offset, meta_info_pos.file_size);
-    loadMetaInfoFromBuffer(limit_reader, load_hint_mutation);
+    if (!checksums_ptr)
+    {
+        checksums_ptr = loadChecksumsFromRemote(false);
+        MergeTreeDataPartChecksum meta_info_pos = checksums_ptr->files["metainfo.txt"];
+
+        String data_rel_path = fs::path(getFullRelativePath()) / DATA_FILE;
+        DiskPtr disk = volume->getDisk();
+        auto reader = openForReading(disk, data_rel_path, meta_info_pos.file_size, "metainfo.txt");
+        LimitReadBuffer limit_reader = readPartFile(*reader, meta_info_pos.file_offset, meta_info_pos.file_size);
+        loadMetaInfoFromBuffer(limit_reader, load_hint_mutation);
+    }
 
     // We should load the projection's name list from the disk when loading part from the file system, e.g., attach partion.
     if (!parent_part)
@@ -739,7 +759,21 @@ IMergeTreeDataPart::IndexPtr MergeTreeDataPartCNCH::loadIndexFromStorage() const
             try
             {
                 LOG_DEBUG(storage.log, "has index disk cache {}", segment_path);
-                auto cache_buf = openForReading(cache_disk, segment_path, cache_disk->getFileSize(segment_path));
+                size_t cached_size = cache_disk->getFileSize(segment_path);
+                std::unique_ptr<ReadBufferFromFileBase> cache_buf;
+                if (storage.getContext()->getSettingsRef().enable_primary_index_cache_mmap_read)
+                {
+                    /// The cached index lives on local disk: map it instead of reading through
+                    /// a buffer, so loads right after a restart are served straight from the OS
+                    /// page cache and concurrent loaders share one mapping.
+                    ReadSettings mmap_settings = storage.getContext()->getReadSettings();
+                    mmap_settings.local_fs_method = LocalFSReadMethod::mmap;
+                    mmap_settings.mmap_threshold = 1;
+                    mmap_settings.adjustBufferSize(cached_size);
+                    cache_buf = cache_disk->readFile(segment_path, mmap_settings);
+                }
+                else
+                    cache_buf = openForReading(cache_disk, segment_path, cached_size);
                 res = loadIndexFromBuffer(*cache_buf, primary_key);
                 ProfileEvents::increment(ProfileEvents::PrimaryIndexDiskCacheHits);
                 return res;
@@ -759,6 +793,20 @@ IMergeTreeDataPart::IndexPtr MergeTreeDataPartCNCH::loadIndexFromStorage() const
                     name,
                     segment_path);
         }
+
+        /// The worker owning this part in the cache assignment may have the index cached
+        if (auto peer_buf = tryReadMetaFromPeerCache(segment.getSegmentName()))
+        {
+            try
+            {
+                res = loadIndexFromBuffer(*peer_buf, primary_key);
+                return res;
+            }
+            catch (...)
+            {
+                tryLogCurrentException("Could not load index from peer disk cache");
+            }
+        }
     }
 
     /// load index from remote disk
@@ -777,6 +825,45 @@ IMergeTreeDataPart::IndexPtr MergeTreeDataPartCNCH::loadIndexFromStorage() const
     return res;
 }
 
+std::unique_ptr<ReadBufferFromFileBase> MergeTreeDataPartCNCH::tryReadMetaFromPeerCache(const String & segment_key) const
+{
+    UInt64 stealing_mode = storage.getSettings()->disk_cache_stealing_mode;
+    if (stealing_mode != StealingCacheMode::READ_ONLY && stealing_mode != StealingCacheMode::READ_WRITE)
+        return nullptr;
+
+    if (disk_cache_host_port.empty() || assign_compute_host_port.empty())
+        return nullptr;
+
+    auto parsed_disk_cache_host = parseAddress(disk_cache_host_port, 0).first;
+    auto parsed_assign_compute_host = parseAddress(assign_compute_host_port, 0).first;
+    if (removeBracketsIfIpv6(parsed_disk_cache_host) == removeBracketsIfIpv6(parsed_assign_compute_host))
+        return nullptr;
+
+    try
+    {
+        const auto & cache_settings = DiskCacheFactory::instance().get(DiskCacheType::MergeTree)->getMetaCache()->getSettings();
+        DistributedDataClientOption option{
+            .max_request_rate = cache_settings.stealing_max_request_rate,
+            .connection_timeout_ms = cache_settings.stealing_connection_timeout_ms,
+            .read_timeout_ms = cache_settings.stealing_read_timeout_ms,
+            .max_retry_times = cache_settings.stealing_max_retry_times,
+            .retry_sleep_ms = cache_settings.stealing_retry_sleep_ms,
+            .max_queue_count = cache_settings.stealing_max_queue_count,
+        };
+        auto remote_data_client = std::make_shared<DistributedDataClient>(disk_cache_host_port, segment_key, option);
+        auto peer_cache_file = std::make_unique<ReadBufferFromRpcStreamFile>(remote_data_client);
+        if (peer_cache_file->getFileName().empty())
+            return nullptr;
+        LOG_TRACE(storage.log, "Read {} from peer disk cache {}", segment_key, disk_cache_host_port);
+        return peer_cache_file;
+    }
+    catch (...)
+    {
+        tryLogCurrentException(storage.log, fmt::format("Could not read {} from peer disk cache {}", segment_key, disk_cache_host_port));
+        return nullptr;
+    }
+}
+
 IMergeTreeDataPart::ChecksumsPtr MergeTreeDataPartCNCH::loadChecksums([[maybe_unused]] bool require)
 {
     ProfileEvents::increment(ProfileEvents::LoadChecksums);
@@ -814,6 +901,23 @@ IMergeTreeDataPart::ChecksumsPtr MergeTreeDataPartCNCH::loadChecksums([[maybe_un
                 name,
                 segment_path);
         }
+
+        /// The worker owning this part in the cache assignment may have the checksums cached
+        if (auto peer_buf = tryReadMetaFromPeerCache(checksums_segment.getSegmentName()))
+        {
+            try
+            {
+                auto peer_checksums = std::make_shared<Checksums>();
+                peer_checksums->storage_type = StorageType::ByteHDFS;
+                if (peer_checksums->read(*peer_buf))
+                    assertEOF(*peer_buf);
+                return peer_checksums;
+            }
+            catch (...)
+            {
+                tryLogCurrentException("Could not load checksums from peer disk cache");
+            }
+        }
     }
     return loadChecksumsFromRemote(true);
 }
@@ -895,6 +999,81 @@ IMergeTreeDataPart::ChecksumsPtr MergeTreeDataPartCNCH::loadChecksumsFromRemote(
     return checksums;
 }
 
+IMergeTreeDataPart::ChecksumsPtr MergeTreeDataPartCNCH::loadMetaFromDataFileTail(bool load_hint_mutation)
+{
+    size_t tail_size = storage.getSettings()->cnch_part_meta_tail_read_bytes;
+    if (tail_size == 0)
+        return nullptr;
+
+    const String data_rel_path = fs::path(getFullRelativePath()) / DATA_FILE;
+    DiskPtr disk = volume->getDisk();
+    size_t data_file_size = disk->getFileSize(data_rel_path);
+    tail_size = std::min(std::max<size_t>(tail_size, MERGE_TREE_STORAGE_CNCH_DATA_FOOTER_SIZE), data_file_size);
+    size_t tail_offset = data_file_size - tail_size;
+
+    String tail(tail_size, '\0');
+    {
+        auto reader = openForReading(disk, data_rel_path, tail_size, "data file tail");
+        reader->setReadUntilPosition(data_file_size);
+        reader->seek(tail_offset);
+        reader->readStrict(tail.data(), tail_size);
+    }
+
+    /// The footer sits at the very end of the data file; same layout as in loadPartDataFooter
+    ReadBufferFromMemory footer_buf(
+        tail.data() + tail_size - MERGE_TREE_STORAGE_CNCH_DATA_FOOTER_SIZE, MERGE_TREE_STORAGE_CNCH_DATA_FOOTER_SIZE);
+    MergeTreeDataPartChecksums::FileChecksums data_footer;
+    auto add_file_checksum = [this, &footer_buf, &data_footer](const String & file_name) {
+        Checksum file_checksum;
+        file_checksum.mutation = info.mutation;
+        readIntBinary(file_checksum.file_offset, footer_buf);
+        readIntBinary(file_checksum.file_size, footer_buf);
+        readIntBinary(file_checksum.file_hash, footer_buf);
+        data_footer[file_name] = std::move(file_checksum);
+    };
+    add_file_checksum("primary.idx");
+    add_file_checksum("checksums.txt");
+    add_file_checksum("metainfo.txt");
+    add_file_checksum("unique_key.idx");
+
+    const auto & checksum_file = data_footer["checksums.txt"];
+    const auto & meta_info_file = data_footer["metainfo.txt"];
+    if (checksum_file.file_size == 0 /* && isDeleted() */)
+        throw Exception(ErrorCodes::NO_FILE_IN_DATA_PART, "The size of checksums in part {} under path {} is zero", name, data_rel_path);
+
+    /// The meta cluster of a bigger part may start before the speculative tail read
+    if (checksum_file.file_offset < tail_offset || meta_info_file.file_offset < tail_offset)
+        return nullptr;
+
+    ChecksumsPtr checksums = std::make_shared<Checksums>();
+    checksums->storage_type = StorageType::ByteHDFS;
+    ReadBufferFromMemory checksums_buf(tail.data() + (checksum_file.file_offset - tail_offset), checksum_file.file_size);
+    if (checksums->read(checksums_buf))
+        assertEOF(checksums_buf);
+
+    // merge with data footer
+    data_footer.merge(checksums->files);
+    checksums->files.swap(data_footer);
+
+    for (auto & file : checksums->files)
+        file.second.mutation = info.mutation;
+
+    // remove deleted files in checksums, same as loadChecksumsFromRemote does; a reader
+    // must never see entries a partial part marked as deleted
+    for (auto it = checksums->files.begin(); it != checksums->files.end();)
+    {
+        if (it->second.is_deleted)
+            it = checksums->files.erase(it);
+        else
+            ++it;
+    }
+
+    ReadBufferFromMemory meta_info_buf(tail.data() + (meta_info_file.file_offset - tail_offset), meta_info_file.file_size);
+    loadMetaInfoFromBuffer(meta_info_buf, load_hint_mutation);
+
+    return checksums;
+}
+
 void MergeTreeDataPartCNCH::loadProjections([[maybe_unused]] bool require_columns_checksums, [[maybe_unused]] bool check_consistency)
 {
     auto metadata_snapshot = storage.getInMemoryMetadataPtr();
@@ -130,6 +130,17 @@ private:
     ChecksumsPtr loadChecksums(bool require) override;
     ChecksumsPtr loadChecksumsFromRemote(bool follow_part_chain);
 
+    /// Single-request meta load for top-level parts: reads the tail of the packed data file
+    /// once and parses the footer, checksums and metainfo from memory instead of issuing one
+    /// remote read per meta file. Returns nullptr when disabled or when the meta cluster of a
+    /// bigger part is not fully covered by the speculative tail read.
+    ChecksumsPtr loadMetaFromDataFileTail(bool load_hint_mutation);
+
+    /// Stream a meta cache segment (checksums / primary index) from the worker owning it
+    /// in the consistent-hash assignment. Returns nullptr when cache stealing is disabled
+    /// for reads, this worker is the owner, or the peer has not cached the segment.
+    std::unique_ptr<ReadBufferFromFileBase> tryReadMetaFromPeerCache(const String & segment_key) const;
+
     UniqueKeyIndexPtr loadUniqueKeyIndex() override;
 
     IndexFile::RemoteFileInfo getRemoteFileInfo();
@@ -74,6 +74,12 @@ void MergeTreeDataPartWriterCompact::CompactDataWriter::sync() const
     marks_file->sync();
 }
 
+void MergeTreeDataPartWriterCompact::CompactDataWriter::advisePageCacheDontNeed() const
+{
+    plain_file->advisePageCacheDontNeed();
+    marks_file->advisePageCacheDontNeed();
+}
+
 void MergeTreeDataPartWriterCompact::CompactDataWriter::addToChecksums(IMergeTreeDataPart::Checksums & checksums)
 {
     String data_file_name = MergeTreeDataPartCompact::DATA_FILE_NAME_WITH_EXTENSION;
@@ -469,6 +475,8 @@ void MergeTreeDataPartWriterCompact::finishDataSerialization(IMergeTreeDataPart:
 
         if (sync)
             data_writer->sync();
+        if (settings.drop_page_cache_after_write)
+            data_writer->advisePageCacheDontNeed();
     }
 
     /// handle implicit column
@@ -478,6 +486,8 @@ void MergeTreeDataPartWriterCompact::finishDataSerialization(IMergeTreeDataPart:
         stream.second->addToChecksums(checksums);
         if (sync)
             stream.second->sync();
+        if (settings.drop_page_cache_after_write)
+            stream.second->advisePageCacheDontNeed();
     }
 
     column_streams.clear();
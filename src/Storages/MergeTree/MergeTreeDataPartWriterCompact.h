@@ -107,6 +107,9 @@ private:
 
         void sync() const;
 
+        /// After finalize(): advise the written files out of the page cache.
+        void advisePageCacheDontNeed() const;
+
         void addToChecksums(IMergeTreeDataPart::Checksums & checksums);
 
         void addDataStreams(const NameAndTypePair & column, const ASTPtr & effective_codec_desc, SerializationsMap & serializations);
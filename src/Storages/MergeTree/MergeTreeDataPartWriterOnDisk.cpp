@@ -67,6 +67,12 @@ void MergeTreeDataPartWriterOnDisk::Stream::sync() const
     marks_file->sync();
 }
 
+void MergeTreeDataPartWriterOnDisk::Stream::advisePageCacheDontNeed() const
+{
+    plain_file->advisePageCacheDontNeed();
+    marks_file->advisePageCacheDontNeed();
+}
+
 MergeTreeDataPartWriterOnDisk::Stream::Stream(
     const String & escaped_column_name_,
     DiskPtr disk_,
@@ -628,6 +634,15 @@ Names MergeTreeDataPartWriterOnDisk::getSkipIndicesColumns() const
     return Names(skip_indexes_column_names_set.begin(), skip_indexes_column_names_set.end());
 }
 
+size_t MergeTreeDataPartWriterOnDisk::getCompressBlockSize(const IDataType & substream_type) const
+{
+    if (!settings.enable_adaptive_compress_block_size || !substream_type.haveMaximumSizeOfValue())
+        return settings.max_compress_block_size;
+
+    size_t block_size = substream_type.getMaximumSizeOfValueInMemory() * settings.adaptive_compress_block_rows;
+    return std::min(settings.max_compress_block_size, std::max(settings.min_compress_block_size, block_size));
+}
+
 void MergeTreeDataPartWriterOnDisk::addStreams(
     const NameAndTypePair & column,
     const ASTPtr & effective_codec_desc)
@@ -655,7 +670,7 @@ void MergeTreeDataPartWriterOnDisk::addStreams(
             part_path + stream_name, DATA_FILE_EXTENSION,
             part_path + stream_name, marks_file_extension,
             compression_codec,
-            settings.max_compress_block_size,
+            getCompressBlockSize(substream_type),
             false,
             write_compressed_index);
     };
@@ -692,7 +707,7 @@ void MergeTreeDataPartWriterOnDisk::addByteMapStreams(
             part_path + col_stream_name, DATA_FILE_EXTENSION,
             part_path + col_stream_name, marks_file_extension,
             compression_codec,
-            settings.max_compress_block_size,
+            getCompressBlockSize(substream_type),
             /* write_append = */data_part->versions->enable_compact_map_data,
             /* is_compact_map = */data_part->versions->enable_compact_map_data);
     };
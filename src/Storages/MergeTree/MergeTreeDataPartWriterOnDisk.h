@@ -119,6 +119,9 @@ public:
 
         void sync() const;
 
+        /// After finalize(): advise the written files out of the page cache.
+        void advisePageCacheDontNeed() const;
+
         void addToChecksums(IMergeTreeDataPart::Checksums & checksums);
 
         void deepCopyTo(Stream& target);
@@ -185,6 +188,11 @@ protected:
         const NameAndTypePair & column,
         const ASTPtr & effective_codec_desc);
 
+    /// Compression block size for one column stream. With enable_adaptive_compress_block_size
+    /// fixed-width streams get a block sized to hold adaptive_compress_block_rows values,
+    /// variable-width (high entropy) streams keep max_compress_block_size.
+    size_t getCompressBlockSize(const IDataType & substream_type) const;
+
     /// construct an implicit stream for map column (not kv)
     void addByteMapStreams(
          const NameAndTypePair & column, // implicit_name
@@ -740,6 +740,8 @@ void MergeTreeDataPartWriterWide::finishDataSerialization(IMergeTreeDataPart::Ch
         stream.second->addToChecksums(checksums);
         if (sync)
             stream.second->sync();
+        if (settings.drop_page_cache_after_write)
+            stream.second->advisePageCacheDontNeed();
     }
 
     column_streams.clear();
@@ -908,7 +910,7 @@ void MergeTreeDataPartWriterWide::updateWriterStream(const NameAndTypePair &pair
             part_path + stream_name, DATA_FILE_EXTENSION,
             part_path + stream_name, marks_file_extension,
             compression_codec,
-            settings.max_compress_block_size);
+            getCompressBlockSize(substream_type));
     };
 
     pair.type->enumerateStreams(serializations[pair.name], callback);
@@ -48,6 +48,7 @@
 #include <Parsers/parseIdentifierOrStringLiteral.h>
 #include <Interpreters/ExpressionAnalyzer.h>
 #include <Interpreters/Context.h>
+#include <Interpreters/RuntimeFilter/RuntimeFilterTypes.h>
 #include <Processors/ConcatProcessor.h>
 #include <QueryPlan/QueryPlan.h>
 #include <QueryPlan/FilterStep.h>
@@ -82,6 +83,7 @@ namespace ProfileEvents
     extern const Event IndexGranuleSeekTime;
     extern const Event IndexGranuleReadTime;
     extern const Event IndexGranuleCalcTime;
+    extern const Event RuntimeFilterPrunedGranules;
 }
 
 
@@ -569,11 +571,14 @@ MergeTreeDataSelectSamplingData MergeTreeDataSelectExecutor::getSampling(
     if (settings.enable_final_sample)
         sampling.use_sampling = false;
 
+    /// Regardless of how the sample is taken — the sampling key condition built below or the
+    /// mark range subsetting of sampleByRange() — queries scaling their aggregates by the
+    /// _sample_factor virtual column must see the actual sampled fraction.
+    if (sampling.use_sampling && sample_factor_column_queried && relative_sample_size != RelativeSize(0))
+        sampling.used_sample_factor = 1.0 / boost::rational_cast<Float64>(relative_sample_size);
+
     if (sampling.use_sampling && !settings.enable_sample_by_range && !settings.enable_deterministic_sample_by_range)
     {
-        if (sample_factor_column_queried && relative_sample_size != RelativeSize(0))
-            sampling.used_sample_factor = 1.0 / boost::rational_cast<Float64>(relative_sample_size);
-
         RelativeSize size_of_universum = 0;
         const auto & sampling_key = metadata_snapshot->getSamplingKey();
         DataTypePtr sampling_column_type = sampling_key.data_types[0];
@@ -868,6 +873,78 @@ DataTypes MergeTreeDataSelectExecutor::get_set_element_types(const NamesAndTypes
     return set_element_types;
 }
 
+/// Probe ready build-side runtime bloom filters against primary key values during index analysis.
+/// A key column has a single value inside a granule when the whole key prefix up to it is equal at
+/// both granule boundaries; such values can be probed for membership and whole granules dropped
+/// before any column IO. Effective for star-join probe tables ordered by the join key.
+static MarkRanges filterMarkRangesByRuntimeFilters(
+    const MergeTreeMetaBase::DataPartPtr & part,
+    const StorageMetadataPtr & metadata_snapshot,
+    const RuntimeFilterBloomFilters & runtime_filters,
+    MarkRanges ranges)
+{
+    auto index = part->getIndex();
+    if (!index || index->empty())
+        return ranges;
+
+    const auto & primary_key_columns = metadata_snapshot->getPrimaryKey().column_names;
+    std::vector<std::pair<size_t, const BloomFilterWithRange *>> key_filters;
+    for (size_t i = 0; i < primary_key_columns.size() && i < index->size(); ++i)
+    {
+        auto it = runtime_filters.find(primary_key_columns[i]);
+        if (it != runtime_filters.end() && it->second)
+            key_filters.emplace_back(i, it->second.get());
+    }
+
+    if (key_filters.empty())
+        return ranges;
+
+    size_t index_size = (*index)[0]->size();
+    size_t granules_dropped = 0;
+    MarkRanges res;
+
+    for (const auto & range : ranges)
+    {
+        for (size_t mark = range.begin; mark < range.end; ++mark)
+        {
+            bool keep = true;
+            if (mark + 1 < index_size)
+            {
+                for (const auto & [key_pos, bloom_filter] : key_filters)
+                {
+                    bool single_value = true;
+                    for (size_t i = 0; i <= key_pos && single_value; ++i)
+                        single_value = (*index)[i]->compareAt(mark, mark + 1, *(*index)[i], 1) == 0;
+                    if (!single_value)
+                        continue;
+
+                    Field value;
+                    (*index)[key_pos]->get(mark, value);
+                    if (!bloom_filter->probeFieldKey(value))
+                    {
+                        keep = false;
+                        break;
+                    }
+                }
+            }
+
+            if (keep)
+            {
+                if (!res.empty() && res.back().end == mark)
+                    ++res.back().end;
+                else
+                    res.emplace_back(MarkRange{mark, mark + 1});
+            }
+            else
+                ++granules_dropped;
+        }
+    }
+
+    if (granules_dropped)
+        ProfileEvents::increment(ProfileEvents::RuntimeFilterPrunedGranules, granules_dropped);
+    return res;
+}
+
 RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipIndexes(
     MergeTreeMetaBase::DataPartsVector && parts,
     StorageMetadataPtr metadata_snapshot,
@@ -879,7 +956,7 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
     size_t num_streams,
     ReadFromMergeTree::IndexStats & index_stats,
     bool use_skip_indexes,
-    const MergeTreeMetaBase & /*data_*/,
+    const MergeTreeMetaBase & data_,
     bool use_sampling,
     RelativeSize relative_sample_size)
 {
@@ -914,6 +991,18 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
             if (!condition->alwaysUnknownOrTrue())
                 useful_indices.emplace_back(index_helper, condition);
         }
+
+        if (data_.getSettings()->enable_auto_minmax_index)
+        {
+            /// Implicit per-column minmax indexes; parts written before the setting was
+            /// enabled have no index file and fall through filterMarksUsingIndex unchanged.
+            for (const auto & index_helper : getImplicitMinMaxIndices(metadata_snapshot, context))
+            {
+                auto condition = index_helper->createIndexCondition(query_info, context);
+                if (!condition->alwaysUnknownOrTrue())
+                    useful_indices.emplace_back(index_helper, condition);
+            }
+        }
     }
 
     if (use_skip_indexes && settings.force_data_skipping_indices.changed)
@@ -995,6 +1084,11 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
                 ranges.ranges = std::move(sampled_ranges);
             }
 
+            if (!ranges.ranges.empty() && query_info.runtime_filter_bloom_filters && !query_info.runtime_filter_bloom_filters->empty()
+                && metadata_snapshot->hasPrimaryKey())
+                ranges.ranges = filterMarkRangesByRuntimeFilters(
+                    part, metadata_snapshot, *query_info.runtime_filter_bloom_filters, std::move(ranges.ranges));
+
             MutableFilterBitmapPtr filter_bitmap = std::make_shared<roaring::Roaring>();
 
             IndexTimeWatcher index_time_watcher;
@@ -1056,7 +1150,10 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
 
         };
 
-        size_t num_threads = std::min(size_t(num_streams), parts.size());
+        size_t max_selection_threads = settings.merge_tree_parts_ranges_selection_threads
+            ? size_t(settings.merge_tree_parts_ranges_selection_threads)
+            : size_t(num_streams);
+        size_t num_threads = std::min(max_selection_threads, parts.size());
 
         if (num_threads <= 1)
         {
@@ -1067,18 +1164,28 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
         }
         else
         {
-            /// Parallel loading of data parts.
+            /// Parallel loading of data parts. On tables with hundreds of thousands of parts
+            /// scheduling one task per part dominates planning time, so parts are grouped
+            /// into batches and each batch is processed by a single task.
+            size_t min_parts_per_task = std::max<size_t>(1, settings.merge_tree_min_parts_per_ranges_selection_task);
+            size_t batch_size = std::max(min_parts_per_task, (parts.size() + num_threads - 1) / num_threads);
+            num_threads = std::min(num_threads, (parts.size() + batch_size - 1) / batch_size);
+
             ThreadPool pool(num_threads);
 
-            for (size_t part_index = 0; part_index < parts.size(); ++part_index)
-                pool.scheduleOrThrowOnError([&, part_index, thread_group = CurrentThread::getGroup()]
+            for (size_t batch_begin = 0; batch_begin < parts.size(); batch_begin += batch_size)
+            {
+                size_t batch_end = std::min(batch_begin + batch_size, parts.size());
+                pool.scheduleOrThrowOnError([&, batch_begin, batch_end, thread_group = CurrentThread::getGroup()]
                 {
                     SCOPE_EXIT_SAFE(if (thread_group) CurrentThread::detachQueryIfNotDetached(););
                     if (thread_group)
                         CurrentThread::attachTo(thread_group);
 
-                    process_part(part_index, part_index == 0);
+                    for (size_t part_index = batch_begin; part_index < batch_end; ++part_index)
+                        process_part(part_index, part_index == 0);
                 });
+            }
 
             pool.wait();
         }
@@ -587,11 +587,18 @@ MergeTreeMetaBase::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(
     if (!data.getSettings()->enable_segment_bitmap_index)
         bitmap_build_info.build_all_segment_bitmap_index = false;
 
+    auto skip_indices = index_factory.getMany(metadata_snapshot->getSecondaryIndices());
+    if (data.getSettings()->enable_auto_minmax_index)
+    {
+        for (auto & index : getImplicitMinMaxIndices(metadata_snapshot, context))
+            skip_indices.emplace_back(std::move(index));
+    }
+
     MergedBlockOutputStream out(
         new_data_part,
         metadata_snapshot,
         columns,
-        index_factory.getMany(metadata_snapshot->getSecondaryIndices()),
+        skip_indices,
         compression_codec,
         /* blocks_are_granules_size(default) */false,
         context->getSettingsRef().optimize_map_column_serialization,
@@ -45,10 +45,32 @@ struct MergeTreeReaderSettings
     bool convert_nested_to_subcolumns = false;
     /// Validate checksums on reading (should be always enabled in production).
     bool checksum_on_read = true;
+    /// Validate checksums of locally cached segments on a background thread instead of the
+    /// scan hot loop; corrupted segments are dropped from the disk cache and re-fetched.
+    /// Only takes effect together with checksum_on_read.
+    bool async_checksum_validation = false;
 
     /// whether read the original bitmap columns in BitEngine mode
     bool read_source_bitmap = true;
 
+    /// Number of compressed blocks each stream reads ahead and decompresses on the thread pool,
+    /// overlapping decompression with IO. 0 keeps decompression on the query thread.
+    size_t decompress_ahead_blocks = 0;
+
+    /// Decode independent columns of one granule batch concurrently on up to this many
+    /// threads. Columns sharing substreams (Nested siblings, ByteMap implicit columns)
+    /// keep their serial order on one thread. 1 keeps decoding on the query thread.
+    size_t read_columns_max_parallelism = 1;
+
+    /// Estimated compressed bytes the whole query is going to scan, used by the disk cache
+    /// admission policy to read huge scans around the cache. 0 means unknown.
+    size_t estimated_scan_bytes = 0;
+
+    /// If the mark ranges a stream serves cover at least this fraction of its marks, the
+    /// stream is read in one sequential window instead of one remote request per range.
+    /// 0 disables the heuristic. See IMergeTreeReaderStream::planSequentialRead.
+    double remote_read_min_density_for_sequential_read = 0;
+
     void setDiskCacheSteaing(UInt64 stealing_disk_cache)
     {
         if (stealing_disk_cache == 0)
@@ -105,16 +127,21 @@ struct MergeTreeWriterSettings
         , max_compress_block_size(
               storage_settings->max_compress_block_size ? storage_settings->max_compress_block_size
                                                         : global_settings.max_compress_block_size)
+        , enable_adaptive_compress_block_size(storage_settings->enable_adaptive_compress_block_size)
+        , adaptive_compress_block_rows(storage_settings->adaptive_compress_block_rows)
         , can_use_adaptive_granularity(can_use_adaptive_granularity_)
         , rewrite_primary_key(rewrite_primary_key_)
         , blocks_are_granules_size(blocks_are_granules_size_)
         , optimize_map_column_serialization(optimize_map_column_serialization_)
         , enable_disk_based_key_index(enable_disk_based_key_index_)
+        , drop_page_cache_after_write(storage_settings->drop_page_cache_after_part_write)
     {
     }
 
     size_t min_compress_block_size;
     size_t max_compress_block_size;
+    bool enable_adaptive_compress_block_size = false;
+    size_t adaptive_compress_block_rows = 65536;
     bool can_use_adaptive_granularity;
     bool rewrite_primary_key;
     bool blocks_are_granules_size;
@@ -122,5 +149,8 @@ struct MergeTreeWriterSettings
     bool optimize_map_column_serialization = false;
     bool enable_disk_based_key_index = false;
     bool is_merge = false;
+    /// Advise the written files out of the page cache after finalize, see
+    /// merge tree setting drop_page_cache_after_part_write.
+    bool drop_page_cache_after_write = false;
 };
 }
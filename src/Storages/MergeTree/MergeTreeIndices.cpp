@@ -1,8 +1,13 @@
 #include <Storages/MergeTree/MergeTreeIndices.h>
+#include <DataTypes/DataTypeNullable.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTIdentifier.h>
+#include <Parsers/ASTIndexDeclaration.h>
 #include <Parsers/parseQuery.h>
 #include <Parsers/ParserCreateQuery.h>
 #include <IO/WriteHelpers.h>
 #include <IO/ReadHelpers.h>
+#include <Common/escapeForFileName.h>
 
 #include <numeric>
 
@@ -109,4 +114,46 @@ MergeTreeIndexFactory & MergeTreeIndexFactory::instance()
     return instance;
 }
 
+MergeTreeIndices getImplicitMinMaxIndices(const StorageMetadataPtr & metadata_snapshot, ContextPtr context)
+{
+    NameSet covered_columns;
+    for (const auto & index : metadata_snapshot->getSecondaryIndices())
+        if (index.type == "minmax" && index.column_names.size() == 1)
+            covered_columns.insert(index.column_names.front());
+    /// The primary key already prunes granules on its columns.
+    for (const auto & name : metadata_snapshot->getColumnsRequiredForPrimaryKey())
+        covered_columns.insert(name);
+
+    MergeTreeIndices res;
+    for (const auto & column : metadata_snapshot->getColumns().getAllPhysical())
+    {
+        if (covered_columns.contains(column.name) || !removeNullable(column.type)->isValueRepresentedByNumber())
+            continue;
+
+        auto index_ast = std::make_shared<ASTIndexDeclaration>();
+        index_ast->name = "auto_minmax_" + escapeForFileName(column.name);
+        index_ast->granularity = 1;
+        ASTPtr expr = std::make_shared<ASTIdentifier>(column.name);
+        index_ast->set(index_ast->expr, expr);
+        ASTPtr type = std::make_shared<ASTFunction>();
+        type->as<ASTFunction &>().name = "minmax";
+        type->as<ASTFunction &>().no_empty_args = true;
+        index_ast->set(index_ast->type, type);
+
+        auto description = std::make_shared<IndexDescription>(
+            IndexDescription::getIndexFromAST(index_ast, metadata_snapshot->getColumns(), context));
+        auto index = MergeTreeIndexFactory::instance().get(*description);
+        /// IMergeTreeIndex keeps a reference to its IndexDescription; for declared indexes the
+        /// metadata snapshot owns it, here the description's lifetime is tied to the index object.
+        struct Holder
+        {
+            std::shared_ptr<IndexDescription> description;
+            MergeTreeIndexPtr index;
+        };
+        auto holder = std::make_shared<Holder>(Holder{std::move(description), std::move(index)});
+        res.emplace_back(MergeTreeIndexPtr(holder, holder->index.get()));
+    }
+    return res;
+}
+
 }
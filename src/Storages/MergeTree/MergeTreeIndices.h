@@ -129,6 +129,13 @@ private:
     Validators validators;
 };
 
+/// Minmax skipping indexes synthesized for every numeric and date column that is not already
+/// covered by the primary key or by a declared single-column minmax index. They are written
+/// and consulted only when the enable_auto_minmax_index merge tree setting is on; parts
+/// written before the setting was enabled simply have no index file and are read as usual.
+/// Unlike indexes built from table metadata, the returned objects own their IndexDescription.
+MergeTreeIndices getImplicitMinMaxIndices(const StorageMetadataPtr & metadata_snapshot, ContextPtr context);
+
 MergeTreeIndexPtr minmaxIndexCreator(const IndexDescription & index);
 void minmaxIndexValidator(const IndexDescription & index, bool attach);
 
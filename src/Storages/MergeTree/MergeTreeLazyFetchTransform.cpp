@@ -0,0 +1,165 @@
+#include <Storages/MergeTree/MergeTreeLazyFetchTransform.h>
+
+#include <Interpreters/Context.h>
+#include <Storages/MergeTree/IMergeTreeReader.h>
+#include <Storages/MergeTree/MergeTreeIndexGranularity.h>
+#include <common/logger_useful.h>
+
+#include <map>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+    extern const int NO_SUCH_DATA_PART;
+}
+
+namespace
+{
+    /// Index of the mark whose granule contains the given row of the part.
+    size_t markContainingRow(const MergeTreeIndexGranularity & index_granularity, size_t row)
+    {
+        size_t lo = 0;
+        size_t hi = index_granularity.getMarksCountWithoutFinal();
+        while (hi - lo > 1)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (index_granularity.getMarkStartingRow(mid) <= row)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+}
+
+Block MergeTreeLazyFetchTransform::transformHeader(Block header, const NamesAndTypesList & columns_to_fetch)
+{
+    header.erase("_part");
+    header.erase("_part_row_number");
+    for (const auto & column : columns_to_fetch)
+        header.insert({column.type->createColumn(), column.type, column.name});
+    return header;
+}
+
+MergeTreeLazyFetchTransform::MergeTreeLazyFetchTransform(
+    const Block & header_,
+    const MergeTreeMetaBase & storage_,
+    StorageMetadataPtr metadata_snapshot_,
+    NamesAndTypesList columns_to_fetch_,
+    ContextPtr context_)
+    : ISimpleTransform(header_, transformHeader(header_, columns_to_fetch_), false)
+    , storage(storage_)
+    , metadata_snapshot(std::move(metadata_snapshot_))
+    , columns_to_fetch(std::move(columns_to_fetch_))
+    , mark_cache(context_->getMarkCache())
+{
+    reader_settings = {
+        .save_marks_in_cache = false,
+        .read_source_bitmap = true,
+    };
+
+    part_column_pos = header_.getPositionByName("_part");
+    row_number_column_pos = header_.getPositionByName("_part_row_number");
+}
+
+MergeTreeMetaBase::DataPartPtr MergeTreeLazyFetchTransform::findPart(const String & name)
+{
+    if (!parts_loaded)
+    {
+        for (const auto & part : storage.getDataPartsVector())
+            parts_by_name.emplace(part->name, part);
+        parts_loaded = true;
+    }
+
+    auto it = parts_by_name.find(name);
+    if (it == parts_by_name.end())
+        throw Exception(
+            ErrorCodes::NO_SUCH_DATA_PART, "Cannot find part {} to fetch lazily materialized columns from", name);
+    return it->second;
+}
+
+void MergeTreeLazyFetchTransform::transform(Chunk & chunk)
+{
+    size_t num_rows = chunk.getNumRows();
+    auto columns = chunk.detachColumns();
+
+    const auto & part_column = *columns[part_column_pos];
+    const auto & row_number_column = *columns[row_number_column_pos];
+
+    /// Group the surviving rows by part and fetch them in ascending row order, so every
+    /// part is opened once and its reader only moves forward.
+    struct RowRef
+    {
+        size_t input_row;
+        size_t part_row;
+    };
+    std::map<String, std::vector<RowRef>> rows_by_part;
+    for (size_t i = 0; i < num_rows; ++i)
+        rows_by_part[part_column.getDataAt(i).toString()].push_back({i, static_cast<size_t>(row_number_column.getUInt(i))});
+
+    MutableColumns fetched;
+    for (const auto & column : columns_to_fetch)
+    {
+        fetched.emplace_back(column.type->createColumn());
+        fetched.back()->reserve(num_rows);
+    }
+
+    /// Rows are appended to `fetched` in part order; remember where every input row went
+    /// so the result can be permuted back to the sorted order afterwards.
+    IColumn::Permutation positions(num_rows);
+    size_t fetched_rows = 0;
+
+    for (auto & [part_name, rows] : rows_by_part)
+    {
+        std::sort(rows.begin(), rows.end(), [](const RowRef & lhs, const RowRef & rhs) { return lhs.part_row < rhs.part_row; });
+
+        auto part = findPart(part_name);
+        size_t marks_count = part->getMarksCount();
+        auto reader = part->getReader(
+            columns_to_fetch,
+            metadata_snapshot,
+            MarkRanges{MarkRange(0, marks_count)},
+            /* uncompressed_cache = */ nullptr,
+            mark_cache.get(),
+            reader_settings);
+
+        for (const auto & row_ref : rows)
+        {
+            size_t mark = markContainingRow(part->index_granularity, row_ref.part_row);
+            Columns res(columns_to_fetch.size());
+            size_t read = reader->readRows(
+                mark, marks_count, row_ref.part_row - part->index_granularity.getMarkStartingRow(mark), 1, res);
+            if (read != 1)
+                throw Exception(
+                    ErrorCodes::LOGICAL_ERROR,
+                    "Cannot fetch row {} of part {} for lazy materialization",
+                    row_ref.part_row,
+                    part_name);
+
+            bool should_evaluate_missing_defaults = false;
+            reader->fillMissingColumns(res, should_evaluate_missing_defaults, 1);
+            if (should_evaluate_missing_defaults)
+                reader->evaluateMissingDefaults({}, res);
+
+            for (size_t i = 0; i < res.size(); ++i)
+                fetched[i]->insertFrom(*res[i], 0);
+            positions[row_ref.input_row] = fetched_rows;
+            ++fetched_rows;
+        }
+    }
+
+    Columns result_columns;
+    result_columns.reserve(columns.size() - 2 + fetched.size());
+    for (size_t i = 0; i < columns.size(); ++i)
+        if (i != part_column_pos && i != row_number_column_pos)
+            result_columns.emplace_back(std::move(columns[i]));
+    for (auto & column : fetched)
+        result_columns.emplace_back(std::move(column)->permute(positions, 0));
+
+    chunk.setColumns(std::move(result_columns), num_rows);
+}
+
+}
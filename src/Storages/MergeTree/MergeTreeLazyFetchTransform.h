@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Core/NamesAndTypes.h>
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
+#include <Processors/ISimpleTransform.h>
+#include <Storages/MarkCache.h>
+#include <Storages/MergeTree/MergeTreeIOSettings.h>
+
+namespace DB
+{
+
+/** Second stage of lazy TopN materialization (see TableScanStep).
+  *
+  * The first read produces only the sort columns plus the implicit row locators
+  * `_part` and `_part_row_number`. After the top N rows are known, this transform
+  * fetches the remaining columns for exactly those rows with targeted granule
+  * reads, so the wide columns are materialized for N rows instead of every
+  * selected row. The locator columns are consumed and dropped.
+  */
+class MergeTreeLazyFetchTransform : public ISimpleTransform
+{
+public:
+    MergeTreeLazyFetchTransform(
+        const Block & header_,
+        const MergeTreeMetaBase & storage_,
+        StorageMetadataPtr metadata_snapshot_,
+        NamesAndTypesList columns_to_fetch_,
+        ContextPtr context_);
+
+    String getName() const override { return "MergeTreeLazyFetchTransform"; }
+
+    static Block transformHeader(Block header, const NamesAndTypesList & columns_to_fetch);
+
+protected:
+    void transform(Chunk & chunk) override;
+
+private:
+    MergeTreeMetaBase::DataPartPtr findPart(const String & name);
+
+    const MergeTreeMetaBase & storage;
+    StorageMetadataPtr metadata_snapshot;
+    NamesAndTypesList columns_to_fetch;
+    MergeTreeReaderSettings reader_settings;
+    MarkCachePtr mark_cache;
+
+    size_t part_column_pos = 0;
+    size_t row_number_column_pos = 0;
+
+    /// Parts of the storage by name, loaded on first use.
+    std::unordered_map<String, MergeTreeMetaBase::DataPartPtr> parts_by_name;
+    bool parts_loaded = false;
+
+    Poco::Logger * log = &Poco::Logger::get("MergeTreeLazyFetchTransform");
+};
+
+}
@@ -0,0 +1,154 @@
+#include <Storages/MergeTree/MergeTreePointLookup.h>
+
+#include <IO/WriteBufferFromString.h>
+#include <Interpreters/Context.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTIdentifier.h>
+#include <Parsers/ASTLiteral.h>
+#include <Storages/MergeTree/IMergeTreeReader.h>
+#include <Storages/MergeTree/MergeTreeIndexGranularity.h>
+#include <Storages/UniqueKeyIndex.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+}
+
+namespace
+{
+    /// Index of the mark whose granule contains the given row of the part.
+    size_t markContainingRow(const MergeTreeIndexGranularity & index_granularity, size_t row)
+    {
+        size_t lo = 0;
+        size_t hi = index_granularity.getMarksCountWithoutFinal();
+        while (hi - lo > 1)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (index_granularity.getMarkStartingRow(mid) <= row)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    bool collectEqualityConjuncts(const ASTPtr & node, std::unordered_map<String, Field> & bound)
+    {
+        const auto * func = node->as<ASTFunction>();
+        if (!func || !func->arguments)
+            return false;
+
+        if (func->name == "and")
+        {
+            for (const auto & child : func->arguments->children)
+                if (!collectEqualityConjuncts(child, bound))
+                    return false;
+            return true;
+        }
+
+        if (func->name != "equals" || func->arguments->children.size() != 2)
+            return false;
+
+        const auto & lhs = func->arguments->children[0];
+        const auto & rhs = func->arguments->children[1];
+        String column;
+        const ASTLiteral * literal = nullptr;
+        if (auto name = tryGetIdentifierName(lhs); name && (literal = rhs->as<ASTLiteral>()))
+            column = *name;
+        else if (auto rhs_name = tryGetIdentifierName(rhs); rhs_name && (literal = lhs->as<ASTLiteral>()))
+            column = *rhs_name;
+        else
+            return false;
+
+        return bound.emplace(column, literal->value).second;
+    }
+}
+
+std::optional<std::unordered_map<String, Field>> MergeTreePointLookup::extractEqualityConjunction(const ASTPtr & node)
+{
+    std::unordered_map<String, Field> bound;
+    if (!node || !collectEqualityConjuncts(node, bound))
+        return std::nullopt;
+    return bound;
+}
+
+String MergeTreePointLookup::serializeKey(const StorageMetadataPtr & metadata_snapshot, Block key_block)
+{
+    metadata_snapshot->getUniqueKeyExpression()->execute(key_block);
+
+    /// Same encoding as MergeTreeDataPartWriterWide::writeToTempUniqueKeyIndex.
+    WriteBufferFromOwnString key_buf;
+    for (const auto & name : metadata_snapshot->getUniqueKeyColumns())
+    {
+        const auto & column = key_block.getByName(name);
+        column.type->getDefaultSerialization()->serializeMemComparable(*column.column, 0, key_buf);
+    }
+    return key_buf.str();
+}
+
+Block MergeTreePointLookup::lookupRow(
+    const StorageMetadataPtr & metadata_snapshot,
+    const MergeTreeMetaBase::DataPartsVector & parts,
+    const String & serialized_key,
+    const Names & column_names,
+    const ContextPtr & context)
+{
+    for (const auto & part : parts)
+    {
+        auto unique_key_index = part->getUniqueKeyIndex();
+        if (!unique_key_index || !unique_key_index->mayContain(serialized_key))
+            continue;
+
+        UInt32 rowid;
+        if (!unique_key_index->lookup(serialized_key, rowid))
+            continue;
+
+        /// The first hit decides: when a key is superseded or deleted, the delete bitmap of
+        /// the part holding its latest row is updated, so either this row is visible or the
+        /// key has no visible row at all.
+        auto delete_bitmap = part->getDeleteBitmap(/*allow_null*/ true);
+        if (delete_bitmap && delete_bitmap->contains(rowid))
+            return {};
+
+        NamesAndTypesList columns_to_read = metadata_snapshot->getColumns().getAllPhysical().filter(column_names);
+        MergeTreeReaderSettings reader_settings{
+            .save_marks_in_cache = false,
+            .read_source_bitmap = true,
+        };
+        size_t marks_count = part->getMarksCount();
+        auto reader = part->getReader(
+            columns_to_read,
+            metadata_snapshot,
+            MarkRanges{MarkRange(0, marks_count)},
+            /* uncompressed_cache = */ nullptr,
+            context->getMarkCache().get(),
+            reader_settings);
+
+        size_t mark = markContainingRow(part->index_granularity, rowid);
+        Columns res(columns_to_read.size());
+        size_t read = reader->readRows(mark, marks_count, rowid - part->index_granularity.getMarkStartingRow(mark), 1, res);
+        if (read != 1)
+            throw Exception(ErrorCodes::LOGICAL_ERROR, "Cannot read row {} of part {} for point lookup", rowid, part->name);
+
+        bool should_evaluate_missing_defaults = false;
+        reader->fillMissingColumns(res, should_evaluate_missing_defaults, 1);
+        if (should_evaluate_missing_defaults)
+            reader->evaluateMissingDefaults({}, res);
+
+        Block result;
+        size_t i = 0;
+        for (const auto & column : columns_to_read)
+        {
+            result.insert({res[i], column.type, column.name});
+            ++i;
+        }
+        return result;
+    }
+
+    return {};
+}
+
+}
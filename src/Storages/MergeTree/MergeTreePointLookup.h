@@ -0,0 +1,49 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <Core/Block.h>
+#include <Core/Field.h>
+#include <Core/Names.h>
+#include <Interpreters/Context_fwd.h>
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
+#include <Parsers/IAST_fwd.h>
+
+namespace DB
+{
+
+/** Point lookup fast path for tables with UNIQUE KEY.
+  *
+  * Serving-style key lookups do not need full scan setup: every part of a unique table
+  * carries a key index (unique_key.idx, see MergeTreeDataPartWriterWide) mapping the
+  * mem-comparable key encoding to a rowid, with a bloom filter in front. Parts are probed
+  * newest-first and the first index hit decides the outcome: the part owning a key's live
+  * row is always the newest part containing the key, and its delete bitmap tells whether
+  * the row is still visible. On a hit only the single granule containing the row is read.
+  */
+class MergeTreePointLookup
+{
+public:
+    /// If `node` is a conjunction of `column = literal` predicates, return the bound
+    /// values keyed by column name; std::nullopt when any conjunct has another shape
+    /// or a column is bound more than once. Used by the interpreter to recognize
+    /// point-lookup WHERE clauses.
+    static std::optional<std::unordered_map<String, Field>> extractEqualityConjunction(const ASTPtr & node);
+
+    /// Serialize unique key values into the encoding stored in the key index.
+    /// `key_block` must hold one row with the input columns of the table's unique key
+    /// expression; the expression is evaluated here.
+    static String serializeKey(const StorageMetadataPtr & metadata_snapshot, Block key_block);
+
+    /// Probe `parts` (sorted newest-first) for the row whose unique key equals
+    /// `serialized_key` and return its `column_names` as a one-row block.
+    /// Returns an empty block when no visible row matches.
+    static Block lookupRow(
+        const StorageMetadataPtr & metadata_snapshot,
+        const MergeTreeMetaBase::DataPartsVector & parts,
+        const String & serialized_key,
+        const Names & column_names,
+        const ContextPtr & context);
+};
+
+}
@@ -397,7 +397,7 @@ void MergeTreeRangeReader::ReadResult::setFilterConstFalse()
     num_rows = 0;
 }
 
-void MergeTreeRangeReader::ReadResult::optimize(bool can_read_incomplete_granules, bool allow_filter_columns)
+void MergeTreeRangeReader::ReadResult::optimize(bool can_read_incomplete_granules, bool allow_filter_columns, double filter_selectivity_threshold)
 {
     if (total_rows_per_granule == 0 || filter == nullptr)
         return;
@@ -453,7 +453,7 @@ void MergeTreeRangeReader::ReadResult::optimize(bool can_read_incomplete_granule
         need_filter = true;
     }
     /// Another guess, if it's worth filtering at PREWHERE
-    else if (countBytesInResultFilter(filter->getData()) < 0.6 * filter->size())
+    else if (countBytesInResultFilter(filter->getData()) < filter_selectivity_threshold * filter->size())
         need_filter = true;
 }
 
@@ -589,7 +589,8 @@ MergeTreeRangeReader::MergeTreeRangeReader(
     const PrewhereExprInfo * prewhere_info_,
     ImmutableDeleteBitmapPtr delete_bitmap_,
     bool last_reader_in_chain_,
-    size_t filtered_ratio_to_use_skip_read_)
+    size_t filtered_ratio_to_use_skip_read_,
+    double prewhere_filter_selectivity_threshold_)
     : merge_tree_reader(merge_tree_reader_)
     , index_granularity(&(merge_tree_reader->data_part->index_granularity))
     , prev_reader(prev_reader_)
@@ -598,6 +599,7 @@ MergeTreeRangeReader::MergeTreeRangeReader(
     , last_reader_in_chain(last_reader_in_chain_)
     , is_initialized(true)
     , filtered_ratio_to_use_skip_read(filtered_ratio_to_use_skip_read_)
+    , prewhere_filter_selectivity_threshold(prewhere_filter_selectivity_threshold_)
 {
     if (prev_reader)
         sample_block = prev_reader->getSampleBlock();
@@ -866,6 +868,35 @@ MergeTreeRangeReader::ReadResult MergeTreeRangeReader::read(size_t max_rows, Mar
 }
 
 
+/// Clears filter bytes of rows from [read_pos, read_end) that are set in the delete bitmap.
+/// Deleted row ids are extracted in bulk through the roaring C API instead of advancing the
+/// iterator row by row, which is noticeably cheaper on CDC-heavy unique tables with dense bitmaps.
+/// Returns true if at least one row was deleted.
+static bool clearDeletedRowsInFilter(const Roaring & bitmap, size_t read_pos, size_t read_end, UInt8 * filter_start)
+{
+    UInt64 num_deleted = roaring::api::roaring_bitmap_range_cardinality(&bitmap.roaring, read_pos, read_end);
+    if (num_deleted == 0)
+        return false;
+
+    roaring::api::roaring_uint32_iterator_t iter;
+    roaring::api::roaring_init_iterator(&bitmap.roaring, &iter);
+    roaring::api::roaring_move_uint32_iterator_equalorlarger(&iter, read_pos);
+
+    constexpr size_t batch_size = 256;
+    UInt32 deleted_rows[batch_size];
+    while (num_deleted > 0)
+    {
+        /// range_cardinality guarantees the next num_deleted values are below read_end
+        UInt32 fetched = roaring::api::roaring_read_uint32_iterator(&iter, deleted_rows, std::min<UInt64>(num_deleted, batch_size));
+        if (fetched == 0)
+            break;
+        for (UInt32 i = 0; i < fetched; ++i)
+            filter_start[deleted_rows[i] - read_pos] = 0;
+        num_deleted -= fetched;
+    }
+    return true;
+}
+
 MergeTreeRangeReader::ReadResult MergeTreeRangeReader::startReadingChain(size_t max_rows, MarkRanges & ranges)
 {
     ReadResult result;
@@ -926,16 +957,7 @@ MergeTreeRangeReader::ReadResult MergeTreeRangeReader::startReadingChain(size_t
                 if (delete_bitmap)
                 {
                     UInt8 * filter_start = delete_filter_column->getData().data() + filter_column_offset;
-                    auto iter = delete_bitmap->begin();
-                    auto end = delete_bitmap->end();
-                    iter.equalorlarger(read_pos);
-                    auto saved_iter = iter;
-                    while (iter != end && *iter < read_end)
-                    {
-                        filter_start[*iter - read_pos] = 0;
-                        iter++;
-                    }
-                    if (iter != saved_iter)
+                    if (clearDeletedRowsInFilter(*delete_bitmap, read_pos, read_end, filter_start))
                         delete_filter_always_true = false;
                 }
 
@@ -1300,7 +1322,7 @@ void MergeTreeRangeReader::executePrewhereActionsAndFilterColumns(ReadResult & r
 
     /// If there is a WHERE, we filter in there, and only optimize IO and shrink columns here
     if (!last_reader_in_chain)
-        result.optimize(merge_tree_reader->canReadIncompleteGranules(), prewhere_info->row_level_filter == nullptr);
+        result.optimize(merge_tree_reader->canReadIncompleteGranules(), prewhere_info->row_level_filter == nullptr, prewhere_filter_selectivity_threshold);
 
     /// If we read nothing or filter gets optimized to nothing
     if (result.totalRowsPerGranule() == 0)
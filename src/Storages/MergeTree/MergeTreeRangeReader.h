@@ -72,7 +72,8 @@ public:
         const PrewhereExprInfo * prewhere_info_,
         ImmutableDeleteBitmapPtr delete_bitmap_,
         bool last_reader_in_chain_,
-        size_t filtered_ratio_to_use_skip_read_);
+        size_t filtered_ratio_to_use_skip_read_,
+        double prewhere_filter_selectivity_threshold_ = 0.6);
 
     MergeTreeRangeReader() = default;
 
@@ -208,7 +209,7 @@ public:
         /// Set filter or replace old one. Filter must have more zeroes than previous.
         void setFilter(const ColumnPtr & new_filter);
         /// For each granule calculate the number of filtered rows at the end. Remove them and update filter.
-        void optimize(bool can_read_incomplete_granules, bool allow_filter_columns);
+        void optimize(bool can_read_incomplete_granules, bool allow_filter_columns, double filter_selectivity_threshold = 0.6);
         /// Remove all rows from granules.
         void clear();
 
@@ -282,6 +283,9 @@ private:
     bool is_initialized = false;
 
     size_t filtered_ratio_to_use_skip_read = 0;
+    /// If the combined PREWHERE filter keeps less than this fraction of rows, filter columns
+    /// right inside PREWHERE instead of deferring the filtering to WHERE.
+    double prewhere_filter_selectivity_threshold = 0.6;
     /// used by last reader to track how many marks are selected
     std::optional<size_t> last_selected_mark {std::nullopt};
 };
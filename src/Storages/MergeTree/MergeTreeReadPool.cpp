@@ -89,6 +89,7 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
 
     /// Steal task if nothing to do and it's not prohibited
     auto thread_idx = thread;
+    bool stolen_from_active_thread = false;
     if (!tasks_remaining_for_this_thread)
     {
         auto it = remaining_thread_tasks.lower_bound(backoff_state.current_threads);
@@ -99,12 +100,22 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
             remaining_thread_tasks.erase(it);
             remaining_thread_tasks.insert(thread);
         }
-        else // Try steal tasks from the next thread
+        else // Steal from the active thread with the most remaining work, so that a single
+             // part with cold granules does not gate the whole scan
         {
-            it = remaining_thread_tasks.upper_bound(thread);
-            if (it == remaining_thread_tasks.end())
-                it = remaining_thread_tasks.begin();
-            thread_idx = *it;
+            size_t max_marks_left = 0;
+            for (auto candidate : remaining_thread_tasks)
+            {
+                size_t marks_left = 0;
+                for (auto marks : threads_tasks[candidate].sum_marks_in_parts)
+                    marks_left += marks;
+                if (marks_left > max_marks_left)
+                {
+                    max_marks_left = marks_left;
+                    thread_idx = candidate;
+                }
+            }
+            stolen_from_active_thread = thread_idx != thread;
         }
         ProfileEvents::increment(ProfileEvents::TaskStealCount);
     }
@@ -119,10 +130,22 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
 
     auto need_marks = min_marks_to_read;
 
+    if (stolen_from_active_thread)
+    {
+        // Take half of the victim's tail part, leaving the rest (and its locality) to the owner.
+        // When backoff already reported slow reads, the disk subsystem is saturated and bigger
+        // stolen batches would only amplify the pressure, so fall back to the minimal batch.
+        if (backoff_state.num_events > 0)
+            need_marks = min_marks_to_read;
+        else
+            need_marks = std::max(min_marks_to_read, marks_in_part / 2);
+        if (marks_in_part < need_marks + min_marks_to_read)
+            need_marks = marks_in_part; /// do not leave a sliver that is not worth a separate read
+    }
     // If there are remaining tasks can be stolen, read the whole part
     // For remote storage like S3, we can send less net request if task is bigger
-    if (thread_tasks.parts_and_ranges.size() > 1) {
-        need_marks = marks_in_part; 
+    else if (thread_tasks.parts_and_ranges.size() > 1) {
+        need_marks = marks_in_part;
     } else {
         // If only last part is left, get whole part to read if it is small enough.
         if (marks_in_part <= min_marks_to_read)
@@ -112,9 +112,14 @@ MergeTreeReaderStream::MergeTreeReaderStream(
         if (!settings_.checksum_on_read)
             buffer->disableChecksumming();
 
+        if (settings_.decompress_ahead_blocks)
+            buffer->enableDecompressAhead(settings_.decompress_ahead_blocks);
+
         non_cached_buffer = std::move(buffer);
         data_buffer = non_cached_buffer.get();
     }
+
+    planSequentialRead(all_mark_ranges, settings_.remote_read_min_density_for_sequential_read);
 }
 
 void MergeTreeReaderStream::seekToMark(size_t index)
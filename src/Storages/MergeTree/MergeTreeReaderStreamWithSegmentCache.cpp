@@ -80,6 +80,8 @@ MergeTreeReaderStreamWithSegmentCache::MergeTreeReaderStreamWithSegmentCache(
         clock_type_, stream_extension_
     );
     data_buffer = read_buffer_holder.get();
+
+    planSequentialRead(all_mark_ranges_, settings_.remote_read_min_density_for_sequential_read);
 }
 
 void MergeTreeReaderStreamWithSegmentCache::seekToStart()
@@ -260,55 +260,9 @@ size_t MergeTreeReaderWide::readNecessaryRows(size_t num_columns, size_t from_ma
 
     ProfileEventsTimer timer(ProfileEvents::ReadRowsTimeMicro);
 
-    size_t read_rows = 0;
     int row_number_column_pos = -1;
-    auto name_and_type = sort_columns.begin();
-    for (size_t i = 0; i < num_columns; ++i, ++name_and_type)
-    {
-        auto column_from_part = getColumnFromPart(*name_and_type);
-        const auto& [name, type] = column_from_part;
-        size_t pos = res_col_to_idx[name];
-
-        if (!res_columns[pos]) {
-            type->enable_zero_cpy_read = this->settings.read_settings.zero_copy_read_from_cache;
-            res_columns[pos] = type->createColumn();
-        }
-
-        /// row number column will be populated at last after `read_rows` is set
-        if (name == "_part_row_number")
-        {
-            row_number_column_pos = pos;
-            continue;
-        }
-
-        auto& column = res_columns[pos];
-        try
-        {
-            size_t column_size_before_reading = column->size();
-            auto& cache = caches[column_from_part.getNameInStorage()];
-            if (type->isByteMap())
-                readMapDataNotKV(column_from_part, column, from_mark, continue_reading,
-                    current_task_last_mark, rows_to_read, res_col_to_idx, res_columns);
-            else
-                readData(column_from_part, column, from_mark, continue_reading,
-                   current_task_last_mark, rows_to_read, cache);
-
-            /// For elements of Nested, column_size_before_reading may be greater than column size
-            ///  if offsets are not empty and were already read, but elements are empty.
-            if (!column->empty())
-                read_rows = std::max(read_rows, column->size() - column_size_before_reading);
-        }
-        catch (Exception& e)
-        {
-            /// Better diagnostics.
-            e.addMessage("(while reading column " + name + ")");
-            throw;
-        }
-
-        if (column->empty())
-            res_columns[pos] = nullptr;
-    }
-    caches.clear();
+    size_t read_rows = readPhysicalColumns(num_columns, from_mark, continue_reading,
+        current_task_last_mark, rows_to_read, res_col_to_idx, res_columns, row_number_column_pos);
 
     /// Populate _part_row_number column if requested
     if (row_number_column_pos >= 0)
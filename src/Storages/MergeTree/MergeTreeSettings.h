@@ -63,6 +63,18 @@ enum StealingCacheMode : UInt64
       "Compress the pending uncompressed data in buffer if its size is larger or equal than the specified threshold. Block of data will " \
       "be compressed even if the current granule is not finished. If this setting is not set, the corresponding global setting is used.", \
       0) \
+    M(Bool, \
+      enable_adaptive_compress_block_size, \
+      false, \
+      "Pick the compression block size per column stream instead of using one fixed max_compress_block_size. Fixed-width columns get a " \
+      "block sized to hold adaptive_compress_block_rows values (clamped between min and max compress block size), variable-width " \
+      "columns keep max_compress_block_size.", \
+      0) \
+    M(UInt64, \
+      adaptive_compress_block_rows, \
+      65536, \
+      "When enable_adaptive_compress_block_size is set, the number of values one compression block of a fixed-width column should hold.", \
+      0) \
     M(UInt64, index_granularity, 8192, "How many rows correspond to one primary key value.", 0) \
     M(UInt64, max_digestion_size_per_segment, 256 * 1024 * 1024, "Max number of bytes to digest per segment to build GIN index.", 0) \
     \
@@ -278,6 +290,12 @@ enum StealingCacheMode : UInt64
       0, \
       "The maximum speed of data exchange over the network in bytes per second for replicated sends. Zero means unlimited.", \
       0) \
+    M(UInt64, \
+      max_remote_request_rate, \
+      0, \
+      "The maximum number of remote storage read requests per second issued for this table, also counted against " \
+      "max_remote_request_rate_for_server when it is set. Zero means unlimited.", \
+      0) \
 \
     /** Check delay of replicas settings. */ \
     M(UInt64, \
@@ -348,6 +366,8 @@ enum StealingCacheMode : UInt64
     M(Bool, enable_partition_ttl_fallback, true, "When TTL expression doesn't match partition expression, Try to calculate partition's TTL value and mark expired partitions by scanning parts' ttl info", 0) \
     \
     M(Bool, write_final_mark, 1, "Write final mark after end of column (0 - disabled, do nothing if index_granularity_bytes=0)", 0) \
+    M(Bool, write_part_ndv_sketches, false, "Compute per column NDV sketches while writing a part and store them in the part, so table statistics can be maintained incrementally instead of recollected with scans", 0) \
+    M(Bool, drop_page_cache_after_part_write, false, "Advise the kernel to drop written part data from the page cache once each file is finalized, so large write-once INSERTs and merges do not evict hot data. Local disks only.", 0) \
     M(Bool, enable_mixed_granularity_parts, 1, "Enable parts with adaptive and non adaptive granularity", 0) \
     M(MaxThreads, max_part_loading_threads, 0, "The number of threads to load data parts at startup.", 0) \
     M(MaxThreads, \
@@ -401,6 +421,7 @@ enum StealingCacheMode : UInt64
 \
     /** ByteDance settings */ \
     \
+    M(Bool, enable_auto_minmax_index, false, "Automatically build a per-granule minmax skipping index for every numeric and date column not covered by the primary key or a declared minmax index, and consult it to prune granules at read time", 0) \
     M(Bool, enable_build_ab_index, true, "", 0) \
     M(Bool, enable_segment_bitmap_index, true, "", 0) \
     M(Bool, build_bitmap_index_in_merge, true, "", 0) \
@@ -433,6 +454,8 @@ enum StealingCacheMode : UInt64
     M(Bool, enable_async_init_metasotre, false, "", 0) \
     M(Bool, cnch_temporary_table, false, "", 0) \
     M(MaxThreads, cnch_parallel_prefetching, 0, "", 0) \
+    M(Bool, cnch_part_cache_compact_model, false, "Drop the raw partition_minmax bytes from cached part models once they are deserialized into the wrapper; they are restored on demand when a model leaves the server", 0) \
+    M(UInt64, cnch_part_meta_tail_read_bytes, 256 * 1024, "Read the last N bytes of a part's packed data file in one request and parse the footer, checksums and metainfo from it; 0 falls back to one request per meta file", 0) \
     M(Bool, enable_prefetch_checksums, true, "", 0) \
     M(Bool, enable_calculate_columns_size_with_sample, 1, "", 0) \
     M(Bool, enable_calculate_columns_size_without_map, 1, "", 0) \
@@ -461,8 +484,13 @@ enum StealingCacheMode : UInt64
     M(UInt64, cnch_merge_max_total_rows_to_merge, 50000000, "", 0) \
     M(UInt64, cnch_merge_max_total_bytes_to_merge, 150ULL * 1024 * 1024 * 1024, "", 0) \
     M(UInt64, cnch_merge_max_parts_to_merge, 100, "", 0) \
+    M(Bool, cnch_merge_enable_micro_merge, false, "Select contiguous runs of tiny parts from microbatch INSERTs directly, without waiting for the cost-based selector", 0) \
+    M(UInt64, cnch_merge_micro_part_bytes, 1024 * 1024, "Parts of at most this size on disk are eligible for the micro-merge fast path", 0) \
+    M(UInt64, cnch_merge_micro_min_parts_to_merge, 8, "Minimum number of contiguous tiny parts that forms a micro-merge group", 0) \
+    M(Bool, cnch_merge_enable_recompression_ttl, true, "Schedule rewrite merges for parts whose RECOMPRESS TTL has expired when the regular selector finds nothing to do", 0) \
     M(UInt64, cnch_mutate_max_parts_to_mutate, 100, "", 0) \
     M(UInt64, cnch_mutate_max_total_bytes_to_mutate, 50UL * 1024 * 1024 * 1024, "", 0) \
+    M(UInt64, cnch_mutate_max_batched_mutations, 16, "Apply up to this many consecutive non-schema-changing mutations (e.g. point deletes) to a part in one rewrite task instead of one task per mutation. 1 disables batching.", 0) \
     \
     /* Unique table related settings */\
     M(Bool, cloud_enable_staging_area, false, "", 0) \
@@ -472,9 +500,11 @@ enum StealingCacheMode : UInt64
     M(UInt64, staged_part_lifetime_threshold_ms_to_block_kafka_consume, 10000, "", 0) \
     M(Seconds, unique_acquire_write_lock_timeout, 300, "", 0) \
     M(MaxThreads, cnch_parallel_dumping_threads, 8, "", 0) \
+    M(UInt64, cnch_parallel_dumping_max_inflight_bytes, 0, "Bound on the total on-disk size of parts being dumped to remote storage at once, 0 means unlimited", 0) \
     M(MaxThreads, unique_table_dedup_threads, 8, "", 0) \
     M(Seconds, dedup_worker_progress_log_interval, 120, "", 0) \
     M(UInt64, max_delete_bitmap_meta_depth, 100, "", 0) \
+    M(UInt64, max_delete_bitmap_delta_cardinality, 16, "Max number of deleted rows per dedup cycle written as an incremental delta bitmap; larger deltas rewrite the base bitmap. Raising it reduces base rewrite IO on high-churn tables at the cost of more bitmaps to merge per read, bounded by max_delete_bitmap_meta_depth", 0) \
     M(UInt64, enable_delete_mutation_on_unique_table, false, "Allow to run delete mutation on unique table. It's disabled by default and DELETE FROM is recommended for unique table.", 0) \
     M(UInt64, unique_merge_acquire_lock_retry_time, 10, "", 0) \
     M(Bool, enable_bucket_level_unique_keys, false, "", 0) \
@@ -485,6 +515,8 @@ enum StealingCacheMode : UInt64
     M(Bool, enable_duplicate_check_while_writing, true, "Whether to check duplicate keys while writing for unique table. Although turning it on may have a certain impact on the tps of writing, it is recommended to enable it by default.", 0) \
     /**Whether block the actual dedup progress, Attention: set this value to true only in ci **/               \
     M(Bool, disable_dedup_parts, false, "", 0) \
+    M(UInt64, dedup_bloom_filter_prefilter_max_rows, 0, "When a dedup batch has at most this many rows, probe visible parts' unique key index bloom filters with the batch keys first and skip parts that cannot contain any of them. 0 disables the prefilter.", 0) \
+    M(UInt64, dedup_index_scan_batch_size, 0, "Decode unique key index entries in batches of this size during the dedup merge, trading a small copy per entry for far fewer virtual calls. 0 keeps per-entry iteration.", 0) \
     \
     /* Metastore settings */\
     M(Bool, enable_metastore, false, "Use KV metastore to manage data parts.", 0) \
@@ -501,6 +533,9 @@ enum StealingCacheMode : UInt64
     M(Bool, enable_gc_evict_disk_cache, false, "Enable gc evict disk cache", 0)      \
     M(MaxThreads, cnch_parallel_preloading, 0, "Max threads when worker preload parts", 0) \
     M(UInt64, disk_cache_stealing_mode, 0, "Read/write remote vw local disk cache if cur local disk cache empty, 0: close; 1: read 2: write 3: read&write", 0) \
+    M(Bool, enable_disk_cache_auto_tiering, false, "Let the host server preload frequently queried partitions into the worker disk cache and drop cached data of partitions that went cold, based on per-partition query access statistics", 0) \
+    M(UInt64, disk_cache_auto_tiering_max_hot_partitions, 16, "Auto tiering keeps at most this many partitions preloaded per table", 0) \
+    M(UInt64, disk_cache_auto_tiering_hot_window_seconds, 86400, "Auto tiering only preloads partitions queried within this window and demotes pinned partitions idle for longer", 0) \
     \
     /* Renamed settings - cannot be ignored */\
     M(Bool, enable_nullable_sorting_key, false, "Alias of `allow_nullable_key`", 0) \
@@ -533,6 +568,7 @@ enum StealingCacheMode : UInt64
     M(UInt64, gc_trash_part_thread_pool_size, 4, "Turn up the thread pool size to speed up trashing of parts", 0) \
     M(UInt64, gc_remove_part_thread_pool_size, 20, "Turn up the thread pool size to speed up trash cleaning of parts", 0) \
     M(UInt64, gc_remove_part_batch_size, 200, "Batch size to remove trash parts from storage in background tasks", 0) \
+    M(Bool, gc_trash_items_range_delete, false, "Remove trash records of a fully removed GC batch with one ranged metastore delete instead of one delete per key. Assumes no concurrent writer adds trash items for the table inside the scanned key range.", 0) \
 \
     /** uuid of CnchMergeTree, as we won't use uuid in CloudMergeTree */ \
     M(String, cnch_table_uuid, "", "Used for CloudMergeTree to get uuid of Cnch Table for ingestion task, like Kafka", 0) \
@@ -107,6 +107,7 @@ MergeTreeWhereOptimizer::MergeTreeWhereOptimizer(
     , metadata_snapshot{metadata_snapshot_}
     , enable_ab_index_optimization{context_->getSettingsRef().enable_ab_index_optimization}
     , enable_implicit_column_prewhere_push{context_->getSettingsRef().enable_implicit_column_prewhere_push}
+    , prewhere_use_selectivity_cost{context_->getSettingsRef().enable_prewhere_selectivity_order}
     , materialize_strategy{materialize_strategy_}
     , aggresive_pushdown{context_->getSettingsRef().late_materialize_aggressive_push_down}
     , partition_columns(metadata_snapshot_->getPartitionKey().column_names)
@@ -190,6 +191,48 @@ static bool isConditionGood(const ASTPtr & condition)
 }
 
 
+/// Estimated fraction of rows surviving a condition, from per-operator defaults in the
+/// spirit of the classic Selinger constants. Column statistics (NDV, histograms) are not
+/// reachable from every place this optimizer is constructed - workers rewrite queries
+/// without access to the statistics catalog - so the estimates are shape-based; they only
+/// need to order conditions relative to each other, not be accurate in absolute terms.
+static Float64 estimateSelectivity(const ASTPtr & condition)
+{
+    const auto * function = condition->as<ASTFunction>();
+    if (!function)
+        return 1.0;
+
+    const auto & name = function->name;
+
+    if (name == "not")
+    {
+        if (function->arguments && !function->arguments->children.empty())
+            return std::max(0.1, 1.0 - estimateSelectivity(function->arguments->children.front()));
+        return 1.0;
+    }
+
+    if (name == "or")
+    {
+        Float64 total = 0.0;
+        for (const auto & child : function->arguments->children)
+            total += estimateSelectivity(child);
+        return std::min(1.0, total);
+    }
+
+    if (name == "equals")
+        return 0.1;
+    if (name == "in" || name == "arraySetCheck" || name == "has")
+        return 0.2;
+    if (name == "less" || name == "greater" || name == "lessOrEqual" || name == "greaterOrEqual" || name == "startsWith")
+        return 0.3;
+    if (name == "like" || name == "match")
+        return 0.5;
+    if (name == "notEquals" || name == "notLike" || name == "notIn")
+        return 0.9;
+
+    return 1.0;
+}
+
 void MergeTreeWhereOptimizer::analyzeImpl(Conditions & res, const ASTPtr & node, bool is_final) const
 {
     if (const auto * func_and = node->as<ASTFunction>(); func_and && func_and->name == "and")
@@ -201,6 +244,7 @@ void MergeTreeWhereOptimizer::analyzeImpl(Conditions & res, const ASTPtr & node,
     {
         Condition cond;
         cond.node = node;
+        cond.use_cost_order = prewhere_use_selectivity_cost;
 
         collectIdentifiersNoSubqueries(node, cond.identifiers);
 
@@ -221,6 +265,8 @@ void MergeTreeWhereOptimizer::analyzeImpl(Conditions & res, const ASTPtr & node,
         if (cond.viable)
         {
             cond.good = isConditionGood(node);
+            if (prewhere_use_selectivity_cost)
+                cond.selectivity = estimateSelectivity(node);
             LOG_DEBUG(log, "MergeTreeWhereOptimizer: analyzeImpl identifiers: {}, column_size:{}", boost::join(cond.identifiers, ","), std::to_string(cond.columns_size));
         }
         res.emplace_back(std::move(cond));
@@ -351,10 +397,33 @@ bool MergeTreeWhereOptimizer::isArraySetCheck(const ASTPtr & condition, bool) co
 
 void MergeTreeWhereOptimizer::optimize(ASTSelectQuery & select) const
 {
-    if (!select.where() || select.prewhere())
+    /// A scan can reach us already carrying a PREWHERE: under the distributed optimizer the
+    /// probe side of a join gets its runtime filter placed there by rewriteDynamicFilter().
+    /// For the prewhere strategy there is nothing left to decide, but for late
+    /// materialization such scans are the most profitable ones - the join-selectivity
+    /// filter drops most probe rows, and every other column should be fetched only for the
+    /// survivors. Stage its conditions together with the rest of the WHERE, remembering
+    /// where they came from: the ones the chain cannot take are restored to PREWHERE
+    /// afterwards instead of degrading to an after-read WHERE filter.
+    Conditions prewhere_conditions;
+    if (select.prewhere())
+    {
+        if (materialize_strategy != MaterializeStrategy::LATE_MATERIALIZE)
+            return;
+
+        prewhere_conditions = analyze(select.prewhere(), select.final());
+        for (auto & condition : prewhere_conditions)
+            condition.from_prewhere = true;
+        select.setExpression(ASTSelectQuery::Expression::PREWHERE, nullptr);
+    }
+
+    if (!select.where() && prewhere_conditions.empty())
         return;
 
-    Conditions where_conditions = analyze(select.where(), select.final());
+    Conditions where_conditions;
+    if (select.where())
+        where_conditions = analyze(select.where(), select.final());
+    where_conditions.splice(where_conditions.begin(), prewhere_conditions);
 
     if (materialize_strategy == MaterializeStrategy::PREWHERE)
         optimizePrewhere(where_conditions, select);
@@ -603,6 +672,28 @@ void MergeTreeWhereOptimizer::optimizeLateMaterialize(Conditions where_condition
     LOG_DEBUG(log, "Prewhere predicate map by column:\n {}", fmt::join(atomic_predicates_expr, "\n"));
 #endif
 
+    /// Conditions that arrived in PREWHERE but could not be staged go back to PREWHERE:
+    /// left in plain WHERE they would only run after every column is read, losing the
+    /// in-read filtering they had before the optimizer touched the query. The interpreter
+    /// folds PREWHERE into WHERE whenever a WHERE remains, so no row escapes either path.
+    Conditions restored_prewhere;
+    for (auto it = where_conditions.begin(); it != where_conditions.end();)
+    {
+        if (it->from_prewhere)
+            restored_prewhere.splice(restored_prewhere.end(), where_conditions, it++);
+        else
+            ++it;
+    }
+    if (!restored_prewhere.empty())
+    {
+        /// The late-materialize readers evaluate only their chain and WHERE; when nothing
+        /// else is left in WHERE the restored conditions must stay there as well, or the
+        /// chain's survivors would never be filtered by them.
+        if (where_conditions.empty() && !atomic_predicates_expr.empty())
+            where_conditions = restored_prewhere;
+        select.setExpression(ASTSelectQuery::Expression::PREWHERE, reconstruct(restored_prewhere));
+    }
+
     select.setExpression(ASTSelectQuery::Expression::WHERE, reconstruct(where_conditions));
 
 }
@@ -90,9 +90,25 @@ private:
         /// Can condition be moved to prewhere?
         bool viable = false;
 
+        /// Condition arrived in the query's PREWHERE (e.g. a runtime filter placed there
+        /// by the optimizer); if it cannot be staged it goes back to PREWHERE, not WHERE.
+        bool from_prewhere = false;
+
         /// Does the condition presumably have good selectivity?
         bool good = false;
 
+        /// Estimated fraction of rows surviving this condition (see estimateSelectivity).
+        /// Only meaningful when cost ordering is enabled.
+        Float64 selectivity = 1.0;
+
+        /// Rank candidates by estimated cost instead of the plain size heuristic.
+        bool use_cost_order = false;
+
+        /// Bytes that have to be read, weighted by the chance the rows survive:
+        /// a selective condition on a fat column may still beat an unselective one
+        /// on a thin column because every later step scales with its survivors.
+        Float64 cost() const { return selectivity * columns_size; }
+
         auto tuple() const
         {
             return std::make_tuple(!viable, !good, columns_size, identifiers.size());
@@ -101,6 +117,9 @@ private:
         /// Is condition a better candidate for moving to PREWHERE?
         bool operator < (const Condition & rhs) const
         {
+            if (use_cost_order)
+                return std::make_tuple(!viable, cost(), columns_size, identifiers.size())
+                    < std::make_tuple(!rhs.viable, rhs.cost(), rhs.columns_size, rhs.identifiers.size());
             return tuple() < rhs.tuple();
         }
     };
@@ -175,6 +194,7 @@ private:
     const StorageMetadataPtr & metadata_snapshot;
     bool enable_ab_index_optimization;
     bool enable_implicit_column_prewhere_push;
+    bool prewhere_use_selectivity_cost;
 
     /// Late materialize
     MaterializeStrategy materialize_strategy;
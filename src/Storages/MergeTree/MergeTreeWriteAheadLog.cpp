@@ -58,6 +58,7 @@ MergeTreeWriteAheadLog::MergeTreeWriteAheadLog(
     {
         std::lock_guard lock(write_mutex);
         out->sync();
+        ++syncs_done;
         sync_scheduled = false;
         sync_cv.notify_all();
     });
@@ -251,20 +252,32 @@ void MergeTreeWriteAheadLog::sync(std::unique_lock<std::mutex> & lock)
     size_t bytes_to_sync = storage.getSettings()->write_ahead_log_bytes_to_fsync;
     time_t time_to_sync = storage.getSettings()->write_ahead_log_interval_ms_to_fsync;
     size_t current_bytes = out->count();
+    bool insert_sync = storage.getSettings()->in_memory_parts_insert_sync;
 
     if (bytes_to_sync && current_bytes - bytes_at_last_sync > bytes_to_sync)
     {
-        sync_task->schedule();
+        if (!sync_scheduled)
+        {
+            sync_task->schedule();
+            sync_scheduled = true;
+        }
         bytes_at_last_sync = current_bytes;
     }
-    else if (time_to_sync && !sync_scheduled)
+    else if ((time_to_sync || insert_sync) && !sync_scheduled)
     {
         sync_task->scheduleAfter(time_to_sync);
         sync_scheduled = true;
     }
 
-    if (storage.getSettings()->in_memory_parts_insert_sync)
-        sync_cv.wait(lock, [this] { return !sync_scheduled; });
+    /// Group commit: all appends of the current window share the single fsync scheduled
+    /// above, but each insert is acknowledged only once a sync covering its bytes has
+    /// completed. The mutex is held from the append up to here, so the next completed
+    /// sync is guaranteed to include this insert.
+    if (insert_sync)
+    {
+        UInt64 target = syncs_done + 1;
+        sync_cv.wait(lock, [&] { return syncs_done >= target; });
+    }
 }
 
 std::optional<MergeTreeWriteAheadLog::MinMaxBlockNumber>
@@ -109,6 +109,9 @@ private:
     std::condition_variable sync_cv;
 
     size_t bytes_at_last_sync = 0;
+    /// Number of completed fsyncs. Monotonic across rotations, so an insert can be
+    /// acknowledged as soon as a sync covering its bytes has finished (group commit).
+    UInt64 syncs_done = 0;
     bool sync_scheduled = false;
     bool has_sync_to_metastore = false;
 
@@ -61,6 +61,9 @@ MergedBlockOutputStream::MergedBlockOutputStream(
 
     writer = data_part->getWriter(columns_list, metadata_snapshot, skip_indices, default_codec, writer_settings, {}, bitmap_build_info);
 
+    if (storage.getSettings()->write_part_ndv_sketches)
+        ndv_sketches = std::make_unique<Statistics::PartNdvSketches>();
+
     if (metadata_snapshot->hasUniqueKey())
     {
         auto writer_wide = dynamic_cast<MergeTreeDataPartWriterWide *>(writer.get());
@@ -216,6 +219,21 @@ void MergedBlockOutputStream::finalizePartOnDisk(
             out->sync();
     }
 
+    if (ndv_sketches && !ndv_sketches->empty())
+    {
+        /// Write the per column NDV sketches, the part carries them into the shared storage.
+        const String sketches_file_name = Statistics::PartNdvSketches::FILE_NAME;
+        auto out = volume->getDisk()->writeFile(fs::path(part_path) / sketches_file_name, {.buffer_size = 4096});
+        HashingWriteBuffer out_hashing(*out);
+        ndv_sketches->write(out_hashing);
+        out_hashing.next();
+        checksums.files[sketches_file_name].file_size = out_hashing.count();
+        checksums.files[sketches_file_name].file_hash = out_hashing.getHash();
+        out->finalize();
+        if (sync)
+            out->sync();
+    }
+
     removeEmptyColumnsFromPart(new_part, part_columns, checksums);
 
     {
@@ -259,6 +277,16 @@ void MergedBlockOutputStream::writeImpl(const Block & block, const IColumn::Perm
 
     writer->write(block, permutation);
     rows_count += rows;
+
+    /// NDV is invariant under the permutation, the unsorted block can be used as is.
+    if (ndv_sketches)
+        ndv_sketches->update(block);
+}
+
+void MergedBlockOutputStream::updateNdvSketches(const Block & block)
+{
+    if (ndv_sketches)
+        ndv_sketches->update(block);
 }
 
 void  MergedBlockOutputStream::updateWriterStream(const NameAndTypePair &pair)
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <Statistics/PartNdvSketches.h>
 #include <Storages/MergeTree/IMergedBlockOutputStream.h>
 #include <Columns/ColumnArray.h>
 
@@ -72,6 +73,11 @@ public:
     size_t getRowsCount() const { return rows_count; }
     void updateWriterStream(const NameAndTypePair &pair) override;
 
+    /// Feed columns written outside this stream into the part's NDV sketches. A vertical
+    /// merge writes only the merging key columns through write(); the gathered columns
+    /// must be reported here so the sketches stored with the merged part cover them too.
+    void updateNdvSketches(const Block & block);
+
 private:
     /** If `permutation` is given, it rearranges the values in the columns when writing.
       * This is necessary to not keep the whole block in the RAM to sort it.
@@ -89,6 +95,10 @@ private:
     IMergeTreeDataPart::MinMaxIndex minmax_idx;
     size_t rows_count = 0;
     CompressionCodecPtr default_codec;
+
+    /// Per column NDV sketches accumulated from written blocks and stored in the part,
+    /// enabled by the merge tree setting write_part_ndv_sketches.
+    std::unique_ptr<Statistics::PartNdvSketches> ndv_sketches;
 };
 
 }
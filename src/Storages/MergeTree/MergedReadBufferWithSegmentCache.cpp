@@ -17,10 +17,12 @@
 #include <memory>
 #include <optional>
 #include <math.h>
+#include <IO/LimitReadBuffer.h>
 #include <IO/createReadBufferFromFileBase.h>
 #include <Storages/DiskCache/PartFileDiskCacheSegment.h>
 #include <Storages/MergeTree/MergeTreeSuffix.h>
 #include <Storages/MergeTree/MergedReadBufferWithSegmentCache.h>
+#include "Compression/AsyncChecksumValidator.h"
 #include "Compression/CachedCompressedReadBuffer.h"
 #include "Compression/CompressedReadBufferFromFile.h"
 #include "Core/SettingsEnums.h"
@@ -36,6 +38,8 @@ namespace ProfileEvents
 {
     extern const Event CnchReadSizeFromDiskCache;
     extern const Event CnchReadSizeFromRemote;
+    extern const Event CnchDiskCacheReadaheadSegments;
+    extern const Event CnchDiskCacheReadaheadBytes;
 }
 
 namespace DB
@@ -111,6 +115,15 @@ void MergedReadBufferWithSegmentCache::DualCompressedReadBuffer::disableChecksum
         : non_cached_buffer->disableChecksumming();
 }
 
+void MergedReadBufferWithSegmentCache::DualCompressedReadBuffer::offloadChecksumValidation(
+    std::function<void(PODArray<char> frame)> offload)
+{
+    assertInitialized();
+
+    cached_buffer != nullptr ? cached_buffer->offloadChecksumValidation(std::move(offload))
+        : non_cached_buffer->offloadChecksumValidation(std::move(offload));
+}
+
 ReadBuffer& MergedReadBufferWithSegmentCache::DualCompressedReadBuffer::activeBuffer()
 {
     assertInitialized();
@@ -310,6 +323,8 @@ void MergedReadBufferWithSegmentCache::seekToPosition(size_t segment_idx,
     // Reset current working/internal buffer first
     reset();
 
+    sequential_segments = segment_idx == current_segment_idx + 1 ? sequential_segments + 1 : 0;
+
     current_compressed_offset = std::nullopt;
 
     if (seekToMarkInSegmentCache(segment_idx, mark_pos))
@@ -322,6 +337,16 @@ void MergedReadBufferWithSegmentCache::seekToPosition(size_t segment_idx,
         cache_buffer.reset();
     }
 
+    // A sequential scan just crossed a segment boundary and missed the cache, fetch the
+    // following segments with one remote read, populate the cache and retry it
+    if (segment_cache != nullptr && sequential_segments > 0
+        && settings.read_settings.disk_cache_readahead_segments > 0
+        && tryCoalescedReadAhead(segment_idx)
+        && seekToMarkInSegmentCache(segment_idx, mark_pos))
+    {
+        return;
+    }
+
     // No segment cache, trying to use source reader
     initSourceBufferIfNeeded();
 
@@ -454,6 +479,78 @@ bool MergedReadBufferWithSegmentCache::seekToMarkInRemoteSegmentCache(size_t seg
     return true;
 }
 
+bool MergedReadBufferWithSegmentCache::tryCoalescedReadAhead(size_t segment_idx)
+{
+    size_t max_segments = settings.read_settings.disk_cache_readahead_segments;
+
+    // Collect right boundaries of the contiguous run of uncached segments to fetch.
+    // A boundary mark pointing into the middle of a compressed block makes a segment
+    // overlap the following one (see PartFileDiskCacheSegment::cacheToDisk), such
+    // segments can't be sliced out of one sequential read, stop before them
+    std::vector<size_t> right_offsets;
+    for (size_t candidate = segment_idx;
+        candidate < total_segment_count && candidate - segment_idx < max_segments; ++candidate)
+    {
+        if (candidate != segment_idx
+            && segment_cache->get(PartFileDiskCacheSegment::getSegmentKey(
+                storage_id, part_name, stream_name, candidate, stream_extension)).first != nullptr)
+        {
+            break;
+        }
+
+        if (candidate + 1 == total_segment_count)
+        {
+            right_offsets.push_back(source_data_size);
+            break;
+        }
+
+        const MarkInCompressedFile & boundary = marks_loader.getMark((candidate + 1) * cache_segment_size);
+        if (boundary.offset_in_decompressed_block != 0)
+            break;
+        right_offsets.push_back(boundary.offset_in_compressed_file);
+    }
+
+    // A single segment readahead saves nothing over the plain source fallback
+    if (right_offsets.size() < 2)
+        return false;
+
+    size_t left_offset = marks_loader.getMark(segment_idx * cache_segment_size).offset_in_compressed_file;
+    size_t total_bytes = right_offsets.back() - left_offset;
+
+    try
+    {
+        auto read_settings = settings.read_settings;
+        read_settings.estimated_size = total_bytes;
+        auto data_file = source_disk->readFile(source_file_path, read_settings);
+        data_file->seek(toSourceDataOffset(left_offset));
+
+        size_t segment_left_offset = left_offset;
+        for (size_t i = 0; i < right_offsets.size(); ++i)
+        {
+            size_t segment_bytes = right_offsets[i] - segment_left_offset;
+            String segment_key = PartFileDiskCacheSegment::getSegmentKey(
+                storage_id, part_name, stream_name, segment_idx + i, stream_extension);
+            LimitReadBuffer segment_value(*data_file, segment_bytes, false);
+            segment_cache->set(segment_key, segment_value, segment_bytes, false);
+            segment_left_offset = right_offsets[i];
+        }
+
+        ProfileEvents::increment(ProfileEvents::CnchDiskCacheReadaheadSegments, right_offsets.size());
+        ProfileEvents::increment(ProfileEvents::CnchDiskCacheReadaheadBytes, total_bytes);
+
+        LOG_TRACE(logger, fmt::format("Coalesced readahead of {} segments [{}, {}) of part {} "
+            "stream {}, offset {}, bytes {}", right_offsets.size(), segment_idx,
+            segment_idx + right_offsets.size(), part_name, stream_name, left_offset, total_bytes));
+    }
+    catch (...)
+    {
+        tryLogCurrentException("MergedReadBufferWithSegmentCache");
+        return false;
+    }
+
+    return true;
+}
+
 void MergedReadBufferWithSegmentCache::initCacheBufferIfNeeded(
     const DiskPtr & cache_disk, const String & cache_path, std::unique_ptr<ReadBufferFromRpcStreamFile> remote_cache)
 {
@@ -501,6 +598,27 @@ void MergedReadBufferWithSegmentCache::initCacheBufferIfNeeded(
         {
             cache_buffer.disableChecksumming();
         }
+        else if (settings.async_checksum_validation && cache_disk && !uncompressed_cache)
+        {
+            /// The local copy can be quarantined and re-fetched from remote storage, so its
+            /// CRC pass may run behind the scenes: serve blocks optimistically and let the
+            /// background checker drop the cached segment on a mismatch, falling back to the
+            /// source of truth on the next read. Direct remote reads keep inline validation,
+            /// and so does the uncompressed cache path, where decompressed cells keyed by the
+            /// segment path would outlive the quarantined file.
+            cache_buffer.offloadChecksumValidation(
+                [cache_disk, cache_path, label = fullPath(cache_disk, cache_path), log = logger](PODArray<char> frame)
+                {
+                    AsyncChecksumValidator::instance().submit(
+                        label,
+                        std::move(frame),
+                        [cache_disk, cache_path, log](const String &)
+                        {
+                            LOG_WARNING(log, "Quarantining corrupted disk cache segment {}", cache_path);
+                            cache_disk->removeFileIfExists(cache_path);
+                        });
+                });
+        }
     }
 }
 
@@ -111,6 +111,7 @@ private:
         inline void seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block);
         inline size_t compressedOffset();
         inline void disableChecksumming();
+        inline void offloadChecksumValidation(std::function<void(PODArray<char> frame)> offload);
 
         inline ReadBuffer& activeBuffer();
 
@@ -123,6 +124,9 @@ private:
 
     void seekToPosition(size_t segment_idx, const MarkInCompressedFile& mark_pos);
     bool seekToMarkInSegmentCache(size_t segment_idx, const MarkInCompressedFile& mark_pos);
+    // Fetch segment_idx and following uncached segments with one remote read and
+    // populate the segment cache, returns false if nothing got cached
+    bool tryCoalescedReadAhead(size_t segment_idx);
     void initialize();
     bool seekToMarkInRemoteSegmentCache(size_t segment_idx, const MarkInCompressedFile& mark_pos, const String & segment_key);
     void initCacheBufferIfNeeded(const DiskPtr & disk, const String & path, std::unique_ptr<ReadBufferFromRpcStreamFile> remote_cache = nullptr);
@@ -160,6 +164,9 @@ private:
 
     // current segment index is guarantee to be consistent with cache_buffer
     size_t current_segment_idx;
+    // Number of consecutive seeks which moved to the directly following segment,
+    // used to detect sequential scans worth a coalesced readahead
+    size_t sequential_segments = 0;
     // Current compressed offset of underlying data, if this object has_value,
     // then there must encounter end of a segment
     std::optional<size_t> current_compressed_offset;
@@ -82,7 +82,7 @@ void ReplicatedMergeTreeQueue::initialize(const MergeTreeData::DataParts & parts
 
 bool ReplicatedMergeTreeQueue::isVirtualPart(const MergeTreeData::DataPartPtr & data_part) const
 {
-    std::lock_guard lock(state_mutex);
+    /// Deliberately without state_mutex: the parts mover calls this for every part.
     auto virtual_part_name = virtual_parts.getContainingPart(data_part->info);
     return !virtual_part_name.empty() && virtual_part_name != data_part->name;
 }
@@ -1843,10 +1843,7 @@ ReplicatedMergeTreeMergePredicate::ReplicatedMergeTreeMergePredicate(
     : queue(queue_)
     , prev_virtual_parts(queue.format_version)
 {
-    {
-        std::lock_guard lock(queue.state_mutex);
-        prev_virtual_parts = queue.virtual_parts;
-    }
+    prev_virtual_parts = *queue.virtual_parts.getSnapshot();
 
     /// Load current quorum status.
     auto quorum_status_future = zookeeper->asyncTryGet(fs::path(queue.zookeeper_path) / "quorum" / "status");
@@ -2194,7 +2191,7 @@ bool ReplicatedMergeTreeMergePredicate::isMutationFinished(const ReplicatedMerge
     {
         std::lock_guard lock(queue.state_mutex);
 
-        size_t suddenly_appeared_parts = getPartNamesToMutate(mutation, queue.virtual_parts).size();
+        size_t suddenly_appeared_parts = getPartNamesToMutate(mutation, *queue.virtual_parts.getSnapshot()).size();
         if (suddenly_appeared_parts)
         {
             LOG_TRACE(queue.log, "Mutation {} is not done yet because {} parts to mutate suddenly appeared.", mutation.znode_name, suddenly_appeared_parts);
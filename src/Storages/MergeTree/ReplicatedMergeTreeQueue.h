@@ -98,8 +98,13 @@ private:
 
     /** What will be the set of active parts after executing all log entries up to log_pointer.
       * Used to determine which merges can be assigned (see ReplicatedMergeTreeMergePredicate)
+      *
+      * Concurrent so that hot read-only paths (isVirtualPart is called for every part by the
+      * parts mover, the merge predicate copies the whole set) take a wait-free snapshot instead
+      * of contending on state_mutex with queue processing. All mutations still happen under
+      * state_mutex, so readers holding state_mutex observe a stable snapshot.
       */
-    ActiveDataPartSet virtual_parts;
+    ConcurrentActiveDataPartSet virtual_parts;
 
 
     /// Dropped ranges inserted into queue
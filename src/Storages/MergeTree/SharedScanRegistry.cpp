@@ -0,0 +1,86 @@
+#include <Storages/MergeTree/SharedScanRegistry.h>
+
+#include <Core/UUID.h>
+#include <Common/Stopwatch.h>
+
+
+namespace DB
+{
+
+SharedScanRegistry & SharedScanRegistry::instance()
+{
+    static SharedScanRegistry registry;
+    return registry;
+}
+
+String SharedScanRegistry::partKey(const RangesInDataPart & part)
+{
+    return UUIDHelpers::UUIDToString(part.data_part->storage.getStorageUUID()) + "_" + part.data_part->name;
+}
+
+void SharedScanRegistry::registerScan(const RangesInDataParts & parts)
+{
+    UInt64 now_ns = clock_gettime_ns(CLOCK_MONOTONIC);
+
+    std::lock_guard lock(mutex);
+    sweepExpiredLocked(now_ns);
+    for (const auto & part : parts)
+    {
+        if (part.ranges.empty())
+            continue;
+
+        auto & entries = active_scans[partKey(part)];
+        std::erase_if(entries, [now_ns](const ScanEntry & entry) { return entry.expires_at_ns <= now_ns; });
+        entries.push_back(ScanEntry{part.ranges, now_ns + scan_visibility_ns});
+    }
+}
+
+void SharedScanRegistry::sweepExpiredLocked(UInt64 now_ns)
+{
+    /// Lazy per-key pruning never reaches keys that are not looked up again (e.g. parts
+    /// of dropped tables), so the map would grow without bound; sweep them here.
+    if (now_ns < next_sweep_ns)
+        return;
+    next_sweep_ns = now_ns + scan_visibility_ns;
+
+    for (auto it = active_scans.begin(); it != active_scans.end();)
+    {
+        std::erase_if(it->second, [now_ns](const ScanEntry & entry) { return entry.expires_at_ns <= now_ns; });
+        if (it->second.empty())
+            it = active_scans.erase(it);
+        else
+            ++it;
+    }
+}
+
+bool SharedScanRegistry::hasOverlappingScan(const RangesInDataParts & parts) const
+{
+    UInt64 now_ns = clock_gettime_ns(CLOCK_MONOTONIC);
+
+    std::lock_guard lock(mutex);
+    for (const auto & part : parts)
+    {
+        auto it = active_scans.find(partKey(part));
+        if (it == active_scans.end())
+            continue;
+
+        auto & entries = it->second;
+        std::erase_if(entries, [now_ns](const ScanEntry & entry) { return entry.expires_at_ns <= now_ns; });
+        if (entries.empty())
+        {
+            active_scans.erase(it);
+            continue;
+        }
+
+        /// Parts hold few ranges after coalescing, so the quadratic check is cheap.
+        for (const auto & entry : entries)
+            for (const auto & their : entry.ranges)
+                for (const auto & ours : part.ranges)
+                    if (ours.begin < their.end && their.begin < ours.end)
+                        return true;
+    }
+
+    return false;
+}
+
+}
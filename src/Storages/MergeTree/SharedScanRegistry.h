@@ -0,0 +1,66 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <Storages/MergeTree/RangesInDataPart.h>
+
+
+namespace DB
+{
+
+/** Tracks which parts and mark ranges are currently being scanned on this node,
+  * so that overlapping scans from concurrent queries can cooperate.
+  *
+  * Dashboard-style bursts issue many queries over the same partitions within
+  * seconds. The uncompressed cache already multicasts decompressed blocks to
+  * every reader (LRUCache::getOrSet collapses concurrent loads of one block into
+  * a single read + decompression, and all readers share the resulting cell), but
+  * large scans bypass the cache to avoid flushing it (merge_tree_max_rows_to_use_cache).
+  * This registry provides the missing detection piece: when a new query's ranges
+  * overlap a scan registered by another running query, the caller can opt back
+  * into the cached path so the burst pays IO and decompression once per granule.
+  *
+  * Registrations expire after a fixed interval rather than being tied to query
+  * lifetime: the goal is burst detection, and an expired entry only costs one
+  * query a missed sharing opportunity. Expired entries are pruned lazily on the
+  * keys a lookup touches, and a periodic full sweep removes keys that are never
+  * looked up again (e.g. parts of dropped tables), so the map stays bounded by
+  * the scans of the last visibility window.
+  */
+class SharedScanRegistry
+{
+public:
+    static SharedScanRegistry & instance();
+
+    /// Record that a query is about to scan these ranges. Entries stay visible
+    /// to hasOverlappingScan() for scan_visibility_ns.
+    void registerScan(const RangesInDataParts & parts);
+
+    /// Whether any previously registered, non-expired scan covers at least one
+    /// mark range overlapping `parts`.
+    bool hasOverlappingScan(const RangesInDataParts & parts) const;
+
+private:
+    /// Bursts that benefit from sharing land within seconds of each other.
+    static constexpr UInt64 scan_visibility_ns = 30ULL * 1000 * 1000 * 1000;
+
+    struct ScanEntry
+    {
+        MarkRanges ranges;
+        UInt64 expires_at_ns;
+    };
+
+    static String partKey(const RangesInDataPart & part);
+
+    /// Erases all expired entries and empty keys. Must be called with `mutex` held;
+    /// runs at most once per visibility window.
+    void sweepExpiredLocked(UInt64 now_ns);
+
+    mutable std::mutex mutex;
+    /// Keyed by storage UUID + part name; a part may be scanned by several queries at once.
+    mutable std::unordered_map<String, std::vector<ScanEntry>> active_scans;
+    UInt64 next_sweep_ns = 0;
+};
+
+}
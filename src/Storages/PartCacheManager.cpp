@@ -16,7 +16,9 @@
 #include <Protos/data_models.pb.h>
 #include <Storages/PartCacheManager.h>
 
+#include <algorithm>
 #include <chrono>
+#include <thread>
 #include <iterator>
 #include <Catalog/Catalog.h>
 #include <Catalog/CatalogFactory.h>
@@ -131,11 +133,24 @@ PartCacheManager::PartCacheManager(ContextMutablePtr context_, const size_t memo
         }
         this->trashed_active_tables_cleaner->scheduleAfter(5 * 60 * 1000);
     });
+    size_t tiering_interval_ms = getContext()->getConfigRef().getUInt("disk_cache_auto_tiering_interval_seconds", 300) * 1000;
+    disk_cache_tiering_task = getContext()->getSchedulePool().createTask("DiskCacheAutoTiering", [this, tiering_interval_ms]() {
+        try
+        {
+            runDiskCacheAutoTiering();
+        }
+        catch (...)
+        {
+            tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+        }
+        this->disk_cache_tiering_task->scheduleAfter(tiering_interval_ms);
+    });
     if (getContext()->getServerType() == ServerType::cnch_server && !dummy_mode)
     {
         meta_lock_cleaner->activateAndSchedule();
         active_table_loader->activateAndSchedule();
         trashed_active_tables_cleaner->activateAndSchedule();
+        disk_cache_tiering_task->activateAndSchedule();
     }
 }
 
@@ -399,6 +414,53 @@ UInt64 PartCacheManager::getTableLastUpdateTime(const UUID & uuid)
     return last_update_time;
 }
 
+std::shared_ptr<const ServerDataPartsVector> PartCacheManager::getCachedVisibleParts(const IStorage & table, UInt64 ts)
+{
+    TableMetaEntryPtr table_entry = getTableMeta(table.getStorageUUID());
+    if (!table_entry || ts == 0)
+        return nullptr;
+
+    UInt64 last_update_time;
+    {
+        auto lock = table_entry->readLock();
+        last_update_time = table_entry->last_update_time;
+    }
+
+    /// A snapshot older than the last commit may miss parts the cached set already contains.
+    if (last_update_time == 0 || ts < last_update_time)
+        return nullptr;
+
+    std::lock_guard lock(table_entry->visible_parts_cache_mutex);
+    if (table_entry->visible_parts_cache
+        && table_entry->visible_parts_cache_update_time == last_update_time
+        && table_entry->visible_parts_cache_version == table_entry->cache_version.get())
+        return table_entry->visible_parts_cache;
+
+    return nullptr;
+}
+
+void PartCacheManager::setCachedVisibleParts(const IStorage & table, UInt64 ts, const ServerDataPartsVector & visible_parts)
+{
+    TableMetaEntryPtr table_entry = getTableMeta(table.getStorageUUID());
+    if (!table_entry || ts == 0 || table_entry->need_invalid_cache)
+        return;
+
+    UInt64 last_update_time;
+    {
+        auto lock = table_entry->readLock();
+        last_update_time = table_entry->last_update_time;
+    }
+
+    /// If a part committed after the snapshot the set was computed at, it is already stale.
+    if (last_update_time == 0 || ts < last_update_time)
+        return;
+
+    std::lock_guard lock(table_entry->visible_parts_cache_mutex);
+    table_entry->visible_parts_cache_update_time = last_update_time;
+    table_entry->visible_parts_cache_version = table_entry->cache_version.get();
+    table_entry->visible_parts_cache = std::make_shared<const ServerDataPartsVector>(visible_parts);
+}
+
 void PartCacheManager::setTableClusterStatus(const UUID & uuid, const bool clustered)
 {
     TableMetaEntryPtr table_entry = getTableMeta(uuid);
@@ -707,6 +769,14 @@ void PartCacheManager::invalidDataCache(const UUID & uuid, const Ds & xs)
 
     if (!meta_ptr)
         return;
+
+    /// Parts are being removed behind the cache's back (e.g. on rollback); any published
+    /// visible set may contain them, so drop it.
+    {
+        std::lock_guard visible_lock(meta_ptr->visible_parts_cache_mutex);
+        meta_ptr->visible_parts_cache = nullptr;
+    }
+
     std::unordered_map<String, Strings> partition_to_data;
     for (auto & x : xs)
     {
@@ -798,7 +868,7 @@ void PartCacheManager::insertDataIntoCache(
         if constexpr (std::is_same_v<CachePtr, CnchDataPartCachePtr>)
         {
             if (!partitionid_to_partition.contains(partition_id))
-                partitionid_to_partition[partition_id] = createPartitionFromMetaString(storage, data_adapter.getPartitionMinmax());
+                partitionid_to_partition[partition_id] = data_adapter.getPartition();
         }
         else if constexpr (!std::is_same_v<CachePtr, CnchDeleteBitmapCachePtr>)
         {
@@ -975,6 +1045,41 @@ inline bool PartCacheManager::isVisible(const DB::DataModelDeleteBitmapPtr & bit
     return ts == 0 || (bitmap->txn_id() <= ts && bitmap->commit_time() <= ts);
 }
 
+/// Whether early pruning may be applied to a fully cached partition. Tombstone parts must reach
+/// the later visibility calculation (pruning one would resurrect the parts it covers), and
+/// partitions that contain partial parts are returned unpruned, because dropping a base part
+/// would leave its version chain dangling before the chains are even constructed.
+template <typename CacheValueMap>
+static bool canApplyCachedPartsFilter(const CachedPartsFilter & parts_filter, CacheValueMap & cached)
+{
+    if (!parts_filter)
+        return false;
+
+    for (const auto & value : cached)
+    {
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, DataModelPartWrapperPtr>)
+        {
+            if (value->part_model->part_info().hint_mutation())
+                return false;
+        }
+        else
+        {
+            /// Only the part cache supports early pruning.
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename ValuePtr>
+static bool passesCachedPartsFilter(const CachedPartsFilter & parts_filter, const ValuePtr & value)
+{
+    if constexpr (std::is_same_v<ValuePtr, DataModelPartWrapperPtr>)
+        return value->part_model->deleted() || parts_filter(value);
+    else
+        return true;
+}
+
 template <
     typename CachePtr,
     typename RetValue,
@@ -984,7 +1089,12 @@ template <
     typename LoadFunc,
     typename RetValueVec>
 RetValueVec PartCacheManager::getOrSetDataInPartitions(
-    const IStorage & table, const Strings & partitions, LoadFunc && load_func, const UInt64 & ts, const PairInt64 & topology_version)
+    const IStorage & table,
+    const Strings & partitions,
+    LoadFunc && load_func,
+    const UInt64 & ts,
+    const PairInt64 & topology_version,
+    const CachedPartsFilter & parts_filter)
 {
     RetValueVec res;
     mayUpdateTableMeta(table, topology_version);
@@ -1012,10 +1122,10 @@ RetValueVec PartCacheManager::getOrSetDataInPartitions(
 
     if (meta_ptr->load_parts_by_partition)
         res = getDataByPartition<CachePtr, RetValue, CacheValueMap, FetchedValue, Adapter, LoadFunc, RetValueVec>(
-            storage, meta_ptr, partitions, load_func, ts);
+            storage, meta_ptr, partitions, load_func, ts, parts_filter);
     else
         res = getDataInternal<CachePtr, RetValue, CacheValueMap, FetchedValue, Adapter, LoadFunc, RetValueVec>(
-            storage, meta_ptr, partitions, meta_ptr->getPartitionIDs(), load_func, ts);
+            storage, meta_ptr, partitions, meta_ptr->getPartitionIDs(), load_func, ts, parts_filter);
 
     return res;
 }
@@ -1028,6 +1138,7 @@ void PartCacheManager::loadActiveTables()
     LOG_DEBUG(&Poco::Logger::get("PartCacheManager"), "Reloading {} active tables.", tables_meta.size());
 
     auto rpc_port = getContext()->getRPCPort();
+    std::vector<StoragePtr> tables_to_prefetch;
     for (auto & table_meta : tables_meta)
     {
         if (table_meta.database() == "cnch_system" || table_meta.database() == "system" || Status::isDeleted(table_meta.status()))
@@ -1043,7 +1154,152 @@ void PartCacheManager::loadActiveTables()
                 continue;
 
             if (isLocalServer(host_port.getRPCAddress(), toString(rpc_port)))
+            {
                 mayUpdateTableMeta(*table, host_port.topology_version);
+                if (getContext()->getConfigRef().getBool("enable_part_cache_prefetch", false))
+                    tables_to_prefetch.push_back(table);
+            }
+        }
+    }
+
+    if (!tables_to_prefetch.empty())
+        prefetchPartCacheForTables(tables_to_prefetch);
+}
+
+void PartCacheManager::prefetchPartCacheForTables(const std::vector<StoragePtr> & tables)
+{
+    /// Warm the part cache for tables newly assigned to this server so that the first
+    /// query after a failover does not pay a Catalog round-trip storm. Catalog calls are
+    /// batched by partition and rate limited to avoid hammering the metastore.
+    size_t partition_batch_size = std::max<size_t>(1, getContext()->getConfigRef().getUInt("part_cache_prefetch_partition_batch_size", 16));
+    size_t batch_interval_ms = getContext()->getConfigRef().getUInt("part_cache_prefetch_batch_interval_ms", 100);
+
+    for (const auto & table : tables)
+    {
+        try
+        {
+            auto meta_ptr = getTableMeta(table->getStorageUUID());
+            if (!meta_ptr)
+                continue;
+
+            auto partition_ids = meta_ptr->getPartitionIDs();
+            if (partition_ids.empty())
+                continue;
+
+            TxnTimestamp ts = getContext()->tryGetTimestamp();
+
+            for (size_t batch_begin = 0; batch_begin < partition_ids.size(); batch_begin += partition_batch_size)
+            {
+                size_t batch_end = std::min(batch_begin + partition_batch_size, partition_ids.size());
+                Strings partition_batch(partition_ids.begin() + batch_begin, partition_ids.begin() + batch_end);
+                /// The read-through path populates the part cache as a side effect.
+                getContext()->getCnchCatalog()->getServerDataPartsInPartitions(table, partition_batch, ts, nullptr);
+
+                if (batch_interval_ms && batch_end < partition_ids.size())
+                    std::this_thread::sleep_for(std::chrono::milliseconds(batch_interval_ms));
+            }
+
+            LOG_DEBUG(
+                &Poco::Logger::get("PartCacheManager"),
+                "Prefetched part cache for table {} ({} partitions).",
+                table->getStorageID().getNameForLogs(),
+                partition_ids.size());
+        }
+        catch (...)
+        {
+            tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+        }
+    }
+}
+
+void PartCacheManager::runDiskCacheAutoTiering()
+{
+    /// Hands-free counterpart of ALTER DISK CACHE PRELOAD/DROP: for every hosted table
+    /// that opts in, rank its partitions by decayed query access counts and keep the top
+    /// ones preloaded in the worker disk cache, dropping cached data of partitions that
+    /// fell out of the hot set. Preloading a hot partition every cycle is close to free,
+    /// the worker side skips segments that are already cached, and it picks up parts
+    /// committed since the previous cycle.
+    for (const auto & meta_ptr : getAllActiveTables())
+    {
+        try
+        {
+            if (meta_ptr->cache_status != CacheStatus::LOADED)
+                continue;
+
+            auto table = getContext()->getCnchCatalog()->getTableByUUID(*getContext(), meta_ptr->table_uuid, TxnTimestamp::maxTS());
+            auto * storage = dynamic_cast<StorageCnchMergeTree *>(table.get());
+            if (!storage)
+                continue;
+            const auto storage_settings = storage->getSettings();
+            if (!storage_settings->enable_disk_cache_auto_tiering)
+                continue;
+
+            UInt64 now = time(nullptr);
+            UInt64 hot_window = storage_settings->disk_cache_auto_tiering_hot_window_seconds;
+            size_t max_hot = storage_settings->disk_cache_auto_tiering_max_hot_partitions;
+
+            std::vector<std::pair<UInt64, PartitionInfoPtr>> ranked;
+            std::vector<PartitionInfoPtr> demoted;
+            meta_ptr->forEachPartition([&](PartitionInfoPtr partition_info) {
+                UInt64 count = partition_info->access_count.load(std::memory_order_relaxed);
+                if (count)
+                    partition_info->access_count.store(count / 2, std::memory_order_relaxed);
+                bool recently_used = partition_info->last_access_time.load(std::memory_order_relaxed) + hot_window >= now;
+                if (recently_used && count)
+                    ranked.emplace_back(count, partition_info);
+                else if (partition_info->disk_cache_pinned)
+                    demoted.push_back(partition_info);
+            });
+
+            std::sort(ranked.begin(), ranked.end(), [](const auto & lhs, const auto & rhs) { return lhs.first > rhs.first; });
+            Strings hot_partitions;
+            for (size_t i = 0; i < ranked.size(); ++i)
+            {
+                if (i < max_hot)
+                    hot_partitions.push_back(ranked[i].second->partition_id);
+                else if (ranked[i].second->disk_cache_pinned)
+                    demoted.push_back(ranked[i].second);
+            }
+
+            TxnTimestamp ts = getContext()->tryGetTimestamp();
+            auto get_visible_parts = [&](const Strings & partition_ids) {
+                auto parts = getContext()->getCnchCatalog()->getServerDataPartsInPartitions(table, partition_ids, ts, nullptr);
+                return CnchPartsHelper::calcVisibleParts(parts, false);
+            };
+
+            if (!hot_partitions.empty())
+            {
+                /// Tables usually enable auto tiering without ingest-time preloading, so
+                /// fall back to preloading both meta and data when no level is configured.
+                UInt64 preload_level = storage_settings->parts_preload_level ? storage_settings->parts_preload_level : 3;
+                storage->sendPreloadTasks(getContext(), get_visible_parts(hot_partitions), /*enable_parts_sync_preload*/ false, preload_level, ts);
+                for (size_t i = 0; i < hot_partitions.size(); ++i)
+                    ranked[i].second->disk_cache_pinned = true;
+            }
+
+            if (!demoted.empty())
+            {
+                Strings demoted_partitions;
+                for (const auto & partition_info : demoted)
+                    demoted_partitions.push_back(partition_info->partition_id);
+                storage->sendDropDiskCacheTasks(getContext(), get_visible_parts(demoted_partitions));
+                for (const auto & partition_info : demoted)
+                    partition_info->disk_cache_pinned = false;
+            }
+
+            if (!hot_partitions.empty() || !demoted.empty())
+                LOG_DEBUG(
+                    &Poco::Logger::get("PartCacheManager"),
+                    "Disk cache auto tiering for table {}.{}: {} hot partitions preloaded, {} demoted.",
+                    meta_ptr->database,
+                    meta_ptr->table,
+                    hot_partitions.size(),
+                    demoted.size());
+        }
+        catch (...)
+        {
+            tryLogDebugCurrentException(__PRETTY_FUNCTION__);
         }
     }
 }
@@ -1109,7 +1365,8 @@ RetValueVec PartCacheManager::getDataInternal(
     const Strings & partitions,
     const Strings & all_existing_partitions,
     LoadFunc & load_func,
-    const UInt64 & ts)
+    const UInt64 & ts,
+    const CachedPartsFilter & parts_filter)
 {
     String type;
     CachePtr cache_ptr = nullptr;
@@ -1145,10 +1402,12 @@ RetValueVec PartCacheManager::getDataInternal(
                       if (cached)
                       {
                           hit_cache = true;
+                          const bool apply_filter = canApplyCachedPartsFilter(parts_filter, *cached);
                           for (auto it = cached->begin(); it != cached->end(); ++it)
                           {
                               const auto & part_wrapper_ptr = *it;
-                              if (this->isVisible(part_wrapper_ptr, ts))
+                              if (this->isVisible(part_wrapper_ptr, ts)
+                                  && (!apply_filter || passesCachedPartsFilter(parts_filter, part_wrapper_ptr)))
                               {
                                   Adapter adapter(storage, part_wrapper_ptr);
                                   parts.push_back(adapter.toData());
@@ -1375,7 +1634,8 @@ template <
         const TableMetaEntryPtr & meta_ptr,
         const Strings & partitions,
         LoadFunc & load_func,
-        const UInt64 & ts)
+        const UInt64 & ts,
+        const CachedPartsFilter & parts_filter)
     {
         String type;
         CachePtr cache_ptr = nullptr;
@@ -1416,10 +1676,12 @@ template <
                         auto cached = cache_ptr->get({uuid, partition_id});
                         if (cached)
                         {
+                            const bool apply_filter = canApplyCachedPartsFilter(parts_filter, *cached);
                             for (auto it = cached->begin(); it != cached->end(); ++it)
                             {
                                 const auto & data_wrapper_ptr = *it;
-                                if (this->isVisible(data_wrapper_ptr, ts))
+                                if (this->isVisible(data_wrapper_ptr, ts)
+                                    && (!apply_filter || passesCachedPartsFilter(parts_filter, data_wrapper_ptr)))
                                 {
                                     Adapter adapter(storage, data_wrapper_ptr);
                                     parts.push_back(adapter.toData());
@@ -1547,11 +1809,13 @@ template <
                         {
                             throw Exception("Cannot get already loaded parts from cache. Its a logic error.", ErrorCodes::LOGICAL_ERROR);
                         }
+                        const bool apply_filter = canApplyCachedPartsFilter(parts_filter, *cached);
                         for (auto it = cached->begin(); it != cached->end(); ++it)
                         {
                             const auto & part_wrapper_ptr = *it;
                             /// Only filter the parts when both commit_time and txnid are smaller or equal to ts (txnid is helpful for intermediate parts).
-                            if (this->isVisible(part_wrapper_ptr, ts))
+                            if (this->isVisible(part_wrapper_ptr, ts)
+                                && (!apply_filter || passesCachedPartsFilter(parts_filter, part_wrapper_ptr)))
                             {
                                 Adapter adapter(storage, part_wrapper_ptr);
                                 parts.push_back(adapter.toData());
@@ -1765,6 +2029,7 @@ void PartCacheManager::shutDown()
     active_table_loader->deactivate();
     meta_lock_cleaner->deactivate();
     trashed_active_tables_cleaner->deactivate();
+    disk_cache_tiering_task->deactivate();
 }
 
 StoragePtr PartCacheManager::getStorageFromCache(const UUID & uuid, const PairInt64 & topology_version)
@@ -1776,6 +2041,15 @@ StoragePtr PartCacheManager::getStorageFromCache(const UUID & uuid, const PairIn
     return res;
 }
 
+StoragePtr PartCacheManager::getStorageFromCache(const UUID & uuid, const PairInt64 & topology_version, const UInt64 ts)
+{
+    StoragePtr res;
+    TableMetaEntryPtr table_entry = getTableMeta(uuid);
+    if (table_entry && topology_version == table_entry->cache_version.get())
+        res = storageCachePtr->get(uuid, ts);
+    return res;
+}
+
 void PartCacheManager::insertStorageCache(const StorageID & storage_id, const StoragePtr storage, const UInt64 commit_ts, const PairInt64 & topology_version)
 {
     TableMetaEntryPtr table_entry = getTableMeta(storage_id.uuid);
@@ -1965,8 +2239,24 @@ void PartCacheManager::invalidDeleteBitmapCache(const UUID & uuid, const Strings
 }
 
 ServerDataPartsVector PartCacheManager::getOrSetServerDataPartsInPartitions(
-    const IStorage & table, const Strings & partitions, LoadPartsFunc && load_func, const UInt64 & ts, const PairInt64 & topology_version)
+    const IStorage & table,
+    const Strings & partitions,
+    LoadPartsFunc && load_func,
+    const UInt64 & ts,
+    const PairInt64 & topology_version,
+    const CachedPartsFilter & parts_filter)
 {
+    /// Feed the disk cache auto tiering statistics, see runDiskCacheAutoTiering.
+    if (auto meta_ptr = getTableMeta(table.getStorageUUID()))
+    {
+        UInt64 now = time(nullptr);
+        for (auto & [partition_id, partition_info] : meta_ptr->getPartitions(partitions))
+        {
+            partition_info->access_count.fetch_add(1, std::memory_order_relaxed);
+            partition_info->last_access_time.store(now, std::memory_order_relaxed);
+        }
+    }
+
     return getOrSetDataInPartitions<
         CnchDataPartCachePtr,
         ServerDataPart,
@@ -1974,7 +2264,7 @@ ServerDataPartsVector PartCacheManager::getOrSetServerDataPartsInPartitions(
         DataModelPartWrapper,
         ServerDataPartAdapter,
         LoadPartsFunc,
-        Vec<const ServerDataPart>>(table, partitions, std::move(load_func), ts, topology_version);
+        Vec<const ServerDataPart>>(table, partitions, std::move(load_func), ts, topology_version, parts_filter);
 }
 
 void PartCacheManager::insertDeleteBitmapsIntoCache(
@@ -182,12 +182,16 @@ public:
     using LoadPartsFunc = std::function<DataModelPartWrapperVector(const Strings &, const Strings &)>;
     using LoadDeleteBitmapsFunc = std::function<DataModelDeleteBitmapPtrVector(const Strings &, const Strings &)>;
 
+    /// If `parts_filter` is set, parts it rejects are dropped while scanning cached partitions,
+    /// before ServerDataPart objects are materialized. The filter never affects what is stored
+    /// in the cache, and tombstones as well as partitions with partial parts bypass it.
     ServerDataPartsVector getOrSetServerDataPartsInPartitions(
         const IStorage & table,
         const Strings & partitions,
         LoadPartsFunc && load_func,
         const UInt64 & ts,
-        const PairInt64 & topology_version);
+        const PairInt64 & topology_version,
+        const CachedPartsFilter & parts_filter = {});
 
     DeleteBitmapMetaPtrVector getOrSetDeleteBitmapInPartitions(
         const IStorage & table,
@@ -196,12 +200,25 @@ public:
         const UInt64 & ts,
         const PairInt64 & topology_version);
 
+    /// Whole-table visible-set cache keyed by the table's last data update time. Returns the
+    /// visible parts computed by a previous query when no part has committed since and the read
+    /// snapshot `ts` is not older than the cached one; nullptr on a miss. Only meaningful for
+    /// tables whose served parts are not mutated downstream (i.e. without a unique key).
+    std::shared_ptr<const ServerDataPartsVector> getCachedVisibleParts(const IStorage & table, UInt64 ts);
+
+    /// Publish the visible set computed at snapshot `ts` for reuse by later queries.
+    void setCachedVisibleParts(const IStorage & table, UInt64 ts, const ServerDataPartsVector & visible_parts);
+
     bool trySetCachedNHUTForUpdate(const UUID & uuid, const UInt64 & pts);
 
     bool checkIfCacheValidWithNHUT(const UUID & uuid, const UInt64 & nhut);
 
     StoragePtr getStorageFromCache(const UUID & uuid, const PairInt64 & topology_version);
 
+    /// Snapshot-aware lookup: returns the newest cached storage version visible at read
+    /// snapshot `ts`, so queries started before an ALTER keep their old version.
+    StoragePtr getStorageFromCache(const UUID & uuid, const PairInt64 & topology_version, const UInt64 ts);
+
     void insertStorageCache(const StorageID & storage_id, StoragePtr storage, UInt64 commit_ts, const PairInt64 & topology_version);
 
     void removeStorageCache(const String & database, const String & table = "");
@@ -238,11 +255,17 @@ private:
     BackgroundSchedulePool::TaskHolder meta_lock_cleaner; // remove unused meta lock periodically;
     /// release lock periodically;
     BackgroundSchedulePool::TaskHolder trashed_active_tables_cleaner;
+    /// maintain the worker disk cache of tables with auto tiering enabled;
+    BackgroundSchedulePool::TaskHolder disk_cache_tiering_task;
 
     CnchTablePartitionMetricsHelper table_partition_metrics;
     void cleanMetaLock();
     // load tables belongs to current server according to the topology. The task is performed asynchronously.
     void loadActiveTables();
+    // warm the part cache for tables newly assigned to this server (rate-limited batched Catalog reads).
+    void prefetchPartCacheForTables(const std::vector<StoragePtr> & tables);
+    // preload hot partitions into the worker disk cache and demote cold ones, per table policy.
+    void runDiskCacheAutoTiering();
 
     template <typename T>
     using Vec = std::vector<std::shared_ptr<T>>;
@@ -256,7 +279,12 @@ private:
         typename LoadFunc,
         typename RetValueVec>
     RetValueVec getOrSetDataInPartitions(
-        const IStorage & table, const Strings & partitions, LoadFunc && load_func, const UInt64 & ts, const PairInt64 & topology_version);
+        const IStorage & table,
+        const Strings & partitions,
+        LoadFunc && load_func,
+        const UInt64 & ts,
+        const PairInt64 & topology_version,
+        const CachedPartsFilter & parts_filter = {});
 
     // we supply two implementation for getting parts. Normally, we just use getPartsInternal. If the table parts number is huge we can
     // fetch parts sequentially for each partition by using getPartsByPartition.
@@ -274,7 +302,8 @@ private:
         const Strings & partitions,
         const Strings & all_existing_partitions,
         LoadFunc & load_func,
-        const UInt64 & ts);
+        const UInt64 & ts,
+        const CachedPartsFilter & parts_filter);
 
     inline static bool isVisible(const DB::DataModelPartWrapperPtr & part_wrapper_ptr, const UInt64 & ts);
     inline static bool isVisible(const ServerDataPartPtr & data_part, const UInt64 & ts);
@@ -294,7 +323,8 @@ private:
         const TableMetaEntryPtr & meta_ptr,
         const Strings & partitions,
         LoadFunc & load_func,
-        const UInt64 & ts);
+        const UInt64 & ts,
+        const CachedPartsFilter & parts_filter);
 
     void checkTimeLimit(Stopwatch & watch);
 
@@ -67,6 +67,11 @@ using InputOrderInfoPtr = std::shared_ptr<InputOrderInfo>;
 struct TreeRewriterResult;
 using TreeRewriterResultPtr = std::shared_ptr<const TreeRewriterResult>;
 
+class BloomFilterWithRange;
+/// Ready build-side runtime bloom filters keyed by probe column name.
+using RuntimeFilterBloomFilters = std::unordered_map<String, std::shared_ptr<BloomFilterWithRange>>;
+using RuntimeFilterBloomFiltersPtr = std::shared_ptr<RuntimeFilterBloomFilters>;
+
 class ReadInOrderOptimizer;
 using ReadInOrderOptimizerPtr = std::shared_ptr<const ReadInOrderOptimizer>;
 
@@ -213,6 +218,11 @@ struct SelectQueryInfo
 
     MergeTreeIndexContextPtr index_context;
 
+    /// Ready build-side runtime bloom filters, probed against primary key values that are
+    /// constant within a granule during index analysis so whole granules are pruned before any
+    /// column IO. See MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipIndexes.
+    RuntimeFilterBloomFiltersPtr runtime_filter_bloom_filters;
+
     /// Prepared sets are used for indices by storage engine.
     /// Example: x IN (1, 2, 3)
     PreparedSets sets;
@@ -1252,7 +1252,7 @@ CheckResults StorageCnchMergeTree::checkDataCommon(const ASTPtr & query, Context
     std::mutex mutex;
     CheckResults results;
 
-    auto assignment = assignCnchParts(worker_group, parts);
+    auto assignment = assignCnchParts(worker_group, parts, getStorageUUID());
 
     ThreadPool allocate_pool(std::min<UInt64>(local_context->getSettingsRef().parts_preallocate_pool_size, num_of_workers));
 
@@ -1321,13 +1321,37 @@ ServerDataPartsWithDBM StorageCnchMergeTree::getAllPartsWithDBM(ContextPtr local
             res = local_context->getCnchCatalog()->getAllServerDataPartsWithDBM(shared_from_this(), {0}, local_context.get());
             /// Fillter by commited parts and parts written by same explicit transaction
             res.first = filterPartsInExplicitTransaction(res.first, local_context);
+            res.first = CnchPartsHelper::calcVisibleParts(res.first, false, CnchPartsHelper::getLoggingOption(*local_context));
         }
         else
         {
-            res = local_context->getCnchCatalog()->getAllServerDataPartsWithDBM(
-                shared_from_this(), cur_txn->getTransactionID(), local_context.get());
+            /// Reuse the visible set from a previous query at the same table snapshot if possible.
+            /// Restricted to tables without unique key since readers attach delete bitmap metas to
+            /// the served parts, which must not happen on shared objects.
+            auto cache_manager = local_context->getPartCacheManager();
+            bool use_visible_parts_cache = local_context->getSettingsRef().enable_visible_parts_cache && cache_manager
+                && !getInMemoryMetadataPtr()->hasUniqueKey();
+            UInt64 snapshot_ts = cur_txn->getTransactionID();
+
+            std::shared_ptr<const ServerDataPartsVector> cached_visible_parts;
+            if (use_visible_parts_cache)
+                cached_visible_parts = cache_manager->getCachedVisibleParts(*this, snapshot_ts);
+
+            if (cached_visible_parts)
+            {
+                LOG_DEBUG(log, "Reused {} visible parts computed by a previous query at the same snapshot", cached_visible_parts->size());
+                res.first = *cached_visible_parts;
+            }
+            else
+            {
+                res = local_context->getCnchCatalog()->getAllServerDataPartsWithDBM(
+                    shared_from_this(), snapshot_ts, local_context.get());
+                res.first = CnchPartsHelper::calcVisibleParts(res.first, false, CnchPartsHelper::getLoggingOption(*local_context));
+
+                if (use_visible_parts_cache)
+                    cache_manager->setCachedVisibleParts(*this, snapshot_ts, res.first);
+            }
         }
-        res.first = CnchPartsHelper::calcVisibleParts(res.first, false, CnchPartsHelper::getLoggingOption(*local_context));
     }
     LOG_INFO(log, "Number of parts get from catalog: {}", res.first.size());
     return res;
@@ -1357,6 +1381,31 @@ ServerDataPartsWithDBM StorageCnchMergeTree::getAllPartsInPartitionsWithDBM(
         Strings & pruned_partitions = pruned_res.partitions;
         UInt64 total_partition_number = pruned_res.total_partition_number;
 
+        /// Push the minmax index condition down into the part cache scan, so that on a cache hit
+        /// pruned parts are never materialized as ServerDataPart objects. Tombstones and partial
+        /// parts bypass the filter inside the cache, and filterPartsByPartition() stays as the
+        /// complete pruning pass over whatever is returned.
+        CachedPartsFilter parts_filter;
+        auto metadata_snapshot = getInMemoryMetadataPtr();
+        if (local_context->getSettingsRef().enable_part_cache_minmax_pruning && metadata_snapshot->hasPartitionKey())
+        {
+            const auto & partition_key = metadata_snapshot->getPartitionKey();
+            auto minmax_idx_condition = std::make_shared<KeyCondition>(
+                query_info,
+                local_context,
+                getMinMaxColumnsNames(partition_key),
+                getMinMaxExpr(partition_key, ExpressionActionsSettings::fromContext(local_context)));
+
+            if (!minmax_idx_condition->alwaysUnknownOrTrue())
+                parts_filter = [minmax_idx_condition, minmax_columns_types = getMinMaxColumnsTypes(partition_key)](
+                                   const DataModelPartWrapperPtr & part_wrapper_ptr) {
+                    const auto & minmax_idx = part_wrapper_ptr->minmax_idx;
+                    if (!minmax_idx || !minmax_idx->initialized)
+                        return true;
+                    return minmax_idx_condition->checkInHyperrectangle(minmax_idx->hyperrectangle, minmax_columns_types).can_be_true;
+                };
+        }
+
         if (cur_txn->isSecondary())
         {
             /// TODO: snapshot read in interactive txn?
@@ -1370,7 +1419,7 @@ ServerDataPartsWithDBM StorageCnchMergeTree::getAllPartsInPartitionsWithDBM(
             }
             else
                 res = catalog->getServerDataPartsInPartitionsWithDBM(
-                    shared_from_this(), pruned_partitions, {0}, local_context.get());
+                    shared_from_this(), pruned_partitions, {0}, local_context.get(), Catalog::VisibilityLevel::Visible, {}, parts_filter);
             /// Fillter by commited parts and parts written by same explicit transaction
             all_parts = filterPartsInExplicitTransaction(all_parts, local_context);
         }
@@ -1388,7 +1437,7 @@ ServerDataPartsWithDBM StorageCnchMergeTree::getAllPartsInPartitionsWithDBM(
                 res = catalog->getServerDataPartsInPartitionsWithDBM(
                     shared_from_this(), pruned_partitions,
                     snapshot_ts ? TxnTimestamp(snapshot_ts) : local_context->getCurrentTransactionID(),
-                    local_context.get());
+                    local_context.get(), Catalog::VisibilityLevel::Visible, {}, parts_filter);
             if (snapshot_ts)
             {
                 auto trashed_parts_with_dbm = catalog->getTrashedPartsInPartitionsWithDBM(shared_from_this(), pruned_partitions, snapshot_ts);
@@ -3485,6 +3534,70 @@ std::optional<UInt64> StorageCnchMergeTree::totalRowsByPartitionPredicate(const
     return rows;
 }
 
+std::optional<std::pair<Field, Field>> StorageCnchMergeTree::minMaxValuesByPartitionPredicate(
+    const SelectQueryInfo & query_info, ContextPtr local_context, const String & column_name) const
+{
+    /// Similar to totalRowsByPartitionPredicate, but folds the partition minmax index of the
+    /// surviving parts instead of summing their row counts. Will return {} if the predicate is
+    /// not a partition predicate or the column is not covered by the minmax index.
+    const auto & metadata_snapshot = getInMemoryMetadataPtr();
+    /// Delete bitmaps may have removed the rows holding the stored extremes.
+    if (metadata_snapshot->hasUniqueKey())
+        return {};
+
+    auto minmax_columns = getMinMaxColumnsNames(metadata_snapshot->getPartitionKey());
+    auto minmax_column_it = std::find(minmax_columns.begin(), minmax_columns.end(), column_name);
+    if (minmax_column_it == minmax_columns.end())
+        return {};
+    size_t minmax_column_pos = minmax_column_it - minmax_columns.begin();
+
+    auto column_names_to_return = query_info.syntax_analyzer_result->requiredSourceColumns();
+    auto parts_with_dbm = getAllPartsInPartitionsWithDBM(column_names_to_return, local_context, query_info);
+    auto & parts = parts_with_dbm.first;
+
+    const auto & select = query_info.query->as<ASTSelectQuery &>();
+    std::optional<PartitionPruner> partition_pruner;
+    if (select.where() || select.prewhere())
+    {
+        /// Strict mode guarantees that every row of a surviving part satisfies the predicate,
+        /// so the minmax index of the surviving parts is exact under the filter.
+        partition_pruner.emplace(metadata_snapshot, query_info, local_context, true /* strict */);
+        if (partition_pruner->isUseless())
+            return {};
+    }
+
+    std::optional<std::pair<Field, Field>> res;
+    for (const auto & part : parts)
+    {
+        auto base_part = part->getBasePart();
+        if (base_part->isEmpty())
+            continue;
+        if (partition_pruner && partition_pruner->canBePruned(*base_part))
+            continue;
+
+        const auto & minmax_idx = base_part->minmax_idx();
+        if (!minmax_idx || !minmax_idx->initialized || minmax_column_pos >= minmax_idx->hyperrectangle.size())
+            return {};
+        const auto & range = minmax_idx->hyperrectangle[minmax_column_pos];
+        if (!range.left_included || !range.right_included)
+            return {};
+
+        if (!res)
+            res = std::make_pair(range.left, range.right);
+        else
+        {
+            if (range.left < res->first)
+                res->first = range.left;
+            if (res->second < range.right)
+                res->second = range.right;
+        }
+    }
+
+    if (res)
+        LOG_TRACE(log, "Shortcut: calculate min/max of column {} from part minmax metadata", column_name);
+    return res;
+}
+
 void StorageCnchMergeTree::checkMutationIsPossible(const MutationCommands & commands, const Settings & /*settings*/) const
 {
     static std::unordered_set<MutationCommand::Type> supported_mutations =
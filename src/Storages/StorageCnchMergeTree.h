@@ -57,6 +57,7 @@ public:
 
     std::optional<UInt64> totalRows(const ContextPtr &) const override;
     std::optional<UInt64> totalRowsByPartitionPredicate(const SelectQueryInfo &, ContextPtr) const override;
+    std::optional<std::pair<Field, Field>> minMaxValuesByPartitionPredicate(const SelectQueryInfo &, ContextPtr, const String & column_name) const override;
 
     StoragePolicyPtr getStoragePolicy(StorageLocation location) const override;
     const String & getRelativeDataPath(StorageLocation location) const override;
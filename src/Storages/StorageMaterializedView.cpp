@@ -264,6 +264,19 @@ void StorageMaterializedView::syncBaseTablePartitions(
         if (iter == previous_partitions.end() && current_partitions.empty())
             continue;
 
+        /// An empty hint list can also mean the hints were simply unavailable (e.g. the table's
+        /// host server could not be reached). Diffing it against a non-empty previous snapshot
+        /// would misread every partition as dropped and schedule a spurious full refresh, so
+        /// verify against the partition list in the catalog before trusting the emptiness.
+        if (iter != previous_partitions.end() && current_partitions.empty()
+            && !local_context->getCnchCatalog()->getPartitionIDs(storage, nullptr).empty())
+        {
+            LOG_WARNING(log,
+                "skip partition diff of base table-{}: no last modification time hints, but the table has partitions",
+                storage->getStorageID().getNameForLogs());
+            continue;
+        }
+
         if (iter != previous_partitions.end())
         {
             /// traverse current snapshot record partition diff on new or updated partitions
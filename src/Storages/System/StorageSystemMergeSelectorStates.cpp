@@ -0,0 +1,46 @@
+#include <Storages/System/StorageSystemMergeSelectorStates.h>
+
+#include <DataTypes/DataTypeDateTime.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Storages/MergeTree/MergeSelectorAdaptiveController.h>
+
+namespace DB
+{
+
+NamesAndTypesList StorageSystemMergeSelectorStates::getNamesAndTypes()
+{
+    return
+        {
+            {"table_uuid", std::make_shared<DataTypeString>()},
+            {"partition_id", std::make_shared<DataTypeString>()},
+            {"ewma_parts_number", std::make_shared<DataTypeFloat64>()},
+            {"parts_number_trend", std::make_shared<DataTypeFloat64>()},
+            {"ewma_write_amplification", std::make_shared<DataTypeFloat64>()},
+            {"base_multiplier", std::make_shared<DataTypeFloat64>()},
+            {"observations", std::make_shared<DataTypeUInt64>()},
+            {"selected_ranges", std::make_shared<DataTypeUInt64>()},
+            {"selected_bytes", std::make_shared<DataTypeUInt64>()},
+            {"last_update_time", std::make_shared<DataTypeDateTime>()}
+        };
+}
+
+void StorageSystemMergeSelectorStates::fillData(MutableColumns & res_columns, ContextPtr, const SelectQueryInfo &) const
+{
+    for (const auto & state : MergeSelectorAdaptiveController::instance().getStates())
+    {
+        size_t col = 0;
+        res_columns[col++]->insert(state.table_uuid);
+        res_columns[col++]->insert(state.partition_id);
+        res_columns[col++]->insert(state.ewma_parts_number);
+        res_columns[col++]->insert(state.parts_number_trend);
+        res_columns[col++]->insert(state.ewma_write_amplification);
+        res_columns[col++]->insert(state.base_multiplier);
+        res_columns[col++]->insert(state.observations);
+        res_columns[col++]->insert(state.selected_ranges);
+        res_columns[col++]->insert(state.selected_bytes);
+        res_columns[col++]->insert(state.last_update_time);
+    }
+}
+
+}
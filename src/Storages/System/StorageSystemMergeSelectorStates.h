@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Storages/System/IStorageSystemOneBlock.h>
+#include <common/shared_ptr_helper.h>
+
+namespace DB
+{
+
+/** Per-partition state of the adaptive merge selector feedback controller
+  * (MergeSelectorAdaptiveController): smoothed part count, its trend, realized write
+  * amplification and the base multiplier currently applied by DanceMergeSelector.
+  */
+class StorageSystemMergeSelectorStates : public shared_ptr_helper<StorageSystemMergeSelectorStates>,
+                                         public IStorageSystemOneBlock<StorageSystemMergeSelectorStates>
+{
+protected:
+    void fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo & query_info) const override;
+
+    using IStorageSystemOneBlock::IStorageSystemOneBlock;
+
+public:
+    std::string getName() const override
+    {
+        return "SystemMergeSelectorStates";
+    }
+
+    static NamesAndTypesList getNamesAndTypes();
+};
+
+}
@@ -0,0 +1,41 @@
+#include <Storages/System/StorageSystemQueryMemory.h>
+
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Interpreters/Context.h>
+#include <Interpreters/DistributedStages/RuntimeSegmentsStatus.h>
+#include <Interpreters/SegmentScheduler.h>
+
+namespace DB
+{
+NamesAndTypesList StorageSystemQueryMemory::getNamesAndTypes()
+{
+    return {
+        {"query_id", std::make_shared<DataTypeString>()},
+        {"segment_id", std::make_shared<DataTypeInt32>()},
+        /// Largest peak of a single parallel instance of the segment - the per-worker
+        /// footprint a memory limit has to accommodate.
+        {"peak_memory_usage", std::make_shared<DataTypeInt64>()},
+        {"cpu_micros", std::make_shared<DataTypeUInt64>()},
+        {"is_succeed", std::make_shared<DataTypeUInt8>()},
+        {"is_cancelled", std::make_shared<DataTypeUInt8>()},
+        {"code", std::make_shared<DataTypeInt32>()},
+    };
+}
+
+void StorageSystemQueryMemory::fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo &) const
+{
+    for (const auto & status : context->getSegmentScheduler()->getSegmentsStatusSnapshot())
+    {
+        size_t c = 0;
+        res_columns[c++]->insert(status.query_id);
+        res_columns[c++]->insert(status.segment_id);
+        res_columns[c++]->insert(status.metrics.peak_memory_usage);
+        res_columns[c++]->insert(status.metrics.cpu_micros);
+        res_columns[c++]->insert(status.is_succeed);
+        res_columns[c++]->insert(status.is_cancelled);
+        res_columns[c++]->insert(status.code);
+    }
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <Storages/System/IStorageSystemOneBlock.h>
+
+namespace DB
+{
+/** Implements `query_memory` system table, the coordinator-side memory ledger of
+  * distributed queries: per plan segment, the high-water mark of worker memory usage
+  * reported through sendPlanSegmentStatus. Covers queries the segment scheduler still
+  * tracks; finished queries are persisted to query_log as usual.
+  */
+class StorageSystemQueryMemory : public shared_ptr_helper<StorageSystemQueryMemory>, // NOLINT
+                                 public IStorageSystemOneBlock<StorageSystemQueryMemory>
+{
+public:
+    std::string getName() const override { return "StorageSystemQueryMemory"; }
+    static NamesAndTypesList getNamesAndTypes();
+
+protected:
+    using IStorageSystemOneBlock::IStorageSystemOneBlock;
+    void fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo & query_info) const override;
+};
+
+}
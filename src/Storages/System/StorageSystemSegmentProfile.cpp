@@ -0,0 +1,39 @@
+#include <Storages/System/StorageSystemSegmentProfile.h>
+
+#include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypeDateTime.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Interpreters/TraceLog.h>
+#include <Common/SegmentProfileSamples.h>
+
+namespace DB
+{
+
+NamesAndTypesList StorageSystemSegmentProfile::getNamesAndTypes()
+{
+    return {
+        {"query_id", std::make_shared<DataTypeString>()},
+        {"segment_id", std::make_shared<DataTypeInt32>()},
+        {"trace_type", std::make_shared<TraceLogElement::TraceDataType>(TraceLogElement::trace_values)},
+        {"trace", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"samples", std::make_shared<DataTypeUInt64>()},
+        {"last_event_time", std::make_shared<DataTypeDateTime>()},
+    };
+}
+
+void StorageSystemSegmentProfile::fillData(MutableColumns & res_columns, ContextPtr, const SelectQueryInfo &) const
+{
+    for (const auto & sample : SegmentProfileSamples::instance().get())
+    {
+        size_t i = 0;
+        res_columns[i++]->insert(sample.query_id);
+        res_columns[i++]->insert(sample.segment_id);
+        res_columns[i++]->insert(static_cast<UInt8>(sample.trace_type));
+        res_columns[i++]->insert(sample.trace);
+        res_columns[i++]->insert(sample.samples);
+        res_columns[i++]->insert(UInt64(sample.last_timestamp_ns / 1000000000));
+    }
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Storages/System/IStorageSystemOneBlock.h>
+
+namespace DB
+{
+
+/** Implements `segment_profile` system table, which exposes sampling profiler stacks
+  * aggregated per (query_id, plan segment). See SegmentProfileSamples.
+  */
+class StorageSystemSegmentProfile : public shared_ptr_helper<StorageSystemSegmentProfile>, // NOLINT
+                                    public IStorageSystemOneBlock<StorageSystemSegmentProfile>
+{
+public:
+    std::string getName() const override { return "StorageSystemSegmentProfile"; }
+    static NamesAndTypesList getNamesAndTypes();
+
+protected:
+    using IStorageSystemOneBlock::IStorageSystemOneBlock;
+    void fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo & query_info) const override;
+};
+
+}
@@ -46,6 +46,7 @@
 #include <Storages/System/StorageSystemDistributionQueue.h>
 #include <Storages/System/StorageSystemMacros.h>
 #include <Storages/System/StorageSystemMergeTreeSettings.h>
+#include <Storages/System/StorageSystemMergeSelectorStates.h>
 #include <Storages/System/StorageSystemMerges.h>
 #include <Storages/System/StorageSystemMetrics.h>
 #include <Storages/System/StorageSystemModels.h>
@@ -58,11 +59,13 @@
 #include <Storages/System/StorageSystemProcesses.h>
 #include <Storages/System/StorageSystemProjectionParts.h>
 #include <Storages/System/StorageSystemProjectionPartsColumns.h>
+#include <Storages/System/StorageSystemQueryMemory.h>
 #include <Storages/System/StorageSystemQueryQueue.h>
 #include <Storages/System/StorageSystemReplicas.h>
 #include <Storages/System/StorageSystemReplicatedFetches.h>
 #include <Storages/System/StorageSystemReplicationQueue.h>
 #include <Storages/System/StorageSystemSettings.h>
+#include <Storages/System/StorageSystemSegmentProfile.h>
 #include <Storages/System/StorageSystemTableEngines.h>
 #include <Storages/System/StorageSystemTableFunctions.h>
 #include <Storages/System/StorageSystemTables.h>
@@ -212,6 +215,7 @@ void attachSystemTablesLocal(IDatabase & system_database)
 #ifdef OS_LINUX
     attach<StorageSystemStackTrace>(system_database, "stack_trace");
 #endif
+    attach<StorageSystemSegmentProfile>(system_database, "segment_profile");
     attach<StorageSystemIOSchedulers>(system_database, "io_schedulers");
     attach<StorageSystemIOWorkers>(system_database, "io_workers");
 }
@@ -232,6 +236,7 @@ void attachSystemTablesServer(IDatabase & system_database, bool has_zookeeper)
     attach<StorageSystemVirtualWarehouseQueryQueue>(system_database, "virtual_warehouse_queue");
     attach<StorageSystemMetrics>(system_database, "metrics");
     attach<StorageSystemMerges>(system_database, "merges");
+    attach<StorageSystemMergeSelectorStates>(system_database, "merge_selector_states");
     attach<StorageSystemMutations>(system_database, "mutations");
     attach<StorageSystemReplicas>(system_database, "replicas");
     attach<StorageSystemReplicationQueue>(system_database, "replication_queue");
@@ -260,6 +265,7 @@ void attachSystemTablesServer(IDatabase & system_database, bool has_zookeeper)
     attach<StorageSystemMetastore>(system_database, "metastore");
     attach<StorageSystemBrokenTables>(system_database, "broken_tables");
     attach<StorageSystemBGThreads>(system_database, "bg_threads");
+    attach<StorageSystemQueryMemory>(system_database, "query_memory");
     attach<StorageSystemCnchParts>(system_database, "cnch_parts");
     attach<StorageSystemCnchTransactions>(system_database, "cnch_transactions");
     attach<StorageSystemCnchFilesystemLock>(system_database, "cnch_fs_lock");
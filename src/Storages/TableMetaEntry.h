@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <Catalog/CatalogUtils.h>
+#include <Catalog/DataModelPartWrapper_fwd.h>
 #include <Storages/CnchPartitionInfo.h>
 #include <Common/CurrentThread.h>
 #include <Common/RWLock.h>
@@ -86,6 +87,14 @@ struct TableMetaEntry
     ScanWaitFreeMap<String, PartitionInfoPtr> partitions;
     String server_vw_name;
 
+    /// Result of the last whole-table visibility calculation (CnchPartsHelper::calcVisibleParts).
+    /// Valid for any read snapshot >= visible_parts_cache_update_time as long as last_update_time
+    /// and the cache version have not moved, since no part can commit in between.
+    std::mutex visible_parts_cache_mutex;
+    UInt64 visible_parts_cache_update_time{0};
+    PairInt64 visible_parts_cache_version{0};
+    std::shared_ptr<const ServerDataPartsVector> visible_parts_cache;
+
     Catalog::PartitionMap getPartitions(const Strings & wanted_partition_ids);
     std::unordered_set<String> getDeletingPartitions();
     Strings getPartitionIDs();
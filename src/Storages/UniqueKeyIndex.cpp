@@ -14,6 +14,7 @@
  */
 
 #include <Storages/UniqueKeyIndex.h>
+#include <Storages/IndexFile/FilterPolicy.h>
 #include <Common/Coding.h>
 #include <Common/Exception.h>
 
@@ -28,6 +29,8 @@ UniqueKeyIndex::UniqueKeyIndex(const String & file_path, UniqueKeyIndexBlockCach
 {
     IndexFile::Options options;
     options.block_cache = std::move(block_cache);
+    /// Must match the policy used by the part writer, otherwise the persisted filter block is ignored
+    options.filter_policy.reset(IndexFile::NewBloomFilterPolicy(10));
     auto local_reader = std::make_unique<IndexFile::IndexFileReader>(options);
     auto status = local_reader->Open(file_path);
     if (!status.ok())
@@ -41,6 +44,8 @@ UniqueKeyIndex::UniqueKeyIndex(
     IndexFile::Options options;
     options.remote_file_cache = std::move(file_cache);
     options.block_cache = std::move(block_cache);
+    /// Must match the policy used by the part writer, otherwise the persisted filter block is ignored
+    options.filter_policy.reset(IndexFile::NewBloomFilterPolicy(10));
     auto local_reader = std::make_unique<IndexFile::IndexFileReader>(options);
     auto status = local_reader->Open(remote_file);
     if (!status.ok())
@@ -72,6 +77,13 @@ bool UniqueKeyIndex::lookup(const String & key, UInt32 & rowid)
     }
 }
 
+bool UniqueKeyIndex::mayContain(const String & key) const
+{
+    if (!index_reader)
+        return false;
+    return index_reader->MayContain(key);
+}
+
 std::unique_ptr<IndexFile::Iterator> UniqueKeyIndex::new_iterator(const IndexFile::ReadOptions & options)
 {
     if (!index_reader)
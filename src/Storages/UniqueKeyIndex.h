@@ -40,6 +40,10 @@ public:
     /// throws exception if error.
     bool lookup(const String & key, UInt32 & rowid);
 
+    /// return false only if the index provably doesn't contain the key,
+    /// judging by its bloom filter and without reading any data blocks.
+    bool mayContain(const String & key) const;
+
     /// Return an iterator over KVs in this file.
     /// Note: client should make sure the UniqueKeyIndex object lives longer than the returned iterator.
     std::unique_ptr<IndexFile::Iterator> new_iterator(const IndexFile::ReadOptions & options);
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <Storages/MergeTree/ActiveDataPartSet.h>
+
+using DB::ConcurrentActiveDataPartSet;
+using DB::Strings;
+
+static const auto format_version = DB::MERGE_TREE_DATA_MIN_FORMAT_VERSION_WITH_CUSTOM_PARTITIONING;
+
+TEST(ConcurrentActiveDataPartSet, AddRemoveAndCoverage)
+{
+    ConcurrentActiveDataPartSet parts(format_version);
+
+    EXPECT_TRUE(parts.add("all_1_1_0"));
+    EXPECT_TRUE(parts.add("all_2_2_0"));
+
+    Strings replaced;
+    EXPECT_TRUE(parts.add("all_1_2_1", &replaced));
+    EXPECT_EQ(replaced, (Strings{"all_1_1_0", "all_2_2_0"}));
+    EXPECT_EQ(parts.getParts(), (Strings{"all_1_2_1"}));
+
+    EXPECT_EQ(parts.getContainingPart("all_1_1_0"), "all_1_2_1");
+    EXPECT_TRUE(parts.remove("all_1_2_1"));
+    EXPECT_EQ(parts.size(), 0u);
+}
+
+TEST(ConcurrentActiveDataPartSet, SnapshotIsImmutable)
+{
+    ConcurrentActiveDataPartSet parts(format_version, {"all_1_1_0", "all_2_2_0"});
+
+    auto snapshot = parts.getSnapshot();
+    parts.removePartAndCoveredParts("all_1_2_1");
+
+    EXPECT_EQ(snapshot->size(), 2u);
+    EXPECT_EQ(parts.size(), 0u);
+}
+
+TEST(ConcurrentActiveDataPartSet, ConcurrentReadersAndWriter)
+{
+    ConcurrentActiveDataPartSet parts(format_version);
+
+    static constexpr size_t num_parts = 500;
+
+    std::thread writer([&]
+    {
+        for (size_t i = 0; i < num_parts; ++i)
+            parts.add("all_" + std::to_string(i + 1) + "_" + std::to_string(i + 1) + "_0");
+    });
+
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&]
+        {
+            size_t last_seen = 0;
+            while (last_seen < num_parts)
+            {
+                auto snapshot = parts.getSnapshot();
+                /// The set only grows here, so sizes observed by a reader never decrease.
+                ASSERT_GE(snapshot->size(), last_seen);
+                last_seen = snapshot->size();
+            }
+        });
+    }
+
+    writer.join();
+    for (auto & reader : readers)
+        reader.join();
+
+    EXPECT_EQ(parts.size(), num_parts);
+}
@@ -0,0 +1,60 @@
+#include <filesystem>
+
+#include <Storages/IndexFile/FilterPolicy.h>
+#include <Storages/IndexFile/IndexFileReader.h>
+#include <Storages/IndexFile/IndexFileWriter.h>
+
+#include <gtest/gtest.h>
+
+using namespace DB;
+
+namespace
+{
+
+std::string makeKey(int i)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "key-%06d", i);
+    return buf;
+}
+
+}
+
+TEST(IndexFileFilterTest, MayContainRespectsBloomFilter)
+{
+    auto path = (std::filesystem::temp_directory_path() / "gtest_index_file_filter.idx").string();
+    std::filesystem::remove(path);
+
+    IndexFile::Options options;
+    options.filter_policy.reset(IndexFile::NewBloomFilterPolicy(10));
+
+    IndexFile::IndexFileWriter writer(options);
+    ASSERT_TRUE(writer.Open(path).ok());
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_TRUE(writer.Add(makeKey(i * 2), "value").ok());
+    ASSERT_TRUE(writer.Finish().ok());
+
+    IndexFile::IndexFileReader reader(options);
+    ASSERT_TRUE(reader.Open(path).ok());
+
+    /// Present keys must always pass the filter.
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_TRUE(reader.MayContain(makeKey(i * 2)));
+
+    /// Absent keys should almost always be ruled out; with 10 bits per key the
+    /// false positive rate is about 1%, leave generous slack to avoid flakiness.
+    int false_positives = 0;
+    for (int i = 0; i < 1000; ++i)
+        false_positives += reader.MayContain(makeKey(i * 2 + 1));
+    EXPECT_LT(false_positives, 100);
+
+    /// Keys past the whole key range are rejected by the index block alone.
+    EXPECT_FALSE(reader.MayContain("zzz"));
+
+    /// Without a filter policy the probe must stay conservative.
+    IndexFile::IndexFileReader plain_reader(IndexFile::Options{});
+    ASSERT_TRUE(plain_reader.Open(path).ok());
+    EXPECT_TRUE(plain_reader.MayContain(makeKey(1)));
+
+    std::filesystem::remove(path);
+}
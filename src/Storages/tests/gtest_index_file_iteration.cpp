@@ -0,0 +1,126 @@
+#include <filesystem>
+
+#include <Storages/IndexFile/BufferedIterator.h>
+#include <Storages/IndexFile/Comparator.h>
+#include <Storages/IndexFile/IndexFileReader.h>
+#include <Storages/IndexFile/IndexFileWriter.h>
+
+#include <gtest/gtest.h>
+
+using namespace DB;
+
+namespace
+{
+
+std::string makeKey(int i)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "key-%06d", i);
+    return buf;
+}
+
+}
+
+TEST(IndexFileIterationTest, BufferedIteratorMatchesPlainIteration)
+{
+    auto path = (std::filesystem::temp_directory_path() / "gtest_index_file_iteration.idx").string();
+    std::filesystem::remove(path);
+
+    constexpr int num_keys = 5000;
+    IndexFile::Options options;
+    IndexFile::IndexFileWriter writer(options);
+    ASSERT_TRUE(writer.Open(path).ok());
+    for (int i = 0; i < num_keys; ++i)
+        ASSERT_TRUE(writer.Add(makeKey(i), "v" + std::to_string(i)).ok());
+    ASSERT_TRUE(writer.Finish().ok());
+
+    IndexFile::IndexFileReader reader(options);
+    ASSERT_TRUE(reader.Open(path).ok());
+
+    /// Full scans must yield identical sequences with any batch size.
+    for (size_t batch_size : {1, 7, 1024})
+    {
+        std::unique_ptr<IndexFile::Iterator> plain;
+        ASSERT_TRUE(reader.NewIterator(IndexFile::ReadOptions(), &plain).ok());
+        std::unique_ptr<IndexFile::Iterator> buffered;
+        ASSERT_TRUE(reader.NewIterator(IndexFile::ReadOptions(), &buffered).ok());
+        buffered.reset(IndexFile::NewBufferedIterator(IndexFile::BytewiseComparator(), buffered.release(), batch_size));
+
+        plain->SeekToFirst();
+        buffered->SeekToFirst();
+        while (plain->Valid())
+        {
+            ASSERT_TRUE(buffered->Valid());
+            EXPECT_EQ(plain->key().ToString(), buffered->key().ToString());
+            EXPECT_EQ(plain->value().ToString(), buffered->value().ToString());
+            plain->Next();
+            buffered->Next();
+        }
+        EXPECT_FALSE(buffered->Valid());
+        EXPECT_TRUE(buffered->status().ok());
+    }
+
+    /// NextUntil has to work within the buffer and across refills.
+    std::unique_ptr<IndexFile::Iterator> iter;
+    ASSERT_TRUE(reader.NewIterator(IndexFile::ReadOptions(), &iter).ok());
+    iter.reset(IndexFile::NewBufferedIterator(IndexFile::BytewiseComparator(), iter.release(), 16));
+    iter->SeekToFirst();
+
+    bool exact_match = false;
+    iter->NextUntil(makeKey(5), exact_match);
+    ASSERT_TRUE(iter->Valid());
+    EXPECT_TRUE(exact_match);
+    EXPECT_EQ(makeKey(5), iter->key().ToString());
+
+    iter->NextUntil(makeKey(3000), exact_match);
+    ASSERT_TRUE(iter->Valid());
+    EXPECT_TRUE(exact_match);
+    EXPECT_EQ(makeKey(3000), iter->key().ToString());
+
+    /// A missing key lands on its successor without an exact match.
+    exact_match = false;
+    iter->NextUntil(makeKey(3001) + "x", exact_match);
+    ASSERT_TRUE(iter->Valid());
+    EXPECT_FALSE(exact_match);
+    EXPECT_EQ(makeKey(3002), iter->key().ToString());
+
+    /// Past the last key the iterator becomes invalid.
+    iter->NextUntil("zzz", exact_match);
+    EXPECT_FALSE(iter->Valid());
+    EXPECT_TRUE(iter->status().ok());
+
+    std::filesystem::remove(path);
+}
+
+TEST(IndexFileIterationTest, NextBatchStopsAtLimit)
+{
+    auto path = (std::filesystem::temp_directory_path() / "gtest_index_file_iteration_batch.idx").string();
+    std::filesystem::remove(path);
+
+    IndexFile::Options options;
+    IndexFile::IndexFileWriter writer(options);
+    ASSERT_TRUE(writer.Open(path).ok());
+    for (int i = 0; i < 100; ++i)
+        ASSERT_TRUE(writer.Add(makeKey(i), "v").ok());
+    ASSERT_TRUE(writer.Finish().ok());
+
+    IndexFile::IndexFileReader reader(options);
+    ASSERT_TRUE(reader.Open(path).ok());
+    std::unique_ptr<IndexFile::Iterator> iter;
+    ASSERT_TRUE(reader.NewIterator(IndexFile::ReadOptions(), &iter).ok());
+    iter->SeekToFirst();
+
+    std::vector<std::pair<std::string, std::string>> out;
+    EXPECT_EQ(30u, iter->NextBatch(30, out));
+    ASSERT_TRUE(iter->Valid());
+    EXPECT_EQ(makeKey(30), iter->key().ToString());
+    EXPECT_EQ(makeKey(0), out.front().first);
+    EXPECT_EQ(makeKey(29), out.back().first);
+
+    /// Asking for more than remains drains the iterator.
+    EXPECT_EQ(70u, iter->NextBatch(1000, out));
+    EXPECT_FALSE(iter->Valid());
+    EXPECT_EQ(100u, out.size());
+
+    std::filesystem::remove(path);
+}
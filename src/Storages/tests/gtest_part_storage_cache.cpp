@@ -197,6 +197,56 @@ TEST_F(CacheManagerTest, GetTableWithTSFromCache)
     EXPECT_EQ(column_size_new, 2);
 }
 
+/***
+ * @brief Storage cache multi-version test
+ * An ALTER publishes a nullptr placeholder for the new commit ts. Queries reading at a
+ * snapshot before the ALTER should keep getting the old cached version; queries at the
+ * new snapshot miss once, then hit after the rebuilt storage fills in the placeholder.
+*/
+TEST_F(CacheManagerTest, MultiVersionStorageCache)
+{
+    UInt64 ts_1 = 1, ts_2 = 2;
+    std::shared_ptr<PartCacheManager> cache_manager = std::make_shared<PartCacheManager>(getContext().context, 0, true);
+    String query = "create table gztest.test UUID '61f0c404-5cb3-11e7-907b-a6006ad3dba0' (id Int32) ENGINE=CnchMergeTree order by id";
+    StoragePtr storage_v1 = CacheTestMock::createTable(query, getContext().context);
+    storage_v1->commit_time = TxnTimestamp(ts_1);
+
+    String query_new = "create table gztest.test UUID '61f0c404-5cb3-11e7-907b-a6006ad3dba0' (id Int32, s String) ENGINE=CnchMergeTree order by id";
+    StoragePtr storage_v2 = CacheTestMock::createTable(query_new, getContext().context);
+    storage_v2->commit_time = TxnTimestamp(ts_2);
+
+    auto topology_version = PairInt64{1, 1};
+    auto uuid = storage_v1->getStorageUUID();
+
+    cache_manager->mayUpdateTableMeta(*storage_v1, topology_version);
+    cache_manager->insertStorageCache(storage_v1->getStorageID(), storage_v1, ts_1, topology_version);
+
+    // mock alter table: publish a nullptr placeholder for the new version
+    cache_manager->insertStorageCache(storage_v1->getStorageID(), nullptr, ts_2, topology_version);
+
+    // a query reading at the old snapshot still hits the old version
+    auto storage_from_cache = cache_manager->getStorageFromCache(uuid, topology_version, ts_1);
+    EXPECT_NE(storage_from_cache, nullptr);
+    EXPECT_EQ(storage_from_cache->getInMemoryMetadataPtr()->getColumns().getAllPhysical().size(), 1);
+
+    // a query at the new snapshot misses and has to rebuild from the metastore
+    EXPECT_EQ(cache_manager->getStorageFromCache(uuid, topology_version, ts_2), nullptr);
+
+    // the rebuilt storage fills in the placeholder
+    cache_manager->insertStorageCache(storage_v2->getStorageID(), storage_v2, ts_2, topology_version);
+
+    // both snapshots now resolve to their own version
+    storage_from_cache = cache_manager->getStorageFromCache(uuid, topology_version, ts_2);
+    EXPECT_NE(storage_from_cache, nullptr);
+    EXPECT_EQ(storage_from_cache->getInMemoryMetadataPtr()->getColumns().getAllPhysical().size(), 2);
+
+    storage_from_cache = cache_manager->getStorageFromCache(uuid, topology_version, ts_1);
+    EXPECT_NE(storage_from_cache, nullptr);
+    EXPECT_EQ(storage_from_cache->getInMemoryMetadataPtr()->getColumns().getAllPhysical().size(), 1);
+
+    cache_manager->shutDown();
+}
+
 /***
  * @brief Storage cache test 2
  * Test contensions between get storage from cache and alter table.
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <Parsers/ExpressionListParsers.h>
+#include <Parsers/IAST.h>
+#include <Parsers/parseQuery.h>
+#include <Storages/MergeTree/MergeTreePointLookup.h>
+
+using namespace DB;
+
+namespace
+{
+
+ASTPtr parseExpression(const String & expression)
+{
+    ParserExpressionWithOptionalAlias parser(false, ParserSettings::CLICKHOUSE);
+    return parseQuery(parser, expression, 0, 0);
+}
+
+}
+
+TEST(PointLookupPredicate, SingleEquality)
+{
+    auto bound = MergeTreePointLookup::extractEqualityConjunction(parseExpression("k = 42"));
+    ASSERT_TRUE(bound.has_value());
+    ASSERT_EQ(bound->size(), 1u);
+    EXPECT_EQ(bound->at("k"), Field(UInt64(42)));
+}
+
+TEST(PointLookupPredicate, ConjunctionAndSwappedOperands)
+{
+    auto bound = MergeTreePointLookup::extractEqualityConjunction(parseExpression("a = 1 AND 'x' = b AND c = 2.5"));
+    ASSERT_TRUE(bound.has_value());
+    ASSERT_EQ(bound->size(), 3u);
+    EXPECT_EQ(bound->at("a"), Field(UInt64(1)));
+    EXPECT_EQ(bound->at("b"), Field(String("x")));
+    EXPECT_EQ(bound->at("c"), Field(Float64(2.5)));
+}
+
+TEST(PointLookupPredicate, RejectsOtherShapes)
+{
+    /// Not an equality.
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("k > 42")).has_value());
+    /// Disjunction.
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("a = 1 OR b = 2")).has_value());
+    /// One conjunct is not a point predicate.
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("a = 1 AND b IN (1, 2)")).has_value());
+    /// No literal operand.
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("a = b")).has_value());
+    /// Expression over the column.
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("toString(a) = '1'")).has_value());
+    /// Bare literal.
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("1")).has_value());
+}
+
+TEST(PointLookupPredicate, RejectsDoubleBinding)
+{
+    EXPECT_FALSE(MergeTreePointLookup::extractEqualityConjunction(parseExpression("a = 1 AND a = 2")).has_value());
+}
@@ -84,9 +84,39 @@ GetTimestampsResp TSOClient::getTimestamps(UInt32 size)
     return resp;
 }
 
+UInt64 TimestampWindow::nextTimestamp(const std::function<UInt64(UInt32)> & fetch_max, UInt32 size, UInt64 ttl_ms)
+{
+    std::lock_guard lock(mutex);
+    auto now = std::chrono::steady_clock::now();
+    if (next_ts <= end_ts && now < expires_at)
+        return next_ts++;
+
+    /// GetTimestamps vends a contiguous range ending at max_timestamp, and successive
+    /// batches are strictly increasing, so vended timestamps stay monotonic across refills.
+    UInt64 max_ts = fetch_max(size);
+    next_ts = max_ts - size + 1;
+    end_ts = max_ts;
+    expires_at = now + std::chrono::milliseconds(ttl_ms);
+    return next_ts++;
+}
+
 UInt64 getTSOResponse(const Context & context, TSORequestType type, size_t size)
 {
     const auto & config = context.getRootConfig();
+
+    UInt64 batch_window_size = config.tso_service.tso_batch_window_size;
+    if (type == TSORequestType::GetTimestamp && batch_window_size > 1)
+    {
+        /// Serve single-timestamp requests from a locally leased window: one GetTimestamps
+        /// RPC covers batch_window_size transactions instead of one RPC each. The short TTL
+        /// bounds how far vended timestamps can lag behind the TSO clock.
+        static TimestampWindow timestamp_window;
+        return timestamp_window.nextTimestamp(
+            [&context](UInt32 batch_size) { return getTSOResponse(context, TSORequestType::GetTimestamps, batch_size); },
+            batch_window_size,
+            config.tso_service.tso_batch_window_ttl_ms);
+    }
+
     int tso_max_retry = config.tso_service.tso_max_retry_count;
 
     int retry = tso_max_retry;
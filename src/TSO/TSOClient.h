@@ -17,10 +17,34 @@
 #include <CloudServices/RpcClientBase.h>
 #include <Protos/tso.pb.h>
 
+#include <chrono>
+#include <functional>
+#include <mutex>
+
 namespace DB::TSO
 {
 class TSO_Stub;
 
+/** Client-side lease of a contiguous timestamp window.
+  * Instead of one GetTimestamp RPC per transaction, a server fetches a batch of timestamps
+  * in one RPC and vends them locally in strictly increasing order. The window expires after
+  * a short TTL so the physical part of vended timestamps stays close to the TSO clock.
+  */
+class TimestampWindow
+{
+public:
+    /// Returns the next cached timestamp; when the window is empty or expired, refills it
+    /// with the range [fetch_max(size) - size + 1, fetch_max(size)]. Refills are serialized
+    /// under the mutex, so threads that miss together share one RPC.
+    UInt64 nextTimestamp(const std::function<UInt64(UInt32)> & fetch_max, UInt32 size, UInt64 ttl_ms);
+
+private:
+    std::mutex mutex;
+    UInt64 next_ts = 1;
+    UInt64 end_ts = 0;
+    std::chrono::steady_clock::time_point expires_at;
+};
+
 class TSOClient : public RpcClientBase
 {
 public:
@@ -19,8 +19,10 @@
 #include <mutex>
 #include <Catalog/Catalog.h>
 #include <IO/WriteBuffer.h>
+#include <Interpreters/Context.h>
 #include <Transaction/TransactionCleaner.h>
 #include <Transaction/TransactionCommon.h>
+#include <Transaction/TransactionCoordinatorRcCnch.h>
 #include <Common/Exception.h>
 #include <Common/ProfileEvents.h>
 #include <common/logger_useful.h>
@@ -179,6 +181,11 @@ TxnTimestamp CnchServerTransaction::commitV2()
     }
 }
 
+/// Note on conflict detection: precommit does not scan committed part lists. Write-write
+/// conflicts are prevented before this point — partition/table locks in LockManager (whose
+/// conflict check is a constant-time mode-mask test), pessimistic write intents in the
+/// metastore for DDL-like operations, and the CAS on the transaction record at commit.
+/// Actions here only persist their metadata; they never enumerate other transactions' parts.
 void CnchServerTransaction::precommit()
 {
     LOG_DEBUG(log, "Transaction {} starts pre commit\n", txn_record.txnID().toUInt64());
@@ -203,6 +210,31 @@ TxnTimestamp CnchServerTransaction::commit()
     if (isReadOnly() || !txn_record.isPrepared())
         throw Exception("Invalid commit operation", ErrorCodes::LOGICAL_ERROR);
 
+    /// Plain commits (no Kafka offsets, binlog, insertion labels or external CAS requests) can be
+    /// grouped with concurrent transactions, sharing one TSO fetch and one metastore write.
+    /// On a group CAS conflict fall through to the individual commit path below, which resolves
+    /// conflicts per record.
+    if (getContext()->getSettingsRef().enable_transaction_group_commit && consumer_group.empty() && binlog.binlog_file.empty()
+        && !insertion_label && extern_commit_functions.empty())
+    {
+        TransactionRecord target_record = getTransactionRecord();
+        target_record.setStatus(CnchTransactionStatus::Finished).setMainTableUUID(getMainTableUUID());
+        if (global_context->getCnchTransactionCoordinator().getGroupCommitter().tryCommit(txn_record, target_record))
+        {
+            txn_record = std::move(target_record);
+            ProfileEvents::increment(ProfileEvents::CnchTxnCommitted);
+            ProfileEvents::increment(ProfileEvents::CnchTxnFinishedTransactionRecord);
+            LOG_DEBUG(
+                log,
+                "Successfully committed transaction {} at {} as part of a commit group\n",
+                txn_record.txnID().toUInt64(),
+                txn_record.commitTs().toUInt64());
+            commitModifiedCount(this->modified_counter);
+            tryCleanMergeTagger();
+            return txn_record.commitTs();
+        }
+    }
+
     TxnTimestamp commit_ts = global_context->getTimestamp();
     int retry = MAX_RETRY;
     do
@@ -25,6 +25,7 @@
 #include <Transaction/TimestampCacheManager.h>
 #include <Transaction/TransactionCleaner.h>
 #include <Transaction/TransactionCommon.h>
+#include <Transaction/TransactionGroupCommitter.h>
 #include <Transaction/TransactionRecordCache.h>
 #include <Transaction/TxnTimestamp.h>
 #include <Common/HostWithPorts.h>
@@ -78,6 +79,11 @@ public:
               getContext()->getConfigRef().getUInt("cnch_transaction_cleaner_dm_max_threads", 32),
               getContext()->getConfigRef().getUInt("cnch_transaction_cleaner_dm_queue_size", 10000)))
         , finished_or_failed_txn_record_cache(std::make_unique<TransactionRecordCache>(getContext()->getConfigRef().getUInt("size_of_cached_txn_records", 20000)))
+        , group_committer(std::make_unique<TransactionGroupCommitter>(
+              getContext(),
+              getContext()->getConfigRef().getUInt("cnch_transaction_group_commit_max_size", 64),
+              getContext()->getConfigRef().getUInt("cnch_transaction_group_commit_wait_ms", 2),
+              getContext()->getConfigRef().getUInt("cnch_transaction_group_commit_max_inflight", 4)))
         , scan_interval(getContext()->getConfigRef().getInt("cnch_transaction_list_scan_interval", 10 * 60 * 1000)) // default 10 mins
         , log(&Poco::Logger::get("TransactionCoordinator"))
     {
@@ -171,9 +177,12 @@ public:
     void shutdown()
     {
         scan_active_txns_task->deactivate();
+        group_committer->shutdown();
         txn_cleaner->finalize();
     }
 
+    TransactionGroupCommitter & getGroupCommitter() const { return *group_committer; }
+
     void addTransaction(const TransactionCnchPtr & txn);
 
 private:
@@ -193,6 +202,7 @@ private:
     // TimestampCacheManagerPtr ts_cache_manager;
     TransactionCleanerPtr txn_cleaner;
     TransactionRecordCachePtr finished_or_failed_txn_record_cache;
+    std::unique_ptr<TransactionGroupCommitter> group_committer;
 
     // background tasks
     UInt64 scan_interval;
@@ -0,0 +1,132 @@
+#include <Transaction/TransactionGroupCommitter.h>
+
+#include <Catalog/Catalog.h>
+#include <Interpreters/Context.h>
+#include <Common/Exception.h>
+#include <Common/setThreadName.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+TransactionGroupCommitter::TransactionGroupCommitter(
+    const ContextPtr & context_, size_t max_group_size_, UInt64 max_wait_ms_, size_t max_inflight_groups_)
+    : WithContext(context_)
+    , max_group_size(std::max<size_t>(1, max_group_size_))
+    , max_wait_ms(max_wait_ms_)
+    , flush_pool(
+          std::max<size_t>(1, max_inflight_groups_),
+          std::max<size_t>(1, max_inflight_groups_),
+          std::max<size_t>(1, max_inflight_groups_))
+{
+    flush_thread = ThreadFromGlobalPool([this] { loop(); });
+}
+
+TransactionGroupCommitter::~TransactionGroupCommitter()
+{
+    try
+    {
+        shutdown();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log);
+    }
+}
+
+void TransactionGroupCommitter::shutdown()
+{
+    {
+        std::lock_guard lock(mutex);
+        if (is_shutdown)
+            return;
+        is_shutdown = true;
+    }
+    queue_cv.notify_all();
+    if (flush_thread.joinable())
+        flush_thread.join();
+    flush_pool.wait();
+}
+
+bool TransactionGroupCommitter::tryCommit(const TransactionRecord & expected_record, TransactionRecord & target_record)
+{
+    auto pending = std::make_shared<PendingCommit>();
+    pending->expected_record = expected_record;
+    pending->target_record = &target_record;
+    auto done = pending->done.get_future();
+
+    {
+        std::lock_guard lock(mutex);
+        if (is_shutdown)
+            return false;
+        queue.push_back(std::move(pending));
+    }
+    queue_cv.notify_all();
+
+    return done.get();
+}
+
+void TransactionGroupCommitter::loop()
+{
+    setThreadName("TxnGroupCommit");
+
+    while (true)
+    {
+        std::vector<PendingCommitPtr> group;
+        {
+            std::unique_lock lock(mutex);
+            queue_cv.wait(lock, [this] { return is_shutdown || !queue.empty(); });
+            if (queue.empty())
+                return; /// shutdown requested and everything flushed
+
+            /// Give concurrent commits a short window to join the group.
+            if (!is_shutdown && queue.size() < max_group_size && max_wait_ms)
+                queue_cv.wait_for(lock, std::chrono::milliseconds(max_wait_ms), [this] {
+                    return is_shutdown || queue.size() >= max_group_size;
+                });
+
+            size_t group_size = std::min(queue.size(), max_group_size);
+            group.assign(
+                std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.begin() + group_size));
+            queue.erase(queue.begin(), queue.begin() + group_size);
+        }
+
+        /// Hand the metastore write to the pool so the next group is collected while this one
+        /// is still in flight; groups confirm independently in whatever order their writes land.
+        flush_pool.scheduleOrThrowOnError([this, group = std::move(group)]() mutable { flushGroup(std::move(group)); });
+    }
+}
+
+void TransactionGroupCommitter::flushGroup(std::vector<PendingCommitPtr> group)
+{
+    try
+    {
+        /// One TSO fetch for the whole group.
+        TxnTimestamp commit_ts = getContext()->getTimestamp();
+
+        std::vector<std::pair<TransactionRecord, TransactionRecord>> expected_and_target;
+        expected_and_target.reserve(group.size());
+        for (auto & pending : group)
+        {
+            pending->target_record->setCommitTs(commit_ts);
+            expected_and_target.emplace_back(pending->expected_record, *pending->target_record);
+        }
+
+        bool committed = getContext()->getCnchCatalog()->setTransactionRecords(expected_and_target);
+        if (committed)
+            LOG_DEBUG(log, "Committed {} transactions as one group at {}", group.size(), commit_ts.toUInt64());
+        else
+            LOG_DEBUG(log, "Group of {} transactions hit a CAS conflict, participants fall back to individual commits", group.size());
+
+        for (auto & pending : group)
+            pending->done.set_value(committed);
+    }
+    catch (...)
+    {
+        auto exception = std::current_exception();
+        for (auto & pending : group)
+            pending->done.set_exception(exception);
+    }
+}
+
+}
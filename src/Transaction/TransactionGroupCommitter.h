@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Interpreters/Context_fwd.h>
+#include <Transaction/TransactionCommon.h>
+#include <Common/ThreadPool.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include <Poco/Logger.h>
+
+namespace DB
+{
+
+/// Groups concurrent transaction-record commits into one TSO fetch and one metastore write.
+///
+/// Micro-batch ingestion (thousands of small INSERTs per minute) is bottlenecked on the commit
+/// round trips: every transaction fetches its own commit timestamp and CAS-writes its own record.
+/// Transactions that reach the commit point within a short window are collected here and flushed
+/// as a single batch sharing one commit TS, which raises small-insert throughput several-fold.
+///
+/// Only the plain commit path may be grouped (no Kafka offsets, binlog, insertion labels or
+/// external CAS requests — those pack extra per-transaction requests into the record write).
+/// The metastore write is all-or-nothing: if any record in the batch hits a CAS conflict the
+/// whole batch is rolled back and every participant falls back to the individual commit path,
+/// which still handles conflicts and retries as before. Conflicts on transaction records are
+/// rare (only the owning session, the cleaner, or an abort touch them).
+///
+/// Group writes are pipelined: up to max_inflight_groups metastore writes run concurrently, so
+/// collecting the next group is not serialized behind the previous group's round trip and
+/// groups confirm out of order as their writes land. This is safe for snapshot isolation
+/// because visibility is decided purely by the commit TS in the durable record — each group
+/// still fetches its own TSO timestamp, and a transaction is acknowledged to its session only
+/// after its record is written, exactly as on the individual path.
+class TransactionGroupCommitter : WithContext
+{
+public:
+    TransactionGroupCommitter(const ContextPtr & context_, size_t max_group_size_, UInt64 max_wait_ms_, size_t max_inflight_groups_);
+    ~TransactionGroupCommitter();
+
+    /// Tries to commit the record as part of a group. On success updates target_record's commit
+    /// TS and returns true. Returns false when the caller must fall back to the individual
+    /// commit path (group CAS conflict or committer shut down). Throws on metastore errors.
+    bool tryCommit(const TransactionRecord & expected_record, TransactionRecord & target_record);
+
+    void shutdown();
+
+private:
+    struct PendingCommit
+    {
+        TransactionRecord expected_record;
+        TransactionRecord * target_record;
+        std::promise<bool> done;
+    };
+    using PendingCommitPtr = std::shared_ptr<PendingCommit>;
+
+    void loop();
+    void flushGroup(std::vector<PendingCommitPtr> group);
+
+    const size_t max_group_size;
+    const UInt64 max_wait_ms;
+
+    std::mutex mutex;
+    std::condition_variable queue_cv;
+    std::vector<PendingCommitPtr> queue;
+    bool is_shutdown = false;
+
+    /// Runs the metastore writes; sized to max_inflight_groups so the collector thread blocks
+    /// (backpressure) instead of queueing unboundedly when the metastore falls behind.
+    ThreadPool flush_pool;
+    ThreadFromGlobalPool flush_thread;
+
+    Poco::Logger * log = &Poco::Logger::get("TransactionGroupCommitter");
+};
+
+}
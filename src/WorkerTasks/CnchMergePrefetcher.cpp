@@ -1,5 +1,6 @@
 #include <WorkerTasks/CnchMergePrefetcher.h>
 
+#include <Common/Stopwatch.h>
 #include <Common/escapeForFileName.h>
 #include <DataTypes/DataTypeMap.h>
 #include <IO/WriteBufferFromFile.h>
@@ -13,9 +14,18 @@ namespace DB
 
 void CnchMergePrefetcher::PartFutureFiles::tryPrefetchStage(int stage)
 {
-    for (auto* future_segment : prefetch_stages[stage])
+    auto & pending_segments = prefetch_stages[stage];
+    size_t scheduled = 0;
+    for (auto* future_segment : pending_segments)
+    {
+        if (!prefetcher.tryAcquireSegmentBudget(future_segment->size))
+            break; /// out of prefetch budget, the window advances once the reader releases segments
+        future_segment->budget_charged = true;
         schedulePrefetchTask(*future_segment);
-    prefetch_stages[stage].clear(); /// each segment could only be prefetched once
+        ++scheduled;
+    }
+    /// each segment could only be prefetched once, keep the ones beyond the window for the next call
+    pending_segments.erase(pending_segments.begin(), pending_segments.begin() + scheduled);
 }
 
 void CnchMergePrefetcher::PartFutureFiles::schedulePrefetchTask(FutureSegment & future_segment)
@@ -45,6 +55,8 @@ void CnchMergePrefetcher::PartFutureFiles::schedulePrefetchTask(FutureSegment &
 
             if (!cancel_flag.load(std::memory_order_relaxed))
             {
+                future_segment.ready_at_ns = clock_gettime_ns(CLOCK_MONOTONIC);
+                future_segment.prefetcher->updateDownloadLatency(stopwatch.elapsed());
                 LOG_TRACE(&Poco::Logger::get("CnchMergePrefetcher"), "Stage {} "
                     "copied to {}, elapsed {} ms.", stage, local_path,
                     stopwatch.elapsedMilliseconds());
@@ -92,12 +104,25 @@ CnchMergePrefetcher::FutureSegment * CnchMergePrefetcher::PartFutureFiles::getFu
     if (!future_segment)
         throw Exception("Future segment for " + stream_name + " not found", ErrorCodes::LOGICAL_ERROR);
 
-    for (int i = future_segment->stage; i < std::min(future_segment->stage + 2, static_cast<int>(prefetch_stages.size())); ++i)
+    int depth = prefetcher.prefetchDepth();
+    for (int i = future_segment->stage; i < std::min(future_segment->stage + depth, static_cast<int>(prefetch_stages.size())); ++i)
         tryPrefetchStage(i);
 
     if (!future_segment->valid())
-        throw Exception("Future segment is not valid: " + future_segment->reservation->getDisk()->getPath() \
-            + future_segment->data_relative_path, ErrorCodes::LOGICAL_ERROR);
+    {
+        /// The merge cursor reached a segment beyond the prefetch window: wait until enough
+        /// segments are released, then schedule it alone.
+        auto & pending_segments = prefetch_stages[future_segment->stage];
+        auto it = std::find(pending_segments.begin(), pending_segments.end(), future_segment);
+        if (it == pending_segments.end())
+            throw Exception("Future segment is not valid: " + future_segment->reservation->getDisk()->getPath() \
+                + future_segment->data_relative_path, ErrorCodes::LOGICAL_ERROR);
+        pending_segments.erase(it);
+
+        prefetcher.acquireSegmentBudget(future_segment->size);
+        future_segment->budget_charged = true;
+        schedulePrefetchTask(*future_segment);
+    }
 
     return future_segment;
 }
@@ -112,6 +137,11 @@ void CnchMergePrefetcher::PartFutureFiles::releaseSegment(const String & stream_
             LOG_TRACE(&Poco::Logger::get("CnchMergePrefetcher"), "Removing {}",
                 future_segment->reservation->getDisk()->getPath() + future_segment->data_relative_path);
             future_segment->reservation->getDisk()->removeRecursive(future_segment->data_relative_path);
+            if (future_segment->budget_charged)
+            {
+                future_segment->budget_charged = false;
+                prefetcher.releaseSegmentBudget(future_segment->size);
+            }
         }
         else if (future_segment->future_access < 0)
         {
@@ -314,12 +344,100 @@ void CnchMergePrefetcher::submitDataPart(
     future_files->tryPrefetchStage(0);
 }
 
+void CnchMergePrefetcher::waitSegment(const FutureSegment & segment)
+{
+    Stopwatch watch;
+    segment.done.get();
+    UInt64 waited_ns = watch.elapsed();
+
+    /// Anything beyond scheduling noise means the merge cursor caught up with the
+    /// downloads, so look one more stage ahead next time.
+    constexpr UInt64 stall_threshold_ns = 1'000'000;
+    if (waited_ns > stall_threshold_ns)
+    {
+        int depth = prefetch_depth.load(std::memory_order_relaxed);
+        if (depth < max_prefetch_depth)
+            prefetch_depth.store(depth + 1, std::memory_order_relaxed);
+        idle_streak.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    /// No wait: if segments keep sitting ready for longer than one download takes,
+    /// the window is deeper than the consumption rate requires; back off so the
+    /// inflight budget is not hogged by one fast tier.
+    UInt64 ready_at = segment.ready_at_ns;
+    UInt64 latency = download_latency_ewma_ns.load(std::memory_order_relaxed);
+    UInt64 now = clock_gettime_ns(CLOCK_MONOTONIC);
+    if (ready_at && latency && now > ready_at + latency)
+    {
+        if (idle_streak.fetch_add(1, std::memory_order_relaxed) + 1 >= 8)
+        {
+            int depth = prefetch_depth.load(std::memory_order_relaxed);
+            if (depth > min_prefetch_depth)
+                prefetch_depth.store(depth - 1, std::memory_order_relaxed);
+            idle_streak.store(0, std::memory_order_relaxed);
+        }
+    }
+    else
+        idle_streak.store(0, std::memory_order_relaxed);
+}
+
+void CnchMergePrefetcher::updateDownloadLatency(UInt64 sample_ns)
+{
+    /// Races between concurrent segment tasks only lose samples, which is fine for an EWMA.
+    UInt64 old = download_latency_ewma_ns.load(std::memory_order_relaxed);
+    download_latency_ewma_ns.store(old ? (3 * old + sample_ns) / 4 : sample_ns, std::memory_order_relaxed);
+}
+
+bool CnchMergePrefetcher::tryAcquireSegmentBudget(size_t bytes)
+{
+    if (!max_inflight_bytes)
+        return true;
+
+    std::lock_guard lock(inflight_mutex);
+    /// Always admit when nothing is in flight, otherwise a segment larger than the budget would never be scheduled
+    if (inflight_bytes && inflight_bytes + bytes > max_inflight_bytes)
+        return false;
+    inflight_bytes += bytes;
+    return true;
+}
+
+void CnchMergePrefetcher::acquireSegmentBudget(size_t bytes)
+{
+    if (!max_inflight_bytes)
+        return;
+
+    std::unique_lock lock(inflight_mutex);
+    inflight_cv.wait(lock, [&] {
+        return cancel.load(std::memory_order_relaxed) || !inflight_bytes || inflight_bytes + bytes <= max_inflight_bytes;
+    });
+    inflight_bytes += bytes;
+}
+
+void CnchMergePrefetcher::releaseSegmentBudget(size_t bytes)
+{
+    if (!max_inflight_bytes)
+        return;
+
+    {
+        std::lock_guard lock(inflight_mutex);
+        inflight_bytes -= std::min(bytes, inflight_bytes);
+    }
+    inflight_cv.notify_all();
+}
+
 CnchMergePrefetcher::CnchMergePrefetcher(const Context & context_, const MergeTreeMetaBase & storage_, const String & temp_dir_)
     : storage(storage_)
     , segment_size(context_.getSettingsRef().cnch_merge_prefetch_segment_size)
+    , max_inflight_bytes(context_.getSettingsRef().cnch_merge_prefetch_max_inflight_bytes)
     , temp_dir_rel_path(temp_dir_.empty() ? temp_dir_ : (temp_dir_.back() == '/' ? temp_dir_ : temp_dir_ + '/'))
     , read_settings(context_.getReadSettings())
 {
+    /// Merge reads belong to the background class, cap them with their own throttler
+    /// instead of the foreground query one installed by getReadSettings().
+    if (auto merge_throttler = context_.getMergeRemoteReadThrottler())
+        read_settings.remote_throttler = merge_throttler;
+
     StoragePolicyPtr policy = storage.getStoragePolicy(IStorage::StorageLocation::AUXILITY);
     for (const DiskPtr& disk : policy->getDisks())
     {
@@ -334,6 +452,7 @@ CnchMergePrefetcher::CnchMergePrefetcher(const Context & context_, const MergeTr
 CnchMergePrefetcher::~CnchMergePrefetcher()
 {
     cancel.store(1, std::memory_order_relaxed);
+    inflight_cv.notify_all(); /// wake up readers blocked on the prefetch budget
 
     for (auto & [part, future_files] : part_to_future_files)
         for (auto & [mutation, future_segments] : future_files->mutation_segments)
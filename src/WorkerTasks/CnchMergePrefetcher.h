@@ -4,6 +4,7 @@
 #include <Disks/IDisk.h>
 #include <Storages/MergeTree/IMergeTreeDataPart_fwd.h>
 
+#include <condition_variable>
 #include <future>
 #include <mutex>
 
@@ -41,6 +42,7 @@ public:
         const IMergeTreeDataPart * part{nullptr};
         int future_access{0};
         int stage{-1};
+        bool budget_charged{false};
 
         ReservationPtr reservation;
         // Segment relative path to disk root path, including table paths, etc
@@ -48,12 +50,14 @@ public:
         off_t offset{0};
         size_t size{0};
         std::shared_future<void> done;
+        /// Set by the prefetch task right before `done` becomes ready; reads are ordered by done.get().
+        UInt64 ready_at_ns{0};
 
         auto valid() const { return done.valid(); }
 
         std::tuple<DiskPtr, String, off_t> get() const
         {
-            done.get();
+            prefetcher->waitSegment(*this);
             return {reservation->getDisk(), data_relative_path, offset};
         }
     };
@@ -95,10 +99,27 @@ public:
 
     ~CnchMergePrefetcher();
 
+    /// Waits for the segment and tunes the stage lookahead from what it observed: a blocked
+    /// wait means the merge cursor outruns the downloads (deepen the window), a segment that
+    /// sat ready for longer than one download repeatedly means the window is over-provisioned
+    /// (shrink it). Converges near in-flight ~= download latency / consumption interval without
+    /// a per-tier config, whether segments come from the disk cache or cross-region S3.
+    void waitSegment(const FutureSegment & segment);
+    void updateDownloadLatency(UInt64 sample_ns);
+    int prefetchDepth() const { return prefetch_depth.load(std::memory_order_relaxed); }
+
 
 private:
+    /// Prefetch window: while max_inflight_bytes != 0, segments are only scheduled while the total
+    /// size of unreleased segments stays under the budget. The window advances as the reader
+    /// releases segments, so the on-disk footprint of a merge is bounded regardless of part size.
+    bool tryAcquireSegmentBudget(size_t bytes);
+    void acquireSegmentBudget(size_t bytes);
+    void releaseSegmentBudget(size_t bytes);
+
     const MergeTreeMetaBase & storage;
     size_t segment_size;
+    size_t max_inflight_bytes;
     String temp_dir_rel_path;
 
     ReadSettings read_settings;
@@ -106,6 +127,17 @@ private:
     std::unordered_map<String, std::unique_ptr<PartFutureFiles>> part_to_future_files;
     std::set<String> columns_may_inject;
 
+    std::mutex inflight_mutex;
+    std::condition_variable inflight_cv;
+    size_t inflight_bytes{0};
+
+    /// Stage lookahead controller state, see waitSegment().
+    static constexpr int min_prefetch_depth = 1;
+    static constexpr int max_prefetch_depth = 8;
+    std::atomic<int> prefetch_depth{2};
+    std::atomic<UInt64> download_latency_ewma_ns{0};
+    std::atomic<int> idle_streak{0};
+
     std::atomic_int cancel{0};
 };
 
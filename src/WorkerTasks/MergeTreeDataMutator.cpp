@@ -275,7 +275,8 @@ IMutableMergeTreeDataPartPtr MergeTreeDataMutator::mutatePartToTemporaryPart(
     MutationCommands for_interpreter;
     MutationCommands for_file_renames;
 
-    splitMutationCommands(source_part, metadata_snapshot, commands, for_interpreter, for_file_renames);
+    NameSet recalc_only_columns;
+    splitMutationCommands(source_part, metadata_snapshot, commands, for_interpreter, for_file_renames, recalc_only_columns);
 
     /// We always do mutateSomePartColumns but not mutateAllPartColumns for CnchMergeTree, so no need to read delete_bitmap. 
     auto storage_from_source_part = StorageFromMergeTreeDataPart::create(source_part, /*without_delete_bitmap*/ true);
@@ -299,6 +300,14 @@ IMutableMergeTreeDataPartPtr MergeTreeDataMutator::mutatePartToTemporaryPart(
         if (in)
             in->setProgressCallback(MutateProgressCallback(manipulation_entry, watch_prev_elapsed, stage_progress));
         updated_header = interpreter->getUpdatedHeader();
+
+        /// Columns read only as inputs for rebuilding projections keep their data
+        /// unchanged: drop them from the mutation header so their streams are not
+        /// rewritten into the new part. The mutating stream still carries them,
+        /// which is all writeWithProjections needs.
+        for (const auto & column_name : recalc_only_columns)
+            if (updated_header.has(column_name))
+                updated_header.erase(column_name);
     }
 
     auto new_part_info = source_part->info;
@@ -417,7 +426,8 @@ void MergeTreeDataMutator::splitMutationCommands(
     const StorageMetadataPtr & metadata_snapshot,
     const MutationCommands & commands,
     MutationCommands & for_interpreter,
-    MutationCommands & for_file_renames)
+    MutationCommands & for_file_renames,
+    NameSet & recalc_only_columns)
 {
     ColumnsDescription part_columns(part->getColumns());
     NameSet mutated_columns;
@@ -462,14 +472,15 @@ void MergeTreeDataMutator::splitMutationCommands(
         }
     }
 
-    addColumnsForRecalculateProjections(part, metadata_snapshot, mutated_columns, for_interpreter);
+    addColumnsForRecalculateProjections(part, metadata_snapshot, mutated_columns, for_interpreter, recalc_only_columns);
 }
 
 void MergeTreeDataMutator::addColumnsForRecalculateProjections(
     MergeTreeData::DataPartPtr source_part,
     const StorageMetadataPtr & metadata_snapshot,
     const NameSet & mutated_columns,
-    MutationCommands & for_interpreter)
+    MutationCommands & for_interpreter,
+    NameSet & recalc_only_columns)
 {
     ColumnsDescription part_columns(source_part->getColumns());
     auto checksums = source_part->getChecksums();
@@ -490,6 +501,7 @@ void MergeTreeDataMutator::addColumnsForRecalculateProjections(
             }
             if (mutate)
             {
+                const auto & metadata_columns = metadata_snapshot->getColumns();
                 for (const auto & col : projection_cols)
                 {
                     if (!mutated_columns.count(col))
@@ -497,6 +509,16 @@ void MergeTreeDataMutator::addColumnsForRecalculateProjections(
                         const auto & column = part_columns.getPhysical(col);
                         for_interpreter.emplace_back(
                             MutationCommand{.type = MutationCommand::Type::READ_COLUMN, .column_name = column.name, .data_type = column.type});
+
+                        /// The interpreter may rewrite a MATERIALIZED column (the cascade stage
+                        /// rebuilds all of them once any is affected) and a column with a TTL is
+                        /// rewritten when the TTL is materialized. Their streams must stay in the
+                        /// mutation header, so never mark them as recalc-only.
+                        bool may_be_rewritten = metadata_columns.has(column.name)
+                            && (metadata_columns.get(column.name).default_desc.kind == ColumnDefaultKind::Materialized
+                                || metadata_columns.get(column.name).ttl);
+                        if (!may_be_rewritten)
+                            recalc_only_columns.emplace(column.name);
                     }
                 }
             }
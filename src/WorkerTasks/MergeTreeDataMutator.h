@@ -69,7 +69,8 @@ private:
         const StorageMetadataPtr & metadata_snapshot,
         const MutationCommands & commands,
         MutationCommands & for_interpreter,
-        MutationCommands & for_file_renames);
+        MutationCommands & for_file_renames,
+        NameSet & recalc_only_columns);
 
     /// Apply commands to source_part i.e. remove and rename some columns in
     /// source_part and return set of files, that have to be removed or renamed
@@ -159,12 +160,15 @@ private:
         TableLockHolder & holder,
         ContextPtr context);
 
-    // For projections that needed to be recaluated, we collect all the columns that are depended on by the projections
+    // For projections that needed to be recaluated, we collect all the columns that are depended on by the projections.
+    // Columns added here are only inputs for rebuilding the projections: they are collected
+    // into recalc_only_columns so the caller can keep their unchanged streams out of the new part.
     static void addColumnsForRecalculateProjections(
         MergeTreeData::DataPartPtr part,
         const StorageMetadataPtr & metadata_snapshot,
         const NameSet & mutated_columns,
-        MutationCommands & for_interpreter);
+        MutationCommands & for_interpreter,
+        NameSet & recalc_only_columns);
 
 public :
     /// Initialize and write to disk new part fields like checksums, columns, etc.
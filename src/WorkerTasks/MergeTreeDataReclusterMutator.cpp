@@ -68,7 +68,10 @@ MergeTreeMutableDataPartsVector MergeTreeDataReclusterMutator::executeOnSinglePa
     Block block;
     while(checkOperationIsNotCanceled(manipulation_entry) && (block = input_stream->read()))
     {
-        auto splitted_parts = cloud_stream->convertBlockIntoDataParts(block);
+        /// All rows keep the source part's partition, only their bucket assignment changes.
+        /// Passing the partition down skips re-evaluating the partition key per row and
+        /// splits each block by cluster key into exactly the affected buckets.
+        auto splitted_parts = cloud_stream->convertBlockIntoDataParts(block, false, &part->partition.value);
         for (auto & new_part : splitted_parts)
         {
             new_part->info.mutation = part->info.mutation;
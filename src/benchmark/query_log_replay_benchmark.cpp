@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-as-null-pointer-constant"
+#include <benchmark/benchmark.h>
+#pragma clang diagnostic pop
+
+#include <Client/Connection.h>
+#include <DataStreams/RemoteBlockInputStream.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteBufferFromFile.h>
+#include <IO/WriteHelpers.h>
+#include <Common/Stopwatch.h>
+#include <Common/tests/gtest_global_context.h>
+#include <common/types.h>
+
+/** Replays a production query-log extract against a live server and scores latency
+  * percentiles per query class, so an upgraded or re-configured virtual warehouse can be
+  * qualified against a recorded baseline instead of weeks of production mirroring.
+  *
+  * The workload file is a TSV extract of system.query_log, one line per query:
+  *
+  *     SELECT toUnixTimestamp64Micro(query_start_time_microseconds),
+  *            toString(normalized_query_hash), query
+  *     FROM system.query_log
+  *     WHERE type = 'QueryFinish' AND is_initial_query
+  *     ORDER BY query_start_time_microseconds
+  *     FORMAT TSV
+  *
+  * (the second column is free-form - any label works as the query class). Queries are
+  * replayed with their original relative timing (scalable with the TIME_SCALE variable) on
+  * a bounded set of worker connections, which reproduces the original concurrency as long
+  * as MAX_CONCURRENCY is not lower than the recorded peak.
+  *
+  * Environment variables:
+  *     CLICKHOUSE_REPLAY_QUERY_LOG       - path of the TSV extract (required)
+  *     CLICKHOUSE_REPLAY_HOST / _PORT    - target server, default localhost:9000
+  *     CLICKHOUSE_REPLAY_USER / _PASSWORD / _DATABASE
+  *     CLICKHOUSE_REPLAY_TIME_SCALE      - stretch factor for inter-query gaps, 0 replays
+  *                                         as fast as the workers allow (default 1.0)
+  *     CLICKHOUSE_REPLAY_MAX_CONCURRENCY - worker connections, default 16
+  *     CLICKHOUSE_REPLAY_BASELINE        - baseline report to compare against; a run whose
+  *                                         p95/p99 exceed the baseline by more than the
+  *                                         threshold fails with the offending classes
+  *     CLICKHOUSE_REPLAY_REPORT          - where to write this run's report (same format)
+  *     CLICKHOUSE_REPLAY_REGRESSION_THRESHOLD - allowed slowdown ratio, default 1.10
+  */
+namespace DB
+{
+
+namespace
+{
+
+constexpr char ENV_REPLAY_QUERY_LOG[] = "CLICKHOUSE_REPLAY_QUERY_LOG";
+constexpr char ENV_REPLAY_HOST[] = "CLICKHOUSE_REPLAY_HOST";
+constexpr char ENV_REPLAY_PORT[] = "CLICKHOUSE_REPLAY_PORT";
+constexpr char ENV_REPLAY_USER[] = "CLICKHOUSE_REPLAY_USER";
+constexpr char ENV_REPLAY_PASSWORD[] = "CLICKHOUSE_REPLAY_PASSWORD";
+constexpr char ENV_REPLAY_DATABASE[] = "CLICKHOUSE_REPLAY_DATABASE";
+constexpr char ENV_REPLAY_TIME_SCALE[] = "CLICKHOUSE_REPLAY_TIME_SCALE";
+constexpr char ENV_REPLAY_MAX_CONCURRENCY[] = "CLICKHOUSE_REPLAY_MAX_CONCURRENCY";
+constexpr char ENV_REPLAY_BASELINE[] = "CLICKHOUSE_REPLAY_BASELINE";
+constexpr char ENV_REPLAY_REPORT[] = "CLICKHOUSE_REPLAY_REPORT";
+constexpr char ENV_REPLAY_REGRESSION_THRESHOLD[] = "CLICKHOUSE_REPLAY_REGRESSION_THRESHOLD";
+
+const char * envOr(const char * name, const char * fallback)
+{
+    const char * value = std::getenv(name);
+    return value ? value : fallback;
+}
+
+struct ReplayEntry
+{
+    UInt64 start_micros;
+    String query_class;
+    String query;
+};
+
+std::vector<ReplayEntry> loadQueryLog(const String & path)
+{
+    std::vector<ReplayEntry> entries;
+    ReadBufferFromFile in(path);
+    while (!in.eof())
+    {
+        ReplayEntry entry;
+        readIntText(entry.start_micros, in);
+        assertChar('\t', in);
+        readEscapedString(entry.query_class, in);
+        assertChar('\t', in);
+        readEscapedString(entry.query, in);
+        if (!in.eof())
+            assertChar('\n', in);
+        entries.push_back(std::move(entry));
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto & lhs, const auto & rhs) { return lhs.start_micros < rhs.start_micros; });
+    return entries;
+}
+
+double percentile(std::vector<double> & sorted_latencies, double level)
+{
+    if (sorted_latencies.empty())
+        return 0.0;
+    size_t index = static_cast<size_t>(level * static_cast<double>(sorted_latencies.size() - 1));
+    return sorted_latencies[index];
+}
+
+struct ClassReport
+{
+    size_t count = 0;
+    size_t failures = 0;
+    double p50 = 0;
+    double p95 = 0;
+    double p99 = 0;
+};
+
+std::map<String, ClassReport> loadBaseline(const String & path)
+{
+    std::map<String, ClassReport> baseline;
+    ReadBufferFromFile in(path);
+    while (!in.eof())
+    {
+        String query_class;
+        ClassReport report;
+        readEscapedString(query_class, in);
+        assertChar('\t', in);
+        readIntText(report.count, in);
+        assertChar('\t', in);
+        readIntText(report.failures, in);
+        assertChar('\t', in);
+        readFloatText(report.p50, in);
+        assertChar('\t', in);
+        readFloatText(report.p95, in);
+        assertChar('\t', in);
+        readFloatText(report.p99, in);
+        if (!in.eof())
+            assertChar('\n', in);
+        baseline.emplace(std::move(query_class), report);
+    }
+    return baseline;
+}
+
+void writeReport(const String & path, const std::map<String, ClassReport> & reports)
+{
+    WriteBufferFromFile out(path);
+    for (const auto & [query_class, report] : reports)
+    {
+        writeEscapedString(query_class, out);
+        writeChar('\t', out);
+        writeIntText(report.count, out);
+        writeChar('\t', out);
+        writeIntText(report.failures, out);
+        writeChar('\t', out);
+        writeFloatText(report.p50, out);
+        writeChar('\t', out);
+        writeFloatText(report.p95, out);
+        writeChar('\t', out);
+        writeFloatText(report.p99, out);
+        writeChar('\n', out);
+    }
+    out.finalize();
+}
+
+struct QueryResult
+{
+    double latency_ms = 0;
+    bool ok = false;
+};
+
+/// Runs all entries with their original relative timing (scaled) on `concurrency` worker
+/// connections and returns one result slot per entry.
+std::vector<QueryResult> replay(
+    const std::vector<ReplayEntry> & entries, ContextPtr global_context, double time_scale, size_t concurrency)
+{
+    std::vector<QueryResult> results(entries.size());
+    const UInt64 base_micros = entries.front().start_micros;
+
+    std::atomic<size_t> next_entry{0};
+    Stopwatch replay_clock;
+
+    auto worker = [&]()
+    {
+        Connection connection(
+            envOr(ENV_REPLAY_HOST, "localhost"),
+            static_cast<UInt16>(std::stoul(envOr(ENV_REPLAY_PORT, "9000"))),
+            envOr(ENV_REPLAY_DATABASE, "default"),
+            envOr(ENV_REPLAY_USER, "default"),
+            envOr(ENV_REPLAY_PASSWORD, ""),
+            /* cluster_ */ "",
+            /* cluster_secret_ */ "",
+            "query_log_replay",
+            Protocol::Compression::Enable,
+            Protocol::Secure::Disable);
+
+        while (true)
+        {
+            size_t i = next_entry.fetch_add(1);
+            if (i >= entries.size())
+                break;
+
+            if (time_scale > 0)
+            {
+                auto scheduled_micros = static_cast<UInt64>(static_cast<double>(entries[i].start_micros - base_micros) * time_scale);
+                UInt64 now_micros = replay_clock.elapsedMicroseconds();
+                if (scheduled_micros > now_micros)
+                    std::this_thread::sleep_for(std::chrono::microseconds(scheduled_micros - now_micros));
+            }
+
+            Stopwatch query_watch;
+            try
+            {
+                RemoteBlockInputStream stream(connection, entries[i].query, {}, global_context);
+                stream.readPrefix();
+                while (Block block = stream.read())
+                    ;
+                stream.readSuffix();
+                results[i].ok = true;
+            }
+            catch (...)
+            {
+                /// A failed query is scored into the failure count of its class; the replay goes on.
+                connection.disconnect();
+            }
+            results[i].latency_ms = query_watch.elapsedMilliseconds();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(concurrency);
+    for (size_t i = 0; i < concurrency; ++i)
+        workers.emplace_back(worker);
+    for (auto & thread : workers)
+        thread.join();
+
+    return results;
+}
+
+void BM_QueryLogReplay(benchmark::State & state)
+{
+    const char * workload_path = std::getenv(ENV_REPLAY_QUERY_LOG);
+    if (!workload_path)
+    {
+        state.SkipWithError("CLICKHOUSE_REPLAY_QUERY_LOG is not set");
+        return;
+    }
+
+    std::vector<ReplayEntry> entries;
+    try
+    {
+        entries = loadQueryLog(workload_path);
+    }
+    catch (const std::exception & e)
+    {
+        state.SkipWithError(e.what());
+        return;
+    }
+    if (entries.empty())
+    {
+        state.SkipWithError("workload file contains no queries");
+        return;
+    }
+
+    const double time_scale = std::stod(envOr(ENV_REPLAY_TIME_SCALE, "1.0"));
+    const size_t concurrency = std::stoul(envOr(ENV_REPLAY_MAX_CONCURRENCY, "16"));
+    const double regression_threshold = std::stod(envOr(ENV_REPLAY_REGRESSION_THRESHOLD, "1.10"));
+    const auto & context_holder = getContext();
+
+    std::map<String, ClassReport> reports;
+    for (auto _ : state)
+    {
+        auto results = replay(entries, context_holder.context, time_scale, concurrency);
+
+        std::map<String, std::vector<double>> latencies_per_class;
+        reports.clear();
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            auto & report = reports[entries[i].query_class];
+            ++report.count;
+            if (results[i].ok)
+                latencies_per_class[entries[i].query_class].push_back(results[i].latency_ms);
+            else
+                ++report.failures;
+        }
+        for (auto & [query_class, latencies] : latencies_per_class)
+        {
+            std::sort(latencies.begin(), latencies.end());
+            auto & report = reports[query_class];
+            report.p50 = percentile(latencies, 0.50);
+            report.p95 = percentile(latencies, 0.95);
+            report.p99 = percentile(latencies, 0.99);
+        }
+    }
+
+    std::vector<double> all_p99;
+    size_t total_failures = 0;
+    for (const auto & [query_class, report] : reports)
+    {
+        all_p99.push_back(report.p99);
+        total_failures += report.failures;
+    }
+    std::sort(all_p99.begin(), all_p99.end());
+    state.counters["classes"] = static_cast<double>(reports.size());
+    state.counters["failures"] = static_cast<double>(total_failures);
+    state.counters["worst_class_p99_ms"] = all_p99.empty() ? 0.0 : all_p99.back();
+
+    if (const char * report_path = std::getenv(ENV_REPLAY_REPORT))
+        writeReport(report_path, reports);
+
+    if (const char * baseline_path = std::getenv(ENV_REPLAY_BASELINE))
+    {
+        String regressions;
+        for (const auto & [query_class, baseline] : loadBaseline(baseline_path))
+        {
+            auto it = reports.find(query_class);
+            if (it == reports.end())
+                continue;
+            const auto & current = it->second;
+            if (current.p95 > baseline.p95 * regression_threshold || current.p99 > baseline.p99 * regression_threshold)
+                regressions += fmt::format(
+                    "{}: p95 {:.1f} -> {:.1f} ms, p99 {:.1f} -> {:.1f} ms; ",
+                    query_class, baseline.p95, current.p95, baseline.p99, current.p99);
+        }
+        if (!regressions.empty())
+            state.SkipWithError(("latency regression against baseline: " + regressions).c_str());
+    }
+}
+
+BENCHMARK(BM_QueryLogReplay)->Unit(benchmark::kSecond)->Iterations(1)->UseRealTime();
+
+}
+}